@@ -1,21409 +1,6053 @@
-﻿#pragma once
+#pragma once
 #include "epd_driver.h"
 /*
 Created with
- fontconvert.py FiraSans 14 FiraSans-Regular.ttf --compress
+ fontconvert.py FiraSans 14 FiraSans-Regular.ttf --compress --kerning
 As 'FiraSans' with available 228 characters
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~┬á┬í┬ó┬ú┬ñ┬Ñ┬ª┬º┬¿┬⌐┬¬┬½┬¼┬¡┬«┬»┬░┬▒┬▓┬│┬┤┬╡┬╢┬╖┬╕┬╣┬║┬╗┬╝┬╜┬╛┬┐├Ç├ü├é├â├ä├à├å├ç├ê├ë├è├ï├î├ì├Ä├Å├É├æ├Æ├ô├ö├ò├û├ù├ÿ├Ö├Ü├¢├£├¥├₧├ƒ├á├í├ó├ú├ñ├Ñ├ª├º├¿├⌐├¬├½├¼├¡├«├»├░├▒├▓├│├┤├╡├╢├╖├╕├╣├║├╗├╝├╜├╛├┐ΓÇÆΓÇôΓÇöΓÇòΓÇûΓÇÿΓÇÖΓÇÜΓÇ£ΓÇ¥ΓÇ₧ΓÇáΓÇíΓÇóΓÇªΓÇ░ΓÇ╣ΓÇ║ΓÇ┐ΓüäΓüèΓåÉΓåæΓåÆΓåôΓçªΓçºΓç¿Γç⌐Γç¬ΓîªΓîºΓî¿Γî½ΓÅÄΓû»Γùè
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ ¡¢£¤¥¦§¨©ª«¬­®¯°±²³´µ¶·¸¹º»¼½¾¿ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÐÑÒÓÔÕÖ×ØÙÚÛÜÝÞßàáâãäåæçèéêëìíîïðñòóôõö÷øùúûüýþÿ‒–—―‖‘’‚“”„†‡•…‰‹›‿⁄⁊←↑→↓⇦⇧⇨⇩⇪⌦⌧⌨⌫⏎▯◊
 */
+const UnicodeInterval FiraSans_Intervals[] = {
+    { 0x20, 0x7E, 0x0 },
+    { 0xA0, 0xFF, 0x5F },
+    { 0x2012, 0x2016, 0xBF },
+    { 0x2018, 0x201A, 0xC4 },
+    { 0x201C, 0x201E, 0xC7 },
+    { 0x2020, 0x2022, 0xCA },
+    { 0x2026, 0x2026, 0xCD },
+    { 0x2030, 0x2030, 0xCE },
+    { 0x2039, 0x203A, 0xCF },
+    { 0x203F, 0x203F, 0xD1 },
+    { 0x2044, 0x2044, 0xD2 },
+    { 0x204A, 0x204A, 0xD3 },
+    { 0x2190, 0x2193, 0xD4 },
+    { 0x21E6, 0x21EA, 0xD8 },
+    { 0x2326, 0x2328, 0xDD },
+    { 0x232B, 0x232B, 0xE0 },
+    { 0x23CE, 0x23CE, 0xE1 },
+    { 0x25AF, 0x25AF, 0xE2 },
+    { 0x25CA, 0x25CA, 0xE3 },
+};
+const uint16_t FiraSans_AsciiGlyphs[128] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+};
 const uint8_t FiraSans_Bitmaps[21136] = {
-    0x78,
-    0x9C,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x01,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF0,
-    0x9F,
-    0xE1,
-    0xC3,
-    0x7B,
-    0x28,
-    0x7A,
-    0x70,
-    0x1F,
-    0x84,
-    0x2E,
-    0x00,
-    0xD1,
-    0x79,
-    0x10,
-    0x3A,
-    0x00,
-    0x44,
-    0xFB,
-    0x41,
-    0x68,
-    0x03,
-    0x10,
-    0xAD,
-    0x67,
-    0x80,
-    0x00,
-    0x20,
-    0xFB,
-    0xDB,
-    0x7F,
-    0xF6,
-    0x6F,
-    0xFF,
-    0xD9,
-    0x16,
-    0xEC,
-    0x67,
-    0x00,
-    0x00,
-    0xF1,
-    0xD9,
-    0x1E,
-    0x18,
-    0x78,
-    0x9C,
-    0x01,
-    0x28,
-    0x00,
-    0xD7,
-    0xFF,
-    0xF3,
-    0x9F,
-    0x00,
-    0xFF,
-    0x0D,
-    0xF2,
-    0x8F,
-    0x00,
-    0xFE,
-    0x0C,
-    0xF1,
-    0x8F,
-    0x00,
-    0xFD,
-    0x0C,
-    0xF1,
-    0x7F,
-    0x00,
-    0xFD,
-    0x0B,
-    0xF0,
-    0x6F,
-    0x00,
-    0xFC,
-    0x0A,
-    0xF0,
-    0x5F,
-    0x00,
-    0xFB,
-    0x09,
-    0xE0,
-    0x4F,
-    0x00,
-    0xFA,
-    0x08,
-    0xD0,
-    0x3F,
-    0x00,
-    0xF9,
-    0x07,
-    0xA2,
-    0x21,
-    0x13,
-    0x23,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0xF8,
-    0xCB,
-    0xCE,
-    0xF0,
-    0xC1,
-    0x9E,
-    0x81,
-    0x81,
-    0xE1,
-    0x3F,
-    0x0B,
-    0xC3,
-    0x67,
-    0x79,
-    0x06,
-    0x06,
-    0x81,
-    0xFF,
-    0x4C,
-    0x0C,
-    0x5F,
-    0xF9,
-    0x18,
-    0x18,
-    0x1C,
-    0xFE,
-    0x33,
-    0x30,
-    0x7C,
-    0xE7,
-    0x61,
-    0x28,
-    0xF8,
-    0x0F,
-    0x06,
-    0x5C,
-    0x30,
-    0x5A,
-    0x60,
-    0xF3,
-    0x7E,
-    0x63,
-    0xE3,
-    0x7F,
-    0x16,
-    0x4C,
-    0x0C,
-    0x07,
-    0xFA,
-    0xC1,
-    0x5A,
-    0x18,
-    0x2E,
-    0xE4,
-    0x83,
-    0xB5,
-    0x30,
-    0x7C,
-    0xF0,
-    0x67,
-    0x30,
-    0x00,
-    0x6A,
-    0x61,
-    0xF8,
-    0xA8,
-    0xCF,
-    0x10,
-    0x00,
-    0xA2,
-    0x3F,
-    0xF3,
-    0x33,
-    0x14,
-    0xDC,
-    0x07,
-    0xD2,
-    0x40,
-    0xB3,
-    0x26,
-    0xEC,
-    0x67,
-    0x60,
-    0xF8,
-    0x09,
-    0xD6,
-    0x3E,
-    0x1F,
-    0x4E,
-    0x1B,
-    0xFE,
-    0xB1,
-    0x34,
-    0xFE,
-    0x9C,
-    0x2F,
-    0xCC,
-    0xC0,
-    0xF0,
-    0x97,
-    0x0D,
-    0xA4,
-    0x05,
-    0x62,
-    0x3D,
-    0x3F,
-    0x03,
-    0x83,
-    0x02,
-    0xAA,
-    0xF5,
-    0x0C,
-    0x00,
-    0x4C,
-    0xA9,
-    0x3F,
-    0x8B,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0xF8,
-    0xC2,
-    0xCF,
-    0x00,
-    0x06,
-    0x38,
-    0x68,
-    0x81,
-    0xEF,
-    0xF6,
-    0x20,
-    0x4A,
-    0xE1,
-    0xF7,
-    0xFF,
-    0xFF,
-    0x7D,
-    0x40,
-    0xFA,
-    0xF3,
-    0x7F,
-    0x20,
-    0xD0,
-    0x63,
-    0x60,
-    0xF8,
-    0xB7,
-    0x9E,
-    0xD9,
-    0xF1,
-    0x57,
-    0x3C,
-    0x83,
-    0xC3,
-    0x7F,
-    0x2E,
-    0x06,
-    0x06,
-    0x07,
-    0x36,
-    0x86,
-    0x82,
-    0xFF,
-    0xAC,
-    0x60,
-    0xD5,
-    0x09,
-    0xFF,
-    0xD9,
-    0xC0,
-    0xB4,
-    0xC1,
-    0x7F,
-    0x59,
-    0x88,
-    0x29,
-    0xBF,
-    0xDF,
-    0x8B,
-    0x83,
-    0xE9,
-    0x8D,
-    0xFF,
-    0xFF,
-    0x47,
-    0x83,
-    0x19,
-    0x57,
-    0xFF,
-    0xFF,
-    0xAF,
-    0x03,
-    0x33,
-    0x9A,
-    0xFF,
-    0xFD,
-    0xE7,
-    0x01,
-    0x33,
-    0x02,
-    0xFE,
-    0xCD,
-    0x87,
-    0xA8,
-    0x7D,
-    0xF8,
-    0x9F,
-    0x11,
-    0x4C,
-    0x4F,
-    0xF8,
-    0xCF,
-    0x0C,
-    0xA6,
-    0x1B,
-    0xFE,
-    0xB3,
-    0x80,
-    0xE9,
-    0x0D,
-    0xFF,
-    0x99,
-    0x13,
-    0xFC,
-    0x40,
-    0x2E,
-    0x7A,
-    0x0F,
-    0x54,
-    0x92,
-    0x63,
-    0xB2,
-    0xF4,
-    0x7F,
-    0x3C,
-    0x83,
-    0xC1,
-    0x5F,
-    0x90,
-    0x3B,
-    0xD8,
-    0x81,
-    0x9A,
-    0x5F,
-    0xFF,
-    0x7F,
-    0xAF,
-    0x89,
-    0xCF,
-    0xFD,
-    0x70,
-    0xBA,
-    0x08,
-    0xA8,
-    0x9A,
-    0x01,
-    0x00,
-    0x7B,
-    0xF7,
-    0x3E,
-    0xAD,
-    0x78,
-    0x9C,
-    0x3D,
-    0xCF,
-    0x3B,
-    0x0A,
-    0xC2,
-    0x40,
-    0x10,
-    0x80,
-    0xE1,
-    0x7F,
-    0x1B,
-    0x89,
-    0x0F,
-    0x42,
-    0x3C,
-    0x81,
-    0xE2,
-    0x05,
-    0xC4,
-    0xD2,
-    0x4A,
-    0x8B,
-    0xF4,
-    0xF1,
-    0x00,
-    0x42,
-    0x2A,
-    0x7B,
-    0x6F,
-    0xA2,
-    0x78,
-    0x81,
-    0x78,
-    0x04,
-    0x6F,
-    0x10,
-    0x0B,
-    0x4B,
-    0x21,
-    0x1E,
-    0xC1,
-    0xCE,
-    0xCE,
-    0x60,
-    0x04,
-    0x13,
-    0xB6,
-    0x70,
-    0x9D,
-    0x4C,
-    0x82,
-    0x0B,
-    0xB3,
-    0x0C,
-    0x7C,
-    0xF3,
-    0x60,
-    0xA0,
-    0x79,
-    0x1B,
-    0x89,
-    0x8B,
-    0x5B,
-    0xCB,
-    0x1F,
-    0x7C,
-    0x3D,
-    0xB6,
-    0xCE,
-    0xB9,
-    0x2E,
-    0x9C,
-    0x72,
-    0x43,
-    0x91,
-    0x86,
-    0x36,
-    0x82,
-    0x4F,
-    0x0C,
-    0x95,
-    0xCF,
-    0x3D,
-    0x21,
-    0x70,
-    0x3D,
-    0xB0,
-    0x7D,
-    0x8E,
-    0x99,
-    0xBA,
-    0xA6,
-    0xA9,
-    0x3A,
-    0xA5,
-    0xCF,
-    0x2D,
-    0x51,
-    0xE7,
-    0x25,
-    0x6D,
-    0x53,
-    0x75,
-    0x56,
-    0x32,
-    0xAC,
-    0xA3,
-    0x0E,
-    0x87,
-    0xEB,
-    0x7C,
-    0x2C,
-    0x3E,
-    0x69,
-    0x96,
-    0x9E,
-    0x73,
-    0xF3,
-    0x70,
-    0x3B,
-    0x4D,
-    0xCB,
-    0x78,
-    0x2F,
-    0x65,
-    0x75,
-    0xA7,
-    0xF8,
-    0x3B,
-    0x19,
-    0x56,
-    0x51,
-    0xE3,
-    0x55,
-    0x3D,
-    0x52,
-    0xBD,
-    0x5D,
-    0x54,
-    0x3B,
-    0x76,
-    0xA0,
-    0xA9,
-    0x38,
-    0xE5,
-    0x48,
-    0x0B,
-    0xC4,
-    0x29,
-    0xB2,
-    0xD0,
-    0x2E,
-    0xD4,
-    0xF5,
-    0x00,
-    0x8F,
-    0xE5,
-    0xD3,
-    0xFC,
-    0xCF,
-    0x9A,
-    0xB5,
-    0x87,
-    0xF2,
-    0x03,
-    0x14,
-    0x39,
-    0x51,
-    0xFB,
-    0x78,
-    0x9C,
-    0x25,
-    0x8E,
-    0xB1,
-    0x09,
-    0xC2,
-    0x50,
-    0x18,
-    0x84,
-    0x2F,
-    0x10,
-    0x44,
-    0x10,
-    0xE5,
-    0x2D,
-    0x20,
-    0x66,
-    0x00,
-    0xD1,
-    0xC6,
-    0x3E,
-    0x8A,
-    0x0B,
-    0xBC,
-    0x0D,
-    0xE2,
-    0x06,
-    0x3A,
-    0x80,
-    0x82,
-    0x9D,
-    0x9D,
-    0x56,
-    0xA9,
-    0xCD,
-    0x02,
-    0xE2,
-    0x08,
-    0xCF,
-    0x0D,
-    0x44,
-    0x17,
-    0x08,
-    0x92,
-    0x4A,
-    0x1B,
-    0x9B,
-    0x18,
-    0x94,
-    0x68,
-    0xCE,
-    0x3F,
-    0xEF,
-    0xFD,
-    0xD5,
-    0xC7,
-    0x71,
-    0x77,
-    0xFF,
-    0x21,
-    0xB8,
-    0x3F,
-    0x97,
-    0xB0,
-    0x97,
-    0x93,
-    0xEC,
-    0x5A,
-    0xAA,
-    0x76,
-    0xD3,
-    0xF2,
-    0x58,
-    0xC3,
-    0x98,
-    0x4D,
-    0x9C,
-    0x58,
-    0xD3,
-    0x8C,
-    0x3E,
-    0xD6,
-    0xF4,
-    0xAC,
-    0xD6,
-    0x40,
-    0x42,
-    0xE7,
-    0x6B,
-    0x23,
-    0xDF,
-    0xBB,
-    0xAC,
-    0xD1,
-    0x6C,
-    0x59,
-    0x5A,
-    0xB0,
-    0x72,
-    0x12,
-    0xD4,
-    0x4F,
-    0x9C,
-    0x98,
-    0x08,
-    0x65,
-    0xE4,
-    0x00,
-    0x28,
-    0x42,
-    0xC9,
-    0xF6,
-    0x33,
-    0x29,
-    0x2A,
-    0x3B,
-    0xB8,
-    0xA5,
-    0x08,
-    0xAA,
-    0x48,
-    0x49,
-    0x7F,
-    0x11,
-    0x01,
-    0x17,
-    0x6E,
-    0xA4,
-    0xFB,
-    0x33,
-    0x14,
-    0x6F,
-    0xC9,
-    0x39,
-    0xF0,
-    0x0E,
-    0x85,
-    0x12,
-    0xF6,
-    0x80,
-    0x97,
-    0x11,
-    0xBA,
-    0x32,
-    0xF5,
-    0x64,
-    0xC7,
-    0x6A,
-    0x14,
-    0x73,
-    0x2B,
-    0x4D,
-    0xEA,
-    0x2B,
-    0x4B,
-    0x8D,
-    0x57,
-    0x9C,
-    0x01,
-    0xFD,
-    0xE0,
-    0xC1,
-    0x87,
-    0x76,
-    0xAF,
-    0xDD,
-    0xFD,
-    0x01,
-    0x73,
-    0xF2,
-    0x49,
-    0xEF,
-    0x78,
-    0x9C,
-    0xFB,
-    0x3C,
-    0xFF,
-    0x53,
-    0xFF,
-    0xC7,
-    0xFE,
-    0x8F,
-    0xF5,
-    0x1F,
-    0xF2,
-    0x3F,
-    0xC4,
-    0x3F,
-    0xF0,
-    0xBF,
-    0x60,
-    0x0F,
-    0x00,
-    0x64,
-    0xB2,
-    0x0A,
-    0xF0,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x08,
-    0x60,
-    0x64,
-    0x60,
-    0xF8,
-    0x2C,
-    0xC7,
-    0xC0,
-    0xF0,
-    0x97,
-    0x8B,
-    0xA1,
-    0xE1,
-    0x3D,
-    0x23,
-    0xC3,
-    0xA7,
-    0x7A,
-    0x06,
-    0x86,
-    0xDF,
-    0x7C,
-    0x0C,
-    0x0A,
-    0xFF,
-    0xD9,
-    0x19,
-    0x26,
-    0xFC,
-    0x67,
-    0x64,
-    0x78,
-    0x70,
-    0x1E,
-    0x28,
-    0x0B,
-    0x14,
-    0xFA,
-    0x16,
-    0xCF,
-    0xC0,
-    0xF0,
-    0x53,
-    0x1F,
-    0x28,
-    0x25,
-    0xCF,
-    0xC0,
-    0xF0,
-    0x87,
-    0x1F,
-    0x81,
-    0x7F,
-    0x03,
-    0xF1,
-    0x2F,
-    0xA0,
-    0xD8,
-    0x0F,
-    0x7B,
-    0x06,
-    0x86,
-    0xAF,
-    0xF9,
-    0x0C,
-    0x0C,
-    0x1F,
-    0xE7,
-    0x33,
-    0x30,
-    0x1C,
-    0x78,
-    0xCF,
-    0xC0,
-    0x90,
-    0xF0,
-    0x9F,
-    0x99,
-    0x81,
-    0xE1,
-    0x1F,
-    0x17,
-    0x03,
-    0xC3,
-    0x77,
-    0xA0,
-    0xA6,
-    0x0B,
-    0xEB,
-    0x19,
-    0x18,
-    0x1C,
-    0xFE,
-    0xB3,
-    0x00,
-    0x4D,
-    0xE0,
-    0x05,
-    0x72,
-    0x38,
-    0x19,
-    0x80,
-    0x00,
-    0x00,
-    0x86,
-    0xE9,
-    0x23,
-    0x11,
-    0x78,
-    0x9C,
-    0x4B,
-    0x60,
-    0x64,
-    0x60,
-    0xF8,
-    0xC1,
-    0xC5,
-    0xC0,
-    0xF0,
-    0x39,
-    0x9E,
-    0x81,
-    0x61,
-    0xC2,
-    0x7B,
-    0x06,
-    0x06,
-    0x81,
-    0x7F,
-    0x9C,
-    0x0C,
-    0x0C,
-    0xDF,
-    0xF5,
-    0x19,
-    0x18,
-    0x3E,
-    0xCC,
-    0x07,
-    0x0A,
-    0xFC,
-    0x67,
-    0x60,
-    0x08,
-    0xF8,
-    0xCF,
-    0xCA,
-    0x20,
-    0xF0,
-    0x1F,
-    0xA8,
-    0xE2,
-    0x1F,
-    0x2F,
-    0x03,
-    0xC3,
-    0x6F,
-    0x7E,
-    0x06,
-    0x86,
-    0x9F,
-    0x40,
-    0xC9,
-    0x9F,
-    0xF6,
-    0x40,
-    0x5D,
-    0xFE,
-    0x40,
-    0x6C,
-    0x0F,
-    0xE1,
-    0xFF,
-    0x92,
-    0x67,
-    0x60,
-    0xF8,
-    0x03,
-    0x94,
-    0xFB,
-    0xCF,
-    0xC3,
-    0xA0,
-    0xF0,
-    0x9F,
-    0x83,
-    0xA1,
-    0xE0,
-    0x3F,
-    0x33,
-    0xC3,
-    0x81,
-    0xFB,
-    0x40,
-    0x43,
-    0xF3,
-    0x81,
-    0x52,
-    0x7C,
-    0x0C,
-    0x06,
-    0x40,
-    0x23,
-    0x0E,
-    0xEC,
-    0x07,
-    0x1A,
-    0x2B,
-    0xC7,
-    0xC0,
-    0xF0,
-    0x84,
-    0x95,
-    0x01,
-    0x0C,
-    0x00,
-    0x58,
-    0xA7,
-    0x22,
-    0x9A,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x78,
-    0xB0,
-    0x9E,
-    0x01,
-    0x04,
-    0x0E,
-    0xCC,
-    0x07,
-    0x53,
-    0x1B,
-    0xEA,
-    0x81,
-    0xC4,
-    0x05,
-    0xAB,
-    0x09,
-    0xF9,
-    0x01,
-    0x6B,
-    0x18,
-    0x3E,
-    0xFD,
-    0xDF,
-    0xB3,
-    0xFE,
-    0xEF,
-    0x7B,
-    0x86,
-    0xA6,
-    0xD7,
-    0xFF,
-    0xFF,
-    0xBF,
-    0xAF,
-    0x02,
-    0x0A,
-    0x7F,
-    0xFB,
-    0xCF,
-    0x0C,
-    0x24,
-    0x15,
-    0xFE,
-    0xFD,
-    0xE6,
-    0x01,
-    0x52,
-    0x17,
-    0xF7,
-    0x3F,
-    0xD8,
-    0x0F,
-    0xA4,
-    0x7E,
-    0xEB,
-    0x07,
-    0xFC,
-    0xE7,
-    0x60,
-    0x60,
-    0xB8,
-    0xC4,
-    0xC9,
-    0xB0,
-    0x86,
-    0x11,
-    0x6C,
-    0x00,
-    0x90,
-    0x04,
-    0x00,
-    0x0C,
-    0xDE,
-    0x1C,
-    0x95,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0xF8,
-    0x50,
-    0xCF,
-    0x00,
-    0x04,
-    0xE8,
-    0xE4,
-    0xE7,
-    0xFF,
-    0x40,
-    0x70,
-    0x1E,
-    0x42,
-    0x1A,
-    0x18,
-    0x7F,
-    0x9E,
-    0x6F,
-    0xAC,
-    0x8C,
-    0xA9,
-    0x06,
-    0x42,
-    0x02,
-    0x00,
-    0x65,
-    0xA2,
-    0x19,
-    0x40,
-    0x78,
-    0x9C,
-    0x5B,
-    0xB0,
-    0x9E,
-    0xE1,
-    0xDB,
-    0x7F,
-    0xB6,
-    0xEF,
-    0xFF,
-    0xD9,
-    0x1F,
-    0xFD,
-    0x67,
-    0xB9,
-    0xF0,
-    0x9E,
-    0xE1,
-    0x63,
-    0x3D,
-    0xC3,
-    0x57,
-    0x79,
-    0x86,
-    0x1F,
-    0x5C,
-    0x0C,
-    0x7F,
-    0x98,
-    0x19,
-    0x00,
-    0xD7,
-    0x99,
-    0x0D,
-    0x71,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x36,
-    0x36,
-    0x66,
-    0xFE,
-    0xF2,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x7E,
-    0x30,
-    0x01,
-    0x00,
-    0x3A,
-    0x59,
-    0x08,
-    0xCD,
-    0x78,
-    0x9C,
-    0xDB,
-    0xB0,
-    0x9E,
-    0xE1,
-    0xFB,
-    0x7F,
-    0xB6,
-    0x6F,
-    0xFF,
-    0xD9,
-    0x36,
-    0xAC,
-    0x67,
-    0x00,
-    0x00,
-    0x2E,
-    0xE7,
-    0x06,
-    0xB6,
-    0x78,
-    0x9C,
-    0x2D,
-    0xCD,
-    0xD9,
-    0x0D,
-    0x41,
-    0x01,
-    0x10,
-    0x85,
-    0xE1,
-    0x1F,
-    0xC1,
-    0xB5,
-    0xEB,
-    0xE0,
-    0x96,
-    0x40,
-    0x09,
-    0x3A,
-    0x50,
-    0x02,
-    0xD1,
-    0x00,
-    0x9D,
-    0xD0,
-    0x01,
-    0x1D,
-    0xD0,
-    0x09,
-    0x8F,
-    0xDE,
-    0xE8,
-    0xC0,
-    0x12,
-    0xFB,
-    0x92,
-    0xF1,
-    0xDF,
-    0xC4,
-    0x3C,
-    0x7C,
-    0xC9,
-    0x39,
-    0x99,
-    0xC9,
-    0x00,
-    0xA3,
-    0x3C,
-    0x70,
-    0x6F,
-    0xC9,
-    0xBB,
-    0x26,
-    0x51,
-    0x86,
-    0x6E,
-    0x14,
-    0x60,
-    0x72,
-    0x30,
-    0xAD,
-    0x96,
-    0x72,
-    0x1C,
-    0xCB,
-    0xA5,
-    0x23,
-    0x8F,
-    0xA6,
-    0x7C,
-    0xAA,
-    0xD9,
-    0x5A,
-    0x09,
-    0x7A,
-    0xE1,
-    0xE9,
-    0x6C,
-    0x67,
-    0xDA,
-    0xCC,
-    0xE5,
-    0x34,
-    0x90,
-    0x6B,
-    0x2A,
-    0xCF,
-    0x86,
-    0x7C,
-    0x2B,
-    0xD0,
-    0x8E,
-    0x22,
-    0x0C,
-    0x23,
-    0x07,
-    0x8B,
-    0xB5,
-    0xD5,
-    0x7E,
-    0x2A,
-    0xE7,
-    0xBE,
-    0xDC,
-    0xB2,
-    0x7F,
-    0xAF,
-    0xBA,
-    0x6C,
-    0x13,
-    0xFE,
-    0xF3,
-    0x03,
-    0xB6,
-    0x30,
-    0x1F,
-    0x07,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x38,
-    0xF6,
-    0xAF,
-    0x97,
-    0x91,
-    0x81,
-    0xE1,
-    0xC0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xF5,
-    0x18,
-    0x18,
-    0x7E,
-    0xED,
-    0x37,
-    0xF9,
-    0xF1,
-    0x9E,
-    0xC1,
-    0xE0,
-    0x3F,
-    0x17,
-    0x43,
-    0xC2,
-    0x7F,
-    0xF6,
-    0x09,
-    0xFF,
-    0x99,
-    0x18,
-    0x18,
-    0xFE,
-    0xF1,
-    0x3D,
-    0xB8,
-    0xCF,
-    0xC0,
-    0xC0,
-    0xF0,
-    0xD3,
-    0xFE,
-    0xE3,
-    0x7A,
-    0x20,
-    0xF5,
-    0x35,
-    0xFF,
-    0x4B,
-    0x3F,
-    0x90,
-    0xFA,
-    0xDC,
-    0xFF,
-    0xB5,
-    0x1E,
-    0x48,
-    0x7D,
-    0x9A,
-    0xFF,
-    0x35,
-    0x1F,
-    0x44,
-    0xAD,
-    0x87,
-    0x51,
-    0x10,
-    0x41,
-    0xB0,
-    0x92,
-    0x2F,
-    0xFD,
-    0x50,
-    0x0D,
-    0x10,
-    0xED,
-    0xFA,
-    0x50,
-    0xC3,
-    0xA0,
-    0x46,
-    0x83,
-    0x2D,
-    0xBA,
-    0x0F,
-    0xB7,
-    0x16,
-    0xE2,
-    0x08,
-    0x00,
-    0xC0,
-    0x18,
-    0x3C,
-    0x90,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x58,
-    0xF8,
-    0x9F,
-    0x8D,
-    0x21,
-    0xE0,
-    0xDF,
-    0x7F,
-    0x36,
-    0x81,
-    0x5F,
-    0xFF,
-    0xFF,
-    0xB3,
-    0x3D,
-    0xFB,
-    0x5F,
-    0xF3,
-    0x9F,
-    0xED,
-    0x57,
-    0xBD,
-    0xC3,
-    0x7F,
-    0xB6,
-    0x85,
-    0x8C,
-    0x40,
-    0x82,
-    0x81,
-    0x81,
-    0x1A,
-    0x04,
-    0x00,
-    0x6C,
-    0x29,
-    0x20,
-    0xD9,
-    0x78,
-    0x9C,
-    0x63,
-    0x70,
-    0x78,
-    0xF5,
-    0x3E,
-    0x9A,
-    0x81,
-    0x41,
-    0xE0,
-    0xF7,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xB9,
-    0x19,
-    0x0E,
-    0xFC,
-    0x8F,
-    0x0E,
-    0xFE,
-    0xBB,
-    0x9E,
-    0x61,
-    0x42,
-    0x3E,
-    0x03,
-    0xC3,
-    0x85,
-    0xFF,
-    0x4C,
-    0x0C,
-    0x4C,
-    0x0C,
-    0x0C,
-    0x05,
-    0xFF,
-    0xD9,
-    0x18,
-    0x80,
-    0x20,
-    0xE0,
-    0x3F,
-    0x3B,
-    0x88,
-    0x4A,
-    0x80,
-    0xF0,
-    0x26,
-    0xFC,
-    0x67,
-    0x06,
-    0x51,
-    0x1F,
-    0xEE,
-    0x83,
-    0x48,
-    0x86,
-    0x9F,
-    0xF1,
-    0x20,
-    0xD2,
-    0x01,
-    0xA8,
-    0x1D,
-    0x08,
-    0x1E,
-    0xBE,
-    0x67,
-    0x04,
-    0x51,
-    0x7F,
-    0xEC,
-    0x41,
-    0xE4,
-    0x86,
-    0xFF,
-    0xAC,
-    0x20,
-    0xEA,
-    0x57,
-    0x3E,
-    0x44,
-    0x13,
-    0xD8,
-    0x88,
-    0x1F,
-    0xF5,
-    0x20,
-    0xB2,
-    0xE0,
-    0xBF,
-    0x95,
-    0xB1,
-    0xB1,
-    0x31,
-    0xD3,
-    0x85,
-    0xFF,
-    0x20,
-    0xC0,
-    0x07,
-    0xA1,
-    0xB8,
-    0x01,
-    0x31,
-    0xB8,
-    0x2E,
-    0xCF,
-    0x78,
-    0x9C,
-    0x63,
-    0x08,
-    0x78,
-    0xF5,
-    0x3E,
-    0x9B,
-    0x81,
-    0x41,
-    0xE0,
-    0xCF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x65,
-    0x18,
-    0x36,
-    0xFC,
-    0xF7,
-    0x08,
-    0xFE,
-    0xB3,
-    0x9F,
-    0x41,
-    0x40,
-    0x92,
-    0x81,
-    0xE1,
-    0xC0,
-    0x7F,
-    0x26,
-    0x06,
-    0x20,
-    0x48,
-    0xF8,
-    0xCF,
-    0x82,
-    0x44,
-    0x1D,
-    0x78,
-    0x0F,
-    0x22,
-    0x0D,
-    0xFE,
-    0xF8,
-    0x03,
-    0xC9,
-    0x07,
-    0xFF,
-    0xE7,
-    0x83,
-    0x54,
-    0x7C,
-    0xFC,
-    0x7F,
-    0x9F,
-    0x1D,
-    0x24,
-    0x16,
-    0xFC,
-    0x6B,
-    0x3F,
-    0x48,
-    0x8E,
-    0xA1,
-    0xE0,
-    0x3F,
-    0x3B,
-    0x98,
-    0xFE,
-    0xCF,
-    0x03,
-    0xA6,
-    0xFE,
-    0xF2,
-    0x81,
-    0xA9,
-    0x7F,
-    0xBC,
-    0x20,
-    0x52,
-    0xE1,
-    0x3F,
-    0xF7,
-    0x02,
-    0x69,
-    0x06,
-    0xA0,
-    0x2D,
-    0xAC,
-    0x5F,
-    0xDE,
-    0x83,
-    0x2D,
-    0x0A,
-    0x00,
-    0xDA,
-    0xFA,
-    0x1F,
-    0x28,
-    0x52,
-    0xF8,
-    0xE6,
-    0xBE,
-    0x17,
-    0x03,
-    0x03,
-    0x00,
-    0x85,
-    0x2B,
-    0x2D,
-    0x81,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x10,
-    0xD0,
-    0x64,
-    0x00,
-    0x81,
-    0x86,
-    0xFF,
-    0x8C,
-    0x20,
-    0xEA,
-    0xC3,
-    0x7E,
-    0x30,
-    0xEF,
-    0xBB,
-    0x3D,
-    0x98,
-    0xFA,
-    0xC7,
-    0x03,
-    0x22,
-    0x03,
-    0xFE,
-    0xB3,
-    0x82,
-    0xA8,
-    0x03,
-    0xEF,
-    0xC1,
-    0x62,
-    0x9F,
-    0xEB,
-    0xC1,
-    0xD4,
-    0x6F,
-    0x7E,
-    0x86,
-    0x2F,
-    0xF2,
-    0x0C,
-    0x0A,
-    0xFF,
-    0x39,
-    0x41,
-    0xD4,
-    0x84,
-    0xFF,
-    0x4C,
-    0x0C,
-    0x5F,
-    0xE5,
-    0x19,
-    0x3E,
-    0xAE,
-    0x67,
-    0x60,
-    0xF8,
-    0x26,
-    0x0F,
-    0xD6,
-    0x0C,
-    0xA4,
-    0xFE,
-    0xFE,
-    0x07,
-    0x81,
-    0xF5,
-    0x50,
-    0xCA,
-    0xC8,
-    0xD8,
-    0xD8,
-    0xF8,
-    0xA7,
-    0xBF,
-    0x30,
-    0xD8,
-    0x70,
-    0x79,
-    0x06,
-    0xAC,
-    0x14,
-    0x00,
-    0x3C,
-    0x8E,
-    0x29,
-    0xE7,
-    0x78,
-    0x9C,
-    0x63,
-    0x30,
-    0x32,
-    0x06,
-    0x02,
-    0x46,
-    0x86,
-    0x7F,
-    0xFF,
-    0x81,
-    0x80,
-    0x03,
-    0x42,
-    0xB1,
-    0x32,
-    0xFC,
-    0xE3,
-    0x62,
-    0x00,
-    0x01,
-    0xBC,
-    0x54,
-    0xF7,
-    0xDF,
-    0x7D,
-    0x2C,
-    0x0C,
-    0x60,
-    0x0D,
-    0xFD,
-    0x0C,
-    0x0C,
-    0x77,
-    0xB2,
-    0x9D,
-    0x7F,
-    0x00,
-    0xF5,
-    0x01,
-    0x81,
-    0xC1,
-    0x7F,
-    0x5E,
-    0xB0,
-    0xFC,
-    0x1F,
-    0x79,
-    0x30,
-    0xF5,
-    0xC3,
-    0x1E,
-    0x42,
-    0xF9,
-    0x83,
-    0xA9,
-    0x9F,
-    0xFA,
-    0x10,
-    0xBD,
-    0x7C,
-    0x06,
-    0x3A,
-    0x0C,
-    0x0C,
-    0x05,
-    0xFF,
-    0x39,
-    0x1E,
-    0xFC,
-    0xF7,
-    0x74,
-    0xFE,
-    0x75,
-    0x9F,
-    0xC1,
-    0xE0,
-    0x2F,
-    0xD0,
-    0x14,
-    0xA0,
-    0x48,
-    0xC2,
-    0xEB,
-    0xF7,
-    0xD9,
-    0x0C,
-    0x0C,
-    0x00,
-    0xA3,
-    0xC7,
-    0x2F,
-    0x9C,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x68,
-    0xFC,
-    0x7B,
-    0x5F,
-    0x82,
-    0x81,
-    0xC1,
-    0xE0,
-    0xDF,
-    0xFF,
-    0xFF,
-    0xE7,
-    0x19,
-    0x18,
-    0x3E,
-    0xFD,
-    0xB7,
-    0x48,
-    0xF1,
-    0x65,
-    0x60,
-    0xF8,
-    0x63,
-    0xCF,
-    0x00,
-    0x04,
-    0x0E,
-    0xFF,
-    0xD9,
-    0x41,
-    0xD4,
-    0x84,
-    0xFF,
-    0x20,
-    0x92,
-    0xE1,
-    0xC1,
-    0x7E,
-    0x06,
-    0x05,
-    0x46,
-    0xA0,
-    0x8A,
-    0xFA,
-    0x86,
-    0xFF,
-    0xEF,
-    0x39,
-    0x18,
-    0x3E,
-    0xE7,
-    0xFF,
-    0x05,
-    0x69,
-    0xF8,
-    0xFA,
-    0xBE,
-    0x9F,
-    0x69,
-    0xD1,
-    0x7F,
-    0x8E,
-    0x6F,
-    0xFF,
-    0x59,
-    0x18,
-    0x18,
-    0xFE,
-    0xF2,
-    0x7D,
-    0xAD,
-    0x07,
-    0xAA,
-    0xFB,
-    0x61,
-    0xFF,
-    0x25,
-    0x1E,
-    0x48,
-    0x7D,
-    0x8D,
-    0xFF,
-    0x54,
-    0x0F,
-    0xA6,
-    0x3E,
-    0xAC,
-    0x07,
-    0x52,
-    0xDF,
-    0xED,
-    0x37,
-    0xBC,
-    0x07,
-    0x52,
-    0x7F,
-    0xF8,
-    0x03,
-    0x80,
-    0x66,
-    0x3A,
-    0xFC,
-    0xE7,
-    0x64,
-    0xF8,
-    0x33,
-    0xDF,
-    0xE4,
-    0xFB,
-    0x7B,
-    0x46,
-    0x86,
-    0x8B,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xB7,
-    0x03,
-    0x4A,
-    0x1C,
-    0xFF,
-    0x57,
-    0xCB,
-    0xC8,
-    0x00,
-    0x00,
-    0x52,
-    0xDC,
-    0x39,
-    0x89,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x06,
-    0x01,
-    0x86,
-    0x2F,
-    0xFF,
-    0x41,
-    0x80,
-    0x11,
-    0x4A,
-    0x31,
-    0x00,
-    0xC1,
-    0x85,
-    0xF3,
-    0x20,
-    0x92,
-    0xE1,
-    0x4B,
-    0x3E,
-    0x98,
-    0xFA,
-    0xC5,
-    0x0F,
-    0x22,
-    0x05,
-    0xFE,
-    0x73,
-    0x82,
-    0xA8,
-    0x82,
-    0xFF,
-    0xCC,
-    0x20,
-    0xEA,
-    0x01,
-    0x44,
-    0xC5,
-    0x57,
-    0x88,
-    0x8A,
-    0xDF,
-    0x60,
-    0x15,
-    0x0A,
-    0x10,
-    0x15,
-    0x0D,
-    0xFF,
-    0x99,
-    0x90,
-    0x55,
-    0xC4,
-    0x83,
-    0xA9,
-    0x3F,
-    0x7C,
-    0x20,
-    0xD2,
-    0xE0,
-    0x3F,
-    0x07,
-    0x88,
-    0x9A,
-    0x00,
-    0x51,
-    0xF1,
-    0x01,
-    0xA2,
-    0xE2,
-    0x1B,
-    0x44,
-    0x45,
-    0x11,
-    0x0F,
-    0x88,
-    0x04,
-    0x00,
-    0xEF,
-    0xA3,
-    0x24,
-    0xD2,
-    0x78,
-    0x9C,
-    0x63,
-    0x10,
-    0xB8,
-    0xF1,
-    0x7F,
-    0x2E,
-    0x13,
-    0x03,
-    0xC3,
-    0x97,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xE7,
-    0x33,
-    0x28,
-    0xFC,
-    0xEF,
-    0x77,
-    0x79,
-    0xFE,
-    0x9F,
-    0x79,
-    0xC2,
-    0x7F,
-    0x16,
-    0x06,
-    0x83,
-    0xFF,
-    0xDC,
-    0x07,
-    0xEE,
-    0x33,
-    0x30,
-    0x30,
-    0xFC,
-    0xE1,
-    0xBB,
-    0x70,
-    0x1E,
-    0x48,
-    0xFD,
-    0xE6,
-    0x5B,
-    0xF0,
-    0x9F,
-    0x91,
-    0x81,
-    0xE1,
-    0x1F,
-    0x97,
-    0xC1,
-    0x7F,
-    0x5D,
-    0x86,
-    0x86,
-    0xF7,
-    0x4C,
-    0x0C,
-    0xDF,
-    0xFE,
-    0x47,
-    0xFF,
-    0xB2,
-    0x65,
-    0x60,
-    0x70,
-    0xF8,
-    0xFF,
-    0xFF,
-    0x3D,
-    0x33,
-    0x03,
-    0xC3,
-    0xB7,
-    0xF9,
-    0xD7,
-    0xFF,
-    0xCF,
-    0x67,
-    0x68,
-    0x00,
-    0xEA,
-    0x3B,
-    0xFC,
-    0x9F,
-    0xFB,
-    0xF3,
-    0x7C,
-    0x90,
-    0x86,
-    0xF8,
-    0x1F,
-    0xF6,
-    0x40,
-    0xEA,
-    0xF3,
-    0xFA,
-    0x5F,
-    0xFA,
-    0x40,
-    0xEA,
-    0xE3,
-    0xFE,
-    0x9F,
-    0x10,
-    0xDE,
-    0x97,
-    0xFD,
-    0x60,
-    0xB9,
-    0x0D,
-    0xFF,
-    0x73,
-    0x5D,
-    0xAE,
-    0xFD,
-    0xE7,
-    0x66,
-    0xF8,
-    0x0D,
-    0xB4,
-    0x76,
-    0x3D,
-    0xD0,
-    0x94,
-    0x5B,
-    0xFF,
-    0xE7,
-    0xB2,
-    0x30,
-    0x00,
-    0x00,
-    0x83,
-    0x97,
-    0x40,
-    0x8C,
-    0x78,
-    0x9C,
-    0x63,
-    0x30,
-    0xB8,
-    0xF5,
-    0x3E,
-    0x9A,
-    0x81,
-    0x81,
-    0xE1,
-    0xC7,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xB9,
-    0x18,
-    0x12,
-    0xFE,
-    0xC7,
-    0x06,
-    0xFF,
-    0xE9,
-    0x67,
-    0xF8,
-    0x70,
-    0x9F,
-    0x81,
-    0xE1,
-    0xC0,
-    0x7F,
-    0xC6,
-    0x6F,
-    0xF9,
-    0x0C,
-    0x0C,
-    0x0E,
-    0xFF,
-    0xD9,
-    0x7E,
-    0xEA,
-    0x03,
-    0xE5,
-    0xFF,
-    0x73,
-    0xFD,
-    0x92,
-    0x07,
-    0x52,
-    0xFF,
-    0x78,
-    0xC0,
-    0xBC,
-    0x7F,
-    0xBC,
-    0xDF,
-    0xFD,
-    0x19,
-    0x18,
-    0x04,
-    0xFE,
-    0xF1,
-    0x7E,
-    0x3A,
-    0x0F,
-    0x52,
-    0xC9,
-    0xB3,
-    0xE0,
-    0xBF,
-    0x77,
-    0xF2,
-    0xDF,
-    0xFF,
-    0xDC,
-    0x02,
-    0x7F,
-    0xFE,
-    0xFF,
-    0x8F,
-    0xFF,
-    0xCF,
-    0xC1,
-    0x50,
-    0xF0,
-    0x77,
-    0x9D,
-    0xF1,
-    0x7F,
-    0x56,
-    0xA0,
-    0x3A,
-    0x86,
-    0x09,
-    0xFF,
-    0x19,
-    0x41,
-    0xD4,
-    0xA7,
-    0xF5,
-    0x20,
-    0x52,
-    0xE0,
-    0x2F,
-    0x48,
-    0x2F,
-    0xC3,
-    0xE3,
-    0xFF,
-    0x6C,
-    0x40,
-    0x72,
-    0xD1,
-    0xFF,
-    0x7A,
-    0x20,
-    0xB9,
-    0xED,
-    0xFF,
-    0x7D,
-    0x66,
-    0x90,
-    0x79,
-    0xE7,
-    0xC1,
-    0xAA,
-    0x3B,
-    0x98,
-    0x40,
-    0x24,
-    0x00,
-    0x81,
-    0x4F,
-    0x36,
-    0x19,
-    0x78,
-    0x9C,
-    0xDB,
-    0xB0,
-    0x9E,
-    0xE1,
-    0xFB,
-    0x7F,
-    0xB6,
-    0x6F,
-    0xFF,
-    0xD9,
-    0x36,
-    0xAC,
-    0x67,
-    0xC0,
-    0x0A,
-    0x36,
-    0x20,
-    0x29,
-    0x00,
-    0x00,
-    0x3B,
-    0x47,
-    0x0D,
-    0x6B,
-    0x78,
-    0x9C,
-    0xDB,
-    0xB0,
-    0x9E,
-    0xE1,
-    0xFB,
-    0x7F,
-    0xB6,
-    0x6F,
-    0xFF,
-    0xD9,
-    0x36,
-    0xAC,
-    0x67,
-    0xC0,
-    0x0A,
-    0x16,
-    0xAC,
-    0x67,
-    0x00,
-    0xCA,
-    0x7E,
-    0xFF,
-    0xCF,
-    0xFE,
-    0xE8,
-    0x3F,
-    0xCB,
-    0x85,
-    0xF7,
-    0x0C,
-    0x1F,
-    0xEB,
-    0x19,
-    0xBE,
-    0xCA,
-    0x33,
-    0xFC,
-    0xE0,
-    0x62,
-    0xF8,
-    0xC3,
-    0xCC,
-    0x00,
-    0x00,
-    0x48,
-    0xA3,
-    0x14,
-    0x26,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x80,
-    0x03,
-    0x87,
-    0x1C,
-    0x10,
-    0x19,
-    0xF0,
-    0xF7,
-    0x3E,
-    0x90,
-    0x4C,
-    0xF8,
-    0xF7,
-    0x3F,
-    0x97,
-    0x81,
-    0xA1,
-    0xF0,
-    0xDF,
-    0x7F,
-    0x6F,
-    0x06,
-    0x86,
-    0x89,
-    0xFF,
-    0xFF,
-    0x6B,
-    0x02,
-    0x85,
-    0x7E,
-    0xBC,
-    0x17,
-    0x07,
-    0xC9,
-    0xFF,
-    0x88,
-    0x03,
-    0x2B,
-    0xFE,
-    0x06,
-    0x92,
-    0x67,
-    0x60,
-    0x50,
-    0xF8,
-    0xF9,
-    0xBF,
-    0x9F,
-    0x09,
-    0x48,
-    0x0B,
-    0xFC,
-    0xF8,
-    0xBF,
-    0x9E,
-    0x19,
-    0x24,
-    0xF0,
-    0xFC,
-    0xFF,
-    0x79,
-    0xB0,
-    0xFC,
-    0xB5,
-    0xF5,
-    0x10,
-    0x43,
-    0x4D,
-    0x19,
-    0x00,
-    0x00,
-    0x54,
-    0x1A,
-    0x9B,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x06,
-    0x02,
-    0xE5,
-    0xCF,
-    0xFF,
-    0x81,
-    0xE0,
-    0x3C,
-    0x84,
-    0x64,
-    0xC0,
-    0x00,
-    0x06,
-    0x18,
-    0x6A,
-    0x00,
-    0x7F,
-    0xD6,
-    0x19,
-    0x37,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x00,
-    0x83,
-    0x03,
-    0x92,
-    0x60,
-    0xEA,
-    0xCB,
-    0x7F,
-    0x2D,
-    0x10,
-    0x35,
-    0xE9,
-    0xFF,
-    0x7F,
-    0x6B,
-    0x10,
-    0x5D,
-    0xF8,
-    0xEF,
-    0xBF,
-    0x0F,
-    0x88,
-    0x0E,
-    0xF8,
-    0xF3,
-    0x3F,
-    0x16,
-    0x44,
-    0x1B,
-    0xFC,
-    0xFA,
-    0xCF,
-    0x04,
-    0xA2,
-    0x27,
-    0x82,
-    0xA9,
-    0x49,
-    0xFF,
-    0xDF,
-    0x33,
-    0x32,
-    0x30,
-    0x6C,
-    0xF9,
-    0x7F,
-    0x9F,
-    0x8D,
-    0x81,
-    0xE1,
-    0xDA,
-    0xFF,
-    0xF3,
-    0xAC,
-    0x0C,
-    0x0C,
-    0x4F,
-    0xFE,
-    0xEF,
-    0x67,
-    0x01,
-    0x4A,
-    0x7C,
-    0x5C,
-    0xCF,
-    0x0C,
-    0x52,
-    0x95,
-    0x00,
-    0x56,
-    0xCB,
-    0x00,
-    0x00,
-    0x21,
-    0xBF,
-    0x1B,
-    0x4E,
-    0x78,
-    0x9C,
-    0x63,
-    0x50,
-    0xB8,
-    0xF9,
-    0xBF,
-    0x97,
-    0x91,
-    0x81,
-    0xE1,
-    0xC7,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFD,
-    0x19,
-    0x16,
-    0xFC,
-    0xCF,
-    0x71,
-    0xFE,
-    0xF9,
-    0x9F,
-    0x31,
-    0xA1,
-    0x9F,
-    0x81,
-    0x61,
-    0xC2,
-    0x7F,
-    0x36,
-    0x06,
-    0xA0,
-    0x78,
-    0xC0,
-    0x7F,
-    0x76,
-    0x06,
-    0x20,
-    0x68,
-    0xF8,
-    0xCF,
-    0x0A,
-    0xA2,
-    0xBE,
-    0xBD,
-    0x07,
-    0x91,
-    0x1B,
-    0xFF,
-    0xEB,
-    0x01,
-    0x49,
-    0x85,
-    0x7F,
-    0xFB,
-    0x81,
-    0xF2,
-    0x0C,
-    0x17,
-    0x20,
-    0x0A,
-    0x3E,
-    0xCF,
-    0x67,
-    0x00,
-    0x2B,
-    0xF0,
-    0x87,
-    0x50,
-    0xF6,
-    0x60,
-    0x4A,
-    0x81,
-    0x89,
-    0x01,
-    0x13,
-    0x3C,
-    0xF5,
-    0x03,
-    0x53,
-    0xFF,
-    0xDE,
-    0x23,
-    0x53,
-    0x4F,
-    0x40,
-    0x82,
-    0x00,
-    0xB2,
-    0x10,
-    0x22,
-    0x55,
-    0x78,
-    0x9C,
-    0x45,
-    0x90,
-    0xBF,
-    0x4E,
-    0xC2,
-    0x60,
-    0x14,
-    0xC5,
-    0x8F,
-    0x2D,
-    0x48,
-    0x44,
-    0x88,
-    0xBC,
-    0x81,
-    0xBC,
-    0x41,
-    0x4D,
-    0x88,
-    0xB3,
-    0xBC,
-    0x80,
-    0x61,
-    0xD0,
-    0x44,
-    0x27,
-    0x7D,
-    0x84,
-    0x9A,
-    0x38,
-    0x3A,
-    0x40,
-    0x82,
-    0x9B,
-    0x43,
-    0x7D,
-    0x83,
-    0xEA,
-    0x13,
-    0xB0,
-    0x98,
-    0xB8,
-    0xD1,
-    0x0E,
-    0x38,
-    0x37,
-    0x46,
-    0x07,
-    0x27,
-    0x8B,
-    0x93,
-    0x03,
-    0x24,
-    0x28,
-    0x7F,
-    0x42,
-    0x01,
-    0xDB,
-    0xE3,
-    0xFD,
-    0xBE,
-    0xA2,
-    0x3D,
-    0xD3,
-    0xFD,
-    0x9D,
-    0x73,
-    0xEE,
-    0xFD,
-    0x92,
-    0x0F,
-    0x00,
-    0xDA,
-    0x03,
-    0x86,
-    0x57,
-    0x06,
-    0xB4,
-    0x7A,
-    0x54,
-    0xF2,
-    0x34,
-    0xDD,
-    0x33,
-    0x3C,
-    0xAD,
-    0x1D,
-    0xBD,
-    0xB1,
-    0x29,
-    0x73,
-    0x25,
-    0x0E,
-    0x4C,
-    0xE5,
-    0xBD,
-    0x72,
-    0x0B,
-    0x78,
-    0x66,
-    0x21,
-    0x6D,
-    0x2F,
-    0x25,
-    0x5A,
-    0xDA,
-    0xC0,
-    0x43,
-    0xD2,
-    0xDD,
-    0x84,
-    0x4F,
-    0xA3,
-    0xCE,
-    0x22,
-    0x6E,
-    0x65,
-    0x3F,
-    0x44,
-    0x95,
-    0x45,
-    0x9F,
-    0x1B,
-    0x88,
-    0xBC,
-    0xFD,
-    0xA7,
-    0x91,
-    0x74,
-    0x76,
-    0xC7,
-    0xAE,
-    0x58,
-    0xDB,
-    0x68,
-    0x09,
-    0xCC,
-    0xCE,
-    0xE7,
-    0x0D,
-    0xB4,
-    0x68,
-    0x68,
-    0x18,
-    0x3B,
-    0xAB,
-    0x1D,
-    0xF8,
-    0x21,
-    0x34,
-    0x7C,
-    0x75,
-    0xE2,
-    0x32,
-    0xFA,
-    0xDE,
-    0x1A,
-    0xBC,
-    0xA4,
-    0x24,
-    0xCE,
-    0x5F,
-    0xA2,
-    0xC0,
-    0x4D,
-    0xE1,
-    0xDB,
-    0x4D,
-    0xB2,
-    0xDA,
-    0xD4,
-    0xFE,
-    0x91,
-    0x03,
-    0x32,
-    0xDC,
-    0x11,
-    0x88,
-    0xAC,
-    0x85,
-    0x85,
-    0x0B,
-    0xE6,
-    0x30,
-    0xA1,
-    0x89,
-    0xA4,
-    0x34,
-    0x6D,
-    0xA2,
-    0xC2,
-    0xB3,
-    0xCB,
-    0xF7,
-    0xE8,
-    0xB0,
-    0xC7,
-    0x5C,
-    0x5F,
-    0x3D,
-    0x4D,
-    0x1E,
-    0x7C,
-    0x90,
-    0x8E,
-    0x74,
-    0x0A,
-    0xD8,
-    0x5B,
-    0x75,
-    0xCD,
-    0xEA,
-    0x20,
-    0xC8,
-    0x03,
-    0x71,
-    0x03,
-    0x99,
-    0x26,
-    0xB2,
-    0xFE,
-    0xAF,
-    0x3A,
-    0x3B,
-    0x46,
-    0x46,
-    0x2F,
-    0x0C,
-    0x4E,
-    0x6A,
-    0xC7,
-    0x8F,
-    0x56,
-    0x4A,
-    0x9F,
-    0xFA,
-    0xAB,
-    0x9C,
-    0x75,
-    0x76,
-    0x3D,
-    0xE4,
-    0xE8,
-    0x46,
-    0x6D,
-    0xFE,
-    0x02,
-    0xF2,
-    0xE4,
-    0x85,
-    0x79,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0xF8,
-    0xF1,
-    0x9F,
-    0x85,
-    0x01,
-    0x0C,
-    0xFE,
-    0xFE,
-    0xE7,
-    0x04,
-    0xD3,
-    0x0A,
-    0xFF,
-    0xFF,
-    0xF2,
-    0x81,
-    0x19,
-    0x0D,
-    0xFF,
-    0xBF,
-    0xDA,
-    0x83,
-    0x19,
-    0x17,
-    0xD6,
-    0x7F,
-    0x98,
-    0x0F,
-    0x66,
-    0x7C,
-    0x8A,
-    0xDF,
-    0xF0,
-    0x1E,
-    0xCC,
-    0xF8,
-    0x2E,
-    0x9F,
-    0xF0,
-    0x9F,
-    0x19,
-    0xC4,
-    0xF8,
-    0xC3,
-    0xAD,
-    0xF0,
-    0x9F,
-    0x03,
-    0x48,
-    0x0B,
-    0xFC,
-    0x67,
-    0x63,
-    0xF8,
-    0xCB,
-    0x0B,
-    0x64,
-    0x14,
-    0xFC,
-    0x67,
-    0x62,
-    0xF8,
-    0xA1,
-    0x0F,
-    0x64,
-    0x1C,
-    0xB8,
-    0xCF,
-    0xC0,
-    0xF0,
-    0xB9,
-    0x1E,
-    0xC8,
-    0xF8,
-    0xD8,
-    0xCF,
-    0xC0,
-    0xF0,
-    0x00,
-    0xC8,
-    0x61,
-    0xF8,
-    0x56,
-    0xEF,
-    0xE2,
-    0x72,
-    0x04,
-    0x28,
-    0xCD,
-    0xF0,
-    0xFB,
-    0x3F,
-    0x08,
-    0xB0,
-    0x03,
-    0x35,
-    0x81,
-    0x01,
-    0x0F,
-    0x43,
-    0xC2,
-    0x7F,
-    0x56,
-    0xA0,
-    0xFC,
-    0x6F,
-    0x79,
-    0x86,
-    0x0D,
-    0xFF,
-    0xC1,
-    0xA6,
-    0xE7,
-    0x33,
-    0x7C,
-    0xD8,
-    0x0F,
-    0xB6,
-    0x6F,
-    0x3F,
-    0xC3,
-    0xD7,
-    0x7C,
-    0xB0,
-    0x0B,
-    0xFE,
-    0x33,
-    0xFE,
-    0x92,
-    0x87,
-    0xB8,
-    0x89,
-    0x0D,
-    0x00,
-    0xBC,
-    0xC0,
-    0x3D,
-    0x23,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF8,
-    0xFF,
-    0xFF,
-    0xFB,
-    0x39,
-    0x2C,
-    0x0C,
-    0x0C,
-    0x1F,
-    0xFF,
-    0x03,
-    0xC1,
-    0x79,
-    0x26,
-    0x86,
-    0x8F,
-    0xFB,
-    0x8D,
-    0x9D,
-    0xAF,
-    0xFF,
-    0xE7,
-    0x05,
-    0xD2,
-    0x0C,
-    0x0C,
-    0x0C,
-    0xBF,
-    0xE3,
-    0x21,
-    0xF4,
-    0xD7,
-    0x7E,
-    0x28,
-    0x5D,
-    0x0F,
-    0x15,
-    0xD7,
-    0x07,
-    0xD1,
-    0x02,
-    0x5B,
-    0xFE,
-    0xB3,
-    0x43,
-    0xF4,
-    0x79,
-    0x43,
-    0xF5,
-    0xD7,
-    0x30,
-    0x80,
-    0xF5,
-    0x1F,
-    0xFB,
-    0xAF,
-    0x0B,
-    0x51,
-    0xF7,
-    0xED,
-    0x3E,
-    0x84,
-    0x3E,
-    0xF0,
-    0x9F,
-    0x19,
-    0x4C,
-    0x37,
-    0xFC,
-    0x67,
-    0x43,
-    0xA1,
-    0x37,
-    0xFC,
-    0x67,
-    0x01,
-    0xD3,
-    0x9F,
-    0xDF,
-    0x83,
-    0xF4,
-    0x19,
-    0x2F,
-    0xFD,
-    0x9F,
-    0x0F,
-    0x31,
-    0xE7,
-    0x3F,
-    0x1B,
-    0x98,
-    0xDE,
-    0x2B,
-    0xCE,
-    0xC0,
-    0x00,
-    0x00,
-    0x2C,
-    0x16,
-    0x4F,
-    0xE8,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x30,
-    0xB8,
-    0xF5,
-    0x7F,
-    0x1D,
-    0x0B,
-    0x03,
-    0x83,
-    0xC0,
-    0xAF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x67,
-    0x62,
-    0xB8,
-    0xF0,
-    0xBF,
-    0xD6,
-    0xE4,
-    0xD8,
-    0x7B,
-    0x46,
-    0x86,
-    0x5F,
-    0xF3,
-    0x19,
-    0x18,
-    0x18,
-    0xCC,
-    0x18,
-    0x0C,
-    0xFE,
-    0xF3,
-    0x30,
-    0x80,
-    0xC0,
-    0x82,
-    0xFF,
-    0x2C,
-    0x60,
-    0xFA,
-    0xC3,
-    0x7B,
-    0x30,
-    0xC5,
-    0xF0,
-    0x69,
-    0x3F,
-    0x84,
-    0xFE,
-    0x3A,
-    0x1F,
-    0x3F,
-    0x0D,
-    0x53,
-    0x07,
-    0xD3,
-    0x07,
-    0x33,
-    0xC7,
-    0x01,
-    0x6A,
-    0x2E,
-    0xC3,
-    0xEF,
-    0xF5,
-    0x40,
-    0xA2,
-    0x98,
-    0x81,
-    0xE1,
-    0xE2,
-    0xFF,
-    0x5C,
-    0xE3,
-    0xAD,
-    0xFF,
-    0xD9,
-    0x18,
-    0x04,
-    0x7E,
-    0x43,
-    0xDC,
-    0xC1,
-    0xE0,
-    0x70,
-    0xEB,
-    0xFF,
-    0x5A,
-    0x56,
-    0x06,
-    0x00,
-    0xD8,
-    0xE1,
-    0x2E,
-    0xC0,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF8,
-    0xFF,
-    0xFF,
-    0xBD,
-    0x48,
-    0x06,
-    0x06,
-    0x86,
-    0x8F,
-    0xFF,
-    0x81,
-    0xA0,
-    0x1E,
-    0x48,
-    0xEF,
-    0x37,
-    0x0E,
-    0x79,
-    0xF9,
-    0x9F,
-    0x1B,
-    0x48,
-    0x33,
-    0x30,
-    0x08,
-    0xFC,
-    0x59,
-    0x0F,
-    0xA6,
-    0x19,
-    0x1E,
-    0xFE,
-    0x67,
-    0x06,
-    0xD3,
-    0x05,
-    0xFF,
-    0x39,
-    0xC1,
-    0xB4,
-    0xC2,
-    0x7F,
-    0x5E,
-    0x30,
-    0xCD,
-    0xF0,
-    0x9F,
-    0x1F,
-    0x42,
-    0xFF,
-    0x95,
-    0x87,
-    0xD0,
-    0x7F,
-    0xF4,
-    0x51,
-    0x69,
-    0x98,
-    0x38,
-    0x54,
-    0x9D,
-    0xC2,
-    0x7F,
-    0x1E,
-    0x30,
-    0xDD,
-    0xF0,
-    0x9F,
-    0x03,
-    0x4C,
-    0x3F,
-    0xFA,
-    0xCF,
-    0x08,
-    0xA2,
-    0x15,
-    0xFE,
-    0xD6,
-    0x83,
-    0xEC,
-    0x0D,
-    0xFE,
-    0xF5,
-    0x9F,
-    0x13,
-    0xE2,
-    0x8E,
-    0x38,
-    0xB0,
-    0x7B,
-    0xEE,
-    0x47,
-    0x01,
-    0x95,
-    0x00,
-    0x00,
-    0x59,
-    0x99,
-    0x46,
-    0x24,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF8,
-    0x1F,
-    0x08,
-    0xF6,
-    0x33,
-    0x7C,
-    0x04,
-    0x51,
-    0xF3,
-    0x19,
-    0x3E,
-    0xEE,
-    0x37,
-    0x36,
-    0x36,
-    0x16,
-    0x06,
-    0x52,
-    0x0C,
-    0x20,
-    0x80,
-    0x9F,
-    0x02,
-    0xAA,
-    0x64,
-    0x84,
-    0xE8,
-    0x63,
-    0x87,
-    0x53,
-    0xC4,
-    0xE8,
-    0x43,
-    0x68,
-    0x37,
-    0x86,
-    0xE8,
-    0xFB,
-    0x0F,
-    0xA3,
-    0x00,
-    0x54,
-    0x10,
-    0x3A,
-    0xAB,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF8,
-    0x1F,
-    0x08,
-    0xFA,
-    0x3F,
-    0x82,
-    0xC8,
-    0xF8,
-    0x8F,
-    0xFB,
-    0x8D,
-    0x8D,
-    0x8D,
-    0x99,
-    0x3F,
-    0xEE,
-    0x67,
-    0x00,
-    0x02,
-    0xDC,
-    0x24,
-    0x50,
-    0x0D,
-    0x03,
-    0x58,
-    0x3D,
-    0x0B,
-    0x94,
-    0x24,
-    0xA0,
-    0x1E,
-    0x3B,
-    0x09,
-    0x00,
-    0x7D,
-    0x2E,
-    0x30,
-    0xE0,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x10,
-    0x38,
-    0xF1,
-    0xFF,
-    0x9C,
-    0x38,
-    0x03,
-    0x03,
-    0xC3,
-    0x8F,
-    0xFF,
-    0x40,
-    0xC0,
-    0xCE,
-    0xB0,
-    0xE0,
-    0x7F,
-    0x9F,
-    0x49,
-    0xC9,
-    0x5F,
-    0x59,
-    0x86,
-    0x1F,
-    0xE7,
-    0x19,
-    0x19,
-    0x18,
-    0x12,
-    0x18,
-    0x15,
-    0xFE,
-    0xCB,
-    0x31,
-    0x80,
-    0xC0,
-    0x84,
-    0xFF,
-    0x6C,
-    0x60,
-    0xFA,
-    0xC1,
-    0x7F,
-    0x46,
-    0x30,
-    0xFD,
-    0xE9,
-    0x3C,
-    0x98,
-    0x62,
-    0xF8,
-    0xB2,
-    0x9E,
-    0x81,
-    0xE1,
-    0xC3,
-    0xFF,
-    0xFF,
-    0xF3,
-    0xBF,
-    0xCE,
-    0x67,
-    0x60,
-    0x38,
-    0x00,
-    0xA5,
-    0x15,
-    0x8C,
-    0xBF,
-    0xCC,
-    0xFF,
-    0x32,
-    0x1F,
-    0xAC,
-    0x6A,
-    0xFE,
-    0xE7,
-    0xFD,
-    0x10,
-    0xFA,
-    0xC3,
-    0x7B,
-    0x08,
-    0xBD,
-    0xE1,
-    0x3F,
-    0x33,
-    0x98,
-    0x0E,
-    0xF8,
-    0xCF,
-    0x0D,
-    0xA6,
-    0x19,
-    0xFE,
-    0xD4,
-    0x43,
-    0xE8,
-    0x47,
-    0xFF,
-    0x73,
-    0x8C,
-    0xA7,
-    0xFE,
-    0x9F,
-    0xCF,
-    0xA0,
-    0xF0,
-    0x07,
-    0xE4,
-    0x0E,
-    0x5F,
-    0x06,
-    0x86,
-    0x80,
-    0x5B,
-    0xFF,
-    0xCF,
-    0x59,
-    0x30,
-    0x00,
-    0x00,
-    0x8E,
-    0xAA,
-    0x42,
-    0x36,
-    0x78,
-    0x9C,
-    0xFB,
-    0xB8,
-    0x9F,
-    0x01,
-    0x08,
-    0xFE,
-    0xF2,
-    0x7D,
-    0x24,
-    0x97,
-    0xFE,
-    0x0F,
-    0x06,
-    0x08,
-    0x7A,
-    0xBF,
-    0x31,
-    0x10,
-    0xFC,
-    0x23,
-    0xDF,
-    0x3C,
-    0x34,
-    0x1A,
-    0x00,
-    0x8D,
-    0x24,
-    0x3F,
-    0xE6,
-    0x78,
-    0x9C,
-    0xFB,
-    0xB8,
-    0xFF,
-    0x23,
-    0x51,
-    0x10,
-    0x00,
-    0xB6,
-    0x1A,
-    0x21,
-    0xC1,
-    0x78,
-    0x9C,
-    0x63,
-    0x58,
-    0xF0,
-    0x9F,
-    0x89,
-    0x81,
-    0x72,
-    0xCC,
-    0xC8,
-    0xB0,
-    0x01,
-    0x88,
-    0x2F,
-    0xFC,
-    0x67,
-    0x60,
-    0xF8,
-    0xB2,
-    0x9F,
-    0xC1,
-    0xE0,
-    0x9F,
-    0x3D,
-    0xC3,
-    0xCF,
-    0xFF,
-    0xEC,
-    0x0C,
-    0xDF,
-    0x7D,
-    0x19,
-    0x18,
-    0x1C,
-    0x19,
-    0x18,
-    0x18,
-    0x00,
-    0x0C,
-    0x20,
-    0x27,
-    0x75,
-    0x78,
-    0x9C,
-    0xFB,
-    0xB8,
-    0x9F,
-    0x81,
-    0x81,
-    0xE1,
-    0xE2,
-    0x7F,
-    0xE6,
-    0x8F,
-    0x20,
-    0xFA,
-    0x77,
-    0x3E,
-    0x03,
-    0x88,
-    0x6E,
-    0xF8,
-    0xCF,
-    0x09,
-    0xA6,
-    0xBF,
-    0x02,
-    0x31,
-    0x90,
-    0x36,
-    0xF8,
-    0x2F,
-    0x0B,
-    0xA6,
-    0x1F,
-    0xFE,
-    0x67,
-    0x02,
-    0xD3,
-    0x7F,
-    0xFC,
-    0x19,
-    0x40,
-    0xF4,
-    0x84,
-    0xFF,
-    0xEC,
-    0x60,
-    0xFA,
-    0xDB,
-    0x7A,
-    0x06,
-    0x30,
-    0xFD,
-    0xCF,
-    0x1F,
-    0x42,
-    0x7F,
-    0x7D,
-    0xCF,
-    0x08,
-    0x95,
-    0xE7,
-    0x06,
-    0xD3,
-    0x0C,
-    0x7F,
-    0xEB,
-    0x21,
-    0xF4,
-    0xA7,
-    0xFF,
-    0x2C,
-    0x60,
-    0x3A,
-    0xE0,
-    0xBF,
-    0x1C,
-    0x98,
-    0x66,
-    0xF8,
-    0x79,
-    0x1E,
-    0x42,
-    0x5F,
-    0xF8,
-    0xCF,
-    0x01,
-    0xA6,
-    0x15,
-    0xFE,
-    0xFB,
-    0x83,
-    0x69,
-    0x06,
-    0xA0,
-    0x11,
-    0x60,
-    0x7A,
-    0xC2,
-    0x7F,
-    0x1E,
-    0x00,
-    0xFD,
-    0x4C,
-    0x42,
-    0x25,
-    0x78,
-    0x9C,
-    0xFB,
-    0xB8,
-    0x9F,
-    0x01,
-    0x08,
-    0x3E,
-    0xD2,
-    0x9A,
-    0xBC,
-    0x5F,
-    0x5E,
-    0x5E,
-    0x9E,
-    0xFE,
-    0xF1,
-    0x3F,
-    0x10,
-    0xDC,
-    0x07,
-    0x93,
-    0xFB,
-    0x01,
-    0x8B,
-    0x3E,
-    0x2B,
-    0xC5,
-    0x78,
-    0x9C,
-    0x25,
-    0x8E,
-    0xC9,
-    0x0D,
-    0x82,
-    0x60,
-    0x14,
-    0x84,
-    0x07,
-    0xB7,
-    0x28,
-    0x51,
-    0xF0,
-    0xE2,
-    0x59,
-    0x3A,
-    0xD0,
-    0x0E,
-    0x28,
-    0x01,
-    0x3B,
-    0xD0,
-    0x93,
-    0x57,
-    0xED,
-    0x40,
-    0xEF,
-    0x1E,
-    0xB0,
-    0x03,
-    0xED,
-    0x00,
-    0x4E,
-    0x5E,
-    0xB5,
-    0x03,
-    0xE8,
-    0x00,
-    0x3A,
-    0x10,
-    0x71,
-    0x61,
-    0xFF,
-    0xC7,
-    0x67,
-    0x7C,
-    0xC9,
-    0x24,
-    0x33,
-    0xC9,
-    0xE4,
-    0x7D,
-    0x83,
-    0x82,
-    0x5D,
-    0x00,
-    0x25,
-    0x3B,
-    0x22,
-    0x5D,
-    0x9C,
-    0x92,
-    0x5C,
-    0xD1,
-    0x00,
-    0xE6,
-    0x64,
-    0x0F,
-    0x4D,
-    0x63,
-    0x03,
-    0xFB,
-    0x88,
-    0x7D,
-    0xA8,
-    0xDC,
-    0x05,
-    0x6E,
-    0x2E,
-    0x07,
-    0xE0,
-    0x25,
-    0x00,
-    0x1E,
-    0x8E,
-    0xD2,
-    0xC7,
-    0x5C,
-    0x53,
-    0xC3,
-    0xDB,
-    0x6C,
-    0x86,
-    0x16,
-    0x27,
-    0x52,
-    0x2E,
-    0xF4,
-    0x7A,
-    0x34,
-    0x67,
-    0xA7,
-    0xD6,
-    0xA1,
-    0xBA,
-    0x95,
-    0xB1,
-    0x60,
-    0x3B,
-    0x33,
-    0x2D,
-    0x6A,
-    0xA5,
-    0xB9,
-    0x62,
-    0x2B,
-    0x75,
-    0x56,
-    0x01,
-    0xF2,
-    0xE9,
-    0x96,
-    0x5A,
-    0xE8,
-    0xFA,
-    0x3B,
-    0x64,
-    0xB3,
-    0x23,
-    0xE5,
-    0x6D,
-    0x62,
-    0xE3,
-    0xE3,
-    0x9C,
-    0xEF,
-    0x82,
-    0xFA,
-    0x18,
-    0x78,
-    0x2D,
-    0xFD,
-    0x48,
-    0xF0,
-    0x6A,
-    0x80,
-    0xE7,
-    0x26,
-    0x0C,
-    0xFE,
-    0x93,
-    0x52,
-    0x37,
-    0xBE,
-    0x02,
-    0x6F,
-    0x0A,
-    0xEF,
-    0x94,
-    0x78,
-    0x80,
-    0x7F,
-    0x00,
-    0x12,
-    0xEF,
-    0x21,
-    0x4B,
-    0x7E,
-    0x17,
-    0x07,
-    0xE9,
-    0xEE,
-    0xEF,
-    0xC2,
-    0xE8,
-    0x0B,
-    0xAB,
-    0x48,
-    0x5A,
-    0x91,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF8,
-    0x9F,
-    0x87,
-    0x81,
-    0x81,
-    0xE1,
-    0x27,
-    0xFF,
-    0xC7,
-    0xFF,
-    0xFE,
-    0x50,
-    0x7A,
-    0x3F,
-    0x84,
-    0xBE,
-    0xFF,
-    0x9F,
-    0x19,
-    0x4C,
-    0xD7,
-    0xFF,
-    0xE7,
-    0x06,
-    0xD3,
-    0xF1,
-    0xBF,
-    0xED,
-    0xC1,
-    0x74,
-    0xFE,
-    0x97,
-    0xF5,
-    0x10,
-    0xFA,
-    0xC0,
-    0x7F,
-    0x26,
-    0xB0,
-    0xBC,
-    0xC3,
-    0x7F,
-    0x2E,
-    0x30,
-    0xCD,
-    0xF0,
-    0x47,
-    0x1F,
-    0x44,
-    0xF7,
-    0x33,
-    0x7C,
-    0x9D,
-    0x0F,
-    0xA1,
-    0x2F,
-    0xFC,
-    0x67,
-    0x04,
-    0xD3,
-    0x01,
-    0xFF,
-    0x39,
-    0x7F,
-    0x80,
-    0x68,
-    0x86,
-    0xBF,
-    0xF2,
-    0x10,
-    0xFA,
-    0x6B,
-    0xFF,
-    0x77,
-    0x30,
-    0x7D,
-    0xE1,
-    0x3F,
-    0x84,
-    0x4E,
-    0xF8,
-    0xFF,
-    0x07,
-    0x4C,
-    0x33,
-    0xFC,
-    0xFB,
-    0x0F,
-    0xA1,
-    0xBF,
-    0x41,
-    0xE9,
-    0x07,
-    0xFF,
-    0xF9,
-    0x01,
-    0x83,
-    0x96,
-    0x4B,
-    0x46,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x30,
-    0xB8,
-    0xF9,
-    0x7F,
-    0x1D,
-    0x2B,
-    0x03,
-    0x03,
-    0x83,
-    0xC0,
-    0xAF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x67,
-    0x62,
-    0x60,
-    0xB8,
-    0xF0,
-    0x3F,
-    0xD7,
-    0x78,
-    0xEB,
-    0x7F,
-    0x3D,
-    0x06,
-    0x86,
-    0x5F,
-    0xF3,
-    0x81,
-    0xC2,
-    0x5F,
-    0xEF,
-    0x33,
-    0x18,
-    0xFC,
-    0xE7,
-    0x01,
-    0x32,
-    0x1A,
-    0xFE,
-    0xB3,
-    0x2F,
-    0xF8,
-    0xCF,
-    0x02,
-    0x52,
-    0xF8,
-    0x9F,
-    0xF7,
-    0xC3,
-    0x7B,
-    0x06,
-    0x10,
-    0xF8,
-    0xA3,
-    0xFF,
-    0x69,
-    0x3F,
-    0x98,
-    0xF1,
-    0x33,
-    0xFE,
-    0xCB,
-    0x7C,
-    0x30,
-    0xE3,
-    0x5B,
-    0xFF,
-    0x57,
-    0xDC,
-    0x8C,
-    0xCF,
-    0x10,
-    0xC5,
-    0x3F,
-    0xE2,
-    0xA1,
-    0xDA,
-    0x7F,
-    0xEB,
-    0x6F,
-    0xF8,
-    0xCF,
-    0x0C,
-    0x31,
-    0xD0,
-    0xE1,
-    0x3F,
-    0x37,
-    0xC4,
-    0x0A,
-    0x86,
-    0xDF,
-    0x50,
-    0x4B,
-    0x19,
-    0x2E,
-    0xC2,
-    0x9C,
-    0x21,
-    0xF0,
-    0x1B,
-    0xEA,
-    0x30,
-    0x06,
-    0x87,
-    0x5B,
-    0x60,
-    0xA7,
-    0x02,
-    0x00,
-    0x80,
-    0x3C,
-    0x42,
-    0x5D,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF8,
-    0xFF,
-    0xFF,
-    0xFB,
-    0x39,
-    0x2C,
-    0x0C,
-    0x0C,
-    0x1F,
-    0xFF,
-    0x03,
-    0xC1,
-    0x79,
-    0x46,
-    0x86,
-    0x8F,
-    0xFB,
-    0x8D,
-    0x9D,
-    0x5F,
-    0xFC,
-    0xE7,
-    0x03,
-    0xD2,
-    0x0C,
-    0x0C,
-    0x0C,
-    0x7F,
-    0xFA,
-    0x21,
-    0xF4,
-    0xE7,
-    0xFB,
-    0x10,
-    0xFA,
-    0xC3,
-    0x7F,
-    0x54,
-    0xFA,
-    0x13,
-    0x54,
-    0xFC,
-    0x27,
-    0x58,
-    0x9D,
-    0xC0,
-    0x96,
-    0xFF,
-    0x72,
-    0x10,
-    0x73,
-    0xEE,
-    0x33,
-    0x81,
-    0xE9,
-    0xF3,
-    0x6C,
-    0x0C,
-    0x20,
-    0xF3,
-    0x84,
-    0x80,
-    0x2A,
-    0x20,
-    0xEA,
-    0xC8,
-    0xA0,
-    0x01,
-    0xBB,
-    0x2C,
-    0x3E,
-    0xF2,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x30,
-    0xB8,
-    0xF9,
-    0x7F,
-    0x1D,
-    0x2B,
-    0x03,
-    0x10,
-    0x08,
-    0xFC,
-    0xFA,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x79,
-    0x26,
-    0x20,
-    0xEB,
-    0xC0,
-    0xFF,
-    0x5C,
-    0xE3,
-    0xAD,
-    0xFF,
-    0xF5,
-    0x80,
-    0xAC,
-    0x5F,
-    0xF3,
-    0x81,
-    0xC4,
-    0xD7,
-    0xFB,
-    0x0C,
-    0x0C,
-    0x06,
-    0xFF,
-    0x79,
-    0x80,
-    0xAC,
-    0x86,
-    0xFF,
-    0xEC,
-    0x0C,
-    0x0B,
-    0xFE,
-    0xB3,
-    0x80,
-    0x14,
-    0xFF,
-    0xE7,
-    0x65,
-    0xF8,
-    0xF0,
-    0x1E,
-    0xA4,
-    0x8D,
-    0xE1,
-    0x8F,
-    0x3E,
-    0xC3,
-    0xA7,
-    0xFD,
-    0x60,
-    0xD6,
-    0xCF,
-    0x78,
-    0x86,
-    0x2F,
-    0xF3,
-    0xC1,
-    0xAC,
-    0x6F,
-    0xFD,
-    0x0C,
-    0x5F,
-    0xF1,
-    0xB2,
-    0x3E,
-    0x43,
-    0x74,
-    0xFC,
-    0x88,
-    0x87,
-    0x99,
-    0xF2,
-    0x5B,
-    0x9F,
-    0x61,
-    0xC3,
-    0x7F,
-    0x66,
-    0xA8,
-    0xC9,
-    0x0E,
-    0xFF,
-    0xB9,
-    0xC1,
-    0xB6,
-    0x01,
-    0xDD,
-    0xF5,
-    0x1B,
-    0xEC,
-    0x02,
-    0x10,
-    0xF1,
-    0x10,
-    0xEC,
-    0x2A,
-    0x4E,
-    0x90,
-    0x92,
-    0x3F,
-    0x40,
-    0x97,
-    0xAE,
-    0x07,
-    0x39,
-    0x83,
-    0xC1,
-    0xE1,
-    0x16,
-    0x90,
-    0xF9,
-    0x5F,
-    0x0B,
-    0x6C,
-    0x04,
-    0x83,
-    0xC2,
-    0xD6,
-    0xFF,
-    0xFF,
-    0x99,
-    0x20,
-    0x4C,
-    0x86,
-    0xCB,
-    0xF3,
-    0x19,
-    0x60,
-    0x80,
-    0x83,
-    0x01,
-    0x00,
-    0x7E,
-    0xB8,
-    0x48,
-    0x9C,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF8,
-    0xFF,
-    0xFF,
-    0xFB,
-    0xB5,
-    0xAC,
-    0x0C,
-    0x0C,
-    0x1F,
-    0xFF,
-    0x03,
-    0xC1,
-    0x7D,
-    0x26,
-    0x86,
-    0x8F,
-    0xFB,
-    0x8D,
-    0x9D,
-    0xAF,
-    0xFF,
-    0x97,
-    0x03,
-    0xD2,
-    0x0C,
-    0x0C,
-    0x0C,
-    0xBF,
-    0xEB,
-    0x21,
-    0xF4,
-    0xE7,
-    0xFD,
-    0x10,
-    0xFA,
-    0xD3,
-    0x7D,
-    0x54,
-    0xFE,
-    0x2F,
-    0xB0,
-    0xBC,
-    0xC0,
-    0x92,
-    0xFF,
-    0x7C,
-    0x10,
-    0xFD,
-    0xE7,
-    0x99,
-    0xC0,
-    0xF4,
-    0x7D,
-    0x16,
-    0x06,
-    0x90,
-    0x39,
-    0x9F,
-    0xDF,
-    0x33,
-    0x82,
-    0x68,
-    0x86,
-    0x82,
-    0xFF,
-    0x1C,
-    0x60,
-    0x9A,
-    0xE1,
-    0x9F,
-    0x3E,
-    0x84,
-    0xFE,
-    0xB6,
-    0x1F,
-    0x42,
-    0x5F,
-    0xF8,
-    0xCF,
-    0x02,
-    0xA6,
-    0x1D,
-    0xFE,
-    0xF3,
-    0xA2,
-    0xD9,
-    0xF7,
-    0x9F,
-    0x11,
-    0x4C,
-    0x2F,
-    0xF8,
-    0xCF,
-    0x05,
-    0x00,
-    0x16,
-    0x81,
-    0x4A,
-    0xE5,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x58,
-    0xF2,
-    0xF7,
-    0xBE,
-    0x17,
-    0x03,
-    0x03,
-    0xC3,
-    0x82,
-    0xFF,
-    0x40,
-    0xA0,
-    0xC3,
-    0xC0,
-    0xF0,
-    0xEB,
-    0xBE,
-    0x5B,
-    0xF2,
-    0xEF,
-    0xF3,
-    0x0C,
-    0x0A,
-    0xFF,
-    0x79,
-    0x18,
-    0x18,
-    0x0C,
-    0x74,
-    0x18,
-    0x12,
-    0xFE,
-    0xB3,
-    0x31,
-    0x80,
-    0x40,
-    0xC2,
-    0x7F,
-    0x76,
-    0x30,
-    0x6D,
-    0xF0,
-    0x9F,
-    0x17,
-    0x4C,
-    0x33,
-    0xFC,
-    0x79,
-    0x0F,
-    0x91,
-    0xB8,
-    0xF8,
-    0xFF,
-    0x7F,
-    0x14,
-    0x98,
-    0xF1,
-    0xFC,
-    0xFF,
-    0xFF,
-    0x7E,
-    0x46,
-    0x10,
-    0x63,
-    0xC9,
-    0xBF,
-    0xFF,
-    0x76,
-    0x60,
-    0x91,
-    0x80,
-    0xBF,
-    0xEF,
-    0x21,
-    0x6A,
-    0x0F,
-    0x40,
-    0x0D,
-    0x71,
-    0xF8,
-    0xCF,
-    0x05,
-    0xA6,
-    0x15,
-    0xFE,
-    0x73,
-    0x43,
-    0x14,
-    0xFC,
-    0xE7,
-    0x0C,
-    0xF0,
-    0x05,
-    0x9B,
-    0xC1,
-    0xFC,
-    0xF0,
-    0x7F,
-    0x8D,
-    0x49,
-    0xCB,
-    0xFF,
-    0xF5,
-    0x0C,
-    0x0A,
-    0x7F,
-    0x40,
-    0xEE,
-    0xE0,
-    0x04,
-    0x5A,
-    0x74,
-    0xF2,
-    0xDF,
-    0x3D,
-    0x0B,
-    0x06,
-    0x06,
-    0x00,
-    0x0A,
-    0xC7,
-    0x34,
-    0x07,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF9,
-    0x1F,
-    0x0C,
-    0xB8,
-    0x7F,
-    0x42,
-    0x68,
-    0x4E,
-    0x43,
-    0x63,
-    0xE3,
-    0xBF,
-    0x76,
-    0xC6,
-    0xC6,
-    0x8C,
-    0x0C,
-    0x0C,
-    0x0C,
-    0x7F,
-    0xF9,
-    0x18,
-    0xC0,
-    0x60,
-    0x40,
-    0x69,
-    0x00,
-    0x5B,
-    0x39,
-    0x21,
-    0xEF,
-    0x78,
-    0x9C,
-    0xFB,
-    0x96,
-    0xCF,
-    0xC0,
-    0xC0,
-    0x20,
-    0xF0,
-    0x9F,
-    0xFB,
-    0x1B,
-    0x8D,
-    0xE9,
-    0xAF,
-    0x20,
-    0x5A,
-    0xE1,
-    0x3F,
-    0xD7,
-    0x97,
-    0x7E,
-    0x20,
-    0x6D,
-    0xF0,
-    0x9F,
-    0xE3,
-    0xE3,
-    0x79,
-    0x20,
-    0x5D,
-    0xF0,
-    0x9F,
-    0x75,
-    0xC3,
-    0x7F,
-    0x56,
-    0x06,
-    0x86,
-    0x47,
-    0xFF,
-    0x81,
-    0x52,
-    0xF3,
-    0x4D,
-    0x4A,
-    0xFE,
-    0xC5,
-    0x33,
-    0x30,
-    0x3C,
-    0xFE,
-    0x0F,
-    0x04,
-    0x6C,
-    0x40,
-    0xC9,
-    0xE3,
-    0xFF,
-    0xCE,
-    0x89,
-    0x33,
-    0x30,
-    0x00,
-    0x00,
-    0x54,
-    0x64,
-    0x37,
-    0xD6,
-    0x78,
-    0x9C,
-    0x25,
-    0xCC,
-    0xE9,
-    0x11,
-    0x82,
-    0x50,
-    0x0C,
-    0x04,
-    0xE0,
-    0x75,
-    0xBC,
-    0x6F,
-    0x3A,
-    0x80,
-    0x0E,
-    0x2C,
-    0xC1,
-    0x12,
-    0xB4,
-    0x03,
-    0xED,
-    0x00,
-    0x3A,
-    0xB0,
-    0x14,
-    0xEC,
-    0x40,
-    0x3B,
-    0xE0,
-    0x75,
-    0x60,
-    0x0B,
-    0x76,
-    0xC0,
-    0xF3,
-    0x40,
-    0x50,
-    0x60,
-    0xD6,
-    0x24,
-    0x64,
-    0x26,
-    0x99,
-    0xEF,
-    0xC7,
-    0x66,
-    0x7F,
-    0x3B,
-    0xC8,
-    0xDC,
-    0x73,
-    0x14,
-    0xA9,
-    0xE2,
-    0x95,
-    0xC2,
-    0xE7,
-    0x8A,
-    0x72,
-    0x8B,
-    0x2B,
-    0xFB,
-    0x82,
-    0x66,
-    0x85,
-    0x3D,
-    0xC7,
-    0x40,
-    0xC0,
-    0xA9,
-    0xEC,
-    0x02,
-    0x38,
-    0x72,
-    0x00,
-    0xD4,
-    0x21,
-    0x70,
-    0xD6,
-    0xE0,
-    0x27,
-    0x06,
-    0xFC,
-    0x45,
-    0xF0,
-    0x90,
-    0xF3,
-    0x3E,
-    0x08,
-    0x1C,
-    0x81,
-    0xEF,
-    0x1A,
-    0x5D,
-    0xB0,
-    0x9D,
-    0x41,
-    0x5F,
-    0x27,
-    0x11,
-    0x87,
-    0xDA,
-    0xDA,
-    0x2C,
-    0x13,
-    0xC2,
-    0xEA,
-    0x37,
-    0x2E,
-    0x33,
-    0x3C,
-    0x4F,
-    0x3E,
-    0x36,
-    0xB8,
-    0xAC,
-    0x08,
-    0x0D,
-    0x09,
-    0xEB,
-    0xB9,
-    0x21,
-    0x22,
-    0x47,
-    0x06,
-    0xB4,
-    0xEC,
-    0x75,
-    0xA8,
-    0x6E,
-    0x7A,
-    0xFF,
-    0x9A,
-    0x46,
-    0x33,
-    0xE5,
-    0x78,
-    0x9C,
-    0x15,
-    0x8F,
-    0xDB,
-    0x6D,
-    0xC2,
-    0x50,
-    0x10,
-    0x44,
-    0x0F,
-    0x82,
-    0xF0,
-    0x70,
-    0xB0,
-    0x9C,
-    0x0E,
-    0xA0,
-    0x03,
-    0xDC,
-    0x81,
-    0x4B,
-    0x80,
-    0x0E,
-    0xB8,
-    0x1D,
-    0xD0,
-    0x02,
-    0x1D,
-    0x98,
-    0x0E,
-    0x42,
-    0x2A,
-    0x80,
-    0x0E,
-    0xA0,
-    0x03,
-    0xFB,
-    0x83,
-    0x7F,
-    0xD2,
-    0x81,
-    0xB1,
-    0x65,
-    0xC4,
-    0x55,
-    0x2E,
-    0x78,
-    0x33,
-    0xFC,
-    0xEC,
-    0xAC,
-    0x34,
-    0x3B,
-    0x8F,
-    0x6D,
-    0x72,
-    0xC0,
-    0x7F,
-    0x6B,
-    0xB4,
-    0xCB,
-    0xDB,
-    0x49,
-    0xF0,
-    0xBC,
-    0x6A,
-    0x3C,
-    0x92,
-    0x73,
-    0x25,
-    0x30,
-    0xEB,
-    0xC1,
-    0x5F,
-    0xBC,
-    0x15,
-    0xA4,
-    0x66,
-    0x03,
-    0x78,
-    0x45,
-    0x2B,
-    0x81,
-    0x2B,
-    0xC2,
-    0x58,
-    0xE4,
-    0x68,
-    0x6E,
-    0x23,
-    0xF6,
-    0xB9,
-    0xFF,
-    0x14,
-    0xD9,
-    0xA7,
-    0x8B,
-    0x28,
-    0xD7,
-    0x6D,
-    0x82,
-    0x33,
-    0x08,
-    0x31,
-    0xF5,
-    0xAC,
-    0xCE,
-    0xD8,
-    0xC9,
-    0xCB,
-    0x27,
-    0xB4,
-    0x71,
-    0xB9,
-    0xE1,
-    0x7C,
-    0x80,
-    0x7B,
-    0x86,
-    0x8F,
-    0xF6,
-    0x07,
-    0x6E,
-    0x1B,
-    0x68,
-    0xD6,
-    0x84,
-    0xA1,
-    0xBB,
-    0xD2,
-    0x64,
-    0xF0,
-    0x9B,
-    0x63,
-    0xFD,
-    0xB9,
-    0xF5,
-    0xEE,
-    0x09,
-    0x1C,
-    0x4F,
-    0xA9,
-    0x1C,
-    0xEC,
-    0xC3,
-    0x4F,
-    0x61,
-    0x5B,
-    0x39,
-    0x55,
-    0x0A,
-    0xE3,
-    0x30,
-    0x81,
-    0x95,
-    0xFD,
-    0xA8,
-    0xAA,
-    0x9F,
-    0x76,
-    0x43,
-    0xF8,
-    0xB2,
-    0xCB,
-    0x52,
-    0x85,
-    0x17,
-    0x8A,
-    0x85,
-    0xCE,
-    0xCF,
-    0xA0,
-    0xCE,
-    0x25,
-    0xD2,
-    0x69,
-    0x17,
-    0x43,
-    0x59,
-    0x15,
-    0xEF,
-    0xFD,
-    0x61,
-    0x52,
-    0xED,
-    0xEC,
-    0xFD,
-    0x1A,
-    0xAD,
-    0x49,
-    0xE5,
-    0x4C,
-    0xB1,
-    0xFF,
-    0x79,
-    0x9D,
-    0x5A,
-    0xE5,
-    0x78,
-    0x9C,
-    0x1D,
-    0x8D,
-    0xED,
-    0x0D,
-    0x82,
-    0x40,
-    0x10,
-    0x05,
-    0x87,
-    0x9C,
-    0x09,
-    0x41,
-    0xB1,
-    0x05,
-    0xB5,
-    0x03,
-    0x4A,
-    0x91,
-    0x0E,
-    0xB0,
-    0x03,
-    0xAF,
-    0x03,
-    0x4B,
-    0xB0,
-    0x04,
-    0x4B,
-    0xD0,
-    0x0E,
-    0x6C,
-    0xC1,
-    0x0E,
-    0x38,
-    0x2A,
-    0x20,
-    0x24,
-    0xC4,
-    0x9C,
-    0x89,
-    0xF8,
-    0xBC,
-    0xBD,
-    0xFD,
-    0xF3,
-    0xB2,
-    0x1F,
-    0x33,
-    0x3B,
-    0xA9,
-    0x80,
-    0x56,
-    0x6B,
-    0xAF,
-    0x0A,
-    0x5E,
-    0xA9,
-    0x59,
-    0x1A,
-    0x78,
-    0x5F,
-    0x60,
-    0xBE,
-    0xC3,
-    0x6F,
-    0x0B,
-    0x0F,
-    0x39,
-    0xAF,
-    0x15,
-    0x1C,
-    0xB4,
-    0x09,
-    0x69,
-    0x04,
-    0xF1,
-    0x18,
-    0xF7,
-    0x96,
-    0xA1,
-    0x57,
-    0x69,
-    0xD9,
-    0xAA,
-    0x27,
-    0x97,
-    0xF2,
-    0x9A,
-    0x93,
-    0xE4,
-    0x2C,
-    0x87,
-    0xA7,
-    0xEA,
-    0x7C,
-    0xDF,
-    0xC4,
-    0x0E,
-    0xE3,
-    0xAB,
-    0x30,
-    0x62,
-    0xBE,
-    0xC2,
-    0x1B,
-    0x38,
-    0x5F,
-    0x93,
-    0x3F,
-    0x89,
-    0x96,
-    0x5D,
-    0xFA,
-    0x77,
-    0x4B,
-    0x54,
-    0x69,
-    0xFF,
-    0xDD,
-    0x30,
-    0x66,
-    0x65,
-    0xFD,
-    0x39,
-    0x1B,
-    0xFB,
-    0xED,
-    0xFE,
-    0x52,
-    0x84,
-    0x36,
-    0xDC,
-    0x78,
-    0x9C,
-    0xFB,
-    0x59,
-    0xCF,
-    0x00,
-    0x04,
-    0x9F,
-    0xD7,
-    0x7F,
-    0x7C,
-    0x0F,
-    0xA2,
-    0x7F,
-    0xEB,
-    0x37,
-    0xFC,
-    0x67,
-    0x63,
-    0x60,
-    0x30,
-    0xF8,
-    0xCF,
-    0x29,
-    0xF0,
-    0x9F,
-    0x8F,
-    0x81,
-    0x61,
-    0xC3,
-    0x7F,
-    0x46,
-    0x86,
-    0x1F,
-    0xF9,
-    0x40,
-    0xE9,
-    0x7E,
-    0x06,
-    0x86,
-    0x07,
-    0x40,
-    0x05,
-    0xBF,
-    0xE4,
-    0x19,
-    0x18,
-    0x0A,
-    0xFE,
-    0xB3,
-    0x29,
-    0xFC,
-    0xE7,
-    0x00,
-    0xAA,
-    0xFD,
-    0xC7,
-    0xBB,
-    0x00,
-    0xAC,
-    0xE7,
-    0x5B,
-    0xFC,
-    0x27,
-    0xB0,
-    0x19,
-    0x0F,
-    0xEE,
-    0xFF,
-    0xE2,
-    0x03,
-    0xD1,
-    0x09,
-    0xFF,
-    0x41,
-    0x46,
-    0x00,
-    0xC1,
-    0xDF,
-    0xFB,
-    0x60,
-    0x8A,
-    0xE1,
-    0x5B,
-    0x3D,
-    0x94,
-    0xCE,
-    0x27,
-    0x83,
-    0x06,
-    0x00,
-    0x15,
-    0x89,
-    0x2B,
-    0xBB,
-    0x78,
-    0x9C,
-    0x13,
-    0xF8,
-    0x0F,
-    0x02,
-    0xEF,
-    0x05,
-    0x20,
-    0x14,
-    0x83,
-    0x31,
-    0x10,
-    0x7C,
-    0x5F,
-    0xCF,
-    0x00,
-    0x02,
-    0xFF,
-    0xE4,
-    0x40,
-    0xE4,
-    0x84,
-    0xFF,
-    0x6C,
-    0x20,
-    0xEA,
-    0xF3,
-    0x79,
-    0xB0,
-    0xD8,
-    0x5F,
-    0x7D,
-    0x10,
-    0x59,
-    0xF0,
-    0x9F,
-    0x1D,
-    0x44,
-    0x7D,
-    0xBA,
-    0x0F,
-    0x16,
-    0xFB,
-    0x6D,
-    0x0F,
-    0x22,
-    0x13,
-    0xFE,
-    0x73,
-    0x82,
-    0xA8,
-    0x87,
-    0xEF,
-    0x19,
-    0x41,
-    0xD4,
-    0xAF,
-    0x78,
-    0x10,
-    0xE9,
-    0xF0,
-    0x9F,
-    0x1B,
-    0x44,
-    0x3D,
-    0xF8,
-    0x0F,
-    0x16,
-    0xFB,
-    0x99,
-    0x0F,
-    0x22,
-    0x0D,
-    0xFE,
-    0xF3,
-    0x80,
-    0xA8,
-    0x0B,
-    0xFF,
-    0x4D,
-    0x81,
-    0x36,
-    0x29,
-    0x7F,
-    0x02,
-    0x5B,
-    0x7B,
-    0x1F,
-    0x42,
-    0xAD,
-    0x07,
-    0x00,
-    0x9D,
-    0xBE,
-    0x33,
-    0x0E,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF8,
-    0xFF,
-    0x3F,
-    0xFF,
-    0x47,
-    0x10,
-    0xEE,
-    0x37,
-    0x66,
-    0xFA,
-    0x58,
-    0xCF,
-    0xC0,
-    0x40,
-    0x13,
-    0x0C,
-    0x32,
-    0x1B,
-    0x6A,
-    0x0F,
-    0x00,
-    0x8D,
-    0xF2,
-    0x2F,
-    0x03,
-    0x78,
-    0x9C,
-    0x0B,
-    0x64,
-    0x66,
-    0x60,
-    0x60,
-    0xF8,
-    0xC3,
-    0x09,
-    0x24,
-    0x7E,
-    0xF0,
-    0x02,
-    0x89,
-    0x2F,
-    0xFA,
-    0x40,
-    0xE2,
-    0x43,
-    0x3E,
-    0x90,
-    0x38,
-    0xB0,
-    0x1E,
-    0x48,
-    0x34,
-    0xBC,
-    0x07,
-    0x12,
-    0x0E,
-    0xFF,
-    0x99,
-    0x80,
-    0xE4,
-    0x7F,
-    0x36,
-    0x20,
-    0xF1,
-    0x9B,
-    0x1B,
-    0x48,
-    0x7C,
-    0xE7,
-    0x07,
-    0x12,
-    0x9F,
-    0xED,
-    0x41,
-    0x0A,
-    0xEB,
-    0x81,
-    0xC4,
-    0x86,
-    0xFD,
-    0x40,
-    0xA2,
-    0xE0,
-    0x3F,
-    0x90,
-    0x30,
-    0xF8,
-    0xCF,
-    0x02,
-    0x24,
-    0xFF,
-    0x71,
-    0x00,
-    0x89,
-    0x5F,
-    0x3C,
-    0x40,
-    0xE2,
-    0x1B,
-    0x48,
-    0xE1,
-    0x27,
-    0x7F,
-    0x20,
-    0xF1,
-    0xA0,
-    0x1F,
-    0x48,
-    0x2C,
-    0xB8,
-    0x0F,
-    0x24,
-    0x12,
-    0xFE,
-    0x33,
-    0x32,
-    0x30,
-    0x08,
-    0xFC,
-    0x67,
-    0x05,
-    0x32,
-    0xFF,
-    0x82,
-    0x6C,
-    0xFD,
-    0x09,
-    0xB2,
-    0xF5,
-    0x2A,
-    0x17,
-    0x03,
-    0x08,
-    0x00,
-    0x00,
-    0xDD,
-    0xF7,
-    0x1F,
-    0x62,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF1,
-    0xFF,
-    0x3F,
-    0xC7,
-    0x0F,
-    0x20,
-    0x36,
-    0x34,
-    0xFE,
-    0xCF,
-    0xC1,
-    0xC0,
-    0x40,
-    0x1B,
-    0x0C,
-    0x32,
-    0xFB,
-    0x07,
-    0xD4,
-    0x1E,
-    0x00,
-    0x3B,
-    0xAE,
-    0x25,
-    0x69,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x30,
-    0xE8,
-    0x60,
-    0x64,
-    0x00,
-    0x82,
-    0x0B,
-    0xFF,
-    0xB9,
-    0x40,
-    0xD4,
-    0xF7,
-    0xFF,
-    0xF6,
-    0x40,
-    0x52,
-    0xE0,
-    0xFF,
-    0xCD,
-    0xF3,
-    0x40,
-    0x6A,
-    0xC1,
-    0x7B,
-    0xC7,
-    0xFF,
-    0x6C,
-    0x0C,
-    0x0C,
-    0x9F,
-    0xEB,
-    0x19,
-    0xFE,
-    0xC8,
-    0x31,
-    0x30,
-    0xFC,
-    0xE1,
-    0x63,
-    0xF8,
-    0xDC,
-    0xCF,
-    0x90,
-    0xF0,
-    0x9F,
-    0x95,
-    0x61,
-    0xC1,
-    0x7F,
-    0xA6,
-    0x07,
-    0x40,
-    0x79,
-    0x85,
-    0xFF,
-    0xDC,
-    0x3F,
-    0xFC,
-    0x81,
-    0xCA,
-    0x7E,
-    0xF8,
-    0x03,
-    0x00,
-    0xF8,
-    0x74,
-    0x17,
-    0xD8,
-    0x78,
-    0x9C,
-    0x33,
-    0x34,
-    0x06,
-    0x03,
-    0xA6,
-    0x1F,
-    0xFF,
-    0xC1,
-    0x80,
-    0x0B,
-    0x46,
-    0x03,
-    0x00,
-    0x9A,
-    0x91,
-    0x0F,
-    0x5E,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x62,
-    0x60,
-    0x48,
-    0xE8,
-    0x67,
-    0x60,
-    0x78,
-    0xF0,
-    0x3F,
-    0x8F,
-    0x41,
-    0xE1,
-    0xC5,
-    0x7F,
-    0x5F,
-    0x06,
-    0x86,
-    0xA3,
-    0xF3,
-    0x19,
-    0x18,
-    0x18,
-    0x84,
-    0x00,
-    0x55,
-    0x46,
-    0x07,
-    0x09,
-    0x78,
-    0x9C,
-    0x63,
-    0x98,
-    0xF2,
-    0xE6,
-    0x7F,
-    0x0D,
-    0x03,
-    0x43,
-    0xC2,
-    0x7F,
-    0x20,
-    0x90,
-    0x65,
-    0x10,
-    0x98,
-    0xEB,
-    0x16,
-    0xFC,
-    0x67,
-    0x3E,
-    0x03,
-    0x08,
-    0x5C,
-    0x78,
-    0x0F,
-    0xA6,
-    0x16,
-    0xFC,
-    0x67,
-    0x04,
-    0x51,
-    0x13,
-    0x80,
-    0x54,
-    0xC2,
-    0x6B,
-    0xA0,
-    0x1A,
-    0x26,
-    0x85,
-    0xBF,
-    0x20,
-    0xA5,
-    0x4C,
-    0x0F,
-    0xFE,
-    0xE7,
-    0x18,
-    0x2F,
-    0xFE,
-    0xCF,
-    0xF4,
-    0x6D,
-    0x3F,
-    0x48,
-    0x8E,
-    0xE9,
-    0xA7,
-    0x3F,
-    0x98,
-    0xFA,
-    0x65,
-    0x0F,
-    0xD2,
-    0xC0,
-    0xF4,
-    0xA3,
-    0x9E,
-    0x81,
-    0xE1,
-    0xCB,
-    0x7F,
-    0xE6,
-    0xCF,
-    0xFF,
-    0xCD,
-    0xA7,
-    0xDC,
-    0xFF,
-    0xCF,
-    0xD5,
-    0x00,
-    0x32,
-    0xF9,
-    0xB7,
-    0x3D,
-    0xC3,
-    0xD1,
-    0xFF,
-    0xBD,
-    0x0C,
-    0x0B,
-    0x79,
-    0x19,
-    0x20,
-    0x00,
-    0x00,
-    0xA7,
-    0x03,
-    0x35,
-    0xAA,
-    0x78,
-    0x9C,
-    0x63,
-    0x10,
-    0x62,
-    0x00,
-    0x81,
-    0xCF,
-    0xF5,
-    0xC4,
-    0x53,
-    0x09,
-    0x7F,
-    0xF6,
-    0x31,
-    0x03,
-    0xA9,
-    0x5F,
-    0xFF,
-    0xFF,
-    0xE7,
-    0x33,
-    0x7C,
-    0x7E,
-    0xBF,
-    0xDE,
-    0xE4,
-    0xC7,
-    0x7F,
-    0xE6,
-    0xCF,
-    0xFF,
-    0xD9,
-    0x18,
-    0x12,
-    0xFE,
-    0x73,
-    0x7F,
-    0x5E,
-    0x0F,
-    0x54,
-    0xF0,
-    0x57,
-    0x1E,
-    0xAC,
-    0xF2,
-    0xA7,
-    0x3F,
-    0x98,
-    0xFA,
-    0x9E,
-    0x0F,
-    0xA6,
-    0xBE,
-    0xD5,
-    0x23,
-    0x53,
-    0x50,
-    0xC1,
-    0x5F,
-    0xF6,
-    0x60,
-    0xEA,
-    0x1F,
-    0xFF,
-    0xE7,
-    0xF7,
-    0x4C,
-    0x0C,
-    0x05,
-    0xFF,
-    0x39,
-    0x3F,
-    0xFF,
-    0xAF,
-    0x73,
-    0xFE,
-    0xF9,
-    0x9F,
-    0xF1,
-    0x73,
-    0xFD,
-    0xBF,
-    0xFF,
-    0xFF,
-    0xED,
-    0x19,
-    0x3E,
-    0xDB,
-    0x4F,
-    0xFC,
-    0x37,
-    0x97,
-    0x91,
-    0x01,
-    0x00,
-    0xF8,
-    0xAC,
-    0x3F,
-    0x7C,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0xD8,
-    0xFA,
-    0x6F,
-    0x1F,
-    0x2B,
-    0x03,
-    0xC3,
-    0x86,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xEF,
-    0x67,
-    0x60,
-    0xF8,
-    0x75,
-    0xDE,
-    0x74,
-    0x4A,
-    0x3E,
-    0x83,
-    0xC3,
-    0x7F,
-    0x6E,
-    0x06,
-    0x06,
-    0x26,
-    0xA0,
-    0x18,
-    0x13,
-    0x03,
-    0x10,
-    0x7C,
-    0xB8,
-    0x0F,
-    0x22,
-    0x19,
-    0x3E,
-    0xAF,
-    0x07,
-    0x53,
-    0x5F,
-    0xE6,
-    0x83,
-    0xA9,
-    0xAF,
-    0x10,
-    0xEA,
-    0x0B,
-    0x44,
-    0xF0,
-    0xE3,
-    0x79,
-    0x30,
-    0x75,
-    0xE1,
-    0x3F,
-    0x23,
-    0x88,
-    0x4A,
-    0xF8,
-    0xCF,
-    0x05,
-    0xD2,
-    0xCE,
-    0xF0,
-    0x67,
-    0xBF,
-    0xE9,
-    0x92,
-    0x7A,
-    0x06,
-    0x86,
-    0x83,
-    0x10,
-    0xA3,
-    0x19,
-    0x8E,
-    0xFD,
-    0x5B,
-    0xC7,
-    0xC2,
-    0x00,
-    0x00,
-    0x17,
-    0xE4,
-    0x24,
-    0x1D,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x00,
-    0x02,
-    0x03,
-    0x46,
-    0x10,
-    0xC9,
-    0xF0,
-    0x61,
-    0x3D,
-    0x51,
-    0xD4,
-    0xF5,
-    0xF7,
-    0xD6,
-    0x40,
-    0xEA,
-    0xC0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x7F,
-    0xAC,
-    0x67,
-    0xF8,
-    0x7D,
-    0xDE,
-    0xF4,
-    0xDA,
-    0xFF,
-    0xF5,
-    0x0E,
-    0xFF,
-    0x79,
-    0x18,
-    0x18,
-    0x7E,
-    0xAF,
-    0x5F,
-    0xF0,
-    0x9F,
-    0x05,
-    0xA4,
-    0xE4,
-    0xC1,
-    0x7F,
-    0xB0,
-    0xCA,
-    0x8F,
-    0xE7,
-    0xC1,
-    0xD4,
-    0xA7,
-    0xFD,
-    0xC8,
-    0x14,
-    0x54,
-    0xF0,
-    0xC3,
-    0x7B,
-    0x30,
-    0xB5,
-    0xE1,
-    0x3F,
-    0x33,
-    0x03,
-    0xC3,
-    0xC7,
-    0xF5,
-    0x09,
-    0xFF,
-    0xB9,
-    0x19,
-    0x18,
-    0xFE,
-    0xAC,
-    0x67,
-    0xF8,
-    0xBB,
-    0xDF,
-    0xE4,
-    0xDA,
-    0xBF,
-    0xF5,
-    0x0C,
-    0x8F,
-    0x80,
-    0x46,
-    0x5F,
-    0x5E,
-    0xCF,
-    0x20,
-    0x70,
-    0xF3,
-    0xBD,
-    0xE6,
-    0x86,
-    0xF5,
-    0x00,
-    0x44,
-    0xC3,
-    0x45,
-    0x9F,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x38,
-    0xF6,
-    0xBF,
-    0x97,
-    0x91,
-    0x81,
-    0xE1,
-    0xC0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xED,
-    0x19,
-    0x18,
-    0x7E,
-    0xCF,
-    0x37,
-    0x79,
-    0xF6,
-    0x9E,
-    0x31,
-    0xE0,
-    0x3F,
-    0x3B,
-    0x83,
-    0xC2,
-    0x7F,
-    0xCE,
-    0x0D,
-    0xEF,
-    0x19,
-    0x18,
-    0x18,
-    0x7E,
-    0xF2,
-    0x7F,
-    0xD8,
-    0x0F,
-    0xA4,
-    0xBE,
-    0xEA,
-    0x7F,
-    0x5E,
-    0x6F,
-    0x6C,
-    0x6C,
-    0xFC,
-    0xCD,
-    0xFF,
-    0xCB,
-    0x7F,
-    0x10,
-    0x88,
-    0xFF,
-    0x0A,
-    0xA1,
-    0xBE,
-    0xCC,
-    0x67,
-    0x00,
-    0x81,
-    0x8F,
-    0xE7,
-    0xC1,
-    0xD4,
-    0x85,
-    0xFF,
-    0x8C,
-    0x20,
-    0xAA,
-    0xE0,
-    0x3F,
-    0x37,
-    0x03,
-    0x83,
-    0x03,
-    0x03,
-    0xC3,
-    0x9F,
-    0xF3,
-    0xA6,
-    0x25,
-    0x7F,
-    0xD9,
-    0x18,
-    0x0E,
-    0x02,
-    0x15,
-    0xBE,
-    0x67,
-    0x65,
-    0x60,
-    0xD8,
-    0xF6,
-    0x6F,
-    0x1F,
-    0x1B,
-    0x03,
-    0x00,
-    0xAC,
-    0x93,
-    0x33,
-    0x87,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x50,
-    0x60,
-    0x64,
-    0x60,
-    0x60,
-    0x38,
-    0xFC,
-    0xFF,
-    0xBF,
-    0x35,
-    0x83,
-    0xC1,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xF5,
-    0x19,
-    0x36,
-    0xFC,
-    0x67,
-    0x33,
-    0x60,
-    0x63,
-    0x78,
-    0x70,
-    0x1E,
-    0x28,
-    0xCA,
-    0xF0,
-    0x61,
-    0x3F,
-    0x9C,
-    0xFC,
-    0x0D,
-    0x94,
-    0xCC,
-    0x07,
-    0x93,
-    0xF6,
-    0x0C,
-    0x46,
-    0x9F,
-    0xCF,
-    0x1B,
-    0x33,
-    0xA3,
-    0xC8,
-    0x52,
-    0x4E,
-    0x02,
-    0x00,
-    0x6A,
-    0x63,
-    0x2E,
-    0x1D,
-    0x78,
-    0x9C,
-    0x25,
-    0x4E,
-    0x41,
-    0x0E,
-    0xC1,
-    0x50,
-    0x10,
-    0x7D,
-    0xBF,
-    0xDA,
-    0x12,
-    0x45,
-    0xDC,
-    0xA0,
-    0xC4,
-    0x01,
-    0x34,
-    0x69,
-    0xEC,
-    0xBB,
-    0xB4,
-    0x92,
-    0xE0,
-    0x00,
-    0xB5,
-    0xB7,
-    0x71,
-    0x03,
-    0xDC,
-    0xC0,
-    0xDA,
-    0xC6,
-    0x11,
-    0x88,
-    0xC4,
-    0xDA,
-    0x11,
-    0xBA,
-    0x61,
-    0x5D,
-    0x7B,
-    0x12,
-    0x49,
-    0x23,
-    0xB4,
-    0x15,
-    0x9E,
-    0xF9,
-    0x35,
-    0x8B,
-    0x37,
-    0x6F,
-    0x66,
-    0xDE,
-    0xCC,
-    0x1B,
-    0x40,
-    0x47,
-    0xD3,
-    0x28,
-    0x70,
-    0x94,
-    0x57,
-    0x81,
-    0xC3,
-    0x97,
-    0x64,
-    0x03,
-    0x3B,
-    0xC1,
-    0xE3,
-    0xDA,
-    0x42,
-    0x1E,
-    0xF5,
-    0xCE,
-    0x91,
-    0x42,
-    0x8B,
-    0x35,
-    0xE0,
-    0xE3,
-    0x60,
-    0x46,
-    0x0B,
-    0x48,
-    0xBB,
-    0x58,
-    0xB0,
-    0x04,
-    0x3C,
-    0x43,
-    0xA9,
-    0x4D,
-    0xE0,
-    0x15,
-    0xC2,
-    0xA3,
-    0x23,
-    0x73,
-    0x17,
-    0x78,
-    0x6F,
-    0x8C,
-    0xBD,
-    0xE6,
-    0x2B,
-    0xD9,
-    0x8F,
-    0x15,
-    0x44,
-    0xC8,
-    0x7B,
-    0x45,
-    0x8E,
-    0x3F,
-    0xDC,
-    0xB6,
-    0xD2,
-    0x26,
-    0x59,
-    0xBD,
-    0x70,
-    0x44,
-    0x3A,
-    0xF7,
-    0x3B,
-    0xBA,
-    0x91,
-    0x68,
-    0x9D,
-    0x0D,
-    0x78,
-    0x57,
-    0x21,
-    0xDB,
-    0xFF,
-    0x37,
-    0x27,
-    0x9A,
-    0x43,
-    0xB1,
-    0x41,
-    0xC0,
-    0x72,
-    0x12,
-    0x4A,
-    0x9E,
-    0xD0,
-    0xBE,
-    0xB0,
-    0xEF,
-    0x8F,
-    0x33,
-    0xAA,
-    0x80,
-    0x3A,
-    0x06,
-    0xC0,
-    0xF2,
-    0xC6,
-    0x78,
-    0x0A,
-    0xFC,
-    0x00,
-    0xAA,
-    0x93,
-    0x48,
-    0xA5,
-    0x78,
-    0x9C,
-    0x63,
-    0x10,
-    0x64,
-    0x00,
-    0x81,
-    0xCF,
-    0xF5,
-    0xC4,
-    0x53,
-    0x0E,
-    0xAF,
-    0xCF,
-    0xB3,
-    0x02,
-    0xA9,
-    0xEF,
-    0xFF,
-    0xFF,
-    0xE7,
-    0x33,
-    0x7C,
-    0x3E,
-    0x7F,
-    0xDE,
-    0xF4,
-    0xFB,
-    0x7F,
-    0xC6,
-    0xCF,
-    0xFF,
-    0xB9,
-    0x18,
-    0x1A,
-    0xFE,
-    0xB3,
-    0x7E,
-    0x3E,
-    0xCF,
-    0xC0,
-    0xE0,
-    0xF0,
-    0x9F,
-    0x1D,
-    0xA4,
-    0xD2,
-    0x80,
-    0x5A,
-    0x14,
-    0x00,
-    0x8A,
-    0xD2,
-    0x39,
-    0x82,
-    0x78,
-    0x9C,
-    0xBB,
-    0x1C,
-    0xF7,
-    0xEB,
-    0xFD,
-    0xEF,
-    0xF7,
-    0x97,
-    0xE3,
-    0x18,
-    0xC0,
-    0xE0,
-    0x73,
-    0x3D,
-    0x7E,
-    0x08,
-    0x00,
-    0x89,
-    0xC8,
-    0x1D,
-    0x56,
-    0x78,
-    0x9C,
-    0x63,
-    0x30,
-    0x78,
-    0xCB,
-    0xC2,
-    0xB0,
-    0xE1,
-    0x3F,
-    0x2F,
-    0x18,
-    0x83,
-    0xD8,
-    0xC8,
-    0xC0,
-    0xE1,
-    0x3F,
-    0x1B,
-    0xD9,
-    0x38,
-    0xE0,
-    0x3F,
-    0x2B,
-    0x43,
-    0xC2,
-    0x7F,
-    0x16,
-    0x86,
-    0x05,
-    0xFF,
-    0x19,
-    0x18,
-    0x3E,
-    0xAF,
-    0x67,
-    0x28,
-    0xF8,
-    0xAF,
-    0xC7,
-    0xF0,
-    0xF1,
-    0x3E,
-    0x13,
-    0x43,
-    0x03,
-    0x3B,
-    0x03,
-    0x03,
-    0x00,
-    0x59,
-    0xE8,
-    0x22,
-    0xB4,
-    0x78,
-    0x9C,
-    0x4B,
-    0xF4,
-    0x60,
-    0x00,
-    0x81,
-    0xCF,
-    0xF5,
-    0xA4,
-    0x50,
-    0x9F,
-    0xEE,
-    0x83,
-    0xA9,
-    0xBF,
-    0xFA,
-    0x20,
-    0x6A,
-    0xC1,
-    0x7F,
-    0x56,
-    0x10,
-    0xF5,
-    0xAD,
-    0x1F,
-    0x24,
-    0x67,
-    0xF0,
-    0x9F,
-    0x1B,
-    0x44,
-    0x3D,
-    0xBC,
-    0xCF,
-    0x08,
-    0xA2,
-    0x7E,
-    0xEB,
-    0x83,
-    0x34,
-    0xAC,
-    0xFF,
-    0xCF,
-    0x0B,
-    0xD6,
-    0xF7,
-    0x63,
-    0x3E,
-    0x98,
-    0xBA,
-    0x00,
-    0x54,
-    0x0F,
-    0xA4,
-    0x14,
-    0xFE,
-    0xCB,
-    0x81,
-    0x0D,
-    0xFB,
-    0xB6,
-    0x1F,
-    0x4C,
-    0x6D,
-    0xF8,
-    0xCF,
-    0x0E,
-    0xA2,
-    0x04,
-    0xFE,
-    0x81,
-    0xCD,
-    0x64,
-    0xF8,
-    0x0A,
-    0xB1,
-    0x61,
-    0xC2,
-    0x7F,
-    0x4E,
-    0x00,
-    0x9E,
-    0x59,
-    0x38,
-    0xB9,
-    0x78,
-    0x9C,
-    0x0B,
-    0x54,
-    0x67,
-    0xF8,
-    0x16,
-    0x4F,
-    0x0E,
-    0xFA,
-    0x1A,
-    0xCF,
-    0xF0,
-    0x79,
-    0xBD,
-    0xF0,
-    0x85,
-    0xFF,
-    0xF3,
-    0x15,
-    0x7E,
-    0xCF,
-    0x03,
-    0x00,
-    0x12,
-    0x75,
-    0x1F,
-    0xA3,
-    0x78,
-    0x9C,
-    0xFB,
-    0x2C,
-    0x1F,
-    0xF0,
-    0x67,
-    0x1E,
-    0x83,
-    0xC2,
-    0xAB,
-    0xF3,
-    0xAC,
-    0x0C,
-    0x9F,
-    0xED,
-    0x7F,
-    0xFE,
-    0xFF,
-    0xCF,
-    0xF3,
-    0xF8,
-    0xFF,
-    0xFF,
-    0x78,
-    0x86,
-    0xCF,
-    0xFB,
-    0xD7,
-    0xBB,
-    0xFC,
-    0xA9,
-    0x7F,
-    0x67,
-    0xF6,
-    0xFD,
-    0x3D,
-    0xC3,
-    0xE7,
-    0xFF,
-    0x9C,
-    0x0C,
-    0x1F,
-    0xFF,
-    0xEB,
-    0x31,
-    0x4C,
-    0xF8,
-    0xCF,
-    0xFC,
-    0xF9,
-    0x3E,
-    0x03,
-    0xC3,
-    0x85,
-    0xFF,
-    0x2C,
-    0x0C,
-    0x09,
-    0xFF,
-    0x59,
-    0x3F,
-    0xD7,
-    0x33,
-    0x30,
-    0x1C,
-    0x78,
-    0xCF,
-    0xC0,
-    0x10,
-    0xF0,
-    0x9F,
-    0x8D,
-    0xBE,
-    0x4C,
-    0x00,
-    0x81,
-    0xF3,
-    0x4F,
-    0x40,
-    0x78,
-    0x9C,
-    0xFB,
-    0x2C,
-    0xEF,
-    0xF0,
-    0xFA,
-    0x3C,
-    0x2B,
-    0xC3,
-    0x67,
-    0xFB,
-    0x1F,
-    0xFF,
-    0xFF,
-    0xE7,
-    0x33,
-    0x7C,
-    0x5E,
-    0x7F,
-    0xDE,
-    0xF4,
-    0xFB,
-    0x7F,
-    0xC6,
-    0xCF,
-    0xFF,
-    0xB9,
-    0x18,
-    0x1A,
-    0xFE,
-    0xB3,
-    0x7E,
-    0xBE,
-    0xCF,
-    0xC0,
-    0xE0,
-    0xF0,
-    0x9F,
-    0xFD,
-    0x73,
-    0x3D,
-    0x03,
-    0x83,
-    0x01,
-    0xB5,
-    0x28,
-    0x00,
-    0x98,
-    0xD1,
-    0x30,
-    0x16,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0xD8,
-    0xF2,
-    0x77,
-    0x1F,
-    0x1B,
-    0x03,
-    0x03,
-    0xC3,
-    0x82,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x67,
-    0x64,
-    0x60,
-    0xF8,
-    0x7D,
-    0xDE,
-    0x74,
-    0xEB,
-    0x7F,
-    0x1E,
-    0x86,
-    0x80,
-    0xFF,
-    0xDC,
-    0x0C,
-    0x0C,
-    0xBF,
-    0xF2,
-    0x19,
-    0x36,
-    0xFC,
-    0x67,
-    0x62,
-    0x60,
-    0xF8,
-    0x78,
-    0x9F,
-    0xE1,
-    0xE3,
-    0x79,
-    0xA0,
-    0x9A,
-    0x03,
-    0xFF,
-    0x19,
-    0x3F,
-    0xAF,
-    0x07,
-    0xD2,
-    0x13,
-    0xFE,
-    0xB3,
-    0x7C,
-    0x99,
-    0x0F,
-    0xA4,
-    0x1B,
-    0xFE,
-    0xB3,
-    0x7E,
-    0x85,
-    0xD2,
-    0x50,
-    0x71,
-    0x66,
-    0x98,
-    0x3A,
-    0x20,
-    0x62,
-    0x00,
-    0x69,
-    0x4A,
-    0xF8,
-    0xCF,
-    0x05,
-    0x34,
-    0x27,
-    0x9E,
-    0x81,
-    0xE1,
-    0xCF,
-    0x7E,
-    0xA0,
-    0xB9,
-    0x40,
-    0x33,
-    0x0F,
-    0x02,
-    0xED,
-    0xD9,
-    0x0F,
-    0x54,
-    0xC3,
-    0xB0,
-    0xF5,
-    0xDF,
-    0x3E,
-    0x16,
-    0x06,
-    0x06,
-    0x00,
-    0x8D,
-    0x15,
-    0x35,
-    0x61,
-    0x78,
-    0x9C,
-    0xFB,
-    0x2C,
-    0x9F,
-    0xF0,
-    0xE7,
-    0x1C,
-    0x2B,
-    0xC3,
-    0x67,
-    0xFB,
-    0xDF,
-    0xFF,
-    0xFF,
-    0xCF,
-    0x67,
-    0xF8,
-    0x7C,
-    0x7F,
-    0xBD,
-    0xC9,
-    0x8F,
-    0xFF,
-    0xAC,
-    0x9F,
-    0xFF,
-    0xB3,
-    0x31,
-    0x04,
-    0xFC,
-    0xE7,
-    0xFD,
-    0x3C,
-    0x9F,
-    0x81,
-    0x81,
-    0xE1,
-    0xAF,
-    0xFE,
-    0xE7,
-    0x7A,
-    0x20,
-    0xF5,
-    0x33,
-    0x1E,
-    0x4C,
-    0x7D,
-    0xAF,
-    0x07,
-    0x53,
-    0xDF,
-    0x50,
-    0xA8,
-    0xEF,
-    0xF9,
-    0x10,
-    0x25,
-    0xFE,
-    0x60,
-    0xEA,
-    0x1F,
-    0xFF,
-    0xE7,
-    0xFB,
-    0x8C,
-    0x0C,
-    0x05,
-    0xFF,
-    0xB9,
-    0x3E,
-    0xFF,
-    0xCF,
-    0x73,
-    0xFE,
-    0xF9,
-    0x9F,
-    0xE9,
-    0xF3,
-    0xFE,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xC7,
-    0x33,
-    0x7C,
-    0xAE,
-    0x5F,
-    0xFC,
-    0x6F,
-    0x1D,
-    0x13,
-    0x03,
-    0x58,
-    0x09,
-    0x03,
-    0x5E,
-    0xEA,
-    0xB1,
-    0x0F,
-    0x98,
-    0x02,
-    0x00,
-    0x05,
-    0xD7,
-    0x3F,
-    0x83,
-    0x78,
-    0x9C,
-    0x85,
-    0xCC,
-    0x3D,
-    0x0E,
-    0x82,
-    0x40,
-    0x00,
-    0x44,
-    0xE1,
-    0x97,
-    0x68,
-    0x27,
-    0x85,
-    0xD7,
-    0xB0,
-    0xC7,
-    0x9E,
-    0x9E,
-    0x4B,
-    0x78,
-    0x34,
-    0x2E,
-    0x60,
-    0x86,
-    0x1B,
-    0x60,
-    0x69,
-    0x47,
-    0x87,
-    0xB1,
-    0x33,
-    0x5E,
-    0x60,
-    0x17,
-    0x2D,
-    0xF9,
-    0x19,
-    0x75,
-    0x63,
-    0x41,
-    0x47,
-    0xF5,
-    0x25,
-    0x2F,
-    0x93,
-    0x81,
-    0x5B,
-    0x28,
-    0x2B,
-    0x71,
-    0xB1,
-    0x7D,
-    0x15,
-    0x43,
-    0x7B,
-    0xEC,
-    0xAC,
-    0xC2,
-    0x19,
-    0x0C,
-    0xAA,
-    0xBC,
-    0x85,
-    0xA8,
-    0x87,
-    0xF9,
-    0xD1,
-    0xB7,
-    0x89,
-    0x57,
-    0xB3,
-    0xE4,
-    0x1F,
-    0x63,
-    0x48,
-    0xD4,
-    0xDE,
-    0x40,
-    0xAF,
-    0x93,
-    0x77,
-    0x30,
-    0x8A,
-    0xA9,
-    0xC9,
-    0xBB,
-    0x59,
-    0x3C,
-    0xBF,
-    0xD7,
-    0x6F,
-    0xB1,
-    0xBF,
-    0x87,
-    0x43,
-    0x14,
-    0xA4,
-    0xE5,
-    0x2A,
-    0xF5,
-    0xF9,
-    0x03,
-    0x82,
-    0x38,
-    0x45,
-    0x1C,
-    0x78,
-    0x9C,
-    0xFB,
-    0x2C,
-    0x5F,
-    0xF0,
-    0x97,
-    0xF7,
-    0xB3,
-    0xFD,
-    0xAF,
-    0xFF,
-    0x5C,
-    0x9F,
-    0xE7,
-    0xEF,
-    0x37,
-    0x61,
-    0xFE,
-    0xFC,
-    0x9F,
-    0x9B,
-    0x81,
-    0xE1,
-    0xF3,
-    0x7F,
-    0x26,
-    0x20,
-    0x71,
-    0x9E,
-    0x01,
-    0x48,
-    0xF4,
-    0x83,
-    0x88,
-    0x7A,
-    0x12,
-    0x08,
-    0x00,
-    0x41,
-    0x8F,
-    0x1C,
-    0x81,
-    0x78,
-    0x9C,
-    0x63,
-    0x50,
-    0xB8,
-    0xF9,
-    0x7F,
-    0x2E,
-    0x33,
-    0x03,
-    0xC3,
-    0xD7,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xAF,
-    0x67,
-    0x50,
-    0xF8,
-    0x5F,
-    0x6F,
-    0xBC,
-    0x6D,
-    0x3F,
-    0x43,
-    0xC1,
-    0x7F,
-    0x36,
-    0x06,
-    0x06,
-    0x61,
-    0x86,
-    0x09,
-    0xFF,
-    0x59,
-    0x18,
-    0x80,
-    0x20,
-    0xE0,
-    0xBF,
-    0x0C,
-    0x88,
-    0x62,
-    0xF8,
-    0xF3,
-    0x3F,
-    0x8A,
-    0x11,
-    0x48,
-    0x2D,
-    0xFC,
-    0xFF,
-    0x7F,
-    0x3F,
-    0x50,
-    0x03,
-    0x43,
-    0xD1,
-    0x9F,
-    0xFF,
-    0xF9,
-    0x20,
-    0x61,
-    0x81,
-    0x1F,
-    0xFF,
-    0x99,
-    0x40,
-    0x74,
-    0xC1,
-    0x7F,
-    0x0E,
-    0x10,
-    0xE5,
-    0xF0,
-    0x9F,
-    0x53,
-    0x00,
-    0xA8,
-    0x7B,
-    0xC2,
-    0x7F,
-    0xF6,
-    0x03,
-    0xF7,
-    0xDD,
-    0x9D,
-    0x7F,
-    0xFD,
-    0x67,
-    0x6C,
-    0x00,
-    0x9A,
-    0xFC,
-    0xDF,
-    0x8F,
-    0x81,
-    0xA1,
-    0xE9,
-    0xCD,
-    0xFF,
-    0x1A,
-    0x46,
-    0x06,
-    0x00,
-    0x17,
-    0x19,
-    0x29,
-    0xE4,
-    0x78,
-    0x9C,
-    0x63,
-    0x98,
-    0xD0,
-    0xCD,
-    0x00,
-    0x04,
-    0x1F,
-    0xD6,
-    0xA3,
-    0x91,
-    0xBF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x6F,
-    0x0F,
-    0x26,
-    0xE5,
-    0x19,
-    0x8C,
-    0x3E,
-    0xEF,
-    0x37,
-    0x66,
-    0xC2,
-    0xA2,
-    0x86,
-    0x38,
-    0xF2,
-    0x3C,
-    0x88,
-    0xDC,
-    0xF0,
-    0xDF,
-    0xBC,
-    0x8D,
-    0x81,
-    0xC1,
-    0x00,
-    0x68,
-    0x1C,
-    0x0B,
-    0x03,
-    0xC3,
-    0xE6,
-    0xFF,
-    0xBD,
-    0x8C,
-    0x00,
-    0x9F,
-    0x57,
-    0x28,
-    0x93,
-    0x78,
-    0x9C,
-    0xFB,
-    0x16,
-    0xCF,
-    0xC0,
-    0x50,
-    0xF0,
-    0x9F,
-    0xF9,
-    0x1B,
-    0x55,
-    0xA8,
-    0xAF,
-    0x40,
-    0x6A,
-    0xC3,
-    0x7F,
-    0xE6,
-    0x2F,
-    0xFD,
-    0x0C,
-    0x0C,
-    0xDF,
-    0xFF,
-    0x33,
-    0x3F,
-    0xF8,
-    0xAF,
-    0xB6,
-    0xF8,
-    0xFC,
-    0x7F,
-    0xE6,
-    0x84,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x5B,
-    0xFD,
-    0x67,
-    0x66,
-    0x38,
-    0xFA,
-    0x3F,
-    0x47,
-    0xE1,
-    0x3F,
-    0x33,
-    0x00,
-    0x30,
-    0xD2,
-    0x31,
-    0x74,
-    0x78,
-    0x9C,
-    0xFB,
-    0x11,
-    0xCF,
-    0xC0,
-    0xC0,
-    0xF0,
-    0xE0,
-    0x3D,
-    0xC3,
-    0xE7,
-    0xF5,
-    0x40,
-    0xFA,
-    0xF3,
-    0x7C,
-    0x86,
-    0x0B,
-    0xEF,
-    0x81,
-    0xF4,
-    0x0F,
-    0x7B,
-    0x86,
-    0x86,
-    0xFF,
-    0xCC,
-    0x0C,
-    0x0C,
-    0x7F,
-    0xF8,
-    0x18,
-    0x0C,
-    0xFE,
-    0x73,
-    0x30,
-    0x08,
-    0xFC,
-    0xE7,
-    0x64,
-    0x60,
-    0xF8,
-    0xC7,
-    0xCB,
-    0x90,
-    0xF0,
-    0x9F,
-    0x05,
-    0x28,
-    0xA7,
-    0xCF,
-    0xB0,
-    0x01,
-    0xA4,
-    0xE6,
-    0x73,
-    0x3E,
-    0xC3,
-    0x87,
-    0xF9,
-    0x20,
-    0xBD,
-    0xFB,
-    0x19,
-    0xBE,
-    0xF8,
-    0x03,
-    0xE9,
-    0x86,
-    0xFF,
-    0x0C,
-    0x3F,
-    0xF9,
-    0x81,
-    0xB4,
-    0xC1,
-    0x7F,
-    0xD6,
-    0xBF,
-    0x5C,
-    0x40,
-    0x9A,
-    0xE1,
-    0x9F,
-    0x26,
-    0x48,
-    0x39,
-    0x03,
-    0xC3,
-    0xCF,
-    0xBA,
-    0xFF,
-    0x20,
-    0x8A,
-    0xE1,
-    0xF3,
-    0xFB,
-    0xF5,
-    0x60,
-    0xFA,
-    0xC1,
-    0xFF,
-    0x78,
-    0x30,
-    0x3D,
-    0xE1,
-    0x3F,
-    0x48,
-    0x39,
-    0x00,
-    0x1D,
-    0x95,
-    0x29,
-    0x02,
-    0x78,
-    0x9C,
-    0x0D,
-    0x8E,
-    0xCB,
-    0x0D,
-    0x82,
-    0x50,
-    0x14,
-    0x44,
-    0x4F,
-    0x24,
-    0xFE,
-    0x7F,
-    0x74,
-    0x80,
-    0x1D,
-    0x60,
-    0x07,
-    0x96,
-    0x20,
-    0x89,
-    0x05,
-    0x40,
-    0x07,
-    0x96,
-    0x20,
-    0x3B,
-    0x97,
-    0xD8,
-    0x01,
-    0x96,
-    0xC0,
-    0xDA,
-    0x0D,
-    0x76,
-    0x00,
-    0x1D,
-    0x48,
-    0x03,
-    0x46,
-    0x11,
-    0x51,
-    0x02,
-    0xF1,
-    0x5D,
-    0xEF,
-    0x6E,
-    0x26,
-    0x39,
-    0x99,
-    0x33,
-    0xB5,
-    0x0F,
-    0x4F,
-    0xE9,
-    0xE1,
-    0x89,
-    0x55,
-    0x46,
-    0x50,
-    0xC9,
-    0x80,
-    0x50,
-    0xC8,
-    0x33,
-    0xF8,
-    0xCA,
-    0x98,
-    0x24,
-    0xE3,
-    0x2C,
-    0xD0,
-    0xB6,
-    0x33,
-    0x8A,
-    0x88,
-    0x40,
-    0x39,
-    0x53,
-    0x2D,
-    0x79,
-    0xF9,
-    0xAC,
-    0xA5,
-    0x6F,
-    0x3F,
-    0x8A,
-    0x0D,
-    0xB5,
-    0x03,
-    0x32,
-    0xF2,
-    0xD2,
-    0x64,
-    0x4F,
-    0xB3,
-    0x80,
-    0x6E,
-    0x1A,
-    0x1E,
-    0xC2,
-    0x98,
-    0x6E,
-    0x82,
-    0xD6,
-    0xEB,
-    0xD6,
-    0xBB,
-    0x61,
-    0x86,
-    0xF0,
-    0x76,
-    0x9F,
-    0x8E,
-    0x2D,
-    0xB6,
-    0x58,
-    0x50,
-    0xFA,
-    0xD5,
-    0x1C,
-    0xB3,
-    0xD3,
-    0x4D,
-    0xF2,
-    0xE8,
-    0x33,
-    0xA1,
-    0x3B,
-    0xAA,
-    0x89,
-    0x53,
-    0xDA,
-    0x0E,
-    0x69,
-    0x2E,
-    0xB1,
-    0xC6,
-    0xE0,
-    0xF1,
-    0xB3,
-    0xA8,
-    0xEF,
-    0xFA,
-    0x8A,
-    0x95,
-    0x28,
-    0x56,
-    0x8A,
-    0xAB,
-    0x11,
-    0x73,
-    0x83,
-    0x42,
-    0xD4,
-    0xF0,
-    0x07,
-    0xCD,
-    0x7C,
-    0x48,
-    0x5A,
-    0x78,
-    0x9C,
-    0x7B,
-    0xF0,
-    0x9F,
-    0x89,
-    0x81,
-    0xE1,
-    0x9F,
-    0xBC,
-    0xC3,
-    0x7F,
-    0x6E,
-    0x86,
-    0x82,
-    0xFF,
-    0xEC,
-    0x0C,
-    0xBF,
-    0xFC,
-    0x19,
-    0x1E,
-    0x9E,
-    0x67,
-    0x60,
-    0xF8,
-    0x78,
-    0x9E,
-    0xE1,
-    0x87,
-    0x3E,
-    0x03,
-    0x43,
-    0xC2,
-    0x7F,
-    0xD5,
-    0xFF,
-    0x1C,
-    0x0C,
-    0x0C,
-    0x0C,
-    0x7F,
-    0xD6,
-    0xDE,
-    0x07,
-    0x92,
-    0x0C,
-    0x9F,
-    0xFF,
-    0xFB,
-    0x83,
-    0xA8,
-    0x05,
-    0xFF,
-    0x79,
-    0x41,
-    0xD4,
-    0xC7,
-    0xFF,
-    0xF1,
-    0x20,
-    0xEA,
-    0xD7,
-    0xDD,
-    0xF7,
-    0x40,
-    0x32,
-    0xE0,
-    0x7F,
-    0xC8,
-    0x7F,
-    0x4E,
-    0x06,
-    0x86,
-    0x87,
-    0xFB,
-    0x19,
-    0xFE,
-    0xD8,
-    0x33,
-    0x30,
-    0xFC,
-    0xD4,
-    0x67,
-    0xF8,
-    0x7C,
-    0x9E,
-    0xC1,
-    0x01,
-    0x28,
-    0xB2,
-    0xE0,
-    0x3F,
-    0xFB,
-    0x85,
-    0xFF,
-    0x8C,
-    0x0C,
-    0x02,
-    0xFF,
-    0xE5,
-    0x7F,
-    0xD4,
-    0x03,
-    0x95,
-    0xFD,
-    0xD8,
-    0x0F,
-    0x00,
-    0x6F,
-    0xE1,
-    0x2B,
-    0x3E,
-    0x78,
-    0x9C,
-    0x25,
-    0xCD,
-    0xCB,
-    0x11,
-    0x82,
-    0x50,
-    0x0C,
-    0x85,
-    0xE1,
-    0x5F,
-    0xD1,
-    0xF1,
-    0x39,
-    0x6A,
-    0x07,
-    0xEC,
-    0xDD,
-    0xD8,
-    0x02,
-    0x0D,
-    0x38,
-    0xD8,
-    0x01,
-    0x5A,
-    0x81,
-    0xAD,
-    0xD8,
-    0x01,
-    0x76,
-    0x80,
-    0x1D,
-    0x50,
-    0x82,
-    0x94,
-    0xA0,
-    0x15,
-    0x5C,
-    0x06,
-    0xDF,
-    0x32,
-    0x12,
-    0x93,
-    0xCB,
-    0xEA,
-    0xCB,
-    0x24,
-    0x27,
-    0xC9,
-    0x3B,
-    0x06,
-    0x0A,
-    0xC7,
-    0x2D,
-    0x55,
-    0xAB,
-    0x94,
-    0x8B,
-    0x53,
-    0x9F,
-    0x31,
-    0x07,
-    0xE9,
-    0x42,
-    0x3D,
-    0x23,
-    0x92,
-    0x01,
-    0xC8,
-    0x08,
-    0x9A,
-    0xA9,
-    0xD6,
-    0x3D,
-    0xF8,
-    0x84,
-    0x3A,
-    0xD3,
-    0xCC,
-    0x3D,
-    0xA1,
-    0xC8,
-    0xD4,
-    0x32,
-    0xA3,
-    0x4A,
-    0xD4,
-    0xA3,
-    0xE3,
-    0x35,
-    0x57,
-    0x37,
-    0x12,
-    0xD4,
-    0x63,
-    0x15,
-    0x19,
-    0x4A,
-    0xDF,
-    0xFC,
-    0xAE,
-    0xA5,
-    0x63,
-    0x3E,
-    0xF2,
-    0xDC,
-    0xA0,
-    0x94,
-    0xBD,
-    0xF7,
-    0x24,
-    0xA1,
-    0x97,
-    0xDF,
-    0xC4,
-    0x13,
-    0xB5,
-    0x71,
-    0xAE,
-    0x67,
-    0xCF,
-    0xAE,
-    0x59,
-    0x19,
-    0x5B,
-    0xB1,
-    0xA7,
-    0x76,
-    0x76,
-    0xE9,
-    0xDB,
-    0x8B,
-    0xA0,
-    0x5D,
-    0xFA,
-    0x03,
-    0x11,
-    0xA9,
-    0x32,
-    0x31,
-    0x78,
-    0x9C,
-    0x9B,
-    0xF0,
-    0x1F,
-    0x08,
-    0xCE,
-    0x4F,
-    0x00,
-    0x93,
-    0x02,
-    0xC6,
-    0xC6,
-    0xC6,
-    0xBF,
-    0xF2,
-    0x19,
-    0x18,
-    0x18,
-    0x14,
-    0xFE,
-    0x73,
-    0x03,
-    0xC9,
-    0x0B,
-    0xFF,
-    0x19,
-    0x81,
-    0xE4,
-    0x0F,
-    0x90,
-    0x80,
-    0x01,
-    0x44,
-    0xE0,
-    0x3D,
-    0x58,
-    0x20,
-    0x1E,
-    0x2C,
-    0xC0,
-    0x85,
-    0x55,
-    0xE0,
-    0xBF,
-    0x89,
-    0xB1,
-    0xB1,
-    0xF2,
-    0x17,
-    0xB0,
-    0x69,
-    0x60,
-    0x72,
-    0x3E,
-    0x00,
-    0x9C,
-    0xD2,
-    0x28,
-    0xDE,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x58,
-    0xF2,
-    0x8F,
-    0x91,
-    0x21,
-    0xE1,
-    0xFF,
-    0x7F,
-    0x46,
-    0x86,
-    0x07,
-    0xFF,
-    0xCD,
-    0x19,
-    0x18,
-    0x3E,
-    0xD5,
-    0x33,
-    0x30,
-    0x30,
-    0x7C,
-    0x8E,
-    0x27,
-    0x48,
-    0x7C,
-    0xF1,
-    0x07,
-    0x12,
-    0xDF,
-    0xEC,
-    0x19,
-    0x18,
-    0x02,
-    0xFE,
-    0xF2,
-    0x01,
-    0x79,
-    0xFB,
-    0x99,
-    0x80,
-    0xC4,
-    0x7B,
-    0x56,
-    0x06,
-    0x06,
-    0x81,
-    0x3F,
-    0xF2,
-    0x40,
-    0x89,
-    0xAF,
-    0xFE,
-    0xC4,
-    0x99,
-    0x02,
-    0xB6,
-    0xED,
-    0xC3,
-    0x7B,
-    0x33,
-    0x06,
-    0x86,
-    0x02,
-    0x90,
-    0x0B,
-    0x18,
-    0xB6,
-    0xFE,
-    0x63,
-    0x04,
-    0x00,
-    0x7A,
-    0x09,
-    0x2B,
-    0x8E,
-    0x78,
-    0x9C,
-    0xFB,
-    0x2A,
-    0xFF,
-    0x95,
-    0x0C,
-    0x08,
-    0x00,
-    0x2C,
-    0x2E,
-    0x1D,
-    0x1D,
-    0x78,
-    0x9C,
-    0x7B,
-    0x55,
-    0xC3,
-    0xC0,
-    0xF0,
-    0xFB,
-    0x3F,
-    0x0F,
-    0x43,
-    0xD0,
-    0x1F,
-    0x7F,
-    0x06,
-    0x86,
-    0x8F,
-    0xFD,
-    0x0C,
-    0x0C,
-    0x0F,
-    0xE6,
-    0x03,
-    0xF1,
-    0x7A,
-    0xDC,
-    0xF8,
-    0xC2,
-    0x79,
-    0x06,
-    0x86,
-    0x86,
-    0xFF,
-    0xEA,
-    0x0C,
-    0x0C,
-    0x3F,
-    0xD6,
-    0x33,
-    0x08,
-    0xFC,
-    0x5E,
-    0xCF,
-    0xB0,
-    0xE0,
-    0x3F,
-    0x0B,
-    0xC3,
-    0x85,
-    0xFD,
-    0x78,
-    0xF4,
-    0x00,
-    0xCD,
-    0xFB,
-    0xD0,
-    0xCF,
-    0x10,
-    0xF4,
-    0x3B,
-    0x1E,
-    0x68,
-    0x0F,
-    0x2F,
-    0xC3,
-    0xAF,
-    0x1E,
-    0x06,
-    0x06,
-    0x00,
-    0x95,
-    0x67,
-    0x2E,
-    0x5B,
-    0x78,
-    0x9C,
-    0x13,
-    0x78,
-    0xB5,
-    0x9E,
-    0x89,
-    0x41,
-    0x95,
-    0xE1,
-    0xE1,
-    0xFF,
-    0xFF,
-    0xFD,
-    0xCD,
-    0xEF,
-    0x19,
-    0x7E,
-    0x7B,
-    0x3F,
-    0xFB,
-    0xFF,
-    0x3F,
-    0x9F,
-    0x61,
-    0x32,
-    0x83,
-    0xC0,
-    0x8B,
-    0xF3,
-    0x2C,
-    0x0C,
-    0x00,
-    0xCA,
-    0x61,
-    0x0D,
-    0xA8,
-    0x78,
-    0x9C,
-    0x03,
-    0x00,
-    0x00,
-    0x00,
-    0x00,
-    0x01,
-    0x78,
-    0x9C,
-    0x5B,
-    0xB0,
-    0x9F,
-    0xE1,
-    0xDB,
-    0x7F,
-    0xB6,
-    0x6F,
-    0xFF,
-    0xD9,
-    0x37,
-    0xEC,
-    0x67,
-    0x40,
-    0x06,
-    0x0B,
-    0xF6,
-    0x33,
-    0x2C,
-    0x38,
-    0xCF,
-    0xB0,
-    0x01,
-    0x82,
-    0xEE,
-    0x33,
-    0x1C,
-    0x00,
-    0xA2,
-    0xF7,
-    0x20,
-    0x74,
-    0x01,
-    0x88,
-    0xFE,
-    0x83,
-    0xD0,
-    0x03,
-    0x30,
-    0x02,
-    0x00,
-    0x27,
-    0xDD,
-    0x1C,
-    0x39,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0xF8,
-    0xCD,
-    0xC9,
-    0x00,
-    0x02,
-    0xD8,
-    0x28,
-    0x81,
-    0x3F,
-    0xD2,
-    0x40,
-    0x52,
-    0xE1,
-    0xF7,
-    0xFF,
-    0xFF,
-    0x52,
-    0x0C,
-    0x0C,
-    0x8F,
-    0xFE,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x9F,
-    0x81,
-    0xE1,
-    0xEF,
-    0x7A,
-    0xA6,
-    0x42,
-    0x3F,
-    0x86,
-    0x84,
-    0xFF,
-    0x5C,
-    0x20,
-    0x05,
-    0x07,
-    0xFE,
-    0x33,
-    0x82,
-    0xA8,
-    0x8F,
-    0xE7,
-    0xC1,
-    0x9A,
-    0x3E,
-    0xAF,
-    0x07,
-    0x53,
-    0x5F,
-    0xE6,
-    0x83,
-    0xA9,
-    0xAF,
-    0xF3,
-    0x91,
-    0x79,
-    0x9F,
-    0x20,
-    0x4A,
-    0x1E,
-    0x40,
-    0x34,
-    0x4C,
-    0xF8,
-    0xCF,
-    0x01,
-    0x36,
-    0xFF,
-    0xFF,
-    0x7C,
-    0x90,
-    0x61,
-    0x0C,
-    0x5F,
-    0x21,
-    0x46,
-    0x3B,
-    0xFC,
-    0xFB,
-    0xFF,
-    0x5F,
-    0x07,
-    0x28,
-    0xEC,
-    0xF0,
-    0xD7,
-    0x06,
-    0xA7,
-    0x93,
-    0xC0,
-    0x14,
-    0x00,
-    0x44,
-    0x73,
-    0x30,
-    0x44,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x28,
-    0xF8,
-    0x73,
-    0x5F,
-    0x82,
-    0x81,
-    0x41,
-    0xE0,
-    0xCF,
-    0xFF,
-    0xFF,
-    0xEF,
-    0x59,
-    0x18,
-    0x16,
-    0xFC,
-    0xF7,
-    0x4E,
-    0xFE,
-    0x2B,
-    0xCF,
-    0xF0,
-    0x71,
-    0x3F,
-    0x03,
-    0xC3,
-    0x02,
-    0x66,
-    0x86,
-    0xAF,
-    0xF1,
-    0x0C,
-    0x20,
-    0xF0,
-    0xCD,
-    0x1E,
-    0x4C,
-    0x7D,
-    0xC7,
-    0x42,
-    0x7D,
-    0xFD,
-    0x0F,
-    0x04,
-    0xFE,
-    0x30,
-    0xCA,
-    0xF0,
-    0x47,
-    0xBC,
-    0xB1,
-    0x31,
-    0x33,
-    0x76,
-    0x95,
-    0x0C,
-    0x3F,
-    0xE4,
-    0xC1,
-    0xD4,
-    0x1F,
-    0x1E,
-    0x10,
-    0xB9,
-    0xF9,
-    0xBD,
-    0x89,
-    0xB1,
-    0xB1,
-    0x31,
-    0xD3,
-    0x5F,
-    0x90,
-    0xBE,
-    0xFF,
-    0x5C,
-    0x10,
-    0x8A,
-    0x03,
-    0x00,
-    0x36,
-    0x5E,
-    0x32,
-    0xED,
-    0x78,
-    0x9C,
-    0x1D,
-    0x8D,
-    0x31,
-    0x12,
-    0xC1,
-    0x40,
-    0x00,
-    0x45,
-    0xDF,
-    0x5A,
-    0x34,
-    0xC1,
-    0x68,
-    0xF4,
-    0x5B,
-    0xAA,
-    0x8C,
-    0x1B,
-    0x44,
-    0xA9,
-    0x73,
-    0x04,
-    0x99,
-    0x49,
-    0xA9,
-    0xE0,
-    0x06,
-    0xDC,
-    0x40,
-    0xE7,
-    0x3A,
-    0x71,
-    0x84,
-    0x38,
-    0x41,
-    0x26,
-    0xE3,
-    0x00,
-    0x19,
-    0xC3,
-    0x28,
-    0xD8,
-    0xEC,
-    0x97,
-    0xF5,
-    0x9A,
-    0xD7,
-    0xBD,
-    0x87,
-    0xA1,
-    0x63,
-    0x4A,
-    0xB6,
-    0x89,
-    0xBE,
-    0x25,
-    0xA5,
-    0x72,
-    0x5F,
-    0xCD,
-    0x7D,
-    0xEA,
-    0x82,
-    0x22,
-    0x43,
-    0x9E,
-    0x5A,
-    0xE7,
-    0xED,
-    0x19,
-    0x5E,
-    0x7B,
-    0xA8,
-    0x0B,
-    0xF8,
-    0x4C,
-    0xE0,
-    0x20,
-    0x43,
-    0x9B,
-    0xC0,
-    0x4A,
-    0x7D,
-    0xC2,
-    0xDF,
-    0x03,
-    0xFC,
-    0x18,
-    0x32,
-    0x59,
-    0xDE,
-    0x5D,
-    0xA8,
-    0xAC,
-    0xE0,
-    0xD1,
-    0xCC,
-    0x96,
-    0xDF,
-    0x23,
-    0xF8,
-    0x98,
-    0x69,
-    0xEC,
-    0x55,
-    0x17,
-    0x69,
-    0x17,
-    0x16,
-    0xA7,
-    0x2D,
-    0xAE,
-    0xC7,
-    0x7D,
-    0x84,
-    0x8D,
-    0x3F,
-    0x67,
-    0x7E,
-    0x9C,
-    0x26,
-    0x32,
-    0x4E,
-    0x78,
-    0x9C,
-    0xFB,
-    0x99,
-    0xCF,
-    0x00,
-    0x04,
-    0x3F,
-    0xED,
-    0x3F,
-    0xBE,
-    0x07,
-    0x52,
-    0x0A,
-    0xFF,
-    0xB9,
-    0x0A,
-    0xFE,
-    0xB3,
-    0x31,
-    0x30,
-    0x2C,
-    0xF8,
-    0xCF,
-    0xC8,
-    0xF0,
-    0x8F,
-    0x8F,
-    0x81,
-    0xE1,
-    0x53,
-    0x3F,
-    0x03,
-    0xC3,
-    0xD7,
-    0x7A,
-    0x06,
-    0x86,
-    0x5F,
-    0x40,
-    0xF6,
-    0x81,
-    0xF7,
-    0x8C,
-    0x06,
-    0x20,
-    0x39,
-    0x83,
-    0xFF,
-    0x1C,
-    0x1B,
-    0xEE,
-    0x83,
-    0xF4,
-    0xFC,
-    0x92,
-    0xFF,
-    0xEC,
-    0x0F,
-    0xA2,
-    0x3F,
-    0xCD,
-    0xFF,
-    0xC3,
-    0x03,
-    0xA2,
-    0x1B,
-    0xFE,
-    0xFF,
-    0x67,
-    0x06,
-    0x19,
-    0xF5,
-    0x1F,
-    0x08,
-    0xEC,
-    0x19,
-    0x18,
-    0x6E,
-    0xDC,
-    0xFD,
-    0x77,
-    0xFF,
-    0xAE,
-    0x2E,
-    0x48,
-    0xE2,
-    0x87,
-    0x3D,
-    0x03,
-    0x03,
-    0x82,
-    0x86,
-    0xC9,
-    0xC3,
-    0x68,
-    0x43,
-    0xE3,
-    0x5F,
-    0xF1,
-    0xC6,
-    0xCC,
-    0x98,
-    0xEA,
-    0xA0,
-    0x34,
-    0x00,
-    0x37,
-    0xF4,
-    0x37,
-    0x26,
-    0x78,
-    0x9C,
-    0xFB,
-    0x2A,
-    0xFF,
-    0x15,
-    0x0B,
-    0x64,
-    0x80,
-    0x03,
-    0x6C,
-    0xB2,
-    0x5F,
-    0xE5,
-    0x01,
-    0x95,
-    0xCA,
-    0x17,
-    0xB9,
-    0x78,
-    0x9C,
-    0x63,
-    0x68,
-    0xFC,
-    0xF3,
-    0xDE,
-    0x8B,
-    0x41,
-    0xE1,
-    0xDF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x79,
-    0x2E,
-    0xFC,
-    0xF7,
-    0x08,
-    0xFE,
-    0xC5,
-    0xFD,
-    0x69,
-    0x3E,
-    0x03,
-    0x83,
-    0x02,
-    0xD3,
-    0xE7,
-    0x7A,
-    0x06,
-    0x20,
-    0xF8,
-    0x78,
-    0x9F,
-    0x11,
-    0x48,
-    0x4E,
-    0xF8,
-    0x5F,
-    0x07,
-    0xA4,
-    0x04,
-    0xFE,
-    0xFD,
-    0xDF,
-    0xCF,
-    0xC2,
-    0xF0,
-    0x70,
-    0xFD,
-    0x8B,
-    0xFF,
-    0xE7,
-    0x19,
-    0x7F,
-    0xF2,
-    0x31,
-    0x1C,
-    0xFD,
-    0xCF,
-    0xFB,
-    0x8F,
-    0x8B,
-    0x81,
-    0xE1,
-    0x47,
-    0xFC,
-    0x3F,
-    0x5E,
-    0xA0,
-    0xBA,
-    0xFA,
-    0x5F,
-    0xF3,
-    0x19,
-    0x19,
-    0x3E,
-    0xFB,
-    0x5F,
-    0xFC,
-    0xBF,
-    0x9F,
-    0xF5,
-    0x37,
-    0x0F,
-    0xC3,
-    0xF3,
-    0xFF,
-    0x40,
-    0x35,
-    0x0C,
-    0x0C,
-    0x93,
-    0xFF,
-    0x9F,
-    0x67,
-    0x00,
-    0x6B,
-    0xE7,
-    0x00,
-    0x51,
-    0x20,
-    0x75,
-    0x40,
-    0x92,
-    0xE7,
-    0xA1,
-    0x05,
-    0xC3,
-    0xA2,
-    0xFF,
-    0xEC,
-    0x3F,
-    0x80,
-    0x16,
-    0x9E,
-    0x67,
-    0x48,
-    0xF8,
-    0xF3,
-    0xFF,
-    0x3E,
-    0x3B,
-    0x50,
-    0x54,
-    0x09,
-    0xA8,
-    0x1A,
-    0x00,
-    0xD5,
-    0x6C,
-    0x3B,
-    0x3C,
-    0x78,
-    0x9C,
-    0x9B,
-    0xB0,
-    0x9E,
-    0xA1,
-    0xE0,
-    0x3C,
-    0xC3,
-    0xC7,
-    0xFF,
-    0x4C,
-    0x1F,
-    0xFE,
-    0xB3,
-    0x4C,
-    0x00,
-    0xB3,
-    0x01,
-    0x58,
-    0x45,
-    0x08,
-    0xE2,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x68,
-    0xBE,
-    0xBD,
-    0x46,
-    0x9C,
-    0x01,
-    0x04,
-    0x36,
-    0xFD,
-    0x07,
-    0x02,
-    0x0E,
-    0x20,
-    0xC3,
-    0xE1,
-    0x5F,
-    0x0E,
-    0x93,
-    0xE1,
-    0x8B,
-    0xF3,
-    0x8C,
-    0x0C,
-    0x0C,
-    0x9F,
-    0xF2,
-    0x19,
-    0x14,
-    0x98,
-    0x18,
-    0x7E,
-    0xF1,
-    0x30,
-    0x30,
-    0xFC,
-    0x65,
-    0x29,
-    0xF8,
-    0xF7,
-    0x9E,
-    0x75,
-    0x41,
-    0x3F,
-    0x43,
-    0xC1,
-    0x7C,
-    0x86,
-    0x9F,
-    0xFF,
-    0xFF,
-    0xCB,
-    0x33,
-    0xFC,
-    0x63,
-    0xBC,
-    0x20,
-    0x6F,
-    0xF0,
-    0x5F,
-    0x32,
-    0x91,
-    0x9D,
-    0xE1,
-    0x3B,
-    0xFB,
-    0x47,
-    0xEE,
-    0x09,
-    0xE7,
-    0x41,
-    0x26,
-    0x7C,
-    0xE4,
-    0xFE,
-    0xCC,
-    0x79,
-    0xA0,
-    0x1E,
-    0xC4,
-    0xFA,
-    0xC0,
-    0xF7,
-    0x85,
-    0xFD,
-    0x42,
-    0x3E,
-    0x88,
-    0x75,
-    0x81,
-    0xEF,
-    0x0B,
-    0x54,
-    0xEC,
-    0x01,
-    0xDF,
-    0x27,
-    0xA8,
-    0xBA,
-    0x0F,
-    0x3C,
-    0x0F,
-    0xF8,
-    0x1D,
-    0xFE,
-    0x4B,
-    0x04,
-    0x72,
-    0x30,
-    0x7C,
-    0xE3,
-    0x68,
-    0xA8,
-    0x67,
-    0xF8,
-    0xF5,
-    0xFF,
-    0xBF,
-    0x3D,
-    0xC3,
-    0x1F,
-    0x26,
-    0x81,
-    0x7F,
-    0x4C,
-    0x0D,
-    0xFF,
-    0xDF,
-    0xB3,
-    0x36,
-    0xAC,
-    0x67,
-    0x60,
-    0xF8,
-    0x62,
-    0x07,
-    0xB2,
-    0xF7,
-    0xBB,
-    0x1C,
-    0x03,
-    0x43,
-    0xC1,
-    0x7F,
-    0x4B,
-    0x06,
-    0x86,
-    0xA3,
-    0xEF,
-    0x99,
-    0x81,
-    0xBA,
-    0x9E,
-    0xFC,
-    0x7F,
-    0xFF,
-    0xEF,
-    0xBF,
-    0x34,
-    0xD8,
-    0xA9,
-    0xDB,
-    0xFE,
-    0xDD,
-    0xF7,
-    0x04,
-    0x52,
-    0x00,
-    0xD2,
-    0x39,
-    0x45,
-    0x84,
-    0x78,
-    0x9C,
-    0x63,
-    0x98,
-    0xFA,
-    0xF6,
-    0xBE,
-    0x24,
-    0x03,
-    0x83,
-    0xC0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xDF,
-    0x33,
-    0x32,
-    0x30,
-    0x74,
-    0x9A,
-    0x6E,
-    0xF9,
-    0xCF,
-    0xCE,
-    0x00,
-    0x02,
-    0xFF,
-    0xB9,
-    0xC0,
-    0xD4,
-    0x3F,
-    0x6E,
-    0x06,
-    0x86,
-    0xC6,
-    0x3F,
-    0xFF,
-    0xFF,
-    0x73,
-    0x33,
-    0x28,
-    0xFC,
-    0xFB,
-    0x0F,
-    0xA2,
-    0x0E,
-    0xFC,
-    0x8F,
-    0x36,
-    0x06,
-    0x0A,
-    0x7E,
-    0xB8,
-    0x0F,
-    0x96,
-    0xFB,
-    0xB8,
-    0x1F,
-    0xA8,
-    0x95,
-    0x87,
-    0xE1,
-    0xC1,
-    0x7F,
-    0xF3,
-    0xAB,
-    0xFF,
-    0xF5,
-    0x19,
-    0x12,
-    0x80,
-    0x2A,
-    0xBE,
-    0xF5,
-    0x33,
-    0x30,
-    0x1C,
-    0x7D,
-    0xAF,
-    0x1D,
-    0xE0,
-    0xCB,
-    0x40,
-    0x04,
-    0x50,
-    0x30,
-    0x06,
-    0x01,
-    0xA0,
-    0x76,
-    0x10,
-    0x80,
-    0x51,
-    0x00,
-    0x95,
-    0x3F,
-    0x33,
-    0xF3,
-    0x78,
-    0x9C,
-    0x0D,
-    0x8C,
-    0xCB,
-    0x0D,
-    0x82,
-    0x50,
-    0x14,
-    0x05,
-    0x07,
-    0x34,
-    0x04,
-    0xE5,
-    0x13,
-    0x36,
-    0xAC,
-    0x69,
-    0xC1,
-    0xAD,
-    0x2B,
-    0x2D,
-    0x81,
-    0x0E,
-    0xA0,
-    0x03,
-    0xE8,
-    0x80,
-    0xD7,
-    0x01,
-    0x25,
-    0x40,
-    0x09,
-    0x94,
-    0x40,
-    0x27,
-    0x84,
-    0x0A,
-    0x5E,
-    0xA2,
-    0x81,
-    0x60,
-    0x82,
-    0x5C,
-    0xEE,
-    0x66,
-    0x36,
-    0x67,
-    0xCE,
-    0xC0,
-    0xDB,
-    0x81,
-    0x14,
-    0xF8,
-    0x66,
-    0xE4,
-    0x16,
-    0x92,
-    0xE3,
-    0xCE,
-    0xA7,
-    0x85,
-    0xD1,
-    0x3A,
-    0xC9,
-    0x3F,
-    0x82,
-    0x5F,
-    0xC5,
-    0x20,
-    0x17,
-    0x4A,
-    0x09,
-    0xD8,
-    0x3A,
-    0xB5,
-    0xC4,
-    0xCD,
-    0x25,
-    0x86,
-    0xB5,
-    0xC5,
-    0x88,
-    0x07,
-    0x8B,
-    0xA5,
-    0x96,
-    0x10,
-    0x7A,
-    0xB9,
-    0xB1,
-    0x37,
-    0x9A,
-    0xD9,
-    0x5F,
-    0xCC,
-    0xE2,
-    0xC2,
-    0x3C,
-    0xF1,
-    0xD0,
-    0x8F,
-    0xC2,
-    0x67,
-    0x29,
-    0x74,
-    0x58,
-    0x33,
-    0x8C,
-    0xF6,
-    0x31,
-    0x57,
-    0x78,
-    0x72,
-    0x02,
-    0x21,
-    0xFF,
-    0x26,
-    0xE6,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x06,
-    0x02,
-    0xE5,
-    0xCF,
-    0xFF,
-    0x81,
-    0xE0,
-    0x3C,
-    0x84,
-    0x64,
-    0x00,
-    0x82,
-    0x05,
-    0x58,
-    0x48,
-    0x00,
-    0xC7,
-    0x74,
-    0x12,
-    0x58,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x36,
-    0x36,
-    0x66,
-    0xFE,
-    0xF2,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x7E,
-    0x30,
-    0x01,
-    0x00,
-    0x3A,
-    0x59,
-    0x08,
-    0xCD,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x48,
-    0x78,
-    0x7D,
-    0xDF,
-    0x8A,
-    0x81,
-    0x81,
-    0x41,
-    0xE1,
-    0xAD,
-    0x47,
-    0xF0,
-    0x2F,
-    0x4E,
-    0x06,
-    0x86,
-    0x47,
-    0xDC,
-    0x0C,
-    0x0C,
-    0x06,
-    0xE7,
-    0x18,
-    0x18,
-    0xEE,
-    0x06,
-    0xFC,
-    0x3F,
-    0xC7,
-    0xFA,
-    0x89,
-    0x23,
-    0xC0,
-    0x3F,
-    0x20,
-    0x7F,
-    0xB3,
-    0xFD,
-    0x04,
-    0xF9,
-    0x0D,
-    0x7C,
-    0x01,
-    0xF1,
-    0x0E,
-    0xF9,
-    0x06,
-    0xF9,
-    0x0F,
-    0xB8,
-    0x02,
-    0xE2,
-    0x27,
-    0xF8,
-    0x33,
-    0xCC,
-    0xFF,
-    0xC0,
-    0x19,
-    0xF0,
-    0xFF,
-    0x3D,
-    0x1B,
-    0xC3,
-    0xBE,
-    0x0F,
-    0x5C,
-    0x01,
-    0xF9,
-    0x6F,
-    0x19,
-    0x18,
-    0xD6,
-    0x1F,
-    0xE0,
-    0x09,
-    0x88,
-    0xFF,
-    0xC2,
-    0x2E,
-    0x50,
-    0x5F,
-    0xA0,
-    0x1F,
-    0x10,
-    0x7F,
-    0x40,
-    0xBE,
-    0x40,
-    0x5F,
-    0x60,
-    0x9F,
-    0x81,
-    0x95,
-    0x43,
-    0xD4,
-    0x43,
-    0x2E,
-    0x86,
-    0x2F,
-    0x1C,
-    0x0C,
-    0x0C,
-    0x02,
-    0x6F,
-    0x18,
-    0x19,
-    0x02,
-    0xCE,
-    0x8B,
-    0x28,
-    0x3C,
-    0xD7,
-    0x01,
-    0x5A,
-    0xD4,
-    0xF8,
-    0xEF,
-    0x7F,
-    0x2E,
-    0x03,
-    0x08,
-    0x08,
-    0x30,
-    0x01,
-    0x09,
-    0x00,
-    0x96,
-    0x11,
-    0x2A,
-    0xFF,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x36,
-    0x36,
-    0x66,
-    0xFA,
-    0xF4,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x5E,
-    0x30,
-    0x01,
-    0x00,
-    0x3A,
-    0x22,
-    0x08,
-    0xC4,
-    0x78,
-    0x9C,
-    0x63,
-    0x98,
-    0xF8,
-    0xAF,
-    0x96,
-    0x81,
-    0x41,
-    0xE1,
-    0xDF,
-    0xFF,
-    0xFF,
-    0x3C,
-    0x0C,
-    0x07,
-    0xDE,
-    0x9B,
-    0x7D,
-    0xEF,
-    0x67,
-    0xF8,
-    0x64,
-    0xCF,
-    0x50,
-    0xF0,
-    0x9E,
-    0xE1,
-    0x2B,
-    0x1F,
-    0x83,
-    0xC2,
-    0x7F,
-    0x46,
-    0x08,
-    0x09,
-    0x12,
-    0xF9,
-    0x0F,
-    0x96,
-    0x9D,
-    0x0F,
-    0x55,
-    0xC9,
-    0x00,
-    0xD6,
-    0x05,
-    0x00,
-    0x3C,
-    0xE7,
-    0x1A,
-    0xC5,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0xF8,
-    0xD0,
-    0xCF,
-    0x00,
-    0x04,
-    0xE8,
-    0xE4,
-    0xA7,
-    0xFF,
-    0x40,
-    0x70,
-    0x1E,
-    0x42,
-    0x1A,
-    0x18,
-    0x7F,
-    0x9E,
-    0x6F,
-    0xAC,
-    0x8C,
-    0xA9,
-    0x06,
-    0x46,
-    0xA2,
-    0x03,
-    0x03,
-    0x63,
-    0x20,
-    0x50,
-    0xFE,
-    0x0C,
-    0xD6,
-    0x0B,
-    0x21,
-    0x01,
-    0x71,
-    0xA3,
-    0x26,
-    0x59,
-    0x78,
-    0x9C,
-    0x63,
-    0x38,
-    0xFA,
-    0x5E,
-    0x8B,
-    0x61,
-    0xC2,
-    0xFF,
-    0xFF,
-    0xEF,
-    0x19,
-    0x3F,
-    0xE5,
-    0x15,
-    0xFF,
-    0xE7,
-    0x34,
-    0x60,
-    0x62,
-    0xF8,
-    0xCD,
-    0xCD,
-    0xC0,
-    0xC0,
-    0xF0,
-    0x8B,
-    0x93,
-    0x81,
-    0x41,
-    0xE0,
-    0x3F,
-    0x0B,
-    0x03,
-    0xC3,
-    0x82,
-    0xF5,
-    0x40,
-    0xDE,
-    0x0F,
-    0x1E,
-    0x06,
-    0x86,
-    0x82,
-    0xFB,
-    0x8C,
-    0x0C,
-    0x0C,
-    0xDF,
-    0x65,
-    0x19,
-    0x18,
-    0x1A,
-    0xDE,
-    0x9B,
-    0x18,
-    0x33,
-    0x7F,
-    0xF8,
-    0xFF,
-    0xFF,
-    0x3F,
-    0x3F,
-    0x88,
-    0xE0,
-    0x05,
-    0x00,
-    0x2A,
-    0x01,
-    0x1A,
-    0x0C,
-    0x78,
-    0x9C,
-    0x63,
-    0x38,
-    0xF6,
-    0xDE,
-    0x9A,
-    0x61,
-    0xC1,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x99,
-    0x27,
-    0xE4,
-    0x06,
-    0xFF,
-    0xE3,
-    0x62,
-    0x60,
-    0x60,
-    0xF8,
-    0x01,
-    0x24,
-    0x0C,
-    0xFE,
-    0xB1,
-    0x32,
-    0x04,
-    0xFC,
-    0xCF,
-    0x65,
-    0x60,
-    0x28,
-    0xF8,
-    0x3F,
-    0x8F,
-    0x91,
-    0x41,
-    0x20,
-    0xF8,
-    0x2F,
-    0x37,
-    0x50,
-    0xE2,
-    0x0B,
-    0xBF,
-    0x00,
-    0x03,
-    0xC3,
-    0x57,
-    0xF9,
-    0x47,
-    0x31,
-    0xC9,
-    0xFF,
-    0x78,
-    0x2F,
-    0x02,
-    0x75,
-    0xB0,
-    0x30,
-    0xDC,
-    0x78,
-    0x6F,
-    0xC5,
-    0x00,
-    0x00,
-    0x4D,
-    0x64,
-    0x19,
-    0xF9,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x62,
-    0x60,
-    0xD8,
-    0xA4,
-    0xCF,
-    0xD0,
-    0xF0,
-    0x7F,
-    0x7D,
-    0xC2,
-    0xBF,
-    0xFB,
-    0xE2,
-    0x07,
-    0xD6,
-    0xB3,
-    0x30,
-    0x28,
-    0x30,
-    0x32,
-    0x30,
-    0x00,
-    0x00,
-    0x52,
-    0x8D,
-    0x06,
-    0xFA,
-    0x78,
-    0x9C,
-    0xFB,
-    0x5C,
-    0xCF,
-    0xC0,
-    0x50,
-    0xF0,
-    0x9F,
-    0xF9,
-    0x33,
-    0xD5,
-    0xA8,
-    0x03,
-    0xFF,
-    0x59,
-    0x3E,
-    0xEF,
-    0x67,
-    0x60,
-    0xF8,
-    0xF1,
-    0x9F,
-    0xF5,
-    0xF3,
-    0x7F,
-    0x8B,
-    0x2D,
-    0xE7,
-    0xFF,
-    0xB3,
-    0x7F,
-    0xFE,
-    0xFF,
-    0xFF,
-    0xBF,
-    0xF4,
-    0x7F,
-    0xEE,
-    0xCF,
-    0xF9,
-    0x7F,
-    0x7B,
-    0x19,
-    0x5E,
-    0x73,
-    0x7D,
-    0xF6,
-    0x67,
-    0x00,
-    0x81,
-    0xCF,
-    0xF9,
-    0xB8,
-    0xA9,
-    0xC7,
-    0x3E,
-    0x60,
-    0x0A,
-    0x00,
-    0x04,
-    0x1F,
-    0x3C,
-    0x52,
-    0x78,
-    0x9C,
-    0x63,
-    0x10,
-    0xD8,
-    0xFE,
-    0xEF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xF1,
-    0x0C,
-    0x4F,
-    0xFF,
-    0x83,
-    0x40,
-    0xBC,
-    0x03,
-    0x90,
-    0x58,
-    0x6F,
-    0xFC,
-    0x25,
-    0xFE,
-    0x02,
-    0x90,
-    0x9E,
-    0xCF,
-    0xF0,
-    0x31,
-    0xFE,
-    0x13,
-    0x94,
-    0xFE,
-    0x8A,
-    0x46,
-    0x7F,
-    0x86,
-    0xD2,
-    0x1F,
-    0xA0,
-    0x74,
-    0x01,
-    0x94,
-    0x66,
-    0xF8,
-    0x0D,
-    0xA5,
-    0x13,
-    0xFE,
-    0x40,
-    0x68,
-    0x06,
-    0x86,
-    0x4B,
-    0x50,
-    0xFA,
-    0x02,
-    0x9D,
-    0xE8,
-    0x03,
-    0x39,
-    0x0C,
-    0x0F,
-    0xAD,
-    0x01,
-    0xB2,
-    0x12,
-    0x6B,
-    0x34,
-    0x78,
-    0x9C,
-    0xDB,
-    0xB0,
-    0x9E,
-    0xE1,
-    0xFB,
-    0x7F,
-    0xB6,
-    0x6F,
-    0xFF,
-    0xD9,
-    0x36,
-    0xAC,
-    0x67,
-    0x00,
-    0x00,
-    0x2E,
-    0xE7,
-    0x06,
-    0xB6,
-    0x78,
-    0x9C,
-    0x63,
-    0xF8,
-    0xCA,
-    0xC6,
-    0xC0,
-    0xF0,
-    0x83,
-    0x9D,
-    0x81,
-    0xE1,
-    0xD7,
-    0x7D,
-    0x16,
-    0x06,
-    0x81,
-    0xEF,
-    0xFC,
-    0x0E,
-    0x26,
-    0x3F,
-    0xE4,
-    0x2F,
-    0xFC,
-    0xFF,
-    0xCF,
-    0x53,
-    0xF0,
-    0x77,
-    0x1E,
-    0x23,
-    0x00,
-    0x8C,
-    0xCC,
-    0x0B,
-    0x5F,
-    0x78,
-    0x9C,
-    0x63,
-    0x50,
-    0xF8,
-    0xCD,
-    0xCF,
-    0xF0,
-    0xE3,
-    0x3F,
-    0xFF,
-    0x85,
-    0xF7,
-    0x3F,
-    0xF9,
-    0x13,
-    0x24,
-    0xBF,
-    0xF0,
-    0x33,
-    0x30,
-    0xE0,
-    0xC7,
-    0x00,
-    0xAC,
-    0x15,
-    0x0F,
-    0x8C,
-    0x78,
-    0x9C,
-    0x63,
-    0x70,
-    0x78,
-    0xFD,
-    0x5E,
-    0x93,
-    0x81,
-    0xE1,
-    0xC7,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x59,
-    0x02,
-    0xFE,
-    0xC7,
-    0x16,
-    0xFF,
-    0x97,
-    0xBB,
-    0xF0,
-    0x9F,
-    0x91,
-    0xE1,
-    0x5B,
-    0xFD,
-    0xA7,
-    0xF5,
-    0x0C,
-    0x0C,
-    0x1F,
-    0xF6,
-    0x7F,
-    0xA9,
-    0x67,
-    0x60,
-    0xB8,
-    0xF0,
-    0xFE,
-    0x6B,
-    0x3E,
-    0x88,
-    0x84,
-    0xB0,
-    0x21,
-    0xE2,
-    0x60,
-    0x35,
-    0xF9,
-    0x09,
-    0x20,
-    0xF5,
-    0x7C,
-    0x0C,
-    0x3F,
-    0x81,
-    0x7A,
-    0x99,
-    0x19,
-    0x02,
-    0x5E,
-    0xDF,
-    0x97,
-    0x64,
-    0xC0,
-    0x0F,
-    0x0C,
-    0x8C,
-    0x81,
-    0x40,
-    0xF9,
-    0x33,
-    0x50,
-    0xF9,
-    0xFF,
-    0xF3,
-    0x10,
-    0x12,
-    0x00,
-    0x93,
-    0x63,
-    0x36,
-    0x1D,
-    0x78,
-    0x9C,
-    0x0D,
-    0xC8,
-    0xBD,
-    0x0D,
-    0x40,
-    0x40,
-    0x18,
-    0x80,
-    0xE1,
-    0x37,
-    0x17,
-    0x17,
-    0x12,
-    0xCD,
-    0x2D,
-    0x20,
-    0xD1,
-    0xAA,
-    0xD8,
-    0xC0,
-    0x08,
-    0x6C,
-    0x60,
-    0x15,
-    0x1B,
-    0x30,
-    0x82,
-    0x0D,
-    0xD8,
-    0xE0,
-    0x8C,
-    0x60,
-    0x83,
-    0x1B,
-    0x81,
-    0x88,
-    0xDF,
-    0xE6,
-    0x3E,
-    0x8A,
-    0xA7,
-    0x79,
-    0xD2,
-    0x00,
-    0x34,
-    0xEC,
-    0x39,
-    0xED,
-    0x08,
-    0x93,
-    0x23,
-    0x95,
-    0xF0,
-    0x17,
-    0xF3,
-    0x54,
-    0x70,
-    0x77,
-    0x2C,
-    0xA2,
-    0x98,
-    0x45,
-    0x17,
-    0x92,
-    0x50,
-    0x48,
-    0xCE,
-    0x6B,
-    0xE1,
-    0x6D,
-    0xD8,
-    0x56,
-    0x8C,
-    0x2F,
-    0xB9,
-    0x1C,
-    0x83,
-    0x44,
-    0xE6,
-    0xFF,
-    0xC3,
-    0x32,
-    0x89,
-    0xC6,
-    0x27,
-    0x9C,
-    0x1D,
-    0xBD,
-    0x28,
-    0xE3,
-    0x63,
-    0xF6,
-    0x8A,
-    0xDE,
-    0x41,
-    0x1D,
-    0x62,
-    0x32,
-    0xF8,
-    0x00,
-    0xC9,
-    0xA6,
-    0x26,
-    0x4B,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x80,
-    0x80,
-    0x02,
-    0x76,
-    0x06,
-    0x04,
-    0xF8,
-    0xA8,
-    0x0F,
-    0x22,
-    0x15,
-    0x7E,
-    0xF3,
-    0x83,
-    0xA8,
-    0x1F,
-    0x9C,
-    0x60,
-    0xF2,
-    0x3F,
-    0x88,
-    0x23,
-    0xF0,
-    0x9F,
-    0x09,
-    0x48,
-    0x5E,
-    0x78,
-    0xFF,
-    0x0B,
-    0xC4,
-    0x69,
-    0x98,
-    0x0F,
-    0x92,
-    0x48,
-    0x90,
-    0xFC,
-    0x02,
-    0xE2,
-    0x7C,
-    0x94,
-    0x87,
-    0x68,
-    0x05,
-    0x73,
-    0x7E,
-    0x72,
-    0x22,
-    0x38,
-    0x02,
-    0xFF,
-    0x19,
-    0x11,
-    0x9C,
-    0x09,
-    0xF3,
-    0x19,
-    0x10,
-    0x9C,
-    0x4F,
-    0xF2,
-    0x0C,
-    0x13,
-    0xC4,
-    0x61,
-    0x9C,
-    0x9F,
-    0x1C,
-    0x0C,
-    0x9F,
-    0xF4,
-    0xA1,
-    0x1C,
-    0x05,
-    0xA0,
-    0x96,
-    0x5F,
-    0x5C,
-    0x50,
-    0xCE,
-    0x82,
-    0x7E,
-    0xA0,
-    0x11,
-    0xCC,
-    0x50,
-    0x0E,
-    0x50,
-    0x4B,
-    0xC3,
-    0x7E,
-    0x98,
-    0x2B,
-    0x7F,
-    0x71,
-    0x30,
-    0x7C,
-    0xF0,
-    0x5F,
-    0x90,
-    0x0F,
-    0x66,
-    0x83,
-    0xB4,
-    0x7C,
-    0xE7,
-    0xD9,
-    0x00,
-    0xE1,
-    0x2C,
-    0xA8,
-    0x67,
-    0x60,
-    0xF8,
-    0xC7,
-    0x7A,
-    0x00,
-    0xC2,
-    0xF9,
-    0xCC,
-    0xC7,
-    0xE0,
-    0xF0,
-    0x1F,
-    0x08,
-    0xC0,
-    0x7E,
-    0xF9,
-    0xCD,
-    0x8E,
-    0xE0,
-    0x18,
-    0xBC,
-    0x07,
-    0x12,
-    0xC6,
-    0xC6,
-    0x97,
-    0xFB,
-    0x41,
-    0x5E,
-    0xDA,
-    0x50,
-    0x0F,
-    0x56,
-    0x7C,
-    0x21,
-    0x1F,
-    0xAA,
-    0x05,
-    0xC1,
-    0xF9,
-    0x8D,
-    0x1C,
-    0x30,
-    0x6F,
-    0x90,
-    0xD8,
-    0x0C,
-    0x02,
-    0x70,
-    0x16,
-    0x00,
-    0x31,
-    0x9C,
-    0x41,
-    0x46,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x80,
-    0x80,
-    0x02,
-    0x76,
-    0x06,
-    0x04,
-    0xF8,
-    0xA8,
-    0x0F,
-    0x22,
-    0x15,
-    0x7E,
-    0xF3,
-    0x83,
-    0xA8,
-    0x1F,
-    0x9C,
-    0x60,
-    0xF2,
-    0x3F,
-    0x88,
-    0x23,
-    0xF0,
-    0x9F,
-    0x09,
-    0x48,
-    0x5E,
-    0x78,
-    0xFF,
-    0x0B,
-    0xC4,
-    0x69,
-    0x98,
-    0x0F,
-    0x92,
-    0x48,
-    0x90,
-    0xFC,
-    0x02,
-    0xE2,
-    0x7C,
-    0x94,
-    0x87,
-    0x68,
-    0x05,
-    0x73,
-    0x7E,
-    0x72,
-    0x22,
-    0x38,
-    0x02,
-    0xFF,
-    0x19,
-    0x11,
-    0x9C,
-    0x09,
-    0xF3,
-    0x19,
-    0x10,
-    0x9C,
-    0x4F,
-    0xF2,
-    0x02,
-    0x2F,
-    0xEF,
-    0xB3,
-    0x41,
-    0x39,
-    0x3F,
-    0x39,
-    0x1E,
-    0xFD,
-    0xFF,
-    0x3F,
-    0x1F,
-    0xC2,
-    0x51,
-    0xF8,
-    0xCF,
-    0xF8,
-    0xD3,
-    0xEB,
-    0x08,
-    0x48,
-    0x1F,
-    0x90,
-    0xB3,
-    0xA0,
-    0x9F,
-    0x21,
-    0x80,
-    0xC1,
-    0xE0,
-    0x3F,
-    0x33,
-    0x98,
-    0xF3,
-    0x09,
-    0x64,
-    0x8B,
-    0x02,
-    0xD8,
-    0x11,
-    0x0C,
-    0x0C,
-    0xBF,
-    0x38,
-    0x40,
-    0xEE,
-    0x3E,
-    0x0F,
-    0x66,
-    0x2B,
-    0x80,
-    0x6D,
-    0xF9,
-    0x64,
-    0x0F,
-    0xE6,
-    0x2C,
-    0xA8,
-    0x07,
-    0x39,
-    0xF5,
-    0x1F,
-    0x2B,
-    0x98,
-    0xF3,
-    0x99,
-    0x0F,
-    0x48,
-    0x5C,
-    0xAC,
-    0x87,
-    0x58,
-    0xFB,
-    0x1B,
-    0xE8,
-    0x4B,
-    0x81,
-    0xBF,
-    0x6C,
-    0x60,
-    0xB6,
-    0xC1,
-    0x7B,
-    0x20,
-    0xF1,
-    0x68,
-    0xBE,
-    0xB1,
-    0x31,
-    0x48,
-    0xE7,
-    0x86,
-    0x7A,
-    0xB0,
-    0x1F,
-    0xFF,
-    0xFF,
-    0x67,
-    0x87,
-    0x69,
-    0x01,
-    0x71,
-    0x58,
-    0xA1,
-    0x5A,
-    0xE0,
-    0xE0,
-    0x0D,
-    0x12,
-    0x9B,
-    0x41,
-    0x00,
-    0xCE,
-    0x02,
-    0x00,
-    0xE0,
-    0x7E,
-    0x43,
-    0x74,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x80,
-    0x80,
-    0x02,
-    0x76,
-    0x06,
-    0x04,
-    0xF8,
-    0xA8,
-    0x0F,
-    0x22,
-    0x8F,
-    0xBD,
-    0xF7,
-    0x06,
-    0x51,
-    0x3F,
-    0x38,
-    0x81,
-    0xC4,
-    0x82,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xB3,
-    0x31,
-    0x30,
-    0x08,
-    0xFC,
-    0x67,
-    0x02,
-    0x72,
-    0x12,
-    0x3C,
-    0x9D,
-    0xFF,
-    0x72,
-    0x33,
-    0x30,
-    0x34,
-    0xCC,
-    0x87,
-    0xA8,
-    0x56,
-    0xF8,
-    0x03,
-    0xD4,
-    0xFB,
-    0x51,
-    0x1E,
-    0xCC,
-    0x0E,
-    0xF8,
-    0xDF,
-    0x07,
-    0x24,
-    0x7F,
-    0x72,
-    0x42,
-    0xCC,
-    0xFC,
-    0x3F,
-    0x0F,
-    0xA4,
-    0x85,
-    0x11,
-    0xCC,
-    0x11,
-    0x08,
-    0xFE,
-    0xCB,
-    0xC5,
-    0x30,
-    0x61,
-    0x3E,
-    0xCC,
-    0x8A,
-    0xAF,
-    0xFC,
-    0x0C,
-    0x9F,
-    0xE4,
-    0x19,
-    0x26,
-    0x88,
-    0x43,
-    0x38,
-    0xF2,
-    0x0C,
-    0x3F,
-    0x39,
-    0x18,
-    0x3E,
-    0x01,
-    0x6D,
-    0x3D,
-    0xA8,
-    0x69,
-    0xF0,
-    0x97,
-    0x4F,
-    0x01,
-    0xA8,
-    0xE5,
-    0x17,
-    0x17,
-    0x03,
-    0xC3,
-    0x23,
-    0xA0,
-    0xA5,
-    0xAC,
-    0x0B,
-    0xFA,
-    0x81,
-    0x46,
-    0x30,
-    0x03,
-    0x6D,
-    0xF9,
-    0xFD,
-    0x3F,
-    0x16,
-    0xA4,
-    0xA5,
-    0x61,
-    0x3F,
-    0x58,
-    0x8B,
-    0x10,
-    0x03,
-    0xC3,
-    0x2F,
-    0x0E,
-    0x86,
-    0x0F,
-    0xFE,
-    0x0B,
-    0xF2,
-    0x21,
-    0x6E,
-    0x00,
-    0x6A,
-    0xF9,
-    0xCE,
-    0xB3,
-    0x01,
-    0xC2,
-    0x59,
-    0x50,
-    0xCF,
-    0xC0,
-    0xF0,
-    0x8F,
-    0xF5,
-    0x00,
-    0x84,
-    0xF3,
-    0x99,
-    0x8F,
-    0xC1,
-    0x01,
-    0x68,
-    0xCE,
-    0x7F,
-    0x7E,
-    0x10,
-    0xE7,
-    0x37,
-    0x3B,
-    0x82,
-    0x63,
-    0xF0,
-    0x1E,
-    0x48,
-    0x18,
-    0x1B,
-    0x5F,
-    0xEE,
-    0x07,
-    0x79,
-    0x69,
-    0x43,
-    0x3D,
-    0x58,
-    0xF1,
-    0x85,
-    0x7C,
-    0xA8,
-    0x16,
-    0x04,
-    0xE7,
-    0x37,
-    0x72,
-    0xC0,
-    0xBC,
-    0x41,
-    0x62,
-    0x33,
-    0x08,
-    0xC0,
-    0x59,
-    0x00,
-    0x74,
-    0x6E,
-    0x4A,
-    0x72,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x10,
-    0xF8,
-    0xCD,
-    0xC9,
-    0x00,
-    0x04,
-    0x0D,
-    0xFF,
-    0xFD,
-    0x21,
-    0x54,
-    0x3C,
-    0x88,
-    0x82,
-    0x0A,
-    0x62,
-    0x07,
-    0x3B,
-    0x21,
-    0x72,
-    0x7F,
-    0x79,
-    0xC0,
-    0xD4,
-    0x7F,
-    0x6E,
-    0x10,
-    0xB9,
-    0xE0,
-    0x3F,
-    0x3B,
-    0x88,
-    0xFA,
-    0xF5,
-    0x1E,
-    0x44,
-    0x5E,
-    0xFE,
-    0xAF,
-    0x0B,
-    0x24,
-    0x0D,
-    0xFE,
-    0xCF,
-    0x07,
-    0x71,
-    0x0E,
-    0xFC,
-    0x67,
-    0x05,
-    0x51,
-    0x1F,
-    0xCE,
-    0x83,
-    0x55,
-    0x7F,
-    0xDC,
-    0x0F,
-    0x24,
-    0x98,
-    0x18,
-    0x1E,
-    0xFC,
-    0x67,
-    0x64,
-    0x70,
-    0xD8,
-    0xCF,
-    0xD8,
-    0xF0,
-    0x3F,
-    0x37,
-    0xE4,
-    0xD7,
-    0x7B,
-    0x26,
-    0x86,
-    0xDF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xD7,
-    0x61,
-    0x60,
-    0x08,
-    0x78,
-    0xFD,
-    0x3E,
-    0x9A,
-    0x81,
-    0x01,
-    0x00,
-    0x84,
-    0xE6,
-    0x22,
-    0xEF,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x30,
-    0x60,
-    0x62,
-    0x80,
-    0x80,
-    0x0B,
-    0xEB,
-    0x19,
-    0x21,
-    0x8C,
-    0xCF,
-    0xFF,
-    0xFB,
-    0xA1,
-    0xAC,
-    0x6D,
-    0xFF,
-    0xFD,
-    0xA1,
-    0x92,
-    0x85,
-    0xBA,
-    0x0C,
-    0x38,
-    0xC0,
-    0x8F,
-    0xFF,
-    0x2C,
-    0x10,
-    0xC6,
-    0xDF,
-    0xFF,
-    0x9C,
-    0x60,
-    0x5A,
-    0xE1,
-    0xFF,
-    0x5F,
-    0x3E,
-    0x30,
-    0xA3,
-    0xE1,
-    0xFF,
-    0x57,
-    0x7B,
-    0xA8,
-    0xC9,
-    0x1F,
-    0xE6,
-    0x83,
-    0x19,
-    0x9F,
-    0xE2,
-    0x37,
-    0xBC,
-    0x07,
-    0x33,
-    0xBE,
-    0xCB,
-    0x27,
-    0xFC,
-    0x67,
-    0x06,
-    0x31,
-    0xFE,
-    0x70,
-    0x2B,
-    0xFC,
-    0xE7,
-    0x00,
-    0xD2,
-    0x02,
-    0xFF,
-    0xD9,
-    0x18,
-    0xFE,
-    0xF2,
-    0x02,
-    0x19,
-    0x05,
-    0xFF,
-    0x99,
-    0x18,
-    0x7E,
-    0xE8,
-    0x03,
-    0x19,
-    0x07,
-    0xEE,
-    0x03,
-    0x5D,
-    0x52,
-    0x0F,
-    0x64,
-    0x7C,
-    0xEC,
-    0x67,
-    0x60,
-    0x78,
-    0x00,
-    0xE4,
-    0x30,
-    0x7C,
-    0xAB,
-    0x77,
-    0x71,
-    0x39,
-    0x02,
-    0x94,
-    0x66,
-    0xF8,
-    0xFD,
-    0x1F,
-    0x04,
-    0xD8,
-    0x81,
-    0x9A,
-    0xC0,
-    0x80,
-    0x87,
-    0x21,
-    0xE1,
-    0x3F,
-    0x2B,
-    0x50,
-    0xFE,
-    0xB7,
-    0x3C,
-    0xC3,
-    0x86,
-    0xFF,
-    0x60,
-    0xD3,
-    0xF3,
-    0x19,
-    0x3E,
-    0xEC,
-    0x07,
-    0xDB,
-    0xB7,
-    0x9F,
-    0xE1,
-    0x6B,
-    0x3E,
-    0xD8,
-    0x05,
-    0xFF,
-    0x19,
-    0x7F,
-    0xC9,
-    0x43,
-    0xDC,
-    0xC4,
-    0x06,
-    0x00,
-    0x9D,
-    0xAA,
-    0x43,
-    0xF9,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x00,
-    0x02,
-    0x56,
-    0x06,
-    0x08,
-    0x78,
-    0xE6,
-    0x0F,
-    0xA1,
-    0xAF,
-    0xFE,
-    0x9F,
-    0x0F,
-    0xA6,
-    0x0F,
-    0xFC,
-    0xEF,
-    0x63,
-    0x02,
-    0x33,
-    0x26,
-    0x78,
-    0x31,
-    0xE0,
-    0x04,
-    0x3F,
-    0xFE,
-    0xB3,
-    0x40,
-    0x18,
-    0x7F,
-    0xFF,
-    0x73,
-    0x82,
-    0x69,
-    0x85,
-    0xFF,
-    0x7F,
-    0xF9,
-    0xC0,
-    0x8C,
-    0x86,
-    0xFF,
-    0x5F,
-    0xED,
-    0xC1,
-    0x8C,
-    0x0B,
-    0xEB,
-    0x3F,
-    0x40,
-    0x0C,
-    0xFC,
-    0x14,
-    0xBF,
-    0xE1,
-    0x3D,
-    0x98,
-    0xF1,
-    0x5D,
-    0x3E,
-    0xE1,
-    0x3F,
-    0x33,
-    0x88,
-    0xF1,
-    0x87,
-    0x5B,
-    0xE1,
-    0x3F,
-    0x07,
-    0x90,
-    0x16,
-    0xF8,
-    0xCF,
-    0xC6,
-    0xF0,
-    0x97,
-    0x17,
-    0xC8,
-    0x28,
-    0xF8,
-    0xCF,
-    0xC4,
-    0xF0,
-    0x43,
-    0x1F,
-    0x64,
-    0xF9,
-    0x7D,
-    0x06,
-    0x86,
-    0xCF,
-    0xF5,
-    0x40,
-    0xC6,
-    0xC7,
-    0x7E,
-    0x06,
-    0x86,
-    0x07,
-    0x40,
-    0x0E,
-    0xC3,
-    0xB7,
-    0x7A,
-    0x17,
-    0x97,
-    0x23,
-    0x40,
-    0x69,
-    0x86,
-    0xDF,
-    0xFF,
-    0x41,
-    0x80,
-    0x1D,
-    0xA8,
-    0x09,
-    0x0C,
-    0x78,
-    0x18,
-    0x12,
-    0xFE,
-    0x83,
-    0xBC,
-    0xF0,
-    0x5B,
-    0x9E,
-    0x61,
-    0xC3,
-    0x7F,
-    0xB0,
-    0xE9,
-    0xF9,
-    0x0C,
-    0x1F,
-    0xF6,
-    0x83,
-    0xED,
-    0xDB,
-    0xCF,
-    0xF0,
-    0x35,
-    0x1F,
-    0xEC,
-    0x82,
-    0xFF,
-    0x8C,
-    0xBF,
-    0xE4,
-    0x21,
-    0x6E,
-    0x62,
-    0x03,
-    0x00,
-    0x8E,
-    0xFC,
-    0x43,
-    0xF9,
-    0x78,
-    0x9C,
-    0x6D,
-    0x8E,
-    0xCD,
-    0x11,
-    0xC1,
-    0x50,
-    0x14,
-    0x85,
-    0x4F,
-    0x82,
-    0x60,
-    0xFC,
-    0x8C,
-    0x85,
-    0x7D,
-    0x52,
-    0x01,
-    0x3A,
-    0xB0,
-    0x49,
-    0x1F,
-    0xD2,
-    0x41,
-    0x74,
-    0x10,
-    0x1D,
-    0x28,
-    0x41,
-    0x09,
-    0x49,
-    0x07,
-    0xB1,
-    0xB0,
-    0xA7,
-    0x03,
-    0x66,
-    0x8C,
-    0x75,
-    0x82,
-    0x09,
-    0x21,
-    0x32,
-    0xC7,
-    0x7D,
-    0xD7,
-    0xD6,
-    0xD9,
-    0x9C,
-    0xEF,
-    0xFE,
-    0xBD,
-    0x77,
-    0x00,
-    0x9C,
-    0xF7,
-    0x16,
-    0x8C,
-    0x02,
-    0x72,
-    0xA2,
-    0x50,
-    0xA6,
-    0x17,
-    0x36,
-    0xC5,
-    0x67,
-    0x99,
-    0x83,
-    0xD7,
-    0xD0,
-    0x74,
-    0xC6,
-    0x52,
-    0xD8,
-    0xF8,
-    0xAF,
-    0x52,
-    0x77,
-    0x45,
-    0x35,
-    0xBB,
-    0xEA,
-    0x1E,
-    0x6B,
-    0x3D,
-    0xC2,
-    0x8A,
-    0xC5,
-    0x5C,
-    0xE1,
-    0x10,
-    0xE7,
-    0x1B,
-    0x85,
-    0xDB,
-    0x22,
-    0xC9,
-    0x14,
-    0x9E,
-    0x6E,
-    0xC0,
-    0x86,
-    0x81,
-    0x4F,
-    0xCF,
-    0x63,
-    0x47,
-    0x7C,
-    0x44,
-    0x07,
-    0xF5,
-    0x40,
-    0x60,
-    0x49,
-    0x1B,
-    0xE5,
-    0x54,
-    0x60,
-    0x7B,
-    0x04,
-    0xEE,
-    0x91,
-    0xC0,
-    0x75,
-    0x0D,
-    0x9C,
-    0xA4,
-    0xC0,
-    0x23,
-    0xF2,
-    0xFD,
-    0x9D,
-    0x8C,
-    0x51,
-    0xD1,
-    0xA8,
-    0x2D,
-    0x47,
-    0xAA,
-    0xBE,
-    0x44,
-    0x6F,
-    0xC9,
-    0xBC,
-    0x72,
-    0x91,
-    0x50,
-    0x5F,
-    0x0F,
-    0x91,
-    0xA7,
-    0xFA,
-    0x5F,
-    0x8A,
-    0x22,
-    0xD4,
-    0x04,
-    0xB4,
-    0xDE,
-    0xEE,
-    0x2F,
-    0x93,
-    0xF3,
-    0x05,
-    0xC7,
-    0x0E,
-    0x47,
-    0x73,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x10,
-    0x62,
-    0x80,
-    0x80,
-    0x4B,
-    0xFF,
-    0xBD,
-    0x9F,
-    0xCA,
-    0x00,
-    0x69,
-    0x81,
-    0x7F,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xE7,
-    0x02,
-    0x32,
-    0x0C,
-    0x66,
-    0x1B,
-    0xBE,
-    0x9C,
-    0xC7,
-    0x40,
-    0x08,
-    0xFC,
-    0xF8,
-    0xCF,
-    0x02,
-    0x61,
-    0xFC,
-    0xFD,
-    0xCF,
-    0x09,
-    0xA6,
-    0x15,
-    0xFE,
-    0xFF,
-    0xE5,
-    0x03,
-    0x33,
-    0x1A,
-    0xFE,
-    0x7F,
-    0xB5,
-    0x07,
-    0x33,
-    0x2E,
-    0xAC,
-    0xFF,
-    0x30,
-    0x1F,
-    0xCC,
-    0xF8,
-    0x14,
-    0xBF,
-    0xE1,
-    0x3D,
-    0x98,
-    0xF1,
-    0x5D,
-    0x3E,
-    0xE1,
-    0x3F,
-    0x33,
-    0x88,
-    0xF1,
-    0x87,
-    0x5B,
-    0xE1,
-    0x3F,
-    0x07,
-    0xC8,
-    0xD2,
-    0xFF,
-    0x6C,
-    0x0C,
-    0x7F,
-    0x79,
-    0x81,
-    0x8C,
-    0x82,
-    0xFF,
-    0x4C,
-    0x0C,
-    0x3F,
-    0xF4,
-    0x81,
-    0x8C,
-    0x03,
-    0xF7,
-    0x19,
-    0x18,
-    0x3E,
-    0xD7,
-    0x03,
-    0x19,
-    0x1F,
-    0xFB,
-    0x19,
-    0x18,
-    0x1E,
-    0x00,
-    0x39,
-    0x0C,
-    0xDF,
-    0xEA,
-    0x5D,
-    0x5C,
-    0x8E,
-    0x00,
-    0xA5,
-    0x19,
-    0x7E,
-    0xFF,
-    0x07,
-    0x01,
-    0x76,
-    0xA0,
-    0x26,
-    0x30,
-    0xE0,
-    0x61,
-    0x48,
-    0xF8,
-    0xCF,
-    0x0A,
-    0x94,
-    0xFF,
-    0x2D,
-    0xCF,
-    0xB0,
-    0xE1,
-    0x3F,
-    0xD8,
-    0xF4,
-    0x7C,
-    0x86,
-    0x0F,
-    0xFB,
-    0xC1,
-    0xF6,
-    0xED,
-    0x67,
-    0xF8,
-    0x9A,
-    0x0F,
-    0x76,
-    0xC1,
-    0x7F,
-    0xC6,
-    0x5F,
-    0xF2,
-    0x10,
-    0x37,
-    0xB1,
-    0x01,
-    0x00,
-    0x3A,
-    0x08,
-    0x46,
-    0xEA,
-    0x78,
-    0x9C,
-    0x63,
-    0x10,
-    0xF8,
-    0xC3,
-    0xCE,
-    0xF0,
-    0x9B,
-    0x93,
-    0x81,
-    0x81,
-    0x21,
-    0xE0,
-    0x3F,
-    0x9F,
-    0xC1,
-    0x7F,
-    0x7E,
-    0x20,
-    0x03,
-    0x2E,
-    0x82,
-    0x17,
-    0xFC,
-    0xF8,
-    0xCF,
-    0x02,
-    0x61,
-    0xFC,
-    0xFD,
-    0x0F,
-    0x51,
-    0xAB,
-    0xF0,
-    0xFF,
-    0x2F,
-    0x1F,
-    0x98,
-    0xD1,
-    0xF0,
-    0xFF,
-    0xAB,
-    0x3D,
-    0x98,
-    0x71,
-    0x61,
-    0xFD,
-    0x87,
-    0xF9,
-    0x60,
-    0xC6,
-    0xA7,
-    0xF8,
-    0x0D,
-    0xEF,
-    0xC1,
-    0x8C,
-    0xEF,
-    0xF2,
-    0x09,
-    0xFF,
-    0x99,
-    0x41,
-    0x8C,
-    0x3F,
-    0xDC,
-    0x0A,
-    0xFF,
-    0x39,
-    0x40,
-    0x76,
-    0xFD,
-    0x67,
-    0x63,
-    0xF8,
-    0xCB,
-    0x0B,
-    0x64,
-    0x14,
-    0xFC,
-    0x67,
-    0x62,
-    0xF8,
-    0xA1,
-    0x0F,
-    0x64,
-    0x1C,
-    0xB8,
-    0xCF,
-    0xC0,
-    0xF0,
-    0xB9,
-    0x1E,
-    0xC8,
-    0xF8,
-    0xD8,
-    0xCF,
-    0xC0,
-    0xF0,
-    0x00,
-    0xC8,
-    0x61,
-    0xF8,
-    0x56,
-    0xEF,
-    0xE2,
-    0x72,
-    0x04,
-    0x28,
-    0xCD,
-    0xF0,
-    0xFB,
-    0x3F,
-    0x08,
-    0xB0,
-    0x03,
-    0x35,
-    0x81,
-    0x01,
-    0x0F,
-    0x43,
-    0xC2,
-    0x7F,
-    0x56,
-    0xA0,
-    0xFC,
-    0x6F,
-    0x79,
-    0x86,
-    0x0D,
-    0xFF,
-    0xC1,
-    0xA6,
-    0xE7,
-    0x33,
-    0x7C,
-    0xD8,
-    0x0F,
-    0xB6,
-    0x6F,
-    0x3F,
-    0xC3,
-    0xD7,
-    0x7C,
-    0xB0,
-    0x0B,
-    0xFE,
-    0x33,
-    0xFE,
-    0x92,
-    0x87,
-    0xB8,
-    0x89,
-    0x0D,
-    0x00,
-    0x9C,
-    0xF8,
-    0x43,
-    0xEC,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0xB8,
-    0x76,
-    0x9E,
-    0x85,
-    0x01,
-    0x04,
-    0x0A,
-    0xFA,
-    0x37,
-    0xDB,
-    0x83,
-    0x19,
-    0x17,
-    0xF8,
-    0x14,
-    0xE6,
-    0xA3,
-    0x32,
-    0x1A,
-    0xE2,
-    0x27,
-    0xF8,
-    0x83,
-    0x19,
-    0x0C,
-    0x3F,
-    0xFF,
-    0xB3,
-    0x43,
-    0x18,
-    0x0C,
-    0x4C,
-    0x0C,
-    0xB8,
-    0xC0,
-    0x8F,
-    0xFF,
-    0x10,
-    0x03,
-    0x19,
-    0xFE,
-    0xFE,
-    0xE7,
-    0x04,
-    0xD3,
-    0x0A,
-    0xFF,
-    0xFF,
-    0xF2,
-    0x41,
-    0xCC,
-    0xF9,
-    0xFF,
-    0x15,
-    0x6A,
-    0xC5,
-    0xFA,
-    0x0F,
-    0x10,
-    0x93,
-    0x3F,
-    0xC5,
-    0x6F,
-    0x78,
-    0x0F,
-    0x66,
-    0x7C,
-    0x97,
-    0x4F,
-    0xF8,
-    0xCF,
-    0x0C,
-    0x62,
-    0xFC,
-    0xE1,
-    0x56,
-    0xF8,
-    0xCF,
-    0x01,
-    0xA4,
-    0x05,
-    0xFE,
-    0xB3,
-    0x31,
-    0xFC,
-    0xE5,
-    0x05,
-    0xB9,
-    0xEB,
-    0x3F,
-    0x13,
-    0xC3,
-    0x0F,
-    0x7D,
-    0x20,
-    0xE3,
-    0xC0,
-    0x7D,
-    0x06,
-    0x86,
-    0xCF,
-    0xF5,
-    0x40,
-    0xC6,
-    0xC7,
-    0x7E,
-    0x06,
-    0x86,
-    0x07,
-    0x40,
-    0x0E,
-    0xC3,
-    0xB7,
-    0x7A,
-    0x17,
-    0x97,
-    0x23,
-    0x40,
-    0x69,
-    0x86,
-    0xDF,
-    0xFF,
-    0x41,
-    0x80,
-    0x1D,
-    0xA8,
-    0x09,
-    0x0C,
-    0x78,
-    0x18,
-    0x12,
-    0xFE,
-    0xB3,
-    0x02,
-    0xE5,
-    0x7F,
-    0xCB,
-    0x33,
-    0x6C,
-    0xF8,
-    0x0F,
-    0x36,
-    0x3D,
-    0x9F,
-    0xE1,
-    0xC3,
-    0x7E,
-    0xB0,
-    0x7D,
-    0xFB,
-    0x19,
-    0xBE,
-    0xE6,
-    0x83,
-    0x5D,
-    0xF0,
-    0x9F,
-    0xF1,
-    0x97,
-    0x3C,
-    0xC4,
-    0x4D,
-    0x6C,
-    0x00,
-    0x6E,
-    0x53,
-    0x47,
-    0xB6,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0xF8,
-    0xF9,
-    0x1F,
-    0x0C,
-    0x18,
-    0x40,
-    0xE0,
-    0x1F,
-    0x98,
-    0x79,
-    0x1F,
-    0xC4,
-    0x0C,
-    0xF8,
-    0xFF,
-    0xC7,
-    0xD6,
-    0xD8,
-    0xD8,
-    0x58,
-    0x19,
-    0xC4,
-    0x3E,
-    0xB0,
-    0xFF,
-    0x3B,
-    0x3F,
-    0x03,
-    0x14,
-    0x7C,
-    0x8A,
-    0xFF,
-    0xEC,
-    0x0F,
-    0x63,
-    0xFF,
-    0xE0,
-    0xFB,
-    0xD0,
-    0x0F,
-    0x63,
-    0xFF,
-    0xE3,
-    0x3C,
-    0x70,
-    0x1E,
-    0xCA,
-    0x0C,
-    0xF8,
-    0xCF,
-    0xDC,
-    0xF0,
-    0x1F,
-    0xCA,
-    0x3E,
-    0x70,
-    0x1F,
-    0xC8,
-    0x35,
-    0x85,
-    0x98,
-    0xF3,
-    0xA9,
-    0x9E,
-    0x41,
-    0x00,
-    0x64,
-    0x3E,
-    0x48,
-    0xDD,
-    0x0F,
-    0x79,
-    0x06,
-    0x86,
-    0xBF,
-    0x50,
-    0xF6,
-    0x3F,
-    0x6E,
-    0x06,
-    0x86,
-    0x5F,
-    0xFC,
-    0x50,
-    0xAD,
-    0xE6,
-    0xC6,
-    0xC6,
-    0x3F,
-    0x20,
-    0x16,
-    0x1C,
-    0x00,
-    0x3B,
-    0x06,
-    0x62,
-    0xC1,
-    0xA7,
-    0xFF,
-    0x30,
-    0x8D,
-    0x40,
-    0xAD,
-    0xFA,
-    0x40,
-    0x62,
-    0x03,
-    0xD4,
-    0xC1,
-    0x3C,
-    0x40,
-    0xA2,
-    0xE0,
-    0x3F,
-    0x0B,
-    0x58,
-    0x2B,
-    0x1B,
-    0x90,
-    0x34,
-    0xF8,
-    0x6F,
-    0x69,
-    0x6C,
-    0xCC,
-    0xBC,
-    0xE1,
-    0x3F,
-    0x23,
-    0x48,
-    0x16,
-    0xA4,
-    0xC7,
-    0xFE,
-    0xD3,
-    0x7A,
-    0xB0,
-    0xCA,
-    0x3F,
-    0x20,
-    0x36,
-    0x00,
-    0x39,
-    0x7B,
-    0x54,
-    0x74,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x30,
-    0xB8,
-    0xF9,
-    0x7F,
-    0x1D,
-    0x0B,
-    0x03,
-    0x03,
-    0xC3,
-    0xCF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x67,
-    0x62,
-    0xD8,
-    0xF0,
-    0xBF,
-    0xCE,
-    0xE4,
-    0xD8,
-    0x7B,
-    0x46,
-    0x86,
-    0x1F,
-    0xFB,
-    0x81,
-    0x62,
-    0x6E,
-    0x0C,
-    0x02,
-    0xFF,
-    0x79,
-    0x19,
-    0x40,
-    0xA0,
-    0xE1,
-    0x3F,
-    0x2B,
-    0x98,
-    0xBE,
-    0xF0,
-    0x1F,
-    0x4C,
-    0x31,
-    0x7C,
-    0xBC,
-    0x0F,
-    0xA1,
-    0xBF,
-    0xAC,
-    0x87,
-    0xD0,
-    0x5F,
-    0xE7,
-    0x43,
-    0xE8,
-    0x6F,
-    0xFD,
-    0xA8,
-    0x7C,
-    0x98,
-    0xFC,
-    0xA7,
-    0xF3,
-    0x10,
-    0xFA,
-    0x01,
-    0x54,
-    0xFF,
-    0x82,
-    0xFF,
-    0x2C,
-    0x60,
-    0x3A,
-    0xE0,
-    0x3F,
-    0x0F,
-    0x44,
-    0xE0,
-    0x0F,
-    0x48,
-    0x43,
-    0x12,
-    0x50,
-    0xE1,
-    0x7F,
-    0x6F,
-    0x86,
-    0x66,
-    0xA0,
-    0xA4,
-    0xC3,
-    0x7F,
-    0x10,
-    0x00,
-    0x5A,
-    0xBA,
-    0x10,
-    0x48,
-    0x69,
-    0x83,
-    0x54,
-    0x38,
-    0xFC,
-    0x13,
-    0x81,
-    0x28,
-    0xFD,
-    0xCF,
-    0x04,
-    0xA6,
-    0x04,
-    0xFE,
-    0x9F,
-    0x67,
-    0x04,
-    0x33,
-    0x14,
-    0xFE,
-    0x70,
-    0x80,
-    0xA8,
-    0x04,
-    0xE7,
-    0xBF,
-    0x5C,
-    0x60,
-    0xAB,
-    0xFF,
-    0x43,
-    0xDC,
-    0xBA,
-    0xF9,
-    0x5F,
-    0x0C,
-    0x03,
-    0x03,
-    0x00,
-    0xE9,
-    0xDA,
-    0x3D,
-    0x33,
-    0x78,
-    0x9C,
-    0x63,
-    0x50,
-    0x60,
-    0x66,
-    0x00,
-    0x81,
-    0x0D,
-    0xEB,
-    0x99,
-    0x40,
-    0xD4,
-    0xA7,
-    0xFF,
-    0xF3,
-    0x19,
-    0x41,
-    0xF4,
-    0xD6,
-    0xFF,
-    0xF1,
-    0x60,
-    0xE1,
-    0x44,
-    0x1B,
-    0x06,
-    0x34,
-    0xF0,
-    0xF1,
-    0x3F,
-    0x10,
-    0xEC,
-    0x87,
-    0x50,
-    0xF3,
-    0x19,
-    0x3E,
-    0xEE,
-    0x37,
-    0x36,
-    0x36,
-    0x16,
-    0x06,
-    0x52,
-    0x10,
-    0x39,
-    0xBC,
-    0x14,
-    0x50,
-    0x25,
-    0x23,
-    0x44,
-    0x1F,
-    0x3B,
-    0x9C,
-    0x22,
-    0x46,
-    0x1F,
-    0x42,
-    0xBB,
-    0x31,
-    0x44,
-    0xDF,
-    0x7F,
-    0x18,
-    0x05,
-    0x00,
-    0xDA,
-    0x9D,
-    0x41,
-    0x70,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x60,
-    0x65,
-    0x00,
-    0x81,
-    0xAB,
-    0xF1,
-    0x20,
-    0xF2,
-    0xC8,
-    0xFF,
-    0xF5,
-    0x40,
-    0x72,
-    0xC3,
-    0xFF,
-    0x79,
-    0xCC,
-    0x40,
-    0xAA,
-    0xC1,
-    0x8B,
-    0x01,
-    0x03,
-    0x7C,
-    0xFC,
-    0x0F,
-    0x04,
-    0xFB,
-    0x21,
-    0xD4,
-    0x7C,
-    0x86,
-    0x8F,
-    0xFB,
-    0x8D,
-    0x8D,
-    0x8D,
-    0x85,
-    0x81,
-    0x14,
-    0x44,
-    0x0E,
-    0x2F,
-    0x05,
-    0x54,
-    0xC9,
-    0x08,
-    0xD1,
-    0xC7,
-    0x0E,
-    0xA7,
-    0x88,
-    0xD1,
-    0x87,
-    0xD0,
-    0x6E,
-    0x0C,
-    0xD1,
-    0xF7,
-    0x1F,
-    0x46,
-    0x01,
-    0x00,
-    0xD1,
-    0xA6,
-    0x41,
-    0x70,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x78,
-    0x74,
-    0x9E,
-    0x91,
-    0x81,
-    0x81,
-    0x21,
-    0xE0,
-    0xFF,
-    0x7F,
-    0x3B,
-    0x20,
-    0xF5,
-    0xFD,
-    0xFC,
-    0xD5,
-    0xFF,
-    0xAC,
-    0x0C,
-    0x0A,
-    0xFF,
-    0xD9,
-    0x19,
-    0x7E,
-    0xC8,
-    0x31,
-    0x30,
-    0xA8,
-    0x30,
-    0x30,
-    0x18,
-    0x30,
-    0x33,
-    0xA0,
-    0x82,
-    0x8F,
-    0xFF,
-    0x81,
-    0x60,
-    0x3F,
-    0x84,
-    0x9A,
-    0xCF,
-    0xF0,
-    0x71,
-    0xBF,
-    0xB1,
-    0xB1,
-    0xB1,
-    0x30,
-    0x90,
-    0x82,
-    0xC8,
-    0xE1,
-    0xA5,
-    0x80,
-    0x2A,
-    0x19,
-    0x21,
-    0xFA,
-    0xD8,
-    0xE1,
-    0x14,
-    0x31,
-    0xFA,
-    0x10,
-    0xDA,
-    0x8D,
-    0x21,
-    0xFA,
-    0xFE,
-    0xC3,
-    0x28,
-    0x00,
-    0x72,
-    0x4D,
-    0x45,
-    0x1B,
-    0x78,
-    0x9C,
-    0x63,
-    0xF8,
-    0xCD,
-    0xC1,
-    0xF0,
-    0x8B,
-    0x8B,
-    0xC1,
-    0xE0,
-    0x3F,
-    0xBF,
-    0xC0,
-    0x7F,
-    0x7D,
-    0x06,
-    0x06,
-    0x08,
-    0x0F,
-    0x2B,
-    0xF8,
-    0xF8,
-    0x1F,
-    0x08,
-    0xF6,
-    0x43,
-    0xA8,
-    0xF9,
-    0x0C,
-    0x1F,
-    0xF7,
-    0x1B,
-    0x1B,
-    0x1B,
-    0x0B,
-    0x03,
-    0x29,
-    0x88,
-    0x1C,
-    0x5E,
-    0x0A,
-    0xA8,
-    0x92,
-    0x11,
-    0xA2,
-    0x8F,
-    0x1D,
-    0x4E,
-    0x11,
-    0xA3,
-    0x0F,
-    0xA1,
-    0xDD,
-    0x18,
-    0xA2,
-    0xEF,
-    0x3F,
-    0x8C,
-    0x02,
-    0x00,
-    0xBC,
-    0x4E,
-    0x41,
-    0x35,
-    0x78,
-    0x9C,
-    0x73,
-    0x60,
-    0x62,
-    0x60,
-    0x78,
-    0x30,
-    0x9F,
-    0x91,
-    0xE1,
-    0xCB,
-    0xFF,
-    0x7E,
-    0x06,
-    0x81,
-    0x63,
-    0xFF,
-    0xED,
-    0x18,
-    0x18,
-    0x8A,
-    0x64,
-    0x18,
-    0x60,
-    0xE0,
-    0xE3,
-    0x7E,
-    0xAA,
-    0x62,
-    0x00,
-    0xFE,
-    0xFB,
-    0x28,
-    0xA6,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x65,
-    0x60,
-    0x78,
-    0x66,
-    0xCF,
-    0xF0,
-    0xF4,
-    0x7F,
-    0xFF,
-    0x85,
-    0xFF,
-    0xBD,
-    0x4C,
-    0x0B,
-    0x2C,
-    0x19,
-    0x10,
-    0xE0,
-    0xE3,
-    0x7E,
-    0xAA,
-    0x62,
-    0x00,
-    0xEF,
-    0x75,
-    0x28,
-    0x95,
-    0x78,
-    0x9C,
-    0x63,
-    0x70,
-    0xF8,
-    0xC7,
-    0xCD,
-    0xC0,
-    0xC0,
-    0xF0,
-    0xFD,
-    0xFF,
-    0x7D,
-    0x26,
-    0x86,
-    0x09,
-    0xFF,
-    0xB3,
-    0xFE,
-    0xF9,
-    0x31,
-    0x7C,
-    0x89,
-    0x63,
-    0x58,
-    0x78,
-    0x9F,
-    0x21,
-    0x80,
-    0x91,
-    0x81,
-    0x41,
-    0x85,
-    0x01,
-    0x05,
-    0x08,
-    0xFC,
-    0xE7,
-    0x1E,
-    0x08,
-    0x12,
-    0x00,
-    0x78,
-    0x1F,
-    0x20,
-    0xB5,
-    0x78,
-    0x9C,
-    0x3B,
-    0x98,
-    0xCF,
-    0x70,
-    0xA0,
-    0x9F,
-    0xE1,
-    0xDB,
-    0x7D,
-    0x86,
-    0x2F,
-    0xFF,
-    0x19,
-    0x2E,
-    0x82,
-    0xD9,
-    0x58,
-    0x80,
-    0xC0,
-    0x7F,
-    0xEE,
-    0x81,
-    0x20,
-    0x01,
-    0x5C,
-    0xF5,
-    0x1E,
-    0xDF,
-    0x78,
-    0x9C,
-    0x63,
-    0xD8,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xBD,
-    0x6A,
-    0x46,
-    0x06,
-    0x06,
-    0x06,
-    0x20,
-    0xE3,
-    0xFF,
-    0xFF,
-    0xF5,
-    0x8C,
-    0x20,
-    0x86,
-    0xB1,
-    0xF3,
-    0x8D,
-    0xFF,
-    0x76,
-    0x20,
-    0x06,
-    0x50,
-    0xF8,
-    0xFB,
-    0x7B,
-    0x46,
-    0x08,
-    0x63,
-    0xC1,
-    0x7F,
-    0x0E,
-    0x08,
-    0x43,
-    0xE0,
-    0x3F,
-    0x1F,
-    0x84,
-    0xC1,
-    0xF0,
-    0x47,
-    0x1F,
-    0xCA,
-    0xF8,
-    0x19,
-    0x6F,
-    0x78,
-    0xF8,
-    0xBF,
-    0xB1,
-    0x31,
-    0x23,
-    0xC3,
-    0xF7,
-    0xFC,
-    0x6F,
-    0x20,
-    0x63,
-    0xB8,
-    0x18,
-    0xBE,
-    0xF5,
-    0x43,
-    0x19,
-    0xDF,
-    0xEB,
-    0xA1,
-    0x6A,
-    0xBE,
-    0xE7,
-    0xC3,
-    0x15,
-    0x43,
-    0x19,
-    0x7F,
-    0xE5,
-    0x21,
-    0x0C,
-    0x85,
-    0xFF,
-    0xBC,
-    0x10,
-    0xC6,
-    0x86,
-    0xFF,
-    0x6C,
-    0x10,
-    0xC6,
-    0xAF,
-    0xF3,
-    0x10,
-    0x67,
-    0xBC,
-    0xF8,
-    0x2F,
-    0x0B,
-    0x75,
-    0xD8,
-    0x7C,
-    0x88,
-    0x0B,
-    0xDF,
-    0x83,
-    0x9C,
-    0x0A,
-    0x00,
-    0xC7,
-    0x4E,
-    0x4E,
-    0x16,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x62,
-    0x00,
-    0x83,
-    0xC7,
-    0xFF,
-    0xBD,
-    0x9E,
-    0x72,
-    0x33,
-    0x30,
-    0x08,
-    0xFC,
-    0xFB,
-    0xFF,
-    0xFF,
-    0x3F,
-    0x07,
-    0x03,
-    0x83,
-    0x41,
-    0x8F,
-    0xE1,
-    0xAB,
-    0x3E,
-    0x06,
-    0x9C,
-    0xE0,
-    0xE3,
-    0x7F,
-    0x1E,
-    0x20,
-    0xF9,
-    0x93,
-    0xFF,
-    0xE3,
-    0x7F,
-    0x7F,
-    0x28,
-    0xBD,
-    0x1F,
-    0x42,
-    0xDF,
-    0xFF,
-    0xCF,
-    0x0C,
-    0xA6,
-    0xEB,
-    0xFF,
-    0x73,
-    0x83,
-    0xE9,
-    0xF8,
-    0xDF,
-    0xF6,
-    0x60,
-    0x3A,
-    0xFF,
-    0xCB,
-    0x7A,
-    0x08,
-    0x7D,
-    0xE0,
-    0x3F,
-    0x13,
-    0x58,
-    0xDE,
-    0xE1,
-    0x3F,
-    0x17,
-    0x98,
-    0x66,
-    0xF8,
-    0xA3,
-    0x0F,
-    0xA2,
-    0xFB,
-    0x19,
-    0xBE,
-    0xCE,
-    0x87,
-    0xD0,
-    0x17,
-    0xFE,
-    0x33,
-    0x82,
-    0xE9,
-    0x80,
-    0xFF,
-    0x9C,
-    0x3F,
-    0x40,
-    0x34,
-    0xC3,
-    0x5F,
-    0x79,
-    0x08,
-    0xFD,
-    0xB5,
-    0xFF,
-    0x3B,
-    0x98,
-    0xBE,
-    0xF0,
-    0x1F,
-    0x42,
-    0x27,
-    0xFC,
-    0xFF,
-    0x03,
-    0xA6,
-    0x19,
-    0xFE,
-    0xFD,
-    0x87,
-    0xD0,
-    0xDF,
-    0xA0,
-    0xF4,
-    0x83,
-    0xFF,
-    0xFC,
-    0x00,
-    0xE6,
-    0x1A,
-    0x54,
-    0xDC,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x10,
-    0x65,
-    0x80,
-    0x00,
-    0x85,
-    0xFF,
-    0xEC,
-    0x10,
-    0x46,
-    0xC1,
-    0xFF,
-    0xF7,
-    0x6C,
-    0x10,
-    0x56,
-    0xE1,
-    0xDF,
-    0xFB,
-    0x8C,
-    0x10,
-    0x96,
-    0xC1,
-    0x4E,
-    0x06,
-    0xEC,
-    0xC0,
-    0xE0,
-    0xE6,
-    0xFF,
-    0x75,
-    0xAC,
-    0x40,
-    0x5A,
-    0xE0,
-    0xD7,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xCF,
-    0x33,
-    0x31,
-    0x30,
-    0x5C,
-    0xF8,
-    0x9F,
-    0x6B,
-    0xBC,
-    0xF5,
-    0xBF,
-    0x1E,
-    0x03,
-    0xC3,
-    0xAF,
-    0xF9,
-    0x40,
-    0xE1,
-    0xAF,
-    0xF7,
-    0x19,
-    0x0C,
-    0xFE,
-    0xF3,
-    0x00,
-    0x19,
-    0x0D,
-    0xFF,
-    0xD9,
-    0x17,
-    0xFC,
-    0x67,
-    0x01,
-    0x29,
-    0xFC,
-    0xCF,
-    0xFB,
-    0xE1,
-    0x3D,
-    0x58,
-    0xEB,
-    0x1F,
-    0xFD,
-    0x4F,
-    0xFB,
-    0xC1,
-    0x8C,
-    0x9F,
-    0xF1,
-    0x5F,
-    0xE6,
-    0x83,
-    0x19,
-    0xDF,
-    0xFA,
-    0xBF,
-    0xE2,
-    0x66,
-    0x7C,
-    0x86,
-    0x28,
-    0xFE,
-    0x11,
-    0x0F,
-    0xD5,
-    0xFE,
-    0x5B,
-    0x7F,
-    0xC3,
-    0x7F,
-    0x66,
-    0x88,
-    0x81,
-    0x0E,
-    0xFF,
-    0xB9,
-    0x21,
-    0x56,
-    0x30,
-    0xFC,
-    0x86,
-    0x5A,
-    0xCA,
-    0x70,
-    0x11,
-    0xE6,
-    0x0C,
-    0x81,
-    0xDF,
-    0x50,
-    0x87,
-    0x31,
-    0x38,
-    0xDC,
-    0x02,
-    0x3B,
-    0x15,
-    0x00,
-    0x50,
-    0x47,
-    0x49,
-    0x33,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x00,
-    0x02,
-    0x47,
-    0x06,
-    0x08,
-    0x68,
-    0x7C,
-    0x0F,
-    0xA1,
-    0x0B,
-    0xFE,
-    0xFF,
-    0x67,
-    0x05,
-    0xD1,
-    0x0A,
-    0xFF,
-    0xCE,
-    0x8B,
-    0x43,
-    0x44,
-    0x7A,
-    0x98,
-    0x18,
-    0x70,
-    0x00,
-    0x83,
-    0x9B,
-    0xFF,
-    0xD7,
-    0x81,
-    0x14,
-    0x0B,
-    0xFC,
-    0xFA,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x79,
-    0xA0,
-    0xB2,
-    0x0B,
-    0xFF,
-    0x73,
-    0x8D,
-    0xB7,
-    0xFE,
-    0xD7,
-    0x63,
-    0x60,
-    0xF8,
-    0x35,
-    0x1F,
-    0x28,
-    0xFC,
-    0xF5,
-    0x3E,
-    0x83,
-    0xC1,
-    0x7F,
-    0x1E,
-    0x20,
-    0xA3,
-    0xE1,
-    0x3F,
-    0xFB,
-    0x82,
-    0xFF,
-    0x2C,
-    0x20,
-    0x85,
-    0xFF,
-    0x79,
-    0x3F,
-    0x40,
-    0xEC,
-    0xF9,
-    0xA3,
-    0xFF,
-    0x69,
-    0x3F,
-    0x98,
-    0xF1,
-    0x33,
-    0xFE,
-    0xCB,
-    0x7C,
-    0x30,
-    0xE3,
-    0x5B,
-    0xFF,
-    0x57,
-    0xDC,
-    0x8C,
-    0xCF,
-    0x10,
-    0xC5,
-    0x3F,
-    0xE2,
-    0xA1,
-    0xDA,
-    0x7F,
-    0xEB,
-    0x6F,
-    0xF8,
-    0xCF,
-    0x0C,
-    0x31,
-    0xD0,
-    0xE1,
-    0x3F,
-    0x37,
-    0xC4,
-    0x0A,
-    0x86,
-    0xDF,
-    0x50,
-    0x4B,
-    0x19,
-    0x2E,
-    0xC2,
-    0x9C,
-    0x21,
-    0xF0,
-    0x1B,
-    0xEA,
-    0x30,
-    0x06,
-    0x87,
-    0x5B,
-    0x60,
-    0xA7,
-    0x02,
-    0x00,
-    0x41,
-    0x3F,
-    0x49,
-    0x13,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x48,
-    0xF8,
-    0xCF,
-    0xC1,
-    0x00,
-    0x06,
-    0x3F,
-    0xFF,
-    0xEF,
-    0x07,
-    0xD3,
-    0x07,
-    0xFF,
-    0x57,
-    0xFC,
-    0xD7,
-    0x05,
-    0x31,
-    0xBE,
-    0xDB,
-    0x32,
-    0x1C,
-    0x5A,
-    0x0F,
-    0x62,
-    0x04,
-    0x00,
-    0x31,
-    0x2B,
-    0x03,
-    0x56,
-    0x60,
-    0x70,
-    0xF3,
-    0xFF,
-    0x3A,
-    0x90,
-    0x94,
-    0xC0,
-    0xAF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x67,
-    0x62,
-    0x60,
-    0xB8,
-    0xF0,
-    0x3F,
-    0xD7,
-    0x78,
-    0xEB,
-    0x7F,
-    0x3D,
-    0x06,
-    0x86,
-    0x5F,
-    0xF3,
-    0x81,
-    0xC2,
-    0x5F,
-    0xEF,
-    0x33,
-    0x18,
-    0xFC,
-    0xE7,
-    0x01,
-    0x32,
-    0x1A,
-    0xFE,
-    0xB3,
-    0x2F,
-    0xF8,
-    0xCF,
-    0x02,
-    0x52,
-    0xF8,
-    0x9F,
-    0xF7,
-    0xC3,
-    0x7B,
-    0xB0,
-    0xD6,
-    0x3F,
-    0xFA,
-    0x9F,
-    0x20,
-    0x16,
-    0xFE,
-    0x8C,
-    0xFF,
-    0x32,
-    0x1F,
-    0xCC,
-    0xF8,
-    0xD6,
-    0xFF,
-    0x15,
-    0x37,
-    0xE3,
-    0x33,
-    0x44,
-    0xF1,
-    0x8F,
-    0x78,
-    0xA8,
-    0xF6,
-    0xDF,
-    0xFA,
-    0x1B,
-    0xFE,
-    0x33,
-    0x43,
-    0x0C,
-    0x74,
-    0xF8,
-    0xCF,
-    0x0D,
-    0xB1,
-    0x82,
-    0xE1,
-    0x37,
-    0xD4,
-    0x52,
-    0x86,
-    0x8B,
-    0x30,
-    0x67,
-    0x08,
-    0xFC,
-    0x86,
-    0x3A,
-    0x8C,
-    0xC1,
-    0xE1,
-    0x16,
-    0xD8,
-    0xA9,
-    0x00,
-    0xA4,
-    0x4F,
-    0x4C,
-    0xD9,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x50,
-    0x60,
-    0x80,
-    0x80,
-    0x80,
-    0xFF,
-    0xF3,
-    0x8B,
-    0xE7,
-    0x83,
-    0x18,
-    0x5F,
-    0xFE,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x0F,
-    0x62,
-    0x1C,
-    0x65,
-    0xDD,
-    0x7A,
-    0x9F,
-    0x95,
-    0x01,
-    0x3F,
-    0x30,
-    0xB8,
-    0xF9,
-    0x7F,
-    0x1D,
-    0x48,
-    0x8D,
-    0xC0,
-    0x2F,
-    0xA0,
-    0xAE,
-    0xF3,
-    0x4C,
-    0x0C,
-    0x0C,
-    0x17,
-    0xFE,
-    0xE7,
-    0x1A,
-    0x6F,
-    0xFD,
-    0xAF,
-    0xC7,
-    0xC0,
-    0xF0,
-    0x0B,
-    0x64,
-    0xD8,
-    0xD7,
-    0xFB,
-    0x0C,
-    0x06,
-    0xFF,
-    0x79,
-    0x80,
-    0x8C,
-    0x86,
-    0xFF,
-    0xEC,
-    0x0B,
-    0xFE,
-    0xB3,
-    0x80,
-    0x14,
-    0xFE,
-    0xE7,
-    0xFD,
-    0xF0,
-    0x1E,
-    0xAC,
-    0xF5,
-    0x8F,
-    0xFE,
-    0xA7,
-    0xFD,
-    0x60,
-    0xC6,
-    0xCF,
-    0xF8,
-    0x2F,
-    0x60,
-    0x8B,
-    0x19,
-    0xBE,
-    0xF5,
-    0x7F,
-    0xC5,
-    0xCD,
-    0xF8,
-    0x0C,
-    0x51,
-    0xFC,
-    0x23,
-    0x1E,
-    0xAA,
-    0xFD,
-    0xB7,
-    0xFE,
-    0x86,
-    0xFF,
-    0xCC,
-    0x10,
-    0x03,
-    0x1D,
-    0xFE,
-    0x73,
-    0x43,
-    0xAC,
-    0x60,
-    0xF8,
-    0x0D,
-    0xB5,
-    0x94,
-    0xE1,
-    0x22,
-    0xCC,
-    0x19,
-    0x02,
-    0xBF,
-    0xA1,
-    0x0E,
-    0x63,
-    0x70,
-    0xB8,
-    0x05,
-    0x76,
-    0x2A,
-    0x00,
-    0x05,
-    0xCC,
-    0x4C,
-    0x30,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x78,
-    0x6C,
-    0xC7,
-    0x70,
-    0x29,
-    0x8E,
-    0x01,
-    0x08,
-    0x7E,
-    0xAE,
-    0x67,
-    0xF8,
-    0x7E,
-    0x1E,
-    0xC4,
-    0x80,
-    0x8B,
-    0xE0,
-    0x01,
-    0x06,
-    0x37,
-    0xFF,
-    0xAF,
-    0x63,
-    0x05,
-    0xD2,
-    0x02,
-    0xBF,
-    0xFE,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x9E,
-    0x89,
-    0x81,
-    0xE1,
-    0xC2,
-    0xFF,
-    0x5C,
-    0xE3,
-    0xAD,
-    0xFF,
-    0xF5,
-    0x18,
-    0x18,
-    0x7E,
-    0xCD,
-    0x07,
-    0x0A,
-    0x7F,
-    0xBD,
-    0xCF,
-    0x60,
-    0xF0,
-    0x9F,
-    0x07,
-    0xC8,
-    0x68,
-    0xF8,
-    0xCF,
-    0xBE,
-    0xE0,
-    0x3F,
-    0x0B,
-    0x48,
-    0xE1,
-    0x7F,
-    0xDE,
-    0x0F,
-    0xEF,
-    0xC1,
-    0x5A,
-    0xFF,
-    0xE8,
-    0x7F,
-    0xDA,
-    0x0F,
-    0x66,
-    0xFC,
-    0x8C,
-    0xFF,
-    0x32,
-    0x1F,
-    0xCC,
-    0xF8,
-    0xD6,
-    0xFF,
-    0x15,
-    0x37,
-    0xE3,
-    0x33,
-    0x44,
-    0xF1,
-    0x8F,
-    0x78,
-    0xA8,
-    0xF6,
-    0xDF,
-    0xFA,
-    0x1B,
-    0xFE,
-    0x33,
-    0x43,
-    0x0C,
-    0x74,
-    0xF8,
-    0xCF,
-    0x0D,
-    0xB1,
-    0x82,
-    0xE1,
-    0x37,
-    0xD4,
-    0x52,
-    0x86,
-    0x8B,
-    0x30,
-    0x67,
-    0x08,
-    0xFC,
-    0x86,
-    0x3A,
-    0x8C,
-    0xC1,
-    0xE1,
-    0x16,
-    0xD8,
-    0xA9,
-    0x00,
-    0x77,
-    0xA3,
-    0x4A,
-    0x6D,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x00,
-    0x81,
-    0x8B,
-    0x6C,
-    0x0C,
-    0x0C,
-    0x3D,
-    0x0C,
-    0xBF,
-    0xE2,
-    0x19,
-    0x0E,
-    0xFC,
-    0x67,
-    0xBE,
-    0xF8,
-    0x9F,
-    0xF5,
-    0x4F,
-    0x3D,
-    0x83,
-    0xC0,
-    0xDF,
-    0xF3,
-    0xFF,
-    0xD9,
-    0x19,
-    0x18,
-    0x1E,
-    0xFE,
-    0xAF,
-    0x07,
-    0x4A,
-    0x1F,
-    0x00,
-    0x93,
-    0x7F,
-    0xEE,
-    0x03,
-    0x45,
-    0x0E,
-    0xFC,
-    0x67,
-    0xFF,
-    0x93,
-    0xCF,
-    0xF0,
-    0xAB,
-    0x1E,
-    0xA4,
-    0xF2,
-    0x11,
-    0x50,
-    0xC1,
-    0x1C,
-    0x06,
-    0x08,
-    0x00,
-    0x00,
-    0xC5,
-    0x40,
-    0x1A,
-    0x20,
-    0x78,
-    0x9C,
-    0x2D,
-    0x8F,
-    0xCB,
-    0x0D,
-    0x82,
-    0x00,
-    0x10,
-    0x44,
-    0x47,
-    0xF1,
-    0x17,
-    0x54,
-    0xC2,
-    0xC5,
-    0x36,
-    0xC4,
-    0x84,
-    0x02,
-    0xB4,
-    0x03,
-    0xE9,
-    0x40,
-    0x1B,
-    0x30,
-    0xB1,
-    0x03,
-    0xEC,
-    0x00,
-    0x3B,
-    0xD0,
-    0x0A,
-    0x84,
-    0x8B,
-    0x67,
-    0xEC,
-    0x80,
-    0xB3,
-    0x27,
-    0x62,
-    0x05,
-    0x20,
-    0x0A,
-    0x7E,
-    0x40,
-    0xC7,
-    0x45,
-    0xD8,
-    0xCB,
-    0xBE,
-    0xCC,
-    0xCE,
-    0x6E,
-    0x66,
-    0x81,
-    0xB2,
-    0x46,
-    0xA8,
-    0x6A,
-    0xC2,
-    0x56,
-    0x05,
-    0x6B,
-    0xD6,
-    0xCA,
-    0xC9,
-    0xFD,
-    0xEB,
-    0x67,
-    0x7E,
-    0x16,
-    0xD2,
-    0xF5,
-    0x37,
-    0xC9,
-    0xB0,
-    0x29,
-    0x32,
-    0x57,
-    0x66,
-    0xCE,
-    0x29,
-    0xF0,
-    0xDE,
-    0x01,
-    0xC5,
-    0x33,
-    0x94,
-    0xCD,
-    0x01,
-    0xF4,
-    0x60,
-    0xCB,
-    0xEE,
-    0x5E,
-    0x4E,
-    0x2C,
-    0x6D,
-    0x9D,
-    0x5A,
-    0x1C,
-    0x01,
-    0x9E,
-    0x81,
-    0xDC,
-    0x48,
-    0x7C,
-    0xE0,
-    0x3A,
-    0xC4,
-    0x73,
-    0x71,
-    0x17,
-    0x6F,
-    0xD6,
-    0x43,
-    0x66,
-    0xA7,
-    0x02,
-    0xB9,
-    0x82,
-    0xCC,
-    0x29,
-    0x41,
-    0x6C,
-    0x02,
-    0x2E,
-    0xAC,
-    0x72,
-    0xEA,
-    0xDC,
-    0x7C,
-    0xEC,
-    0xE7,
-    0x10,
-    0xB3,
-    0xAC,
-    0xC7,
-    0x9A,
-    0xD8,
-    0x0C,
-    0x8F,
-    0xCA,
-    0x5D,
-    0x85,
-    0xCE,
-    0xA1,
-    0xC5,
-    0xFE,
-    0xAB,
-    0x8D,
-    0x0D,
-    0xBB,
-    0x28,
-    0x9C,
-    0x2F,
-    0x90,
-    0x86,
-    0xC0,
-    0x85,
-    0xA1,
-    0x79,
-    0xE4,
-    0x58,
-    0x82,
-    0x15,
-    0x12,
-    0x2C,
-    0x90,
-    0x60,
-    0x48,
-    0x22,
-    0x1E,
-    0xDA,
-    0x65,
-    0xE6,
-    0x87,
-    0x56,
-    0xBF,
-    0x50,
-    0xA8,
-    0x35,
-    0xB0,
-    0x53,
-    0xC3,
-    0xAC,
-    0xF1,
-    0x6F,
-    0x3F,
-    0x7D,
-    0xDF,
-    0x59,
-    0x89,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x70,
-    0x64,
-    0x80,
-    0x80,
-    0x1F,
-    0x36,
-    0x10,
-    0xFA,
-    0xEF,
-    0x7F,
-    0x6D,
-    0x30,
-    0xED,
-    0xF0,
-    0xEB,
-    0x3F,
-    0x07,
-    0x44,
-    0x64,
-    0x2B,
-    0x1B,
-    0x03,
-    0x06,
-    0xF8,
-    0x96,
-    0x0F,
-    0x24,
-    0x04,
-    0xFE,
-    0x73,
-    0xD3,
-    0x9A,
-    0xFE,
-    0x0A,
-    0xA2,
-    0x15,
-    0xFE,
-    0x73,
-    0x7D,
-    0xE9,
-    0x07,
-    0xD2,
-    0x06,
-    0xFF,
-    0x39,
-    0x3E,
-    0x9E,
-    0x07,
-    0xD2,
-    0x05,
-    0xFF,
-    0x59,
-    0x37,
-    0xFC,
-    0x67,
-    0x65,
-    0x60,
-    0x78,
-    0xF4,
-    0x1F,
-    0x28,
-    0x35,
-    0xDF,
-    0xA4,
-    0xE4,
-    0x5F,
-    0x3C,
-    0x03,
-    0xC3,
-    0xE3,
-    0xFF,
-    0x40,
-    0x00,
-    0x72,
-    0xE8,
-    0xF1,
-    0x7F,
-    0xE7,
-    0xC4,
-    0x19,
-    0x18,
-    0x00,
-    0x58,
-    0x52,
-    0x3E,
-    0x6E,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x08,
-    0x60,
-    0x64,
-    0x00,
-    0x01,
-    0x83,
-    0x3F,
-    0x1C,
-    0x20,
-    0x4A,
-    0xE1,
-    0xF7,
-    0x7F,
-    0x5E,
-    0x10,
-    0xFD,
-    0xE3,
-    0xBF,
-    0x17,
-    0x58,
-    0x78,
-    0x2B,
-    0x2B,
-    0x03,
-    0x16,
-    0xF0,
-    0x2D,
-    0x1F,
-    0x48,
-    0x08,
-    0xFC,
-    0xE7,
-    0xA6,
-    0x35,
-    0xFD,
-    0x15,
-    0x44,
-    0x2B,
-    0xFC,
-    0xE7,
-    0xFA,
-    0xD2,
-    0x0F,
-    0x72,
-    0xE1,
-    0x7F,
-    0x8E,
-    0x8F,
-    0xE7,
-    0x81,
-    0x74,
-    0xC1,
-    0x7F,
-    0xD6,
-    0x0D,
-    0xFF,
-    0x81,
-    0xCE,
-    0x7A,
-    0xF4,
-    0x1F,
-    0x28,
-    0x35,
-    0xDF,
-    0xA4,
-    0xE4,
-    0x5F,
-    0x3C,
-    0x03,
-    0xC3,
-    0xE3,
-    0xFF,
-    0x40,
-    0xC0,
-    0x06,
-    0x94,
-    0x3C,
-    0xFE,
-    0xEF,
-    0x9C,
-    0x38,
-    0x03,
-    0x03,
-    0x00,
-    0x63,
-    0x7E,
-    0x3E,
-    0x7D,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x10,
-    0xF8,
-    0x63,
-    0xC7,
-    0x00,
-    0x02,
-    0x8F,
-    0xFF,
-    0xFF,
-    0x67,
-    0x05,
-    0x52,
-    0x01,
-    0xFF,
-    0x63,
-    0xFF,
-    0xF4,
-    0x03,
-    0xE9,
-    0x07,
-    0xF3,
-    0x19,
-    0x12,
-    0xFE,
-    0x33,
-    0x33,
-    0x30,
-    0x28,
-    0x00,
-    0xB1,
-    0x23,
-    0x03,
-    0x06,
-    0xF8,
-    0x96,
-    0x0F,
-    0x24,
-    0x04,
-    0xFE,
-    0x73,
-    0xD3,
-    0x9A,
-    0xFE,
-    0x0A,
-    0xA2,
-    0x15,
-    0xFE,
-    0x73,
-    0x7D,
-    0x01,
-    0xB9,
-    0xC9,
-    0xE0,
-    0x3F,
-    0xC7,
-    0xC7,
-    0xF3,
-    0x40,
-    0xBA,
-    0xE0,
-    0x3F,
-    0xEB,
-    0x06,
-    0x90,
-    0x63,
-    0x1F,
-    0xFD,
-    0x07,
-    0x4A,
-    0xCD,
-    0x37,
-    0x29,
-    0xF9,
-    0x17,
-    0x0F,
-    0x76,
-    0xFE,
-    0xFF,
-    0xFF,
-    0x6C,
-    0x40,
-    0xC9,
-    0xE3,
-    0xFF,
-    0xCE,
-    0x89,
-    0x33,
-    0x30,
-    0x00,
-    0x00,
-    0x98,
-    0xE2,
-    0x42,
-    0x82,
-    0x78,
-    0x9C,
-    0x63,
-    0x98,
-    0xB0,
-    0x9F,
-    0xA1,
-    0xE0,
-    0x3C,
-    0x23,
-    0x03,
-    0xC3,
-    0x87,
-    0xFF,
-    0xCC,
-    0x0F,
-    0xFE,
-    0xB3,
-    0x32,
-    0x30,
-    0xC0,
-    0xF8,
-    0x38,
-    0xC0,
-    0xB7,
-    0x7C,
-    0x20,
-    0x21,
-    0xF0,
-    0x9F,
-    0x9B,
-    0xD6,
-    0xF4,
-    0x57,
-    0x10,
-    0xAD,
-    0xF0,
-    0x9F,
-    0xEB,
-    0x4B,
-    0x3F,
-    0x90,
-    0x36,
-    0xF8,
-    0xCF,
-    0xF1,
-    0xF1,
-    0x3C,
-    0x90,
-    0x2E,
-    0xF8,
-    0xCF,
-    0xBA,
-    0x01,
-    0xE4,
-    0xC6,
-    0x47,
-    0xFF,
-    0x81,
-    0x52,
-    0xF3,
-    0x4D,
-    0x4A,
-    0xFE,
-    0xC5,
-    0x33,
-    0x30,
-    0x3C,
-    0xFE,
-    0x0F,
-    0x04,
-    0x6C,
-    0x40,
-    0xC9,
-    0xE3,
-    0xFF,
-    0xCE,
-    0x89,
-    0x33,
-    0x30,
-    0x00,
-    0x00,
-    0x38,
-    0x4F,
-    0x40,
-    0xCA,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x50,
-    0x60,
-    0x61,
-    0x00,
-    0x01,
-    0x81,
-    0x9F,
-    0x7C,
-    0x60,
-    0xFA,
-    0xC7,
-    0x7F,
-    0x7F,
-    0x10,
-    0xF5,
-    0xF8,
-    0x7F,
-    0x0E,
-    0x23,
-    0x88,
-    0x3E,
-    0xA8,
-    0xC1,
-    0x80,
-    0x05,
-    0xFC,
-    0xAC,
-    0x07,
-    0x91,
-    0x9F,
-    0xD7,
-    0x7F,
-    0x7C,
-    0x0F,
-    0xA2,
-    0x7F,
-    0xEB,
-    0x37,
-    0xFC,
-    0x67,
-    0x63,
-    0x60,
-    0x30,
-    0xF8,
-    0xCF,
-    0x29,
-    0xF0,
-    0x1F,
-    0x68,
-    0xC8,
-    0x86,
-    0xFF,
-    0x8C,
-    0x0C,
-    0x3F,
-    0xF2,
-    0x81,
-    0xD2,
-    0xFD,
-    0x0C,
-    0x0C,
-    0x0F,
-    0x80,
-    0x0A,
-    0x7E,
-    0xC9,
-    0x33,
-    0x30,
-    0x14,
-    0xFC,
-    0x67,
-    0x53,
-    0xF8,
-    0xCF,
-    0x01,
-    0x54,
-    0xFB,
-    0x8F,
-    0x77,
-    0x01,
-    0x58,
-    0xCF,
-    0xB7,
-    0xF8,
-    0x4F,
-    0x60,
-    0x33,
-    0x1E,
-    0xDC,
-    0xFF,
-    0x05,
-    0xB6,
-    0x37,
-    0xE1,
-    0x3F,
-    0xC8,
-    0x08,
-    0x20,
-    0xF8,
-    0x7B,
-    0x1F,
-    0x62,
-    0xC5,
-    0xB7,
-    0x7A,
-    0x28,
-    0x9D,
-    0x4F,
-    0x06,
-    0x0D,
-    0x00,
-    0x2A,
-    0xB5,
-    0x32,
-    0x74,
-    0x78,
-    0x9C,
-    0xFB,
-    0xB8,
-    0x9F,
-    0x01,
-    0x0C,
-    0x3E,
-    0xA2,
-    0xD3,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x9F,
-    0xC3,
-    0x0C,
-    0xA6,
-    0xFF,
-    0xFF,
-    0x5F,
-    0xCF,
-    0x08,
-    0x14,
-    0x37,
-    0x76,
-    0x7E,
-    0xF1,
-    0x9F,
-    0x07,
-    0x2C,
-    0x2F,
-    0xF0,
-    0x37,
-    0x1F,
-    0xA2,
-    0xEE,
-    0xCB,
-    0x79,
-    0x08,
-    0xFD,
-    0xE1,
-    0x3D,
-    0x94,
-    0xFE,
-    0x8F,
-    0xCA,
-    0xFF,
-    0xBC,
-    0x1F,
-    0x42,
-    0xFF,
-    0x06,
-    0xAB,
-    0x17,
-    0x38,
-    0xFA,
-    0x9F,
-    0x17,
-    0x62,
-    0xDE,
-    0x79,
-    0x46,
-    0x30,
-    0xBD,
-    0x9F,
-    0x15,
-    0x64,
-    0x9F,
-    0xB1,
-    0x10,
-    0x56,
-    0xFB,
-    0xA1,
-    0x34,
-    0x00,
-    0xEE,
-    0x32,
-    0x40,
-    0x21,
-    0x78,
-    0x9C,
-    0x63,
-    0x30,
-    0x78,
-    0xF5,
-    0x3E,
-    0x9A,
-    0x01,
-    0x08,
-    0xBE,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x8B,
-    0x81,
-    0xC1,
-    0xE1,
-    0x7F,
-    0x5E,
-    0xF0,
-    0x9F,
-    0x7C,
-    0x06,
-    0x86,
-    0x0D,
-    0xFF,
-    0x99,
-    0x18,
-    0x1E,
-    0x9C,
-    0x67,
-    0x60,
-    0xF8,
-    0xB0,
-    0x1F,
-    0xC8,
-    0xBE,
-    0xCF,
-    0xC0,
-    0xF0,
-    0xA9,
-    0x9F,
-    0x81,
-    0xE1,
-    0x01,
-    0x90,
-    0xFD,
-    0xB9,
-    0x9E,
-    0x81,
-    0xE1,
-    0xA7,
-    0x3D,
-    0x98,
-    0x5E,
-    0xF0,
-    0x9F,
-    0x05,
-    0x4C,
-    0x7F,
-    0xF7,
-    0x67,
-    0x00,
-    0xD3,
-    0x7F,
-    0xB9,
-    0xA1,
-    0x34,
-    0x2F,
-    0x84,
-    0xFE,
-    0xB1,
-    0x1F,
-    0x42,
-    0x6F,
-    0xF8,
-    0x6F,
-    0x0B,
-    0xD5,
-    0xF7,
-    0x9F,
-    0x15,
-    0x4C,
-    0x27,
-    0xFC,
-    0xD7,
-    0x07,
-    0xD3,
-    0x0C,
-    0xDF,
-    0xF6,
-    0x43,
-    0xE8,
-    0x0B,
-    0xFF,
-    0x21,
-    0xF4,
-    0x82,
-    0xFF,
-    0x8C,
-    0x60,
-    0x7A,
-    0x03,
-    0x94,
-    0xFF,
-    0xF1,
-    0x3E,
-    0x88,
-    0x0E,
-    0x0E,
-    0xFE,
-    0x1B,
-    0x0F,
-    0xA2,
-    0x7F,
-    0xFD,
-    0xFF,
-    0xCF,
-    0x09,
-    0xA2,
-    0xC1,
-    0x0E,
-    0x06,
-    0x00,
-    0x0C,
-    0x40,
-    0x49,
-    0x59,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x62,
-    0x00,
-    0x83,
-    0xBB,
-    0x2C,
-    0x20,
-    0x32,
-    0xE0,
-    0xFF,
-    0x7E,
-    0x30,
-    0x7F,
-    0xEB,
-    0xFF,
-    0xF9,
-    0x8C,
-    0x20,
-    0xBA,
-    0xE9,
-    0x1F,
-    0x44,
-    0xDA,
-    0x80,
-    0x01,
-    0x1D,
-    0x4C,
-    0x79,
-    0xF3,
-    0xBF,
-    0x86,
-    0x81,
-    0x21,
-    0xE1,
-    0x3F,
-    0x10,
-    0xC8,
-    0x32,
-    0x08,
-    0xCC,
-    0x75,
-    0x0B,
-    0xFE,
-    0x33,
-    0x1F,
-    0x2C,
-    0x7E,
-    0xE1,
-    0x3D,
-    0x98,
-    0x5A,
-    0xF0,
-    0x1F,
-    0xAC,
-    0x7F,
-    0x02,
-    0x90,
-    0x4A,
-    0x78,
-    0x0D,
-    0x54,
-    0xC3,
-    0xA4,
-    0xF0,
-    0x17,
-    0xA4,
-    0x94,
-    0xE9,
-    0xC1,
-    0xFF,
-    0x1C,
-    0xE3,
-    0xC5,
-    0xFF,
-    0x99,
-    0xBE,
-    0xED,
-    0x07,
-    0xC9,
-    0x31,
-    0xFD,
-    0xF4,
-    0x07,
-    0x53,
-    0xBF,
-    0xEC,
-    0x41,
-    0x1A,
-    0x98,
-    0x7E,
-    0xD4,
-    0x33,
-    0x30,
-    0x7C,
-    0xF9,
-    0xCF,
-    0xFC,
-    0xF9,
-    0xBF,
-    0xF9,
-    0x94,
-    0xFB,
-    0xFF,
-    0xB9,
-    0x1A,
-    0x40,
-    0x26,
-    0xFF,
-    0xB6,
-    0x67,
-    0x38,
-    0xFA,
-    0xBF,
-    0x97,
-    0x61,
-    0x21,
-    0x2F,
-    0xD4,
-    0x56,
-    0x00,
-    0xD3,
-    0x6E,
-    0x3C,
-    0xA3,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x60,
-    0x62,
-    0x00,
-    0x81,
-    0xC6,
-    0x78,
-    0x10,
-    0x99,
-    0xF0,
-    0xEF,
-    0x3E,
-    0x90,
-    0x74,
-    0xF8,
-    0xFB,
-    0x5E,
-    0x03,
-    0x48,
-    0x4D,
-    0x38,
-    0xCF,
-    0x0A,
-    0x12,
-    0x13,
-    0x80,
-    0x28,
-    0x40,
-    0x05,
-    0x53,
-    0xDE,
-    0xFC,
-    0xAF,
-    0x01,
-    0x2A,
-    0xFF,
-    0x0F,
-    0x04,
-    0xB2,
-    0x0C,
-    0x02,
-    0x73,
-    0xDD,
-    0x82,
-    0xFF,
-    0xCC,
-    0x07,
-    0x8B,
-    0x5F,
-    0x78,
-    0x0F,
-    0xA6,
-    0x16,
-    0xFC,
-    0x67,
-    0x04,
-    0x51,
-    0x13,
-    0x80,
-    0x54,
-    0xC2,
-    0x6B,
-    0xA0,
-    0x1A,
-    0x26,
-    0x85,
-    0xBF,
-    0x20,
-    0xA5,
-    0x4C,
-    0x0F,
-    0xFE,
-    0xE7,
-    0x18,
-    0x2F,
-    0xFE,
-    0xCF,
-    0xF4,
-    0x6D,
-    0x3F,
-    0x48,
-    0x8E,
-    0xE9,
-    0xA7,
-    0x3F,
-    0x98,
-    0xFA,
-    0x65,
-    0x0F,
-    0xD2,
-    0xC0,
-    0xF4,
-    0xA3,
-    0x9E,
-    0x81,
-    0xE1,
-    0xCB,
-    0x7F,
-    0xE6,
-    0xCF,
-    0xFF,
-    0xCD,
-    0xA7,
-    0xDC,
-    0xFF,
-    0xCF,
-    0xD5,
-    0x00,
-    0x32,
-    0xF9,
-    0xB7,
-    0x3D,
-    0xC3,
-    0xD1,
-    0xFF,
-    0xBD,
-    0x0C,
-    0x0B,
-    0x79,
-    0xA1,
-    0xB6,
-    0x02,
-    0x00,
-    0xCE,
-    0xC9,
-    0x3C,
-    0x93,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x38,
-    0xF8,
-    0x9E,
-    0x89,
-    0x81,
-    0x81,
-    0x41,
-    0xE1,
-    0xDF,
-    0x7F,
-    0x7F,
-    0x20,
-    0xF5,
-    0xE5,
-    0xFD,
-    0xB1,
-    0xFF,
-    0xEC,
-    0x0C,
-    0x0C,
-    0xFF,
-    0x38,
-    0x19,
-    0xBE,
-    0xDB,
-    0x33,
-    0x30,
-    0xB8,
-    0x00,
-    0xC5,
-    0xD9,
-    0x18,
-    0xB0,
-    0x83,
-    0x29,
-    0x6F,
-    0xFE,
-    0xD7,
-    0x30,
-    0x30,
-    0x24,
-    0xFC,
-    0x07,
-    0x02,
-    0x59,
-    0x06,
-    0x81,
-    0xB9,
-    0x6E,
-    0xC1,
-    0x7F,
-    0xE6,
-    0x83,
-    0xC5,
-    0x2F,
-    0xBC,
-    0x07,
-    0x53,
-    0x0B,
-    0xFE,
-    0x33,
-    0x82,
-    0xA8,
-    0x09,
-    0x40,
-    0x2A,
-    0xE1,
-    0x35,
-    0x50,
-    0x0D,
-    0x93,
-    0xC2,
-    0x5F,
-    0x90,
-    0x52,
-    0xA6,
-    0x07,
-    0xFF,
-    0x73,
-    0x8C,
-    0x17,
-    0xFF,
-    0x67,
-    0xFA,
-    0xB6,
-    0x1F,
-    0x24,
-    0xC7,
-    0xF4,
-    0xD3,
-    0x1F,
-    0x4C,
-    0xFD,
-    0xB2,
-    0x07,
-    0x69,
-    0x60,
-    0xFA,
-    0x51,
-    0x0F,
-    0x74,
-    0xC0,
-    0x7F,
-    0xE6,
-    0xCF,
-    0xFF,
-    0xCD,
-    0xA7,
-    0xDC,
-    0xFF,
-    0xCF,
-    0xD5,
-    0x00,
-    0x32,
-    0xF9,
-    0xB7,
-    0x3D,
-    0xC3,
-    0xD1,
-    0xFF,
-    0xBD,
-    0x0C,
-    0x0B,
-    0x79,
-    0xA1,
-    0xB6,
-    0x02,
-    0x00,
-    0x32,
-    0xD9,
-    0x40,
-    0x1E,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x10,
-    0x64,
-    0x00,
-    0x81,
-    0x8D,
-    0xFF,
-    0x73,
-    0xB6,
-    0xD8,
-    0x32,
-    0x30,
-    0xFC,
-    0xFE,
-    0xFF,
-    0xFF,
-    0x3F,
-    0x2F,
-    0x83,
-    0xC0,
-    0x2E,
-    0xC5,
-    0x17,
-    0xFB,
-    0x19,
-    0x19,
-    0xB0,
-    0x83,
-    0x29,
-    0x6F,
-    0xFE,
-    0xD7,
-    0x30,
-    0x30,
-    0x24,
-    0x00,
-    0x15,
-    0xFE,
-    0x97,
-    0x65,
-    0x10,
-    0x98,
-    0xEB,
-    0x16,
-    0xFC,
-    0x67,
-    0x3E,
-    0x58,
-    0xFC,
-    0xC2,
-    0x7B,
-    0x30,
-    0xB5,
-    0xE0,
-    0x3F,
-    0x58,
-    0xE3,
-    0x04,
-    0x20,
-    0x95,
-    0xF0,
-    0x1A,
-    0xA8,
-    0x86,
-    0x49,
-    0xE1,
-    0x2F,
-    0x48,
-    0x29,
-    0xD3,
-    0x83,
-    0xFF,
-    0x39,
-    0xC6,
-    0x8B,
-    0xFF,
-    0x33,
-    0x7D,
-    0xDB,
-    0x0F,
-    0x92,
-    0x63,
-    0xFA,
-    0xE9,
-    0x0F,
-    0xA6,
-    0x7E,
-    0xD9,
-    0x83,
-    0x34,
-    0x30,
-    0xFD,
-    0xA8,
-    0x67,
-    0x60,
-    0xF8,
-    0xF2,
-    0x9F,
-    0xF9,
-    0xF3,
-    0x7F,
-    0xF3,
-    0x29,
-    0xF7,
-    0xFF,
-    0x73,
-    0x35,
-    0x80,
-    0x4C,
-    0xFE,
-    0x6D,
-    0xCF,
-    0x70,
-    0xF4,
-    0x7F,
-    0x2F,
-    0xC3,
-    0x42,
-    0x5E,
-    0xA8,
-    0xAD,
-    0x00,
-    0x6A,
-    0x50,
-    0x3F,
-    0x60,
-    0x78,
-    0x9C,
-    0x63,
-    0xF8,
-    0xC9,
-    0xC5,
-    0xF0,
-    0x83,
-    0x9B,
-    0x41,
-    0xE0,
-    0xBF,
-    0x3E,
-    0xC3,
-    0x7F,
-    0x7F,
-    0x06,
-    0x06,
-    0x10,
-    0x8F,
-    0x87,
-    0x01,
-    0x3B,
-    0x98,
-    0xF2,
-    0xE6,
-    0x7F,
-    0x0D,
-    0x03,
-    0x43,
-    0xC2,
-    0x7F,
-    0x20,
-    0x90,
-    0x65,
-    0x10,
-    0x98,
-    0xEB,
-    0x16,
-    0xFC,
-    0x67,
-    0x3E,
-    0x58,
-    0xFC,
-    0xC2,
-    0x7B,
-    0x30,
-    0xB5,
-    0xE0,
-    0x3F,
-    0x23,
-    0x88,
-    0x9A,
-    0x00,
-    0xA4,
-    0x12,
-    0x5E,
-    0x03,
-    0xD5,
-    0x30,
-    0x29,
-    0xFC,
-    0x05,
-    0x29,
-    0x65,
-    0x7A,
-    0xF0,
-    0x3F,
-    0xC7,
-    0x78,
-    0xF1,
-    0x7F,
-    0xA6,
-    0x6F,
-    0xFB,
-    0x41,
-    0x72,
-    0x4C,
-    0x3F,
-    0xFD,
-    0xC1,
-    0xD4,
-    0x2F,
-    0x7B,
-    0x90,
-    0x06,
-    0xA6,
-    0x1F,
-    0xF5,
-    0x0C,
-    0x0C,
-    0x5F,
-    0xFE,
-    0x33,
-    0x7F,
-    0xFE,
-    0x6F,
-    0x3E,
-    0xE5,
-    0xFE,
-    0x7F,
-    0xAE,
-    0x06,
-    0x90,
-    0xC9,
-    0xBF,
-    0xED,
-    0x19,
-    0x8E,
-    0xFE,
-    0xEF,
-    0x65,
-    0x58,
-    0xC8,
-    0x0B,
-    0xB5,
-    0x15,
-    0x00,
-    0x8E,
-    0x3B,
-    0x3C,
-    0x43,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x38,
-    0x72,
-    0x9F,
-    0x8D,
-    0x81,
-    0x81,
-    0xC1,
-    0x60,
-    0x7F,
-    0x73,
-    0x3E,
-    0x90,
-    0x9A,
-    0xA0,
-    0xCF,
-    0x70,
-    0x0F,
-    0x48,
-    0x2D,
-    0x90,
-    0x07,
-    0x53,
-    0x01,
-    0xFD,
-    0x01,
-    0xFD,
-    0x40,
-    0x8A,
-    0xE1,
-    0xFB,
-    0x7F,
-    0x4E,
-    0x10,
-    0xC5,
-    0xC0,
-    0xC4,
-    0x80,
-    0x01,
-    0xA6,
-    0xBC,
-    0xF9,
-    0x5F,
-    0xC3,
-    0xC0,
-    0x90,
-    0xF0,
-    0x1F,
-    0x08,
-    0x64,
-    0x19,
-    0x04,
-    0xE6,
-    0xBA,
-    0x05,
-    0xFF,
-    0x99,
-    0x0F,
-    0x16,
-    0xBF,
-    0xF0,
-    0x1E,
-    0x4C,
-    0x2D,
-    0xF8,
-    0xCF,
-    0x08,
-    0xA2,
-    0x26,
-    0x00,
-    0xA9,
-    0x84,
-    0xD7,
-    0x40,
-    0x35,
-    0x4C,
-    0x0A,
-    0x7F,
-    0x41,
-    0x4A,
-    0x99,
-    0x1E,
-    0xFC,
-    0xCF,
-    0x31,
-    0x5E,
-    0xFC,
-    0x9F,
-    0xE9,
-    0xDB,
-    0x7E,
-    0x90,
-    0x1C,
-    0xD3,
-    0x4F,
-    0x7F,
-    0x30,
-    0xF5,
-    0xCB,
-    0x1E,
-    0xA4,
-    0x81,
-    0xE9,
-    0x47,
-    0x3D,
-    0x03,
-    0xC3,
-    0x97,
-    0xFF,
-    0xCC,
-    0x9F,
-    0xFF,
-    0x9B,
-    0x4F,
-    0xB9,
-    0xFF,
-    0x9F,
-    0xAB,
-    0x01,
-    0x64,
-    0xF2,
-    0x6F,
-    0x7B,
-    0x86,
-    0xA3,
-    0xFF,
-    0x7B,
-    0x19,
-    0x16,
-    0xF2,
-    0x42,
-    0x6D,
-    0x05,
-    0x00,
-    0x48,
-    0x9B,
-    0x40,
-    0x2D,
-    0x78,
-    0x9C,
-    0x63,
-    0x68,
-    0x79,
-    0xF3,
-    0x3E,
-    0x87,
-    0x21,
-    0xE1,
-    0xCF,
-    0x7D,
-    0x09,
-    0x06,
-    0x86,
-    0x80,
-    0xFF,
-    0x40,
-    0xC0,
-    0xF5,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xF7,
-    0x4C,
-    0x0C,
-    0x0C,
-    0x73,
-    0xDD,
-    0x82,
-    0x7F,
-    0xDF,
-    0xFF,
-    0x6F,
-    0x51,
-    0xFC,
-    0x9F,
-    0x8F,
-    0x01,
-    0x04,
-    0x0E,
-    0xFC,
-    0x8F,
-    0x67,
-    0x60,
-    0xF8,
-    0x5C,
-    0x0F,
-    0x66,
-    0x37,
-    0xFC,
-    0xE7,
-    0x65,
-    0x60,
-    0xD8,
-    0x70,
-    0x1F,
-    0xCC,
-    0x2E,
-    0xF8,
-    0xCF,
-    0x09,
-    0x22,
-    0x18,
-    0x19,
-    0x02,
-    0x5E,
-    0x03,
-    0x35,
-    0x5B,
-    0x18,
-    0x1B,
-    0x37,
-    0xFF,
-    0x67,
-    0x52,
-    0xF8,
-    0xFB,
-    0x1F,
-    0x06,
-    0x98,
-    0x2F,
-    0xFC,
-    0xCF,
-    0x35,
-    0x69,
-    0x86,
-    0xB2,
-    0xBF,
-    0x9D,
-    0x67,
-    0x60,
-    0x48,
-    0xF8,
-    0xCF,
-    0x0E,
-    0xD6,
-    0xF7,
-    0x13,
-    0x68,
-    0x9C,
-    0xC1,
-    0x7F,
-    0x2E,
-    0x30,
-    0xFB,
-    0x17,
-    0x98,
-    0x0D,
-    0xB1,
-    0xE7,
-    0x47,
-    0x3F,
-    0x03,
-    0xC3,
-    0xA5,
-    0xFF,
-    0xF3,
-    0x81,
-    0x2C,
-    0x16,
-    0x86,
-    0x4F,
-    0xFF,
-    0x2D,
-    0x5A,
-    0xFE,
-    0xBD,
-    0xFC,
-    0x1F,
-    0xED,
-    0xFC,
-    0xDC,
-    0x1F,
-    0x68,
-    0xC5,
-    0xFF,
-    0xFF,
-    0xF3,
-    0xC1,
-    0x06,
-    0xDB,
-    0x32,
-    0x30,
-    0x6C,
-    0xF9,
-    0xB7,
-    0x8E,
-    0x85,
-    0x21,
-    0xE1,
-    0xCD,
-    0xFB,
-    0x68,
-    0x06,
-    0x06,
-    0x00,
-    0xEF,
-    0xA2,
-    0x57,
-    0x2B,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0xD8,
-    0xFA,
-    0x6F,
-    0x1F,
-    0x2B,
-    0x03,
-    0xC3,
-    0x82,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xEF,
-    0x67,
-    0x60,
-    0xF8,
-    0x75,
-    0xDE,
-    0x74,
-    0x49,
-    0x3E,
-    0x83,
-    0xC3,
-    0x7F,
-    0x6E,
-    0x06,
-    0x06,
-    0x26,
-    0x86,
-    0x0D,
-    0xFF,
-    0x99,
-    0x18,
-    0x80,
-    0xE0,
-    0xC3,
-    0x7D,
-    0x10,
-    0xC9,
-    0xF0,
-    0x79,
-    0x3D,
-    0x98,
-    0xFA,
-    0x32,
-    0x1F,
-    0x4C,
-    0x7D,
-    0xED,
-    0x47,
-    0xE6,
-    0x7D,
-    0x3A,
-    0x0F,
-    0xA6,
-    0x1E,
-    0xFC,
-    0x07,
-    0x53,
-    0x13,
-    0xFE,
-    0x73,
-    0x80,
-    0x28,
-    0x81,
-    0xFF,
-    0xFD,
-    0x4C,
-    0x85,
-    0x7E,
-    0x40,
-    0xA5,
-    0x40,
-    0xA3,
-    0x81,
-    0x46,
-    0x18,
-    0xFC,
-    0xF9,
-    0xFF,
-    0x5F,
-    0x0A,
-    0x28,
-    0xAC,
-    0xF0,
-    0x4F,
-    0x04,
-    0xAC,
-    0x0A,
-    0x62,
-    0xB8,
-    0xC0,
-    0xFF,
-    0xF3,
-    0x8C,
-    0x20,
-    0xDA,
-    0xE0,
-    0x2F,
-    0x48,
-    0x8F,
-    0x81,
-    0xC0,
-    0x6F,
-    0x2E,
-    0x90,
-    0x55,
-    0xFF,
-    0xFF,
-    0xB3,
-    0x01,
-    0xA9,
-    0x27,
-    0xFF,
-    0xEB,
-    0xC1,
-    0x2A,
-    0x15,
-    0x81,
-    0x18,
-    0x00,
-    0x62,
-    0xA2,
-    0x30,
-    0xAD,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x50,
-    0x60,
-    0x00,
-    0x83,
-    0xAF,
-    0x92,
-    0x60,
-    0xEA,
-    0xEF,
-    0x7B,
-    0x36,
-    0x10,
-    0xD5,
-    0xF8,
-    0xEF,
-    0x3E,
-    0x0B,
-    0x88,
-    0x0E,
-    0xF8,
-    0xCD,
-    0x05,
-    0x16,
-    0x56,
-    0x60,
-    0x64,
-    0x40,
-    0x07,
-    0xC7,
-    0xFE,
-    0xF7,
-    0x02,
-    0x05,
-    0x0F,
-    0xFC,
-    0xFF,
-    0xFF,
-    0xDF,
-    0x9E,
-    0x81,
-    0xE1,
-    0xF7,
-    0x7C,
-    0x93,
-    0x67,
-    0xEF,
-    0x19,
-    0x03,
-    0xFE,
-    0xB3,
-    0x33,
-    0x28,
-    0xFC,
-    0xE7,
-    0xDC,
-    0xF0,
-    0x1E,
-    0x28,
-    0xFD,
-    0x93,
-    0xFF,
-    0xC3,
-    0x7E,
-    0x90,
-    0xB1,
-    0xFA,
-    0x9F,
-    0xD7,
-    0x1B,
-    0x1B,
-    0x1B,
-    0x7F,
-    0xF3,
-    0xFF,
-    0xF2,
-    0x1F,
-    0x04,
-    0xE2,
-    0xBF,
-    0x42,
-    0xA8,
-    0x2F,
-    0xF3,
-    0xC1,
-    0x66,
-    0x7C,
-    0x3C,
-    0x0F,
-    0xA6,
-    0x2E,
-    0xFC,
-    0x07,
-    0x1B,
-    0x5F,
-    0xF0,
-    0x9F,
-    0x9B,
-    0x81,
-    0xC1,
-    0x81,
-    0x81,
-    0xE1,
-    0xCF,
-    0x79,
-    0xD3,
-    0x92,
-    0xBF,
-    0x6C,
-    0x0C,
-    0x07,
-    0x81,
-    0x0A,
-    0xDF,
-    0xB3,
-    0x32,
-    0x30,
-    0x6C,
-    0xFB,
-    0xB7,
-    0x8F,
-    0x8D,
-    0x01,
-    0x00,
-    0xAC,
-    0xDD,
-    0x3A,
-    0x7F,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x50,
-    0x60,
-    0x00,
-    0x01,
-    0x87,
-    0xBB,
-    0x20,
-    0x52,
-    0xE1,
-    0xD7,
-    0x7F,
-    0x36,
-    0x20,
-    0xF5,
-    0xE3,
-    0x7F,
-    0x34,
-    0x90,
-    0x14,
-    0x78,
-    0xAF,
-    0x01,
-    0x96,
-    0x62,
-    0x66,
-    0xC0,
-    0x02,
-    0x8E,
-    0xFD,
-    0xEF,
-    0x65,
-    0x64,
-    0x60,
-    0x38,
-    0xF0,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x7B,
-    0x06,
-    0x86,
-    0xDF,
-    0xF3,
-    0x4D,
-    0x9E,
-    0xBD,
-    0x67,
-    0x0C,
-    0xF8,
-    0xCF,
-    0xCE,
-    0xA0,
-    0xF0,
-    0x9F,
-    0x73,
-    0xC3,
-    0x7B,
-    0xA0,
-    0xF4,
-    0x4F,
-    0xFE,
-    0x0F,
-    0xFB,
-    0x81,
-    0xD4,
-    0x57,
-    0xFD,
-    0xCF,
-    0xEB,
-    0x8D,
-    0x8D,
-    0x8D,
-    0xBF,
-    0xF9,
-    0x7F,
-    0xF9,
-    0x0F,
-    0x02,
-    0xF1,
-    0x5F,
-    0x21,
-    0xD4,
-    0x97,
-    0xF9,
-    0x60,
-    0x33,
-    0x3E,
-    0x9E,
-    0x07,
-    0x53,
-    0x17,
-    0xFE,
-    0x33,
-    0x82,
-    0xA8,
-    0x82,
-    0xFF,
-    0xDC,
-    0x40,
-    0x67,
-    0x30,
-    0x30,
-    0xFC,
-    0x39,
-    0x6F,
-    0x5A,
-    0xF2,
-    0x97,
-    0x8D,
-    0xE1,
-    0x20,
-    0x50,
-    0xE1,
-    0x7B,
-    0x56,
-    0x06,
-    0x86,
-    0x6D,
-    0xFF,
-    0xF6,
-    0xB1,
-    0x31,
-    0x00,
-    0x00,
-    0x9F,
-    0x22,
-    0x3A,
-    0x5F,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x48,
-    0xF8,
-    0xCF,
-    0xC9,
-    0x00,
-    0x04,
-    0x3F,
-    0xFE,
-    0xEF,
-    0x07,
-    0x92,
-    0x0B,
-    0xFE,
-    0x57,
-    0xFD,
-    0xD7,
-    0x65,
-    0x60,
-    0xF8,
-    0xEE,
-    0xC7,
-    0x70,
-    0x08,
-    0xC8,
-    0x2D,
-    0x60,
-    0x64,
-    0x60,
-    0x10,
-    0x67,
-    0xC0,
-    0x01,
-    0x8E,
-    0xFD,
-    0xEF,
-    0x05,
-    0x4A,
-    0x1F,
-    0xF8,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x3D,
-    0x03,
-    0xC3,
-    0xEF,
-    0xF9,
-    0x26,
-    0xCF,
-    0xDE,
-    0x33,
-    0x06,
-    0xFC,
-    0x67,
-    0x67,
-    0x50,
-    0xF8,
-    0xCF,
-    0xB9,
-    0xE1,
-    0x3D,
-    0x50,
-    0xFA,
-    0x27,
-    0xFF,
-    0x07,
-    0x90,
-    0x81,
-    0x5F,
-    0xF5,
-    0x3F,
-    0xAF,
-    0x37,
-    0x36,
-    0x36,
-    0xFE,
-    0xE6,
-    0xFF,
-    0xE5,
-    0x3F,
-    0x08,
-    0xC4,
-    0x7F,
-    0x85,
-    0x50,
-    0x5F,
-    0xE6,
-    0x83,
-    0xCD,
-    0xF8,
-    0x78,
-    0x1E,
-    0x4C,
-    0x5D,
-    0xF8,
-    0xCF,
-    0x08,
-    0xA2,
-    0x0A,
-    0xFE,
-    0x73,
-    0x33,
-    0x30,
-    0x38,
-    0x30,
-    0x30,
-    0xFC,
-    0x39,
-    0x6F,
-    0x5A,
-    0xF2,
-    0x97,
-    0x8D,
-    0xE1,
-    0x20,
-    0x50,
-    0xE1,
-    0x7B,
-    0x56,
-    0x06,
-    0x86,
-    0x6D,
-    0xFF,
-    0xF6,
-    0xB1,
-    0x31,
-    0x00,
-    0x00,
-    0x09,
-    0x90,
-    0x3E,
-    0x38,
-    0x78,
-    0x9C,
-    0x63,
-    0xB8,
-    0xEC,
-    0xC7,
-    0x70,
-    0x29,
-    0x8E,
-    0x81,
-    0xE1,
-    0xE7,
-    0x7A,
-    0x86,
-    0xEF,
-    0xE7,
-    0x19,
-    0x18,
-    0xA0,
-    0x3C,
-    0xEC,
-    0xE0,
-    0xD8,
-    0xFF,
-    0x5E,
-    0x46,
-    0x06,
-    0x86,
-    0x03,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xB7,
-    0x67,
-    0x60,
-    0xF8,
-    0x3D,
-    0xDF,
-    0xE4,
-    0xD9,
-    0x7B,
-    0xC6,
-    0x80,
-    0xFF,
-    0xEC,
-    0x0C,
-    0x0A,
-    0xFF,
-    0x39,
-    0x37,
-    0xBC,
-    0x07,
-    0x4A,
-    0xFF,
-    0xE4,
-    0xFF,
-    0xB0,
-    0x1F,
-    0x48,
-    0x7D,
-    0xD5,
-    0xFF,
-    0xBC,
-    0xDE,
-    0xD8,
-    0xD8,
-    0xF8,
-    0x9B,
-    0xFF,
-    0x97,
-    0xFF,
-    0x20,
-    0x10,
-    0xFF,
-    0x15,
-    0x42,
-    0x7D,
-    0x99,
-    0x0F,
-    0x36,
-    0xE3,
-    0xE3,
-    0x79,
-    0x30,
-    0x75,
-    0xE1,
-    0x3F,
-    0x23,
-    0x88,
-    0x2A,
-    0xF8,
-    0xCF,
-    0xCD,
-    0xC0,
-    0xE0,
-    0xC0,
-    0xC0,
-    0xF0,
-    0xE7,
-    0xBC,
-    0x69,
-    0xC9,
-    0x5F,
-    0x36,
-    0x86,
-    0x83,
-    0x40,
-    0x85,
-    0xEF,
-    0x59,
-    0x19,
-    0x18,
-    0xB6,
-    0xFD,
-    0xDB,
-    0xC7,
-    0xC6,
-    0x00,
-    0x00,
-    0x36,
-    0xE0,
-    0x3B,
-    0x97,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x62,
-    0x60,
-    0x08,
-    0xE8,
-    0x67,
-    0x64,
-    0xB8,
-    0xF0,
-    0x3F,
-    0x8F,
-    0x41,
-    0xE1,
-    0xC5,
-    0x7F,
-    0x5F,
-    0x06,
-    0x86,
-    0xAD,
-    0xF3,
-    0x19,
-    0x18,
-    0x18,
-    0x84,
-    0x18,
-    0x60,
-    0xE0,
-    0x73,
-    0x3D,
-    0x45,
-    0x18,
-    0x00,
-    0x33,
-    0x83,
-    0x1D,
-    0xFA,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x62,
-    0x60,
-    0xB8,
-    0xC2,
-    0xCB,
-    0xB0,
-    0xE9,
-    0x7F,
-    0x7E,
-    0xC3,
-    0xFF,
-    0xFD,
-    0xAC,
-    0x1F,
-    0xFB,
-    0x98,
-    0x18,
-    0x0C,
-    0x18,
-    0x90,
-    0xC0,
-    0xE7,
-    0x7A,
-    0x8A,
-    0x30,
-    0x00,
-    0x3C,
-    0x13,
-    0x1E,
-    0x18,
-    0x78,
-    0x9C,
-    0x63,
-    0x48,
-    0xF8,
-    0xCF,
-    0xC1,
-    0xC0,
-    0xF0,
-    0xE3,
-    0xFF,
-    0x7E,
-    0x86,
-    0x05,
-    0xFF,
-    0x2B,
-    0xFF,
-    0xCB,
-    0x7E,
-    0xF7,
-    0x63,
-    0x38,
-    0xB4,
-    0xBF,
-    0x80,
-    0x81,
-    0x81,
-    0x41,
-    0x9C,
-    0x01,
-    0x0D,
-    0x18,
-    0xFC,
-    0x67,
-    0xA7,
-    0x26,
-    0x01,
-    0x00,
-    0x99,
-    0x7E,
-    0x1D,
-    0xFF,
-    0x78,
-    0x9C,
-    0x7B,
-    0xEC,
-    0xC7,
-    0x70,
-    0x29,
-    0xEE,
-    0xE7,
-    0x7A,
-    0x86,
-    0xEF,
-    0xE7,
-    0x1F,
-    0x83,
-    0x58,
-    0x0C,
-    0x68,
-    0xC0,
-    0xE0,
-    0x3F,
-    0x3B,
-    0x35,
-    0x09,
-    0x00,
-    0x60,
-    0x70,
-    0x1B,
-    0x91,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x80,
-    0x00,
-    0x43,
-    0x06,
-    0x86,
-    0xAB,
-    0x8C,
-    0x0C,
-    0x0C,
-    0xDF,
-    0xE6,
-    0x39,
-    0xFF,
-    0xE7,
-    0x60,
-    0x60,
-    0xF8,
-    0xF1,
-    0xFF,
-    0xFF,
-    0x7A,
-    0x90,
-    0xE8,
-    0xB5,
-    0xFF,
-    0xF9,
-    0x20,
-    0xEA,
-    0xD1,
-    0xFF,
-    0xFF,
-    0x6C,
-    0x0C,
-    0x0C,
-    0x0A,
-    0xFF,
-    0xB4,
-    0xFF,
-    0xF9,
-    0x33,
-    0x30,
-    0x08,
-    0xAC,
-    0x64,
-    0xF8,
-    0xF4,
-    0x1E,
-    0xAC,
-    0x27,
-    0xE1,
-    0x3F,
-    0x3B,
-    0x90,
-    0x14,
-    0x62,
-    0xF8,
-    0xC7,
-    0xCB,
-    0xE0,
-    0xF0,
-    0xE7,
-    0x7F,
-    0xEC,
-    0x0F,
-    0x7D,
-    0x86,
-    0x6F,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x9D,
-    0xAF,
-    0xF0,
-    0xDF,
-    0x57,
-    0xE0,
-    0xC8,
-    0xFF,
-    0xF9,
-    0x1B,
-    0xFE,
-    0x33,
-    0x31,
-    0x30,
-    0xFC,
-    0xDA,
-    0xFF,
-    0x01,
-    0x64,
-    0xD2,
-    0x87,
-    0xF3,
-    0x9F,
-    0xEB,
-    0x81,
-    0xD4,
-    0x83,
-    0xF3,
-    0x5F,
-    0xF2,
-    0x21,
-    0x14,
-    0x88,
-    0xF7,
-    0x61,
-    0xFD,
-    0xA7,
-    0xF9,
-    0x40,
-    0xEA,
-    0x73,
-    0xFD,
-    0x83,
-    0xFB,
-    0x40,
-    0xEA,
-    0x87,
-    0x7E,
-    0x03,
-    0xD0,
-    0x16,
-    0x83,
-    0xFF,
-    0xDC,
-    0x0C,
-    0x7F,
-    0xE7,
-    0x9B,
-    0x7C,
-    0x07,
-    0xEA,
-    0xBD,
-    0x04,
-    0x34,
-    0xCC,
-    0x0E,
-    0x28,
-    0x71,
-    0xEC,
-    0x5F,
-    0x2F,
-    0x23,
-    0x03,
-    0x00,
-    0x52,
-    0x40,
-    0x44,
-    0x3E,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x10,
-    0x64,
-    0x00,
-    0x81,
-    0x05,
-    0xFF,
-    0x73,
-    0xB7,
-    0xF8,
-    0x31,
-    0x30,
-    0xFC,
-    0xFA,
-    0xFF,
-    0xFF,
-    0xBF,
-    0x1C,
-    0x03,
-    0xC3,
-    0x29,
-    0xA1,
-    0xEB,
-    0xFB,
-    0x99,
-    0x18,
-    0xB0,
-    0x82,
-    0xCF,
-    0xF2,
-    0x0E,
-    0xAF,
-    0xCF,
-    0xB3,
-    0x32,
-    0x7C,
-    0xB6,
-    0xFF,
-    0xF1,
-    0xFF,
-    0x7F,
-    0x3E,
-    0xC3,
-    0xE7,
-    0xF5,
-    0xE7,
-    0x4D,
-    0xBF,
-    0xFF,
-    0x67,
-    0xFC,
-    0xFC,
-    0x9F,
-    0x8B,
-    0xA1,
-    0xE1,
-    0x3F,
-    0xEB,
-    0xE7,
-    0xFB,
-    0x0C,
-    0x0C,
-    0x0E,
-    0xFF,
-    0xD9,
-    0x3F,
-    0xD7,
-    0x33,
-    0x30,
-    0x18,
-    0x50,
-    0x8B,
-    0x02,
-    0x00,
-    0x10,
-    0x9B,
-    0x39,
-    0xBE,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x50,
-    0x60,
-    0x80,
-    0x80,
-    0x07,
-    0x36,
-    0x10,
-    0xFA,
-    0xFB,
-    0x7F,
-    0x29,
-    0x30,
-    0x1D,
-    0xF0,
-    0xE7,
-    0x3F,
-    0x07,
-    0x98,
-    0xA1,
-    0xF0,
-    0x53,
-    0x0E,
-    0xAA,
-    0x84,
-    0x89,
-    0x01,
-    0x0B,
-    0xD8,
-    0xF2,
-    0x77,
-    0x1F,
-    0x1B,
-    0x90,
-    0x5A,
-    0xF0,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xF3,
-    0x8C,
-    0x0C,
-    0x0C,
-    0xBF,
-    0xCF,
-    0x9B,
-    0x6E,
-    0xFD,
-    0xCF,
-    0xC3,
-    0x10,
-    0xF0,
-    0x9F,
-    0x9B,
-    0x81,
-    0xE1,
-    0x57,
-    0x3E,
-    0xC3,
-    0x86,
-    0xFF,
-    0x40,
-    0x4D,
-    0x1F,
-    0xEF,
-    0x33,
-    0x7C,
-    0x3C,
-    0x0F,
-    0x54,
-    0x73,
-    0xE0,
-    0x3F,
-    0xE3,
-    0xE7,
-    0xF5,
-    0x40,
-    0x7A,
-    0xC2,
-    0x7F,
-    0x96,
-    0x2F,
-    0xF3,
-    0x81,
-    0x74,
-    0xC3,
-    0x7F,
-    0xD6,
-    0xAF,
-    0x50,
-    0x1A,
-    0x2A,
-    0xCE,
-    0x0C,
-    0x53,
-    0x07,
-    0x44,
-    0x0C,
-    0x20,
-    0x4D,
-    0x09,
-    0xFF,
-    0xB9,
-    0x80,
-    0xE6,
-    0xC4,
-    0x33,
-    0x30,
-    0xFC,
-    0xD9,
-    0x0F,
-    0x34,
-    0x17,
-    0x68,
-    0xE6,
-    0x41,
-    0xA0,
-    0x3D,
-    0xFB,
-    0x41,
-    0xF6,
-    0x6E,
-    0xFD,
-    0xB7,
-    0x8F,
-    0x85,
-    0x81,
-    0x01,
-    0x00,
-    0x12,
-    0x25,
-    0x3C,
-    0x39,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x50,
-    0x60,
-    0x00,
-    0x03,
-    0x81,
-    0x9F,
-    0x2C,
-    0x60,
-    0xFA,
-    0xFB,
-    0x7F,
-    0x1E,
-    0x10,
-    0x75,
-    0xF5,
-    0x7F,
-    0x1D,
-    0x23,
-    0x88,
-    0xFE,
-    0xE5,
-    0x0D,
-    0x91,
-    0x56,
-    0x64,
-    0xC0,
-    0x0E,
-    0xB6,
-    0xFC,
-    0xDD,
-    0xC7,
-    0x06,
-    0xA4,
-    0x16,
-    0xFC,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x3C,
-    0x50,
-    0xC3,
-    0xEF,
-    0xF3,
-    0xA6,
-    0x5B,
-    0x81,
-    0x06,
-    0x04,
-    0xFC,
-    0xE7,
-    0x06,
-    0x6A,
-    0xCD,
-    0x67,
-    0xD8,
-    0xF0,
-    0x9F,
-    0x89,
-    0x81,
-    0xE1,
-    0xE3,
-    0x7D,
-    0x86,
-    0x8F,
-    0xE7,
-    0x81,
-    0x6A,
-    0x0E,
-    0xFC,
-    0x67,
-    0xFC,
-    0xBC,
-    0x1E,
-    0x48,
-    0x4F,
-    0xF8,
-    0xCF,
-    0xF2,
-    0x65,
-    0x3E,
-    0x90,
-    0x6E,
-    0xF8,
-    0xCF,
-    0xFA,
-    0x15,
-    0x4A,
-    0x43,
-    0xC5,
-    0x99,
-    0x61,
-    0xEA,
-    0x80,
-    0x88,
-    0x01,
-    0xA4,
-    0x29,
-    0xE1,
-    0x3F,
-    0x17,
-    0xD0,
-    0x9C,
-    0x78,
-    0x06,
-    0x86,
-    0x3F,
-    0xFB,
-    0x81,
-    0xE6,
-    0x02,
-    0xCD,
-    0x3C,
-    0x08,
-    0xB4,
-    0x67,
-    0x3F,
-    0xC8,
-    0xDE,
-    0xAD,
-    0xFF,
-    0xF6,
-    0x01,
-    0xDD,
-    0x0B,
-    0x00,
-    0x18,
-    0x08,
-    0x3C,
-    0x49,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x50,
-    0xF8,
-    0xAB,
-    0xCB,
-    0x00,
-    0x02,
-    0x8F,
-    0xFF,
-    0xBF,
-    0x67,
-    0x06,
-    0x52,
-    0x01,
-    0xFF,
-    0x63,
-    0xFF,
-    0xC6,
-    0x03,
-    0xE9,
-    0x8F,
-    0xFD,
-    0x0C,
-    0x0D,
-    0xFF,
-    0x99,
-    0x18,
-    0x18,
-    0x1C,
-    0x80,
-    0x82,
-    0xC1,
-    0x0C,
-    0x78,
-    0xC0,
-    0x96,
-    0xBF,
-    0xFB,
-    0xD8,
-    0x80,
-    0xD4,
-    0x82,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x9F,
-    0x67,
-    0x64,
-    0x60,
-    0xF8,
-    0x7D,
-    0xDE,
-    0x74,
-    0xEB,
-    0x7F,
-    0x1E,
-    0xA0,
-    0x31,
-    0xDC,
-    0x0C,
-    0x0C,
-    0xBF,
-    0xF2,
-    0x19,
-    0x36,
-    0x80,
-    0xCC,
-    0xF8,
-    0x78,
-    0x9F,
-    0xE1,
-    0xE3,
-    0x79,
-    0xA0,
-    0x9A,
-    0x03,
-    0xFF,
-    0x19,
-    0x3F,
-    0xAF,
-    0x07,
-    0xD2,
-    0x13,
-    0xFE,
-    0xB3,
-    0x7C,
-    0x99,
-    0x0F,
-    0xA4,
-    0x1B,
-    0xFE,
-    0xB3,
-    0x7E,
-    0x85,
-    0xD2,
-    0x50,
-    0x71,
-    0x66,
-    0x98,
-    0x3A,
-    0x20,
-    0x62,
-    0x00,
-    0x69,
-    0x4A,
-    0xF8,
-    0xCF,
-    0x05,
-    0x34,
-    0x07,
-    0xE8,
-    0xA0,
-    0x3F,
-    0xFB,
-    0x81,
-    0xE6,
-    0x02,
-    0xCD,
-    0x3C,
-    0x08,
-    0xB4,
-    0x67,
-    0x3F,
-    0xC8,
-    0xDE,
-    0xAD,
-    0xFF,
-    0xF6,
-    0xB1,
-    0x30,
-    0x30,
-    0x00,
-    0x00,
-    0xD8,
-    0xDE,
-    0x40,
-    0x1E,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x10,
-    0x60,
-    0x64,
-    0x00,
-    0x01,
-    0x81,
-    0x3F,
-    0xE7,
-    0x5D,
-    0xEF,
-    0x30,
-    0x31,
-    0x30,
-    0x1C,
-    0xF8,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x79,
-    0x20,
-    0x7F,
-    0xA3,
-    0xD4,
-    0xA4,
-    0x7F,
-    0x52,
-    0x0C,
-    0x78,
-    0xC0,
-    0x96,
-    0xBF,
-    0xFB,
-    0xD8,
-    0x80,
-    0xD4,
-    0x02,
-    0x90,
-    0x7A,
-    0xA0,
-    0x11,
-    0xBF,
-    0xCF,
-    0x9B,
-    0x6E,
-    0xFD,
-    0xCF,
-    0xC3,
-    0x10,
-    0xF0,
-    0x9F,
-    0x9B,
-    0x81,
-    0xE1,
-    0x57,
-    0x3E,
-    0xC3,
-    0x86,
-    0xFF,
-    0x40,
-    0xB3,
-    0x3E,
-    0xDE,
-    0x67,
-    0xF8,
-    0x08,
-    0x32,
-    0xEB,
-    0xC0,
-    0x7F,
-    0xC6,
-    0xCF,
-    0xEB,
-    0x81,
-    0xF4,
-    0x84,
-    0xFF,
-    0x2C,
-    0x5F,
-    0xE6,
-    0x03,
-    0xE9,
-    0x86,
-    0xFF,
-    0xAC,
-    0x5F,
-    0xA1,
-    0x34,
-    0x54,
-    0x9C,
-    0x19,
-    0xA6,
-    0x0E,
-    0x88,
-    0x18,
-    0x40,
-    0x9A,
-    0x12,
-    0xFE,
-    0x73,
-    0x01,
-    0xCD,
-    0x89,
-    0x67,
-    0x60,
-    0xF8,
-    0xB3,
-    0x1F,
-    0x68,
-    0x2E,
-    0xD0,
-    0xCC,
-    0x83,
-    0x40,
-    0x7B,
-    0xF6,
-    0x83,
-    0xEC,
-    0xDD,
-    0xFA,
-    0x6F,
-    0x1F,
-    0x0B,
-    0x03,
-    0x03,
-    0x00,
-    0x0E,
-    0xB3,
-    0x3F,
-    0x71,
-    0x78,
-    0x9C,
-    0x75,
-    0x8E,
-    0xCD,
-    0x11,
-    0x82,
-    0x60,
-    0x0C,
-    0x44,
-    0xDF,
-    0x27,
-    0xE8,
-    0x01,
-    0x6D,
-    0xC7,
-    0x3E,
-    0xEC,
-    0x40,
-    0x3B,
-    0xB0,
-    0x05,
-    0x4B,
-    0xA0,
-    0x03,
-    0xE8,
-    0x40,
-    0x0F,
-    0x72,
-    0x05,
-    0xAD,
-    0xE0,
-    0x2B,
-    0xC1,
-    0x16,
-    0x44,
-    0xE5,
-    0xE2,
-    0xDF,
-    0xBA,
-    0x3A,
-    0x70,
-    0x34,
-    0x93,
-    0x99,
-    0x37,
-    0x9B,
-    0xD9,
-    0x6C,
-    0x42,
-    0x59,
-    0x90,
-    0x37,
-    0xC0,
-    0x45,
-    0xE1,
-    0xAC,
-    0x04,
-    0x06,
-    0xFD,
-    0xB7,
-    0xF6,
-    0xAF,
-    0x7A,
-    0x62,
-    0x94,
-    0x92,
-    0x62,
-    0x80,
-    0x47,
-    0x9C,
-    0x57,
-    0x9A,
-    0xB1,
-    0xD0,
-    0x14,
-    0xEE,
-    0x6B,
-    0x76,
-    0x1A,
-    0x41,
-    0x7B,
-    0xA2,
-    0x8D,
-    0xF6,
-    0x1C,
-    0x14,
-    0xAE,
-    0x5B,
-    0x33,
-    0x57,
-    0x7A,
-    0x2B,
-    0xCC,
-    0x8D,
-    0xC6,
-    0x5D,
-    0xCF,
-    0x7E,
-    0x9E,
-    0x0C,
-    0x3E,
-    0x37,
-    0xDF,
-    0xA5,
-    0x95,
-    0x32,
-    0xE7,
-    0x2C,
-    0xE1,
-    0xD9,
-    0x38,
-    0xD7,
-    0x99,
-    0x47,
-    0xDF,
-    0xF9,
-    0xFD,
-    0x53,
-    0xBD,
-    0xEB,
-    0x14,
-    0x3E,
-    0x5A,
-    0x2D,
-    0x3E,
-    0x61,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x38,
-    0xD4,
-    0xCF,
-    0x00,
-    0x04,
-    0x3F,
-    0xFF,
-    0x33,
-    0xC3,
-    0xC9,
-    0x83,
-    0x60,
-    0x11,
-    0x74,
-    0x60,
-    0x60,
-    0x0C,
-    0x04,
-    0xCA,
-    0x9F,
-    0xFF,
-    0x03,
-    0xC1,
-    0x79,
-    0x08,
-    0x89,
-    0x4D,
-    0x15,
-    0x04,
-    0x60,
-    0x37,
-    0x13,
-    0x00,
-    0x89,
-    0x46,
-    0x19,
-    0xCA,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x00,
-    0x02,
-    0x51,
-    0x06,
-    0x30,
-    0x50,
-    0xF8,
-    0xCF,
-    0x0C,
-    0xA6,
-    0x0B,
-    0xDE,
-    0x43,
-    0xF8,
-    0x07,
-    0xE6,
-    0x83,
-    0xC8,
-    0x2D,
-    0x7F,
-    0xFF,
-    0xF9,
-    0x03,
-    0xA9,
-    0x05,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xDF,
-    0xCF,
-    0xC8,
-    0xC0,
-    0xF0,
-    0xFB,
-    0xBC,
-    0xE9,
-    0xAF,
-    0xFF,
-    0x3C,
-    0x0C,
-    0x01,
-    0xFF,
-    0xB9,
-    0x19,
-    0xDE,
-    0xFE,
-    0xC8,
-    0x67,
-    0xD8,
-    0xF0,
-    0x9F,
-    0x49,
-    0x61,
-    0xFE,
-    0x87,
-    0xF3,
-    0x0C,
-    0x1F,
-    0xCF,
-    0x33,
-    0x34,
-    0xF8,
-    0x6F,
-    0xF8,
-    0xCF,
-    0xF8,
-    0x79,
-    0x3D,
-    0xC3,
-    0x05,
-    0xBE,
-    0x09,
-    0xFF,
-    0x99,
-    0xBF,
-    0xCC,
-    0x67,
-    0xF8,
-    0xC4,
-    0xD9,
-    0xF0,
-    0x9F,
-    0x15,
-    0x48,
-    0xFF,
-    0x60,
-    0x01,
-    0xD2,
-    0x9F,
-    0xE7,
-    0x33,
-    0xBC,
-    0x65,
-    0x00,
-    0x8A,
-    0x7F,
-    0x3C,
-    0x6F,
-    0x30,
-    0x9F,
-    0xE1,
-    0xC0,
-    0x7F,
-    0xC6,
-    0x03,
-    0xFF,
-    0x1B,
-    0xFD,
-    0x41,
-    0x9A,
-    0x12,
-    0xFE,
-    0xDF,
-    0xE0,
-    0x63,
-    0xF8,
-    0x15,
-    0x0F,
-    0x34,
-    0xF7,
-    0xBF,
-    0xF5,
-    0x56,
-    0xA0,
-    0x99,
-    0x0C,
-    0x1B,
-    0x41,
-    0xF6,
-    0x00,
-    0xED,
-    0x33,
-    0xF8,
-    0xFF,
-    0x6F,
-    0x1F,
-    0x0B,
-    0x90,
-    0x6E,
-    0xB8,
-    0x0F,
-    0x71,
-    0xCC,
-    0x85,
-    0x7E,
-    0x08,
-    0xFD,
-    0xC9,
-    0x1E,
-    0x42,
-    0x0B,
-    0xB0,
-    0x81,
-    0x29,
-    0x00,
-    0xFE,
-    0x27,
-    0x47,
-    0x4A,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x62,
-    0x00,
-    0x01,
-    0x81,
-    0xFD,
-    0x60,
-    0xBA,
-    0xE1,
-    0xFF,
-    0x7C,
-    0x46,
-    0x10,
-    0x7D,
-    0xEC,
-    0x7F,
-    0x3D,
-    0x58,
-    0x78,
-    0xF2,
-    0x7B,
-    0x30,
-    0xC5,
-    0xA0,
-    0xC8,
-    0x80,
-    0x06,
-    0xBE,
-    0xC5,
-    0x33,
-    0x30,
-    0x14,
-    0xFC,
-    0x67,
-    0xA6,
-    0x0E,
-    0xF5,
-    0x15,
-    0x48,
-    0x6D,
-    0xF8,
-    0xCF,
-    0xFC,
-    0xA5,
-    0x9F,
-    0x81,
-    0xE1,
-    0xFB,
-    0x7F,
-    0xE6,
-    0x07,
-    0xFF,
-    0xD5,
-    0x16,
-    0x9F,
-    0xFF,
-    0xCF,
-    0x9C,
-    0xF0,
-    0xFF,
-    0xFF,
-    0x7F,
-    0xAB,
-    0xFF,
-    0xCC,
-    0x0C,
-    0x47,
-    0xFF,
-    0xE7,
-    0x28,
-    0xFC,
-    0x67,
-    0x06,
-    0x00,
-    0x1B,
-    0x81,
-    0x38,
-    0x4D,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x60,
-    0x62,
-    0x00,
-    0x81,
-    0x85,
-    0xF6,
-    0x20,
-    0xB2,
-    0xE1,
-    0xFF,
-    0x7E,
-    0x20,
-    0x19,
-    0xF0,
-    0xEF,
-    0xBE,
-    0x38,
-    0x90,
-    0x3A,
-    0xB0,
-    0x9E,
-    0x05,
-    0x24,
-    0xA6,
-    0xC0,
-    0xC8,
-    0x80,
-    0x01,
-    0xBE,
-    0xC5,
-    0x33,
-    0x30,
-    0x14,
-    0xFC,
-    0x67,
-    0xA6,
-    0x0E,
-    0xF5,
-    0x15,
-    0x48,
-    0x6D,
-    0xF8,
-    0xCF,
-    0xFC,
-    0xA5,
-    0x9F,
-    0x81,
-    0xE1,
-    0xFB,
-    0x7F,
-    0xE6,
-    0x07,
-    0xFF,
-    0xD5,
-    0x16,
-    0x9F,
-    0xFF,
-    0xCF,
-    0x9C,
-    0xF0,
-    0xFF,
-    0xFF,
-    0x7F,
-    0xAB,
-    0xFF,
-    0xCC,
-    0x0C,
-    0x47,
-    0xFF,
-    0xE7,
-    0x28,
-    0xFC,
-    0x67,
-    0x06,
-    0x00,
-    0x30,
-    0x66,
-    0x38,
-    0x6C,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x78,
-    0x74,
-    0x9E,
-    0x91,
-    0x81,
-    0x81,
-    0xC1,
-    0xE1,
-    0xFF,
-    0x7F,
-    0x3D,
-    0x20,
-    0xF5,
-    0xED,
-    0xFC,
-    0xB3,
-    0xFF,
-    0x2C,
-    0x0C,
-    0x0A,
-    0xFF,
-    0xD9,
-    0x19,
-    0x7E,
-    0xCA,
-    0x33,
-    0x30,
-    0xA8,
-    0x02,
-    0xC5,
-    0x59,
-    0x18,
-    0xB0,
-    0x82,
-    0x6F,
-    0xF1,
-    0x0C,
-    0x0C,
-    0x05,
-    0xFF,
-    0x99,
-    0xA9,
-    0x43,
-    0x7D,
-    0x05,
-    0x52,
-    0x1B,
-    0xFE,
-    0x33,
-    0x7F,
-    0xE9,
-    0x67,
-    0x60,
-    0xF8,
-    0xFE,
-    0x9F,
-    0xF9,
-    0xC1,
-    0x7F,
-    0xB5,
-    0xC5,
-    0xE7,
-    0xFF,
-    0x33,
-    0x27,
-    0xFC,
-    0xFF,
-    0xFF,
-    0xDF,
-    0xEA,
-    0x3F,
-    0x33,
-    0xC3,
-    0xD1,
-    0xFF,
-    0x39,
-    0x0A,
-    0xFF,
-    0x99,
-    0x01,
-    0x73,
-    0x8F,
-    0x3B,
-    0xE7,
-    0x78,
-    0x9C,
-    0x63,
-    0xF8,
-    0xCD,
-    0xC1,
-    0xF0,
-    0x8B,
-    0x93,
-    0xC1,
-    0xE1,
-    0x3F,
-    0xBF,
-    0xC2,
-    0x7F,
-    0x79,
-    0x06,
-    0x06,
-    0x08,
-    0x0F,
-    0x2B,
-    0xF8,
-    0x16,
-    0xCF,
-    0xC0,
-    0x50,
-    0xF0,
-    0x9F,
-    0x99,
-    0x3A,
-    0xD4,
-    0x57,
-    0x20,
-    0xB5,
-    0xE1,
-    0x3F,
-    0xF3,
-    0x97,
-    0x7E,
-    0x06,
-    0x86,
-    0xEF,
-    0xFF,
-    0x99,
-    0x1F,
-    0xFC,
-    0x57,
-    0x5B,
-    0x7C,
-    0xFE,
-    0x3F,
-    0x73,
-    0xC2,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xAD,
-    0xFE,
-    0x33,
-    0x33,
-    0x1C,
-    0xFD,
-    0x9F,
-    0xA3,
-    0xF0,
-    0x9F,
-    0x19,
-    0x00,
-    0xEA,
-    0x1D,
-    0x38,
-    0x0C,
-    0x78,
-    0x9C,
-    0x6D,
-    0xCF,
-    0xDD,
-    0x0D,
-    0x82,
-    0x40,
-    0x0C,
-    0x07,
-    0xF0,
-    0xBF,
-    0xA2,
-    0xF1,
-    0x33,
-    0xEA,
-    0x06,
-    0xF8,
-    0xAA,
-    0x2F,
-    0x3A,
-    0x02,
-    0x0B,
-    0x18,
-    0x1C,
-    0xC0,
-    0x04,
-    0x9D,
-    0xC0,
-    0x55,
-    0xDC,
-    0x00,
-    0x36,
-    0xC0,
-    0x0D,
-    0x18,
-    0x41,
-    0x46,
-    0xD0,
-    0x77,
-    0x93,
-    0x23,
-    0xF8,
-    0x85,
-    0x10,
-    0xA9,
-    0x6D,
-    0xCF,
-    0x47,
-    0xFB,
-    0x70,
-    0xBF,
-    0xBB,
-    0xB4,
-    0x69,
-    0xAF,
-    0x00,
-    0x30,
-    0x85,
-    0xC6,
-    0xF2,
-    0xAA,
-    0x4C,
-    0x4A,
-    0xEA,
-    0x88,
-    0x05,
-    0x6D,
-    0xF4,
-    0x49,
-    0x33,
-    0x9B,
-    0x76,
-    0xF0,
-    0x2F,
-    0x0A,
-    0x9F,
-    0x8F,
-    0xD4,
-    0xE0,
-    0x16,
-    0xB2,
-    0x79,
-    0x88,
-    0xB3,
-    0x61,
-    0x9F,
-    0x3E,
-    0x0E,
-    0xD4,
-    0x04,
-    0xAA,
-    0x11,
-    0x3C,
-    0x69,
-    0x46,
-    0x3D,
-    0xA0,
-    0x1E,
-    0xF2,
-    0xBD,
-    0x05,
-    0xBC,
-    0x5D,
-    0xCE,
-    0x71,
-    0xCD,
-    0x3D,
-    0x40,
-    0x1A,
-    0xB3,
-    0x59,
-    0x8C,
-    0x3C,
-    0x60,
-    0x23,
-    0x83,
-    0xD7,
-    0x98,
-    0x5D,
-    0x93,
-    0x53,
-    0xF5,
-    0xA5,
-    0x33,
-    0x75,
-    0xA9,
-    0x2D,
-    0x96,
-    0x2B,
-    0x6A,
-    0x88,
-    0x8F,
-    0x24,
-    0xD1,
-    0x89,
-    0x19,
-    0xED,
-    0xD5,
-    0x23,
-    0xB9,
-    0xF6,
-    0x0B,
-    0x9F,
-    0x81,
-    0xE2,
-    0xD9,
-    0x72,
-    0x5C,
-    0x4E,
-    0xCA,
-    0xAE,
-    0x5E,
-    0x08,
-    0x5B,
-    0x92,
-    0xA1,
-    0xD2,
-    0x76,
-    0x6E,
-    0xB7,
-    0xFB,
-    0xAD,
-    0xF1,
-    0x05,
-    0x17,
-    0x7A,
-    0x39,
-    0x0B,
-    0x78,
-    0x9C,
-    0x63,
-    0x10,
-    0x62,
-    0x00,
-    0x81,
-    0xCF,
-    0xF5,
-    0xC4,
-    0x53,
-    0x09,
-    0x7F,
-    0xCE,
-    0xB1,
-    0x02,
-    0xA9,
-    0xDF,
-    0xFF,
-    0xFF,
-    0xCF,
-    0x67,
-    0xF8,
-    0xFC,
-    0x7F,
-    0xBD,
-    0xC9,
-    0x8F,
-    0xFF,
-    0xAC,
-    0x9F,
-    0xFF,
-    0xB3,
-    0x31,
-    0x04,
-    0xFC,
-    0xE7,
-    0xFD,
-    0x3C,
-    0x1F,
-    0xA8,
-    0xE0,
-    0xAF,
-    0x3E,
-    0x58,
-    0xE5,
-    0xCF,
-    0x78,
-    0x30,
-    0xF5,
-    0xBD,
-    0x1E,
-    0x4C,
-    0x7D,
-    0x43,
-    0xA1,
-    0xBE,
-    0xE7,
-    0x43,
-    0x94,
-    0xF8,
-    0x83,
-    0xA9,
-    0x7F,
-    0xFC,
-    0x9F,
-    0xEF,
-    0x33,
-    0x32,
-    0x14,
-    0xFC,
-    0xE7,
-    0xFA,
-    0xFC,
-    0x3F,
-    0xCF,
-    0xF9,
-    0xE7,
-    0x7F,
-    0xA6,
-    0xCF,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x1F,
-    0x0F,
-    0xB4,
-    0x61,
-    0xF1,
-    0xBF,
-    0x75,
-    0x4C,
-    0xC4,
-    0x38,
-    0xE9,
-    0xB1,
-    0x37,
-    0x98,
-    0x02,
-    0x00,
-    0x8C,
-    0xC4,
-    0x49,
-    0x00,
-    0x78,
-    0x9C,
-    0x75,
-    0xCE,
-    0xDB,
-    0x11,
-    0xC1,
-    0x40,
-    0x14,
-    0x06,
-    0xE0,
-    0x9F,
-    0x30,
-    0x04,
-    0x83,
-    0x0E,
-    0xF2,
-    0x9E,
-    0x17,
-    0x2D,
-    0xA4,
-    0x01,
-    0xA2,
-    0x83,
-    0x50,
-    0x81,
-    0x56,
-    0x74,
-    0x10,
-    0x1D,
-    0x44,
-    0x07,
-    0x3B,
-    0x2A,
-    0x48,
-    0x46,
-    0x03,
-    0xA2,
-    0x82,
-    0xCD,
-    0x04,
-    0x11,
-    0x32,
-    0x72,
-    0x9C,
-    0xB3,
-    0x3B,
-    0x1E,
-    0xED,
-    0xC3,
-    0x7E,
-    0x7B,
-    0x39,
-    0x37,
-    0x9C,
-    0x57,
-    0x38,
-    0xED,
-    0x00,
-    0xD4,
-    0x0A,
-    0xD5,
-    0x85,
-    0xFD,
-    0xDD,
-    0xFF,
-    0xAC,
-    0x3A,
-    0xE4,
-    0x2D,
-    0xD3,
-    0xB8,
-    0xC5,
-    0x6C,
-    0x19,
-    0x23,
-    0xD7,
-    0x6C,
-    0x15,
-    0x62,
-    0x4F,
-    0x5D,
-    0xA0,
-    0x99,
-    0x22,
-    0xA0,
-    0x01,
-    0x40,
-    0x2E,
-    0xD0,
-    0x4E,
-    0xF8,
-    0xDC,
-    0x03,
-    0x5E,
-    0x1E,
-    0xFF,
-    0x71,
-    0xCC,
-    0x3D,
-    0x42,
-    0x96,
-    0xB0,
-    0x45,
-    0x82,
-    0x32,
-    0x62,
-    0x0F,
-    0x1A,
-    0xCF,
-    0x19,
-    0xBB,
-    0x26,
-    0xA7,
-    0x19,
-    0x49,
-    0x65,
-    0x1A,
-    0x52,
-    0x5F,
-    0x7C,
-    0x2F,
-    0xA9,
-    0x23,
-    0x3E,
-    0x94,
-    0x32,
-    0x1D,
-    0x0B,
-    0xB2,
-    0xE3,
-    0x1C,
-    0xC9,
-    0xB3,
-    0x23,
-    0x7C,
-    0xC6,
-    0x86,
-    0xC0,
-    0x86,
-    0xE3,
-    0x9A,
-    0x1A,
-    0xB6,
-    0xED,
-    0x42,
-    0xD8,
-    0x90,
-    0x34,
-    0x95,
-    0xB2,
-    0xBE,
-    0x79,
-    0x9E,
-    0x3B,
-    0x36,
-    0xE9,
-    0x0B,
-    0x20,
-    0xDF,
-    0x3A,
-    0x5D,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x06,
-    0x03,
-    0xE1,
-    0x2F,
-    0xFF,
-    0xC1,
-    0x60,
-    0x3E,
-    0x8C,
-    0x06,
-    0x00,
-    0xA1,
-    0x0C,
-    0x10,
-    0x90,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x06,
-    0x03,
-    0x86,
-    0x8F,
-    0xFF,
-    0xC1,
-    0x80,
-    0x19,
-    0x46,
-    0x03,
-    0x00,
-    0x99,
-    0x69,
-    0x0F,
-    0x3F,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x86,
-    0x03,
-    0x86,
-    0x8F,
-    0xFF,
-    0xE1,
-    0x80,
-    0x11,
-    0x99,
-    0x0D,
-    0x00,
-    0x5E,
-    0xAE,
-    0x17,
-    0xFF,
-    0x78,
-    0x9C,
-    0x33,
-    0x30,
-    0x06,
-    0x03,
-    0x86,
-    0x8F,
-    0xFF,
-    0xC1,
-    0x80,
-    0x19,
-    0x46,
-    0x03,
-    0x00,
-    0x99,
-    0x69,
-    0x0F,
-    0x3F,
-    0x78,
-    0x9C,
-    0xFB,
-    0x2A,
-    0xEF,
-    0xF0,
-    0x9F,
-    0xE9,
-    0xEB,
-    0x80,
-    0x13,
-    0x00,
-    0xD6,
-    0xB5,
-    0x3E,
-    0xF8,
-    0x78,
-    0x9C,
-    0x63,
-    0xF8,
-    0xCE,
-    0xCA,
-    0xF0,
-    0x8F,
-    0x31,
-    0xE1,
-    0x3E,
-    0xC3,
-    0x85,
-    0xF9,
-    0x0C,
-    0x5F,
-    0xF2,
-    0x19,
-    0x7E,
-    0xBD,
-    0x67,
-    0xF8,
-    0xF5,
-    0x9F,
-    0xE1,
-    0x52,
-    0x1E,
-    0x03,
-    0x00,
-    0x83,
-    0xB3,
-    0x0B,
-    0x2F,
-    0x78,
-    0x9C,
-    0x5B,
-    0xB0,
-    0x9E,
-    0xE1,
-    0xEB,
-    0x7F,
-    0x96,
-    0x2F,
-    0xFF,
-    0x59,
-    0x0E,
-    0xBC,
-    0x67,
-    0x78,
-    0xD0,
-    0xCF,
-    0xF0,
-    0x59,
-    0x9E,
-    0xE1,
-    0x3B,
-    0x27,
-    0xC3,
-    0x6F,
-    0x26,
-    0x06,
-    0x00,
-    0xA4,
-    0xDF,
-    0x0B,
-    0x6C,
-    0x78,
-    0x9C,
-    0x5B,
-    0xB0,
-    0x9E,
-    0xE1,
-    0xEB,
-    0x7F,
-    0x96,
-    0x2F,
-    0xFF,
-    0x59,
-    0x0E,
-    0xBC,
-    0x67,
-    0x78,
-    0xD0,
-    0xCF,
-    0xF0,
-    0x59,
-    0x9E,
-    0xE1,
-    0x3B,
-    0x27,
-    0xC3,
-    0x6F,
-    0x26,
-    0x06,
-    0x00,
-    0xA4,
-    0xDF,
-    0x0B,
-    0x6C,
-    0x78,
-    0x9C,
-    0x01,
-    0x28,
-    0x00,
-    0xD7,
-    0xFF,
-    0x00,
-    0xF7,
-    0x05,
-    0x40,
-    0x8F,
-    0x00,
-    0xFE,
-    0x01,
-    0xC0,
-    0x4F,
-    0x60,
-    0xDF,
-    0x00,
-    0xF3,
-    0x0F,
-    0xD0,
-    0x9F,
-    0x00,
-    0xFA,
-    0x0C,
-    0xF4,
-    0x6F,
-    0x10,
-    0xFF,
-    0x0A,
-    0xFA,
-    0xEF,
-    0x60,
-    0xFF,
-    0x1F,
-    0xFA,
-    0xFF,
-    0x70,
-    0xFF,
-    0x2F,
-    0xD2,
-    0x6E,
-    0x00,
-    0xFB,
-    0x08,
-    0x82,
-    0xB5,
-    0x14,
-    0x4D,
-    0x78,
-    0x9C,
-    0x01,
-    0x28,
-    0x00,
-    0xD7,
-    0xFF,
-    0xA0,
-    0xAF,
-    0x00,
-    0xF8,
-    0x1B,
-    0xF5,
-    0xFF,
-    0x24,
-    0xFF,
-    0x7F,
-    0xF4,
-    0xFF,
-    0x14,
-    0xFF,
-    0x7F,
-    0xC0,
-    0xEF,
-    0x00,
-    0xF9,
-    0x2F,
-    0xE0,
-    0x8F,
-    0x00,
-    0xFB,
-    0x0B,
-    0xF3,
-    0x1F,
-    0x00,
-    0xFF,
-    0x03,
-    0xF7,
-    0x09,
-    0x40,
-    0xCF,
-    0x00,
-    0xFB,
-    0x02,
-    0x80,
-    0x5F,
-    0x00,
-    0xDA,
-    0xEE,
-    0x14,
-    0xC9,
-    0x78,
-    0x9C,
-    0x01,
-    0x28,
-    0x00,
-    0xD7,
-    0xFF,
-    0xA0,
-    0xAF,
-    0x00,
-    0xF8,
-    0x1B,
-    0xF5,
-    0xFF,
-    0x24,
-    0xFF,
-    0x7F,
-    0xF4,
-    0xFF,
-    0x14,
-    0xFF,
-    0x7F,
-    0xC0,
-    0xEF,
-    0x00,
-    0xF9,
-    0x2F,
-    0xE0,
-    0x8F,
-    0x00,
-    0xFB,
-    0x0B,
-    0xF3,
-    0x1F,
-    0x00,
-    0xFF,
-    0x03,
-    0xF7,
-    0x09,
-    0x40,
-    0xCF,
-    0x00,
-    0xFB,
-    0x02,
-    0x80,
-    0x5F,
-    0x00,
-    0xDA,
-    0xEE,
-    0x14,
-    0xC9,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0xB8,
-    0xB0,
-    0x9F,
-    0x01,
-    0x04,
-    0xB0,
-    0x50,
-    0x7F,
-    0xFE,
-    0x83,
-    0x00,
-    0x17,
-    0x94,
-    0x32,
-    0x32,
-    0xBE,
-    0x7C,
-    0xDE,
-    0xD8,
-    0x98,
-    0x11,
-    0xAB,
-    0x4A,
-    0xEA,
-    0x50,
-    0x00,
-    0xA8,
-    0x44,
-    0x28,
-    0xF0,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0xB8,
-    0xB0,
-    0x9F,
-    0x01,
-    0x04,
-    0xB0,
-    0x50,
-    0x7F,
-    0xFE,
-    0x83,
-    0x00,
-    0x17,
-    0x94,
-    0x32,
-    0x32,
-    0xBE,
-    0x7C,
-    0xDE,
-    0xD8,
-    0x98,
-    0x11,
-    0xAB,
-    0x4A,
-    0xEA,
-    0x68,
-    0x07,
-    0x00,
-    0x42,
-    0x8B,
-    0x32,
-    0xB3,
-    0x78,
-    0x9C,
-    0x53,
-    0xF8,
-    0x9D,
-    0xC7,
-    0xF0,
-    0xE0,
-    0xFF,
-    0x7F,
-    0xD6,
-    0x6F,
-    0xFF,
-    0xFF,
-    0xF3,
-    0xFE,
-    0xF8,
-    0xFF,
-    0x9F,
-    0xFF,
-    0x2B,
-    0x90,
-    0x06,
-    0xF2,
-    0xD9,
-    0x14,
-    0x7E,
-    0xE7,
-    0x32,
-    0x00,
-    0x00,
-    0x0A,
-    0xDA,
-    0x11,
-    0xDF,
-    0x78,
-    0x9C,
-    0xDB,
-    0xB0,
-    0x9E,
-    0x81,
-    0xE1,
-    0x87,
-    0x0E,
-    0x83,
-    0xC3,
-    0x3B,
-    0xD6,
-    0xEF,
-    0xFF,
-    0xD9,
-    0x14,
-    0xFE,
-    0xAF,
-    0x67,
-    0x78,
-    0xF0,
-    0x9F,
-    0xEF,
-    0x1B,
-    0x9C,
-    0xB5,
-    0x01,
-    0x26,
-    0xCB,
-    0x02,
-    0x00,
-    0x8B,
-    0x0C,
-    0x12,
-    0xD9,
-    0x78,
-    0x9C,
-    0x55,
-    0xD0,
-    0x3F,
-    0x0A,
-    0xC2,
-    0x30,
-    0x14,
-    0x06,
-    0xF0,
-    0xAF,
-    0x52,
-    0x44,
-    0xAB,
-    0x48,
-    0x3D,
-    0x81,
-    0xE2,
-    0x01,
-    0x14,
-    0x27,
-    0x71,
-    0xD2,
-    0xC1,
-    0xBD,
-    0x1E,
-    0x40,
-    0xE8,
-    0xE4,
-    0xEE,
-    0x0D,
-    0xF4,
-    0x06,
-    0x16,
-    0x2F,
-    0x50,
-    0x4F,
-    0x20,
-    0xE2,
-    0x05,
-    0x74,
-    0x70,
-    0x14,
-    0x2A,
-    0x5E,
-    0x40,
-    0x17,
-    0x71,
-    0xB3,
-    0xFE,
-    0x01,
-    0x2D,
-    0x05,
-    0x7D,
-    0xBE,
-    0x24,
-    0x2D,
-    0xC4,
-    0x37,
-    0x84,
-    0xE4,
-    0x23,
-    0xBF,
-    0xBC,
-    0x24,
-    0x80,
-    0xAA,
-    0x21,
-    0xD2,
-    0xDA,
-    0xD2,
-    0x80,
-    0x47,
-    0xFB,
-    0x9B,
-    0x4B,
-    0xD6,
-    0x23,
-    0x22,
-    0xCA,
-    0x03,
-    0xCB,
-    0xD0,
-    0x48,
-    0x82,
-    0xC7,
-    0xBA,
-    0x17,
-    0x3B,
-    0xC0,
-    0xCB,
-    0x4D,
-    0x45,
-    0x54,
-    0xC2,
-    0xC9,
-    0x87,
-    0x4D,
-    0x56,
-    0x1A,
-    0xC4,
-    0x05,
-    0xCC,
-    0x03,
-    0x4D,
-    0xC8,
-    0x60,
-    0xAD,
-    0x09,
-    0xBC,
-    0x4B,
-    0xD8,
-    0xFB,
-    0x9A,
-    0xC0,
-    0x9D,
-    0x0F,
-    0x6D,
-    0x68,
-    0x02,
-    0x7D,
-    0x6E,
-    0x9B,
-    0xD5,
-    0x04,
-    0x30,
-    0xDB,
-    0xB5,
-    0xAB,
-    0x2C,
-    0x6A,
-    0x62,
-    0x5E,
-    0x4D,
-    0x36,
-    0x6E,
-    0x42,
-    0xE3,
-    0x42,
-    0x53,
-    0x60,
-    0x45,
-    0x47,
-    0x53,
-    0x1D,
-    0xEC,
-    0x7A,
-    0x0C,
-    0x2D,
-    0xFB,
-    0x4B,
-    0xE4,
-    0xC8,
-    0x8D,
-    0x64,
-    0x3D,
-    0xFD,
-    0x72,
-    0xE4,
-    0xCC,
-    0x43,
-    0xF3,
-    0x70,
-    0x4C,
-    0x44,
-    0x24,
-    0x9A,
-    0xDF,
-    0xC6,
-    0xE8,
-    0x52,
-    0x46,
-    0x0A,
-    0x75,
-    0xBD,
-    0xBB,
-    0xC3,
-    0x4F,
-    0x30,
-    0xA5,
-    0x40,
-    0x5C,
-    0x14,
-    0x81,
-    0xAB,
-    0x02,
-    0x16,
-    0x78,
-    0x57,
-    0x98,
-    0xF0,
-    0x23,
-    0xFB,
-    0x82,
-    0xB0,
-    0xC0,
-    0x23,
-    0xE8,
-    0xC5,
-    0x1D,
-    0x8F,
-    0x5A,
-    0xE7,
-    0x40,
-    0x09,
-    0xF9,
-    0x4D,
-    0x39,
-    0x7C,
-    0x88,
-    0xEA,
-    0x40,
-    0xF7,
-    0x6A,
-    0xA4,
-    0x1F,
-    0x39,
-    0xF9,
-    0x2C,
-    0x44,
-    0x93,
-    0x26,
-    0xFE,
-    0xEA,
-    0x07,
-    0x33,
-    0xDC,
-    0x6E,
-    0x55,
-    0x78,
-    0x9C,
-    0x01,
-    0x3C,
-    0x00,
-    0xC3,
-    0xFF,
-    0x00,
-    0x00,
-    0x40,
-    0x01,
-    0x00,
-    0x00,
-    0xF3,
-    0x1F,
-    0x00,
-    0x10,
-    0xFE,
-    0x0A,
-    0x00,
-    0xC0,
-    0xEF,
-    0x01,
-    0x00,
-    0xF9,
-    0x6F,
-    0x00,
-    0x60,
-    0xFF,
-    0x0B,
-    0x00,
-    0xF3,
-    0xFF,
-    0x02,
-    0x00,
-    0xF6,
-    0x8F,
-    0x00,
-    0x00,
-    0xF5,
-    0xEF,
-    0x00,
-    0x00,
-    0xA0,
-    0xFF,
-    0x09,
-    0x00,
-    0x00,
-    0xFC,
-    0x3F,
-    0x00,
-    0x00,
-    0xE1,
-    0xDF,
-    0x00,
-    0x00,
-    0x30,
-    0xFF,
-    0x08,
-    0x00,
-    0x00,
-    0xF6,
-    0x1F,
-    0x00,
-    0x00,
-    0x80,
-    0x04,
-    0x55,
-    0x9B,
-    0x13,
-    0xBE,
-    0x78,
-    0x9C,
-    0x53,
-    0x60,
-    0x61,
-    0x60,
-    0xF8,
-    0xA4,
-    0xCF,
-    0xC0,
-    0xB0,
-    0xE1,
-    0x3E,
-    0x03,
-    0x83,
-    0xC2,
-    0x7F,
-    0x6E,
-    0x06,
-    0x86,
-    0xEF,
-    0xFD,
-    0x0C,
-    0x0C,
-    0x07,
-    0xFE,
-    0xB3,
-    0x32,
-    0x18,
-    0xFC,
-    0x07,
-    0x8A,
-    0xFE,
-    0x8C,
-    0x67,
-    0x10,
-    0xF8,
-    0x67,
-    0xCF,
-    0xB0,
-    0xE0,
-    0x3F,
-    0x07,
-    0xC3,
-    0x97,
-    0xFD,
-    0x0C,
-    0x0C,
-    0xFF,
-    0x64,
-    0x19,
-    0x26,
-    0xFC,
-    0x67,
-    0x62,
-    0xF8,
-    0xE4,
-    0xCF,
-    0xC0,
-    0x10,
-    0xC0,
-    0xCE,
-    0xC0,
-    0x00,
-    0x00,
-    0x3D,
-    0x69,
-    0x12,
-    0xEA,
-    0x78,
-    0x9C,
-    0x73,
-    0x60,
-    0x80,
-    0x00,
-    0x01,
-    0xE6,
-    0x9F,
-    0xD6,
-    0x10,
-    0xD6,
-    0x33,
-    0xFD,
-    0xEF,
-    0xFF,
-    0x6B,
-    0x98,
-    0x19,
-    0x18,
-    0x02,
-    0x7F,
-    0xFE,
-    0xD7,
-    0x35,
-    0xF8,
-    0xFB,
-    0xFF,
-    0xFF,
-    0xFB,
-    0x7F,
-    0xFF,
-    0xFF,
-    0xCF,
-    0x67,
-    0x60,
-    0x48,
-    0x00,
-    0x32,
-    0xFF,
-    0xFF,
-    0x5F,
-    0xCF,
-    0x04,
-    0x54,
-    0x61,
-    0x70,
-    0xE2,
-    0xDF,
-    0xBD,
-    0x6C,
-    0x46,
-    0x06,
-    0x06,
-    0x00,
-    0x66,
-    0x12,
-    0x18,
-    0x87,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x00,
-    0x02,
-    0x03,
-    0x2D,
-    0x10,
-    0xC9,
-    0xB0,
-    0xA1,
-    0x1E,
-    0x4C,
-    0x7D,
-    0xE6,
-    0x03,
-    0x53,
-    0xBF,
-    0xD9,
-    0xC0,
-    0x52,
-    0xEF,
-    0x21,
-    0x52,
-    0xF9,
-    0x60,
-    0xEA,
-    0x0B,
-    0x44,
-    0xEA,
-    0x0F,
-    0x58,
-    0xCA,
-    0xE1,
-    0x3E,
-    0x98,
-    0x73,
-    0x00,
-    0x2A,
-    0xC5,
-    0x0B,
-    0x91,
-    0x62,
-    0x45,
-    0x92,
-    0xBA,
-    0x10,
-    0x0F,
-    0xA6,
-    0xBE,
-    0x42,
-    0xA4,
-    0xFE,
-    0x82,
-    0xA5,
-    0x02,
-    0x50,
-    0xA5,
-    0x78,
-    0x20,
-    0x52,
-    0x2C,
-    0x20,
-    0x32,
-    0xE1,
-    0x3C,
-    0x44,
-    0xCA,
-    0x1F,
-    0x4C,
-    0x7D,
-    0x83,
-    0x48,
-    0xFD,
-    0x00,
-    0x4B,
-    0x31,
-    0x08,
-    0x80,
-    0x49,
-    0x06,
-    0x00,
-    0xCC,
-    0x3B,
-    0x19,
-    0x2C,
-    0x78,
-    0x9C,
-    0xFB,
-    0xF1,
-    0x1F,
-    0x04,
-    0xD8,
-    0x7E,
-    0x40,
-    0x28,
-    0x43,
-    0x63,
-    0x63,
-    0xE3,
-    0xC9,
-    0xFF,
-    0x99,
-    0x19,
-    0x80,
-    0xE0,
-    0xC2,
-    0x7D,
-    0x10,
-    0xC9,
-    0xF0,
-    0xA5,
-    0x1E,
-    0x4C,
-    0xFD,
-    0x92,
-    0x07,
-    0x53,
-    0xFF,
-    0xB9,
-    0x41,
-    0x64,
-    0xC2,
-    0x7F,
-    0x56,
-    0x10,
-    0x75,
-    0xE0,
-    0x3D,
-    0x58,
-    0xEC,
-    0xD3,
-    0x7C,
-    0x30,
-    0xF5,
-    0xC3,
-    0x1E,
-    0x4C,
-    0xFD,
-    0xE3,
-    0x05,
-    0x91,
-    0x0E,
-    0xFF,
-    0xD9,
-    0x41,
-    0xD4,
-    0x82,
-    0xFF,
-    0x8C,
-    0x20,
-    0xEA,
-    0xE3,
-    0x7E,
-    0xB0,
-    0xD4,
-    0xB7,
-    0x78,
-    0x30,
-    0xF5,
-    0x87,
-    0x0F,
-    0x44,
-    0x2A,
-    0xFC,
-    0xE7,
-    0x04,
-    0x51,
-    0x0D,
-    0x10,
-    0xCB,
-    0x1E,
-    0xA0,
-    0x58,
-    0x16,
-    0x20,
-    0x05,
-    0x22,
-    0x01,
-    0x06,
-    0x3A,
-    0x27,
-    0xB8,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x60,
-    0x65,
-    0x80,
-    0x82,
-    0x05,
-    0xFD,
-    0x30,
-    0xD6,
-    0x8F,
-    0xF3,
-    0x50,
-    0x46,
-    0xC1,
-    0x7F,
-    0x59,
-    0x28,
-    0xEB,
-    0xEB,
-    0x7B,
-    0x26,
-    0x08,
-    0xC3,
-    0xE1,
-    0xBF,
-    0x3E,
-    0x54,
-    0xE8,
-    0xF3,
-    0x7F,
-    0x66,
-    0x08,
-    0x43,
-    0xE1,
-    0x9F,
-    0x3F,
-    0x54,
-    0xE8,
-    0xE2,
-    0xFF,
-    0xB3,
-    0x67,
-    0xC0,
-    0xA0,
-    0xE7,
-    0xC7,
-    0x7F,
-    0x28,
-    0xD8,
-    0xBF,
-    0xE1,
-    0xFF,
-    0x9C,
-    0x99,
-    0x60,
-    0x90,
-    0xC9,
-    0xF0,
-    0x27,
-    0x9F,
-    0x01,
-    0xAE,
-    0x90,
-    0x8D,
-    0x01,
-    0xA6,
-    0x39,
-    0x9E,
-    0x01,
-    0x6E,
-    0x20,
-    0x0B,
-    0x03,
-    0xCC,
-    0x12,
-    0x7B,
-    0x98,
-    0xE0,
-    0xB7,
-    0xF7,
-    0x30,
-    0x56,
-    0x03,
-    0x5C,
-    0x21,
-    0x03,
-    0xC4,
-    0x2D,
-    0x00,
-    0x8E,
-    0x07,
-    0x2E,
-    0x20,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x30,
-    0x64,
-    0x80,
-    0x02,
-    0x85,
-    0x7F,
-    0xAC,
-    0x50,
-    0xD6,
-    0xE3,
-    0xFF,
-    0xF9,
-    0x10,
-    0x86,
-    0xC3,
-    0xFF,
-    0xFF,
-    0xFF,
-    0x39,
-    0xC0,
-    0xAC,
-    0x6F,
-    0xE7,
-    0xFF,
-    0xFF,
-    0x99,
-    0x0F,
-    0x62,
-    0x14,
-    0xFC,
-    0xB7,
-    0xF9,
-    0x3F,
-    0xFD,
-    0x3F,
-    0x37,
-    0x90,
-    0xF5,
-    0xF3,
-    0xBC,
-    0xE1,
-    0x7F,
-    0xF6,
-    0x9F,
-    0xE7,
-    0x19,
-    0x19,
-    0x16,
-    0xFC,
-    0xE7,
-    0x36,
-    0xF8,
-    0xCF,
-    0xDE,
-    0xF0,
-    0x5F,
-    0x97,
-    0xE1,
-    0xF7,
-    0x7A,
-    0x06,
-    0x20,
-    0x8B,
-    0xE1,
-    0xFB,
-    0x7B,
-    0xC6,
-    0x2F,
-    0x9C,
-    0x60,
-    0x56,
-    0x42,
-    0x3F,
-    0x83,
-    0x01,
-    0x03,
-    0x98,
-    0xC5,
-    0xC0,
-    0x0C,
-    0xD2,
-    0x0D,
-    0x66,
-    0x31,
-    0x50,
-    0x9D,
-    0x05,
-    0x00,
-    0x8E,
-    0x4B,
-    0x2D,
-    0x21,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x00,
-    0x02,
-    0x03,
-    0x26,
-    0x06,
-    0x28,
-    0xF8,
-    0x2A,
-    0x0B,
-    0x63,
-    0xFD,
-    0x3C,
-    0x0F,
-    0x63,
-    0x2D,
-    0xF8,
-    0xCF,
-    0x0D,
-    0x63,
-    0xFE,
-    0x9E,
-    0x0F,
-    0x63,
-    0x1D,
-    0xF8,
-    0xCF,
-    0x0E,
-    0x65,
-    0x09,
-    0xFC,
-    0xCD,
-    0x87,
-    0x09,
-    0x5E,
-    0xFA,
-    0xCF,
-    0x72,
-    0xF4,
-    0x0C,
-    0x04,
-    0xFC,
-    0xB7,
-    0xFF,
-    0xFE,
-    0x1F,
-    0x0A,
-    0xCE,
-    0x4F,
-    0x9E,
-    0x09,
-    0x06,
-    0x3B,
-    0xFF,
-    0xCB,
-    0x41,
-    0xD5,
-    0x3D,
-    0xFE,
-    0x0F,
-    0xB5,
-    0xD0,
-    0xE0,
-    0x9F,
-    0x3F,
-    0x54,
-    0xE8,
-    0xD1,
-    0x7F,
-    0x56,
-    0x98,
-    0x71,
-    0xF5,
-    0x70,
-    0x2B,
-    0x38,
-    0x60,
-    0xD6,
-    0xAE,
-    0x87,
-    0xD9,
-    0xF0,
-    0x08,
-    0xEE,
-    0x14,
-    0x01,
-    0x10,
-    0x01,
-    0x00,
-    0x28,
-    0x41,
-    0x2D,
-    0xFD,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x10,
-    0xE8,
-    0x60,
-    0x66,
-    0x80,
-    0x00,
-    0x83,
-    0xFF,
-    0xEC,
-    0xB4,
-    0x60,
-    0x2D,
-    0x60,
-    0x02,
-    0xB3,
-    0x04,
-    0xB4,
-    0x19,
-    0x7E,
-    0xD9,
-    0x81,
-    0x59,
-    0x17,
-    0xEF,
-    0x33,
-    0x7E,
-    0xF9,
-    0xCF,
-    0x02,
-    0x64,
-    0x29,
-    0xFC,
-    0xED,
-    0x67,
-    0x30,
-    0xF8,
-    0x17,
-    0x0F,
-    0x64,
-    0x3D,
-    0xFE,
-    0xCF,
-    0xC6,
-    0xC0,
-    0x70,
-    0xE9,
-    0xBF,
-    0xD9,
-    0x7F,
-    0xF3,
-    0xFF,
-    0xF1,
-    0x40,
-    0x2D,
-    0x02,
-    0x7F,
-    0xEA,
-    0xFF,
-    0xBF,
-    0x78,
-    0x0F,
-    0x76,
-    0xD7,
-    0x86,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xEB,
-    0x41,
-    0xCC,
-    0xFB,
-    0xF5,
-    0xFF,
-    0x3E,
-    0x23,
-    0x84,
-    0xD5,
-    0xF0,
-    0x5F,
-    0x06,
-    0x6A,
-    0x07,
-    0xC3,
-    0x72,
-    0x06,
-    0x54,
-    0x00,
-    0x00,
-    0x05,
-    0xD8,
-    0x2D,
-    0x2D,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x60,
-    0x63,
-    0x40,
-    0x80,
-    0x06,
-    0x5E,
-    0x24,
-    0xCE,
-    0x0F,
-    0x24,
-    0x4E,
-    0xC1,
-    0x79,
-    0x24,
-    0xCE,
-    0xF7,
-    0x52,
-    0x04,
-    0xA7,
-    0x20,
-    0xBF,
-    0xE0,
-    0xFC,
-    0x19,
-    0x08,
-    0xF0,
-    0x66,
-    0xF8,
-    0xCE,
-    0x66,
-    0xD0,
-    0x01,
-    0x05,
-    0xA7,
-    0x0B,
-    0xF2,
-    0x11,
-    0x1A,
-    0xAE,
-    0x7F,
-    0x47,
-    0xB2,
-    0xE4,
-    0xFA,
-    0x17,
-    0x2E,
-    0x24,
-    0x8E,
-    0xC3,
-    0x7A,
-    0x24,
-    0x0E,
-    0xC3,
-    0x17,
-    0xCE,
-    0x00,
-    0xA8,
-    0x61,
-    0x67,
-    0xF6,
-    0x31,
-    0x38,
-    0xCC,
-    0x2F,
-    0xA8,
-    0x2B,
-    0x87,
-    0x00,
-    0x71,
-    0x06,
-    0x86,
-    0x2F,
-    0x95,
-    0x48,
-    0x2E,
-    0x70,
-    0x78,
-    0x8F,
-    0xEC,
-    0xD0,
-    0x2F,
-    0xC8,
-    0x1C,
-    0x07,
-    0x64,
-    0x0E,
-    0x03,
-    0x33,
-    0x8C,
-    0x01,
-    0x00,
-    0x42,
-    0x19,
-    0x2B,
-    0x4F,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x10,
-    0x60,
-    0x80,
-    0x81,
-    0x2F,
-    0x2C,
-    0x50,
-    0x86,
-    0xC3,
-    0x7D,
-    0x7F,
-    0x98,
-    0x10,
-    0xE7,
-    0x4F,
-    0x88,
-    0x60,
-    0xC0,
-    0x7C,
-    0x86,
-    0x09,
-    0xF1,
-    0x60,
-    0xD6,
-    0x57,
-    0x4E,
-    0x06,
-    0x86,
-    0x1F,
-    0xAC,
-    0x20,
-    0xA1,
-    0x7E,
-    0x20,
-    0xD1,
-    0x00,
-    0x12,
-    0xFC,
-    0xCA,
-    0x01,
-    0x92,
-    0x00,
-    0x0A,
-    0x06,
-    0xFC,
-    0x7F,
-    0xC7,
-    0xC7,
-    0xC0,
-    0xF0,
-    0xEE,
-    0x5F,
-    0x3C,
-    0x43,
-    0x42,
-    0xDA,
-    0x34,
-    0x7E,
-    0x06,
-    0x86,
-    0xF9,
-    0x69,
-    0x69,
-    0x20,
-    0x85,
-    0x40,
-    0x16,
-    0x44,
-    0xEF,
-    0x40,
-    0xB1,
-    0x1C,
-    0xE0,
-    0x2C,
-    0x85,
-    0xFF,
-    0xFF,
-    0xFF,
-    0xEB,
-    0x43,
-    0xFC,
-    0x16,
-    0x14,
-    0x1A,
-    0xCA,
-    0x04,
-    0xA4,
-    0x00,
-    0xE7,
-    0xB4,
-    0x22,
-    0x0C,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x80,
-    0x80,
-    0x04,
-    0x06,
-    0x24,
-    0x70,
-    0x81,
-    0x03,
-    0x99,
-    0xD3,
-    0x8F,
-    0xCC,
-    0xF9,
-    0xC3,
-    0x8E,
-    0xC4,
-    0x09,
-    0xAF,
-    0x67,
-    0x60,
-    0xD8,
-    0x7C,
-    0x06,
-    0x02,
-    0xFE,
-    0xB0,
-    0x7F,
-    0x63,
-    0x67,
-    0xD8,
-    0xD3,
-    0x01,
-    0x05,
-    0xCC,
-    0x09,
-    0xF5,
-    0x0C,
-    0xB5,
-    0x08,
-    0x95,
-    0xDF,
-    0xD8,
-    0x91,
-    0x38,
-    0x09,
-    0xF5,
-    0x48,
-    0x9C,
-    0x05,
-    0xFE,
-    0x48,
-    0x9C,
-    0x5F,
-    0x2C,
-    0xAF,
-    0xA1,
-    0xA6,
-    0x9D,
-    0x61,
-    0x5D,
-    0xE0,
-    0xCF,
-    0x50,
-    0x58,
-    0x0E,
-    0x01,
-    0xCF,
-    0xD9,
-    0x7F,
-    0xB2,
-    0x20,
-    0x2C,
-    0x9D,
-    0xEE,
-    0x8F,
-    0xE4,
-    0x82,
-    0x7F,
-    0x2C,
-    0x48,
-    0x1C,
-    0x24,
-    0x09,
-    0x86,
-    0x0B,
-    0x48,
-    0x12,
-    0x0C,
-    0x06,
-    0x20,
-    0x02,
-    0x00,
-    0x2D,
-    0xEA,
-    0x2D,
-    0x7A,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0xB8,
-    0xFD,
-    0xEE,
-    0x1E,
-    0x37,
-    0x03,
-    0x08,
-    0x38,
-    0xE4,
-    0xA7,
-    0xA5,
-    0xF9,
-    0x83,
-    0x59,
-    0x01,
-    0xFC,
-    0x0C,
-    0x0C,
-    0xF1,
-    0x83,
-    0x82,
-    0xB5,
-    0xE1,
-    0xFF,
-    0x7F,
-    0x20,
-    0xEB,
-    0xFF,
-    0xFF,
-    0xFD,
-    0x0C,
-    0x0C,
-    0xBF,
-    0x23,
-    0x58,
-    0x19,
-    0x18,
-    0x42,
-    0x7F,
-    0x00,
-    0xDD,
-    0xBA,
-    0x41,
-    0x0F,
-    0x28,
-    0xA3,
-    0xB0,
-    0x0F,
-    0xA4,
-    0xEE,
-    0x35,
-    0x13,
-    0x03,
-    0xC3,
-    0x23,
-    0xB0,
-    0xF3,
-    0x81,
-    0x82,
-    0x10,
-    0x21,
-    0xA0,
-    0x20,
-    0x33,
-    0x44,
-    0x08,
-    0x28,
-    0x18,
-    0x07,
-    0x15,
-    0x02,
-    0x6A,
-    0xE7,
-    0x86,
-    0xB1,
-    0x0A,
-    0xC0,
-    0x24,
-    0x00,
-    0x18,
-    0x1F,
-    0x21,
-    0x7A,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x60,
-    0x60,
-    0x10,
-    0x60,
-    0x80,
-    0x81,
-    0x2F,
-    0x2C,
-    0x50,
-    0x86,
-    0xC3,
-    0x7D,
-    0x7F,
-    0x98,
-    0x10,
-    0xE7,
-    0x4F,
-    0x88,
-    0x60,
-    0xC0,
-    0x7C,
-    0x86,
-    0x09,
-    0xF1,
-    0x60,
-    0xD6,
-    0x57,
-    0x4E,
-    0x06,
-    0x86,
-    0x1F,
-    0xAC,
-    0x20,
-    0xA1,
-    0x7E,
-    0x20,
-    0xD1,
-    0x00,
-    0x12,
-    0xFC,
-    0xCA,
-    0x01,
-    0x92,
-    0x00,
-    0x0A,
-    0x06,
-    0xFC,
-    0x7F,
-    0xC7,
-    0xC7,
-    0xC0,
-    0xF0,
-    0xEE,
-    0x5F,
-    0x3C,
-    0x43,
-    0x42,
-    0xDA,
-    0x34,
-    0x7E,
-    0x06,
-    0x86,
-    0xF9,
-    0x69,
-    0x69,
-    0x20,
-    0x85,
-    0x40,
-    0x16,
-    0x44,
-    0x2F,
-    0x19,
-    0xAC,
-    0xF5,
-    0xAB,
-    0x56,
-    0x41,
-    0x58,
-    0x0A,
-    0x33,
-    0x67,
-    0xCE,
-    0xD4,
-    0x64,
-    0xC0,
-    0x05,
-    0x14,
-    0x3A,
-    0x3A,
-    0x3A,
-    0x34,
-    0x20,
-    0x3A,
-    0xF6,
-    0xEF,
-    0xDE,
-    0x8D,
-    0x6E,
-    0x8A,
-    0x03,
-    0x9C,
-    0xA5,
-    0xF0,
-    0xFF,
-    0xFF,
-    0x7F,
-    0x7D,
-    0x88,
-    0x96,
-    0xA0,
-    0xD0,
-    0x50,
-    0x26,
-    0x20,
-    0x05,
-    0x00,
-    0x4F,
-    0x1B,
-    0x27,
-    0x22,
-    0x78,
-    0x9C,
-    0x65,
-    0xD0,
-    0xBD,
-    0x0D,
-    0x02,
-    0x31,
-    0x0C,
-    0x05,
-    0xE0,
-    0xC7,
-    0x71,
-    0x8A,
-    0x72,
-    0x90,
-    0x82,
-    0x1E,
-    0x56,
-    0x60,
-    0x05,
-    0x74,
-    0x25,
-    0x1D,
-    0x15,
-    0xF5,
-    0xAD,
-    0xC0,
-    0x06,
-    0xDC,
-    0x06,
-    0x61,
-    0x00,
-    0x76,
-    0x60,
-    0x04,
-    0x16,
-    0x40,
-    0xBA,
-    0x11,
-    0x60,
-    0x03,
-    0x7E,
-    0x44,
-    0x71,
-    0x54,
-    0x26,
-    0xB1,
-    0xAD,
-    0x28,
-    0x52,
-    0x5C,
-    0x44,
-    0xCA,
-    0x17,
-    0x2B,
-    0x7E,
-    0xF2,
-    0xE1,
-    0x96,
-    0xD5,
-    0x12,
-    0xB1,
-    0x5E,
-    0x94,
-    0xD5,
-    0x7D,
-    0x12,
-    0xE9,
-    0x9D,
-    0x13,
-    0xAD,
-    0x4B,
-    0x7A,
-    0x56,
-    0x4A,
-    0xC3,
-    0x18,
-    0x8E,
-    0x33,
-    0xDB,
-    0x46,
-    0xC9,
-    0xF5,
-    0x81,
-    0xF1,
-    0x63,
-    0x9B,
-    0x0A,
-    0x59,
-    0x8C,
-    0xE4,
-    0xF0,
-    0x65,
-    0xDA,
-    0x09,
-    0x79,
-    0xF4,
-    0x03,
-    0x5A,
-    0xFD,
-    0xAE,
-    0x96,
-    0xEF,
-    0x2D,
-    0x8C,
-    0x36,
-    0x11,
-    0x75,
-    0x42,
-    0x1E,
-    0xA9,
-    0x89,
-    0xC8,
-    0x48,
-    0x08,
-    0x83,
-    0x4F,
-    0xA2,
-    0x8E,
-    0x69,
-    0x00,
-    0x4E,
-    0x89,
-    0x56,
-    0x4C,
-    0x0E,
-    0x95,
-    0x66,
-    0x88,
-    0xCF,
-    0x1C,
-    0x15,
-    0xAD,
-    0x4F,
-    0x6D,
-    0x73,
-    0x89,
-    0x1A,
-    0xC6,
-    0x59,
-    0x6D,
-    0xBB,
-    0x4A,
-    0xAE,
-    0xA6,
-    0x8D,
-    0x43,
-    0x25,
-    0xC5,
-    0x4C,
-    0xA3,
-    0xC6,
-    0xDB,
-    0x96,
-    0xE5,
-    0x52,
-    0x6C,
-    0x82,
-    0x9A,
-    0x82,
-    0x7C,
-    0xB9,
-    0x2F,
-    0x1B,
-    0xE9,
-    0x91,
-    0xCB,
-    0x91,
-    0x77,
-    0xBF,
-    0xD8,
-    0x67,
-    0x55,
-    0x33,
-    0xFD,
-    0x01,
-    0xDF,
-    0xDA,
-    0x24,
-    0xC2,
-    0x78,
-    0x9C,
-    0x2B,
-    0x38,
-    0x83,
-    0x02,
-    0x38,
-    0x3F,
-    0xFC,
-    0x47,
-    0x01,
-    0xF6,
-    0x1F,
-    0x51,
-    0xF9,
-    0xFE,
-    0x58,
-    0xF9,
-    0xF9,
-    0xFF,
-    0x80,
-    0xC4,
-    0x33,
-    0x04,
-    0x9F,
-    0xF5,
-    0x11,
-    0x90,
-    0x65,
-    0x00,
-    0xE7,
-    0xBF,
-    0x67,
-    0x54,
-    0xF8,
-    0xF7,
-    0x9F,
-    0x85,
-    0xE1,
-    0x0F,
-    0x5C,
-    0x5E,
-    0x96,
-    0xE1,
-    0x91,
-    0x3F,
-    0xC3,
-    0x06,
-    0x84,
-    0xFA,
-    0xFB,
-    0x8C,
-    0x0A,
-    0x10,
-    0x69,
-    0x98,
-    0xF9,
-    0xB2,
-    0x0C,
-    0x0C,
-    0x07,
-    0x90,
-    0xED,
-    0xBB,
-    0xCF,
-    0xC0,
-    0xF0,
-    0x0B,
-    0x99,
-    0xEF,
-    0xCF,
-    0xC0,
-    0xF0,
-    0x08,
-    0x99,
-    0xCF,
-    0xC2,
-    0x00,
-    0xB2,
-    0x02,
-    0xCE,
-    0xF7,
-    0x67,
-    0x38,
-    0x20,
-    0x0B,
-    0x51,
-    0x00,
-    0xE1,
-    0x03,
-    0x0D,
-    0xBF,
-    0x0F,
-    0x51,
-    0x00,
-    0x75,
-    0xCF,
-    0x01,
-    0x90,
-    0x15,
-    0x08,
-    0xF7,
-    0xE8,
-    0x02,
-    0x99,
-    0xF7,
-    0x0F,
-    0xE1,
-    0xF6,
-    0x1F,
-    0x6E,
-    0xBE,
-    0xFD,
-    0x03,
-    0x54,
-    0xBE,
-    0xBC,
-    0x40,
-    0x28,
-    0x0A,
-    0x60,
-    0x02,
-    0x00,
-    0xA7,
-    0xF6,
-    0x18,
-    0x9F,
-    0x78,
-    0x9C,
-    0xDB,
-    0x78,
-    0x06,
-    0x0D,
-    0xD4,
-    0x30,
-    0x7C,
-    0xBF,
-    0xFF,
-    0xF6,
-    0xFF,
-    0xDD,
-    0x7F,
-    0xF7,
-    0xEF,
-    0xFE,
-    0xBF,
-    0xF7,
-    0x17,
-    0x4C,
-    0xBF,
-    0xFD,
-    0xCF,
-    0xF0,
-    0x83,
-    0x2D,
-    0x60,
-    0x3D,
-    0xC3,
-    0x47,
-    0x3E,
-    0x86,
-    0xBF,
-    0xCC,
-    0x13,
-    0xEA,
-    0x19,
-    0xBE,
-    0x72,
-    0x33,
-    0x38,
-    0xFC,
-    0x67,
-    0xFC,
-    0xC1,
-    0xE6,
-    0xB0,
-    0x9E,
-    0xE1,
-    0x03,
-    0x1F,
-    0xC3,
-    0x1F,
-    0xA6,
-    0x86,
-    0x7C,
-    0x86,
-    0x2F,
-    0x5C,
-    0x10,
-    0x21,
-    0x90,
-    0x2A,
-    0x7E,
-    0xB8,
-    0xAA,
-    0x00,
-    0xA0,
-    0xD0,
-    0xFB,
-    0x7F,
-    0xFF,
-    0xDF,
-    0xFD,
-    0x7B,
-    0xFF,
-    0xEE,
-    0x3F,
-    0x88,
-    0xFE,
-    0xFF,
-    0xFE,
-    0xDD,
-    0x3F,
-    0x90,
-    0xD0,
-    0xAA,
-    0x3F,
-    0xEB,
-    0x57,
-    0xFD,
-    0x5F,
-    0xFD,
-    0xEA,
-    0xFE,
-    0xAA,
-    0xBF,
-    0xEB,
-    0x4E,
-    0xFD,
-    0x5F,
-    0x75,
-    0x0B,
-    0x28,
-    0x34,
-    0x9F,
-    0xE1,
-    0x23,
-    0x2F,
-    0xC3,
-    0x5F,
-    0xC6,
-    0x09,
-    0xF1,
-    0x0C,
-    0x5F,
-    0x39,
-    0x05,
-    0xEE,
-    0x83,
-    0xCD,
-    0xC2,
-    0x22,
-    0xB4,
-    0x5E,
-    0xF0,
-    0x8B,
-    0x9C,
-    0xE0,
-    0x3F,
-    0xE1,
-    0x8D,
-    0xF5,
-    0x82,
-    0xDF,
-    0xA5,
-    0x1C,
-    0xDF,
-    0x33,
-    0x82,
-    0x84,
-    0xFE,
-    0xA3,
-    0x00,
-    0x3E,
-    0xB0,
-    0xD0,
-    0xFC,
-    0x95,
-    0xFF,
-    0x67,
-    0xFD,
-    0x3C,
-    0x3F,
-    0xF3,
-    0xEF,
-    0xBC,
-    0x93,
-    0xFF,
-    0x67,
-    0xFE,
-    0xE2,
-    0x07,
-    0x0B,
-    0x71,
-    0x33,
-    0xFC,
-    0x67,
-    0xD8,
-    0x60,
-    0xCF,
-    0xF0,
-    0x9D,
-    0xDD,
-    0x60,
-    0x3F,
-    0xC3,
-    0x07,
-    0x9C,
-    0x42,
-    0xB2,
-    0x8A,
-    0xFF,
-    0x85,
-    0x0E,
-    0xE6,
-    0x0B,
-    0xFE,
-    0x94,
-    0x0A,
-    0xBC,
-    0x2F,
-    0xF8,
-    0x49,
-    0xBF,
-    0x10,
-    0xC3,
-    0x78,
-    0x20,
-    0x00,
-    0x0B,
-    0xE5,
-    0xA7,
-    0x41,
-    0x41,
-    0x1B,
-    0x5C,
-    0x88,
-    0x97,
-    0x01,
-    0x0A,
-    0x04,
-    0x70,
-    0x09,
-    0x7D,
-    0x07,
-    0x12,
-    0x71,
-    0x2E,
-    0x50,
-    0x50,
-    0x02,
-    0x16,
-    0xFA,
-    0x8A,
-    0x6E,
-    0xFA,
-    0x7B,
-    0x06,
-    0x83,
-    0x50,
-    0x34,
-    0x20,
-    0xCA,
-    0x00,
-    0x00,
-    0x2F,
-    0x7B,
-    0xF4,
-    0x8C,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x00,
-    0x82,
-    0x80,
-    0x33,
-    0x48,
-    0xC0,
-    0x1A,
-    0x24,
-    0xC2,
-    0xF0,
-    0xED,
-    0x3F,
-    0x12,
-    0x58,
-    0x0F,
-    0x12,
-    0x49,
-    0xF8,
-    0x8F,
-    0x21,
-    0xF4,
-    0x1D,
-    0x43,
-    0xA8,
-    0x01,
-    0xCC,
-    0xCA,
-    0x07,
-    0xE2,
-    0xF7,
-    0xDF,
-    0xA0,
-    0x42,
-    0x3F,
-    0xC1,
-    0x42,
-    0xCC,
-    0x5F,
-    0xFE,
-    0xFF,
-    0xB7,
-    0x73,
-    0x80,
-    0x08,
-    0x4D,
-    0x00,
-    0x8B,
-    0x9C,
-    0x67,
-    0x70,
-    0xF8,
-    0xFF,
-    0x9E,
-    0x59,
-    0xE0,
-    0x2F,
-    0x58,
-    0xE8,
-    0x17,
-    0xC4,
-    0x08,
-    0x1E,
-    0x86,
-    0x2F,
-    0xF6,
-    0x0C,
-    0x17,
-    0xC1,
-    0xAA,
-    0x36,
-    0x40,
-    0x4D,
-    0x05,
-    0x2A,
-    0x03,
-    0x2B,
-    0x02,
-    0x0A,
-    0xFD,
-    0x86,
-    0xD9,
-    0x24,
-    0xC3,
-    0x00,
-    0x56,
-    0xF4,
-    0x7F,
-    0xFD,
-    0x01,
-    0xB8,
-    0xE5,
-    0xFB,
-    0x19,
-    0x18,
-    0xFE,
-    0x80,
-    0x85,
-    0x1C,
-    0xE0,
-    0x42,
-    0xF6,
-    0x0C,
-    0x0C,
-    0x5F,
-    0x20,
-    0xEE,
-    0xFA,
-    0x02,
-    0x13,
-    0x62,
-    0x16,
-    0x60,
-    0x74,
-    0x80,
-    0x08,
-    0x19,
-    0xC0,
-    0x15,
-    0x5D,
-    0x94,
-    0x01,
-    0xCB,
-    0x03,
-    0x1D,
-    0xF1,
-    0x18,
-    0xA6,
-    0xE8,
-    0xEF,
-    0x79,
-    0x46,
-    0xA8,
-    0x53,
-    0x15,
-    0xFE,
-    0x81,
-    0x44,
-    0xEE,
-    0x33,
-    0x02,
-    0xAD,
-    0x93,
-    0x81,
-    0x3A,
-    0x95,
-    0xE1,
-    0x11,
-    0x58,
-    0x95,
-    0x0E,
-    0x90,
-    0x77,
-    0xFE,
-    0x12,
-    0xD4,
-    0x8F,
-    0x10,
-    0x65,
-    0xA8,
-    0x81,
-    0x73,
-    0x11,
-    0x53,
-    0x08,
-    0xEC,
-    0x0F,
-    0x54,
-    0x21,
-    0x86,
-    0x83,
-    0xC8,
-    0x42,
-    0xFD,
-    0x60,
-    0x21,
-    0x86,
-    0x50,
-    0x24,
-    0xC0,
-    0x02,
-    0x00,
-    0x59,
-    0x99,
-    0x22,
-    0xB0,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x80,
-    0x82,
-    0x43,
-    0xEF,
-    0xDE,
-    0xD5,
-    0xC2,
-    0xD8,
-    0x0C,
-    0x37,
-    0xD3,
-    0xD2,
-    0x7E,
-    0xC1,
-    0x39,
-    0x3B,
-    0x19,
-    0x18,
-    0xBE,
-    0x61,
-    0x70,
-    0x02,
-    0x90,
-    0x39,
-    0xB3,
-    0x91,
-    0x38,
-    0x1B,
-    0xE6,
-    0x23,
-    0x71,
-    0x5E,
-    0xCF,
-    0x45,
-    0x70,
-    0x36,
-    0xE8,
-    0xCD,
-    0x41,
-    0x70,
-    0x5E,
-    0x33,
-    0xBD,
-    0x39,
-    0x03,
-    0x04,
-    0xFB,
-    0x40,
-    0x9C,
-    0x0D,
-    0x7A,
-    0x0C,
-    0x6D,
-    0x1D,
-    0x40,
-    0x90,
-    0x01,
-    0xE2,
-    0xBC,
-    0x66,
-    0x82,
-    0x5B,
-    0xF5,
-    0x6D,
-    0x83,
-    0x3E,
-    0x03,
-    0x82,
-    0xD3,
-    0x10,
-    0x8F,
-    0xC4,
-    0x61,
-    0xF8,
-    0xC1,
-    0x8A,
-    0xC4,
-    0x01,
-    0x4A,
-    0x9D,
-    0x3C,
-    0x03,
-    0x01,
-    0x77,
-    0x19,
-    0x80,
-    0x52,
-    0x67,
-    0xCA,
-    0x21,
-    0x40,
-    0x9D,
-    0x01,
-    0x28,
-    0x35,
-    0x07,
-    0xA1,
-    0x8D,
-    0xE1,
-    0xC7,
-    0x3C,
-    0x24,
-    0x4E,
-    0xC3,
-    0x7C,
-    0x24,
-    0x0E,
-    0xC3,
-    0x0C,
-    0x64,
-    0x8E,
-    0x02,
-    0x8C,
-    0x01,
-    0x00,
-    0x42,
-    0x4E,
-    0x3C,
-    0x11,
-    0x78,
-    0x9C,
-    0x13,
-    0x10,
-    0x04,
-    0x01,
-    0x86,
-    0xCF,
-    0xFF,
-    0x41,
-    0x80,
-    0x0D,
-    0x46,
-    0x9D,
-    0x9F,
-    0x39,
-    0x73,
-    0x27,
-    0x90,
-    0xAA,
-    0x67,
-    0x60,
-    0x70,
-    0xA0,
-    0x2D,
-    0x75,
-    0x7F,
-    0xF7,
-    0xEE,
-    0xD3,
-    0x08,
-    0x6B,
-    0x21,
-    0x14,
-    0x00,
-    0x03,
-    0x86,
-    0x48,
-    0x02,
-    0x78,
-    0x9C,
-    0x63,
-    0x60,
-    0x10,
-    0xF8,
-    0x3F,
-    0x9F,
-    0x01,
-    0x04,
-    0x26,
-    0xFC,
-    0xFF,
-    0xCF,
-    0x04,
-    0xA2,
-    0x3F,
-    0xED,
-    0xFF,
-    0xCF,
-    0x05,
-    0xA2,
-    0x7F,
-    0xC9,
-    0xFF,
-    0xD4,
-    0x07,
-    0x52,
-    0x06,
-    0xFF,
-    0x39,
-    0x3E,
-    0xEE,
-    0x07,
-    0xD2,
-    0x1B,
-    0xFE,
-    0x33,
-    0x4E,
-    0xF8,
-    0xCF,
-    0xCC,
-    0xC0,
-    0xF0,
-    0xA5,
-    0x1E,
-    0xA8,
-    0x83,
-    0x87,
-    0x81,
-    0xE1,
-    0x0F,
-    0x1F,
-    0x03,
-    0xC3,
-    0x0F,
-    0x7F,
-    0x86,
-    0x80,
-    0xFF,
-    0x6C,
-    0x0C,
-    0x0C,
-    0x0F,
-    0xCE,
-    0x33,
-    0x5C,
-    0x78,
-    0x0F,
-    0x54,
-    0x53,
-    0xF0,
-    0x9F,
-    0xF5,
-    0xC2,
-    0x7D,
-    0x20,
-    0x9D,
-    0xF0,
-    0x9F,
-    0x15,
-    0x26,
-    0x0E,
-    0x56,
-    0xF7,
-    0xDD,
-    0x1F,
-    0xA8,
-    0x2F,
-    0x9F,
-    0x81,
-    0xE1,
-    0x1F,
-    0x50,
-    0xDF,
-    0x86,
-    0xF7,
-    0x40,
-    0x65,
-    0xCC,
-    0x20,
-    0x73,
-    0xD9,
-    0x1F,
-    0xEC,
-    0x07,
-    0xDB,
-    0xC3,
-    0xF7,
-    0x43,
-    0x1F,
-    0x6C,
-    0x6F,
-    0x3F,
-    0xC4,
-    0x5E,
-    0x98,
-    0x3B,
-    0x20,
-    0xEE,
-    0x02,
-    0x00,
-    0x97,
-    0x37,
-    0x34,
-    0x2A,
+    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0xFB, 0xF0, 0x9F, 0xE1, 0xC3, 0x7B,
+    0x28, 0x7A, 0x70, 0x1F, 0x84, 0x2E, 0x00, 0xD1, 0x79, 0x10, 0x3A, 0x00, 0x44, 0xFB, 0x41, 0x68,
+    0x03, 0x10, 0xAD, 0x67, 0x80, 0x00, 0x20, 0xFB, 0xDB, 0x7F, 0xF6, 0x6F, 0xFF, 0xD9, 0x16, 0xEC,
+    0x67, 0x00, 0x00, 0xF1, 0xD9, 0x1E, 0x18, 0x78, 0x9C, 0x01, 0x28, 0x00, 0xD7, 0xFF, 0xF3, 0x9F,
+    0x00, 0xFF, 0x0D, 0xF2, 0x8F, 0x00, 0xFE, 0x0C, 0xF1, 0x8F, 0x00, 0xFD, 0x0C, 0xF1, 0x7F, 0x00,
+    0xFD, 0x0B, 0xF0, 0x6F, 0x00, 0xFC, 0x0A, 0xF0, 0x5F, 0x00, 0xFB, 0x09, 0xE0, 0x4F, 0x00, 0xFA,
+    0x08, 0xD0, 0x3F, 0x00, 0xF9, 0x07, 0xA2, 0x21, 0x13, 0x23, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0xCB,
+    0xCE, 0xF0, 0xC1, 0x9E, 0x81, 0x81, 0xE1, 0x3F, 0x0B, 0xC3, 0x67, 0x79, 0x06, 0x06, 0x81, 0xFF,
+    0x4C, 0x0C, 0x5F, 0xF9, 0x18, 0x18, 0x1C, 0xFE, 0x33, 0x30, 0x7C, 0xE7, 0x61, 0x28, 0xF8, 0x0F,
+    0x06, 0x5C, 0x30, 0x5A, 0x60, 0xF3, 0x7E, 0x63, 0xE3, 0x7F, 0x16, 0x4C, 0x0C, 0x07, 0xFA, 0xC1,
+    0x5A, 0x18, 0x2E, 0xE4, 0x83, 0xB5, 0x30, 0x7C, 0xF0, 0x67, 0x30, 0x00, 0x6A, 0x61, 0xF8, 0xA8,
+    0xCF, 0x10, 0x00, 0xA2, 0x3F, 0xF3, 0x33, 0x14, 0xDC, 0x07, 0xD2, 0x40, 0xB3, 0x26, 0xEC, 0x67,
+    0x60, 0xF8, 0x09, 0xD6, 0x3E, 0x1F, 0x4E, 0x1B, 0xFE, 0xB1, 0x34, 0xFE, 0x9C, 0x2F, 0xCC, 0xC0,
+    0xF0, 0x97, 0x0D, 0xA4, 0x05, 0x62, 0x3D, 0x3F, 0x03, 0x83, 0x02, 0xAA, 0xF5, 0x0C, 0x00, 0x4C,
+    0xA9, 0x3F, 0x8B, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xC2, 0xCF, 0x00, 0x06, 0x38, 0x68, 0x81,
+    0xEF, 0xF6, 0x20, 0x4A, 0xE1, 0xF7, 0xFF, 0xFF, 0x7D, 0x40, 0xFA, 0xF3, 0x7F, 0x20, 0xD0, 0x63,
+    0x60, 0xF8, 0xB7, 0x9E, 0xD9, 0xF1, 0x57, 0x3C, 0x83, 0xC3, 0x7F, 0x2E, 0x06, 0x06, 0x07, 0x36,
+    0x86, 0x82, 0xFF, 0xAC, 0x60, 0xD5, 0x09, 0xFF, 0xD9, 0xC0, 0xB4, 0xC1, 0x7F, 0x59, 0x88, 0x29,
+    0xBF, 0xDF, 0x8B, 0x83, 0xE9, 0x8D, 0xFF, 0xFF, 0x47, 0x83, 0x19, 0x57, 0xFF, 0xFF, 0xAF, 0x03,
+    0x33, 0x9A, 0xFF, 0xFD, 0xE7, 0x01, 0x33, 0x02, 0xFE, 0xCD, 0x87, 0xA8, 0x7D, 0xF8, 0x9F, 0x11,
+    0x4C, 0x4F, 0xF8, 0xCF, 0x0C, 0xA6, 0x1B, 0xFE, 0xB3, 0x80, 0xE9, 0x0D, 0xFF, 0x99, 0x13, 0xFC,
+    0x40, 0x2E, 0x7A, 0x0F, 0x54, 0x92, 0x63, 0xB2, 0xF4, 0x7F, 0x3C, 0x83, 0xC1, 0x5F, 0x90, 0x3B,
+    0xD8, 0x81, 0x9A, 0x5F, 0xFF, 0x7F, 0xAF, 0x89, 0xCF, 0xFD, 0x70, 0xBA, 0x08, 0xA8, 0x9A, 0x01,
+    0x00, 0x7B, 0xF7, 0x3E, 0xAD, 0x78, 0x9C, 0x3D, 0xCF, 0x3B, 0x0A, 0xC2, 0x40, 0x10, 0x80, 0xE1,
+    0x7F, 0x1B, 0x89, 0x0F, 0x42, 0x3C, 0x81, 0xE2, 0x05, 0xC4, 0xD2, 0x4A, 0x8B, 0xF4, 0xF1, 0x00,
+    0x42, 0x2A, 0x7B, 0x6F, 0xA2, 0x78, 0x81, 0x78, 0x04, 0x6F, 0x10, 0x0B, 0x4B, 0x21, 0x1E, 0xC1,
+    0xCE, 0xCE, 0x60, 0x04, 0x13, 0xB6, 0x70, 0x9D, 0x4C, 0x82, 0x0B, 0xB3, 0x0C, 0x7C, 0xF3, 0x60,
+    0xA0, 0x79, 0x1B, 0x89, 0x8B, 0x5B, 0xCB, 0x1F, 0x7C, 0x3D, 0xB6, 0xCE, 0xB9, 0x2E, 0x9C, 0x72,
+    0x43, 0x91, 0x86, 0x36, 0x82, 0x4F, 0x0C, 0x95, 0xCF, 0x3D, 0x21, 0x70, 0x3D, 0xB0, 0x7D, 0x8E,
+    0x99, 0xBA, 0xA6, 0xA9, 0x3A, 0xA5, 0xCF, 0x2D, 0x51, 0xE7, 0x25, 0x6D, 0x53, 0x75, 0x56, 0x32,
+    0xAC, 0xA3, 0x0E, 0x87, 0xEB, 0x7C, 0x2C, 0x3E, 0x69, 0x96, 0x9E, 0x73, 0xF3, 0x70, 0x3B, 0x4D,
+    0xCB, 0x78, 0x2F, 0x65, 0x75, 0xA7, 0xF8, 0x3B, 0x19, 0x56, 0x51, 0xE3, 0x55, 0x3D, 0x52, 0xBD,
+    0x5D, 0x54, 0x3B, 0x76, 0xA0, 0xA9, 0x38, 0xE5, 0x48, 0x0B, 0xC4, 0x29, 0xB2, 0xD0, 0x2E, 0xD4,
+    0xF5, 0x00, 0x8F, 0xE5, 0xD3, 0xFC, 0xCF, 0x9A, 0xB5, 0x87, 0xF2, 0x03, 0x14, 0x39, 0x51, 0xFB,
+    0x78, 0x9C, 0x25, 0x8E, 0xB1, 0x09, 0xC2, 0x50, 0x18, 0x84, 0x2F, 0x10, 0x44, 0x10, 0xE5, 0x2D,
+    0x20, 0x66, 0x00, 0xD1, 0xC6, 0x3E, 0x8A, 0x0B, 0xBC, 0x0D, 0xE2, 0x06, 0x3A, 0x80, 0x82, 0x9D,
+    0x9D, 0x56, 0xA9, 0xCD, 0x02, 0xE2, 0x08, 0xCF, 0x0D, 0x44, 0x17, 0x08, 0x92, 0x4A, 0x1B, 0x9B,
+    0x18, 0x94, 0x68, 0xCE, 0x3F, 0xEF, 0xFD, 0xD5, 0xC7, 0x71, 0x77, 0xFF, 0x21, 0xB8, 0x3F, 0x97,
+    0xB0, 0x97, 0x93, 0xEC, 0x5A, 0xAA, 0x76, 0xD3, 0xF2, 0x58, 0xC3, 0x98, 0x4D, 0x9C, 0x58, 0xD3,
+    0x8C, 0x3E, 0xD6, 0xF4, 0xAC, 0xD6, 0x40, 0x42, 0xE7, 0x6B, 0x23, 0xDF, 0xBB, 0xAC, 0xD1, 0x6C,
+    0x59, 0x5A, 0xB0, 0x72, 0x12, 0xD4, 0x4F, 0x9C, 0x98, 0x08, 0x65, 0xE4, 0x00, 0x28, 0x42, 0xC9,
+    0xF6, 0x33, 0x29, 0x2A, 0x3B, 0xB8, 0xA5, 0x08, 0xAA, 0x48, 0x49, 0x7F, 0x11, 0x01, 0x17, 0x6E,
+    0xA4, 0xFB, 0x33, 0x14, 0x6F, 0xC9, 0x39, 0xF0, 0x0E, 0x85, 0x12, 0xF6, 0x80, 0x97, 0x11, 0xBA,
+    0x32, 0xF5, 0x64, 0xC7, 0x6A, 0x14, 0x73, 0x2B, 0x4D, 0xEA, 0x2B, 0x4B, 0x8D, 0x57, 0x9C, 0x01,
+    0xFD, 0xE0, 0xC1, 0x87, 0x76, 0xAF, 0xDD, 0xFD, 0x01, 0x73, 0xF2, 0x49, 0xEF, 0x78, 0x9C, 0xFB,
+    0x3C, 0xFF, 0x53, 0xFF, 0xC7, 0xFE, 0x8F, 0xF5, 0x1F, 0xF2, 0x3F, 0xC4, 0x3F, 0xF0, 0xBF, 0x60,
+    0x0F, 0x00, 0x64, 0xB2, 0x0A, 0xF0, 0x78, 0x9C, 0x63, 0x60, 0x08, 0x60, 0x64, 0x60, 0xF8, 0x2C,
+    0xC7, 0xC0, 0xF0, 0x97, 0x8B, 0xA1, 0xE1, 0x3D, 0x23, 0xC3, 0xA7, 0x7A, 0x06, 0x86, 0xDF, 0x7C,
+    0x0C, 0x0A, 0xFF, 0xD9, 0x19, 0x26, 0xFC, 0x67, 0x64, 0x78, 0x70, 0x1E, 0x28, 0x0B, 0x14, 0xFA,
+    0x16, 0xCF, 0xC0, 0xF0, 0x53, 0x1F, 0x28, 0x25, 0xCF, 0xC0, 0xF0, 0x87, 0x1F, 0x81, 0x7F, 0x03,
+    0xF1, 0x2F, 0xA0, 0xD8, 0x0F, 0x7B, 0x06, 0x86, 0xAF, 0xF9, 0x0C, 0x0C, 0x1F, 0xE7, 0x33, 0x30,
+    0x1C, 0x78, 0xCF, 0xC0, 0x90, 0xF0, 0x9F, 0x99, 0x81, 0xE1, 0x1F, 0x17, 0x03, 0xC3, 0x77, 0xA0,
+    0xA6, 0x0B, 0xEB, 0x19, 0x18, 0x1C, 0xFE, 0xB3, 0x00, 0x4D, 0xE0, 0x05, 0x72, 0x38, 0x19, 0x80,
+    0x00, 0x00, 0x86, 0xE9, 0x23, 0x11, 0x78, 0x9C, 0x4B, 0x60, 0x64, 0x60, 0xF8, 0xC1, 0xC5, 0xC0,
+    0xF0, 0x39, 0x9E, 0x81, 0x61, 0xC2, 0x7B, 0x06, 0x06, 0x81, 0x7F, 0x9C, 0x0C, 0x0C, 0xDF, 0xF5,
+    0x19, 0x18, 0x3E, 0xCC, 0x07, 0x0A, 0xFC, 0x67, 0x60, 0x08, 0xF8, 0xCF, 0xCA, 0x20, 0xF0, 0x1F,
+    0xA8, 0xE2, 0x1F, 0x2F, 0x03, 0xC3, 0x6F, 0x7E, 0x06, 0x86, 0x9F, 0x40, 0xC9, 0x9F, 0xF6, 0x40,
+    0x5D, 0xFE, 0x40, 0x6C, 0x0F, 0xE1, 0xFF, 0x92, 0x67, 0x60, 0xF8, 0x03, 0x94, 0xFB, 0xCF, 0xC3,
+    0xA0, 0xF0, 0x9F, 0x83, 0xA1, 0xE0, 0x3F, 0x33, 0xC3, 0x81, 0xFB, 0x40, 0x43, 0xF3, 0x81, 0x52,
+    0x7C, 0x0C, 0x06, 0x40, 0x23, 0x0E, 0xEC, 0x07, 0x1A, 0x2B, 0xC7, 0xC0, 0xF0, 0x84, 0x95, 0x01,
+    0x0C, 0x00, 0x58, 0xA7, 0x22, 0x9A, 0x78, 0x9C, 0x63, 0x60, 0x78, 0xB0, 0x9E, 0x01, 0x04, 0x0E,
+    0xCC, 0x07, 0x53, 0x1B, 0xEA, 0x81, 0xC4, 0x05, 0xAB, 0x09, 0xF9, 0x01, 0x6B, 0x18, 0x3E, 0xFD,
+    0xDF, 0xB3, 0xFE, 0xEF, 0x7B, 0x86, 0xA6, 0xD7, 0xFF, 0xFF, 0xBF, 0xAF, 0x02, 0x0A, 0x7F, 0xFB,
+    0xCF, 0x0C, 0x24, 0x15, 0xFE, 0xFD, 0xE6, 0x01, 0x52, 0x17, 0xF7, 0x3F, 0xD8, 0x0F, 0xA4, 0x7E,
+    0xEB, 0x07, 0xFC, 0xE7, 0x60, 0x60, 0xB8, 0xC4, 0xC9, 0xB0, 0x86, 0x11, 0x6C, 0x00, 0x90, 0x04,
+    0x00, 0x0C, 0xDE, 0x1C, 0x95, 0x78, 0x9C, 0x63, 0x60, 0xF8, 0x50, 0xCF, 0x00, 0x04, 0xE8, 0xE4,
+    0xE7, 0xFF, 0x40, 0x70, 0x1E, 0x42, 0x1A, 0x18, 0x7F, 0x9E, 0x6F, 0xAC, 0x8C, 0xA9, 0x06, 0x42,
+    0x02, 0x00, 0x65, 0xA2, 0x19, 0x40, 0x78, 0x9C, 0x5B, 0xB0, 0x9E, 0xE1, 0xDB, 0x7F, 0xB6, 0xEF,
+    0xFF, 0xD9, 0x1F, 0xFD, 0x67, 0xB9, 0xF0, 0x9E, 0xE1, 0x63, 0x3D, 0xC3, 0x57, 0x79, 0x86, 0x1F,
+    0x5C, 0x0C, 0x7F, 0x98, 0x19, 0x00, 0xD7, 0x99, 0x0D, 0x71, 0x78, 0x9C, 0x33, 0x30, 0x36, 0x36,
+    0x66, 0xFE, 0xF2, 0xFF, 0xFF, 0x7F, 0x7E, 0x30, 0x01, 0x00, 0x3A, 0x59, 0x08, 0xCD, 0x78, 0x9C,
+    0xDB, 0xB0, 0x9E, 0xE1, 0xFB, 0x7F, 0xB6, 0x6F, 0xFF, 0xD9, 0x36, 0xAC, 0x67, 0x00, 0x00, 0x2E,
+    0xE7, 0x06, 0xB6, 0x78, 0x9C, 0x2D, 0xCD, 0xD9, 0x0D, 0x41, 0x01, 0x10, 0x85, 0xE1, 0x1F, 0xC1,
+    0xB5, 0xEB, 0xE0, 0x96, 0x40, 0x09, 0x3A, 0x50, 0x02, 0xD1, 0x00, 0x9D, 0xD0, 0x01, 0x1D, 0xD0,
+    0x09, 0x8F, 0xDE, 0xE8, 0xC0, 0x12, 0xFB, 0x92, 0xF1, 0xDF, 0xC4, 0x3C, 0x7C, 0xC9, 0x39, 0x99,
+    0xC9, 0x00, 0xA3, 0x3C, 0x70, 0x6F, 0xC9, 0xBB, 0x26, 0x51, 0x86, 0x6E, 0x14, 0x60, 0x72, 0x30,
+    0xAD, 0x96, 0x72, 0x1C, 0xCB, 0xA5, 0x23, 0x8F, 0xA6, 0x7C, 0xAA, 0xD9, 0x5A, 0x09, 0x7A, 0xE1,
+    0xE9, 0x6C, 0x67, 0xDA, 0xCC, 0xE5, 0x34, 0x90, 0x6B, 0x2A, 0xCF, 0x86, 0x7C, 0x2B, 0xD0, 0x8E,
+    0x22, 0x0C, 0x23, 0x07, 0x8B, 0xB5, 0xD5, 0x7E, 0x2A, 0xE7, 0xBE, 0xDC, 0xB2, 0x7F, 0xAF, 0xBA,
+    0x6C, 0x13, 0xFE, 0xF3, 0x03, 0xB6, 0x30, 0x1F, 0x07, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xF6, 0xAF,
+    0x97, 0x91, 0x81, 0xE1, 0xC0, 0xFF, 0xFF, 0xFF, 0xF5, 0x18, 0x18, 0x7E, 0xED, 0x37, 0xF9, 0xF1,
+    0x9E, 0xC1, 0xE0, 0x3F, 0x17, 0x43, 0xC2, 0x7F, 0xF6, 0x09, 0xFF, 0x99, 0x18, 0x18, 0xFE, 0xF1,
+    0x3D, 0xB8, 0xCF, 0xC0, 0xC0, 0xF0, 0xD3, 0xFE, 0xE3, 0x7A, 0x20, 0xF5, 0x35, 0xFF, 0x4B, 0x3F,
+    0x90, 0xFA, 0xDC, 0xFF, 0xB5, 0x1E, 0x48, 0x7D, 0x9A, 0xFF, 0x35, 0x1F, 0x44, 0xAD, 0x87, 0x51,
+    0x10, 0x41, 0xB0, 0x92, 0x2F, 0xFD, 0x50, 0x0D, 0x10, 0xED, 0xFA, 0x50, 0xC3, 0xA0, 0x46, 0x83,
+    0x2D, 0xBA, 0x0F, 0xB7, 0x16, 0xE2, 0x08, 0x00, 0xC0, 0x18, 0x3C, 0x90, 0x78, 0x9C, 0x63, 0x60,
+    0x58, 0xF8, 0x9F, 0x8D, 0x21, 0xE0, 0xDF, 0x7F, 0x36, 0x81, 0x5F, 0xFF, 0xFF, 0xB3, 0x3D, 0xFB,
+    0x5F, 0xF3, 0x9F, 0xED, 0x57, 0xBD, 0xC3, 0x7F, 0xB6, 0x85, 0x8C, 0x40, 0x82, 0x81, 0x81, 0x1A,
+    0x04, 0x00, 0x6C, 0x29, 0x20, 0xD9, 0x78, 0x9C, 0x63, 0x70, 0x78, 0xF5, 0x3E, 0x9A, 0x81, 0x41,
+    0xE0, 0xF7, 0xFF, 0xFF, 0xFF, 0xB9, 0x19, 0x0E, 0xFC, 0x8F, 0x0E, 0xFE, 0xBB, 0x9E, 0x61, 0x42,
+    0x3E, 0x03, 0xC3, 0x85, 0xFF, 0x4C, 0x0C, 0x4C, 0x0C, 0x0C, 0x05, 0xFF, 0xD9, 0x18, 0x80, 0x20,
+    0xE0, 0x3F, 0x3B, 0x88, 0x4A, 0x80, 0xF0, 0x26, 0xFC, 0x67, 0x06, 0x51, 0x1F, 0xEE, 0x83, 0x48,
+    0x86, 0x9F, 0xF1, 0x20, 0xD2, 0x01, 0xA8, 0x1D, 0x08, 0x1E, 0xBE, 0x67, 0x04, 0x51, 0x7F, 0xEC,
+    0x41, 0xE4, 0x86, 0xFF, 0xAC, 0x20, 0xEA, 0x57, 0x3E, 0x44, 0x13, 0xD8, 0x88, 0x1F, 0xF5, 0x20,
+    0xB2, 0xE0, 0xBF, 0x95, 0xB1, 0xB1, 0x31, 0xD3, 0x85, 0xFF, 0x20, 0xC0, 0x07, 0xA1, 0xB8, 0x01,
+    0x31, 0xB8, 0x2E, 0xCF, 0x78, 0x9C, 0x63, 0x08, 0x78, 0xF5, 0x3E, 0x9B, 0x81, 0x41, 0xE0, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x65, 0x18, 0x36, 0xFC, 0xF7, 0x08, 0xFE, 0xB3, 0x9F, 0x41, 0x40, 0x92, 0x81,
+    0xE1, 0xC0, 0x7F, 0x26, 0x06, 0x20, 0x48, 0xF8, 0xCF, 0x82, 0x44, 0x1D, 0x78, 0x0F, 0x22, 0x0D,
+    0xFE, 0xF8, 0x03, 0xC9, 0x07, 0xFF, 0xE7, 0x83, 0x54, 0x7C, 0xFC, 0x7F, 0x9F, 0x1D, 0x24, 0x16,
+    0xFC, 0x6B, 0x3F, 0x48, 0x8E, 0xA1, 0xE0, 0x3F, 0x3B, 0x98, 0xFE, 0xCF, 0x03, 0xA6, 0xFE, 0xF2,
+    0x81, 0xA9, 0x7F, 0xBC, 0x20, 0x52, 0xE1, 0x3F, 0xF7, 0x02, 0x69, 0x06, 0xA0, 0x2D, 0xAC, 0x5F,
+    0xDE, 0x83, 0x2D, 0x0A, 0x00, 0xDA, 0xFA, 0x1F, 0x28, 0x52, 0xF8, 0xE6, 0xBE, 0x17, 0x03, 0x03,
+    0x00, 0x85, 0x2B, 0x2D, 0x81, 0x78, 0x9C, 0x63, 0x60, 0x10, 0xD0, 0x64, 0x00, 0x81, 0x86, 0xFF,
+    0x8C, 0x20, 0xEA, 0xC3, 0x7E, 0x30, 0xEF, 0xBB, 0x3D, 0x98, 0xFA, 0xC7, 0x03, 0x22, 0x03, 0xFE,
+    0xB3, 0x82, 0xA8, 0x03, 0xEF, 0xC1, 0x62, 0x9F, 0xEB, 0xC1, 0xD4, 0x6F, 0x7E, 0x86, 0x2F, 0xF2,
+    0x0C, 0x0A, 0xFF, 0x39, 0x41, 0xD4, 0x84, 0xFF, 0x4C, 0x0C, 0x5F, 0xE5, 0x19, 0x3E, 0xAE, 0x67,
+    0x60, 0xF8, 0x26, 0x0F, 0xD6, 0x0C, 0xA4, 0xFE, 0xFE, 0x07, 0x81, 0xF5, 0x50, 0xCA, 0xC8, 0xD8,
+    0xD8, 0xF8, 0xA7, 0xBF, 0x30, 0xD8, 0x70, 0x79, 0x06, 0xAC, 0x14, 0x00, 0x3C, 0x8E, 0x29, 0xE7,
+    0x78, 0x9C, 0x63, 0x30, 0x32, 0x06, 0x02, 0x46, 0x86, 0x7F, 0xFF, 0x81, 0x80, 0x03, 0x42, 0xB1,
+    0x32, 0xFC, 0xE3, 0x62, 0x00, 0x01, 0xBC, 0x54, 0xF7, 0xDF, 0x7D, 0x2C, 0x0C, 0x60, 0x0D, 0xFD,
+    0x0C, 0x0C, 0x77, 0xB2, 0x9D, 0x7F, 0x00, 0xF5, 0x01, 0x81, 0xC1, 0x7F, 0x5E, 0xB0, 0xFC, 0x1F,
+    0x79, 0x30, 0xF5, 0xC3, 0x1E, 0x42, 0xF9, 0x83, 0xA9, 0x9F, 0xFA, 0x10, 0xBD, 0x7C, 0x06, 0x3A,
+    0x0C, 0x0C, 0x05, 0xFF, 0x39, 0x1E, 0xFC, 0xF7, 0x74, 0xFE, 0x75, 0x9F, 0xC1, 0xE0, 0x2F, 0xD0,
+    0x14, 0xA0, 0x48, 0xC2, 0xEB, 0xF7, 0xD9, 0x0C, 0x0C, 0x00, 0xA3, 0xC7, 0x2F, 0x9C, 0x78, 0x9C,
+    0x63, 0x60, 0x68, 0xFC, 0x7B, 0x5F, 0x82, 0x81, 0xC1, 0xE0, 0xDF, 0xFF, 0xFF, 0xE7, 0x19, 0x18,
+    0x3E, 0xFD, 0xB7, 0x48, 0xF1, 0x65, 0x60, 0xF8, 0x63, 0xCF, 0x00, 0x04, 0x0E, 0xFF, 0xD9, 0x41,
+    0xD4, 0x84, 0xFF, 0x20, 0x92, 0xE1, 0xC1, 0x7E, 0x06, 0x05, 0x46, 0xA0, 0x8A, 0xFA, 0x86, 0xFF,
+    0xEF, 0x39, 0x18, 0x3E, 0xE7, 0xFF, 0x05, 0x69, 0xF8, 0xFA, 0xBE, 0x9F, 0x69, 0xD1, 0x7F, 0x8E,
+    0x6F, 0xFF, 0x59, 0x18, 0x18, 0xFE, 0xF2, 0x7D, 0xAD, 0x07, 0xAA, 0xFB, 0x61, 0xFF, 0x25, 0x1E,
+    0x48, 0x7D, 0x8D, 0xFF, 0x54, 0x0F, 0xA6, 0x3E, 0xAC, 0x07, 0x52, 0xDF, 0xED, 0x37, 0xBC, 0x07,
+    0x52, 0x7F, 0xF8, 0x03, 0x80, 0x66, 0x3A, 0xFC, 0xE7, 0x64, 0xF8, 0x33, 0xDF, 0xE4, 0xFB, 0x7B,
+    0x46, 0x86, 0x8B, 0xFF, 0xFF, 0xFF, 0xB7, 0x03, 0x4A, 0x1C, 0xFF, 0x57, 0xCB, 0xC8, 0x00, 0x00,
+    0x52, 0xDC, 0x39, 0x89, 0x78, 0x9C, 0x33, 0x30, 0x06, 0x01, 0x86, 0x2F, 0xFF, 0x41, 0x80, 0x11,
+    0x4A, 0x31, 0x00, 0xC1, 0x85, 0xF3, 0x20, 0x92, 0xE1, 0x4B, 0x3E, 0x98, 0xFA, 0xC5, 0x0F, 0x22,
+    0x05, 0xFE, 0x73, 0x82, 0xA8, 0x82, 0xFF, 0xCC, 0x20, 0xEA, 0x01, 0x44, 0xC5, 0x57, 0x88, 0x8A,
+    0xDF, 0x60, 0x15, 0x0A, 0x10, 0x15, 0x0D, 0xFF, 0x99, 0x90, 0x55, 0xC4, 0x83, 0xA9, 0x3F, 0x7C,
+    0x20, 0xD2, 0xE0, 0x3F, 0x07, 0x88, 0x9A, 0x00, 0x51, 0xF1, 0x01, 0xA2, 0xE2, 0x1B, 0x44, 0x45,
+    0x11, 0x0F, 0x88, 0x04, 0x00, 0xEF, 0xA3, 0x24, 0xD2, 0x78, 0x9C, 0x63, 0x10, 0xB8, 0xF1, 0x7F,
+    0x2E, 0x13, 0x03, 0xC3, 0x97, 0xFF, 0xFF, 0xFF, 0xE7, 0x33, 0x28, 0xFC, 0xEF, 0x77, 0x79, 0xFE,
+    0x9F, 0x79, 0xC2, 0x7F, 0x16, 0x06, 0x83, 0xFF, 0xDC, 0x07, 0xEE, 0x33, 0x30, 0x30, 0xFC, 0xE1,
+    0xBB, 0x70, 0x1E, 0x48, 0xFD, 0xE6, 0x5B, 0xF0, 0x9F, 0x91, 0x81, 0xE1, 0x1F, 0x97, 0xC1, 0x7F,
+    0x5D, 0x86, 0x86, 0xF7, 0x4C, 0x0C, 0xDF, 0xFE, 0x47, 0xFF, 0xB2, 0x65, 0x60, 0x70, 0xF8, 0xFF,
+    0xFF, 0x3D, 0x33, 0x03, 0xC3, 0xB7, 0xF9, 0xD7, 0xFF, 0xCF, 0x67, 0x68, 0x00, 0xEA, 0x3B, 0xFC,
+    0x9F, 0xFB, 0xF3, 0x7C, 0x90, 0x86, 0xF8, 0x1F, 0xF6, 0x40, 0xEA, 0xF3, 0xFA, 0x5F, 0xFA, 0x40,
+    0xEA, 0xE3, 0xFE, 0x9F, 0x10, 0xDE, 0x97, 0xFD, 0x60, 0xB9, 0x0D, 0xFF, 0x73, 0x5D, 0xAE, 0xFD,
+    0xE7, 0x66, 0xF8, 0x0D, 0xB4, 0x76, 0x3D, 0xD0, 0x94, 0x5B, 0xFF, 0xE7, 0xB2, 0x30, 0x00, 0x00,
+    0x83, 0x97, 0x40, 0x8C, 0x78, 0x9C, 0x63, 0x30, 0xB8, 0xF5, 0x3E, 0x9A, 0x81, 0x81, 0xE1, 0xC7,
+    0xFF, 0xFF, 0xFF, 0xB9, 0x18, 0x12, 0xFE, 0xC7, 0x06, 0xFF, 0xE9, 0x67, 0xF8, 0x70, 0x9F, 0x81,
+    0xE1, 0xC0, 0x7F, 0xC6, 0x6F, 0xF9, 0x0C, 0x0C, 0x0E, 0xFF, 0xD9, 0x7E, 0xEA, 0x03, 0xE5, 0xFF,
+    0x73, 0xFD, 0x92, 0x07, 0x52, 0xFF, 0x78, 0xC0, 0xBC, 0x7F, 0xBC, 0xDF, 0xFD, 0x19, 0x18, 0x04,
+    0xFE, 0xF1, 0x7E, 0x3A, 0x0F, 0x52, 0xC9, 0xB3, 0xE0, 0xBF, 0x77, 0xF2, 0xDF, 0xFF, 0xDC, 0x02,
+    0x7F, 0xFE, 0xFF, 0x8F, 0xFF, 0xCF, 0xC1, 0x50, 0xF0, 0x77, 0x9D, 0xF1, 0x7F, 0x56, 0xA0, 0x3A,
+    0x86, 0x09, 0xFF, 0x19, 0x41, 0xD4, 0xA7, 0xF5, 0x20, 0x52, 0xE0, 0x2F, 0x48, 0x2F, 0xC3, 0xE3,
+    0xFF, 0x6C, 0x40, 0x72, 0xD1, 0xFF, 0x7A, 0x20, 0xB9, 0xED, 0xFF, 0x7D, 0x66, 0x90, 0x79, 0xE7,
+    0xC1, 0xAA, 0x3B, 0x98, 0x40, 0x24, 0x00, 0x81, 0x4F, 0x36, 0x19, 0x78, 0x9C, 0xDB, 0xB0, 0x9E,
+    0xE1, 0xFB, 0x7F, 0xB6, 0x6F, 0xFF, 0xD9, 0x36, 0xAC, 0x67, 0xC0, 0x0A, 0x36, 0x20, 0x29, 0x00,
+    0x00, 0x3B, 0x47, 0x0D, 0x6B, 0x78, 0x9C, 0xDB, 0xB0, 0x9E, 0xE1, 0xFB, 0x7F, 0xB6, 0x6F, 0xFF,
+    0xD9, 0x36, 0xAC, 0x67, 0xC0, 0x0A, 0x16, 0xAC, 0x67, 0x00, 0xCA, 0x7E, 0xFF, 0xCF, 0xFE, 0xE8,
+    0x3F, 0xCB, 0x85, 0xF7, 0x0C, 0x1F, 0xEB, 0x19, 0xBE, 0xCA, 0x33, 0xFC, 0xE0, 0x62, 0xF8, 0xC3,
+    0xCC, 0x00, 0x00, 0x48, 0xA3, 0x14, 0x26, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x03, 0x87, 0x1C, 0x10,
+    0x19, 0xF0, 0xF7, 0x3E, 0x90, 0x4C, 0xF8, 0xF7, 0x3F, 0x97, 0x81, 0xA1, 0xF0, 0xDF, 0x7F, 0x6F,
+    0x06, 0x86, 0x89, 0xFF, 0xFF, 0x6B, 0x02, 0x85, 0x7E, 0xBC, 0x17, 0x07, 0xC9, 0xFF, 0x88, 0x03,
+    0x2B, 0xFE, 0x06, 0x92, 0x67, 0x60, 0x50, 0xF8, 0xF9, 0xBF, 0x9F, 0x09, 0x48, 0x0B, 0xFC, 0xF8,
+    0xBF, 0x9E, 0x19, 0x24, 0xF0, 0xFC, 0xFF, 0x79, 0xB0, 0xFC, 0xB5, 0xF5, 0x10, 0x43, 0x4D, 0x19,
+    0x00, 0x00, 0x54, 0x1A, 0x9B, 0x78, 0x9C, 0x33, 0x30, 0x06, 0x02, 0xE5, 0xCF, 0xFF, 0x81, 0xE0,
+    0x3C, 0x84, 0x64, 0xC0, 0x00, 0x06, 0x18, 0x6A, 0x00, 0x7F, 0xD6, 0x19, 0x37, 0x78, 0x9C, 0x63,
+    0x60, 0x00, 0x83, 0x03, 0x92, 0x60, 0xEA, 0xCB, 0x7F, 0x2D, 0x10, 0x35, 0xE9, 0xFF, 0x7F, 0x6B,
+    0x10, 0x5D, 0xF8, 0xEF, 0xBF, 0x0F, 0x88, 0x0E, 0xF8, 0xF3, 0x3F, 0x16, 0x44, 0x1B, 0xFC, 0xFA,
+    0xCF, 0x04, 0xA2, 0x27, 0x82, 0xA9, 0x49, 0xFF, 0xDF, 0x33, 0x32, 0x30, 0x6C, 0xF9, 0x7F, 0x9F,
+    0x8D, 0x81, 0xE1, 0xDA, 0xFF, 0xF3, 0xAC, 0x0C, 0x0C, 0x4F, 0xFE, 0xEF, 0x67, 0x01, 0x4A, 0x7C,
+    0x5C, 0xCF, 0x0C, 0x52, 0x95, 0x00, 0x56, 0xCB, 0x00, 0x00, 0x21, 0xBF, 0x1B, 0x4E, 0x78, 0x9C,
+    0x63, 0x50, 0xB8, 0xF9, 0xBF, 0x97, 0x91, 0x81, 0xE1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFD, 0x19, 0x16,
+    0xFC, 0xCF, 0x71, 0xFE, 0xF9, 0x9F, 0x31, 0xA1, 0x9F, 0x81, 0x61, 0xC2, 0x7F, 0x36, 0x06, 0xA0,
+    0x78, 0xC0, 0x7F, 0x76, 0x06, 0x20, 0x68, 0xF8, 0xCF, 0x0A, 0xA2, 0xBE, 0xBD, 0x07, 0x91, 0x1B,
+    0xFF, 0xEB, 0x01, 0x49, 0x85, 0x7F, 0xFB, 0x81, 0xF2, 0x0C, 0x17, 0x20, 0x0A, 0x3E, 0xCF, 0x67,
+    0x00, 0x2B, 0xF0, 0x87, 0x50, 0xF6, 0x60, 0x4A, 0x81, 0x89, 0x01, 0x13, 0x3C, 0xF5, 0x03, 0x53,
+    0xFF, 0xDE, 0x23, 0x53, 0x4F, 0x40, 0x82, 0x00, 0xB2, 0x10, 0x22, 0x55, 0x78, 0x9C, 0x45, 0x90,
+    0xBF, 0x4E, 0xC2, 0x60, 0x14, 0xC5, 0x8F, 0x2D, 0x48, 0x44, 0x88, 0xBC, 0x81, 0xBC, 0x41, 0x4D,
+    0x88, 0xB3, 0xBC, 0x80, 0x61, 0xD0, 0x44, 0x27, 0x7D, 0x84, 0x9A, 0x38, 0x3A, 0x40, 0x82, 0x9B,
+    0x43, 0x7D, 0x83, 0xEA, 0x13, 0xB0, 0x98, 0xB8, 0xD1, 0x0E, 0x38, 0x37, 0x46, 0x07, 0x27, 0x8B,
+    0x93, 0x03, 0x24, 0x28, 0x7F, 0x42, 0x01, 0xDB, 0xE3, 0xFD, 0xBE, 0xA2, 0x3D, 0xD3, 0xFD, 0x9D,
+    0x73, 0xEE, 0xFD, 0x92, 0x0F, 0x00, 0xDA, 0x03, 0x86, 0x57, 0x06, 0xB4, 0x7A, 0x54, 0xF2, 0x34,
+    0xDD, 0x33, 0x3C, 0xAD, 0x1D, 0xBD, 0xB1, 0x29, 0x73, 0x25, 0x0E, 0x4C, 0xE5, 0xBD, 0x72, 0x0B,
+    0x78, 0x66, 0x21, 0x6D, 0x2F, 0x25, 0x5A, 0xDA, 0xC0, 0x43, 0xD2, 0xDD, 0x84, 0x4F, 0xA3, 0xCE,
+    0x22, 0x6E, 0x65, 0x3F, 0x44, 0x95, 0x45, 0x9F, 0x1B, 0x88, 0xBC, 0xFD, 0xA7, 0x91, 0x74, 0x76,
+    0xC7, 0xAE, 0x58, 0xDB, 0x68, 0x09, 0xCC, 0xCE, 0xE7, 0x0D, 0xB4, 0x68, 0x68, 0x18, 0x3B, 0xAB,
+    0x1D, 0xF8, 0x21, 0x34, 0x7C, 0x75, 0xE2, 0x32, 0xFA, 0xDE, 0x1A, 0xBC, 0xA4, 0x24, 0xCE, 0x5F,
+    0xA2, 0xC0, 0x4D, 0xE1, 0xDB, 0x4D, 0xB2, 0xDA, 0xD4, 0xFE, 0x91, 0x03, 0x32, 0xDC, 0x11, 0x88,
+    0xAC, 0x85, 0x85, 0x0B, 0xE6, 0x30, 0xA1, 0x89, 0xA4, 0x34, 0x6D, 0xA2, 0xC2, 0xB3, 0xCB, 0xF7,
+    0xE8, 0xB0, 0xC7, 0x5C, 0x5F, 0x3D, 0x4D, 0x1E, 0x7C, 0x90, 0x8E, 0x74, 0x0A, 0xD8, 0x5B, 0x75,
+    0xCD, 0xEA, 0x20, 0xC8, 0x03, 0x71, 0x03, 0x99, 0x26, 0xB2, 0xFE, 0xAF, 0x3A, 0x3B, 0x46, 0x46,
+    0x2F, 0x0C, 0x4E, 0x6A, 0xC7, 0x8F, 0x56, 0x4A, 0x9F, 0xFA, 0xAB, 0x9C, 0x75, 0x76, 0x3D, 0xE4,
+    0xE8, 0x46, 0x6D, 0xFE, 0x02, 0xF2, 0xE4, 0x85, 0x79, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xF1,
+    0x9F, 0x85, 0x01, 0x0C, 0xFE, 0xFE, 0xE7, 0x04, 0xD3, 0x0A, 0xFF, 0xFF, 0xF2, 0x81, 0x19, 0x0D,
+    0xFF, 0xBF, 0xDA, 0x83, 0x19, 0x17, 0xD6, 0x7F, 0x98, 0x0F, 0x66, 0x7C, 0x8A, 0xDF, 0xF0, 0x1E,
+    0xCC, 0xF8, 0x2E, 0x9F, 0xF0, 0x9F, 0x19, 0xC4, 0xF8, 0xC3, 0xAD, 0xF0, 0x9F, 0x03, 0x48, 0x0B,
+    0xFC, 0x67, 0x63, 0xF8, 0xCB, 0x0B, 0x64, 0x14, 0xFC, 0x67, 0x62, 0xF8, 0xA1, 0x0F, 0x64, 0x1C,
+    0xB8, 0xCF, 0xC0, 0xF0, 0xB9, 0x1E, 0xC8, 0xF8, 0xD8, 0xCF, 0xC0, 0xF0, 0x00, 0xC8, 0x61, 0xF8,
+    0x56, 0xEF, 0xE2, 0x72, 0x04, 0x28, 0xCD, 0xF0, 0xFB, 0x3F, 0x08, 0xB0, 0x03, 0x35, 0x81, 0x01,
+    0x0F, 0x43, 0xC2, 0x7F, 0x56, 0xA0, 0xFC, 0x6F, 0x79, 0x86, 0x0D, 0xFF, 0xC1, 0xA6, 0xE7, 0x33,
+    0x7C, 0xD8, 0x0F, 0xB6, 0x6F, 0x3F, 0xC3, 0xD7, 0x7C, 0xB0, 0x0B, 0xFE, 0x33, 0xFE, 0x92, 0x87,
+    0xB8, 0x89, 0x0D, 0x00, 0xBC, 0xC0, 0x3D, 0x23, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF, 0xFB, 0x39,
+    0x2C, 0x0C, 0x0C, 0x1F, 0xFF, 0x03, 0xC1, 0x79, 0x26, 0x86, 0x8F, 0xFB, 0x8D, 0x9D, 0xAF, 0xFF,
+    0xE7, 0x05, 0xD2, 0x0C, 0x0C, 0x0C, 0xBF, 0xE3, 0x21, 0xF4, 0xD7, 0x7E, 0x28, 0x5D, 0x0F, 0x15,
+    0xD7, 0x07, 0xD1, 0x02, 0x5B, 0xFE, 0xB3, 0x43, 0xF4, 0x79, 0x43, 0xF5, 0xD7, 0x30, 0x80, 0xF5,
+    0x1F, 0xFB, 0xAF, 0x0B, 0x51, 0xF7, 0xED, 0x3E, 0x84, 0x3E, 0xF0, 0x9F, 0x19, 0x4C, 0x37, 0xFC,
+    0x67, 0x43, 0xA1, 0x37, 0xFC, 0x67, 0x01, 0xD3, 0x9F, 0xDF, 0x83, 0xF4, 0x19, 0x2F, 0xFD, 0x9F,
+    0x0F, 0x31, 0xE7, 0x3F, 0x1B, 0x98, 0xDE, 0x2B, 0xCE, 0xC0, 0x00, 0x00, 0x2C, 0x16, 0x4F, 0xE8,
+    0x78, 0x9C, 0x63, 0x60, 0x30, 0xB8, 0xF5, 0x7F, 0x1D, 0x0B, 0x03, 0x83, 0xC0, 0xAF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x67, 0x62, 0xB8, 0xF0, 0xBF, 0xD6, 0xE4, 0xD8, 0x7B, 0x46, 0x86, 0x5F, 0xF3, 0x19,
+    0x18, 0x18, 0xCC, 0x18, 0x0C, 0xFE, 0xF3, 0x30, 0x80, 0xC0, 0x82, 0xFF, 0x2C, 0x60, 0xFA, 0xC3,
+    0x7B, 0x30, 0xC5, 0xF0, 0x69, 0x3F, 0x84, 0xFE, 0x3A, 0x1F, 0x3F, 0x0D, 0x53, 0x07, 0xD3, 0x07,
+    0x33, 0xC7, 0x01, 0x6A, 0x2E, 0xC3, 0xEF, 0xF5, 0x40, 0xA2, 0x98, 0x81, 0xE1, 0xE2, 0xFF, 0x5C,
+    0xE3, 0xAD, 0xFF, 0xD9, 0x18, 0x04, 0x7E, 0x43, 0xDC, 0xC1, 0xE0, 0x70, 0xEB, 0xFF, 0x5A, 0x56,
+    0x06, 0x00, 0xD8, 0xE1, 0x2E, 0xC0, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF, 0xBD, 0x48, 0x06, 0x06,
+    0x86, 0x8F, 0xFF, 0x81, 0xA0, 0x1E, 0x48, 0xEF, 0x37, 0x0E, 0x79, 0xF9, 0x9F, 0x1B, 0x48, 0x33,
+    0x30, 0x08, 0xFC, 0x59, 0x0F, 0xA6, 0x19, 0x1E, 0xFE, 0x67, 0x06, 0xD3, 0x05, 0xFF, 0x39, 0xC1,
+    0xB4, 0xC2, 0x7F, 0x5E, 0x30, 0xCD, 0xF0, 0x9F, 0x1F, 0x42, 0xFF, 0x95, 0x87, 0xD0, 0x7F, 0xF4,
+    0x51, 0x69, 0x98, 0x38, 0x54, 0x9D, 0xC2, 0x7F, 0x1E, 0x30, 0xDD, 0xF0, 0x9F, 0x03, 0x4C, 0x3F,
+    0xFA, 0xCF, 0x08, 0xA2, 0x15, 0xFE, 0xD6, 0x83, 0xEC, 0x0D, 0xFE, 0xF5, 0x9F, 0x13, 0xE2, 0x8E,
+    0x38, 0xB0, 0x7B, 0xEE, 0x47, 0x01, 0x95, 0x00, 0x00, 0x59, 0x99, 0x46, 0x24, 0x78, 0x9C, 0xFB,
+    0xF8, 0x1F, 0x08, 0xF6, 0x33, 0x7C, 0x04, 0x51, 0xF3, 0x19, 0x3E, 0xEE, 0x37, 0x36, 0x36, 0x16,
+    0x06, 0x52, 0x0C, 0x20, 0x80, 0x9F, 0x02, 0xAA, 0x64, 0x84, 0xE8, 0x63, 0x87, 0x53, 0xC4, 0xE8,
+    0x43, 0x68, 0x37, 0x86, 0xE8, 0xFB, 0x0F, 0xA3, 0x00, 0x54, 0x10, 0x3A, 0xAB, 0x78, 0x9C, 0xFB,
+    0xF8, 0x1F, 0x08, 0xFA, 0x3F, 0x82, 0xC8, 0xF8, 0x8F, 0xFB, 0x8D, 0x8D, 0x8D, 0x99, 0x3F, 0xEE,
+    0x67, 0x00, 0x02, 0xDC, 0x24, 0x50, 0x0D, 0x03, 0x58, 0x3D, 0x0B, 0x94, 0x24, 0xA0, 0x1E, 0x3B,
+    0x09, 0x00, 0x7D, 0x2E, 0x30, 0xE0, 0x78, 0x9C, 0x63, 0x60, 0x10, 0x38, 0xF1, 0xFF, 0x9C, 0x38,
+    0x03, 0x03, 0xC3, 0x8F, 0xFF, 0x40, 0xC0, 0xCE, 0xB0, 0xE0, 0x7F, 0x9F, 0x49, 0xC9, 0x5F, 0x59,
+    0x86, 0x1F, 0xE7, 0x19, 0x19, 0x18, 0x12, 0x18, 0x15, 0xFE, 0xCB, 0x31, 0x80, 0xC0, 0x84, 0xFF,
+    0x6C, 0x60, 0xFA, 0xC1, 0x7F, 0x46, 0x30, 0xFD, 0xE9, 0x3C, 0x98, 0x62, 0xF8, 0xB2, 0x9E, 0x81,
+    0xE1, 0xC3, 0xFF, 0xFF, 0xF3, 0xBF, 0xCE, 0x67, 0x60, 0x38, 0x00, 0xA5, 0x15, 0x8C, 0xBF, 0xCC,
+    0xFF, 0x32, 0x1F, 0xAC, 0x6A, 0xFE, 0xE7, 0xFD, 0x10, 0xFA, 0xC3, 0x7B, 0x08, 0xBD, 0xE1, 0x3F,
+    0x33, 0x98, 0x0E, 0xF8, 0xCF, 0x0D, 0xA6, 0x19, 0xFE, 0xD4, 0x43, 0xE8, 0x47, 0xFF, 0x73, 0x8C,
+    0xA7, 0xFE, 0x9F, 0xCF, 0xA0, 0xF0, 0x07, 0xE4, 0x0E, 0x5F, 0x06, 0x86, 0x80, 0x5B, 0xFF, 0xCF,
+    0x59, 0x30, 0x00, 0x00, 0x8E, 0xAA, 0x42, 0x36, 0x78, 0x9C, 0xFB, 0xB8, 0x9F, 0x01, 0x08, 0xFE,
+    0xF2, 0x7D, 0x24, 0x97, 0xFE, 0x0F, 0x06, 0x08, 0x7A, 0xBF, 0x31, 0x10, 0xFC, 0x23, 0xDF, 0x3C,
+    0x34, 0x1A, 0x00, 0x8D, 0x24, 0x3F, 0xE6, 0x78, 0x9C, 0xFB, 0xB8, 0xFF, 0x23, 0x51, 0x10, 0x00,
+    0xB6, 0x1A, 0x21, 0xC1, 0x78, 0x9C, 0x63, 0x58, 0xF0, 0x9F, 0x89, 0x81, 0x72, 0xCC, 0xC8, 0xB0,
+    0x01, 0x88, 0x2F, 0xFC, 0x67, 0x60, 0xF8, 0xB2, 0x9F, 0xC1, 0xE0, 0x9F, 0x3D, 0xC3, 0xCF, 0xFF,
+    0xEC, 0x0C, 0xDF, 0x7D, 0x19, 0x18, 0x1C, 0x19, 0x18, 0x18, 0x00, 0x0C, 0x20, 0x27, 0x75, 0x78,
+    0x9C, 0xFB, 0xB8, 0x9F, 0x81, 0x81, 0xE1, 0xE2, 0x7F, 0xE6, 0x8F, 0x20, 0xFA, 0x77, 0x3E, 0x03,
+    0x88, 0x6E, 0xF8, 0xCF, 0x09, 0xA6, 0xBF, 0x02, 0x31, 0x90, 0x36, 0xF8, 0x2F, 0x0B, 0xA6, 0x1F,
+    0xFE, 0x67, 0x02, 0xD3, 0x7F, 0xFC, 0x19, 0x40, 0xF4, 0x84, 0xFF, 0xEC, 0x60, 0xFA, 0xDB, 0x7A,
+    0x06, 0x30, 0xFD, 0xCF, 0x1F, 0x42, 0x7F, 0x7D, 0xCF, 0x08, 0x95, 0xE7, 0x06, 0xD3, 0x0C, 0x7F,
+    0xEB, 0x21, 0xF4, 0xA7, 0xFF, 0x2C, 0x60, 0x3A, 0xE0, 0xBF, 0x1C, 0x98, 0x66, 0xF8, 0x79, 0x1E,
+    0x42, 0x5F, 0xF8, 0xCF, 0x01, 0xA6, 0x15, 0xFE, 0xFB, 0x83, 0x69, 0x06, 0xA0, 0x11, 0x60, 0x7A,
+    0xC2, 0x7F, 0x1E, 0x00, 0xFD, 0x4C, 0x42, 0x25, 0x78, 0x9C, 0xFB, 0xB8, 0x9F, 0x01, 0x08, 0x3E,
+    0xD2, 0x9A, 0xBC, 0x5F, 0x5E, 0x5E, 0x9E, 0xFE, 0xF1, 0x3F, 0x10, 0xDC, 0x07, 0x93, 0xFB, 0x01,
+    0x8B, 0x3E, 0x2B, 0xC5, 0x78, 0x9C, 0x25, 0x8E, 0xC9, 0x0D, 0x82, 0x60, 0x14, 0x84, 0x07, 0xB7,
+    0x28, 0x51, 0xF0, 0xE2, 0x59, 0x3A, 0xD0, 0x0E, 0x28, 0x01, 0x3B, 0xD0, 0x93, 0x57, 0xED, 0x40,
+    0xEF, 0x1E, 0xB0, 0x03, 0xED, 0x00, 0x4E, 0x5E, 0xB5, 0x03, 0xE8, 0x00, 0x3A, 0x10, 0x71, 0x61,
+    0xFF, 0xC7, 0x67, 0x7C, 0xC9, 0x24, 0x33, 0xC9, 0xE4, 0x7D, 0x83, 0x82, 0x5D, 0x00, 0x25, 0x3B,
+    0x22, 0x5D, 0x9C, 0x92, 0x5C, 0xD1, 0x00, 0xE6, 0x64, 0x0F, 0x4D, 0x63, 0x03, 0xFB, 0x88, 0x7D,
+    0xA8, 0xDC, 0x05, 0x6E, 0x2E, 0x07, 0xE0, 0x25, 0x00, 0x1E, 0x8E, 0xD2, 0xC7, 0x5C, 0x53, 0xC3,
+    0xDB, 0x6C, 0x86, 0x16, 0x27, 0x52, 0x2E, 0xF4, 0x7A, 0x34, 0x67, 0xA7, 0xD6, 0xA1, 0xBA, 0x95,
+    0xB1, 0x60, 0x3B, 0x33, 0x2D, 0x6A, 0xA5, 0xB9, 0x62, 0x2B, 0x75, 0x56, 0x01, 0xF2, 0xE9, 0x96,
+    0x5A, 0xE8, 0xFA, 0x3B, 0x64, 0xB3, 0x23, 0xE5, 0x6D, 0x62, 0xE3, 0xE3, 0x9C, 0xEF, 0x82, 0xFA,
+    0x18, 0x78, 0x2D, 0xFD, 0x48, 0xF0, 0x6A, 0x80, 0xE7, 0x26, 0x0C, 0xFE, 0x93, 0x52, 0x37, 0xBE,
+    0x02, 0x6F, 0x0A, 0xEF, 0x94, 0x78, 0x80, 0x7F, 0x00, 0x12, 0xEF, 0x21, 0x4B, 0x7E, 0x17, 0x07,
+    0xE9, 0xEE, 0xEF, 0xC2, 0xE8, 0x0B, 0xAB, 0x48, 0x5A, 0x91, 0x78, 0x9C, 0xFB, 0xF8, 0x9F, 0x87,
+    0x81, 0x81, 0xE1, 0x27, 0xFF, 0xC7, 0xFF, 0xFE, 0x50, 0x7A, 0x3F, 0x84, 0xBE, 0xFF, 0x9F, 0x19,
+    0x4C, 0xD7, 0xFF, 0xE7, 0x06, 0xD3, 0xF1, 0xBF, 0xED, 0xC1, 0x74, 0xFE, 0x97, 0xF5, 0x10, 0xFA,
+    0xC0, 0x7F, 0x26, 0xB0, 0xBC, 0xC3, 0x7F, 0x2E, 0x30, 0xCD, 0xF0, 0x47, 0x1F, 0x44, 0xF7, 0x33,
+    0x7C, 0x9D, 0x0F, 0xA1, 0x2F, 0xFC, 0x67, 0x04, 0xD3, 0x01, 0xFF, 0x39, 0x7F, 0x80, 0x68, 0x86,
+    0xBF, 0xF2, 0x10, 0xFA, 0x6B, 0xFF, 0x77, 0x30, 0x7D, 0xE1, 0x3F, 0x84, 0x4E, 0xF8, 0xFF, 0x07,
+    0x4C, 0x33, 0xFC, 0xFB, 0x0F, 0xA1, 0xBF, 0x41, 0xE9, 0x07, 0xFF, 0xF9, 0x01, 0x83, 0x96, 0x4B,
+    0x46, 0x78, 0x9C, 0x63, 0x60, 0x30, 0xB8, 0xF9, 0x7F, 0x1D, 0x2B, 0x03, 0x03, 0x83, 0xC0, 0xAF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x67, 0x62, 0x60, 0xB8, 0xF0, 0x3F, 0xD7, 0x78, 0xEB, 0x7F, 0x3D, 0x06,
+    0x86, 0x5F, 0xF3, 0x81, 0xC2, 0x5F, 0xEF, 0x33, 0x18, 0xFC, 0xE7, 0x01, 0x32, 0x1A, 0xFE, 0xB3,
+    0x2F, 0xF8, 0xCF, 0x02, 0x52, 0xF8, 0x9F, 0xF7, 0xC3, 0x7B, 0x06, 0x10, 0xF8, 0xA3, 0xFF, 0x69,
+    0x3F, 0x98, 0xF1, 0x33, 0xFE, 0xCB, 0x7C, 0x30, 0xE3, 0x5B, 0xFF, 0x57, 0xDC, 0x8C, 0xCF, 0x10,
+    0xC5, 0x3F, 0xE2, 0xA1, 0xDA, 0x7F, 0xEB, 0x6F, 0xF8, 0xCF, 0x0C, 0x31, 0xD0, 0xE1, 0x3F, 0x37,
+    0xC4, 0x0A, 0x86, 0xDF, 0x50, 0x4B, 0x19, 0x2E, 0xC2, 0x9C, 0x21, 0xF0, 0x1B, 0xEA, 0x30, 0x06,
+    0x87, 0x5B, 0x60, 0xA7, 0x02, 0x00, 0x80, 0x3C, 0x42, 0x5D, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0xFF,
+    0xFB, 0x39, 0x2C, 0x0C, 0x0C, 0x1F, 0xFF, 0x03, 0xC1, 0x79, 0x46, 0x86, 0x8F, 0xFB, 0x8D, 0x9D,
+    0x5F, 0xFC, 0xE7, 0x03, 0xD2, 0x0C, 0x0C, 0x0C, 0x7F, 0xFA, 0x21, 0xF4, 0xE7, 0xFB, 0x10, 0xFA,
+    0xC3, 0x7F, 0x54, 0xFA, 0x13, 0x54, 0xFC, 0x27, 0x58, 0x9D, 0xC0, 0x96, 0xFF, 0x72, 0x10, 0x73,
+    0xEE, 0x33, 0x81, 0xE9, 0xF3, 0x6C, 0x0C, 0x20, 0xF3, 0x84, 0x80, 0x2A, 0x20, 0xEA, 0xC8, 0xA0,
+    0x01, 0xBB, 0x2C, 0x3E, 0xF2, 0x78, 0x9C, 0x63, 0x60, 0x30, 0xB8, 0xF9, 0x7F, 0x1D, 0x2B, 0x03,
+    0x10, 0x08, 0xFC, 0xFA, 0xFF, 0xFF, 0xFF, 0x79, 0x26, 0x20, 0xEB, 0xC0, 0xFF, 0x5C, 0xE3, 0xAD,
+    0xFF, 0xF5, 0x80, 0xAC, 0x5F, 0xF3, 0x81, 0xC4, 0xD7, 0xFB, 0x0C, 0x0C, 0x06, 0xFF, 0x79, 0x80,
+    0xAC, 0x86, 0xFF, 0xEC, 0x0C, 0x0B, 0xFE, 0xB3, 0x80, 0x14, 0xFF, 0xE7, 0x65, 0xF8, 0xF0, 0x1E,
+    0xA4, 0x8D, 0xE1, 0x8F, 0x3E, 0xC3, 0xA7, 0xFD, 0x60, 0xD6, 0xCF, 0x78, 0x86, 0x2F, 0xF3, 0xC1,
+    0xAC, 0x6F, 0xFD, 0x0C, 0x5F, 0xF1, 0xB2, 0x3E, 0x43, 0x74, 0xFC, 0x88, 0x87, 0x99, 0xF2, 0x5B,
+    0x9F, 0x61, 0xC3, 0x7F, 0x66, 0xA8, 0xC9, 0x0E, 0xFF, 0xB9, 0xC1, 0xB6, 0x01, 0xDD, 0xF5, 0x1B,
+    0xEC, 0x02, 0x10, 0xF1, 0x10, 0xEC, 0x2A, 0x4E, 0x90, 0x92, 0x3F, 0x40, 0x97, 0xAE, 0x07, 0x39,
+    0x83, 0xC1, 0xE1, 0x16, 0x90, 0xF9, 0x5F, 0x0B, 0x6C, 0x04, 0x83, 0xC2, 0xD6, 0xFF, 0xFF, 0x99,
+    0x20, 0x4C, 0x86, 0xCB, 0xF3, 0x19, 0x60, 0x80, 0x83, 0x01, 0x00, 0x7E, 0xB8, 0x48, 0x9C, 0x78,
+    0x9C, 0xFB, 0xF8, 0xFF, 0xFF, 0xFB, 0xB5, 0xAC, 0x0C, 0x0C, 0x1F, 0xFF, 0x03, 0xC1, 0x7D, 0x26,
+    0x86, 0x8F, 0xFB, 0x8D, 0x9D, 0xAF, 0xFF, 0x97, 0x03, 0xD2, 0x0C, 0x0C, 0x0C, 0xBF, 0xEB, 0x21,
+    0xF4, 0xE7, 0xFD, 0x10, 0xFA, 0xD3, 0x7D, 0x54, 0xFE, 0x2F, 0xB0, 0xBC, 0xC0, 0x92, 0xFF, 0x7C,
+    0x10, 0xFD, 0xE7, 0x99, 0xC0, 0xF4, 0x7D, 0x16, 0x06, 0x90, 0x39, 0x9F, 0xDF, 0x33, 0x82, 0x68,
+    0x86, 0x82, 0xFF, 0x1C, 0x60, 0x9A, 0xE1, 0x9F, 0x3E, 0x84, 0xFE, 0xB6, 0x1F, 0x42, 0x5F, 0xF8,
+    0xCF, 0x02, 0xA6, 0x1D, 0xFE, 0xF3, 0xA2, 0xD9, 0xF7, 0x9F, 0x11, 0x4C, 0x2F, 0xF8, 0xCF, 0x05,
+    0x00, 0x16, 0x81, 0x4A, 0xE5, 0x78, 0x9C, 0x63, 0x60, 0x58, 0xF2, 0xF7, 0xBE, 0x17, 0x03, 0x03,
+    0xC3, 0x82, 0xFF, 0x40, 0xA0, 0xC3, 0xC0, 0xF0, 0xEB, 0xBE, 0x5B, 0xF2, 0xEF, 0xF3, 0x0C, 0x0A,
+    0xFF, 0x79, 0x18, 0x18, 0x0C, 0x74, 0x18, 0x12, 0xFE, 0xB3, 0x31, 0x80, 0x40, 0xC2, 0x7F, 0x76,
+    0x30, 0x6D, 0xF0, 0x9F, 0x17, 0x4C, 0x33, 0xFC, 0x79, 0x0F, 0x91, 0xB8, 0xF8, 0xFF, 0x7F, 0x14,
+    0x98, 0xF1, 0xFC, 0xFF, 0xFF, 0x7E, 0x46, 0x10, 0x63, 0xC9, 0xBF, 0xFF, 0x76, 0x60, 0x91, 0x80,
+    0xBF, 0xEF, 0x21, 0x6A, 0x0F, 0x40, 0x0D, 0x71, 0xF8, 0xCF, 0x05, 0xA6, 0x15, 0xFE, 0x73, 0x43,
+    0x14, 0xFC, 0xE7, 0x0C, 0xF0, 0x05, 0x9B, 0xC1, 0xFC, 0xF0, 0x7F, 0x8D, 0x49, 0xCB, 0xFF, 0xF5,
+    0x0C, 0x0A, 0x7F, 0x40, 0xEE, 0xE0, 0x04, 0x5A, 0x74, 0xF2, 0xDF, 0x3D, 0x0B, 0x06, 0x06, 0x00,
+    0x0A, 0xC7, 0x34, 0x07, 0x78, 0x9C, 0xFB, 0xF9, 0x1F, 0x0C, 0xB8, 0x7F, 0x42, 0x68, 0x4E, 0x43,
+    0x63, 0xE3, 0xBF, 0x76, 0xC6, 0xC6, 0x8C, 0x0C, 0x0C, 0x0C, 0x7F, 0xF9, 0x18, 0xC0, 0x60, 0x40,
+    0x69, 0x00, 0x5B, 0x39, 0x21, 0xEF, 0x78, 0x9C, 0xFB, 0x96, 0xCF, 0xC0, 0xC0, 0x20, 0xF0, 0x9F,
+    0xFB, 0x1B, 0x8D, 0xE9, 0xAF, 0x20, 0x5A, 0xE1, 0x3F, 0xD7, 0x97, 0x7E, 0x20, 0x6D, 0xF0, 0x9F,
+    0xE3, 0xE3, 0x79, 0x20, 0x5D, 0xF0, 0x9F, 0x75, 0xC3, 0x7F, 0x56, 0x06, 0x86, 0x47, 0xFF, 0x81,
+    0x52, 0xF3, 0x4D, 0x4A, 0xFE, 0xC5, 0x33, 0x30, 0x3C, 0xFE, 0x0F, 0x04, 0x6C, 0x40, 0xC9, 0xE3,
+    0xFF, 0xCE, 0x89, 0x33, 0x30, 0x00, 0x00, 0x54, 0x64, 0x37, 0xD6, 0x78, 0x9C, 0x25, 0xCC, 0xE9,
+    0x11, 0x82, 0x50, 0x0C, 0x04, 0xE0, 0x75, 0xBC, 0x6F, 0x3A, 0x80, 0x0E, 0x2C, 0xC1, 0x12, 0xB4,
+    0x03, 0xED, 0x00, 0x3A, 0xB0, 0x14, 0xEC, 0x40, 0x3B, 0xE0, 0x75, 0x60, 0x0B, 0x76, 0xC0, 0xF3,
+    0x40, 0x50, 0x60, 0xD6, 0x24, 0x64, 0x26, 0x99, 0xEF, 0xC7, 0x66, 0x7F, 0x3B, 0xC8, 0xDC, 0x73,
+    0x14, 0xA9, 0xE2, 0x95, 0xC2, 0xE7, 0x8A, 0x72, 0x8B, 0x2B, 0xFB, 0x82, 0x66, 0x85, 0x3D, 0xC7,
+    0x40, 0xC0, 0xA9, 0xEC, 0x02, 0x38, 0x72, 0x00, 0xD4, 0x21, 0x70, 0xD6, 0xE0, 0x27, 0x06, 0xFC,
+    0x45, 0xF0, 0x90, 0xF3, 0x3E, 0x08, 0x1C, 0x81, 0xEF, 0x1A, 0x5D, 0xB0, 0x9D, 0x41, 0x5F, 0x27,
+    0x11, 0x87, 0xDA, 0xDA, 0x2C, 0x13, 0xC2, 0xEA, 0x37, 0x2E, 0x33, 0x3C, 0x4F, 0x3E, 0x36, 0xB8,
+    0xAC, 0x08, 0x0D, 0x09, 0xEB, 0xB9, 0x21, 0x22, 0x47, 0x06, 0xB4, 0xEC, 0x75, 0xA8, 0x6E, 0x7A,
+    0xFF, 0x9A, 0x46, 0x33, 0xE5, 0x78, 0x9C, 0x15, 0x8F, 0xDB, 0x6D, 0xC2, 0x50, 0x10, 0x44, 0x0F,
+    0x82, 0xF0, 0x70, 0xB0, 0x9C, 0x0E, 0xA0, 0x03, 0xDC, 0x81, 0x4B, 0x80, 0x0E, 0xB8, 0x1D, 0xD0,
+    0x02, 0x1D, 0x98, 0x0E, 0x42, 0x2A, 0x80, 0x0E, 0xA0, 0x03, 0xFB, 0x83, 0x7F, 0xD2, 0x81, 0xB1,
+    0x65, 0xC4, 0x55, 0x2E, 0x78, 0x33, 0xFC, 0xEC, 0xAC, 0x34, 0x3B, 0x8F, 0x6D, 0x72, 0xC0, 0x7F,
+    0x6B, 0xB4, 0xCB, 0xDB, 0x49, 0xF0, 0xBC, 0x6A, 0x3C, 0x92, 0x73, 0x25, 0x30, 0xEB, 0xC1, 0x5F,
+    0xBC, 0x15, 0xA4, 0x66, 0x03, 0x78, 0x45, 0x2B, 0x81, 0x2B, 0xC2, 0x58, 0xE4, 0x68, 0x6E, 0x23,
+    0xF6, 0xB9, 0xFF, 0x14, 0xD9, 0xA7, 0x8B, 0x28, 0xD7, 0x6D, 0x82, 0x33, 0x08, 0x31, 0xF5, 0xAC,
+    0xCE, 0xD8, 0xC9, 0xCB, 0x27, 0xB4, 0x71, 0xB9, 0xE1, 0x7C, 0x80, 0x7B, 0x86, 0x8F, 0xF6, 0x07,
+    0x6E, 0x1B, 0x68, 0xD6, 0x84, 0xA1, 0xBB, 0xD2, 0x64, 0xF0, 0x9B, 0x63, 0xFD, 0xB9, 0xF5, 0xEE,
+    0x09, 0x1C, 0x4F, 0xA9, 0x1C, 0xEC, 0xC3, 0x4F, 0x61, 0x5B, 0x39, 0x55, 0x0A, 0xE3, 0x30, 0x81,
+    0x95, 0xFD, 0xA8, 0xAA, 0x9F, 0x76, 0x43, 0xF8, 0xB2, 0xCB, 0x52, 0x85, 0x17, 0x8A, 0x85, 0xCE,
+    0xCF, 0xA0, 0xCE, 0x25, 0xD2, 0x69, 0x17, 0x43, 0x59, 0x15, 0xEF, 0xFD, 0x61, 0x52, 0xED, 0xEC,
+    0xFD, 0x1A, 0xAD, 0x49, 0xE5, 0x4C, 0xB1, 0xFF, 0x79, 0x9D, 0x5A, 0xE5, 0x78, 0x9C, 0x1D, 0x8D,
+    0xED, 0x0D, 0x82, 0x40, 0x10, 0x05, 0x87, 0x9C, 0x09, 0x41, 0xB1, 0x05, 0xB5, 0x03, 0x4A, 0x91,
+    0x0E, 0xB0, 0x03, 0xAF, 0x03, 0x4B, 0xB0, 0x04, 0x4B, 0xD0, 0x0E, 0x6C, 0xC1, 0x0E, 0x38, 0x2A,
+    0x20, 0x24, 0xC4, 0x9C, 0x89, 0xF8, 0xBC, 0xBD, 0xFD, 0xF3, 0xB2, 0x1F, 0x33, 0x3B, 0xA9, 0x80,
+    0x56, 0x6B, 0xAF, 0x0A, 0x5E, 0xA9, 0x59, 0x1A, 0x78, 0x5F, 0x60, 0xBE, 0xC3, 0x6F, 0x0B, 0x0F,
+    0x39, 0xAF, 0x15, 0x1C, 0xB4, 0x09, 0x69, 0x04, 0xF1, 0x18, 0xF7, 0x96, 0xA1, 0x57, 0x69, 0xD9,
+    0xAA, 0x27, 0x97, 0xF2, 0x9A, 0x93, 0xE4, 0x2C, 0x87, 0xA7, 0xEA, 0x7C, 0xDF, 0xC4, 0x0E, 0xE3,
+    0xAB, 0x30, 0x62, 0xBE, 0xC2, 0x1B, 0x38, 0x5F, 0x93, 0x3F, 0x89, 0x96, 0x5D, 0xFA, 0x77, 0x4B,
+    0x54, 0x69, 0xFF, 0xDD, 0x30, 0x66, 0x65, 0xFD, 0x39, 0x1B, 0xFB, 0xED, 0xFE, 0x52, 0x84, 0x36,
+    0xDC, 0x78, 0x9C, 0xFB, 0x59, 0xCF, 0x00, 0x04, 0x9F, 0xD7, 0x7F, 0x7C, 0x0F, 0xA2, 0x7F, 0xEB,
+    0x37, 0xFC, 0x67, 0x63, 0x60, 0x30, 0xF8, 0xCF, 0x29, 0xF0, 0x9F, 0x8F, 0x81, 0x61, 0xC3, 0x7F,
+    0x46, 0x86, 0x1F, 0xF9, 0x40, 0xE9, 0x7E, 0x06, 0x86, 0x07, 0x40, 0x05, 0xBF, 0xE4, 0x19, 0x18,
+    0x0A, 0xFE, 0xB3, 0x29, 0xFC, 0xE7, 0x00, 0xAA, 0xFD, 0xC7, 0xBB, 0x00, 0xAC, 0xE7, 0x5B, 0xFC,
+    0x27, 0xB0, 0x19, 0x0F, 0xEE, 0xFF, 0xE2, 0x03, 0xD1, 0x09, 0xFF, 0x41, 0x46, 0x00, 0xC1, 0xDF,
+    0xFB, 0x60, 0x8A, 0xE1, 0x5B, 0x3D, 0x94, 0xCE, 0x27, 0x83, 0x06, 0x00, 0x15, 0x89, 0x2B, 0xBB,
+    0x78, 0x9C, 0x13, 0xF8, 0x0F, 0x02, 0xEF, 0x05, 0x20, 0x14, 0x83, 0x31, 0x10, 0x7C, 0x5F, 0xCF,
+    0x00, 0x02, 0xFF, 0xE4, 0x40, 0xE4, 0x84, 0xFF, 0x6C, 0x20, 0xEA, 0xF3, 0x79, 0xB0, 0xD8, 0x5F,
+    0x7D, 0x10, 0x59, 0xF0, 0x9F, 0x1D, 0x44, 0x7D, 0xBA, 0x0F, 0x16, 0xFB, 0x6D, 0x0F, 0x22, 0x13,
+    0xFE, 0x73, 0x82, 0xA8, 0x87, 0xEF, 0x19, 0x41, 0xD4, 0xAF, 0x78, 0x10, 0xE9, 0xF0, 0x9F, 0x1B,
+    0x44, 0x3D, 0xF8, 0x0F, 0x16, 0xFB, 0x99, 0x0F, 0x22, 0x0D, 0xFE, 0xF3, 0x80, 0xA8, 0x0B, 0xFF,
+    0x4D, 0x81, 0x36, 0x29, 0x7F, 0x02, 0x5B, 0x7B, 0x1F, 0x42, 0xAD, 0x07, 0x00, 0x9D, 0xBE, 0x33,
+    0x0E, 0x78, 0x9C, 0xFB, 0xF8, 0xFF, 0x3F, 0xFF, 0x47, 0x10, 0xEE, 0x37, 0x66, 0xFA, 0x58, 0xCF,
+    0xC0, 0x40, 0x13, 0x0C, 0x32, 0x1B, 0x6A, 0x0F, 0x00, 0x8D, 0xF2, 0x2F, 0x03, 0x78, 0x9C, 0x0B,
+    0x64, 0x66, 0x60, 0x60, 0xF8, 0xC3, 0x09, 0x24, 0x7E, 0xF0, 0x02, 0x89, 0x2F, 0xFA, 0x40, 0xE2,
+    0x43, 0x3E, 0x90, 0x38, 0xB0, 0x1E, 0x48, 0x34, 0xBC, 0x07, 0x12, 0x0E, 0xFF, 0x99, 0x80, 0xE4,
+    0x7F, 0x36, 0x20, 0xF1, 0x9B, 0x1B, 0x48, 0x7C, 0xE7, 0x07, 0x12, 0x9F, 0xED, 0x41, 0x0A, 0xEB,
+    0x81, 0xC4, 0x86, 0xFD, 0x40, 0xA2, 0xE0, 0x3F, 0x90, 0x30, 0xF8, 0xCF, 0x02, 0x24, 0xFF, 0x71,
+    0x00, 0x89, 0x5F, 0x3C, 0x40, 0xE2, 0x1B, 0x48, 0xE1, 0x27, 0x7F, 0x20, 0xF1, 0xA0, 0x1F, 0x48,
+    0x2C, 0xB8, 0x0F, 0x24, 0x12, 0xFE, 0x33, 0x32, 0x30, 0x08, 0xFC, 0x67, 0x05, 0x32, 0xFF, 0x82,
+    0x6C, 0xFD, 0x09, 0xB2, 0xF5, 0x2A, 0x17, 0x03, 0x08, 0x00, 0x00, 0xDD, 0xF7, 0x1F, 0x62, 0x78,
+    0x9C, 0xFB, 0xF1, 0xFF, 0x3F, 0xC7, 0x0F, 0x20, 0x36, 0x34, 0xFE, 0xCF, 0xC1, 0xC0, 0x40, 0x1B,
+    0x0C, 0x32, 0xFB, 0x07, 0xD4, 0x1E, 0x00, 0x3B, 0xAE, 0x25, 0x69, 0x78, 0x9C, 0x63, 0x60, 0x30,
+    0xE8, 0x60, 0x64, 0x00, 0x82, 0x0B, 0xFF, 0xB9, 0x40, 0xD4, 0xF7, 0xFF, 0xF6, 0x40, 0x52, 0xE0,
+    0xFF, 0xCD, 0xF3, 0x40, 0x6A, 0xC1, 0x7B, 0xC7, 0xFF, 0x6C, 0x0C, 0x0C, 0x9F, 0xEB, 0x19, 0xFE,
+    0xC8, 0x31, 0x30, 0xFC, 0xE1, 0x63, 0xF8, 0xDC, 0xCF, 0x90, 0xF0, 0x9F, 0x95, 0x61, 0xC1, 0x7F,
+    0xA6, 0x07, 0x40, 0x79, 0x85, 0xFF, 0xDC, 0x3F, 0xFC, 0x81, 0xCA, 0x7E, 0xF8, 0x03, 0x00, 0xF8,
+    0x74, 0x17, 0xD8, 0x78, 0x9C, 0x33, 0x34, 0x06, 0x03, 0xA6, 0x1F, 0xFF, 0xC1, 0x80, 0x0B, 0x46,
+    0x03, 0x00, 0x9A, 0x91, 0x0F, 0x5E, 0x78, 0x9C, 0x63, 0x60, 0x62, 0x60, 0x48, 0xE8, 0x67, 0x60,
+    0x78, 0xF0, 0x3F, 0x8F, 0x41, 0xE1, 0xC5, 0x7F, 0x5F, 0x06, 0x86, 0xA3, 0xF3, 0x19, 0x18, 0x18,
+    0x84, 0x00, 0x55, 0x46, 0x07, 0x09, 0x78, 0x9C, 0x63, 0x98, 0xF2, 0xE6, 0x7F, 0x0D, 0x03, 0x43,
+    0xC2, 0x7F, 0x20, 0x90, 0x65, 0x10, 0x98, 0xEB, 0x16, 0xFC, 0x67, 0x3E, 0x03, 0x08, 0x5C, 0x78,
+    0x0F, 0xA6, 0x16, 0xFC, 0x67, 0x04, 0x51, 0x13, 0x80, 0x54, 0xC2, 0x6B, 0xA0, 0x1A, 0x26, 0x85,
+    0xBF, 0x20, 0xA5, 0x4C, 0x0F, 0xFE, 0xE7, 0x18, 0x2F, 0xFE, 0xCF, 0xF4, 0x6D, 0x3F, 0x48, 0x8E,
+    0xE9, 0xA7, 0x3F, 0x98, 0xFA, 0x65, 0x0F, 0xD2, 0xC0, 0xF4, 0xA3, 0x9E, 0x81, 0xE1, 0xCB, 0x7F,
+    0xE6, 0xCF, 0xFF, 0xCD, 0xA7, 0xDC, 0xFF, 0xCF, 0xD5, 0x00, 0x32, 0xF9, 0xB7, 0x3D, 0xC3, 0xD1,
+    0xFF, 0xBD, 0x0C, 0x0B, 0x79, 0x19, 0x20, 0x00, 0x00, 0xA7, 0x03, 0x35, 0xAA, 0x78, 0x9C, 0x63,
+    0x10, 0x62, 0x00, 0x81, 0xCF, 0xF5, 0xC4, 0x53, 0x09, 0x7F, 0xF6, 0x31, 0x03, 0xA9, 0x5F, 0xFF,
+    0xFF, 0xE7, 0x33, 0x7C, 0x7E, 0xBF, 0xDE, 0xE4, 0xC7, 0x7F, 0xE6, 0xCF, 0xFF, 0xD9, 0x18, 0x12,
+    0xFE, 0x73, 0x7F, 0x5E, 0x0F, 0x54, 0xF0, 0x57, 0x1E, 0xAC, 0xF2, 0xA7, 0x3F, 0x98, 0xFA, 0x9E,
+    0x0F, 0xA6, 0xBE, 0xD5, 0x23, 0x53, 0x50, 0xC1, 0x5F, 0xF6, 0x60, 0xEA, 0x1F, 0xFF, 0xE7, 0xF7,
+    0x4C, 0x0C, 0x05, 0xFF, 0x39, 0x3F, 0xFF, 0xAF, 0x73, 0xFE, 0xF9, 0x9F, 0xF1, 0x73, 0xFD, 0xBF,
+    0xFF, 0xFF, 0xED, 0x19, 0x3E, 0xDB, 0x4F, 0xFC, 0x37, 0x97, 0x91, 0x01, 0x00, 0xF8, 0xAC, 0x3F,
+    0x7C, 0x78, 0x9C, 0x63, 0x60, 0xD8, 0xFA, 0x6F, 0x1F, 0x2B, 0x03, 0xC3, 0x86, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x67, 0x60, 0xF8, 0x75, 0xDE, 0x74, 0x4A, 0x3E, 0x83, 0xC3, 0x7F, 0x6E, 0x06, 0x06, 0x26,
+    0xA0, 0x18, 0x13, 0x03, 0x10, 0x7C, 0xB8, 0x0F, 0x22, 0x19, 0x3E, 0xAF, 0x07, 0x53, 0x5F, 0xE6,
+    0x83, 0xA9, 0xAF, 0x10, 0xEA, 0x0B, 0x44, 0xF0, 0xE3, 0x79, 0x30, 0x75, 0xE1, 0x3F, 0x23, 0x88,
+    0x4A, 0xF8, 0xCF, 0x05, 0xD2, 0xCE, 0xF0, 0x67, 0xBF, 0xE9, 0x92, 0x7A, 0x06, 0x86, 0x83, 0x10,
+    0xA3, 0x19, 0x8E, 0xFD, 0x5B, 0xC7, 0xC2, 0x00, 0x00, 0x17, 0xE4, 0x24, 0x1D, 0x78, 0x9C, 0x63,
+    0x60, 0x00, 0x02, 0x03, 0x46, 0x10, 0xC9, 0xF0, 0x61, 0x3D, 0x51, 0xD4, 0xF5, 0xF7, 0xD6, 0x40,
+    0xEA, 0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0xAC, 0x67, 0xF8, 0x7D, 0xDE, 0xF4, 0xDA, 0xFF, 0xF5, 0x0E,
+    0xFF, 0x79, 0x18, 0x18, 0x7E, 0xAF, 0x5F, 0xF0, 0x9F, 0x05, 0xA4, 0xE4, 0xC1, 0x7F, 0xB0, 0xCA,
+    0x8F, 0xE7, 0xC1, 0xD4, 0xA7, 0xFD, 0xC8, 0x14, 0x54, 0xF0, 0xC3, 0x7B, 0x30, 0xB5, 0xE1, 0x3F,
+    0x33, 0x03, 0xC3, 0xC7, 0xF5, 0x09, 0xFF, 0xB9, 0x19, 0x18, 0xFE, 0xAC, 0x67, 0xF8, 0xBB, 0xDF,
+    0xE4, 0xDA, 0xBF, 0xF5, 0x0C, 0x8F, 0x80, 0x46, 0x5F, 0x5E, 0xCF, 0x20, 0x70, 0xF3, 0xBD, 0xE6,
+    0x86, 0xF5, 0x00, 0x44, 0xC3, 0x45, 0x9F, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xF6, 0xBF, 0x97, 0x91,
+    0x81, 0xE1, 0xC0, 0xFF, 0xFF, 0xFF, 0xED, 0x19, 0x18, 0x7E, 0xCF, 0x37, 0x79, 0xF6, 0x9E, 0x31,
+    0xE0, 0x3F, 0x3B, 0x83, 0xC2, 0x7F, 0xCE, 0x0D, 0xEF, 0x19, 0x18, 0x18, 0x7E, 0xF2, 0x7F, 0xD8,
+    0x0F, 0xA4, 0xBE, 0xEA, 0x7F, 0x5E, 0x6F, 0x6C, 0x6C, 0xFC, 0xCD, 0xFF, 0xCB, 0x7F, 0x10, 0x88,
+    0xFF, 0x0A, 0xA1, 0xBE, 0xCC, 0x67, 0x00, 0x81, 0x8F, 0xE7, 0xC1, 0xD4, 0x85, 0xFF, 0x8C, 0x20,
+    0xAA, 0xE0, 0x3F, 0x37, 0x03, 0x83, 0x03, 0x03, 0xC3, 0x9F, 0xF3, 0xA6, 0x25, 0x7F, 0xD9, 0x18,
+    0x0E, 0x02, 0x15, 0xBE, 0x67, 0x65, 0x60, 0xD8, 0xF6, 0x6F, 0x1F, 0x1B, 0x03, 0x00, 0xAC, 0x93,
+    0x33, 0x87, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x50, 0x60, 0x64, 0x60, 0x60, 0x38, 0xFC, 0xFF, 0xBF,
+    0x35, 0x83, 0xC1, 0xFF, 0xFF, 0xFF, 0xF5, 0x19, 0x36, 0xFC, 0x67, 0x33, 0x60, 0x63, 0x78, 0x70,
+    0x1E, 0x28, 0xCA, 0xF0, 0x61, 0x3F, 0x9C, 0xFC, 0x0D, 0x94, 0xCC, 0x07, 0x93, 0xF6, 0x0C, 0x46,
+    0x9F, 0xCF, 0x1B, 0x33, 0xA3, 0xC8, 0x52, 0x4E, 0x02, 0x00, 0x6A, 0x63, 0x2E, 0x1D, 0x78, 0x9C,
+    0x25, 0x4E, 0x41, 0x0E, 0xC1, 0x50, 0x10, 0x7D, 0xBF, 0xDA, 0x12, 0x45, 0xDC, 0xA0, 0xC4, 0x01,
+    0x34, 0x69, 0xEC, 0xBB, 0xB4, 0x92, 0xE0, 0x00, 0xB5, 0xB7, 0x71, 0x03, 0xDC, 0xC0, 0xDA, 0xC6,
+    0x11, 0x88, 0xC4, 0xDA, 0x11, 0xBA, 0x61, 0x5D, 0x7B, 0x12, 0x49, 0x23, 0xB4, 0x15, 0x9E, 0xF9,
+    0x35, 0x8B, 0x37, 0x6F, 0x66, 0xDE, 0xCC, 0x1B, 0x40, 0x47, 0xD3, 0x28, 0x70, 0x94, 0x57, 0x81,
+    0xC3, 0x97, 0x64, 0x03, 0x3B, 0xC1, 0xE3, 0xDA, 0x42, 0x1E, 0xF5, 0xCE, 0x91, 0x42, 0x8B, 0x35,
+    0xE0, 0xE3, 0x60, 0x46, 0x0B, 0x48, 0xBB, 0x58, 0xB0, 0x04, 0x3C, 0x43, 0xA9, 0x4D, 0xE0, 0x15,
+    0xC2, 0xA3, 0x23, 0x73, 0x17, 0x78, 0x6F, 0x8C, 0xBD, 0xE6, 0x2B, 0xD9, 0x8F, 0x15, 0x44, 0xC8,
+    0x7B, 0x45, 0x8E, 0x3F, 0xDC, 0xB6, 0xD2, 0x26, 0x59, 0xBD, 0x70, 0x44, 0x3A, 0xF7, 0x3B, 0xBA,
+    0x91, 0x68, 0x9D, 0x0D, 0x78, 0x57, 0x21, 0xDB, 0xFF, 0x37, 0x27, 0x9A, 0x43, 0xB1, 0x41, 0xC0,
+    0x72, 0x12, 0x4A, 0x9E, 0xD0, 0xBE, 0xB0, 0xEF, 0x8F, 0x33, 0xAA, 0x80, 0x3A, 0x06, 0xC0, 0xF2,
+    0xC6, 0x78, 0x0A, 0xFC, 0x00, 0xAA, 0x93, 0x48, 0xA5, 0x78, 0x9C, 0x63, 0x10, 0x64, 0x00, 0x81,
+    0xCF, 0xF5, 0xC4, 0x53, 0x0E, 0xAF, 0xCF, 0xB3, 0x02, 0xA9, 0xEF, 0xFF, 0xFF, 0xE7, 0x33, 0x7C,
+    0x3E, 0x7F, 0xDE, 0xF4, 0xFB, 0x7F, 0xC6, 0xCF, 0xFF, 0xB9, 0x18, 0x1A, 0xFE, 0xB3, 0x7E, 0x3E,
+    0xCF, 0xC0, 0xE0, 0xF0, 0x9F, 0x1D, 0xA4, 0xD2, 0x80, 0x5A, 0x14, 0x00, 0x8A, 0xD2, 0x39, 0x82,
+    0x78, 0x9C, 0xBB, 0x1C, 0xF7, 0xEB, 0xFD, 0xEF, 0xF7, 0x97, 0xE3, 0x18, 0xC0, 0xE0, 0x73, 0x3D,
+    0x7E, 0x08, 0x00, 0x89, 0xC8, 0x1D, 0x56, 0x78, 0x9C, 0x63, 0x30, 0x78, 0xCB, 0xC2, 0xB0, 0xE1,
+    0x3F, 0x2F, 0x18, 0x83, 0xD8, 0xC8, 0xC0, 0xE1, 0x3F, 0x1B, 0xD9, 0x38, 0xE0, 0x3F, 0x2B, 0x43,
+    0xC2, 0x7F, 0x16, 0x86, 0x05, 0xFF, 0x19, 0x18, 0x3E, 0xAF, 0x67, 0x28, 0xF8, 0xAF, 0xC7, 0xF0,
+    0xF1, 0x3E, 0x13, 0x43, 0x03, 0x3B, 0x03, 0x03, 0x00, 0x59, 0xE8, 0x22, 0xB4, 0x78, 0x9C, 0x4B,
+    0xF4, 0x60, 0x00, 0x81, 0xCF, 0xF5, 0xA4, 0x50, 0x9F, 0xEE, 0x83, 0xA9, 0xBF, 0xFA, 0x20, 0x6A,
+    0xC1, 0x7F, 0x56, 0x10, 0xF5, 0xAD, 0x1F, 0x24, 0x67, 0xF0, 0x9F, 0x1B, 0x44, 0x3D, 0xBC, 0xCF,
+    0x08, 0xA2, 0x7E, 0xEB, 0x83, 0x34, 0xAC, 0xFF, 0xCF, 0x0B, 0xD6, 0xF7, 0x63, 0x3E, 0x98, 0xBA,
+    0x00, 0x54, 0x0F, 0xA4, 0x14, 0xFE, 0xCB, 0x81, 0x0D, 0xFB, 0xB6, 0x1F, 0x4C, 0x6D, 0xF8, 0xCF,
+    0x0E, 0xA2, 0x04, 0xFE, 0x81, 0xCD, 0x64, 0xF8, 0x0A, 0xB1, 0x61, 0xC2, 0x7F, 0x4E, 0x00, 0x9E,
+    0x59, 0x38, 0xB9, 0x78, 0x9C, 0x0B, 0x54, 0x67, 0xF8, 0x16, 0x4F, 0x0E, 0xFA, 0x1A, 0xCF, 0xF0,
+    0x79, 0xBD, 0xF0, 0x85, 0xFF, 0xF3, 0x15, 0x7E, 0xCF, 0x03, 0x00, 0x12, 0x75, 0x1F, 0xA3, 0x78,
+    0x9C, 0xFB, 0x2C, 0x1F, 0xF0, 0x67, 0x1E, 0x83, 0xC2, 0xAB, 0xF3, 0xAC, 0x0C, 0x9F, 0xED, 0x7F,
+    0xFE, 0xFF, 0xCF, 0xF3, 0xF8, 0xFF, 0xFF, 0x78, 0x86, 0xCF, 0xFB, 0xD7, 0xBB, 0xFC, 0xA9, 0x7F,
+    0x67, 0xF6, 0xFD, 0x3D, 0xC3, 0xE7, 0xFF, 0x9C, 0x0C, 0x1F, 0xFF, 0xEB, 0x31, 0x4C, 0xF8, 0xCF,
+    0xFC, 0xF9, 0x3E, 0x03, 0xC3, 0x85, 0xFF, 0x2C, 0x0C, 0x09, 0xFF, 0x59, 0x3F, 0xD7, 0x33, 0x30,
+    0x1C, 0x78, 0xCF, 0xC0, 0x10, 0xF0, 0x9F, 0x8D, 0xBE, 0x4C, 0x00, 0x81, 0xF3, 0x4F, 0x40, 0x78,
+    0x9C, 0xFB, 0x2C, 0xEF, 0xF0, 0xFA, 0x3C, 0x2B, 0xC3, 0x67, 0xFB, 0x1F, 0xFF, 0xFF, 0xE7, 0x33,
+    0x7C, 0x5E, 0x7F, 0xDE, 0xF4, 0xFB, 0x7F, 0xC6, 0xCF, 0xFF, 0xB9, 0x18, 0x1A, 0xFE, 0xB3, 0x7E,
+    0xBE, 0xCF, 0xC0, 0xE0, 0xF0, 0x9F, 0xFD, 0x73, 0x3D, 0x03, 0x83, 0x01, 0xB5, 0x28, 0x00, 0x98,
+    0xD1, 0x30, 0x16, 0x78, 0x9C, 0x63, 0x60, 0xD8, 0xF2, 0x77, 0x1F, 0x1B, 0x03, 0x03, 0xC3, 0x82,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x67, 0x64, 0x60, 0xF8, 0x7D, 0xDE, 0x74, 0xEB, 0x7F, 0x1E, 0x86, 0x80,
+    0xFF, 0xDC, 0x0C, 0x0C, 0xBF, 0xF2, 0x19, 0x36, 0xFC, 0x67, 0x62, 0x60, 0xF8, 0x78, 0x9F, 0xE1,
+    0xE3, 0x79, 0xA0, 0x9A, 0x03, 0xFF, 0x19, 0x3F, 0xAF, 0x07, 0xD2, 0x13, 0xFE, 0xB3, 0x7C, 0x99,
+    0x0F, 0xA4, 0x1B, 0xFE, 0xB3, 0x7E, 0x85, 0xD2, 0x50, 0x71, 0x66, 0x98, 0x3A, 0x20, 0x62, 0x00,
+    0x69, 0x4A, 0xF8, 0xCF, 0x05, 0x34, 0x27, 0x9E, 0x81, 0xE1, 0xCF, 0x7E, 0xA0, 0xB9, 0x40, 0x33,
+    0x0F, 0x02, 0xED, 0xD9, 0x0F, 0x54, 0xC3, 0xB0, 0xF5, 0xDF, 0x3E, 0x16, 0x06, 0x06, 0x00, 0x8D,
+    0x15, 0x35, 0x61, 0x78, 0x9C, 0xFB, 0x2C, 0x9F, 0xF0, 0xE7, 0x1C, 0x2B, 0xC3, 0x67, 0xFB, 0xDF,
+    0xFF, 0xFF, 0xCF, 0x67, 0xF8, 0x7C, 0x7F, 0xBD, 0xC9, 0x8F, 0xFF, 0xAC, 0x9F, 0xFF, 0xB3, 0x31,
+    0x04, 0xFC, 0xE7, 0xFD, 0x3C, 0x9F, 0x81, 0x81, 0xE1, 0xAF, 0xFE, 0xE7, 0x7A, 0x20, 0xF5, 0x33,
+    0x1E, 0x4C, 0x7D, 0xAF, 0x07, 0x53, 0xDF, 0x50, 0xA8, 0xEF, 0xF9, 0x10, 0x25, 0xFE, 0x60, 0xEA,
+    0x1F, 0xFF, 0xE7, 0xFB, 0x8C, 0x0C, 0x05, 0xFF, 0xB9, 0x3E, 0xFF, 0xCF, 0x73, 0xFE, 0xF9, 0x9F,
+    0xE9, 0xF3, 0xFE, 0xFF, 0xFF, 0xFF, 0xC7, 0x33, 0x7C, 0xAE, 0x5F, 0xFC, 0x6F, 0x1D, 0x13, 0x03,
+    0x58, 0x09, 0x03, 0x5E, 0xEA, 0xB1, 0x0F, 0x98, 0x02, 0x00, 0x05, 0xD7, 0x3F, 0x83, 0x78, 0x9C,
+    0x85, 0xCC, 0x3D, 0x0E, 0x82, 0x40, 0x00, 0x44, 0xE1, 0x97, 0x68, 0x27, 0x85, 0xD7, 0xB0, 0xC7,
+    0x9E, 0x9E, 0x4B, 0x78, 0x34, 0x2E, 0x60, 0x86, 0x1B, 0x60, 0x69, 0x47, 0x87, 0xB1, 0x33, 0x5E,
+    0x60, 0x17, 0x2D, 0xF9, 0x19, 0x75, 0x63, 0x41, 0x47, 0xF5, 0x25, 0x2F, 0x93, 0x81, 0x5B, 0x28,
+    0x2B, 0x71, 0xB1, 0x7D, 0x15, 0x43, 0x7B, 0xEC, 0xAC, 0xC2, 0x19, 0x0C, 0xAA, 0xBC, 0x85, 0xA8,
+    0x87, 0xF9, 0xD1, 0xB7, 0x89, 0x57, 0xB3, 0xE4, 0x1F, 0x63, 0x48, 0xD4, 0xDE, 0x40, 0xAF, 0x93,
+    0x77, 0x30, 0x8A, 0xA9, 0xC9, 0xBB, 0x59, 0x3C, 0xBF, 0xD7, 0x6F, 0xB1, 0xBF, 0x87, 0x43, 0x14,
+    0xA4, 0xE5, 0x2A, 0xF5, 0xF9, 0x03, 0x82, 0x38, 0x45, 0x1C, 0x78, 0x9C, 0xFB, 0x2C, 0x5F, 0xF0,
+    0x97, 0xF7, 0xB3, 0xFD, 0xAF, 0xFF, 0x5C, 0x9F, 0xE7, 0xEF, 0x37, 0x61, 0xFE, 0xFC, 0x9F, 0x9B,
+    0x81, 0xE1, 0xF3, 0x7F, 0x26, 0x20, 0x71, 0x9E, 0x01, 0x48, 0xF4, 0x83, 0x88, 0x7A, 0x12, 0x08,
+    0x00, 0x41, 0x8F, 0x1C, 0x81, 0x78, 0x9C, 0x63, 0x50, 0xB8, 0xF9, 0x7F, 0x2E, 0x33, 0x03, 0xC3,
+    0xD7, 0xFF, 0xFF, 0xFF, 0xAF, 0x67, 0x50, 0xF8, 0x5F, 0x6F, 0xBC, 0x6D, 0x3F, 0x43, 0xC1, 0x7F,
+    0x36, 0x06, 0x06, 0x61, 0x86, 0x09, 0xFF, 0x59, 0x18, 0x80, 0x20, 0xE0, 0xBF, 0x0C, 0x88, 0x62,
+    0xF8, 0xF3, 0x3F, 0x8A, 0x11, 0x48, 0x2D, 0xFC, 0xFF, 0x7F, 0x3F, 0x50, 0x03, 0x43, 0xD1, 0x9F,
+    0xFF, 0xF9, 0x20, 0x61, 0x81, 0x1F, 0xFF, 0x99, 0x40, 0x74, 0xC1, 0x7F, 0x0E, 0x10, 0xE5, 0xF0,
+    0x9F, 0x53, 0x00, 0xA8, 0x7B, 0xC2, 0x7F, 0xF6, 0x03, 0xF7, 0xDD, 0x9D, 0x7F, 0xFD, 0x67, 0x6C,
+    0x00, 0x9A, 0xFC, 0xDF, 0x8F, 0x81, 0xA1, 0xE9, 0xCD, 0xFF, 0x1A, 0x46, 0x06, 0x00, 0x17, 0x19,
+    0x29, 0xE4, 0x78, 0x9C, 0x63, 0x98, 0xD0, 0xCD, 0x00, 0x04, 0x1F, 0xD6, 0xA3, 0x91, 0xBF, 0xFF,
+    0xFF, 0xFF, 0x6F, 0x0F, 0x26, 0xE5, 0x19, 0x8C, 0x3E, 0xEF, 0x37, 0x66, 0xC2, 0xA2, 0x86, 0x38,
+    0xF2, 0x3C, 0x88, 0xDC, 0xF0, 0xDF, 0xBC, 0x8D, 0x81, 0xC1, 0x00, 0x68, 0x1C, 0x0B, 0x03, 0xC3,
+    0xE6, 0xFF, 0xBD, 0x8C, 0x00, 0x9F, 0x57, 0x28, 0x93, 0x78, 0x9C, 0xFB, 0x16, 0xCF, 0xC0, 0x50,
+    0xF0, 0x9F, 0xF9, 0x1B, 0x55, 0xA8, 0xAF, 0x40, 0x6A, 0xC3, 0x7F, 0xE6, 0x2F, 0xFD, 0x0C, 0x0C,
+    0xDF, 0xFF, 0x33, 0x3F, 0xF8, 0xAF, 0xB6, 0xF8, 0xFC, 0x7F, 0xE6, 0x84, 0xFF, 0xFF, 0xFF, 0x5B,
+    0xFD, 0x67, 0x66, 0x38, 0xFA, 0x3F, 0x47, 0xE1, 0x3F, 0x33, 0x00, 0x30, 0xD2, 0x31, 0x74, 0x78,
+    0x9C, 0xFB, 0x11, 0xCF, 0xC0, 0xC0, 0xF0, 0xE0, 0x3D, 0xC3, 0xE7, 0xF5, 0x40, 0xFA, 0xF3, 0x7C,
+    0x86, 0x0B, 0xEF, 0x81, 0xF4, 0x0F, 0x7B, 0x86, 0x86, 0xFF, 0xCC, 0x0C, 0x0C, 0x7F, 0xF8, 0x18,
+    0x0C, 0xFE, 0x73, 0x30, 0x08, 0xFC, 0xE7, 0x64, 0x60, 0xF8, 0xC7, 0xCB, 0x90, 0xF0, 0x9F, 0x05,
+    0x28, 0xA7, 0xCF, 0xB0, 0x01, 0xA4, 0xE6, 0x73, 0x3E, 0xC3, 0x87, 0xF9, 0x20, 0xBD, 0xFB, 0x19,
+    0xBE, 0xF8, 0x03, 0xE9, 0x86, 0xFF, 0x0C, 0x3F, 0xF9, 0x81, 0xB4, 0xC1, 0x7F, 0xD6, 0xBF, 0x5C,
+    0x40, 0x9A, 0xE1, 0x9F, 0x26, 0x48, 0x39, 0x03, 0xC3, 0xCF, 0xBA, 0xFF, 0x20, 0x8A, 0xE1, 0xF3,
+    0xFB, 0xF5, 0x60, 0xFA, 0xC1, 0xFF, 0x78, 0x30, 0x3D, 0xE1, 0x3F, 0x48, 0x39, 0x00, 0x1D, 0x95,
+    0x29, 0x02, 0x78, 0x9C, 0x0D, 0x8E, 0xCB, 0x0D, 0x82, 0x50, 0x14, 0x44, 0x4F, 0x24, 0xFE, 0x7F,
+    0x74, 0x80, 0x1D, 0x60, 0x07, 0x96, 0x20, 0x89, 0x05, 0x40, 0x07, 0x96, 0x20, 0x3B, 0x97, 0xD8,
+    0x01, 0x96, 0xC0, 0xDA, 0x0D, 0x76, 0x00, 0x1D, 0x48, 0x03, 0x46, 0x11, 0x51, 0x02, 0xF1, 0x5D,
+    0xEF, 0x6E, 0x26, 0x39, 0x99, 0x33, 0xB5, 0x0F, 0x4F, 0xE9, 0xE1, 0x89, 0x55, 0x46, 0x50, 0xC9,
+    0x80, 0x50, 0xC8, 0x33, 0xF8, 0xCA, 0x98, 0x24, 0xE3, 0x2C, 0xD0, 0xB6, 0x33, 0x8A, 0x88, 0x40,
+    0x39, 0x53, 0x2D, 0x79, 0xF9, 0xAC, 0xA5, 0x6F, 0x3F, 0x8A, 0x0D, 0xB5, 0x03, 0x32, 0xF2, 0xD2,
+    0x64, 0x4F, 0xB3, 0x80, 0x6E, 0x1A, 0x1E, 0xC2, 0x98, 0x6E, 0x82, 0xD6, 0xEB, 0xD6, 0xBB, 0x61,
+    0x86, 0xF0, 0x76, 0x9F, 0x8E, 0x2D, 0xB6, 0x58, 0x50, 0xFA, 0xD5, 0x1C, 0xB3, 0xD3, 0x4D, 0xF2,
+    0xE8, 0x33, 0xA1, 0x3B, 0xAA, 0x89, 0x53, 0xDA, 0x0E, 0x69, 0x2E, 0xB1, 0xC6, 0xE0, 0xF1, 0xB3,
+    0xA8, 0xEF, 0xFA, 0x8A, 0x95, 0x28, 0x56, 0x8A, 0xAB, 0x11, 0x73, 0x83, 0x42, 0xD4, 0xF0, 0x07,
+    0xCD, 0x7C, 0x48, 0x5A, 0x78, 0x9C, 0x7B, 0xF0, 0x9F, 0x89, 0x81, 0xE1, 0x9F, 0xBC, 0xC3, 0x7F,
+    0x6E, 0x86, 0x82, 0xFF, 0xEC, 0x0C, 0xBF, 0xFC, 0x19, 0x1E, 0x9E, 0x67, 0x60, 0xF8, 0x78, 0x9E,
+    0xE1, 0x87, 0x3E, 0x03, 0x43, 0xC2, 0x7F, 0xD5, 0xFF, 0x1C, 0x0C, 0x0C, 0x0C, 0x7F, 0xD6, 0xDE,
+    0x07, 0x92, 0x0C, 0x9F, 0xFF, 0xFB, 0x83, 0xA8, 0x05, 0xFF, 0x79, 0x41, 0xD4, 0xC7, 0xFF, 0xF1,
+    0x20, 0xEA, 0xD7, 0xDD, 0xF7, 0x40, 0x32, 0xE0, 0x7F, 0xC8, 0x7F, 0x4E, 0x06, 0x86, 0x87, 0xFB,
+    0x19, 0xFE, 0xD8, 0x33, 0x30, 0xFC, 0xD4, 0x67, 0xF8, 0x7C, 0x9E, 0xC1, 0x01, 0x28, 0xB2, 0xE0,
+    0x3F, 0xFB, 0x85, 0xFF, 0x8C, 0x0C, 0x02, 0xFF, 0xE5, 0x7F, 0xD4, 0x03, 0x95, 0xFD, 0xD8, 0x0F,
+    0x00, 0x6F, 0xE1, 0x2B, 0x3E, 0x78, 0x9C, 0x25, 0xCD, 0xCB, 0x11, 0x82, 0x50, 0x0C, 0x85, 0xE1,
+    0x5F, 0xD1, 0xF1, 0x39, 0x6A, 0x07, 0xEC, 0xDD, 0xD8, 0x02, 0x0D, 0x38, 0xD8, 0x01, 0x5A, 0x81,
+    0xAD, 0xD8, 0x01, 0x76, 0x80, 0x1D, 0x50, 0x82, 0x94, 0xA0, 0x15, 0x5C, 0x06, 0xDF, 0x32, 0x12,
+    0x93, 0xCB, 0xEA, 0xCB, 0x24, 0x27, 0xC9, 0x3B, 0x06, 0x0A, 0xC7, 0x2D, 0x55, 0xAB, 0x94, 0x8B,
+    0x53, 0x9F, 0x31, 0x07, 0xE9, 0x42, 0x3D, 0x23, 0x92, 0x01, 0xC8, 0x08, 0x9A, 0xA9, 0xD6, 0x3D,
+    0xF8, 0x84, 0x3A, 0xD3, 0xCC, 0x3D, 0xA1, 0xC8, 0xD4, 0x32, 0xA3, 0x4A, 0xD4, 0xA3, 0xE3, 0x35,
+    0x57, 0x37, 0x12, 0xD4, 0x63, 0x15, 0x19, 0x4A, 0xDF, 0xFC, 0xAE, 0xA5, 0x63, 0x3E, 0xF2, 0xDC,
+    0xA0, 0x94, 0xBD, 0xF7, 0x24, 0xA1, 0x97, 0xDF, 0xC4, 0x13, 0xB5, 0x71, 0xAE, 0x67, 0xCF, 0xAE,
+    0x59, 0x19, 0x5B, 0xB1, 0xA7, 0x76, 0x76, 0xE9, 0xDB, 0x8B, 0xA0, 0x5D, 0xFA, 0x03, 0x11, 0xA9,
+    0x32, 0x31, 0x78, 0x9C, 0x9B, 0xF0, 0x1F, 0x08, 0xCE, 0x4F, 0x00, 0x93, 0x02, 0xC6, 0xC6, 0xC6,
+    0xBF, 0xF2, 0x19, 0x18, 0x18, 0x14, 0xFE, 0x73, 0x03, 0xC9, 0x0B, 0xFF, 0x19, 0x81, 0xE4, 0x0F,
+    0x90, 0x80, 0x01, 0x44, 0xE0, 0x3D, 0x58, 0x20, 0x1E, 0x2C, 0xC0, 0x85, 0x55, 0xE0, 0xBF, 0x89,
+    0xB1, 0xB1, 0xF2, 0x17, 0xB0, 0x69, 0x60, 0x72, 0x3E, 0x00, 0x9C, 0xD2, 0x28, 0xDE, 0x78, 0x9C,
+    0x63, 0x60, 0x58, 0xF2, 0x8F, 0x91, 0x21, 0xE1, 0xFF, 0x7F, 0x46, 0x86, 0x07, 0xFF, 0xCD, 0x19,
+    0x18, 0x3E, 0xD5, 0x33, 0x30, 0x30, 0x7C, 0x8E, 0x27, 0x48, 0x7C, 0xF1, 0x07, 0x12, 0xDF, 0xEC,
+    0x19, 0x18, 0x02, 0xFE, 0xF2, 0x01, 0x79, 0xFB, 0x99, 0x80, 0xC4, 0x7B, 0x56, 0x06, 0x06, 0x81,
+    0x3F, 0xF2, 0x40, 0x89, 0xAF, 0xFE, 0xC4, 0x99, 0x02, 0xB6, 0xED, 0xC3, 0x7B, 0x33, 0x06, 0x86,
+    0x02, 0x90, 0x0B, 0x18, 0xB6, 0xFE, 0x63, 0x04, 0x00, 0x7A, 0x09, 0x2B, 0x8E, 0x78, 0x9C, 0xFB,
+    0x2A, 0xFF, 0x95, 0x0C, 0x08, 0x00, 0x2C, 0x2E, 0x1D, 0x1D, 0x78, 0x9C, 0x7B, 0x55, 0xC3, 0xC0,
+    0xF0, 0xFB, 0x3F, 0x0F, 0x43, 0xD0, 0x1F, 0x7F, 0x06, 0x86, 0x8F, 0xFD, 0x0C, 0x0C, 0x0F, 0xE6,
+    0x03, 0xF1, 0x7A, 0xDC, 0xF8, 0xC2, 0x79, 0x06, 0x86, 0x86, 0xFF, 0xEA, 0x0C, 0x0C, 0x3F, 0xD6,
+    0x33, 0x08, 0xFC, 0x5E, 0xCF, 0xB0, 0xE0, 0x3F, 0x0B, 0xC3, 0x85, 0xFD, 0x78, 0xF4, 0x00, 0xCD,
+    0xFB, 0xD0, 0xCF, 0x10, 0xF4, 0x3B, 0x1E, 0x68, 0x0F, 0x2F, 0xC3, 0xAF, 0x1E, 0x06, 0x06, 0x00,
+    0x95, 0x67, 0x2E, 0x5B, 0x78, 0x9C, 0x13, 0x78, 0xB5, 0x9E, 0x89, 0x41, 0x95, 0xE1, 0xE1, 0xFF,
+    0xFF, 0xFD, 0xCD, 0xEF, 0x19, 0x7E, 0x7B, 0x3F, 0xFB, 0xFF, 0x3F, 0x9F, 0x61, 0x32, 0x83, 0xC0,
+    0x8B, 0xF3, 0x2C, 0x0C, 0x00, 0xCA, 0x61, 0x0D, 0xA8, 0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x78, 0x9C, 0x5B, 0xB0, 0x9F, 0xE1, 0xDB, 0x7F, 0xB6, 0x6F, 0xFF, 0xD9, 0x37, 0xEC, 0x67,
+    0x40, 0x06, 0x0B, 0xF6, 0x33, 0x2C, 0x38, 0xCF, 0xB0, 0x01, 0x82, 0xEE, 0x33, 0x1C, 0x00, 0xA2,
+    0xF7, 0x20, 0x74, 0x01, 0x88, 0xFE, 0x83, 0xD0, 0x03, 0x30, 0x02, 0x00, 0x27, 0xDD, 0x1C, 0x39,
+    0x78, 0x9C, 0x63, 0x60, 0x60, 0xF8, 0xCD, 0xC9, 0x00, 0x02, 0xD8, 0x28, 0x81, 0x3F, 0xD2, 0x40,
+    0x52, 0xE1, 0xF7, 0xFF, 0xFF, 0x52, 0x0C, 0x0C, 0x8F, 0xFE, 0xFF, 0xFF, 0x7F, 0x9F, 0x81, 0xE1,
+    0xEF, 0x7A, 0xA6, 0x42, 0x3F, 0x86, 0x84, 0xFF, 0x5C, 0x20, 0x05, 0x07, 0xFE, 0x33, 0x82, 0xA8,
+    0x8F, 0xE7, 0xC1, 0x9A, 0x3E, 0xAF, 0x07, 0x53, 0x5F, 0xE6, 0x83, 0xA9, 0xAF, 0xF3, 0x91, 0x79,
+    0x9F, 0x20, 0x4A, 0x1E, 0x40, 0x34, 0x4C, 0xF8, 0xCF, 0x01, 0x36, 0xFF, 0xFF, 0x7C, 0x90, 0x61,
+    0x0C, 0x5F, 0x21, 0x46, 0x3B, 0xFC, 0xFB, 0xFF, 0x5F, 0x07, 0x28, 0xEC, 0xF0, 0xD7, 0x06, 0xA7,
+    0x93, 0xC0, 0x14, 0x00, 0x44, 0x73, 0x30, 0x44, 0x78, 0x9C, 0x63, 0x60, 0x28, 0xF8, 0x73, 0x5F,
+    0x82, 0x81, 0x41, 0xE0, 0xCF, 0xFF, 0xFF, 0xEF, 0x59, 0x18, 0x16, 0xFC, 0xF7, 0x4E, 0xFE, 0x2B,
+    0xCF, 0xF0, 0x71, 0x3F, 0x03, 0xC3, 0x02, 0x66, 0x86, 0xAF, 0xF1, 0x0C, 0x20, 0xF0, 0xCD, 0x1E,
+    0x4C, 0x7D, 0xC7, 0x42, 0x7D, 0xFD, 0x0F, 0x04, 0xFE, 0x30, 0xCA, 0xF0, 0x47, 0xBC, 0xB1, 0x31,
+    0x33, 0x76, 0x95, 0x0C, 0x3F, 0xE4, 0xC1, 0xD4, 0x1F, 0x1E, 0x10, 0xB9, 0xF9, 0xBD, 0x89, 0xB1,
+    0xB1, 0x31, 0xD3, 0x5F, 0x90, 0xBE, 0xFF, 0x5C, 0x10, 0x8A, 0x03, 0x00, 0x36, 0x5E, 0x32, 0xED,
+    0x78, 0x9C, 0x1D, 0x8D, 0x31, 0x12, 0xC1, 0x40, 0x00, 0x45, 0xDF, 0x5A, 0x34, 0xC1, 0x68, 0xF4,
+    0x5B, 0xAA, 0x8C, 0x1B, 0x44, 0xA9, 0x73, 0x04, 0x99, 0x49, 0xA9, 0xE0, 0x06, 0xDC, 0x40, 0xE7,
+    0x3A, 0x71, 0x84, 0x38, 0x41, 0x26, 0xE3, 0x00, 0x19, 0xC3, 0x28, 0xD8, 0xEC, 0x97, 0xF5, 0x9A,
+    0xD7, 0xBD, 0x87, 0xA1, 0x63, 0x4A, 0xB6, 0x89, 0xBE, 0x25, 0xA5, 0x72, 0x5F, 0xCD, 0x7D, 0xEA,
+    0x82, 0x22, 0x43, 0x9E, 0x5A, 0xE7, 0xED, 0x19, 0x5E, 0x7B, 0xA8, 0x0B, 0xF8, 0x4C, 0xE0, 0x20,
+    0x43, 0x9B, 0xC0, 0x4A, 0x7D, 0xC2, 0xDF, 0x03, 0xFC, 0x18, 0x32, 0x59, 0xDE, 0x5D, 0xA8, 0xAC,
+    0xE0, 0xD1, 0xCC, 0x96, 0xDF, 0x23, 0xF8, 0x98, 0x69, 0xEC, 0x55, 0x17, 0x69, 0x17, 0x16, 0xA7,
+    0x2D, 0xAE, 0xC7, 0x7D, 0x84, 0x8D, 0x3F, 0x67, 0x7E, 0x9C, 0x26, 0x32, 0x4E, 0x78, 0x9C, 0xFB,
+    0x99, 0xCF, 0x00, 0x04, 0x3F, 0xED, 0x3F, 0xBE, 0x07, 0x52, 0x0A, 0xFF, 0xB9, 0x0A, 0xFE, 0xB3,
+    0x31, 0x30, 0x2C, 0xF8, 0xCF, 0xC8, 0xF0, 0x8F, 0x8F, 0x81, 0xE1, 0x53, 0x3F, 0x03, 0xC3, 0xD7,
+    0x7A, 0x06, 0x86, 0x5F, 0x40, 0xF6, 0x81, 0xF7, 0x8C, 0x06, 0x20, 0x39, 0x83, 0xFF, 0x1C, 0x1B,
+    0xEE, 0x83, 0xF4, 0xFC, 0x92, 0xFF, 0xEC, 0x0F, 0xA2, 0x3F, 0xCD, 0xFF, 0xC3, 0x03, 0xA2, 0x1B,
+    0xFE, 0xFF, 0x67, 0x06, 0x19, 0xF5, 0x1F, 0x08, 0xEC, 0x19, 0x18, 0x6E, 0xDC, 0xFD, 0x77, 0xFF,
+    0xAE, 0x2E, 0x48, 0xE2, 0x87, 0x3D, 0x03, 0x03, 0x82, 0x86, 0xC9, 0xC3, 0x68, 0x43, 0xE3, 0x5F,
+    0xF1, 0xC6, 0xCC, 0x98, 0xEA, 0xA0, 0x34, 0x00, 0x37, 0xF4, 0x37, 0x26, 0x78, 0x9C, 0xFB, 0x2A,
+    0xFF, 0x15, 0x0B, 0x64, 0x80, 0x03, 0x6C, 0xB2, 0x5F, 0xE5, 0x01, 0x95, 0xCA, 0x17, 0xB9, 0x78,
+    0x9C, 0x63, 0x68, 0xFC, 0xF3, 0xDE, 0x8B, 0x41, 0xE1, 0xDF, 0xFF, 0xFF, 0xFF, 0x79, 0x2E, 0xFC,
+    0xF7, 0x08, 0xFE, 0xC5, 0xFD, 0x69, 0x3E, 0x03, 0x83, 0x02, 0xD3, 0xE7, 0x7A, 0x06, 0x20, 0xF8,
+    0x78, 0x9F, 0x11, 0x48, 0x4E, 0xF8, 0x5F, 0x07, 0xA4, 0x04, 0xFE, 0xFD, 0xDF, 0xCF, 0xC2, 0xF0,
+    0x70, 0xFD, 0x8B, 0xFF, 0xE7, 0x19, 0x7F, 0xF2, 0x31, 0x1C, 0xFD, 0xCF, 0xFB, 0x8F, 0x8B, 0x81,
+    0xE1, 0x47, 0xFC, 0x3F, 0x5E, 0xA0, 0xBA, 0xFA, 0x5F, 0xF3, 0x19, 0x19, 0x3E, 0xFB, 0x5F, 0xFC,
+    0xBF, 0x9F, 0xF5, 0x37, 0x0F, 0xC3, 0xF3, 0xFF, 0x40, 0x35, 0x0C, 0x0C, 0x93, 0xFF, 0x9F, 0x67,
+    0x00, 0x6B, 0xE7, 0x00, 0x51, 0x20, 0x75, 0x40, 0x92, 0xE7, 0xA1, 0x05, 0xC3, 0xA2, 0xFF, 0xEC,
+    0x3F, 0x80, 0x16, 0x9E, 0x67, 0x48, 0xF8, 0xF3, 0xFF, 0x3E, 0x3B, 0x50, 0x54, 0x09, 0xA8, 0x1A,
+    0x00, 0xD5, 0x6C, 0x3B, 0x3C, 0x78, 0x9C, 0x9B, 0xB0, 0x9E, 0xA1, 0xE0, 0x3C, 0xC3, 0xC7, 0xFF,
+    0x4C, 0x1F, 0xFE, 0xB3, 0x4C, 0x00, 0xB3, 0x01, 0x58, 0x45, 0x08, 0xE2, 0x78, 0x9C, 0x63, 0x60,
+    0x60, 0x68, 0xBE, 0xBD, 0x46, 0x9C, 0x01, 0x04, 0x36, 0xFD, 0x07, 0x02, 0x0E, 0x20, 0xC3, 0xE1,
+    0x5F, 0x0E, 0x93, 0xE1, 0x8B, 0xF3, 0x8C, 0x0C, 0x0C, 0x9F, 0xF2, 0x19, 0x14, 0x98, 0x18, 0x7E,
+    0xF1, 0x30, 0x30, 0xFC, 0x65, 0x29, 0xF8, 0xF7, 0x9E, 0x75, 0x41, 0x3F, 0x43, 0xC1, 0x7C, 0x86,
+    0x9F, 0xFF, 0xFF, 0xCB, 0x33, 0xFC, 0x63, 0xBC, 0x20, 0x6F, 0xF0, 0x5F, 0x32, 0x91, 0x9D, 0xE1,
+    0x3B, 0xFB, 0x47, 0xEE, 0x09, 0xE7, 0x41, 0x26, 0x7C, 0xE4, 0xFE, 0xCC, 0x79, 0xA0, 0x1E, 0xC4,
+    0xFA, 0xC0, 0xF7, 0x85, 0xFD, 0x42, 0x3E, 0x88, 0x75, 0x81, 0xEF, 0x0B, 0x54, 0xEC, 0x01, 0xDF,
+    0x27, 0xA8, 0xBA, 0x0F, 0x3C, 0x0F, 0xF8, 0x1D, 0xFE, 0x4B, 0x04, 0x72, 0x30, 0x7C, 0xE3, 0x68,
+    0xA8, 0x67, 0xF8, 0xF5, 0xFF, 0xBF, 0x3D, 0xC3, 0x1F, 0x26, 0x81, 0x7F, 0x4C, 0x0D, 0xFF, 0xDF,
+    0xB3, 0x36, 0xAC, 0x67, 0x60, 0xF8, 0x62, 0x07, 0xB2, 0xF7, 0xBB, 0x1C, 0x03, 0x43, 0xC1, 0x7F,
+    0x4B, 0x06, 0x86, 0xA3, 0xEF, 0x99, 0x81, 0xBA, 0x9E, 0xFC, 0x7F, 0xFF, 0xEF, 0xBF, 0x34, 0xD8,
+    0xA9, 0xDB, 0xFE, 0xDD, 0xF7, 0x04, 0x52, 0x00, 0xD2, 0x39, 0x45, 0x84, 0x78, 0x9C, 0x63, 0x98,
+    0xFA, 0xF6, 0xBE, 0x24, 0x03, 0x83, 0xC0, 0xFF, 0xFF, 0xFF, 0xDF, 0x33, 0x32, 0x30, 0x74, 0x9A,
+    0x6E, 0xF9, 0xCF, 0xCE, 0x00, 0x02, 0xFF, 0xB9, 0xC0, 0xD4, 0x3F, 0x6E, 0x06, 0x86, 0xC6, 0x3F,
+    0xFF, 0xFF, 0x73, 0x33, 0x28, 0xFC, 0xFB, 0x0F, 0xA2, 0x0E, 0xFC, 0x8F, 0x36, 0x06, 0x0A, 0x7E,
+    0xB8, 0x0F, 0x96, 0xFB, 0xB8, 0x1F, 0xA8, 0x95, 0x87, 0xE1, 0xC1, 0x7F, 0xF3, 0xAB, 0xFF, 0xF5,
+    0x19, 0x12, 0x80, 0x2A, 0xBE, 0xF5, 0x33, 0x30, 0x1C, 0x7D, 0xAF, 0x1D, 0xE0, 0xCB, 0x40, 0x04,
+    0x50, 0x30, 0x06, 0x01, 0xA0, 0x76, 0x10, 0x80, 0x51, 0x00, 0x95, 0x3F, 0x33, 0xF3, 0x78, 0x9C,
+    0x0D, 0x8C, 0xCB, 0x0D, 0x82, 0x50, 0x14, 0x05, 0x07, 0x34, 0x04, 0xE5, 0x13, 0x36, 0xAC, 0x69,
+    0xC1, 0xAD, 0x2B, 0x2D, 0x81, 0x0E, 0xA0, 0x03, 0xE8, 0x80, 0xD7, 0x01, 0x25, 0x40, 0x09, 0x94,
+    0x40, 0x27, 0x84, 0x0A, 0x5E, 0xA2, 0x81, 0x60, 0x82, 0x5C, 0xEE, 0x66, 0x36, 0x67, 0xCE, 0xC0,
+    0xDB, 0x81, 0x14, 0xF8, 0x66, 0xE4, 0x16, 0x92, 0xE3, 0xCE, 0xA7, 0x85, 0xD1, 0x3A, 0xC9, 0x3F,
+    0x82, 0x5F, 0xC5, 0x20, 0x17, 0x4A, 0x09, 0xD8, 0x3A, 0xB5, 0xC4, 0xCD, 0x25, 0x86, 0xB5, 0xC5,
+    0x88, 0x07, 0x8B, 0xA5, 0x96, 0x10, 0x7A, 0xB9, 0xB1, 0x37, 0x9A, 0xD9, 0x5F, 0xCC, 0xE2, 0xC2,
+    0x3C, 0xF1, 0xD0, 0x8F, 0xC2, 0x67, 0x29, 0x74, 0x58, 0x33, 0x8C, 0xF6, 0x31, 0x57, 0x78, 0x72,
+    0x02, 0x21, 0xFF, 0x26, 0xE6, 0x78, 0x9C, 0x33, 0x30, 0x06, 0x02, 0xE5, 0xCF, 0xFF, 0x81, 0xE0,
+    0x3C, 0x84, 0x64, 0x00, 0x82, 0x05, 0x58, 0x48, 0x00, 0xC7, 0x74, 0x12, 0x58, 0x78, 0x9C, 0x33,
+    0x30, 0x36, 0x36, 0x66, 0xFE, 0xF2, 0xFF, 0xFF, 0x7F, 0x7E, 0x30, 0x01, 0x00, 0x3A, 0x59, 0x08,
+    0xCD, 0x78, 0x9C, 0x63, 0x60, 0x48, 0x78, 0x7D, 0xDF, 0x8A, 0x81, 0x81, 0x41, 0xE1, 0xAD, 0x47,
+    0xF0, 0x2F, 0x4E, 0x06, 0x86, 0x47, 0xDC, 0x0C, 0x0C, 0x06, 0xE7, 0x18, 0x18, 0xEE, 0x06, 0xFC,
+    0x3F, 0xC7, 0xFA, 0x89, 0x23, 0xC0, 0x3F, 0x20, 0x7F, 0xB3, 0xFD, 0x04, 0xF9, 0x0D, 0x7C, 0x01,
+    0xF1, 0x0E, 0xF9, 0x06, 0xF9, 0x0F, 0xB8, 0x02, 0xE2, 0x27, 0xF8, 0x33, 0xCC, 0xFF, 0xC0, 0x19,
+    0xF0, 0xFF, 0x3D, 0x1B, 0xC3, 0xBE, 0x0F, 0x5C, 0x01, 0xF9, 0x6F, 0x19, 0x18, 0xD6, 0x1F, 0xE0,
+    0x09, 0x88, 0xFF, 0xC2, 0x2E, 0x50, 0x5F, 0xA0, 0x1F, 0x10, 0x7F, 0x40, 0xBE, 0x40, 0x5F, 0x60,
+    0x9F, 0x81, 0x95, 0x43, 0xD4, 0x43, 0x2E, 0x86, 0x2F, 0x1C, 0x0C, 0x0C, 0x02, 0x6F, 0x18, 0x19,
+    0x02, 0xCE, 0x8B, 0x28, 0x3C, 0xD7, 0x01, 0x5A, 0xD4, 0xF8, 0xEF, 0x7F, 0x2E, 0x03, 0x08, 0x08,
+    0x30, 0x01, 0x09, 0x00, 0x96, 0x11, 0x2A, 0xFF, 0x78, 0x9C, 0x33, 0x30, 0x36, 0x36, 0x66, 0xFA,
+    0xF4, 0xFF, 0xFF, 0x7F, 0x5E, 0x30, 0x01, 0x00, 0x3A, 0x22, 0x08, 0xC4, 0x78, 0x9C, 0x63, 0x98,
+    0xF8, 0xAF, 0x96, 0x81, 0x41, 0xE1, 0xDF, 0xFF, 0xFF, 0x3C, 0x0C, 0x07, 0xDE, 0x9B, 0x7D, 0xEF,
+    0x67, 0xF8, 0x64, 0xCF, 0x50, 0xF0, 0x9E, 0xE1, 0x2B, 0x1F, 0x83, 0xC2, 0x7F, 0x46, 0x08, 0x09,
+    0x12, 0xF9, 0x0F, 0x96, 0x9D, 0x0F, 0x55, 0xC9, 0x00, 0xD6, 0x05, 0x00, 0x3C, 0xE7, 0x1A, 0xC5,
+    0x78, 0x9C, 0x63, 0x60, 0xF8, 0xD0, 0xCF, 0x00, 0x04, 0xE8, 0xE4, 0xA7, 0xFF, 0x40, 0x70, 0x1E,
+    0x42, 0x1A, 0x18, 0x7F, 0x9E, 0x6F, 0xAC, 0x8C, 0xA9, 0x06, 0x46, 0xA2, 0x03, 0x03, 0x63, 0x20,
+    0x50, 0xFE, 0x0C, 0xD6, 0x0B, 0x21, 0x01, 0x71, 0xA3, 0x26, 0x59, 0x78, 0x9C, 0x63, 0x38, 0xFA,
+    0x5E, 0x8B, 0x61, 0xC2, 0xFF, 0xFF, 0xEF, 0x19, 0x3F, 0xE5, 0x15, 0xFF, 0xE7, 0x34, 0x60, 0x62,
+    0xF8, 0xCD, 0xCD, 0xC0, 0xC0, 0xF0, 0x8B, 0x93, 0x81, 0x41, 0xE0, 0x3F, 0x0B, 0x03, 0xC3, 0x82,
+    0xF5, 0x40, 0xDE, 0x0F, 0x1E, 0x06, 0x86, 0x82, 0xFB, 0x8C, 0x0C, 0x0C, 0xDF, 0x65, 0x19, 0x18,
+    0x1A, 0xDE, 0x9B, 0x18, 0x33, 0x7F, 0xF8, 0xFF, 0xFF, 0x3F, 0x3F, 0x88, 0xE0, 0x05, 0x00, 0x2A,
+    0x01, 0x1A, 0x0C, 0x78, 0x9C, 0x63, 0x38, 0xF6, 0xDE, 0x9A, 0x61, 0xC1, 0xFF, 0xFF, 0xFF, 0x99,
+    0x27, 0xE4, 0x06, 0xFF, 0xE3, 0x62, 0x60, 0x60, 0xF8, 0x01, 0x24, 0x0C, 0xFE, 0xB1, 0x32, 0x04,
+    0xFC, 0xCF, 0x65, 0x60, 0x28, 0xF8, 0x3F, 0x8F, 0x91, 0x41, 0x20, 0xF8, 0x2F, 0x37, 0x50, 0xE2,
+    0x0B, 0xBF, 0x00, 0x03, 0xC3, 0x57, 0xF9, 0x47, 0x31, 0xC9, 0xFF, 0x78, 0x2F, 0x02, 0x75, 0xB0,
+    0x30, 0xDC, 0x78, 0x6F, 0xC5, 0x00, 0x00, 0x4D, 0x64, 0x19, 0xF9, 0x78, 0x9C, 0x63, 0x60, 0x60,
+    0x60, 0x62, 0x60, 0xD8, 0xA4, 0xCF, 0xD0, 0xF0, 0x7F, 0x7D, 0xC2, 0xBF, 0xFB, 0xE2, 0x07, 0xD6,
+    0xB3, 0x30, 0x28, 0x30, 0x32, 0x30, 0x00, 0x00, 0x52, 0x8D, 0x06, 0xFA, 0x78, 0x9C, 0xFB, 0x5C,
+    0xCF, 0xC0, 0x50, 0xF0, 0x9F, 0xF9, 0x33, 0xD5, 0xA8, 0x03, 0xFF, 0x59, 0x3E, 0xEF, 0x67, 0x60,
+    0xF8, 0xF1, 0x9F, 0xF5, 0xF3, 0x7F, 0x8B, 0x2D, 0xE7, 0xFF, 0xB3, 0x7F, 0xFE, 0xFF, 0xFF, 0xBF,
+    0xF4, 0x7F, 0xEE, 0xCF, 0xF9, 0x7F, 0x7B, 0x19, 0x5E, 0x73, 0x7D, 0xF6, 0x67, 0x00, 0x81, 0xCF,
+    0xF9, 0xB8, 0xA9, 0xC7, 0x3E, 0x60, 0x0A, 0x00, 0x04, 0x1F, 0x3C, 0x52, 0x78, 0x9C, 0x63, 0x10,
+    0xD8, 0xFE, 0xEF, 0xFF, 0xFF, 0xFF, 0xF1, 0x0C, 0x4F, 0xFF, 0x83, 0x40, 0xBC, 0x03, 0x90, 0x58,
+    0x6F, 0xFC, 0x25, 0xFE, 0x02, 0x90, 0x9E, 0xCF, 0xF0, 0x31, 0xFE, 0x13, 0x94, 0xFE, 0x8A, 0x46,
+    0x7F, 0x86, 0xD2, 0x1F, 0xA0, 0x74, 0x01, 0x94, 0x66, 0xF8, 0x0D, 0xA5, 0x13, 0xFE, 0x40, 0x68,
+    0x06, 0x86, 0x4B, 0x50, 0xFA, 0x02, 0x9D, 0xE8, 0x03, 0x39, 0x0C, 0x0F, 0xAD, 0x01, 0xB2, 0x12,
+    0x6B, 0x34, 0x78, 0x9C, 0xDB, 0xB0, 0x9E, 0xE1, 0xFB, 0x7F, 0xB6, 0x6F, 0xFF, 0xD9, 0x36, 0xAC,
+    0x67, 0x00, 0x00, 0x2E, 0xE7, 0x06, 0xB6, 0x78, 0x9C, 0x63, 0xF8, 0xCA, 0xC6, 0xC0, 0xF0, 0x83,
+    0x9D, 0x81, 0xE1, 0xD7, 0x7D, 0x16, 0x06, 0x81, 0xEF, 0xFC, 0x0E, 0x26, 0x3F, 0xE4, 0x2F, 0xFC,
+    0xFF, 0xCF, 0x53, 0xF0, 0x77, 0x1E, 0x23, 0x00, 0x8C, 0xCC, 0x0B, 0x5F, 0x78, 0x9C, 0x63, 0x50,
+    0xF8, 0xCD, 0xCF, 0xF0, 0xE3, 0x3F, 0xFF, 0x85, 0xF7, 0x3F, 0xF9, 0x13, 0x24, 0xBF, 0xF0, 0x33,
+    0x30, 0xE0, 0xC7, 0x00, 0xAC, 0x15, 0x0F, 0x8C, 0x78, 0x9C, 0x63, 0x70, 0x78, 0xFD, 0x5E, 0x93,
+    0x81, 0xE1, 0xC7, 0xFF, 0xFF, 0xFF, 0x59, 0x02, 0xFE, 0xC7, 0x16, 0xFF, 0x97, 0xBB, 0xF0, 0x9F,
+    0x91, 0xE1, 0x5B, 0xFD, 0xA7, 0xF5, 0x0C, 0x0C, 0x1F, 0xF6, 0x7F, 0xA9, 0x67, 0x60, 0xB8, 0xF0,
+    0xFE, 0x6B, 0x3E, 0x88, 0x84, 0xB0, 0x21, 0xE2, 0x60, 0x35, 0xF9, 0x09, 0x20, 0xF5, 0x7C, 0x0C,
+    0x3F, 0x81, 0x7A, 0x99, 0x19, 0x02, 0x5E, 0xDF, 0x97, 0x64, 0xC0, 0x0F, 0x0C, 0x8C, 0x81, 0x40,
+    0xF9, 0x33, 0x50, 0xF9, 0xFF, 0xF3, 0x10, 0x12, 0x00, 0x93, 0x63, 0x36, 0x1D, 0x78, 0x9C, 0x0D,
+    0xC8, 0xBD, 0x0D, 0x40, 0x40, 0x18, 0x80, 0xE1, 0x37, 0x17, 0x17, 0x12, 0xCD, 0x2D, 0x20, 0xD1,
+    0xAA, 0xD8, 0xC0, 0x08, 0x6C, 0x60, 0x15, 0x1B, 0x30, 0x82, 0x0D, 0xD8, 0xE0, 0x8C, 0x60, 0x83,
+    0x1B, 0x81, 0x88, 0xDF, 0xE6, 0x3E, 0x8A, 0xA7, 0x79, 0xD2, 0x00, 0x34, 0xEC, 0x39, 0xED, 0x08,
+    0x93, 0x23, 0x95, 0xF0, 0x17, 0xF3, 0x54, 0x70, 0x77, 0x2C, 0xA2, 0x98, 0x45, 0x17, 0x92, 0x50,
+    0x48, 0xCE, 0x6B, 0xE1, 0x6D, 0xD8, 0x56, 0x8C, 0x2F, 0xB9, 0x1C, 0x83, 0x44, 0xE6, 0xFF, 0xC3,
+    0x32, 0x89, 0xC6, 0x27, 0x9C, 0x1D, 0xBD, 0x28, 0xE3, 0x63, 0xF6, 0x8A, 0xDE, 0x41, 0x1D, 0x62,
+    0x32, 0xF8, 0x00, 0xC9, 0xA6, 0x26, 0x4B, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x80, 0x02, 0x76, 0x06,
+    0x04, 0xF8, 0xA8, 0x0F, 0x22, 0x15, 0x7E, 0xF3, 0x83, 0xA8, 0x1F, 0x9C, 0x60, 0xF2, 0x3F, 0x88,
+    0x23, 0xF0, 0x9F, 0x09, 0x48, 0x5E, 0x78, 0xFF, 0x0B, 0xC4, 0x69, 0x98, 0x0F, 0x92, 0x48, 0x90,
+    0xFC, 0x02, 0xE2, 0x7C, 0x94, 0x87, 0x68, 0x05, 0x73, 0x7E, 0x72, 0x22, 0x38, 0x02, 0xFF, 0x19,
+    0x11, 0x9C, 0x09, 0xF3, 0x19, 0x10, 0x9C, 0x4F, 0xF2, 0x0C, 0x13, 0xC4, 0x61, 0x9C, 0x9F, 0x1C,
+    0x0C, 0x9F, 0xF4, 0xA1, 0x1C, 0x05, 0xA0, 0x96, 0x5F, 0x5C, 0x50, 0xCE, 0x82, 0x7E, 0xA0, 0x11,
+    0xCC, 0x50, 0x0E, 0x50, 0x4B, 0xC3, 0x7E, 0x98, 0x2B, 0x7F, 0x71, 0x30, 0x7C, 0xF0, 0x5F, 0x90,
+    0x0F, 0x66, 0x83, 0xB4, 0x7C, 0xE7, 0xD9, 0x00, 0xE1, 0x2C, 0xA8, 0x67, 0x60, 0xF8, 0xC7, 0x7A,
+    0x00, 0xC2, 0xF9, 0xCC, 0xC7, 0xE0, 0xF0, 0x1F, 0x08, 0xC0, 0x7E, 0xF9, 0xCD, 0x8E, 0xE0, 0x18,
+    0xBC, 0x07, 0x12, 0xC6, 0xC6, 0x97, 0xFB, 0x41, 0x5E, 0xDA, 0x50, 0x0F, 0x56, 0x7C, 0x21, 0x1F,
+    0xAA, 0x05, 0xC1, 0xF9, 0x8D, 0x1C, 0x30, 0x6F, 0x90, 0xD8, 0x0C, 0x02, 0x70, 0x16, 0x00, 0x31,
+    0x9C, 0x41, 0x46, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x80, 0x02, 0x76, 0x06, 0x04, 0xF8, 0xA8, 0x0F,
+    0x22, 0x15, 0x7E, 0xF3, 0x83, 0xA8, 0x1F, 0x9C, 0x60, 0xF2, 0x3F, 0x88, 0x23, 0xF0, 0x9F, 0x09,
+    0x48, 0x5E, 0x78, 0xFF, 0x0B, 0xC4, 0x69, 0x98, 0x0F, 0x92, 0x48, 0x90, 0xFC, 0x02, 0xE2, 0x7C,
+    0x94, 0x87, 0x68, 0x05, 0x73, 0x7E, 0x72, 0x22, 0x38, 0x02, 0xFF, 0x19, 0x11, 0x9C, 0x09, 0xF3,
+    0x19, 0x10, 0x9C, 0x4F, 0xF2, 0x02, 0x2F, 0xEF, 0xB3, 0x41, 0x39, 0x3F, 0x39, 0x1E, 0xFD, 0xFF,
+    0x3F, 0x1F, 0xC2, 0x51, 0xF8, 0xCF, 0xF8, 0xD3, 0xEB, 0x08, 0x48, 0x1F, 0x90, 0xB3, 0xA0, 0x9F,
+    0x21, 0x80, 0xC1, 0xE0, 0x3F, 0x33, 0x98, 0xF3, 0x09, 0x64, 0x8B, 0x02, 0xD8, 0x11, 0x0C, 0x0C,
+    0xBF, 0x38, 0x40, 0xEE, 0x3E, 0x0F, 0x66, 0x2B, 0x80, 0x6D, 0xF9, 0x64, 0x0F, 0xE6, 0x2C, 0xA8,
+    0x07, 0x39, 0xF5, 0x1F, 0x2B, 0x98, 0xF3, 0x99, 0x0F, 0x48, 0x5C, 0xAC, 0x87, 0x58, 0xFB, 0x1B,
+    0xE8, 0x4B, 0x81, 0xBF, 0x6C, 0x60, 0xB6, 0xC1, 0x7B, 0x20, 0xF1, 0x68, 0xBE, 0xB1, 0x31, 0x48,
+    0xE7, 0x86, 0x7A, 0xB0, 0x1F, 0xFF, 0xFF, 0x67, 0x87, 0x69, 0x01, 0x71, 0x58, 0xA1, 0x5A, 0xE0,
+    0xE0, 0x0D, 0x12, 0x9B, 0x41, 0x00, 0xCE, 0x02, 0x00, 0xE0, 0x7E, 0x43, 0x74, 0x78, 0x9C, 0x63,
+    0x60, 0x80, 0x80, 0x02, 0x76, 0x06, 0x04, 0xF8, 0xA8, 0x0F, 0x22, 0x8F, 0xBD, 0xF7, 0x06, 0x51,
+    0x3F, 0x38, 0x81, 0xC4, 0x82, 0xFF, 0xFF, 0xFF, 0xB3, 0x31, 0x30, 0x08, 0xFC, 0x67, 0x02, 0x72,
+    0x12, 0x3C, 0x9D, 0xFF, 0x72, 0x33, 0x30, 0x34, 0xCC, 0x87, 0xA8, 0x56, 0xF8, 0x03, 0xD4, 0xFB,
+    0x51, 0x1E, 0xCC, 0x0E, 0xF8, 0xDF, 0x07, 0x24, 0x7F, 0x72, 0x42, 0xCC, 0xFC, 0x3F, 0x0F, 0xA4,
+    0x85, 0x11, 0xCC, 0x11, 0x08, 0xFE, 0xCB, 0xC5, 0x30, 0x61, 0x3E, 0xCC, 0x8A, 0xAF, 0xFC, 0x0C,
+    0x9F, 0xE4, 0x19, 0x26, 0x88, 0x43, 0x38, 0xF2, 0x0C, 0x3F, 0x39, 0x18, 0x3E, 0x01, 0x6D, 0x3D,
+    0xA8, 0x69, 0xF0, 0x97, 0x4F, 0x01, 0xA8, 0xE5, 0x17, 0x17, 0x03, 0xC3, 0x23, 0xA0, 0xA5, 0xAC,
+    0x0B, 0xFA, 0x81, 0x46, 0x30, 0x03, 0x6D, 0xF9, 0xFD, 0x3F, 0x16, 0xA4, 0xA5, 0x61, 0x3F, 0x58,
+    0x8B, 0x10, 0x03, 0xC3, 0x2F, 0x0E, 0x86, 0x0F, 0xFE, 0x0B, 0xF2, 0x21, 0x6E, 0x00, 0x6A, 0xF9,
+    0xCE, 0xB3, 0x01, 0xC2, 0x59, 0x50, 0xCF, 0xC0, 0xF0, 0x8F, 0xF5, 0x00, 0x84, 0xF3, 0x99, 0x8F,
+    0xC1, 0x01, 0x68, 0xCE, 0x7F, 0x7E, 0x10, 0xE7, 0x37, 0x3B, 0x82, 0x63, 0xF0, 0x1E, 0x48, 0x18,
+    0x1B, 0x5F, 0xEE, 0x07, 0x79, 0x69, 0x43, 0x3D, 0x58, 0xF1, 0x85, 0x7C, 0xA8, 0x16, 0x04, 0xE7,
+    0x37, 0x72, 0xC0, 0xBC, 0x41, 0x62, 0x33, 0x08, 0xC0, 0x59, 0x00, 0x74, 0x6E, 0x4A, 0x72, 0x78,
+    0x9C, 0x63, 0x60, 0x10, 0xF8, 0xCD, 0xC9, 0x00, 0x04, 0x0D, 0xFF, 0xFD, 0x21, 0x54, 0x3C, 0x88,
+    0x82, 0x0A, 0x62, 0x07, 0x3B, 0x21, 0x72, 0x7F, 0x79, 0xC0, 0xD4, 0x7F, 0x6E, 0x10, 0xB9, 0xE0,
+    0x3F, 0x3B, 0x88, 0xFA, 0xF5, 0x1E, 0x44, 0x5E, 0xFE, 0xAF, 0x0B, 0x24, 0x0D, 0xFE, 0xCF, 0x07,
+    0x71, 0x0E, 0xFC, 0x67, 0x05, 0x51, 0x1F, 0xCE, 0x83, 0x55, 0x7F, 0xDC, 0x0F, 0x24, 0x98, 0x18,
+    0x1E, 0xFC, 0x67, 0x64, 0x70, 0xD8, 0xCF, 0xD8, 0xF0, 0x3F, 0x37, 0xE4, 0xD7, 0x7B, 0x26, 0x86,
+    0xDF, 0xFF, 0xFF, 0xFF, 0xD7, 0x61, 0x60, 0x08, 0x78, 0xFD, 0x3E, 0x9A, 0x81, 0x01, 0x00, 0x84,
+    0xE6, 0x22, 0xEF, 0x78, 0x9C, 0x63, 0x60, 0x30, 0x60, 0x62, 0x80, 0x80, 0x0B, 0xEB, 0x19, 0x21,
+    0x8C, 0xCF, 0xFF, 0xFB, 0xA1, 0xAC, 0x6D, 0xFF, 0xFD, 0xA1, 0x92, 0x85, 0xBA, 0x0C, 0x38, 0xC0,
+    0x8F, 0xFF, 0x2C, 0x10, 0xC6, 0xDF, 0xFF, 0x9C, 0x60, 0x5A, 0xE1, 0xFF, 0x5F, 0x3E, 0x30, 0xA3,
+    0xE1, 0xFF, 0x57, 0x7B, 0xA8, 0xC9, 0x1F, 0xE6, 0x83, 0x19, 0x9F, 0xE2, 0x37, 0xBC, 0x07, 0x33,
+    0xBE, 0xCB, 0x27, 0xFC, 0x67, 0x06, 0x31, 0xFE, 0x70, 0x2B, 0xFC, 0xE7, 0x00, 0xD2, 0x02, 0xFF,
+    0xD9, 0x18, 0xFE, 0xF2, 0x02, 0x19, 0x05, 0xFF, 0x99, 0x18, 0x7E, 0xE8, 0x03, 0x19, 0x07, 0xEE,
+    0x03, 0x5D, 0x52, 0x0F, 0x64, 0x7C, 0xEC, 0x67, 0x60, 0x78, 0x00, 0xE4, 0x30, 0x7C, 0xAB, 0x77,
+    0x71, 0x39, 0x02, 0x94, 0x66, 0xF8, 0xFD, 0x1F, 0x04, 0xD8, 0x81, 0x9A, 0xC0, 0x80, 0x87, 0x21,
+    0xE1, 0x3F, 0x2B, 0x50, 0xFE, 0xB7, 0x3C, 0xC3, 0x86, 0xFF, 0x60, 0xD3, 0xF3, 0x19, 0x3E, 0xEC,
+    0x07, 0xDB, 0xB7, 0x9F, 0xE1, 0x6B, 0x3E, 0xD8, 0x05, 0xFF, 0x19, 0x7F, 0xC9, 0x43, 0xDC, 0xC4,
+    0x06, 0x00, 0x9D, 0xAA, 0x43, 0xF9, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x02, 0x56, 0x06, 0x08, 0x78,
+    0xE6, 0x0F, 0xA1, 0xAF, 0xFE, 0x9F, 0x0F, 0xA6, 0x0F, 0xFC, 0xEF, 0x63, 0x02, 0x33, 0x26, 0x78,
+    0x31, 0xE0, 0x04, 0x3F, 0xFE, 0xB3, 0x40, 0x18, 0x7F, 0xFF, 0x73, 0x82, 0x69, 0x85, 0xFF, 0x7F,
+    0xF9, 0xC0, 0x8C, 0x86, 0xFF, 0x5F, 0xED, 0xC1, 0x8C, 0x0B, 0xEB, 0x3F, 0x40, 0x0C, 0xFC, 0x14,
+    0xBF, 0xE1, 0x3D, 0x98, 0xF1, 0x5D, 0x3E, 0xE1, 0x3F, 0x33, 0x88, 0xF1, 0x87, 0x5B, 0xE1, 0x3F,
+    0x07, 0x90, 0x16, 0xF8, 0xCF, 0xC6, 0xF0, 0x97, 0x17, 0xC8, 0x28, 0xF8, 0xCF, 0xC4, 0xF0, 0x43,
+    0x1F, 0x64, 0xF9, 0x7D, 0x06, 0x86, 0xCF, 0xF5, 0x40, 0xC6, 0xC7, 0x7E, 0x06, 0x86, 0x07, 0x40,
+    0x0E, 0xC3, 0xB7, 0x7A, 0x17, 0x97, 0x23, 0x40, 0x69, 0x86, 0xDF, 0xFF, 0x41, 0x80, 0x1D, 0xA8,
+    0x09, 0x0C, 0x78, 0x18, 0x12, 0xFE, 0x83, 0xBC, 0xF0, 0x5B, 0x9E, 0x61, 0xC3, 0x7F, 0xB0, 0xE9,
+    0xF9, 0x0C, 0x1F, 0xF6, 0x83, 0xED, 0xDB, 0xCF, 0xF0, 0x35, 0x1F, 0xEC, 0x82, 0xFF, 0x8C, 0xBF,
+    0xE4, 0x21, 0x6E, 0x62, 0x03, 0x00, 0x8E, 0xFC, 0x43, 0xF9, 0x78, 0x9C, 0x6D, 0x8E, 0xCD, 0x11,
+    0xC1, 0x50, 0x14, 0x85, 0x4F, 0x82, 0x60, 0xFC, 0x8C, 0x85, 0x7D, 0x52, 0x01, 0x3A, 0xB0, 0x49,
+    0x1F, 0xD2, 0x41, 0x74, 0x10, 0x1D, 0x28, 0x41, 0x09, 0x49, 0x07, 0xB1, 0xB0, 0xA7, 0x03, 0x66,
+    0x8C, 0x75, 0x82, 0x09, 0x21, 0x32, 0xC7, 0x7D, 0xD7, 0xD6, 0xD9, 0x9C, 0xEF, 0xFE, 0xBD, 0x77,
+    0x00, 0x9C, 0xF7, 0x16, 0x8C, 0x02, 0x72, 0xA2, 0x50, 0xA6, 0x17, 0x36, 0xC5, 0x67, 0x99, 0x83,
+    0xD7, 0xD0, 0x74, 0xC6, 0x52, 0xD8, 0xF8, 0xAF, 0x52, 0x77, 0x45, 0x35, 0xBB, 0xEA, 0x1E, 0x6B,
+    0x3D, 0xC2, 0x8A, 0xC5, 0x5C, 0xE1, 0x10, 0xE7, 0x1B, 0x85, 0xDB, 0x22, 0xC9, 0x14, 0x9E, 0x6E,
+    0xC0, 0x86, 0x81, 0x4F, 0xCF, 0x63, 0x47, 0x7C, 0x44, 0x07, 0xF5, 0x40, 0x60, 0x49, 0x1B, 0xE5,
+    0x54, 0x60, 0x7B, 0x04, 0xEE, 0x91, 0xC0, 0x75, 0x0D, 0x9C, 0xA4, 0xC0, 0x23, 0xF2, 0xFD, 0x9D,
+    0x8C, 0x51, 0xD1, 0xA8, 0x2D, 0x47, 0xAA, 0xBE, 0x44, 0x6F, 0xC9, 0xBC, 0x72, 0x91, 0x50, 0x5F,
+    0x0F, 0x91, 0xA7, 0xFA, 0x5F, 0x8A, 0x22, 0xD4, 0x04, 0xB4, 0xDE, 0xEE, 0x2F, 0x93, 0xF3, 0x05,
+    0xC7, 0x0E, 0x47, 0x73, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x10, 0x62, 0x80, 0x80, 0x4B, 0xFF, 0xBD,
+    0x9F, 0xCA, 0x00, 0x69, 0x81, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0x02, 0x32, 0x0C, 0x66, 0x1B, 0xBE,
+    0x9C, 0xC7, 0x40, 0x08, 0xFC, 0xF8, 0xCF, 0x02, 0x61, 0xFC, 0xFD, 0xCF, 0x09, 0xA6, 0x15, 0xFE,
+    0xFF, 0xE5, 0x03, 0x33, 0x1A, 0xFE, 0x7F, 0xB5, 0x07, 0x33, 0x2E, 0xAC, 0xFF, 0x30, 0x1F, 0xCC,
+    0xF8, 0x14, 0xBF, 0xE1, 0x3D, 0x98, 0xF1, 0x5D, 0x3E, 0xE1, 0x3F, 0x33, 0x88, 0xF1, 0x87, 0x5B,
+    0xE1, 0x3F, 0x07, 0xC8, 0xD2, 0xFF, 0x6C, 0x0C, 0x7F, 0x79, 0x81, 0x8C, 0x82, 0xFF, 0x4C, 0x0C,
+    0x3F, 0xF4, 0x81, 0x8C, 0x03, 0xF7, 0x19, 0x18, 0x3E, 0xD7, 0x03, 0x19, 0x1F, 0xFB, 0x19, 0x18,
+    0x1E, 0x00, 0x39, 0x0C, 0xDF, 0xEA, 0x5D, 0x5C, 0x8E, 0x00, 0xA5, 0x19, 0x7E, 0xFF, 0x07, 0x01,
+    0x76, 0xA0, 0x26, 0x30, 0xE0, 0x61, 0x48, 0xF8, 0xCF, 0x0A, 0x94, 0xFF, 0x2D, 0xCF, 0xB0, 0xE1,
+    0x3F, 0xD8, 0xF4, 0x7C, 0x86, 0x0F, 0xFB, 0xC1, 0xF6, 0xED, 0x67, 0xF8, 0x9A, 0x0F, 0x76, 0xC1,
+    0x7F, 0xC6, 0x5F, 0xF2, 0x10, 0x37, 0xB1, 0x01, 0x00, 0x3A, 0x08, 0x46, 0xEA, 0x78, 0x9C, 0x63,
+    0x10, 0xF8, 0xC3, 0xCE, 0xF0, 0x9B, 0x93, 0x81, 0x81, 0x21, 0xE0, 0x3F, 0x9F, 0xC1, 0x7F, 0x7E,
+    0x20, 0x03, 0x2E, 0x82, 0x17, 0xFC, 0xF8, 0xCF, 0x02, 0x61, 0xFC, 0xFD, 0x0F, 0x51, 0xAB, 0xF0,
+    0xFF, 0x2F, 0x1F, 0x98, 0xD1, 0xF0, 0xFF, 0xAB, 0x3D, 0x98, 0x71, 0x61, 0xFD, 0x87, 0xF9, 0x60,
+    0xC6, 0xA7, 0xF8, 0x0D, 0xEF, 0xC1, 0x8C, 0xEF, 0xF2, 0x09, 0xFF, 0x99, 0x41, 0x8C, 0x3F, 0xDC,
+    0x0A, 0xFF, 0x39, 0x40, 0x76, 0xFD, 0x67, 0x63, 0xF8, 0xCB, 0x0B, 0x64, 0x14, 0xFC, 0x67, 0x62,
+    0xF8, 0xA1, 0x0F, 0x64, 0x1C, 0xB8, 0xCF, 0xC0, 0xF0, 0xB9, 0x1E, 0xC8, 0xF8, 0xD8, 0xCF, 0xC0,
+    0xF0, 0x00, 0xC8, 0x61, 0xF8, 0x56, 0xEF, 0xE2, 0x72, 0x04, 0x28, 0xCD, 0xF0, 0xFB, 0x3F, 0x08,
+    0xB0, 0x03, 0x35, 0x81, 0x01, 0x0F, 0x43, 0xC2, 0x7F, 0x56, 0xA0, 0xFC, 0x6F, 0x79, 0x86, 0x0D,
+    0xFF, 0xC1, 0xA6, 0xE7, 0x33, 0x7C, 0xD8, 0x0F, 0xB6, 0x6F, 0x3F, 0xC3, 0xD7, 0x7C, 0xB0, 0x0B,
+    0xFE, 0x33, 0xFE, 0x92, 0x87, 0xB8, 0x89, 0x0D, 0x00, 0x9C, 0xF8, 0x43, 0xEC, 0x78, 0x9C, 0x63,
+    0x60, 0x60, 0xB8, 0x76, 0x9E, 0x85, 0x01, 0x04, 0x0A, 0xFA, 0x37, 0xDB, 0x83, 0x19, 0x17, 0xF8,
+    0x14, 0xE6, 0xA3, 0x32, 0x1A, 0xE2, 0x27, 0xF8, 0x83, 0x19, 0x0C, 0x3F, 0xFF, 0xB3, 0x43, 0x18,
+    0x0C, 0x4C, 0x0C, 0xB8, 0xC0, 0x8F, 0xFF, 0x10, 0x03, 0x19, 0xFE, 0xFE, 0xE7, 0x04, 0xD3, 0x0A,
+    0xFF, 0xFF, 0xF2, 0x41, 0xCC, 0xF9, 0xFF, 0x15, 0x6A, 0xC5, 0xFA, 0x0F, 0x10, 0x93, 0x3F, 0xC5,
+    0x6F, 0x78, 0x0F, 0x66, 0x7C, 0x97, 0x4F, 0xF8, 0xCF, 0x0C, 0x62, 0xFC, 0xE1, 0x56, 0xF8, 0xCF,
+    0x01, 0xA4, 0x05, 0xFE, 0xB3, 0x31, 0xFC, 0xE5, 0x05, 0xB9, 0xEB, 0x3F, 0x13, 0xC3, 0x0F, 0x7D,
+    0x20, 0xE3, 0xC0, 0x7D, 0x06, 0x86, 0xCF, 0xF5, 0x40, 0xC6, 0xC7, 0x7E, 0x06, 0x86, 0x07, 0x40,
+    0x0E, 0xC3, 0xB7, 0x7A, 0x17, 0x97, 0x23, 0x40, 0x69, 0x86, 0xDF, 0xFF, 0x41, 0x80, 0x1D, 0xA8,
+    0x09, 0x0C, 0x78, 0x18, 0x12, 0xFE, 0xB3, 0x02, 0xE5, 0x7F, 0xCB, 0x33, 0x6C, 0xF8, 0x0F, 0x36,
+    0x3D, 0x9F, 0xE1, 0xC3, 0x7E, 0xB0, 0x7D, 0xFB, 0x19, 0xBE, 0xE6, 0x83, 0x5D, 0xF0, 0x9F, 0xF1,
+    0x97, 0x3C, 0xC4, 0x4D, 0x6C, 0x00, 0x6E, 0x53, 0x47, 0xB6, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60,
+    0xF8, 0xF9, 0x1F, 0x0C, 0x18, 0x40, 0xE0, 0x1F, 0x98, 0x79, 0x1F, 0xC4, 0x0C, 0xF8, 0xFF, 0xC7,
+    0xD6, 0xD8, 0xD8, 0x58, 0x19, 0xC4, 0x3E, 0xB0, 0xFF, 0x3B, 0x3F, 0x03, 0x14, 0x7C, 0x8A, 0xFF,
+    0xEC, 0x0F, 0x63, 0xFF, 0xE0, 0xFB, 0xD0, 0x0F, 0x63, 0xFF, 0xE3, 0x3C, 0x70, 0x1E, 0xCA, 0x0C,
+    0xF8, 0xCF, 0xDC, 0xF0, 0x1F, 0xCA, 0x3E, 0x70, 0x1F, 0xC8, 0x35, 0x85, 0x98, 0xF3, 0xA9, 0x9E,
+    0x41, 0x00, 0x64, 0x3E, 0x48, 0xDD, 0x0F, 0x79, 0x06, 0x86, 0xBF, 0x50, 0xF6, 0x3F, 0x6E, 0x06,
+    0x86, 0x5F, 0xFC, 0x50, 0xAD, 0xE6, 0xC6, 0xC6, 0x3F, 0x20, 0x16, 0x1C, 0x00, 0x3B, 0x06, 0x62,
+    0xC1, 0xA7, 0xFF, 0x30, 0x8D, 0x40, 0xAD, 0xFA, 0x40, 0x62, 0x03, 0xD4, 0xC1, 0x3C, 0x40, 0xA2,
+    0xE0, 0x3F, 0x0B, 0x58, 0x2B, 0x1B, 0x90, 0x34, 0xF8, 0x6F, 0x69, 0x6C, 0xCC, 0xBC, 0xE1, 0x3F,
+    0x23, 0x48, 0x16, 0xA4, 0xC7, 0xFE, 0xD3, 0x7A, 0xB0, 0xCA, 0x3F, 0x20, 0x36, 0x00, 0x39, 0x7B,
+    0x54, 0x74, 0x78, 0x9C, 0x63, 0x60, 0x30, 0xB8, 0xF9, 0x7F, 0x1D, 0x0B, 0x03, 0x03, 0xC3, 0xCF,
+    0xFF, 0xFF, 0xFF, 0x9F, 0x67, 0x62, 0xD8, 0xF0, 0xBF, 0xCE, 0xE4, 0xD8, 0x7B, 0x46, 0x86, 0x1F,
+    0xFB, 0x81, 0x62, 0x6E, 0x0C, 0x02, 0xFF, 0x79, 0x19, 0x40, 0xA0, 0xE1, 0x3F, 0x2B, 0x98, 0xBE,
+    0xF0, 0x1F, 0x4C, 0x31, 0x7C, 0xBC, 0x0F, 0xA1, 0xBF, 0xAC, 0x87, 0xD0, 0x5F, 0xE7, 0x43, 0xE8,
+    0x6F, 0xFD, 0xA8, 0x7C, 0x98, 0xFC, 0xA7, 0xF3, 0x10, 0xFA, 0x01, 0x54, 0xFF, 0x82, 0xFF, 0x2C,
+    0x60, 0x3A, 0xE0, 0x3F, 0x0F, 0x44, 0xE0, 0x0F, 0x48, 0x43, 0x12, 0x50, 0xE1, 0x7F, 0x6F, 0x86,
+    0x66, 0xA0, 0xA4, 0xC3, 0x7F, 0x10, 0x00, 0x5A, 0xBA, 0x10, 0x48, 0x69, 0x83, 0x54, 0x38, 0xFC,
+    0x13, 0x81, 0x28, 0xFD, 0xCF, 0x04, 0xA6, 0x04, 0xFE, 0x9F, 0x67, 0x04, 0x33, 0x14, 0xFE, 0x70,
+    0x80, 0xA8, 0x04, 0xE7, 0xBF, 0x5C, 0x60, 0xAB, 0xFF, 0x43, 0xDC, 0xBA, 0xF9, 0x5F, 0x0C, 0x03,
+    0x03, 0x00, 0xE9, 0xDA, 0x3D, 0x33, 0x78, 0x9C, 0x63, 0x50, 0x60, 0x66, 0x00, 0x81, 0x0D, 0xEB,
+    0x99, 0x40, 0xD4, 0xA7, 0xFF, 0xF3, 0x19, 0x41, 0xF4, 0xD6, 0xFF, 0xF1, 0x60, 0xE1, 0x44, 0x1B,
+    0x06, 0x34, 0xF0, 0xF1, 0x3F, 0x10, 0xEC, 0x87, 0x50, 0xF3, 0x19, 0x3E, 0xEE, 0x37, 0x36, 0x36,
+    0x16, 0x06, 0x52, 0x10, 0x39, 0xBC, 0x14, 0x50, 0x25, 0x23, 0x44, 0x1F, 0x3B, 0x9C, 0x22, 0x46,
+    0x1F, 0x42, 0xBB, 0x31, 0x44, 0xDF, 0x7F, 0x18, 0x05, 0x00, 0xDA, 0x9D, 0x41, 0x70, 0x78, 0x9C,
+    0x63, 0x60, 0x60, 0x60, 0x60, 0x65, 0x00, 0x81, 0xAB, 0xF1, 0x20, 0xF2, 0xC8, 0xFF, 0xF5, 0x40,
+    0x72, 0xC3, 0xFF, 0x79, 0xCC, 0x40, 0xAA, 0xC1, 0x8B, 0x01, 0x03, 0x7C, 0xFC, 0x0F, 0x04, 0xFB,
+    0x21, 0xD4, 0x7C, 0x86, 0x8F, 0xFB, 0x8D, 0x8D, 0x8D, 0x85, 0x81, 0x14, 0x44, 0x0E, 0x2F, 0x05,
+    0x54, 0xC9, 0x08, 0xD1, 0xC7, 0x0E, 0xA7, 0x88, 0xD1, 0x87, 0xD0, 0x6E, 0x0C, 0xD1, 0xF7, 0x1F,
+    0x46, 0x01, 0x00, 0xD1, 0xA6, 0x41, 0x70, 0x78, 0x9C, 0x63, 0x60, 0x78, 0x74, 0x9E, 0x91, 0x81,
+    0x81, 0x21, 0xE0, 0xFF, 0x7F, 0x3B, 0x20, 0xF5, 0xFD, 0xFC, 0xD5, 0xFF, 0xAC, 0x0C, 0x0A, 0xFF,
+    0xD9, 0x19, 0x7E, 0xC8, 0x31, 0x30, 0xA8, 0x30, 0x30, 0x18, 0x30, 0x33, 0xA0, 0x82, 0x8F, 0xFF,
+    0x81, 0x60, 0x3F, 0x84, 0x9A, 0xCF, 0xF0, 0x71, 0xBF, 0xB1, 0xB1, 0xB1, 0x30, 0x90, 0x82, 0xC8,
+    0xE1, 0xA5, 0x80, 0x2A, 0x19, 0x21, 0xFA, 0xD8, 0xE1, 0x14, 0x31, 0xFA, 0x10, 0xDA, 0x8D, 0x21,
+    0xFA, 0xFE, 0xC3, 0x28, 0x00, 0x72, 0x4D, 0x45, 0x1B, 0x78, 0x9C, 0x63, 0xF8, 0xCD, 0xC1, 0xF0,
+    0x8B, 0x8B, 0xC1, 0xE0, 0x3F, 0xBF, 0xC0, 0x7F, 0x7D, 0x06, 0x06, 0x08, 0x0F, 0x2B, 0xF8, 0xF8,
+    0x1F, 0x08, 0xF6, 0x43, 0xA8, 0xF9, 0x0C, 0x1F, 0xF7, 0x1B, 0x1B, 0x1B, 0x0B, 0x03, 0x29, 0x88,
+    0x1C, 0x5E, 0x0A, 0xA8, 0x92, 0x11, 0xA2, 0x8F, 0x1D, 0x4E, 0x11, 0xA3, 0x0F, 0xA1, 0xDD, 0x18,
+    0xA2, 0xEF, 0x3F, 0x8C, 0x02, 0x00, 0xBC, 0x4E, 0x41, 0x35, 0x78, 0x9C, 0x73, 0x60, 0x62, 0x60,
+    0x78, 0x30, 0x9F, 0x91, 0xE1, 0xCB, 0xFF, 0x7E, 0x06, 0x81, 0x63, 0xFF, 0xED, 0x18, 0x18, 0x8A,
+    0x64, 0x18, 0x60, 0xE0, 0xE3, 0x7E, 0xAA, 0x62, 0x00, 0xFE, 0xFB, 0x28, 0xA6, 0x78, 0x9C, 0x63,
+    0x60, 0x60, 0x60, 0x65, 0x60, 0x78, 0x66, 0xCF, 0xF0, 0xF4, 0x7F, 0xFF, 0x85, 0xFF, 0xBD, 0x4C,
+    0x0B, 0x2C, 0x19, 0x10, 0xE0, 0xE3, 0x7E, 0xAA, 0x62, 0x00, 0xEF, 0x75, 0x28, 0x95, 0x78, 0x9C,
+    0x63, 0x70, 0xF8, 0xC7, 0xCD, 0xC0, 0xC0, 0xF0, 0xFD, 0xFF, 0x7D, 0x26, 0x86, 0x09, 0xFF, 0xB3,
+    0xFE, 0xF9, 0x31, 0x7C, 0x89, 0x63, 0x58, 0x78, 0x9F, 0x21, 0x80, 0x91, 0x81, 0x41, 0x85, 0x01,
+    0x05, 0x08, 0xFC, 0xE7, 0x1E, 0x08, 0x12, 0x00, 0x78, 0x1F, 0x20, 0xB5, 0x78, 0x9C, 0x3B, 0x98,
+    0xCF, 0x70, 0xA0, 0x9F, 0xE1, 0xDB, 0x7D, 0x86, 0x2F, 0xFF, 0x19, 0x2E, 0x82, 0xD9, 0x58, 0x80,
+    0xC0, 0x7F, 0xEE, 0x81, 0x20, 0x01, 0x5C, 0xF5, 0x1E, 0xDF, 0x78, 0x9C, 0x63, 0xD8, 0xF0, 0xFF,
+    0xFF, 0xBD, 0x6A, 0x46, 0x06, 0x06, 0x06, 0x20, 0xE3, 0xFF, 0xFF, 0xF5, 0x8C, 0x20, 0x86, 0xB1,
+    0xF3, 0x8D, 0xFF, 0x76, 0x20, 0x06, 0x50, 0xF8, 0xFB, 0x7B, 0x46, 0x08, 0x63, 0xC1, 0x7F, 0x0E,
+    0x08, 0x43, 0xE0, 0x3F, 0x1F, 0x84, 0xC1, 0xF0, 0x47, 0x1F, 0xCA, 0xF8, 0x19, 0x6F, 0x78, 0xF8,
+    0xBF, 0xB1, 0x31, 0x23, 0xC3, 0xF7, 0xFC, 0x6F, 0x20, 0x63, 0xB8, 0x18, 0xBE, 0xF5, 0x43, 0x19,
+    0xDF, 0xEB, 0xA1, 0x6A, 0xBE, 0xE7, 0xC3, 0x15, 0x43, 0x19, 0x7F, 0xE5, 0x21, 0x0C, 0x85, 0xFF,
+    0xBC, 0x10, 0xC6, 0x86, 0xFF, 0x6C, 0x10, 0xC6, 0xAF, 0xF3, 0x10, 0x67, 0xBC, 0xF8, 0x2F, 0x0B,
+    0x75, 0xD8, 0x7C, 0x88, 0x0B, 0xDF, 0x83, 0x9C, 0x0A, 0x00, 0xC7, 0x4E, 0x4E, 0x16, 0x78, 0x9C,
+    0x63, 0x60, 0x60, 0x60, 0x62, 0x00, 0x83, 0xC7, 0xFF, 0xBD, 0x9E, 0x72, 0x33, 0x30, 0x08, 0xFC,
+    0xFB, 0xFF, 0xFF, 0x3F, 0x07, 0x03, 0x83, 0x41, 0x8F, 0xE1, 0xAB, 0x3E, 0x06, 0x9C, 0xE0, 0xE3,
+    0x7F, 0x1E, 0x20, 0xF9, 0x93, 0xFF, 0xE3, 0x7F, 0x7F, 0x28, 0xBD, 0x1F, 0x42, 0xDF, 0xFF, 0xCF,
+    0x0C, 0xA6, 0xEB, 0xFF, 0x73, 0x83, 0xE9, 0xF8, 0xDF, 0xF6, 0x60, 0x3A, 0xFF, 0xCB, 0x7A, 0x08,
+    0x7D, 0xE0, 0x3F, 0x13, 0x58, 0xDE, 0xE1, 0x3F, 0x17, 0x98, 0x66, 0xF8, 0xA3, 0x0F, 0xA2, 0xFB,
+    0x19, 0xBE, 0xCE, 0x87, 0xD0, 0x17, 0xFE, 0x33, 0x82, 0xE9, 0x80, 0xFF, 0x9C, 0x3F, 0x40, 0x34,
+    0xC3, 0x5F, 0x79, 0x08, 0xFD, 0xB5, 0xFF, 0x3B, 0x98, 0xBE, 0xF0, 0x1F, 0x42, 0x27, 0xFC, 0xFF,
+    0x03, 0xA6, 0x19, 0xFE, 0xFD, 0x87, 0xD0, 0xDF, 0xA0, 0xF4, 0x83, 0xFF, 0xFC, 0x00, 0xE6, 0x1A,
+    0x54, 0xDC, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x10, 0x65, 0x80, 0x00, 0x85, 0xFF, 0xEC, 0x10, 0x46,
+    0xC1, 0xFF, 0xF7, 0x6C, 0x10, 0x56, 0xE1, 0xDF, 0xFB, 0x8C, 0x10, 0x96, 0xC1, 0x4E, 0x06, 0xEC,
+    0xC0, 0xE0, 0xE6, 0xFF, 0x75, 0xAC, 0x40, 0x5A, 0xE0, 0xD7, 0xFF, 0xFF, 0xFF, 0xCF, 0x33, 0x31,
+    0x30, 0x5C, 0xF8, 0x9F, 0x6B, 0xBC, 0xF5, 0xBF, 0x1E, 0x03, 0xC3, 0xAF, 0xF9, 0x40, 0xE1, 0xAF,
+    0xF7, 0x19, 0x0C, 0xFE, 0xF3, 0x00, 0x19, 0x0D, 0xFF, 0xD9, 0x17, 0xFC, 0x67, 0x01, 0x29, 0xFC,
+    0xCF, 0xFB, 0xE1, 0x3D, 0x58, 0xEB, 0x1F, 0xFD, 0x4F, 0xFB, 0xC1, 0x8C, 0x9F, 0xF1, 0x5F, 0xE6,
+    0x83, 0x19, 0xDF, 0xFA, 0xBF, 0xE2, 0x66, 0x7C, 0x86, 0x28, 0xFE, 0x11, 0x0F, 0xD5, 0xFE, 0x5B,
+    0x7F, 0xC3, 0x7F, 0x66, 0x88, 0x81, 0x0E, 0xFF, 0xB9, 0x21, 0x56, 0x30, 0xFC, 0x86, 0x5A, 0xCA,
+    0x70, 0x11, 0xE6, 0x0C, 0x81, 0xDF, 0x50, 0x87, 0x31, 0x38, 0xDC, 0x02, 0x3B, 0x15, 0x00, 0x50,
+    0x47, 0x49, 0x33, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x02, 0x47, 0x06, 0x08, 0x68, 0x7C, 0x0F, 0xA1,
+    0x0B, 0xFE, 0xFF, 0x67, 0x05, 0xD1, 0x0A, 0xFF, 0xCE, 0x8B, 0x43, 0x44, 0x7A, 0x98, 0x18, 0x70,
+    0x00, 0x83, 0x9B, 0xFF, 0xD7, 0x81, 0x14, 0x0B, 0xFC, 0xFA, 0xFF, 0xFF, 0xFF, 0x79, 0xA0, 0xB2,
+    0x0B, 0xFF, 0x73, 0x8D, 0xB7, 0xFE, 0xD7, 0x63, 0x60, 0xF8, 0x35, 0x1F, 0x28, 0xFC, 0xF5, 0x3E,
+    0x83, 0xC1, 0x7F, 0x1E, 0x20, 0xA3, 0xE1, 0x3F, 0xFB, 0x82, 0xFF, 0x2C, 0x20, 0x85, 0xFF, 0x79,
+    0x3F, 0x40, 0xEC, 0xF9, 0xA3, 0xFF, 0x69, 0x3F, 0x98, 0xF1, 0x33, 0xFE, 0xCB, 0x7C, 0x30, 0xE3,
+    0x5B, 0xFF, 0x57, 0xDC, 0x8C, 0xCF, 0x10, 0xC5, 0x3F, 0xE2, 0xA1, 0xDA, 0x7F, 0xEB, 0x6F, 0xF8,
+    0xCF, 0x0C, 0x31, 0xD0, 0xE1, 0x3F, 0x37, 0xC4, 0x0A, 0x86, 0xDF, 0x50, 0x4B, 0x19, 0x2E, 0xC2,
+    0x9C, 0x21, 0xF0, 0x1B, 0xEA, 0x30, 0x06, 0x87, 0x5B, 0x60, 0xA7, 0x02, 0x00, 0x41, 0x3F, 0x49,
+    0x13, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x48, 0xF8, 0xCF, 0xC1, 0x00, 0x06, 0x3F, 0xFF, 0xEF, 0x07,
+    0xD3, 0x07, 0xFF, 0x57, 0xFC, 0xD7, 0x05, 0x31, 0xBE, 0xDB, 0x32, 0x1C, 0x5A, 0x0F, 0x62, 0x04,
+    0x00, 0x31, 0x2B, 0x03, 0x56, 0x60, 0x70, 0xF3, 0xFF, 0x3A, 0x90, 0x94, 0xC0, 0xAF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x67, 0x62, 0x60, 0xB8, 0xF0, 0x3F, 0xD7, 0x78, 0xEB, 0x7F, 0x3D, 0x06, 0x86, 0x5F,
+    0xF3, 0x81, 0xC2, 0x5F, 0xEF, 0x33, 0x18, 0xFC, 0xE7, 0x01, 0x32, 0x1A, 0xFE, 0xB3, 0x2F, 0xF8,
+    0xCF, 0x02, 0x52, 0xF8, 0x9F, 0xF7, 0xC3, 0x7B, 0xB0, 0xD6, 0x3F, 0xFA, 0x9F, 0x20, 0x16, 0xFE,
+    0x8C, 0xFF, 0x32, 0x1F, 0xCC, 0xF8, 0xD6, 0xFF, 0x15, 0x37, 0xE3, 0x33, 0x44, 0xF1, 0x8F, 0x78,
+    0xA8, 0xF6, 0xDF, 0xFA, 0x1B, 0xFE, 0x33, 0x43, 0x0C, 0x74, 0xF8, 0xCF, 0x0D, 0xB1, 0x82, 0xE1,
+    0x37, 0xD4, 0x52, 0x86, 0x8B, 0x30, 0x67, 0x08, 0xFC, 0x86, 0x3A, 0x8C, 0xC1, 0xE1, 0x16, 0xD8,
+    0xA9, 0x00, 0xA4, 0x4F, 0x4C, 0xD9, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x50, 0x60, 0x80, 0x80, 0x80,
+    0xFF, 0xF3, 0x8B, 0xE7, 0x83, 0x18, 0x5F, 0xFE, 0xFF, 0xFF, 0x1F, 0x0F, 0x62, 0x1C, 0x65, 0xDD,
+    0x7A, 0x9F, 0x95, 0x01, 0x3F, 0x30, 0xB8, 0xF9, 0x7F, 0x1D, 0x48, 0x8D, 0xC0, 0x2F, 0xA0, 0xAE,
+    0xF3, 0x4C, 0x0C, 0x0C, 0x17, 0xFE, 0xE7, 0x1A, 0x6F, 0xFD, 0xAF, 0xC7, 0xC0, 0xF0, 0x0B, 0x64,
+    0xD8, 0xD7, 0xFB, 0x0C, 0x06, 0xFF, 0x79, 0x80, 0x8C, 0x86, 0xFF, 0xEC, 0x0B, 0xFE, 0xB3, 0x80,
+    0x14, 0xFE, 0xE7, 0xFD, 0xF0, 0x1E, 0xAC, 0xF5, 0x8F, 0xFE, 0xA7, 0xFD, 0x60, 0xC6, 0xCF, 0xF8,
+    0x2F, 0x60, 0x8B, 0x19, 0xBE, 0xF5, 0x7F, 0xC5, 0xCD, 0xF8, 0x0C, 0x51, 0xFC, 0x23, 0x1E, 0xAA,
+    0xFD, 0xB7, 0xFE, 0x86, 0xFF, 0xCC, 0x10, 0x03, 0x1D, 0xFE, 0x73, 0x43, 0xAC, 0x60, 0xF8, 0x0D,
+    0xB5, 0x94, 0xE1, 0x22, 0xCC, 0x19, 0x02, 0xBF, 0xA1, 0x0E, 0x63, 0x70, 0xB8, 0x05, 0x76, 0x2A,
+    0x00, 0x05, 0xCC, 0x4C, 0x30, 0x78, 0x9C, 0x63, 0x60, 0x78, 0x6C, 0xC7, 0x70, 0x29, 0x8E, 0x01,
+    0x08, 0x7E, 0xAE, 0x67, 0xF8, 0x7E, 0x1E, 0xC4, 0x80, 0x8B, 0xE0, 0x01, 0x06, 0x37, 0xFF, 0xAF,
+    0x63, 0x05, 0xD2, 0x02, 0xBF, 0xFE, 0xFF, 0xFF, 0x7F, 0x9E, 0x89, 0x81, 0xE1, 0xC2, 0xFF, 0x5C,
+    0xE3, 0xAD, 0xFF, 0xF5, 0x18, 0x18, 0x7E, 0xCD, 0x07, 0x0A, 0x7F, 0xBD, 0xCF, 0x60, 0xF0, 0x9F,
+    0x07, 0xC8, 0x68, 0xF8, 0xCF, 0xBE, 0xE0, 0x3F, 0x0B, 0x48, 0xE1, 0x7F, 0xDE, 0x0F, 0xEF, 0xC1,
+    0x5A, 0xFF, 0xE8, 0x7F, 0xDA, 0x0F, 0x66, 0xFC, 0x8C, 0xFF, 0x32, 0x1F, 0xCC, 0xF8, 0xD6, 0xFF,
+    0x15, 0x37, 0xE3, 0x33, 0x44, 0xF1, 0x8F, 0x78, 0xA8, 0xF6, 0xDF, 0xFA, 0x1B, 0xFE, 0x33, 0x43,
+    0x0C, 0x74, 0xF8, 0xCF, 0x0D, 0xB1, 0x82, 0xE1, 0x37, 0xD4, 0x52, 0x86, 0x8B, 0x30, 0x67, 0x08,
+    0xFC, 0x86, 0x3A, 0x8C, 0xC1, 0xE1, 0x16, 0xD8, 0xA9, 0x00, 0x77, 0xA3, 0x4A, 0x6D, 0x78, 0x9C,
+    0x63, 0x60, 0x00, 0x81, 0x8B, 0x6C, 0x0C, 0x0C, 0x3D, 0x0C, 0xBF, 0xE2, 0x19, 0x0E, 0xFC, 0x67,
+    0xBE, 0xF8, 0x9F, 0xF5, 0x4F, 0x3D, 0x83, 0xC0, 0xDF, 0xF3, 0xFF, 0xD9, 0x19, 0x18, 0x1E, 0xFE,
+    0xAF, 0x07, 0x4A, 0x1F, 0x00, 0x93, 0x7F, 0xEE, 0x03, 0x45, 0x0E, 0xFC, 0x67, 0xFF, 0x93, 0xCF,
+    0xF0, 0xAB, 0x1E, 0xA4, 0xF2, 0x11, 0x50, 0xC1, 0x1C, 0x06, 0x08, 0x00, 0x00, 0xC5, 0x40, 0x1A,
+    0x20, 0x78, 0x9C, 0x2D, 0x8F, 0xCB, 0x0D, 0x82, 0x00, 0x10, 0x44, 0x47, 0xF1, 0x17, 0x54, 0xC2,
+    0xC5, 0x36, 0xC4, 0x84, 0x02, 0xB4, 0x03, 0xE9, 0x40, 0x1B, 0x30, 0xB1, 0x03, 0xEC, 0x00, 0x3B,
+    0xD0, 0x0A, 0x84, 0x8B, 0x67, 0xEC, 0x80, 0xB3, 0x27, 0x62, 0x05, 0x20, 0x0A, 0x7E, 0x40, 0xC7,
+    0x45, 0xD8, 0xCB, 0xBE, 0xCC, 0xCE, 0x6E, 0x66, 0x81, 0xB2, 0x46, 0xA8, 0x6A, 0xC2, 0x56, 0x05,
+    0x6B, 0xD6, 0xCA, 0xC9, 0xFD, 0xEB, 0x67, 0x7E, 0x16, 0xD2, 0xF5, 0x37, 0xC9, 0xB0, 0x29, 0x32,
+    0x57, 0x66, 0xCE, 0x29, 0xF0, 0xDE, 0x01, 0xC5, 0x33, 0x94, 0xCD, 0x01, 0xF4, 0x60, 0xCB, 0xEE,
+    0x5E, 0x4E, 0x2C, 0x6D, 0x9D, 0x5A, 0x1C, 0x01, 0x9E, 0x81, 0xDC, 0x48, 0x7C, 0xE0, 0x3A, 0xC4,
+    0x73, 0x71, 0x17, 0x6F, 0xD6, 0x43, 0x66, 0xA7, 0x02, 0xB9, 0x82, 0xCC, 0x29, 0x41, 0x6C, 0x02,
+    0x2E, 0xAC, 0x72, 0xEA, 0xDC, 0x7C, 0xEC, 0xE7, 0x10, 0xB3, 0xAC, 0xC7, 0x9A, 0xD8, 0x0C, 0x8F,
+    0xCA, 0x5D, 0x85, 0xCE, 0xA1, 0xC5, 0xFE, 0xAB, 0x8D, 0x0D, 0xBB, 0x28, 0x9C, 0x2F, 0x90, 0x86,
+    0xC0, 0x85, 0xA1, 0x79, 0xE4, 0x58, 0x82, 0x15, 0x12, 0x2C, 0x90, 0x60, 0x48, 0x22, 0x1E, 0xDA,
+    0x65, 0xE6, 0x87, 0x56, 0xBF, 0x50, 0xA8, 0x35, 0xB0, 0x53, 0xC3, 0xAC, 0xF1, 0x6F, 0x3F, 0x7D,
+    0xDF, 0x59, 0x89, 0x78, 0x9C, 0x63, 0x60, 0x70, 0x64, 0x80, 0x80, 0x1F, 0x36, 0x10, 0xFA, 0xEF,
+    0x7F, 0x6D, 0x30, 0xED, 0xF0, 0xEB, 0x3F, 0x07, 0x44, 0x64, 0x2B, 0x1B, 0x03, 0x06, 0xF8, 0x96,
+    0x0F, 0x24, 0x04, 0xFE, 0x73, 0xD3, 0x9A, 0xFE, 0x0A, 0xA2, 0x15, 0xFE, 0x73, 0x7D, 0xE9, 0x07,
+    0xD2, 0x06, 0xFF, 0x39, 0x3E, 0x9E, 0x07, 0xD2, 0x05, 0xFF, 0x59, 0x37, 0xFC, 0x67, 0x65, 0x60,
+    0x78, 0xF4, 0x1F, 0x28, 0x35, 0xDF, 0xA4, 0xE4, 0x5F, 0x3C, 0x03, 0xC3, 0xE3, 0xFF, 0x40, 0x00,
+    0x72, 0xE8, 0xF1, 0x7F, 0xE7, 0xC4, 0x19, 0x18, 0x00, 0x58, 0x52, 0x3E, 0x6E, 0x78, 0x9C, 0x63,
+    0x60, 0x60, 0x60, 0x08, 0x60, 0x64, 0x00, 0x01, 0x83, 0x3F, 0x1C, 0x20, 0x4A, 0xE1, 0xF7, 0x7F,
+    0x5E, 0x10, 0xFD, 0xE3, 0xBF, 0x17, 0x58, 0x78, 0x2B, 0x2B, 0x03, 0x16, 0xF0, 0x2D, 0x1F, 0x48,
+    0x08, 0xFC, 0xE7, 0xA6, 0x35, 0xFD, 0x15, 0x44, 0x2B, 0xFC, 0xE7, 0xFA, 0xD2, 0x0F, 0x72, 0xE1,
+    0x7F, 0x8E, 0x8F, 0xE7, 0x81, 0x74, 0xC1, 0x7F, 0xD6, 0x0D, 0xFF, 0x81, 0xCE, 0x7A, 0xF4, 0x1F,
+    0x28, 0x35, 0xDF, 0xA4, 0xE4, 0x5F, 0x3C, 0x03, 0xC3, 0xE3, 0xFF, 0x40, 0xC0, 0x06, 0x94, 0x3C,
+    0xFE, 0xEF, 0x9C, 0x38, 0x03, 0x03, 0x00, 0x63, 0x7E, 0x3E, 0x7D, 0x78, 0x9C, 0x63, 0x60, 0x10,
+    0xF8, 0x63, 0xC7, 0x00, 0x02, 0x8F, 0xFF, 0xFF, 0x67, 0x05, 0x52, 0x01, 0xFF, 0x63, 0xFF, 0xF4,
+    0x03, 0xE9, 0x07, 0xF3, 0x19, 0x12, 0xFE, 0x33, 0x33, 0x30, 0x28, 0x00, 0xB1, 0x23, 0x03, 0x06,
+    0xF8, 0x96, 0x0F, 0x24, 0x04, 0xFE, 0x73, 0xD3, 0x9A, 0xFE, 0x0A, 0xA2, 0x15, 0xFE, 0x73, 0x7D,
+    0x01, 0xB9, 0xC9, 0xE0, 0x3F, 0xC7, 0xC7, 0xF3, 0x40, 0xBA, 0xE0, 0x3F, 0xEB, 0x06, 0x90, 0x63,
+    0x1F, 0xFD, 0x07, 0x4A, 0xCD, 0x37, 0x29, 0xF9, 0x17, 0x0F, 0x76, 0xFE, 0xFF, 0xFF, 0x6C, 0x40,
+    0xC9, 0xE3, 0xFF, 0xCE, 0x89, 0x33, 0x30, 0x00, 0x00, 0x98, 0xE2, 0x42, 0x82, 0x78, 0x9C, 0x63,
+    0x98, 0xB0, 0x9F, 0xA1, 0xE0, 0x3C, 0x23, 0x03, 0xC3, 0x87, 0xFF, 0xCC, 0x0F, 0xFE, 0xB3, 0x32,
+    0x30, 0xC0, 0xF8, 0x38, 0xC0, 0xB7, 0x7C, 0x20, 0x21, 0xF0, 0x9F, 0x9B, 0xD6, 0xF4, 0x57, 0x10,
+    0xAD, 0xF0, 0x9F, 0xEB, 0x4B, 0x3F, 0x90, 0x36, 0xF8, 0xCF, 0xF1, 0xF1, 0x3C, 0x90, 0x2E, 0xF8,
+    0xCF, 0xBA, 0x01, 0xE4, 0xC6, 0x47, 0xFF, 0x81, 0x52, 0xF3, 0x4D, 0x4A, 0xFE, 0xC5, 0x33, 0x30,
+    0x3C, 0xFE, 0x0F, 0x04, 0x6C, 0x40, 0xC9, 0xE3, 0xFF, 0xCE, 0x89, 0x33, 0x30, 0x00, 0x00, 0x38,
+    0x4F, 0x40, 0xCA, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x50, 0x60, 0x61, 0x00, 0x01, 0x81, 0x9F,
+    0x7C, 0x60, 0xFA, 0xC7, 0x7F, 0x7F, 0x10, 0xF5, 0xF8, 0x7F, 0x0E, 0x23, 0x88, 0x3E, 0xA8, 0xC1,
+    0x80, 0x05, 0xFC, 0xAC, 0x07, 0x91, 0x9F, 0xD7, 0x7F, 0x7C, 0x0F, 0xA2, 0x7F, 0xEB, 0x37, 0xFC,
+    0x67, 0x63, 0x60, 0x30, 0xF8, 0xCF, 0x29, 0xF0, 0x1F, 0x68, 0xC8, 0x86, 0xFF, 0x8C, 0x0C, 0x3F,
+    0xF2, 0x81, 0xD2, 0xFD, 0x0C, 0x0C, 0x0F, 0x80, 0x0A, 0x7E, 0xC9, 0x33, 0x30, 0x14, 0xFC, 0x67,
+    0x53, 0xF8, 0xCF, 0x01, 0x54, 0xFB, 0x8F, 0x77, 0x01, 0x58, 0xCF, 0xB7, 0xF8, 0x4F, 0x60, 0x33,
+    0x1E, 0xDC, 0xFF, 0x05, 0xB6, 0x37, 0xE1, 0x3F, 0xC8, 0x08, 0x20, 0xF8, 0x7B, 0x1F, 0x62, 0xC5,
+    0xB7, 0x7A, 0x28, 0x9D, 0x4F, 0x06, 0x0D, 0x00, 0x2A, 0xB5, 0x32, 0x74, 0x78, 0x9C, 0xFB, 0xB8,
+    0x9F, 0x01, 0x0C, 0x3E, 0xA2, 0xD3, 0xFF, 0xFF, 0xBF, 0x9F, 0xC3, 0x0C, 0xA6, 0xFF, 0xFF, 0x5F,
+    0xCF, 0x08, 0x14, 0x37, 0x76, 0x7E, 0xF1, 0x9F, 0x07, 0x2C, 0x2F, 0xF0, 0x37, 0x1F, 0xA2, 0xEE,
+    0xCB, 0x79, 0x08, 0xFD, 0xE1, 0x3D, 0x94, 0xFE, 0x8F, 0xCA, 0xFF, 0xBC, 0x1F, 0x42, 0xFF, 0x06,
+    0xAB, 0x17, 0x38, 0xFA, 0x9F, 0x17, 0x62, 0xDE, 0x79, 0x46, 0x30, 0xBD, 0x9F, 0x15, 0x64, 0x9F,
+    0xB1, 0x10, 0x56, 0xFB, 0xA1, 0x34, 0x00, 0xEE, 0x32, 0x40, 0x21, 0x78, 0x9C, 0x63, 0x30, 0x78,
+    0xF5, 0x3E, 0x9A, 0x01, 0x08, 0xBE, 0xFF, 0xFF, 0xFF, 0x9F, 0x8B, 0x81, 0xC1, 0xE1, 0x7F, 0x5E,
+    0xF0, 0x9F, 0x7C, 0x06, 0x86, 0x0D, 0xFF, 0x99, 0x18, 0x1E, 0x9C, 0x67, 0x60, 0xF8, 0xB0, 0x1F,
+    0xC8, 0xBE, 0xCF, 0xC0, 0xF0, 0xA9, 0x9F, 0x81, 0xE1, 0x01, 0x90, 0xFD, 0xB9, 0x9E, 0x81, 0xE1,
+    0xA7, 0x3D, 0x98, 0x5E, 0xF0, 0x9F, 0x05, 0x4C, 0x7F, 0xF7, 0x67, 0x00, 0xD3, 0x7F, 0xB9, 0xA1,
+    0x34, 0x2F, 0x84, 0xFE, 0xB1, 0x1F, 0x42, 0x6F, 0xF8, 0x6F, 0x0B, 0xD5, 0xF7, 0x9F, 0x15, 0x4C,
+    0x27, 0xFC, 0xD7, 0x07, 0xD3, 0x0C, 0xDF, 0xF6, 0x43, 0xE8, 0x0B, 0xFF, 0x21, 0xF4, 0x82, 0xFF,
+    0x8C, 0x60, 0x7A, 0x03, 0x94, 0xFF, 0xF1, 0x3E, 0x88, 0x0E, 0x0E, 0xFE, 0x1B, 0x0F, 0xA2, 0x7F,
+    0xFD, 0xFF, 0xCF, 0x09, 0xA2, 0xC1, 0x0E, 0x06, 0x00, 0x0C, 0x40, 0x49, 0x59, 0x78, 0x9C, 0x63,
+    0x60, 0x60, 0x62, 0x00, 0x83, 0xBB, 0x2C, 0x20, 0x32, 0xE0, 0xFF, 0x7E, 0x30, 0x7F, 0xEB, 0xFF,
+    0xF9, 0x8C, 0x20, 0xBA, 0xE9, 0x1F, 0x44, 0xDA, 0x80, 0x01, 0x1D, 0x4C, 0x79, 0xF3, 0xBF, 0x86,
+    0x81, 0x21, 0xE1, 0x3F, 0x10, 0xC8, 0x32, 0x08, 0xCC, 0x75, 0x0B, 0xFE, 0x33, 0x1F, 0x2C, 0x7E,
+    0xE1, 0x3D, 0x98, 0x5A, 0xF0, 0x1F, 0xAC, 0x7F, 0x02, 0x90, 0x4A, 0x78, 0x0D, 0x54, 0xC3, 0xA4,
+    0xF0, 0x17, 0xA4, 0x94, 0xE9, 0xC1, 0xFF, 0x1C, 0xE3, 0xC5, 0xFF, 0x99, 0xBE, 0xED, 0x07, 0xC9,
+    0x31, 0xFD, 0xF4, 0x07, 0x53, 0xBF, 0xEC, 0x41, 0x1A, 0x98, 0x7E, 0xD4, 0x33, 0x30, 0x7C, 0xF9,
+    0xCF, 0xFC, 0xF9, 0xBF, 0xF9, 0x94, 0xFB, 0xFF, 0xB9, 0x1A, 0x40, 0x26, 0xFF, 0xB6, 0x67, 0x38,
+    0xFA, 0xBF, 0x97, 0x61, 0x21, 0x2F, 0xD4, 0x56, 0x00, 0xD3, 0x6E, 0x3C, 0xA3, 0x78, 0x9C, 0x63,
+    0x60, 0x60, 0x60, 0x60, 0x62, 0x00, 0x81, 0xC6, 0x78, 0x10, 0x99, 0xF0, 0xEF, 0x3E, 0x90, 0x74,
+    0xF8, 0xFB, 0x5E, 0x03, 0x48, 0x4D, 0x38, 0xCF, 0x0A, 0x12, 0x13, 0x80, 0x28, 0x40, 0x05, 0x53,
+    0xDE, 0xFC, 0xAF, 0x01, 0x2A, 0xFF, 0x0F, 0x04, 0xB2, 0x0C, 0x02, 0x73, 0xDD, 0x82, 0xFF, 0xCC,
+    0x07, 0x8B, 0x5F, 0x78, 0x0F, 0xA6, 0x16, 0xFC, 0x67, 0x04, 0x51, 0x13, 0x80, 0x54, 0xC2, 0x6B,
+    0xA0, 0x1A, 0x26, 0x85, 0xBF, 0x20, 0xA5, 0x4C, 0x0F, 0xFE, 0xE7, 0x18, 0x2F, 0xFE, 0xCF, 0xF4,
+    0x6D, 0x3F, 0x48, 0x8E, 0xE9, 0xA7, 0x3F, 0x98, 0xFA, 0x65, 0x0F, 0xD2, 0xC0, 0xF4, 0xA3, 0x9E,
+    0x81, 0xE1, 0xCB, 0x7F, 0xE6, 0xCF, 0xFF, 0xCD, 0xA7, 0xDC, 0xFF, 0xCF, 0xD5, 0x00, 0x32, 0xF9,
+    0xB7, 0x3D, 0xC3, 0xD1, 0xFF, 0xBD, 0x0C, 0x0B, 0x79, 0xA1, 0xB6, 0x02, 0x00, 0xCE, 0xC9, 0x3C,
+    0x93, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xF8, 0x9E, 0x89, 0x81, 0x81, 0x41, 0xE1, 0xDF, 0x7F, 0x7F,
+    0x20, 0xF5, 0xE5, 0xFD, 0xB1, 0xFF, 0xEC, 0x0C, 0x0C, 0xFF, 0x38, 0x19, 0xBE, 0xDB, 0x33, 0x30,
+    0xB8, 0x00, 0xC5, 0xD9, 0x18, 0xB0, 0x83, 0x29, 0x6F, 0xFE, 0xD7, 0x30, 0x30, 0x24, 0xFC, 0x07,
+    0x02, 0x59, 0x06, 0x81, 0xB9, 0x6E, 0xC1, 0x7F, 0xE6, 0x83, 0xC5, 0x2F, 0xBC, 0x07, 0x53, 0x0B,
+    0xFE, 0x33, 0x82, 0xA8, 0x09, 0x40, 0x2A, 0xE1, 0x35, 0x50, 0x0D, 0x93, 0xC2, 0x5F, 0x90, 0x52,
+    0xA6, 0x07, 0xFF, 0x73, 0x8C, 0x17, 0xFF, 0x67, 0xFA, 0xB6, 0x1F, 0x24, 0xC7, 0xF4, 0xD3, 0x1F,
+    0x4C, 0xFD, 0xB2, 0x07, 0x69, 0x60, 0xFA, 0x51, 0x0F, 0x74, 0xC0, 0x7F, 0xE6, 0xCF, 0xFF, 0xCD,
+    0xA7, 0xDC, 0xFF, 0xCF, 0xD5, 0x00, 0x32, 0xF9, 0xB7, 0x3D, 0xC3, 0xD1, 0xFF, 0xBD, 0x0C, 0x0B,
+    0x79, 0xA1, 0xB6, 0x02, 0x00, 0x32, 0xD9, 0x40, 0x1E, 0x78, 0x9C, 0x63, 0x60, 0x10, 0x64, 0x00,
+    0x81, 0x8D, 0xFF, 0x73, 0xB6, 0xD8, 0x32, 0x30, 0xFC, 0xFE, 0xFF, 0xFF, 0x3F, 0x2F, 0x83, 0xC0,
+    0x2E, 0xC5, 0x17, 0xFB, 0x19, 0x19, 0xB0, 0x83, 0x29, 0x6F, 0xFE, 0xD7, 0x30, 0x30, 0x24, 0x00,
+    0x15, 0xFE, 0x97, 0x65, 0x10, 0x98, 0xEB, 0x16, 0xFC, 0x67, 0x3E, 0x58, 0xFC, 0xC2, 0x7B, 0x30,
+    0xB5, 0xE0, 0x3F, 0x58, 0xE3, 0x04, 0x20, 0x95, 0xF0, 0x1A, 0xA8, 0x86, 0x49, 0xE1, 0x2F, 0x48,
+    0x29, 0xD3, 0x83, 0xFF, 0x39, 0xC6, 0x8B, 0xFF, 0x33, 0x7D, 0xDB, 0x0F, 0x92, 0x63, 0xFA, 0xE9,
+    0x0F, 0xA6, 0x7E, 0xD9, 0x83, 0x34, 0x30, 0xFD, 0xA8, 0x67, 0x60, 0xF8, 0xF2, 0x9F, 0xF9, 0xF3,
+    0x7F, 0xF3, 0x29, 0xF7, 0xFF, 0x73, 0x35, 0x80, 0x4C, 0xFE, 0x6D, 0xCF, 0x70, 0xF4, 0x7F, 0x2F,
+    0xC3, 0x42, 0x5E, 0xA8, 0xAD, 0x00, 0x6A, 0x50, 0x3F, 0x60, 0x78, 0x9C, 0x63, 0xF8, 0xC9, 0xC5,
+    0xF0, 0x83, 0x9B, 0x41, 0xE0, 0xBF, 0x3E, 0xC3, 0x7F, 0x7F, 0x06, 0x06, 0x10, 0x8F, 0x87, 0x01,
+    0x3B, 0x98, 0xF2, 0xE6, 0x7F, 0x0D, 0x03, 0x43, 0xC2, 0x7F, 0x20, 0x90, 0x65, 0x10, 0x98, 0xEB,
+    0x16, 0xFC, 0x67, 0x3E, 0x58, 0xFC, 0xC2, 0x7B, 0x30, 0xB5, 0xE0, 0x3F, 0x23, 0x88, 0x9A, 0x00,
+    0xA4, 0x12, 0x5E, 0x03, 0xD5, 0x30, 0x29, 0xFC, 0x05, 0x29, 0x65, 0x7A, 0xF0, 0x3F, 0xC7, 0x78,
+    0xF1, 0x7F, 0xA6, 0x6F, 0xFB, 0x41, 0x72, 0x4C, 0x3F, 0xFD, 0xC1, 0xD4, 0x2F, 0x7B, 0x90, 0x06,
+    0xA6, 0x1F, 0xF5, 0x0C, 0x0C, 0x5F, 0xFE, 0x33, 0x7F, 0xFE, 0x6F, 0x3E, 0xE5, 0xFE, 0x7F, 0xAE,
+    0x06, 0x90, 0xC9, 0xBF, 0xED, 0x19, 0x8E, 0xFE, 0xEF, 0x65, 0x58, 0xC8, 0x0B, 0xB5, 0x15, 0x00,
+    0x8E, 0x3B, 0x3C, 0x43, 0x78, 0x9C, 0x63, 0x60, 0x38, 0x72, 0x9F, 0x8D, 0x81, 0x81, 0xC1, 0x60,
+    0x7F, 0x73, 0x3E, 0x90, 0x9A, 0xA0, 0xCF, 0x70, 0x0F, 0x48, 0x2D, 0x90, 0x07, 0x53, 0x01, 0xFD,
+    0x01, 0xFD, 0x40, 0x8A, 0xE1, 0xFB, 0x7F, 0x4E, 0x10, 0xC5, 0xC0, 0xC4, 0x80, 0x01, 0xA6, 0xBC,
+    0xF9, 0x5F, 0xC3, 0xC0, 0x90, 0xF0, 0x1F, 0x08, 0x64, 0x19, 0x04, 0xE6, 0xBA, 0x05, 0xFF, 0x99,
+    0x0F, 0x16, 0xBF, 0xF0, 0x1E, 0x4C, 0x2D, 0xF8, 0xCF, 0x08, 0xA2, 0x26, 0x00, 0xA9, 0x84, 0xD7,
+    0x40, 0x35, 0x4C, 0x0A, 0x7F, 0x41, 0x4A, 0x99, 0x1E, 0xFC, 0xCF, 0x31, 0x5E, 0xFC, 0x9F, 0xE9,
+    0xDB, 0x7E, 0x90, 0x1C, 0xD3, 0x4F, 0x7F, 0x30, 0xF5, 0xCB, 0x1E, 0xA4, 0x81, 0xE9, 0x47, 0x3D,
+    0x03, 0xC3, 0x97, 0xFF, 0xCC, 0x9F, 0xFF, 0x9B, 0x4F, 0xB9, 0xFF, 0x9F, 0xAB, 0x01, 0x64, 0xF2,
+    0x6F, 0x7B, 0x86, 0xA3, 0xFF, 0x7B, 0x19, 0x16, 0xF2, 0x42, 0x6D, 0x05, 0x00, 0x48, 0x9B, 0x40,
+    0x2D, 0x78, 0x9C, 0x63, 0x68, 0x79, 0xF3, 0x3E, 0x87, 0x21, 0xE1, 0xCF, 0x7D, 0x09, 0x06, 0x86,
+    0x80, 0xFF, 0x40, 0xC0, 0xF5, 0xFB, 0xFF, 0xFF, 0xF7, 0x4C, 0x0C, 0x0C, 0x73, 0xDD, 0x82, 0x7F,
+    0xDF, 0xFF, 0x6F, 0x51, 0xFC, 0x9F, 0x8F, 0x01, 0x04, 0x0E, 0xFC, 0x8F, 0x67, 0x60, 0xF8, 0x5C,
+    0x0F, 0x66, 0x37, 0xFC, 0xE7, 0x65, 0x60, 0xD8, 0x70, 0x1F, 0xCC, 0x2E, 0xF8, 0xCF, 0x09, 0x22,
+    0x18, 0x19, 0x02, 0x5E, 0x03, 0x35, 0x5B, 0x18, 0x1B, 0x37, 0xFF, 0x67, 0x52, 0xF8, 0xFB, 0x1F,
+    0x06, 0x98, 0x2F, 0xFC, 0xCF, 0x35, 0x69, 0x86, 0xB2, 0xBF, 0x9D, 0x67, 0x60, 0x48, 0xF8, 0xCF,
+    0x0E, 0xD6, 0xF7, 0x13, 0x68, 0x9C, 0xC1, 0x7F, 0x2E, 0x30, 0xFB, 0x17, 0x98, 0x0D, 0xB1, 0xE7,
+    0x47, 0x3F, 0x03, 0xC3, 0xA5, 0xFF, 0xF3, 0x81, 0x2C, 0x16, 0x86, 0x4F, 0xFF, 0x2D, 0x5A, 0xFE,
+    0xBD, 0xFC, 0x1F, 0xED, 0xFC, 0xDC, 0x1F, 0x68, 0xC5, 0xFF, 0xFF, 0xF3, 0xC1, 0x06, 0xDB, 0x32,
+    0x30, 0x6C, 0xF9, 0xB7, 0x8E, 0x85, 0x21, 0xE1, 0xCD, 0xFB, 0x68, 0x06, 0x06, 0x00, 0xEF, 0xA2,
+    0x57, 0x2B, 0x78, 0x9C, 0x63, 0x60, 0xD8, 0xFA, 0x6F, 0x1F, 0x2B, 0x03, 0xC3, 0x82, 0xFF, 0xFF,
+    0xFF, 0xEF, 0x67, 0x60, 0xF8, 0x75, 0xDE, 0x74, 0x49, 0x3E, 0x83, 0xC3, 0x7F, 0x6E, 0x06, 0x06,
+    0x26, 0x86, 0x0D, 0xFF, 0x99, 0x18, 0x80, 0xE0, 0xC3, 0x7D, 0x10, 0xC9, 0xF0, 0x79, 0x3D, 0x98,
+    0xFA, 0x32, 0x1F, 0x4C, 0x7D, 0xED, 0x47, 0xE6, 0x7D, 0x3A, 0x0F, 0xA6, 0x1E, 0xFC, 0x07, 0x53,
+    0x13, 0xFE, 0x73, 0x80, 0x28, 0x81, 0xFF, 0xFD, 0x4C, 0x85, 0x7E, 0x40, 0xA5, 0x40, 0xA3, 0x81,
+    0x46, 0x18, 0xFC, 0xF9, 0xFF, 0x5F, 0x0A, 0x28, 0xAC, 0xF0, 0x4F, 0x04, 0xAC, 0x0A, 0x62, 0xB8,
+    0xC0, 0xFF, 0xF3, 0x8C, 0x20, 0xDA, 0xE0, 0x2F, 0x48, 0x8F, 0x81, 0xC0, 0x6F, 0x2E, 0x90, 0x55,
+    0xFF, 0xFF, 0xB3, 0x01, 0xA9, 0x27, 0xFF, 0xEB, 0xC1, 0x2A, 0x15, 0x81, 0x18, 0x00, 0x62, 0xA2,
+    0x30, 0xAD, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x60, 0x00, 0x83, 0xAF, 0x92, 0x60, 0xEA, 0xEF, 0x7B,
+    0x36, 0x10, 0xD5, 0xF8, 0xEF, 0x3E, 0x0B, 0x88, 0x0E, 0xF8, 0xCD, 0x05, 0x16, 0x56, 0x60, 0x64,
+    0x40, 0x07, 0xC7, 0xFE, 0xF7, 0x02, 0x05, 0x0F, 0xFC, 0xFF, 0xFF, 0xDF, 0x9E, 0x81, 0xE1, 0xF7,
+    0x7C, 0x93, 0x67, 0xEF, 0x19, 0x03, 0xFE, 0xB3, 0x33, 0x28, 0xFC, 0xE7, 0xDC, 0xF0, 0x1E, 0x28,
+    0xFD, 0x93, 0xFF, 0xC3, 0x7E, 0x90, 0xB1, 0xFA, 0x9F, 0xD7, 0x1B, 0x1B, 0x1B, 0x7F, 0xF3, 0xFF,
+    0xF2, 0x1F, 0x04, 0xE2, 0xBF, 0x42, 0xA8, 0x2F, 0xF3, 0xC1, 0x66, 0x7C, 0x3C, 0x0F, 0xA6, 0x2E,
+    0xFC, 0x07, 0x1B, 0x5F, 0xF0, 0x9F, 0x9B, 0x81, 0xC1, 0x81, 0x81, 0xE1, 0xCF, 0x79, 0xD3, 0x92,
+    0xBF, 0x6C, 0x0C, 0x07, 0x81, 0x0A, 0xDF, 0xB3, 0x32, 0x30, 0x6C, 0xFB, 0xB7, 0x8F, 0x8D, 0x01,
+    0x00, 0xAC, 0xDD, 0x3A, 0x7F, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x50, 0x60, 0x00, 0x01, 0x87,
+    0xBB, 0x20, 0x52, 0xE1, 0xD7, 0x7F, 0x36, 0x20, 0xF5, 0xE3, 0x7F, 0x34, 0x90, 0x14, 0x78, 0xAF,
+    0x01, 0x96, 0x62, 0x66, 0xC0, 0x02, 0x8E, 0xFD, 0xEF, 0x65, 0x64, 0x60, 0x38, 0xF0, 0xFF, 0xFF,
+    0x7F, 0x7B, 0x06, 0x86, 0xDF, 0xF3, 0x4D, 0x9E, 0xBD, 0x67, 0x0C, 0xF8, 0xCF, 0xCE, 0xA0, 0xF0,
+    0x9F, 0x73, 0xC3, 0x7B, 0xA0, 0xF4, 0x4F, 0xFE, 0x0F, 0xFB, 0x81, 0xD4, 0x57, 0xFD, 0xCF, 0xEB,
+    0x8D, 0x8D, 0x8D, 0xBF, 0xF9, 0x7F, 0xF9, 0x0F, 0x02, 0xF1, 0x5F, 0x21, 0xD4, 0x97, 0xF9, 0x60,
+    0x33, 0x3E, 0x9E, 0x07, 0x53, 0x17, 0xFE, 0x33, 0x82, 0xA8, 0x82, 0xFF, 0xDC, 0x40, 0x67, 0x30,
+    0x30, 0xFC, 0x39, 0x6F, 0x5A, 0xF2, 0x97, 0x8D, 0xE1, 0x20, 0x50, 0xE1, 0x7B, 0x56, 0x06, 0x86,
+    0x6D, 0xFF, 0xF6, 0xB1, 0x31, 0x00, 0x00, 0x9F, 0x22, 0x3A, 0x5F, 0x78, 0x9C, 0x63, 0x60, 0x48,
+    0xF8, 0xCF, 0xC9, 0x00, 0x04, 0x3F, 0xFE, 0xEF, 0x07, 0x92, 0x0B, 0xFE, 0x57, 0xFD, 0xD7, 0x65,
+    0x60, 0xF8, 0xEE, 0xC7, 0x70, 0x08, 0xC8, 0x2D, 0x60, 0x64, 0x60, 0x10, 0x67, 0xC0, 0x01, 0x8E,
+    0xFD, 0xEF, 0x05, 0x4A, 0x1F, 0xF8, 0xFF, 0xFF, 0xBF, 0x3D, 0x03, 0xC3, 0xEF, 0xF9, 0x26, 0xCF,
+    0xDE, 0x33, 0x06, 0xFC, 0x67, 0x67, 0x50, 0xF8, 0xCF, 0xB9, 0xE1, 0x3D, 0x50, 0xFA, 0x27, 0xFF,
+    0x07, 0x90, 0x81, 0x5F, 0xF5, 0x3F, 0xAF, 0x37, 0x36, 0x36, 0xFE, 0xE6, 0xFF, 0xE5, 0x3F, 0x08,
+    0xC4, 0x7F, 0x85, 0x50, 0x5F, 0xE6, 0x83, 0xCD, 0xF8, 0x78, 0x1E, 0x4C, 0x5D, 0xF8, 0xCF, 0x08,
+    0xA2, 0x0A, 0xFE, 0x73, 0x33, 0x30, 0x38, 0x30, 0x30, 0xFC, 0x39, 0x6F, 0x5A, 0xF2, 0x97, 0x8D,
+    0xE1, 0x20, 0x50, 0xE1, 0x7B, 0x56, 0x06, 0x86, 0x6D, 0xFF, 0xF6, 0xB1, 0x31, 0x00, 0x00, 0x09,
+    0x90, 0x3E, 0x38, 0x78, 0x9C, 0x63, 0xB8, 0xEC, 0xC7, 0x70, 0x29, 0x8E, 0x81, 0xE1, 0xE7, 0x7A,
+    0x86, 0xEF, 0xE7, 0x19, 0x18, 0xA0, 0x3C, 0xEC, 0xE0, 0xD8, 0xFF, 0x5E, 0x46, 0x06, 0x86, 0x03,
+    0xFF, 0xFF, 0xFF, 0xB7, 0x67, 0x60, 0xF8, 0x3D, 0xDF, 0xE4, 0xD9, 0x7B, 0xC6, 0x80, 0xFF, 0xEC,
+    0x0C, 0x0A, 0xFF, 0x39, 0x37, 0xBC, 0x07, 0x4A, 0xFF, 0xE4, 0xFF, 0xB0, 0x1F, 0x48, 0x7D, 0xD5,
+    0xFF, 0xBC, 0xDE, 0xD8, 0xD8, 0xF8, 0x9B, 0xFF, 0x97, 0xFF, 0x20, 0x10, 0xFF, 0x15, 0x42, 0x7D,
+    0x99, 0x0F, 0x36, 0xE3, 0xE3, 0x79, 0x30, 0x75, 0xE1, 0x3F, 0x23, 0x88, 0x2A, 0xF8, 0xCF, 0xCD,
+    0xC0, 0xE0, 0xC0, 0xC0, 0xF0, 0xE7, 0xBC, 0x69, 0xC9, 0x5F, 0x36, 0x86, 0x83, 0x40, 0x85, 0xEF,
+    0x59, 0x19, 0x18, 0xB6, 0xFD, 0xDB, 0xC7, 0xC6, 0x00, 0x00, 0x36, 0xE0, 0x3B, 0x97, 0x78, 0x9C,
+    0x63, 0x60, 0x62, 0x60, 0x08, 0xE8, 0x67, 0x64, 0xB8, 0xF0, 0x3F, 0x8F, 0x41, 0xE1, 0xC5, 0x7F,
+    0x5F, 0x06, 0x86, 0xAD, 0xF3, 0x19, 0x18, 0x18, 0x84, 0x18, 0x60, 0xE0, 0x73, 0x3D, 0x45, 0x18,
+    0x00, 0x33, 0x83, 0x1D, 0xFA, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x62, 0x60, 0xB8, 0xC2, 0xCB,
+    0xB0, 0xE9, 0x7F, 0x7E, 0xC3, 0xFF, 0xFD, 0xAC, 0x1F, 0xFB, 0x98, 0x18, 0x0C, 0x18, 0x90, 0xC0,
+    0xE7, 0x7A, 0x8A, 0x30, 0x00, 0x3C, 0x13, 0x1E, 0x18, 0x78, 0x9C, 0x63, 0x48, 0xF8, 0xCF, 0xC1,
+    0xC0, 0xF0, 0xE3, 0xFF, 0x7E, 0x86, 0x05, 0xFF, 0x2B, 0xFF, 0xCB, 0x7E, 0xF7, 0x63, 0x38, 0xB4,
+    0xBF, 0x80, 0x81, 0x81, 0x41, 0x9C, 0x01, 0x0D, 0x18, 0xFC, 0x67, 0xA7, 0x26, 0x01, 0x00, 0x99,
+    0x7E, 0x1D, 0xFF, 0x78, 0x9C, 0x7B, 0xEC, 0xC7, 0x70, 0x29, 0xEE, 0xE7, 0x7A, 0x86, 0xEF, 0xE7,
+    0x1F, 0x83, 0x58, 0x0C, 0x68, 0xC0, 0xE0, 0x3F, 0x3B, 0x35, 0x09, 0x00, 0x60, 0x70, 0x1B, 0x91,
+    0x78, 0x9C, 0x63, 0x60, 0x80, 0x00, 0x43, 0x06, 0x86, 0xAB, 0x8C, 0x0C, 0x0C, 0xDF, 0xE6, 0x39,
+    0xFF, 0xE7, 0x60, 0x60, 0xF8, 0xF1, 0xFF, 0xFF, 0x7A, 0x90, 0xE8, 0xB5, 0xFF, 0xF9, 0x20, 0xEA,
+    0xD1, 0xFF, 0xFF, 0x6C, 0x0C, 0x0C, 0x0A, 0xFF, 0xB4, 0xFF, 0xF9, 0x33, 0x30, 0x08, 0xAC, 0x64,
+    0xF8, 0xF4, 0x1E, 0xAC, 0x27, 0xE1, 0x3F, 0x3B, 0x90, 0x14, 0x62, 0xF8, 0xC7, 0xCB, 0xE0, 0xF0,
+    0xE7, 0x7F, 0xEC, 0x0F, 0x7D, 0x86, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0xAF, 0xF0, 0xDF, 0x57,
+    0xE0, 0xC8, 0xFF, 0xF9, 0x1B, 0xFE, 0x33, 0x31, 0x30, 0xFC, 0xDA, 0xFF, 0x01, 0x64, 0xD2, 0x87,
+    0xF3, 0x9F, 0xEB, 0x81, 0xD4, 0x83, 0xF3, 0x5F, 0xF2, 0x21, 0x14, 0x88, 0xF7, 0x61, 0xFD, 0xA7,
+    0xF9, 0x40, 0xEA, 0x73, 0xFD, 0x83, 0xFB, 0x40, 0xEA, 0x87, 0x7E, 0x03, 0xD0, 0x16, 0x83, 0xFF,
+    0xDC, 0x0C, 0x7F, 0xE7, 0x9B, 0x7C, 0x07, 0xEA, 0xBD, 0x04, 0x34, 0xCC, 0x0E, 0x28, 0x71, 0xEC,
+    0x5F, 0x2F, 0x23, 0x03, 0x00, 0x52, 0x40, 0x44, 0x3E, 0x78, 0x9C, 0x63, 0x60, 0x10, 0x64, 0x00,
+    0x81, 0x05, 0xFF, 0x73, 0xB7, 0xF8, 0x31, 0x30, 0xFC, 0xFA, 0xFF, 0xFF, 0xBF, 0x1C, 0x03, 0xC3,
+    0x29, 0xA1, 0xEB, 0xFB, 0x99, 0x18, 0xB0, 0x82, 0xCF, 0xF2, 0x0E, 0xAF, 0xCF, 0xB3, 0x32, 0x7C,
+    0xB6, 0xFF, 0xF1, 0xFF, 0x7F, 0x3E, 0xC3, 0xE7, 0xF5, 0xE7, 0x4D, 0xBF, 0xFF, 0x67, 0xFC, 0xFC,
+    0x9F, 0x8B, 0xA1, 0xE1, 0x3F, 0xEB, 0xE7, 0xFB, 0x0C, 0x0C, 0x0E, 0xFF, 0xD9, 0x3F, 0xD7, 0x33,
+    0x30, 0x18, 0x50, 0x8B, 0x02, 0x00, 0x10, 0x9B, 0x39, 0xBE, 0x78, 0x9C, 0x63, 0x60, 0x50, 0x60,
+    0x80, 0x80, 0x07, 0x36, 0x10, 0xFA, 0xFB, 0x7F, 0x29, 0x30, 0x1D, 0xF0, 0xE7, 0x3F, 0x07, 0x98,
+    0xA1, 0xF0, 0x53, 0x0E, 0xAA, 0x84, 0x89, 0x01, 0x0B, 0xD8, 0xF2, 0x77, 0x1F, 0x1B, 0x90, 0x5A,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xF3, 0x8C, 0x0C, 0x0C, 0xBF, 0xCF, 0x9B, 0x6E, 0xFD, 0xCF, 0xC3, 0x10,
+    0xF0, 0x9F, 0x9B, 0x81, 0xE1, 0x57, 0x3E, 0xC3, 0x86, 0xFF, 0x40, 0x4D, 0x1F, 0xEF, 0x33, 0x7C,
+    0x3C, 0x0F, 0x54, 0x73, 0xE0, 0x3F, 0xE3, 0xE7, 0xF5, 0x40, 0x7A, 0xC2, 0x7F, 0x96, 0x2F, 0xF3,
+    0x81, 0x74, 0xC3, 0x7F, 0xD6, 0xAF, 0x50, 0x1A, 0x2A, 0xCE, 0x0C, 0x53, 0x07, 0x44, 0x0C, 0x20,
+    0x4D, 0x09, 0xFF, 0xB9, 0x80, 0xE6, 0xC4, 0x33, 0x30, 0xFC, 0xD9, 0x0F, 0x34, 0x17, 0x68, 0xE6,
+    0x41, 0xA0, 0x3D, 0xFB, 0x41, 0xF6, 0x6E, 0xFD, 0xB7, 0x8F, 0x85, 0x81, 0x01, 0x00, 0x12, 0x25,
+    0x3C, 0x39, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x50, 0x60, 0x00, 0x03, 0x81, 0x9F, 0x2C, 0x60,
+    0xFA, 0xFB, 0x7F, 0x1E, 0x10, 0x75, 0xF5, 0x7F, 0x1D, 0x23, 0x88, 0xFE, 0xE5, 0x0D, 0x91, 0x56,
+    0x64, 0xC0, 0x0E, 0xB6, 0xFC, 0xDD, 0xC7, 0x06, 0xA4, 0x16, 0xFC, 0xFF, 0xFF, 0xFF, 0x3C, 0x50,
+    0xC3, 0xEF, 0xF3, 0xA6, 0x5B, 0x81, 0x06, 0x04, 0xFC, 0xE7, 0x06, 0x6A, 0xCD, 0x67, 0xD8, 0xF0,
+    0x9F, 0x89, 0x81, 0xE1, 0xE3, 0x7D, 0x86, 0x8F, 0xE7, 0x81, 0x6A, 0x0E, 0xFC, 0x67, 0xFC, 0xBC,
+    0x1E, 0x48, 0x4F, 0xF8, 0xCF, 0xF2, 0x65, 0x3E, 0x90, 0x6E, 0xF8, 0xCF, 0xFA, 0x15, 0x4A, 0x43,
+    0xC5, 0x99, 0x61, 0xEA, 0x80, 0x88, 0x01, 0xA4, 0x29, 0xE1, 0x3F, 0x17, 0xD0, 0x9C, 0x78, 0x06,
+    0x86, 0x3F, 0xFB, 0x81, 0xE6, 0x02, 0xCD, 0x3C, 0x08, 0xB4, 0x67, 0x3F, 0xC8, 0xDE, 0xAD, 0xFF,
+    0xF6, 0x01, 0xDD, 0x0B, 0x00, 0x18, 0x08, 0x3C, 0x49, 0x78, 0x9C, 0x63, 0x60, 0x50, 0xF8, 0xAB,
+    0xCB, 0x00, 0x02, 0x8F, 0xFF, 0xBF, 0x67, 0x06, 0x52, 0x01, 0xFF, 0x63, 0xFF, 0xC6, 0x03, 0xE9,
+    0x8F, 0xFD, 0x0C, 0x0D, 0xFF, 0x99, 0x18, 0x18, 0x1C, 0x80, 0x82, 0xC1, 0x0C, 0x78, 0xC0, 0x96,
+    0xBF, 0xFB, 0xD8, 0x80, 0xD4, 0x82, 0xFF, 0xFF, 0xFF, 0x9F, 0x67, 0x64, 0x60, 0xF8, 0x7D, 0xDE,
+    0x74, 0xEB, 0x7F, 0x1E, 0xA0, 0x31, 0xDC, 0x0C, 0x0C, 0xBF, 0xF2, 0x19, 0x36, 0x80, 0xCC, 0xF8,
+    0x78, 0x9F, 0xE1, 0xE3, 0x79, 0xA0, 0x9A, 0x03, 0xFF, 0x19, 0x3F, 0xAF, 0x07, 0xD2, 0x13, 0xFE,
+    0xB3, 0x7C, 0x99, 0x0F, 0xA4, 0x1B, 0xFE, 0xB3, 0x7E, 0x85, 0xD2, 0x50, 0x71, 0x66, 0x98, 0x3A,
+    0x20, 0x62, 0x00, 0x69, 0x4A, 0xF8, 0xCF, 0x05, 0x34, 0x07, 0xE8, 0xA0, 0x3F, 0xFB, 0x81, 0xE6,
+    0x02, 0xCD, 0x3C, 0x08, 0xB4, 0x67, 0x3F, 0xC8, 0xDE, 0xAD, 0xFF, 0xF6, 0xB1, 0x30, 0x30, 0x00,
+    0x00, 0xD8, 0xDE, 0x40, 0x1E, 0x78, 0x9C, 0x63, 0x60, 0x10, 0x60, 0x64, 0x00, 0x01, 0x81, 0x3F,
+    0xE7, 0x5D, 0xEF, 0x30, 0x31, 0x30, 0x1C, 0xF8, 0xFF, 0xFF, 0xFF, 0x79, 0x20, 0x7F, 0xA3, 0xD4,
+    0xA4, 0x7F, 0x52, 0x0C, 0x78, 0xC0, 0x96, 0xBF, 0xFB, 0xD8, 0x80, 0xD4, 0x02, 0x90, 0x7A, 0xA0,
+    0x11, 0xBF, 0xCF, 0x9B, 0x6E, 0xFD, 0xCF, 0xC3, 0x10, 0xF0, 0x9F, 0x9B, 0x81, 0xE1, 0x57, 0x3E,
+    0xC3, 0x86, 0xFF, 0x40, 0xB3, 0x3E, 0xDE, 0x67, 0xF8, 0x08, 0x32, 0xEB, 0xC0, 0x7F, 0xC6, 0xCF,
+    0xEB, 0x81, 0xF4, 0x84, 0xFF, 0x2C, 0x5F, 0xE6, 0x03, 0xE9, 0x86, 0xFF, 0xAC, 0x5F, 0xA1, 0x34,
+    0x54, 0x9C, 0x19, 0xA6, 0x0E, 0x88, 0x18, 0x40, 0x9A, 0x12, 0xFE, 0x73, 0x01, 0xCD, 0x89, 0x67,
+    0x60, 0xF8, 0xB3, 0x1F, 0x68, 0x2E, 0xD0, 0xCC, 0x83, 0x40, 0x7B, 0xF6, 0x83, 0xEC, 0xDD, 0xFA,
+    0x6F, 0x1F, 0x0B, 0x03, 0x03, 0x00, 0x0E, 0xB3, 0x3F, 0x71, 0x78, 0x9C, 0x75, 0x8E, 0xCD, 0x11,
+    0x82, 0x60, 0x0C, 0x44, 0xDF, 0x27, 0xE8, 0x01, 0x6D, 0xC7, 0x3E, 0xEC, 0x40, 0x3B, 0xB0, 0x05,
+    0x4B, 0xA0, 0x03, 0xE8, 0x40, 0x0F, 0x72, 0x05, 0xAD, 0xE0, 0x2B, 0xC1, 0x16, 0x44, 0xE5, 0xE2,
+    0xDF, 0xBA, 0x3A, 0x70, 0x34, 0x93, 0x99, 0x37, 0x9B, 0xD9, 0x6C, 0x42, 0x59, 0x90, 0x37, 0xC0,
+    0x45, 0xE1, 0xAC, 0x04, 0x06, 0xFD, 0xB7, 0xF6, 0xAF, 0x7A, 0x62, 0x94, 0x92, 0x62, 0x80, 0x47,
+    0x9C, 0x57, 0x9A, 0xB1, 0xD0, 0x14, 0xEE, 0x6B, 0x76, 0x1A, 0x41, 0x7B, 0xA2, 0x8D, 0xF6, 0x1C,
+    0x14, 0xAE, 0x5B, 0x33, 0x57, 0x7A, 0x2B, 0xCC, 0x8D, 0xC6, 0x5D, 0xCF, 0x7E, 0x9E, 0x0C, 0x3E,
+    0x37, 0xDF, 0xA5, 0x95, 0x32, 0xE7, 0x2C, 0xE1, 0xD9, 0x38, 0xD7, 0x99, 0x47, 0xDF, 0xF9, 0xFD,
+    0x53, 0xBD, 0xEB, 0x14, 0x3E, 0x5A, 0x2D, 0x3E, 0x61, 0x78, 0x9C, 0x63, 0x60, 0x38, 0xD4, 0xCF,
+    0x00, 0x04, 0x3F, 0xFF, 0x33, 0xC3, 0xC9, 0x83, 0x60, 0x11, 0x74, 0x60, 0x60, 0x0C, 0x04, 0xCA,
+    0x9F, 0xFF, 0x03, 0xC1, 0x79, 0x08, 0x89, 0x4D, 0x15, 0x04, 0x60, 0x37, 0x13, 0x00, 0x89, 0x46,
+    0x19, 0xCA, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x02, 0x51, 0x06, 0x30, 0x50, 0xF8, 0xCF, 0x0C, 0xA6,
+    0x0B, 0xDE, 0x43, 0xF8, 0x07, 0xE6, 0x83, 0xC8, 0x2D, 0x7F, 0xFF, 0xF9, 0x03, 0xA9, 0x05, 0xFF,
+    0xFF, 0xFF, 0xDF, 0xCF, 0xC8, 0xC0, 0xF0, 0xFB, 0xBC, 0xE9, 0xAF, 0xFF, 0x3C, 0x0C, 0x01, 0xFF,
+    0xB9, 0x19, 0xDE, 0xFE, 0xC8, 0x67, 0xD8, 0xF0, 0x9F, 0x49, 0x61, 0xFE, 0x87, 0xF3, 0x0C, 0x1F,
+    0xCF, 0x33, 0x34, 0xF8, 0x6F, 0xF8, 0xCF, 0xF8, 0x79, 0x3D, 0xC3, 0x05, 0xBE, 0x09, 0xFF, 0x99,
+    0xBF, 0xCC, 0x67, 0xF8, 0xC4, 0xD9, 0xF0, 0x9F, 0x15, 0x48, 0xFF, 0x60, 0x01, 0xD2, 0x9F, 0xE7,
+    0x33, 0xBC, 0x65, 0x00, 0x8A, 0x7F, 0x3C, 0x6F, 0x30, 0x9F, 0xE1, 0xC0, 0x7F, 0xC6, 0x03, 0xFF,
+    0x1B, 0xFD, 0x41, 0x9A, 0x12, 0xFE, 0xDF, 0xE0, 0x63, 0xF8, 0x15, 0x0F, 0x34, 0xF7, 0xBF, 0xF5,
+    0x56, 0xA0, 0x99, 0x0C, 0x1B, 0x41, 0xF6, 0x00, 0xED, 0x33, 0xF8, 0xFF, 0x6F, 0x1F, 0x0B, 0x90,
+    0x6E, 0xB8, 0x0F, 0x71, 0xCC, 0x85, 0x7E, 0x08, 0xFD, 0xC9, 0x1E, 0x42, 0x0B, 0xB0, 0x81, 0x29,
+    0x00, 0xFE, 0x27, 0x47, 0x4A, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x62, 0x00, 0x01, 0x81, 0xFD, 0x60,
+    0xBA, 0xE1, 0xFF, 0x7C, 0x46, 0x10, 0x7D, 0xEC, 0x7F, 0x3D, 0x58, 0x78, 0xF2, 0x7B, 0x30, 0xC5,
+    0xA0, 0xC8, 0x80, 0x06, 0xBE, 0xC5, 0x33, 0x30, 0x14, 0xFC, 0x67, 0xA6, 0x0E, 0xF5, 0x15, 0x48,
+    0x6D, 0xF8, 0xCF, 0xFC, 0xA5, 0x9F, 0x81, 0xE1, 0xFB, 0x7F, 0xE6, 0x07, 0xFF, 0xD5, 0x16, 0x9F,
+    0xFF, 0xCF, 0x9C, 0xF0, 0xFF, 0xFF, 0x7F, 0xAB, 0xFF, 0xCC, 0x0C, 0x47, 0xFF, 0xE7, 0x28, 0xFC,
+    0x67, 0x06, 0x00, 0x1B, 0x81, 0x38, 0x4D, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x60, 0x62, 0x00,
+    0x81, 0x85, 0xF6, 0x20, 0xB2, 0xE1, 0xFF, 0x7E, 0x20, 0x19, 0xF0, 0xEF, 0xBE, 0x38, 0x90, 0x3A,
+    0xB0, 0x9E, 0x05, 0x24, 0xA6, 0xC0, 0xC8, 0x80, 0x01, 0xBE, 0xC5, 0x33, 0x30, 0x14, 0xFC, 0x67,
+    0xA6, 0x0E, 0xF5, 0x15, 0x48, 0x6D, 0xF8, 0xCF, 0xFC, 0xA5, 0x9F, 0x81, 0xE1, 0xFB, 0x7F, 0xE6,
+    0x07, 0xFF, 0xD5, 0x16, 0x9F, 0xFF, 0xCF, 0x9C, 0xF0, 0xFF, 0xFF, 0x7F, 0xAB, 0xFF, 0xCC, 0x0C,
+    0x47, 0xFF, 0xE7, 0x28, 0xFC, 0x67, 0x06, 0x00, 0x30, 0x66, 0x38, 0x6C, 0x78, 0x9C, 0x63, 0x60,
+    0x78, 0x74, 0x9E, 0x91, 0x81, 0x81, 0xC1, 0xE1, 0xFF, 0x7F, 0x3D, 0x20, 0xF5, 0xED, 0xFC, 0xB3,
+    0xFF, 0x2C, 0x0C, 0x0A, 0xFF, 0xD9, 0x19, 0x7E, 0xCA, 0x33, 0x30, 0xA8, 0x02, 0xC5, 0x59, 0x18,
+    0xB0, 0x82, 0x6F, 0xF1, 0x0C, 0x0C, 0x05, 0xFF, 0x99, 0xA9, 0x43, 0x7D, 0x05, 0x52, 0x1B, 0xFE,
+    0x33, 0x7F, 0xE9, 0x67, 0x60, 0xF8, 0xFE, 0x9F, 0xF9, 0xC1, 0x7F, 0xB5, 0xC5, 0xE7, 0xFF, 0x33,
+    0x27, 0xFC, 0xFF, 0xFF, 0xDF, 0xEA, 0x3F, 0x33, 0xC3, 0xD1, 0xFF, 0x39, 0x0A, 0xFF, 0x99, 0x01,
+    0x73, 0x8F, 0x3B, 0xE7, 0x78, 0x9C, 0x63, 0xF8, 0xCD, 0xC1, 0xF0, 0x8B, 0x93, 0xC1, 0xE1, 0x3F,
+    0xBF, 0xC2, 0x7F, 0x79, 0x06, 0x06, 0x08, 0x0F, 0x2B, 0xF8, 0x16, 0xCF, 0xC0, 0x50, 0xF0, 0x9F,
+    0x99, 0x3A, 0xD4, 0x57, 0x20, 0xB5, 0xE1, 0x3F, 0xF3, 0x97, 0x7E, 0x06, 0x86, 0xEF, 0xFF, 0x99,
+    0x1F, 0xFC, 0x57, 0x5B, 0x7C, 0xFE, 0x3F, 0x73, 0xC2, 0xFF, 0xFF, 0xFF, 0xAD, 0xFE, 0x33, 0x33,
+    0x1C, 0xFD, 0x9F, 0xA3, 0xF0, 0x9F, 0x19, 0x00, 0xEA, 0x1D, 0x38, 0x0C, 0x78, 0x9C, 0x6D, 0xCF,
+    0xDD, 0x0D, 0x82, 0x40, 0x0C, 0x07, 0xF0, 0xBF, 0xA2, 0xF1, 0x33, 0xEA, 0x06, 0xF8, 0xAA, 0x2F,
+    0x3A, 0x02, 0x0B, 0x18, 0x1C, 0xC0, 0x04, 0x9D, 0xC0, 0x55, 0xDC, 0x00, 0x36, 0xC0, 0x0D, 0x18,
+    0x41, 0x46, 0xD0, 0x77, 0x93, 0x23, 0xF8, 0x85, 0x10, 0xA9, 0x6D, 0xCF, 0x47, 0xFB, 0x70, 0xBF,
+    0xBB, 0xB4, 0x69, 0xAF, 0x00, 0x30, 0x85, 0xC6, 0xF2, 0xAA, 0x4C, 0x4A, 0xEA, 0x88, 0x05, 0x6D,
+    0xF4, 0x49, 0x33, 0x9B, 0x76, 0xF0, 0x2F, 0x0A, 0x9F, 0x8F, 0xD4, 0xE0, 0x16, 0xB2, 0x79, 0x88,
+    0xB3, 0x61, 0x9F, 0x3E, 0x0E, 0xD4, 0x04, 0xAA, 0x11, 0x3C, 0x69, 0x46, 0x3D, 0xA0, 0x1E, 0xF2,
+    0xBD, 0x05, 0xBC, 0x5D, 0xCE, 0x71, 0xCD, 0x3D, 0x40, 0x1A, 0xB3, 0x59, 0x8C, 0x3C, 0x60, 0x23,
+    0x83, 0xD7, 0x98, 0x5D, 0x93, 0x53, 0xF5, 0xA5, 0x33, 0x75, 0xA9, 0x2D, 0x96, 0x2B, 0x6A, 0x88,
+    0x8F, 0x24, 0xD1, 0x89, 0x19, 0xED, 0xD5, 0x23, 0xB9, 0xF6, 0x0B, 0x9F, 0x81, 0xE2, 0xD9, 0x72,
+    0x5C, 0x4E, 0xCA, 0xAE, 0x5E, 0x08, 0x5B, 0x92, 0xA1, 0xD2, 0x76, 0x6E, 0xB7, 0xFB, 0xAD, 0xF1,
+    0x05, 0x17, 0x7A, 0x39, 0x0B, 0x78, 0x9C, 0x63, 0x10, 0x62, 0x00, 0x81, 0xCF, 0xF5, 0xC4, 0x53,
+    0x09, 0x7F, 0xCE, 0xB1, 0x02, 0xA9, 0xDF, 0xFF, 0xFF, 0xCF, 0x67, 0xF8, 0xFC, 0x7F, 0xBD, 0xC9,
+    0x8F, 0xFF, 0xAC, 0x9F, 0xFF, 0xB3, 0x31, 0x04, 0xFC, 0xE7, 0xFD, 0x3C, 0x1F, 0xA8, 0xE0, 0xAF,
+    0x3E, 0x58, 0xE5, 0xCF, 0x78, 0x30, 0xF5, 0xBD, 0x1E, 0x4C, 0x7D, 0x43, 0xA1, 0xBE, 0xE7, 0x43,
+    0x94, 0xF8, 0x83, 0xA9, 0x7F, 0xFC, 0x9F, 0xEF, 0x33, 0x32, 0x14, 0xFC, 0xE7, 0xFA, 0xFC, 0x3F,
+    0xCF, 0xF9, 0xE7, 0x7F, 0xA6, 0xCF, 0xFB, 0xFF, 0xFF, 0xFF, 0x1F, 0x0F, 0xB4, 0x61, 0xF1, 0xBF,
+    0x75, 0x4C, 0xC4, 0x38, 0xE9, 0xB1, 0x37, 0x98, 0x02, 0x00, 0x8C, 0xC4, 0x49, 0x00, 0x78, 0x9C,
+    0x75, 0xCE, 0xDB, 0x11, 0xC1, 0x40, 0x14, 0x06, 0xE0, 0x9F, 0x30, 0x04, 0x83, 0x0E, 0xF2, 0x9E,
+    0x17, 0x2D, 0xA4, 0x01, 0xA2, 0x83, 0x50, 0x81, 0x56, 0x74, 0x10, 0x1D, 0x44, 0x07, 0x3B, 0x2A,
+    0x48, 0x46, 0x03, 0xA2, 0x82, 0xCD, 0x04, 0x11, 0x32, 0x72, 0x9C, 0xB3, 0x3B, 0x1E, 0xED, 0xC3,
+    0x7E, 0x7B, 0x39, 0x37, 0x9C, 0x57, 0x38, 0xED, 0x00, 0xD4, 0x0A, 0xD5, 0x85, 0xFD, 0xDD, 0xFF,
+    0xAC, 0x3A, 0xE4, 0x2D, 0xD3, 0xB8, 0xC5, 0x6C, 0x19, 0x23, 0xD7, 0x6C, 0x15, 0x62, 0x4F, 0x5D,
+    0xA0, 0x99, 0x22, 0xA0, 0x01, 0x40, 0x2E, 0xD0, 0x4E, 0xF8, 0xDC, 0x03, 0x5E, 0x1E, 0xFF, 0x71,
+    0xCC, 0x3D, 0x42, 0x96, 0xB0, 0x45, 0x82, 0x32, 0x62, 0x0F, 0x1A, 0xCF, 0x19, 0xBB, 0x26, 0xA7,
+    0x19, 0x49, 0x65, 0x1A, 0x52, 0x5F, 0x7C, 0x2F, 0xA9, 0x23, 0x3E, 0x94, 0x32, 0x1D, 0x0B, 0xB2,
+    0xE3, 0x1C, 0xC9, 0xB3, 0x23, 0x7C, 0xC6, 0x86, 0xC0, 0x86, 0xE3, 0x9A, 0x1A, 0xB6, 0xED, 0x42,
+    0xD8, 0x90, 0x34, 0x95, 0xB2, 0xBE, 0x79, 0x9E, 0x3B, 0x36, 0xE9, 0x0B, 0x20, 0xDF, 0x3A, 0x5D,
+    0x78, 0x9C, 0x33, 0x30, 0x06, 0x03, 0xE1, 0x2F, 0xFF, 0xC1, 0x60, 0x3E, 0x8C, 0x06, 0x00, 0xA1,
+    0x0C, 0x10, 0x90, 0x78, 0x9C, 0x33, 0x30, 0x06, 0x03, 0x86, 0x8F, 0xFF, 0xC1, 0x80, 0x19, 0x46,
+    0x03, 0x00, 0x99, 0x69, 0x0F, 0x3F, 0x78, 0x9C, 0x33, 0x30, 0x86, 0x03, 0x86, 0x8F, 0xFF, 0xE1,
+    0x80, 0x11, 0x99, 0x0D, 0x00, 0x5E, 0xAE, 0x17, 0xFF, 0x78, 0x9C, 0x33, 0x30, 0x06, 0x03, 0x86,
+    0x8F, 0xFF, 0xC1, 0x80, 0x19, 0x46, 0x03, 0x00, 0x99, 0x69, 0x0F, 0x3F, 0x78, 0x9C, 0xFB, 0x2A,
+    0xEF, 0xF0, 0x9F, 0xE9, 0xEB, 0x80, 0x13, 0x00, 0xD6, 0xB5, 0x3E, 0xF8, 0x78, 0x9C, 0x63, 0xF8,
+    0xCE, 0xCA, 0xF0, 0x8F, 0x31, 0xE1, 0x3E, 0xC3, 0x85, 0xF9, 0x0C, 0x5F, 0xF2, 0x19, 0x7E, 0xBD,
+    0x67, 0xF8, 0xF5, 0x9F, 0xE1, 0x52, 0x1E, 0x03, 0x00, 0x83, 0xB3, 0x0B, 0x2F, 0x78, 0x9C, 0x5B,
+    0xB0, 0x9E, 0xE1, 0xEB, 0x7F, 0x96, 0x2F, 0xFF, 0x59, 0x0E, 0xBC, 0x67, 0x78, 0xD0, 0xCF, 0xF0,
+    0x59, 0x9E, 0xE1, 0x3B, 0x27, 0xC3, 0x6F, 0x26, 0x06, 0x00, 0xA4, 0xDF, 0x0B, 0x6C, 0x78, 0x9C,
+    0x5B, 0xB0, 0x9E, 0xE1, 0xEB, 0x7F, 0x96, 0x2F, 0xFF, 0x59, 0x0E, 0xBC, 0x67, 0x78, 0xD0, 0xCF,
+    0xF0, 0x59, 0x9E, 0xE1, 0x3B, 0x27, 0xC3, 0x6F, 0x26, 0x06, 0x00, 0xA4, 0xDF, 0x0B, 0x6C, 0x78,
+    0x9C, 0x01, 0x28, 0x00, 0xD7, 0xFF, 0x00, 0xF7, 0x05, 0x40, 0x8F, 0x00, 0xFE, 0x01, 0xC0, 0x4F,
+    0x60, 0xDF, 0x00, 0xF3, 0x0F, 0xD0, 0x9F, 0x00, 0xFA, 0x0C, 0xF4, 0x6F, 0x10, 0xFF, 0x0A, 0xFA,
+    0xEF, 0x60, 0xFF, 0x1F, 0xFA, 0xFF, 0x70, 0xFF, 0x2F, 0xD2, 0x6E, 0x00, 0xFB, 0x08, 0x82, 0xB5,
+    0x14, 0x4D, 0x78, 0x9C, 0x01, 0x28, 0x00, 0xD7, 0xFF, 0xA0, 0xAF, 0x00, 0xF8, 0x1B, 0xF5, 0xFF,
+    0x24, 0xFF, 0x7F, 0xF4, 0xFF, 0x14, 0xFF, 0x7F, 0xC0, 0xEF, 0x00, 0xF9, 0x2F, 0xE0, 0x8F, 0x00,
+    0xFB, 0x0B, 0xF3, 0x1F, 0x00, 0xFF, 0x03, 0xF7, 0x09, 0x40, 0xCF, 0x00, 0xFB, 0x02, 0x80, 0x5F,
+    0x00, 0xDA, 0xEE, 0x14, 0xC9, 0x78, 0x9C, 0x01, 0x28, 0x00, 0xD7, 0xFF, 0xA0, 0xAF, 0x00, 0xF8,
+    0x1B, 0xF5, 0xFF, 0x24, 0xFF, 0x7F, 0xF4, 0xFF, 0x14, 0xFF, 0x7F, 0xC0, 0xEF, 0x00, 0xF9, 0x2F,
+    0xE0, 0x8F, 0x00, 0xFB, 0x0B, 0xF3, 0x1F, 0x00, 0xFF, 0x03, 0xF7, 0x09, 0x40, 0xCF, 0x00, 0xFB,
+    0x02, 0x80, 0x5F, 0x00, 0xDA, 0xEE, 0x14, 0xC9, 0x78, 0x9C, 0x63, 0x60, 0xB8, 0xB0, 0x9F, 0x01,
+    0x04, 0xB0, 0x50, 0x7F, 0xFE, 0x83, 0x00, 0x17, 0x94, 0x32, 0x32, 0xBE, 0x7C, 0xDE, 0xD8, 0x98,
+    0x11, 0xAB, 0x4A, 0xEA, 0x50, 0x00, 0xA8, 0x44, 0x28, 0xF0, 0x78, 0x9C, 0x63, 0x60, 0xB8, 0xB0,
+    0x9F, 0x01, 0x04, 0xB0, 0x50, 0x7F, 0xFE, 0x83, 0x00, 0x17, 0x94, 0x32, 0x32, 0xBE, 0x7C, 0xDE,
+    0xD8, 0x98, 0x11, 0xAB, 0x4A, 0xEA, 0x68, 0x07, 0x00, 0x42, 0x8B, 0x32, 0xB3, 0x78, 0x9C, 0x53,
+    0xF8, 0x9D, 0xC7, 0xF0, 0xE0, 0xFF, 0x7F, 0xD6, 0x6F, 0xFF, 0xFF, 0xF3, 0xFE, 0xF8, 0xFF, 0x9F,
+    0xFF, 0x2B, 0x90, 0x06, 0xF2, 0xD9, 0x14, 0x7E, 0xE7, 0x32, 0x00, 0x00, 0x0A, 0xDA, 0x11, 0xDF,
+    0x78, 0x9C, 0xDB, 0xB0, 0x9E, 0x81, 0xE1, 0x87, 0x0E, 0x83, 0xC3, 0x3B, 0xD6, 0xEF, 0xFF, 0xD9,
+    0x14, 0xFE, 0xAF, 0x67, 0x78, 0xF0, 0x9F, 0xEF, 0x1B, 0x9C, 0xB5, 0x01, 0x26, 0xCB, 0x02, 0x00,
+    0x8B, 0x0C, 0x12, 0xD9, 0x78, 0x9C, 0x55, 0xD0, 0x3F, 0x0A, 0xC2, 0x30, 0x14, 0x06, 0xF0, 0xAF,
+    0x52, 0x44, 0xAB, 0x48, 0x3D, 0x81, 0xE2, 0x01, 0x14, 0x27, 0x71, 0xD2, 0xC1, 0xBD, 0x1E, 0x40,
+    0xE8, 0xE4, 0xEE, 0x0D, 0xF4, 0x06, 0x16, 0x2F, 0x50, 0x4F, 0x20, 0xE2, 0x05, 0x74, 0x70, 0x14,
+    0x2A, 0x5E, 0x40, 0x17, 0x71, 0xB3, 0xFE, 0x01, 0x2D, 0x05, 0x7D, 0xBE, 0x24, 0x2D, 0xC4, 0x37,
+    0x84, 0xE4, 0x23, 0xBF, 0xBC, 0x24, 0x80, 0xAA, 0x21, 0xD2, 0xDA, 0xD2, 0x80, 0x47, 0xFB, 0x9B,
+    0x4B, 0xD6, 0x23, 0x22, 0xCA, 0x03, 0xCB, 0xD0, 0x48, 0x82, 0xC7, 0xBA, 0x17, 0x3B, 0xC0, 0xCB,
+    0x4D, 0x45, 0x54, 0xC2, 0xC9, 0x87, 0x4D, 0x56, 0x1A, 0xC4, 0x05, 0xCC, 0x03, 0x4D, 0xC8, 0x60,
+    0xAD, 0x09, 0xBC, 0x4B, 0xD8, 0xFB, 0x9A, 0xC0, 0x9D, 0x0F, 0x6D, 0x68, 0x02, 0x7D, 0x6E, 0x9B,
+    0xD5, 0x04, 0x30, 0xDB, 0xB5, 0xAB, 0x2C, 0x6A, 0x62, 0x5E, 0x4D, 0x36, 0x6E, 0x42, 0xE3, 0x42,
+    0x53, 0x60, 0x45, 0x47, 0x53, 0x1D, 0xEC, 0x7A, 0x0C, 0x2D, 0xFB, 0x4B, 0xE4, 0xC8, 0x8D, 0x64,
+    0x3D, 0xFD, 0x72, 0xE4, 0xCC, 0x43, 0xF3, 0x70, 0x4C, 0x44, 0x24, 0x9A, 0xDF, 0xC6, 0xE8, 0x52,
+    0x46, 0x0A, 0x75, 0xBD, 0xBB, 0xC3, 0x4F, 0x30, 0xA5, 0x40, 0x5C, 0x14, 0x81, 0xAB, 0x02, 0x16,
+    0x78, 0x57, 0x98, 0xF0, 0x23, 0xFB, 0x82, 0xB0, 0xC0, 0x23, 0xE8, 0xC5, 0x1D, 0x8F, 0x5A, 0xE7,
+    0x40, 0x09, 0xF9, 0x4D, 0x39, 0x7C, 0x88, 0xEA, 0x40, 0xF7, 0x6A, 0xA4, 0x1F, 0x39, 0xF9, 0x2C,
+    0x44, 0x93, 0x26, 0xFE, 0xEA, 0x07, 0x33, 0xDC, 0x6E, 0x55, 0x78, 0x9C, 0x01, 0x3C, 0x00, 0xC3,
+    0xFF, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0xF3, 0x1F, 0x00, 0x10, 0xFE, 0x0A, 0x00, 0xC0, 0xEF,
+    0x01, 0x00, 0xF9, 0x6F, 0x00, 0x60, 0xFF, 0x0B, 0x00, 0xF3, 0xFF, 0x02, 0x00, 0xF6, 0x8F, 0x00,
+    0x00, 0xF5, 0xEF, 0x00, 0x00, 0xA0, 0xFF, 0x09, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xE1, 0xDF,
+    0x00, 0x00, 0x30, 0xFF, 0x08, 0x00, 0x00, 0xF6, 0x1F, 0x00, 0x00, 0x80, 0x04, 0x55, 0x9B, 0x13,
+    0xBE, 0x78, 0x9C, 0x53, 0x60, 0x61, 0x60, 0xF8, 0xA4, 0xCF, 0xC0, 0xB0, 0xE1, 0x3E, 0x03, 0x83,
+    0xC2, 0x7F, 0x6E, 0x06, 0x86, 0xEF, 0xFD, 0x0C, 0x0C, 0x07, 0xFE, 0xB3, 0x32, 0x18, 0xFC, 0x07,
+    0x8A, 0xFE, 0x8C, 0x67, 0x10, 0xF8, 0x67, 0xCF, 0xB0, 0xE0, 0x3F, 0x07, 0xC3, 0x97, 0xFD, 0x0C,
+    0x0C, 0xFF, 0x64, 0x19, 0x26, 0xFC, 0x67, 0x62, 0xF8, 0xE4, 0xCF, 0xC0, 0x10, 0xC0, 0xCE, 0xC0,
+    0x00, 0x00, 0x3D, 0x69, 0x12, 0xEA, 0x78, 0x9C, 0x73, 0x60, 0x80, 0x00, 0x01, 0xE6, 0x9F, 0xD6,
+    0x10, 0xD6, 0x33, 0xFD, 0xEF, 0xFF, 0x6B, 0x98, 0x19, 0x18, 0x02, 0x7F, 0xFE, 0xD7, 0x35, 0xF8,
+    0xFB, 0xFF, 0xFF, 0xFB, 0x7F, 0xFF, 0xFF, 0xCF, 0x67, 0x60, 0x48, 0x00, 0x32, 0xFF, 0xFF, 0x5F,
+    0xCF, 0x04, 0x54, 0x61, 0x70, 0xE2, 0xDF, 0xBD, 0x6C, 0x46, 0x06, 0x06, 0x00, 0x66, 0x12, 0x18,
+    0x87, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x02, 0x03, 0x2D, 0x10, 0xC9, 0xB0, 0xA1, 0x1E, 0x4C, 0x7D,
+    0xE6, 0x03, 0x53, 0xBF, 0xD9, 0xC0, 0x52, 0xEF, 0x21, 0x52, 0xF9, 0x60, 0xEA, 0x0B, 0x44, 0xEA,
+    0x0F, 0x58, 0xCA, 0xE1, 0x3E, 0x98, 0x73, 0x00, 0x2A, 0xC5, 0x0B, 0x91, 0x62, 0x45, 0x92, 0xBA,
+    0x10, 0x0F, 0xA6, 0xBE, 0x42, 0xA4, 0xFE, 0x82, 0xA5, 0x02, 0x50, 0xA5, 0x78, 0x20, 0x52, 0x2C,
+    0x20, 0x32, 0xE1, 0x3C, 0x44, 0xCA, 0x1F, 0x4C, 0x7D, 0x83, 0x48, 0xFD, 0x00, 0x4B, 0x31, 0x08,
+    0x80, 0x49, 0x06, 0x00, 0xCC, 0x3B, 0x19, 0x2C, 0x78, 0x9C, 0xFB, 0xF1, 0x1F, 0x04, 0xD8, 0x7E,
+    0x40, 0x28, 0x43, 0x63, 0x63, 0xE3, 0xC9, 0xFF, 0x99, 0x19, 0x80, 0xE0, 0xC2, 0x7D, 0x10, 0xC9,
+    0xF0, 0xA5, 0x1E, 0x4C, 0xFD, 0x92, 0x07, 0x53, 0xFF, 0xB9, 0x41, 0x64, 0xC2, 0x7F, 0x56, 0x10,
+    0x75, 0xE0, 0x3D, 0x58, 0xEC, 0xD3, 0x7C, 0x30, 0xF5, 0xC3, 0x1E, 0x4C, 0xFD, 0xE3, 0x05, 0x91,
+    0x0E, 0xFF, 0xD9, 0x41, 0xD4, 0x82, 0xFF, 0x8C, 0x20, 0xEA, 0xE3, 0x7E, 0xB0, 0xD4, 0xB7, 0x78,
+    0x30, 0xF5, 0x87, 0x0F, 0x44, 0x2A, 0xFC, 0xE7, 0x04, 0x51, 0x0D, 0x10, 0xCB, 0x1E, 0xA0, 0x58,
+    0x16, 0x20, 0x05, 0x22, 0x01, 0x06, 0x3A, 0x27, 0xB8, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x60,
+    0x65, 0x80, 0x82, 0x05, 0xFD, 0x30, 0xD6, 0x8F, 0xF3, 0x50, 0x46, 0xC1, 0x7F, 0x59, 0x28, 0xEB,
+    0xEB, 0x7B, 0x26, 0x08, 0xC3, 0xE1, 0xBF, 0x3E, 0x54, 0xE8, 0xF3, 0x7F, 0x66, 0x08, 0x43, 0xE1,
+    0x9F, 0x3F, 0x54, 0xE8, 0xE2, 0xFF, 0xB3, 0x67, 0xC0, 0xA0, 0xE7, 0xC7, 0x7F, 0x28, 0xD8, 0xBF,
+    0xE1, 0xFF, 0x9C, 0x99, 0x60, 0x90, 0xC9, 0xF0, 0x27, 0x9F, 0x01, 0xAE, 0x90, 0x8D, 0x01, 0xA6,
+    0x39, 0x9E, 0x01, 0x6E, 0x20, 0x0B, 0x03, 0xCC, 0x12, 0x7B, 0x98, 0xE0, 0xB7, 0xF7, 0x30, 0x56,
+    0x03, 0x5C, 0x21, 0x03, 0xC4, 0x2D, 0x00, 0x8E, 0x07, 0x2E, 0x20, 0x78, 0x9C, 0x63, 0x60, 0x60,
+    0x60, 0x30, 0x64, 0x80, 0x02, 0x85, 0x7F, 0xAC, 0x50, 0xD6, 0xE3, 0xFF, 0xF9, 0x10, 0x86, 0xC3,
+    0xFF, 0xFF, 0xFF, 0x39, 0xC0, 0xAC, 0x6F, 0xE7, 0xFF, 0xFF, 0x99, 0x0F, 0x62, 0x14, 0xFC, 0xB7,
+    0xF9, 0x3F, 0xFD, 0x3F, 0x37, 0x90, 0xF5, 0xF3, 0xBC, 0xE1, 0x7F, 0xF6, 0x9F, 0xE7, 0x19, 0x19,
+    0x16, 0xFC, 0xE7, 0x36, 0xF8, 0xCF, 0xDE, 0xF0, 0x5F, 0x97, 0xE1, 0xF7, 0x7A, 0x06, 0x20, 0x8B,
+    0xE1, 0xFB, 0x7B, 0xC6, 0x2F, 0x9C, 0x60, 0x56, 0x42, 0x3F, 0x83, 0x01, 0x03, 0x98, 0xC5, 0xC0,
+    0x0C, 0xD2, 0x0D, 0x66, 0x31, 0x50, 0x9D, 0x05, 0x00, 0x8E, 0x4B, 0x2D, 0x21, 0x78, 0x9C, 0x63,
+    0x60, 0x00, 0x02, 0x03, 0x26, 0x06, 0x28, 0xF8, 0x2A, 0x0B, 0x63, 0xFD, 0x3C, 0x0F, 0x63, 0x2D,
+    0xF8, 0xCF, 0x0D, 0x63, 0xFE, 0x9E, 0x0F, 0x63, 0x1D, 0xF8, 0xCF, 0x0E, 0x65, 0x09, 0xFC, 0xCD,
+    0x87, 0x09, 0x5E, 0xFA, 0xCF, 0x72, 0xF4, 0x0C, 0x04, 0xFC, 0xB7, 0xFF, 0xFE, 0x1F, 0x0A, 0xCE,
+    0x4F, 0x9E, 0x09, 0x06, 0x3B, 0xFF, 0xCB, 0x41, 0xD5, 0x3D, 0xFE, 0x0F, 0xB5, 0xD0, 0xE0, 0x9F,
+    0x3F, 0x54, 0xE8, 0xD1, 0x7F, 0x56, 0x98, 0x71, 0xF5, 0x70, 0x2B, 0x38, 0x60, 0xD6, 0xAE, 0x87,
+    0xD9, 0xF0, 0x08, 0xEE, 0x14, 0x01, 0x10, 0x01, 0x00, 0x28, 0x41, 0x2D, 0xFD, 0x78, 0x9C, 0x63,
+    0x60, 0x60, 0x10, 0xE8, 0x60, 0x66, 0x80, 0x00, 0x83, 0xFF, 0xEC, 0xB4, 0x60, 0x2D, 0x60, 0x02,
+    0xB3, 0x04, 0xB4, 0x19, 0x7E, 0xD9, 0x81, 0x59, 0x17, 0xEF, 0x33, 0x7E, 0xF9, 0xCF, 0x02, 0x64,
+    0x29, 0xFC, 0xED, 0x67, 0x30, 0xF8, 0x17, 0x0F, 0x64, 0x3D, 0xFE, 0xCF, 0xC6, 0xC0, 0x70, 0xE9,
+    0xBF, 0xD9, 0x7F, 0xF3, 0xFF, 0xF1, 0x40, 0x2D, 0x02, 0x7F, 0xEA, 0xFF, 0xBF, 0x78, 0x0F, 0x76,
+    0xD7, 0x86, 0xFF, 0xFF, 0xFF, 0xEB, 0x41, 0xCC, 0xFB, 0xF5, 0xFF, 0x3E, 0x23, 0x84, 0xD5, 0xF0,
+    0x5F, 0x06, 0x6A, 0x07, 0xC3, 0x72, 0x06, 0x54, 0x00, 0x00, 0x05, 0xD8, 0x2D, 0x2D, 0x78, 0x9C,
+    0x63, 0x60, 0x60, 0x60, 0x60, 0x63, 0x40, 0x80, 0x06, 0x5E, 0x24, 0xCE, 0x0F, 0x24, 0x4E, 0xC1,
+    0x79, 0x24, 0xCE, 0xF7, 0x52, 0x04, 0xA7, 0x20, 0xBF, 0xE0, 0xFC, 0x19, 0x08, 0xF0, 0x66, 0xF8,
+    0xCE, 0x66, 0xD0, 0x01, 0x05, 0xA7, 0x0B, 0xF2, 0x11, 0x1A, 0xAE, 0x7F, 0x47, 0xB2, 0xE4, 0xFA,
+    0x17, 0x2E, 0x24, 0x8E, 0xC3, 0x7A, 0x24, 0x0E, 0xC3, 0x17, 0xCE, 0x00, 0xA8, 0x61, 0x67, 0xF6,
+    0x31, 0x38, 0xCC, 0x2F, 0xA8, 0x2B, 0x87, 0x00, 0x71, 0x06, 0x86, 0x2F, 0x95, 0x48, 0x2E, 0x70,
+    0x78, 0x8F, 0xEC, 0xD0, 0x2F, 0xC8, 0x1C, 0x07, 0x64, 0x0E, 0x03, 0x33, 0x8C, 0x01, 0x00, 0x42,
+    0x19, 0x2B, 0x4F, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x10, 0x60, 0x80, 0x81, 0x2F, 0x2C, 0x50,
+    0x86, 0xC3, 0x7D, 0x7F, 0x98, 0x10, 0xE7, 0x4F, 0x88, 0x60, 0xC0, 0x7C, 0x86, 0x09, 0xF1, 0x60,
+    0xD6, 0x57, 0x4E, 0x06, 0x86, 0x1F, 0xAC, 0x20, 0xA1, 0x7E, 0x20, 0xD1, 0x00, 0x12, 0xFC, 0xCA,
+    0x01, 0x92, 0x00, 0x0A, 0x06, 0xFC, 0x7F, 0xC7, 0xC7, 0xC0, 0xF0, 0xEE, 0x5F, 0x3C, 0x43, 0x42,
+    0xDA, 0x34, 0x7E, 0x06, 0x86, 0xF9, 0x69, 0x69, 0x20, 0x85, 0x40, 0x16, 0x44, 0xEF, 0x40, 0xB1,
+    0x1C, 0xE0, 0x2C, 0x85, 0xFF, 0xFF, 0xFF, 0xEB, 0x43, 0xFC, 0x16, 0x14, 0x1A, 0xCA, 0x04, 0xA4,
+    0x00, 0xE7, 0xB4, 0x22, 0x0C, 0x78, 0x9C, 0x63, 0x60, 0x80, 0x80, 0x04, 0x06, 0x24, 0x70, 0x81,
+    0x03, 0x99, 0xD3, 0x8F, 0xCC, 0xF9, 0xC3, 0x8E, 0xC4, 0x09, 0xAF, 0x67, 0x60, 0xD8, 0x7C, 0x06,
+    0x02, 0xFE, 0xB0, 0x7F, 0x63, 0x67, 0xD8, 0xD3, 0x01, 0x05, 0xCC, 0x09, 0xF5, 0x0C, 0xB5, 0x08,
+    0x95, 0xDF, 0xD8, 0x91, 0x38, 0x09, 0xF5, 0x48, 0x9C, 0x05, 0xFE, 0x48, 0x9C, 0x5F, 0x2C, 0xAF,
+    0xA1, 0xA6, 0x9D, 0x61, 0x5D, 0xE0, 0xCF, 0x50, 0x58, 0x0E, 0x01, 0xCF, 0xD9, 0x7F, 0xB2, 0x20,
+    0x2C, 0x9D, 0xEE, 0x8F, 0xE4, 0x82, 0x7F, 0x2C, 0x48, 0x1C, 0x24, 0x09, 0x86, 0x0B, 0x48, 0x12,
+    0x0C, 0x06, 0x20, 0x02, 0x00, 0x2D, 0xEA, 0x2D, 0x7A, 0x78, 0x9C, 0x63, 0x60, 0x60, 0xB8, 0xFD,
+    0xEE, 0x1E, 0x37, 0x03, 0x08, 0x38, 0xE4, 0xA7, 0xA5, 0xF9, 0x83, 0x59, 0x01, 0xFC, 0x0C, 0x0C,
+    0xF1, 0x83, 0x82, 0xB5, 0xE1, 0xFF, 0x7F, 0x20, 0xEB, 0xFF, 0xFF, 0xFD, 0x0C, 0x0C, 0xBF, 0x23,
+    0x58, 0x19, 0x18, 0x42, 0x7F, 0x00, 0xDD, 0xBA, 0x41, 0x0F, 0x28, 0xA3, 0xB0, 0x0F, 0xA4, 0xEE,
+    0x35, 0x13, 0x03, 0xC3, 0x23, 0xB0, 0xF3, 0x81, 0x82, 0x10, 0x21, 0xA0, 0x20, 0x33, 0x44, 0x08,
+    0x28, 0x18, 0x07, 0x15, 0x02, 0x6A, 0xE7, 0x86, 0xB1, 0x0A, 0xC0, 0x24, 0x00, 0x18, 0x1F, 0x21,
+    0x7A, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x10, 0x60, 0x80, 0x81, 0x2F, 0x2C, 0x50, 0x86, 0xC3,
+    0x7D, 0x7F, 0x98, 0x10, 0xE7, 0x4F, 0x88, 0x60, 0xC0, 0x7C, 0x86, 0x09, 0xF1, 0x60, 0xD6, 0x57,
+    0x4E, 0x06, 0x86, 0x1F, 0xAC, 0x20, 0xA1, 0x7E, 0x20, 0xD1, 0x00, 0x12, 0xFC, 0xCA, 0x01, 0x92,
+    0x00, 0x0A, 0x06, 0xFC, 0x7F, 0xC7, 0xC7, 0xC0, 0xF0, 0xEE, 0x5F, 0x3C, 0x43, 0x42, 0xDA, 0x34,
+    0x7E, 0x06, 0x86, 0xF9, 0x69, 0x69, 0x20, 0x85, 0x40, 0x16, 0x44, 0x2F, 0x19, 0xAC, 0xF5, 0xAB,
+    0x56, 0x41, 0x58, 0x0A, 0x33, 0x67, 0xCE, 0xD4, 0x64, 0xC0, 0x05, 0x14, 0x3A, 0x3A, 0x3A, 0x34,
+    0x20, 0x3A, 0xF6, 0xEF, 0xDE, 0x8D, 0x6E, 0x8A, 0x03, 0x9C, 0xA5, 0xF0, 0xFF, 0xFF, 0x7F, 0x7D,
+    0x88, 0x96, 0xA0, 0xD0, 0x50, 0x26, 0x20, 0x05, 0x00, 0x4F, 0x1B, 0x27, 0x22, 0x78, 0x9C, 0x65,
+    0xD0, 0xBD, 0x0D, 0x02, 0x31, 0x0C, 0x05, 0xE0, 0xC7, 0x71, 0x8A, 0x72, 0x90, 0x82, 0x1E, 0x56,
+    0x60, 0x05, 0x74, 0x25, 0x1D, 0x15, 0xF5, 0xAD, 0xC0, 0x06, 0xDC, 0x06, 0x61, 0x00, 0x76, 0x60,
+    0x04, 0x16, 0x40, 0xBA, 0x11, 0x60, 0x03, 0x7E, 0x44, 0x71, 0x54, 0x26, 0xB1, 0xAD, 0x28, 0x52,
+    0x5C, 0x44, 0xCA, 0x17, 0x2B, 0x7E, 0xF2, 0xE1, 0x96, 0xD5, 0x12, 0xB1, 0x5E, 0x94, 0xD5, 0x7D,
+    0x12, 0xE9, 0x9D, 0x13, 0xAD, 0x4B, 0x7A, 0x56, 0x4A, 0xC3, 0x18, 0x8E, 0x33, 0xDB, 0x46, 0xC9,
+    0xF5, 0x81, 0xF1, 0x63, 0x9B, 0x0A, 0x59, 0x8C, 0xE4, 0xF0, 0x65, 0xDA, 0x09, 0x79, 0xF4, 0x03,
+    0x5A, 0xFD, 0xAE, 0x96, 0xEF, 0x2D, 0x8C, 0x36, 0x11, 0x75, 0x42, 0x1E, 0xA9, 0x89, 0xC8, 0x48,
+    0x08, 0x83, 0x4F, 0xA2, 0x8E, 0x69, 0x00, 0x4E, 0x89, 0x56, 0x4C, 0x0E, 0x95, 0x66, 0x88, 0xCF,
+    0x1C, 0x15, 0xAD, 0x4F, 0x6D, 0x73, 0x89, 0x1A, 0xC6, 0x59, 0x6D, 0xBB, 0x4A, 0xAE, 0xA6, 0x8D,
+    0x43, 0x25, 0xC5, 0x4C, 0xA3, 0xC6, 0xDB, 0x96, 0xE5, 0x52, 0x6C, 0x82, 0x9A, 0x82, 0x7C, 0xB9,
+    0x2F, 0x1B, 0xE9, 0x91, 0xCB, 0x91, 0x77, 0xBF, 0xD8, 0x67, 0x55, 0x33, 0xFD, 0x01, 0xDF, 0xDA,
+    0x24, 0xC2, 0x78, 0x9C, 0x2B, 0x38, 0x83, 0x02, 0x38, 0x3F, 0xFC, 0x47, 0x01, 0xF6, 0x1F, 0x51,
+    0xF9, 0xFE, 0x58, 0xF9, 0xF9, 0xFF, 0x80, 0xC4, 0x33, 0x04, 0x9F, 0xF5, 0x11, 0x90, 0x65, 0x00,
+    0xE7, 0xBF, 0x67, 0x54, 0xF8, 0xF7, 0x9F, 0x85, 0xE1, 0x0F, 0x5C, 0x5E, 0x96, 0xE1, 0x91, 0x3F,
+    0xC3, 0x06, 0x84, 0xFA, 0xFB, 0x8C, 0x0A, 0x10, 0x69, 0x98, 0xF9, 0xB2, 0x0C, 0x0C, 0x07, 0x90,
+    0xED, 0xBB, 0xCF, 0xC0, 0xF0, 0x0B, 0x99, 0xEF, 0xCF, 0xC0, 0xF0, 0x08, 0x99, 0xCF, 0xC2, 0x00,
+    0xB2, 0x02, 0xCE, 0xF7, 0x67, 0x38, 0x20, 0x0B, 0x51, 0x00, 0xE1, 0x03, 0x0D, 0xBF, 0x0F, 0x51,
+    0x00, 0x75, 0xCF, 0x01, 0x90, 0x15, 0x08, 0xF7, 0xE8, 0x02, 0x99, 0xF7, 0x0F, 0xE1, 0xF6, 0x1F,
+    0x6E, 0xBE, 0xFD, 0x03, 0x54, 0xBE, 0xBC, 0x40, 0x28, 0x0A, 0x60, 0x02, 0x00, 0xA7, 0xF6, 0x18,
+    0x9F, 0x78, 0x9C, 0xDB, 0x78, 0x06, 0x0D, 0xD4, 0x30, 0x7C, 0xBF, 0xFF, 0xF6, 0xFF, 0xDD, 0x7F,
+    0xF7, 0xEF, 0xFE, 0xBF, 0xF7, 0x17, 0x4C, 0xBF, 0xFD, 0xCF, 0xF0, 0x83, 0x2D, 0x60, 0x3D, 0xC3,
+    0x47, 0x3E, 0x86, 0xBF, 0xCC, 0x13, 0xEA, 0x19, 0xBE, 0x72, 0x33, 0x38, 0xFC, 0x67, 0xFC, 0xC1,
+    0xE6, 0xB0, 0x9E, 0xE1, 0x03, 0x1F, 0xC3, 0x1F, 0xA6, 0x86, 0x7C, 0x86, 0x2F, 0x5C, 0x10, 0x21,
+    0x90, 0x2A, 0x7E, 0xB8, 0xAA, 0x00, 0xA0, 0xD0, 0xFB, 0x7F, 0xFF, 0xDF, 0xFD, 0x7B, 0xFF, 0xEE,
+    0x3F, 0x88, 0xFE, 0xFF, 0xFE, 0xDD, 0x3F, 0x90, 0xD0, 0xAA, 0x3F, 0xEB, 0x57, 0xFD, 0x5F, 0xFD,
+    0xEA, 0xFE, 0xAA, 0xBF, 0xEB, 0x4E, 0xFD, 0x5F, 0x75, 0x0B, 0x28, 0x34, 0x9F, 0xE1, 0x23, 0x2F,
+    0xC3, 0x5F, 0xC6, 0x09, 0xF1, 0x0C, 0x5F, 0x39, 0x05, 0xEE, 0x83, 0xCD, 0xC2, 0x22, 0xB4, 0x5E,
+    0xF0, 0x8B, 0x9C, 0xE0, 0x3F, 0xE1, 0x8D, 0xF5, 0x82, 0xDF, 0xA5, 0x1C, 0xDF, 0x33, 0x82, 0x84,
+    0xFE, 0xA3, 0x00, 0x3E, 0xB0, 0xD0, 0xFC, 0x95, 0xFF, 0x67, 0xFD, 0x3C, 0x3F, 0xF3, 0xEF, 0xBC,
+    0x93, 0xFF, 0x67, 0xFE, 0xE2, 0x07, 0x0B, 0x71, 0x33, 0xFC, 0x67, 0xD8, 0x60, 0xCF, 0xF0, 0x9D,
+    0xDD, 0x60, 0x3F, 0xC3, 0x07, 0x9C, 0x42, 0xB2, 0x8A, 0xFF, 0x85, 0x0E, 0xE6, 0x0B, 0xFE, 0x94,
+    0x0A, 0xBC, 0x2F, 0xF8, 0x49, 0xBF, 0x10, 0xC3, 0x78, 0x20, 0x00, 0x0B, 0xE5, 0xA7, 0x41, 0x41,
+    0x1B, 0x5C, 0x88, 0x97, 0x01, 0x0A, 0x04, 0x70, 0x09, 0x7D, 0x07, 0x12, 0x71, 0x2E, 0x50, 0x50,
+    0x02, 0x16, 0xFA, 0x8A, 0x6E, 0xFA, 0x7B, 0x06, 0x83, 0x50, 0x34, 0x20, 0xCA, 0x00, 0x00, 0x2F,
+    0x7B, 0xF4, 0x8C, 0x78, 0x9C, 0x63, 0x60, 0x00, 0x82, 0x80, 0x33, 0x48, 0xC0, 0x1A, 0x24, 0xC2,
+    0xF0, 0xED, 0x3F, 0x12, 0x58, 0x0F, 0x12, 0x49, 0xF8, 0x8F, 0x21, 0xF4, 0x1D, 0x43, 0xA8, 0x01,
+    0xCC, 0xCA, 0x07, 0xE2, 0xF7, 0xDF, 0xA0, 0x42, 0x3F, 0xC1, 0x42, 0xCC, 0x5F, 0xFE, 0xFF, 0xB7,
+    0x73, 0x80, 0x08, 0x4D, 0x00, 0x8B, 0x9C, 0x67, 0x70, 0xF8, 0xFF, 0x9E, 0x59, 0xE0, 0x2F, 0x58,
+    0xE8, 0x17, 0xC4, 0x08, 0x1E, 0x86, 0x2F, 0xF6, 0x0C, 0x17, 0xC1, 0xAA, 0x36, 0x40, 0x4D, 0x05,
+    0x2A, 0x03, 0x2B, 0x02, 0x0A, 0xFD, 0x86, 0xD9, 0x24, 0xC3, 0x00, 0x56, 0xF4, 0x7F, 0xFD, 0x01,
+    0xB8, 0xE5, 0xFB, 0x19, 0x18, 0xFE, 0x80, 0x85, 0x1C, 0xE0, 0x42, 0xF6, 0x0C, 0x0C, 0x5F, 0x20,
+    0xEE, 0xFA, 0x02, 0x13, 0x62, 0x16, 0x60, 0x74, 0x80, 0x08, 0x19, 0xC0, 0x15, 0x5D, 0x94, 0x01,
+    0xCB, 0x03, 0x1D, 0xF1, 0x18, 0xA6, 0xE8, 0xEF, 0x79, 0x46, 0xA8, 0x53, 0x15, 0xFE, 0x81, 0x44,
+    0xEE, 0x33, 0x02, 0xAD, 0x93, 0x81, 0x3A, 0x95, 0xE1, 0x11, 0x58, 0x95, 0x0E, 0x90, 0x77, 0xFE,
+    0x12, 0xD4, 0x8F, 0x10, 0x65, 0xA8, 0x81, 0x73, 0x11, 0x53, 0x08, 0xEC, 0x0F, 0x54, 0x21, 0x86,
+    0x83, 0xC8, 0x42, 0xFD, 0x60, 0x21, 0x86, 0x50, 0x24, 0xC0, 0x02, 0x00, 0x59, 0x99, 0x22, 0xB0,
+    0x78, 0x9C, 0x63, 0x60, 0x80, 0x82, 0x43, 0xEF, 0xDE, 0xD5, 0xC2, 0xD8, 0x0C, 0x37, 0xD3, 0xD2,
+    0x7E, 0xC1, 0x39, 0x3B, 0x19, 0x18, 0xBE, 0x61, 0x70, 0x02, 0x90, 0x39, 0xB3, 0x91, 0x38, 0x1B,
+    0xE6, 0x23, 0x71, 0x5E, 0xCF, 0x45, 0x70, 0x36, 0xE8, 0xCD, 0x41, 0x70, 0x5E, 0x33, 0xBD, 0x39,
+    0x03, 0x04, 0xFB, 0x40, 0x9C, 0x0D, 0x7A, 0x0C, 0x6D, 0x1D, 0x40, 0x90, 0x01, 0xE2, 0xBC, 0x66,
+    0x82, 0x5B, 0xF5, 0x6D, 0x83, 0x3E, 0x03, 0x82, 0xD3, 0x10, 0x8F, 0xC4, 0x61, 0xF8, 0xC1, 0x8A,
+    0xC4, 0x01, 0x4A, 0x9D, 0x3C, 0x03, 0x01, 0x77, 0x19, 0x80, 0x52, 0x67, 0xCA, 0x21, 0x40, 0x9D,
+    0x01, 0x28, 0x35, 0x07, 0xA1, 0x8D, 0xE1, 0xC7, 0x3C, 0x24, 0x4E, 0xC3, 0x7C, 0x24, 0x0E, 0xC3,
+    0x0C, 0x64, 0x8E, 0x02, 0x8C, 0x01, 0x00, 0x42, 0x4E, 0x3C, 0x11, 0x78, 0x9C, 0x13, 0x10, 0x04,
+    0x01, 0x86, 0xCF, 0xFF, 0x41, 0x80, 0x0D, 0x46, 0x9D, 0x9F, 0x39, 0x73, 0x27, 0x90, 0xAA, 0x67,
+    0x60, 0x70, 0xA0, 0x2D, 0x75, 0x7F, 0xF7, 0xEE, 0xD3, 0x08, 0x6B, 0x21, 0x14, 0x00, 0x03, 0x86,
+    0x48, 0x02, 0x78, 0x9C, 0x63, 0x60, 0x10, 0xF8, 0x3F, 0x9F, 0x01, 0x04, 0x26, 0xFC, 0xFF, 0xCF,
+    0x04, 0xA2, 0x3F, 0xED, 0xFF, 0xCF, 0x05, 0xA2, 0x7F, 0xC9, 0xFF, 0xD4, 0x07, 0x52, 0x06, 0xFF,
+    0x39, 0x3E, 0xEE, 0x07, 0xD2, 0x1B, 0xFE, 0x33, 0x4E, 0xF8, 0xCF, 0xCC, 0xC0, 0xF0, 0xA5, 0x1E,
+    0xA8, 0x83, 0x87, 0x81, 0xE1, 0x0F, 0x1F, 0x03, 0xC3, 0x0F, 0x7F, 0x86, 0x80, 0xFF, 0x6C, 0x0C,
+    0x0C, 0x0F, 0xCE, 0x33, 0x5C, 0x78, 0x0F, 0x54, 0x53, 0xF0, 0x9F, 0xF5, 0xC2, 0x7D, 0x20, 0x9D,
+    0xF0, 0x9F, 0x15, 0x26, 0x0E, 0x56, 0xF7, 0xDD, 0x1F, 0xA8, 0x2F, 0x9F, 0x81, 0xE1, 0x1F, 0x50,
+    0xDF, 0x86, 0xF7, 0x40, 0x65, 0xCC, 0x20, 0x73, 0xD9, 0x1F, 0xEC, 0x07, 0xDB, 0xC3, 0xF7, 0x43,
+    0x1F, 0x6C, 0x6F, 0x3F, 0xC4, 0x5E, 0x98, 0x3B, 0x20, 0xEE, 0x02, 0x00, 0x97, 0x37, 0x34, 0x2A,
 };
 // GlyphProps[width, height, advance_x, left, top, compressed_size, data_offset, code_point]
 const GFXglyph FiraSans_Glyphs[] = {
-    {0, 0, 8, 0, 0, 8, 0},            // ' '
-    {5, 20, 7, 1, 20, 47, 8},         // '!'
-    {9, 8, 12, 1, 20, 51, 55},        // '"'
-    {15, 20, 15, 0, 20, 121, 106},    // '#'
-    {15, 30, 15, 0, 25, 146, 227},    // '$'
-    {22, 22, 24, 1, 21, 171, 373},    // '%'
-    {19, 21, 21, 2, 20, 173, 544},    // '&'
-    {4, 8, 6, 1, 20, 25, 717},        // '''
-    {8, 30, 9, 1, 25, 112, 742},      // '('
-    {8, 30, 9, 1, 25, 112, 854},      // ')'
-    {13, 12, 13, 0, 22, 79, 966},     // '*'
-    {12, 11, 15, 1, 16, 33, 1045},    // '+'
-    {5, 9, 7, 1, 4, 36, 1078},        // ','
-    {9, 3, 12, 1, 11, 20, 1114},      // '-'
-    {5, 4, 7, 1, 4, 21, 1134},        // '.'
-    {10, 28, 15, 3, 24, 118, 1155},   // '/'
-    {14, 20, 16, 1, 20, 99, 1273},    // '0'
-    {9, 20, 13, 1, 20, 42, 1372},     // '1'
-    {13, 20, 14, 0, 20, 110, 1414},   // '2'
-    {13, 20, 15, 0, 20, 113, 1524},   // '3'
-    {14, 20, 16, 1, 20, 91, 1637},    // '4'
-    {14, 21, 15, 0, 21, 94, 1728},    // '5'
-    {14, 20, 16, 1, 20, 134, 1822},   // '6'
-    {13, 21, 13, 0, 21, 85, 1956},    // '7'
-    {14, 20, 16, 1, 20, 139, 2041},   // '8'
-    {13, 21, 15, 1, 20, 135, 2180},   // '9'
-    {5, 15, 7, 1, 15, 26, 2315},      // ':'
-    {5, 20, 7, 1, 15, 50, 2341},      // ';'
-    {13, 14, 15, 1, 17, 78, 2391},    // '<'
-    {12, 9, 15, 1, 15, 24, 2469},     // '='
-    {13, 14, 15, 1, 17, 81, 2493},    // '>'
-    {13, 20, 13, 0, 20, 94, 2574},    // '?'
-    {26, 26, 30, 2, 20, 253, 2668},   // '@'
-    {17, 20, 17, 0, 20, 143, 2921},   // 'A'
-    {15, 20, 18, 2, 20, 104, 3064},   // 'B'
-    {15, 20, 16, 1, 20, 102, 3168},   // 'C'
-    {16, 20, 19, 2, 20, 103, 3270},   // 'D'
-    {13, 20, 16, 2, 20, 48, 3373},    // 'E'
-    {12, 20, 14, 2, 20, 41, 3421},    // 'F'
-    {16, 20, 18, 1, 20, 130, 3462},   // 'G'
-    {15, 20, 20, 2, 20, 31, 3592},    // 'H'
-    {4, 20, 9, 2, 20, 13, 3623},      // 'I'
-    {7, 25, 9, 0, 20, 43, 3636},      // 'J'
-    {16, 20, 17, 2, 20, 105, 3679},   // 'K'
-    {12, 20, 15, 2, 20, 28, 3784},    // 'L'
-    {20, 20, 23, 1, 20, 182, 3812},   // 'M'
-    {15, 20, 20, 2, 20, 103, 3994},   // 'N'
-    {18, 20, 20, 1, 20, 121, 4097},   // 'O'
-    {15, 20, 17, 2, 20, 75, 4218},    // 'P'
-    {19, 23, 20, 1, 20, 154, 4293},   // 'Q'
-    {15, 20, 18, 2, 20, 102, 4447},   // 'R'
-    {15, 20, 16, 0, 20, 127, 4549},   // 'S'
-    {15, 20, 15, 0, 20, 34, 4676},    // 'T'
-    {15, 20, 19, 2, 20, 69, 4710},    // 'U'
-    {17, 20, 16, 0, 20, 138, 4779},   // 'V'
-    {24, 20, 24, 0, 20, 199, 4917},   // 'W'
-    {16, 20, 16, 0, 20, 133, 5116},   // 'X'
-    {16, 20, 16, 0, 20, 95, 5249},    // 'Y'
-    {14, 20, 15, 0, 20, 97, 5344},    // 'Z'
-    {7, 28, 9, 1, 25, 28, 5441},      // '['
-    {10, 28, 15, 3, 24, 114, 5469},   // '<backslash>'
-    {7, 28, 9, 1, 25, 28, 5583},      // ']'
-    {14, 10, 16, 1, 26, 72, 5611},    // '^'
-    {15, 3, 15, 0, -1, 19, 5683},     // '_'
-    {8, 6, 9, 0, 24, 32, 5702},       // '`'
-    {14, 17, 16, 1, 16, 103, 5734},   // 'a'
-    {14, 23, 17, 2, 23, 100, 5837},   // 'b'
-    {13, 16, 14, 1, 16, 92, 5937},    // 'c'
-    {14, 23, 17, 1, 23, 106, 6029},   // 'd'
-    {14, 16, 16, 1, 16, 107, 6135},   // 'e'
-    {12, 23, 10, 0, 23, 60, 6242},    // 'f'
-    {16, 24, 15, 0, 18, 171, 6302},   // 'g'
-    {13, 23, 17, 2, 23, 55, 6473},    // 'h'
-    {4, 23, 8, 2, 23, 23, 6528},      // 'i'
-    {7, 29, 8, -1, 23, 54, 6551},     // 'j'
-    {13, 23, 15, 2, 23, 86, 6605},    // 'k'
-    {6, 23, 9, 2, 23, 28, 6691},      // 'l'
-    {21, 16, 25, 2, 16, 80, 6719},    // 'm'
-    {13, 16, 17, 2, 16, 52, 6799},    // 'n'
-    {15, 16, 17, 1, 16, 112, 6851},   // 'o'
-    {14, 22, 17, 2, 16, 107, 6963},   // 'p'
-    {14, 22, 17, 1, 16, 108, 7070},   // 'q'
-    {9, 16, 11, 2, 16, 43, 7178},     // 'r'
-    {13, 16, 14, 0, 16, 109, 7221},   // 's'
-    {11, 20, 11, 0, 20, 55, 7330},    // 't'
-    {13, 16, 17, 2, 16, 54, 7385},    // 'u'
-    {15, 16, 14, 0, 16, 115, 7439},   // 'v'
-    {21, 16, 21, 0, 16, 162, 7554},   // 'w'
-    {14, 16, 14, 0, 16, 113, 7716},   // 'x'
-    {15, 23, 14, 0, 16, 141, 7829},   // 'y'
-    {12, 16, 13, 0, 16, 60, 7970},    // 'z'
-    {9, 29, 9, 0, 25, 79, 8030},      // '{'
-    {4, 27, 12, 4, 24, 13, 8109},     // '|'
-    {8, 29, 9, 1, 25, 74, 8122},      // '}'
-    {13, 4, 14, 1, 11, 37, 8196},     // '~'
-    {0, 0, 8, 0, 0, 8, 8233},         // '┬á'
-    {5, 21, 7, 1, 15, 47, 8241},      // '┬í'
-    {13, 26, 14, 1, 20, 104, 8288},   // '┬ó'
-    {14, 20, 15, 1, 20, 88, 8392},    // '┬ú'
-    {16, 16, 16, 0, 18, 125, 8480},   // '┬ñ'
-    {16, 20, 16, 0, 20, 111, 8605},   // '┬Ñ'
-    {4, 27, 12, 4, 24, 19, 8716},     // '┬ª'
-    {12, 23, 16, 2, 20, 134, 8735},   // '┬º'
-    {11, 3, 11, 0, 22, 23, 8869},     // '┬¿'
-    {19, 19, 24, 2, 23, 176, 8892},   // '┬⌐'
-    {13, 21, 15, 1, 21, 98, 9068},    // '┬¬'
-    {15, 15, 17, 1, 16, 119, 9166},   // '┬½'
-    {12, 7, 15, 1, 11, 24, 9285},     // '┬¼'
-    {9, 3, 12, 1, 11, 20, 9309},      // '┬¡'
-    {16, 16, 19, 1, 22, 135, 9329},   // '┬«'
-    {9, 3, 10, 0, 23, 20, 9464},      // '┬»'
-    {11, 10, 15, 1, 21, 52, 9484},    // '┬░'
-    {12, 17, 15, 1, 17, 43, 9536},    // '┬▒'
-    {10, 13, 12, 1, 22, 72, 9579},    // '┬▓'
-    {10, 13, 12, 1, 22, 72, 9651},    // '┬│'
-    {8, 6, 9, 0, 24, 33, 9723},       // '┬┤'
-    {13, 22, 17, 2, 16, 64, 9756},    // '┬╡'
-    {16, 27, 21, 2, 20, 70, 9820},    // '┬╢'
-    {5, 4, 7, 1, 11, 21, 9890},       // '┬╖'
-    {8, 7, 8, 0, 0, 37, 9911},        // '┬╕'
-    {7, 12, 12, 1, 21, 28, 9948},     // '┬╣'
-    {12, 21, 15, 1, 21, 85, 9976},    // '┬║'
-    {14, 15, 17, 1, 16, 106, 10061},  // '┬╗'
-    {25, 25, 27, 1, 22, 172, 10167},  // '┬╝'
-    {25, 25, 27, 1, 22, 186, 10339},  // '┬╜'
-    {25, 25, 27, 1, 22, 210, 10525},  // '┬╛'
-    {13, 21, 13, 0, 15, 100, 10735},  // '┬┐'
-    {17, 27, 17, 0, 27, 163, 10835},  // '├Ç'
-    {17, 27, 17, 0, 27, 164, 10998},  // '├ü'
-    {17, 27, 17, 0, 27, 170, 11162},  // '├é'
-    {17, 27, 17, 0, 27, 169, 11332},  // '├â'
-    {17, 26, 17, 0, 26, 160, 11501},  // '├ä'
-    {17, 29, 17, 0, 29, 173, 11661},  // '├à'
-    {24, 20, 24, -1, 20, 152, 11834}, // '├å'
-    {15, 28, 16, 1, 20, 148, 11986},  // '├ç'
-    {13, 27, 16, 2, 27, 72, 12134},   // '├ê'
-    {13, 27, 16, 2, 27, 73, 12206},   // '├ë'
-    {13, 27, 16, 2, 27, 82, 12279},   // '├è'
-    {13, 26, 16, 2, 26, 65, 12361},   // '├ï'
-    {8, 27, 9, 0, 27, 35, 12426},     // '├î'
-    {8, 27, 9, 0, 27, 33, 12461},     // '├ì'
-    {11, 27, 9, -1, 27, 46, 12494},   // '├Ä'
-    {11, 26, 9, -1, 26, 30, 12540},   // '├Å'
-    {18, 20, 19, 0, 20, 116, 12570},  // '├É'
-    {15, 27, 20, 2, 27, 132, 12686},  // '├æ'
-    {18, 27, 20, 1, 27, 145, 12818},  // '├Æ'
-    {18, 27, 20, 1, 27, 142, 12963},  // '├ô'
-    {18, 27, 20, 1, 27, 149, 13105},  // '├ö'
-    {18, 27, 20, 1, 27, 143, 13254},  // '├ò'
-    {18, 26, 20, 1, 26, 137, 13397},  // '├û'
-    {11, 12, 15, 2, 15, 67, 13534},   // '├ù'
-    {18, 28, 20, 1, 24, 194, 13601},  // '├ÿ'
-    {15, 27, 19, 2, 27, 90, 13795},   // '├Ö'
-    {15, 27, 19, 2, 27, 94, 13885},   // '├Ü'
-    {15, 27, 19, 2, 27, 98, 13979},   // '├¢'
-    {15, 26, 19, 2, 26, 86, 14077},   // '├£'
-    {16, 27, 16, 0, 27, 121, 14163},  // '├¥'
-    {15, 20, 17, 2, 20, 79, 14284},   // '├₧'
-    {15, 23, 17, 2, 23, 130, 14363},  // '├ƒ'
-    {14, 25, 16, 1, 24, 128, 14493},  // '├á'
-    {14, 25, 16, 1, 24, 132, 14621},  // '├í'
-    {14, 25, 16, 1, 24, 136, 14753},  // '├ó'
-    {14, 24, 16, 1, 23, 129, 14889},  // '├ú'
-    {14, 23, 16, 1, 22, 122, 15018},  // '├ñ'
-    {14, 26, 16, 1, 25, 141, 15140},  // '├Ñ'
-    {23, 16, 25, 1, 16, 161, 15281},  // '├ª'
-    {13, 24, 14, 1, 16, 128, 15442},  // '├º'
-    {14, 24, 16, 1, 24, 131, 15570},  // '├¿'
-    {14, 24, 16, 1, 24, 134, 15701},  // '├⌐'
-    {14, 24, 16, 1, 24, 136, 15835},  // '├¬'
-    {14, 22, 16, 1, 22, 123, 15971},  // '├½'
-    {8, 24, 8, 0, 24, 39, 16094},     // '├¼'
-    {8, 24, 8, 0, 24, 36, 16133},     // '├¡'
-    {10, 24, 8, -1, 24, 42, 16169},   // '├«'
-    {10, 22, 8, -1, 22, 29, 16211},   // '├»'
-    {14, 24, 17, 1, 24, 153, 16240},  // '├░'
-    {13, 23, 17, 2, 23, 81, 16393},   // '├▒'
-    {15, 24, 17, 1, 24, 136, 16474},  // '├▓'
-    {15, 24, 17, 1, 24, 135, 16610},  // '├│'
-    {15, 24, 17, 1, 24, 140, 16745},  // '├┤'
-    {15, 23, 17, 1, 23, 133, 16885},  // '├╡'
-    {15, 22, 17, 1, 22, 127, 17018},  // '├╢'
-    {12, 18, 15, 1, 19, 41, 17145},   // '├╖'
-    {15, 24, 17, 1, 20, 163, 17186},  // '├╕'
-    {13, 24, 17, 2, 24, 82, 17349},   // '├╣'
-    {13, 24, 17, 2, 24, 85, 17431},   // '├║'
-    {13, 24, 17, 2, 24, 88, 17516},   // '├╗'
-    {13, 22, 17, 2, 22, 72, 17604},   // '├╝'
-    {15, 31, 14, 0, 24, 169, 17676},  // '├╜'
-    {14, 29, 17, 2, 23, 105, 17845},  // '├╛'
-    {15, 29, 14, 0, 22, 162, 17950},  // '├┐'
-    {16, 3, 16, 0, 12, 19, 18112},    // 'ΓÇÆ'
-    {15, 3, 15, 0, 11, 19, 18131},    // 'ΓÇô'
-    {23, 3, 23, 0, 11, 19, 18150},    // 'ΓÇö'
-    {15, 3, 15, 0, 11, 19, 18169},    // 'ΓÇò'
-    {9, 27, 17, 4, 24, 16, 18188},    // 'ΓÇû'
-    {5, 8, 7, 1, 23, 33, 18204},      // 'ΓÇÿ'
-    {5, 8, 7, 1, 22, 33, 18237},      // 'ΓÇÖ'
-    {5, 8, 7, 1, 3, 33, 18270},       // 'ΓÇÜ'
-    {10, 8, 12, 1, 23, 51, 18303},    // 'ΓÇ£'
-    {10, 8, 12, 1, 22, 51, 18354},    // 'ΓÇ¥'
-    {10, 8, 12, 1, 3, 51, 18405},     // 'ΓÇ₧'
-    {13, 20, 15, 1, 20, 34, 18456},   // 'ΓÇá'
-    {13, 20, 15, 1, 20, 35, 18490},   // 'ΓÇí'
-    {7, 7, 9, 1, 14, 35, 18525},      // 'ΓÇó'
-    {20, 4, 22, 1, 4, 36, 18560},     // 'ΓÇª'
-    {33, 22, 35, 1, 21, 230, 18596},  // 'ΓÇ░'
-    {8, 15, 10, 1, 16, 71, 18826},    // 'ΓÇ╣'
-    {8, 15, 10, 1, 16, 69, 18897},    // 'ΓÇ║'
-    {20, 6, 20, 0, 0, 59, 18966},     // 'ΓÇ┐'
-    {14, 25, 4, -5, 22, 87, 19025},   // 'Γüä'
-    {13, 22, 15, 1, 16, 97, 19112},   // 'Γüè'
-    {20, 19, 26, 3, 19, 98, 19209},   // 'ΓåÉ'
-    {19, 20, 26, 4, 20, 98, 19307},   // 'Γåæ'
-    {20, 19, 26, 3, 19, 96, 19405},   // 'ΓåÆ'
-    {19, 21, 26, 4, 19, 97, 19501},   // 'Γåô'
-    {26, 18, 28, 1, 18, 101, 19598},  // 'Γçª'
-    {19, 26, 21, 1, 25, 98, 19699},   // 'Γçº'
-    {26, 18, 28, 1, 18, 100, 19797},  // 'Γç¿'
-    {19, 25, 21, 1, 22, 88, 19897},   // 'Γç⌐'
-    {19, 26, 21, 1, 25, 124, 19985},  // 'Γç¬'
-    {38, 22, 41, 2, 21, 181, 20109},  // 'Γîª'
-    {32, 22, 36, 2, 21, 127, 20290},  // 'Γîº'
-    {37, 22, 43, 3, 21, 242, 20417},  // 'Γî¿'
-    {38, 22, 43, 2, 21, 189, 20659},  // 'Γî½'
-    {26, 22, 29, 0, 22, 123, 20848},  // 'ΓÅÄ'
-    {13, 21, 17, 2, 21, 39, 20971},   // 'Γû»'
-    {15, 20, 15, 0, 20, 126, 21010},  // 'Γùè'
+    { 0, 0, 8, 0, 0, 8, 0 }, // ' '
+    { 5, 20, 7, 1, 20, 47, 8 }, // '!'
+    { 9, 8, 12, 1, 20, 51, 55 }, // '"'
+    { 15, 20, 15, 0, 20, 121, 106 }, // '#'
+    { 15, 30, 15, 0, 25, 146, 227 }, // '$'
+    { 22, 22, 24, 1, 21, 171, 373 }, // '%'
+    { 19, 21, 21, 2, 20, 173, 544 }, // '&'
+    { 4, 8, 6, 1, 20, 25, 717 }, // '''
+    { 8, 30, 9, 1, 25, 112, 742 }, // '('
+    { 8, 30, 9, 1, 25, 112, 854 }, // ')'
+    { 13, 12, 13, 0, 22, 79, 966 }, // '*'
+    { 12, 11, 15, 1, 16, 33, 1045 }, // '+'
+    { 5, 9, 7, 1, 4, 36, 1078 }, // ','
+    { 9, 3, 12, 1, 11, 20, 1114 }, // '-'
+    { 5, 4, 7, 1, 4, 21, 1134 }, // '.'
+    { 10, 28, 15, 3, 24, 118, 1155 }, // '/'
+    { 14, 20, 16, 1, 20, 99, 1273 }, // '0'
+    { 9, 20, 13, 1, 20, 42, 1372 }, // '1'
+    { 13, 20, 14, 0, 20, 110, 1414 }, // '2'
+    { 13, 20, 15, 0, 20, 113, 1524 }, // '3'
+    { 14, 20, 16, 1, 20, 91, 1637 }, // '4'
+    { 14, 21, 15, 0, 21, 94, 1728 }, // '5'
+    { 14, 20, 16, 1, 20, 134, 1822 }, // '6'
+    { 13, 21, 13, 0, 21, 85, 1956 }, // '7'
+    { 14, 20, 16, 1, 20, 139, 2041 }, // '8'
+    { 13, 21, 15, 1, 20, 135, 2180 }, // '9'
+    { 5, 15, 7, 1, 15, 26, 2315 }, // ':'
+    { 5, 20, 7, 1, 15, 50, 2341 }, // ';'
+    { 13, 14, 15, 1, 17, 78, 2391 }, // '<'
+    { 12, 9, 15, 1, 15, 24, 2469 }, // '='
+    { 13, 14, 15, 1, 17, 81, 2493 }, // '>'
+    { 13, 20, 13, 0, 20, 94, 2574 }, // '?'
+    { 26, 26, 30, 2, 20, 253, 2668 }, // '@'
+    { 17, 20, 17, 0, 20, 143, 2921 }, // 'A'
+    { 15, 20, 18, 2, 20, 104, 3064 }, // 'B'
+    { 15, 20, 16, 1, 20, 102, 3168 }, // 'C'
+    { 16, 20, 19, 2, 20, 103, 3270 }, // 'D'
+    { 13, 20, 16, 2, 20, 48, 3373 }, // 'E'
+    { 12, 20, 14, 2, 20, 41, 3421 }, // 'F'
+    { 16, 20, 18, 1, 20, 130, 3462 }, // 'G'
+    { 15, 20, 20, 2, 20, 31, 3592 }, // 'H'
+    { 4, 20, 9, 2, 20, 13, 3623 }, // 'I'
+    { 7, 25, 9, 0, 20, 43, 3636 }, // 'J'
+    { 16, 20, 17, 2, 20, 105, 3679 }, // 'K'
+    { 12, 20, 15, 2, 20, 28, 3784 }, // 'L'
+    { 20, 20, 23, 1, 20, 182, 3812 }, // 'M'
+    { 15, 20, 20, 2, 20, 103, 3994 }, // 'N'
+    { 18, 20, 20, 1, 20, 121, 4097 }, // 'O'
+    { 15, 20, 17, 2, 20, 75, 4218 }, // 'P'
+    { 19, 23, 20, 1, 20, 154, 4293 }, // 'Q'
+    { 15, 20, 18, 2, 20, 102, 4447 }, // 'R'
+    { 15, 20, 16, 0, 20, 127, 4549 }, // 'S'
+    { 15, 20, 15, 0, 20, 34, 4676 }, // 'T'
+    { 15, 20, 19, 2, 20, 69, 4710 }, // 'U'
+    { 17, 20, 16, 0, 20, 138, 4779 }, // 'V'
+    { 24, 20, 24, 0, 20, 199, 4917 }, // 'W'
+    { 16, 20, 16, 0, 20, 133, 5116 }, // 'X'
+    { 16, 20, 16, 0, 20, 95, 5249 }, // 'Y'
+    { 14, 20, 15, 0, 20, 97, 5344 }, // 'Z'
+    { 7, 28, 9, 1, 25, 28, 5441 }, // '['
+    { 10, 28, 15, 3, 24, 114, 5469 }, // '<backslash>'
+    { 7, 28, 9, 1, 25, 28, 5583 }, // ']'
+    { 14, 10, 16, 1, 26, 72, 5611 }, // '^'
+    { 15, 3, 15, 0, -1, 19, 5683 }, // '_'
+    { 8, 6, 9, 0, 24, 32, 5702 }, // '`'
+    { 14, 17, 16, 1, 16, 103, 5734 }, // 'a'
+    { 14, 23, 17, 2, 23, 100, 5837 }, // 'b'
+    { 13, 16, 14, 1, 16, 92, 5937 }, // 'c'
+    { 14, 23, 17, 1, 23, 106, 6029 }, // 'd'
+    { 14, 16, 16, 1, 16, 107, 6135 }, // 'e'
+    { 12, 23, 10, 0, 23, 60, 6242 }, // 'f'
+    { 16, 24, 15, 0, 18, 171, 6302 }, // 'g'
+    { 13, 23, 17, 2, 23, 55, 6473 }, // 'h'
+    { 4, 23, 8, 2, 23, 23, 6528 }, // 'i'
+    { 7, 29, 8, -1, 23, 54, 6551 }, // 'j'
+    { 13, 23, 15, 2, 23, 86, 6605 }, // 'k'
+    { 6, 23, 9, 2, 23, 28, 6691 }, // 'l'
+    { 21, 16, 25, 2, 16, 80, 6719 }, // 'm'
+    { 13, 16, 17, 2, 16, 52, 6799 }, // 'n'
+    { 15, 16, 17, 1, 16, 112, 6851 }, // 'o'
+    { 14, 22, 17, 2, 16, 107, 6963 }, // 'p'
+    { 14, 22, 17, 1, 16, 108, 7070 }, // 'q'
+    { 9, 16, 11, 2, 16, 43, 7178 }, // 'r'
+    { 13, 16, 14, 0, 16, 109, 7221 }, // 's'
+    { 11, 20, 11, 0, 20, 55, 7330 }, // 't'
+    { 13, 16, 17, 2, 16, 54, 7385 }, // 'u'
+    { 15, 16, 14, 0, 16, 115, 7439 }, // 'v'
+    { 21, 16, 21, 0, 16, 162, 7554 }, // 'w'
+    { 14, 16, 14, 0, 16, 113, 7716 }, // 'x'
+    { 15, 23, 14, 0, 16, 141, 7829 }, // 'y'
+    { 12, 16, 13, 0, 16, 60, 7970 }, // 'z'
+    { 9, 29, 9, 0, 25, 79, 8030 }, // '{'
+    { 4, 27, 12, 4, 24, 13, 8109 }, // '|'
+    { 8, 29, 9, 1, 25, 74, 8122 }, // '}'
+    { 13, 4, 14, 1, 11, 37, 8196 }, // '~'
+    { 0, 0, 8, 0, 0, 8, 8233 }, // ' '
+    { 5, 21, 7, 1, 15, 47, 8241 }, // '¡'
+    { 13, 26, 14, 1, 20, 104, 8288 }, // '¢'
+    { 14, 20, 15, 1, 20, 88, 8392 }, // '£'
+    { 16, 16, 16, 0, 18, 125, 8480 }, // '¤'
+    { 16, 20, 16, 0, 20, 111, 8605 }, // '¥'
+    { 4, 27, 12, 4, 24, 19, 8716 }, // '¦'
+    { 12, 23, 16, 2, 20, 134, 8735 }, // '§'
+    { 11, 3, 11, 0, 22, 23, 8869 }, // '¨'
+    { 19, 19, 24, 2, 23, 176, 8892 }, // '©'
+    { 13, 21, 15, 1, 21, 98, 9068 }, // 'ª'
+    { 15, 15, 17, 1, 16, 119, 9166 }, // '«'
+    { 12, 7, 15, 1, 11, 24, 9285 }, // '¬'
+    { 9, 3, 12, 1, 11, 20, 9309 }, // '­'
+    { 16, 16, 19, 1, 22, 135, 9329 }, // '®'
+    { 9, 3, 10, 0, 23, 20, 9464 }, // '¯'
+    { 11, 10, 15, 1, 21, 52, 9484 }, // '°'
+    { 12, 17, 15, 1, 17, 43, 9536 }, // '±'
+    { 10, 13, 12, 1, 22, 72, 9579 }, // '²'
+    { 10, 13, 12, 1, 22, 72, 9651 }, // '³'
+    { 8, 6, 9, 0, 24, 33, 9723 }, // '´'
+    { 13, 22, 17, 2, 16, 64, 9756 }, // 'µ'
+    { 16, 27, 21, 2, 20, 70, 9820 }, // '¶'
+    { 5, 4, 7, 1, 11, 21, 9890 }, // '·'
+    { 8, 7, 8, 0, 0, 37, 9911 }, // '¸'
+    { 7, 12, 12, 1, 21, 28, 9948 }, // '¹'
+    { 12, 21, 15, 1, 21, 85, 9976 }, // 'º'
+    { 14, 15, 17, 1, 16, 106, 10061 }, // '»'
+    { 25, 25, 27, 1, 22, 172, 10167 }, // '¼'
+    { 25, 25, 27, 1, 22, 186, 10339 }, // '½'
+    { 25, 25, 27, 1, 22, 210, 10525 }, // '¾'
+    { 13, 21, 13, 0, 15, 100, 10735 }, // '¿'
+    { 17, 27, 17, 0, 27, 163, 10835 }, // 'À'
+    { 17, 27, 17, 0, 27, 164, 10998 }, // 'Á'
+    { 17, 27, 17, 0, 27, 170, 11162 }, // 'Â'
+    { 17, 27, 17, 0, 27, 169, 11332 }, // 'Ã'
+    { 17, 26, 17, 0, 26, 160, 11501 }, // 'Ä'
+    { 17, 29, 17, 0, 29, 173, 11661 }, // 'Å'
+    { 24, 20, 24, -1, 20, 152, 11834 }, // 'Æ'
+    { 15, 28, 16, 1, 20, 148, 11986 }, // 'Ç'
+    { 13, 27, 16, 2, 27, 72, 12134 }, // 'È'
+    { 13, 27, 16, 2, 27, 73, 12206 }, // 'É'
+    { 13, 27, 16, 2, 27, 82, 12279 }, // 'Ê'
+    { 13, 26, 16, 2, 26, 65, 12361 }, // 'Ë'
+    { 8, 27, 9, 0, 27, 35, 12426 }, // 'Ì'
+    { 8, 27, 9, 0, 27, 33, 12461 }, // 'Í'
+    { 11, 27, 9, -1, 27, 46, 12494 }, // 'Î'
+    { 11, 26, 9, -1, 26, 30, 12540 }, // 'Ï'
+    { 18, 20, 19, 0, 20, 116, 12570 }, // 'Ð'
+    { 15, 27, 20, 2, 27, 132, 12686 }, // 'Ñ'
+    { 18, 27, 20, 1, 27, 145, 12818 }, // 'Ò'
+    { 18, 27, 20, 1, 27, 142, 12963 }, // 'Ó'
+    { 18, 27, 20, 1, 27, 149, 13105 }, // 'Ô'
+    { 18, 27, 20, 1, 27, 143, 13254 }, // 'Õ'
+    { 18, 26, 20, 1, 26, 137, 13397 }, // 'Ö'
+    { 11, 12, 15, 2, 15, 67, 13534 }, // '×'
+    { 18, 28, 20, 1, 24, 194, 13601 }, // 'Ø'
+    { 15, 27, 19, 2, 27, 90, 13795 }, // 'Ù'
+    { 15, 27, 19, 2, 27, 94, 13885 }, // 'Ú'
+    { 15, 27, 19, 2, 27, 98, 13979 }, // 'Û'
+    { 15, 26, 19, 2, 26, 86, 14077 }, // 'Ü'
+    { 16, 27, 16, 0, 27, 121, 14163 }, // 'Ý'
+    { 15, 20, 17, 2, 20, 79, 14284 }, // 'Þ'
+    { 15, 23, 17, 2, 23, 130, 14363 }, // 'ß'
+    { 14, 25, 16, 1, 24, 128, 14493 }, // 'à'
+    { 14, 25, 16, 1, 24, 132, 14621 }, // 'á'
+    { 14, 25, 16, 1, 24, 136, 14753 }, // 'â'
+    { 14, 24, 16, 1, 23, 129, 14889 }, // 'ã'
+    { 14, 23, 16, 1, 22, 122, 15018 }, // 'ä'
+    { 14, 26, 16, 1, 25, 141, 15140 }, // 'å'
+    { 23, 16, 25, 1, 16, 161, 15281 }, // 'æ'
+    { 13, 24, 14, 1, 16, 128, 15442 }, // 'ç'
+    { 14, 24, 16, 1, 24, 131, 15570 }, // 'è'
+    { 14, 24, 16, 1, 24, 134, 15701 }, // 'é'
+    { 14, 24, 16, 1, 24, 136, 15835 }, // 'ê'
+    { 14, 22, 16, 1, 22, 123, 15971 }, // 'ë'
+    { 8, 24, 8, 0, 24, 39, 16094 }, // 'ì'
+    { 8, 24, 8, 0, 24, 36, 16133 }, // 'í'
+    { 10, 24, 8, -1, 24, 42, 16169 }, // 'î'
+    { 10, 22, 8, -1, 22, 29, 16211 }, // 'ï'
+    { 14, 24, 17, 1, 24, 153, 16240 }, // 'ð'
+    { 13, 23, 17, 2, 23, 81, 16393 }, // 'ñ'
+    { 15, 24, 17, 1, 24, 136, 16474 }, // 'ò'
+    { 15, 24, 17, 1, 24, 135, 16610 }, // 'ó'
+    { 15, 24, 17, 1, 24, 140, 16745 }, // 'ô'
+    { 15, 23, 17, 1, 23, 133, 16885 }, // 'õ'
+    { 15, 22, 17, 1, 22, 127, 17018 }, // 'ö'
+    { 12, 18, 15, 1, 19, 41, 17145 }, // '÷'
+    { 15, 24, 17, 1, 20, 163, 17186 }, // 'ø'
+    { 13, 24, 17, 2, 24, 82, 17349 }, // 'ù'
+    { 13, 24, 17, 2, 24, 85, 17431 }, // 'ú'
+    { 13, 24, 17, 2, 24, 88, 17516 }, // 'û'
+    { 13, 22, 17, 2, 22, 72, 17604 }, // 'ü'
+    { 15, 31, 14, 0, 24, 169, 17676 }, // 'ý'
+    { 14, 29, 17, 2, 23, 105, 17845 }, // 'þ'
+    { 15, 29, 14, 0, 22, 162, 17950 }, // 'ÿ'
+    { 16, 3, 16, 0, 12, 19, 18112 }, // '‒'
+    { 15, 3, 15, 0, 11, 19, 18131 }, // '–'
+    { 23, 3, 23, 0, 11, 19, 18150 }, // '—'
+    { 15, 3, 15, 0, 11, 19, 18169 }, // '―'
+    { 9, 27, 17, 4, 24, 16, 18188 }, // '‖'
+    { 5, 8, 7, 1, 23, 33, 18204 }, // '‘'
+    { 5, 8, 7, 1, 22, 33, 18237 }, // '’'
+    { 5, 8, 7, 1, 3, 33, 18270 }, // '‚'
+    { 10, 8, 12, 1, 23, 51, 18303 }, // '“'
+    { 10, 8, 12, 1, 22, 51, 18354 }, // '”'
+    { 10, 8, 12, 1, 3, 51, 18405 }, // '„'
+    { 13, 20, 15, 1, 20, 34, 18456 }, // '†'
+    { 13, 20, 15, 1, 20, 35, 18490 }, // '‡'
+    { 7, 7, 9, 1, 14, 35, 18525 }, // '•'
+    { 20, 4, 22, 1, 4, 36, 18560 }, // '…'
+    { 33, 22, 35, 1, 21, 230, 18596 }, // '‰'
+    { 8, 15, 10, 1, 16, 71, 18826 }, // '‹'
+    { 8, 15, 10, 1, 16, 69, 18897 }, // '›'
+    { 20, 6, 20, 0, 0, 59, 18966 }, // '‿'
+    { 14, 25, 4, -5, 22, 87, 19025 }, // '⁄'
+    { 13, 22, 15, 1, 16, 97, 19112 }, // '⁊'
+    { 20, 19, 26, 3, 19, 98, 19209 }, // '←'
+    { 19, 20, 26, 4, 20, 98, 19307 }, // '↑'
+    { 20, 19, 26, 3, 19, 96, 19405 }, // '→'
+    { 19, 21, 26, 4, 19, 97, 19501 }, // '↓'
+    { 26, 18, 28, 1, 18, 101, 19598 }, // '⇦'
+    { 19, 26, 21, 1, 25, 98, 19699 }, // '⇧'
+    { 26, 18, 28, 1, 18, 100, 19797 }, // '⇨'
+    { 19, 25, 21, 1, 22, 88, 19897 }, // '⇩'
+    { 19, 26, 21, 1, 25, 124, 19985 }, // '⇪'
+    { 38, 22, 41, 2, 21, 181, 20109 }, // '⌦'
+    { 32, 22, 36, 2, 21, 127, 20290 }, // '⌧'
+    { 37, 22, 43, 3, 21, 242, 20417 }, // '⌨'
+    { 38, 22, 43, 2, 21, 189, 20659 }, // '⌫'
+    { 26, 22, 29, 0, 22, 123, 20848 }, // '⏎'
+    { 13, 21, 17, 2, 21, 39, 20971 }, // '▯'
+    { 15, 20, 15, 0, 20, 126, 21010 }, // '◊'
 };
-const UnicodeInterval FiraSans_Intervals[] = {
-    {0x20, 0x7E, 0x0},
-    {0xA0, 0xFF, 0x5F},
-    {0x2010, 0x205F, 0xBF},
-    {0x2190, 0x21FF, 0x10F},
-    {0x2300, 0x23FF, 0x17F},
-    {0x25A0, 0x25FF, 0x27F},
-    {0x2600, 0x26F0, 0x2DF},
-    {0x2700, 0x27BF, 0x3D0},
+const KerningPair FiraSans_Kerning[] = {
+    { 1, 31, -1 },
+    { 2, 3, -1 },
+    { 2, 12, -3 },
+    { 2, 14, -3 },
+    { 2, 15, -3 },
+    { 2, 20, -1 },
+    { 2, 32, -1 },
+    { 2, 33, -1 },
+    { 2, 42, -1 },
+    { 2, 63, -3 },
+    { 2, 98, -1 },
+    { 2, 106, -1 },
+    { 2, 126, -3 },
+    { 2, 127, -1 },
+    { 2, 128, -1 },
+    { 2, 129, -1 },
+    { 2, 130, -1 },
+    { 2, 131, -1 },
+    { 2, 132, -1 },
+    { 2, 133, -2 },
+    { 2, 171, 1 },
+    { 2, 172, 1 },
+    { 2, 173, 1 },
+    { 2, 174, 1 },
+    { 2, 198, -3 },
+    { 2, 201, -3 },
+    { 2, 202, 1 },
+    { 2, 205, -3 },
+    { 2, 207, -1 },
+    { 2, 209, -3 },
+    { 2, 211, 1 },
+    { 3, 6, -1 },
+    { 3, 10, 1 },
+    { 3, 31, -1 },
+    { 3, 60, -1 },
+    { 3, 63, -2 },
+    { 3, 65, -1 },
+    { 3, 109, 1 },
+    { 3, 133, -1 },
+    { 3, 159, -1 },
+    { 3, 160, -1 },
+    { 3, 161, -1 },
+    { 3, 162, -1 },
+    { 3, 163, -1 },
+    { 3, 164, -1 },
+    { 3, 165, -1 },
+    { 3, 171, 1 },
+    { 3, 172, 1 },
+    { 3, 173, 1 },
+    { 3, 174, 1 },
+    { 3, 204, -1 },
+    { 3, 209, -2 },
+    { 4, 17, -1 },
+    { 4, 23, -1 },
+    { 4, 31, -1 },
+    { 4, 52, -1 },
+    { 4, 54, -1 },
+    { 4, 57, -1 },
+    { 4, 60, -1 },
+    { 4, 63, -1 },
+    { 4, 113, -1 },
+    { 4, 114, -1 },
+    { 4, 120, -1 },
+    { 4, 123, -1 },
+    { 4, 124, -1 },
+    { 4, 125, -1 },
+    { 4, 156, -1 },
+    { 4, 209, -1 },
+    { 4, 211, -1 },
+    { 5, 2, -2 },
+    { 5, 7, -2 },
+    { 5, 10, -1 },
+    { 5, 17, -2 },
+    { 5, 31, -2 },
+    { 5, 60, -2 },
+    { 5, 100, -1 },
+    { 5, 109, -1 },
+    { 5, 196, -2 },
+    { 5, 197, -2 },
+    { 5, 199, -2 },
+    { 5, 200, -2 },
+    { 6, 2, -2 },
+    { 6, 5, -1 },
+    { 6, 7, -2 },
+    { 6, 10, -1 },
+    { 6, 15, -1 },
+    { 6, 17, -2 },
+    { 6, 20, -1 },
+    { 6, 21, -1 },
+    { 6, 23, -1 },
+    { 6, 25, -1 },
+    { 6, 31, -2 },
+    { 6, 32, -1 },
+    { 6, 52, -2 },
+    { 6, 54, -1 },
+    { 6, 57, -2 },
+    { 6, 60, -3 },
+    { 6, 70, -1 },
+    { 6, 86, -1 },
+    { 6, 87, -1 },
+    { 6, 89, -1 },
+    { 6, 100, -1 },
+    { 6, 109, -1 },
+    { 6, 156, -2 },
+    { 6, 188, -1 },
+    { 6, 190, -1 },
+    { 6, 196, -2 },
+    { 6, 197, -2 },
+    { 6, 199, -2 },
+    { 6, 200, -2 },
+    { 6, 204, -1 },
+    { 6, 206, -1 },
+    { 6, 211, -1 },
+    { 7, 3, -1 },
+    { 7, 12, -3 },
+    { 7, 14, -3 },
+    { 7, 15, -3 },
+    { 7, 20, -1 },
+    { 7, 32, -1 },
+    { 7, 33, -1 },
+    { 7, 42, -1 },
+    { 7, 63, -3 },
+    { 7, 98, -1 },
+    { 7, 106, -1 },
+    { 7, 126, -3 },
+    { 7, 127, -1 },
+    { 7, 128, -1 },
+    { 7, 129, -1 },
+    { 7, 130, -1 },
+    { 7, 131, -1 },
+    { 7, 132, -1 },
+    { 7, 133, -2 },
+    { 7, 171, 1 },
+    { 7, 172, 1 },
+    { 7, 173, 1 },
+    { 7, 174, 1 },
+    { 7, 198, -3 },
+    { 7, 201, -3 },
+    { 7, 202, 1 },
+    { 7, 205, -3 },
+    { 7, 207, -1 },
+    { 7, 209, -3 },
+    { 7, 211, 1 },
+    { 8, 17, -1 },
+    { 8, 42, 1 },
+    { 8, 74, 1 },
+    { 8, 140, 1 },
+    { 8, 141, 1 },
+    { 8, 142, 1 },
+    { 8, 171, 1 },
+    { 8, 172, 1 },
+    { 8, 173, 1 },
+    { 8, 174, 1 },
+    { 10, 3, -1 },
+    { 10, 15, -2 },
+    { 10, 20, -1 },
+    { 10, 32, -1 },
+    { 10, 33, -1 },
+    { 10, 63, -3 },
+    { 10, 65, -1 },
+    { 10, 98, -1 },
+    { 10, 106, -1 },
+    { 10, 126, -2 },
+    { 10, 127, -1 },
+    { 10, 128, -1 },
+    { 10, 129, -1 },
+    { 10, 130, -1 },
+    { 10, 131, -1 },
+    { 10, 132, -1 },
+    { 10, 133, -1 },
+    { 10, 159, -1 },
+    { 10, 160, -1 },
+    { 10, 161, -1 },
+    { 10, 162, -1 },
+    { 10, 163, -1 },
+    { 10, 164, -1 },
+    { 10, 165, -1 },
+    { 10, 171, 1 },
+    { 10, 172, 1 },
+    { 10, 173, 1 },
+    { 10, 174, 1 },
+    { 10, 207, -1 },
+    { 10, 209, -3 },
+    { 11, 4, -1 },
+    { 11, 5, -1 },
+    { 11, 6, -1 },
+    { 11, 12, -1 },
+    { 11, 14, -1 },
+    { 11, 15, -2 },
+    { 11, 17, -2 },
+    { 11, 18, -2 },
+    { 11, 19, -2 },
+    { 11, 23, -2 },
+    { 11, 31, -2 },
+    { 11, 51, -1 },
+    { 11, 52, -1 },
+    { 11, 54, -1 },
+    { 11, 56, -1 },
+    { 11, 57, -2 },
+    { 11, 58, -1 },
+    { 11, 60, -2 },
+    { 11, 63, -2 },
+    { 11, 88, -1 },
+    { 11, 90, -1 },
+    { 11, 100, -1 },
+    { 11, 122, -1 },
+    { 11, 126, -2 },
+    { 11, 133, -1 },
+    { 11, 156, -2 },
+    { 11, 198, -1 },
+    { 11, 201, -1 },
+    { 11, 205, -1 },
+    { 11, 206, -1 },
+    { 11, 208, -1 },
+    { 11, 209, -2 },
+    { 11, 211, -1 },
+    { 12, 2, -3 },
+    { 12, 5, -3 },
+    { 12, 7, -3 },
+    { 12, 10, -3 },
+    { 12, 11, -1 },
+    { 12, 13, -1 },
+    { 12, 17, -3 },
+    { 12, 20, -1 },
+    { 12, 25, -1 },
+    { 12, 31, -1 },
+    { 12, 35, -1 },
+    { 12, 39, -1 },
+    { 12, 47, -1 },
+    { 12, 49, -1 },
+    { 12, 52, -2 },
+    { 12, 54, -1 },
+    { 12, 55, -1 },
+    { 12, 57, -3 },
+    { 12, 60, -4 },
+    { 12, 84, -1 },
+    { 12, 86, -1 },
+    { 12, 87, -1 },
+    { 12, 89, -1 },
+    { 12, 94, -1 },
+    { 12, 100, -1 },
+    { 12, 104, -2 },
+    { 12, 106, -1 },
+    { 12, 107, -1 },
+    { 12, 108, -1 },
+    { 12, 109, -3 },
+    { 12, 113, -1 },
+    { 12, 114, -1 },
+    { 12, 118, -1 },
+    { 12, 120, -1 },
+    { 12, 123, -1 },
+    { 12, 124, -1 },
+    { 12, 125, -1 },
+    { 12, 134, -1 },
+    { 12, 145, -1 },
+    { 12, 146, -1 },
+    { 12, 147, -1 },
+    { 12, 148, -1 },
+    { 12, 149, -1 },
+    { 12, 151, -1 },
+    { 12, 156, -3 },
+    { 12, 182, -1 },
+    { 12, 188, -1 },
+    { 12, 190, -1 },
+    { 12, 191, -1 },
+    { 12, 192, -1 },
+    { 12, 193, -1 },
+    { 12, 194, -1 },
+    { 12, 196, -3 },
+    { 12, 197, -3 },
+    { 12, 199, -3 },
+    { 12, 200, -3 },
+    { 12, 202, -3 },
+    { 12, 206, -3 },
+    { 12, 207, -1 },
+    { 12, 211, -1 },
+    { 13, 4, -1 },
+    { 13, 5, -1 },
+    { 13, 6, -1 },
+    { 13, 12, -1 },
+    { 13, 14, -1 },
+    { 13, 15, -2 },
+    { 13, 17, -2 },
+    { 13, 18, -2 },
+    { 13, 19, -2 },
+    { 13, 23, -2 },
+    { 13, 31, -2 },
+    { 13, 51, -1 },
+    { 13, 52, -1 },
+    { 13, 54, -1 },
+    { 13, 56, -1 },
+    { 13, 57, -2 },
+    { 13, 58, -1 },
+    { 13, 60, -2 },
+    { 13, 63, -2 },
+    { 13, 88, -1 },
+    { 13, 90, -1 },
+    { 13, 100, -1 },
+    { 13, 122, -1 },
+    { 13, 126, -2 },
+    { 13, 133, -1 },
+    { 13, 156, -2 },
+    { 13, 198, -1 },
+    { 13, 201, -1 },
+    { 13, 205, -1 },
+    { 13, 206, -1 },
+    { 13, 208, -1 },
+    { 13, 209, -2 },
+    { 13, 211, -1 },
+    { 14, 2, -3 },
+    { 14, 5, -3 },
+    { 14, 7, -3 },
+    { 14, 10, -3 },
+    { 14, 11, -1 },
+    { 14, 13, -1 },
+    { 14, 17, -3 },
+    { 14, 20, -1 },
+    { 14, 25, -1 },
+    { 14, 31, -1 },
+    { 14, 35, -1 },
+    { 14, 39, -1 },
+    { 14, 47, -1 },
+    { 14, 49, -1 },
+    { 14, 52, -2 },
+    { 14, 54, -1 },
+    { 14, 55, -1 },
+    { 14, 57, -3 },
+    { 14, 60, -4 },
+    { 14, 84, -1 },
+    { 14, 86, -1 },
+    { 14, 87, -1 },
+    { 14, 89, -1 },
+    { 14, 94, -1 },
+    { 14, 100, -1 },
+    { 14, 104, -2 },
+    { 14, 106, -1 },
+    { 14, 107, -1 },
+    { 14, 108, -1 },
+    { 14, 109, -3 },
+    { 14, 113, -1 },
+    { 14, 114, -1 },
+    { 14, 118, -1 },
+    { 14, 120, -1 },
+    { 14, 123, -1 },
+    { 14, 124, -1 },
+    { 14, 125, -1 },
+    { 14, 134, -1 },
+    { 14, 145, -1 },
+    { 14, 146, -1 },
+    { 14, 147, -1 },
+    { 14, 148, -1 },
+    { 14, 149, -1 },
+    { 14, 151, -1 },
+    { 14, 156, -3 },
+    { 14, 182, -1 },
+    { 14, 188, -1 },
+    { 14, 190, -1 },
+    { 14, 191, -1 },
+    { 14, 192, -1 },
+    { 14, 193, -1 },
+    { 14, 194, -1 },
+    { 14, 196, -3 },
+    { 14, 197, -3 },
+    { 14, 199, -3 },
+    { 14, 200, -3 },
+    { 14, 202, -3 },
+    { 14, 206, -3 },
+    { 14, 207, -1 },
+    { 14, 211, -1 },
+    { 15, 3, -1 },
+    { 15, 5, -1 },
+    { 15, 6, -1 },
+    { 15, 15, -4 },
+    { 15, 17, -2 },
+    { 15, 18, -1 },
+    { 15, 19, -1 },
+    { 15, 20, -1 },
+    { 15, 21, -1 },
+    { 15, 22, -1 },
+    { 15, 24, -1 },
+    { 15, 25, -1 },
+    { 15, 31, -2 },
+    { 15, 32, -1 },
+    { 15, 33, -1 },
+    { 15, 35, -1 },
+    { 15, 39, -1 },
+    { 15, 47, -1 },
+    { 15, 49, -1 },
+    { 15, 56, -1 },
+    { 15, 58, -1 },
+    { 15, 63, -4 },
+    { 15, 65, -1 },
+    { 15, 67, -1 },
+    { 15, 68, -1 },
+    { 15, 69, -1 },
+    { 15, 70, -1 },
+    { 15, 71, -1 },
+    { 15, 77, -1 },
+    { 15, 78, -1 },
+    { 15, 79, -1 },
+    { 15, 80, -1 },
+    { 15, 81, -1 },
+    { 15, 82, -1 },
+    { 15, 83, -1 },
+    { 15, 84, -1 },
+    { 15, 85, -1 },
+    { 15, 86, -1 },
+    { 15, 87, -1 },
+    { 15, 88, -1 },
+    { 15, 89, -1 },
+    { 15, 90, -1 },
+    { 15, 97, -1 },
+    { 15, 98, -1 },
+    { 15, 106, -2 },
+    { 15, 116, -1 },
+    { 15, 122, -1 },
+    { 15, 126, -3 },
+    { 15, 127, -1 },
+    { 15, 128, -1 },
+    { 15, 129, -1 },
+    { 15, 130, -1 },
+    { 15, 131, -1 },
+    { 15, 132, -1 },
+    { 15, 133, -1 },
+    { 15, 134, -1 },
+    { 15, 145, -1 },
+    { 15, 146, -1 },
+    { 15, 147, -1 },
+    { 15, 148, -1 },
+    { 15, 149, -1 },
+    { 15, 151, -1 },
+    { 15, 159, -1 },
+    { 15, 160, -1 },
+    { 15, 161, -1 },
+    { 15, 162, -1 },
+    { 15, 163, -1 },
+    { 15, 164, -1 },
+    { 15, 165, -1 },
+    { 15, 166, -1 },
+    { 15, 167, -1 },
+    { 15, 168, -1 },
+    { 15, 169, -1 },
+    { 15, 170, -1 },
+    { 15, 175, -1 },
+    { 15, 176, -1 },
+    { 15, 177, -1 },
+    { 15, 178, -1 },
+    { 15, 179, -1 },
+    { 15, 180, -1 },
+    { 15, 181, -1 },
+    { 15, 183, -1 },
+    { 15, 184, -1 },
+    { 15, 185, -1 },
+    { 15, 186, -1 },
+    { 15, 187, -1 },
+    { 15, 188, -1 },
+    { 15, 190, -1 },
+    { 15, 204, -1 },
+    { 15, 206, -1 },
+    { 15, 207, -2 },
+    { 15, 208, -1 },
+    { 15, 209, -4 },
+    { 15, 211, -1 },
+    { 16, 17, -1 },
+    { 16, 23, -1 },
+    { 16, 31, -1 },
+    { 16, 52, -1 },
+    { 16, 57, -1 },
+    { 16, 63, -1 },
+    { 16, 156, -1 },
+    { 16, 209, -1 },
+    { 17, 171, 1 },
+    { 17, 172, 1 },
+    { 17, 173, 1 },
+    { 17, 174, 1 },
+    { 18, 17, -1 },
+    { 18, 20, -1 },
+    { 18, 52, -1 },
+    { 18, 57, -1 },
+    { 18, 60, -1 },
+    { 18, 67, -1 },
+    { 18, 68, -1 },
+    { 18, 69, -1 },
+    { 18, 71, -1 },
+    { 18, 79, -1 },
+    { 18, 81, -1 },
+    { 18, 97, -1 },
+    { 18, 106, -1 },
+    { 18, 156, -1 },
+    { 18, 166, -1 },
+    { 18, 167, -1 },
+    { 18, 168, -1 },
+    { 18, 169, -1 },
+    { 18, 170, -1 },
+    { 18, 175, -1 },
+    { 18, 177, -1 },
+    { 18, 178, -1 },
+    { 18, 179, -1 },
+    { 18, 180, -1 },
+    { 18, 181, -1 },
+    { 18, 183, -1 },
+    { 18, 207, -1 },
+    { 19, 15, -1 },
+    { 19, 17, -1 },
+    { 19, 52, -1 },
+    { 19, 57, -1 },
+    { 19, 60, -1 },
+    { 19, 63, -1 },
+    { 19, 156, -1 },
+    { 19, 209, -1 },
+    { 20, 2, -1 },
+    { 20, 4, -1 },
+    { 20, 5, -1 },
+    { 20, 7, -1 },
+    { 20, 10, -1 },
+    { 20, 15, -1 },
+    { 20, 17, -2 },
+    { 20, 18, -1 },
+    { 20, 23, -1 },
+    { 20, 25, -1 },
+    { 20, 31, -1 },
+    { 20, 51, -1 },
+    { 20, 52, -1 },
+    { 20, 54, -1 },
+    { 20, 57, -2 },
+    { 20, 60, -1 },
+    { 20, 100, -1 },
+    { 20, 109, -1 },
+    { 20, 122, -1 },
+    { 20, 156, -2 },
+    { 20, 196, -1 },
+    { 20, 197, -1 },
+    { 20, 199, -1 },
+    { 20, 200, -1 },
+    { 20, 206, -1 },
+    { 20, 208, -1 },
+    { 21, 2, -1 },
+    { 21, 5, -1 },
+    { 21, 7, -1 },
+    { 21, 10, -1 },
+    { 21, 15, -1 },
+    { 21, 17, -1 },
+    { 21, 23, -1 },
+    { 21, 31, -1 },
+    { 21, 52, -1 },
+    { 21, 54, -1 },
+    { 21, 55, -1 },
+    { 21, 57, -1 },
+    { 21, 60, -1 },
+    { 21, 63, -1 },
+    { 21, 100, -1 },
+    { 21, 109, -1 },
+    { 21, 156, -1 },
+    { 21, 196, -1 },
+    { 21, 197, -1 },
+    { 21, 199, -1 },
+    { 21, 200, -1 },
+    { 21, 206, -1 },
+    { 21, 209, -1 },
+    { 22, 2, -1 },
+    { 22, 7, -1 },
+    { 22, 10, -1 },
+    { 22, 15, -1 },
+    { 22, 17, -1 },
+    { 22, 23, -1 },
+    { 22, 31, -1 },
+    { 22, 52, -1 },
+    { 22, 54, -1 },
+    { 22, 57, -1 },
+    { 22, 60, -1 },
+    { 22, 63, -1 },
+    { 22, 100, -1 },
+    { 22, 109, -1 },
+    { 22, 156, -1 },
+    { 22, 196, -1 },
+    { 22, 197, -1 },
+    { 22, 199, -1 },
+    { 22, 200, -1 },
+    { 22, 209, -1 },
+    { 22, 211, -1 },
+    { 23, 1, 1 },
+    { 23, 3, -1 },
+    { 23, 4, -1 },
+    { 23, 6, -1 },
+    { 23, 15, -1 },
+    { 23, 17, -1 },
+    { 23, 20, -1 },
+    { 23, 22, -1 },
+    { 23, 24, -1 },
+    { 23, 25, -1 },
+    { 23, 32, -1 },
+    { 23, 33, -1 },
+    { 23, 42, -1 },
+    { 23, 51, -1 },
+    { 23, 63, -3 },
+    { 23, 65, -1 },
+    { 23, 67, -1 },
+    { 23, 68, -1 },
+    { 23, 69, -1 },
+    { 23, 71, -1 },
+    { 23, 79, -1 },
+    { 23, 81, -1 },
+    { 23, 83, -1 },
+    { 23, 90, -1 },
+    { 23, 97, -1 },
+    { 23, 98, -1 },
+    { 23, 106, -1 },
+    { 23, 122, -1 },
+    { 23, 127, -1 },
+    { 23, 128, -1 },
+    { 23, 129, -1 },
+    { 23, 130, -1 },
+    { 23, 131, -1 },
+    { 23, 132, -1 },
+    { 23, 133, -1 },
+    { 23, 159, -1 },
+    { 23, 160, -1 },
+    { 23, 161, -1 },
+    { 23, 162, -1 },
+    { 23, 163, -1 },
+    { 23, 164, -1 },
+    { 23, 165, -1 },
+    { 23, 166, -1 },
+    { 23, 167, -1 },
+    { 23, 168, -1 },
+    { 23, 169, -1 },
+    { 23, 170, -1 },
+    { 23, 171, 1 },
+    { 23, 172, 1 },
+    { 23, 173, 1 },
+    { 23, 174, 1 },
+    { 23, 175, -1 },
+    { 23, 177, -1 },
+    { 23, 178, -1 },
+    { 23, 179, -1 },
+    { 23, 180, -1 },
+    { 23, 181, -1 },
+    { 23, 183, -1 },
+    { 23, 204, -1 },
+    { 23, 207, -1 },
+    { 23, 208, -1 },
+    { 23, 209, -3 },
+    { 24, 17, -1 },
+    { 24, 31, -1 },
+    { 24, 52, -1 },
+    { 24, 57, -1 },
+    { 24, 60, -1 },
+    { 24, 63, -1 },
+    { 24, 156, -1 },
+    { 24, 209, -1 },
+    { 24, 211, -1 },
+    { 25, 15, -1 },
+    { 25, 17, -1 },
+    { 25, 18, -1 },
+    { 25, 19, -1 },
+    { 25, 31, -1 },
+    { 25, 52, -1 },
+    { 25, 57, -1 },
+    { 25, 58, -1 },
+    { 25, 60, -1 },
+    { 25, 63, -3 },
+    { 25, 133, -1 },
+    { 25, 156, -1 },
+    { 25, 209, -3 },
+    { 26, 17, -1 },
+    { 26, 23, -1 },
+    { 26, 31, -1 },
+    { 26, 52, -1 },
+    { 26, 57, -2 },
+    { 26, 60, -1 },
+    { 26, 133, 1 },
+    { 26, 156, -2 },
+    { 27, 17, -1 },
+    { 27, 23, -1 },
+    { 27, 31, -1 },
+    { 27, 52, -1 },
+    { 27, 57, -2 },
+    { 27, 60, -1 },
+    { 27, 133, 1 },
+    { 27, 156, -2 },
+    { 28, 17, -1 },
+    { 28, 19, -1 },
+    { 28, 31, -1 },
+    { 28, 56, -1 },
+    { 28, 58, -1 },
+    { 28, 100, -1 },
+    { 28, 211, -1 },
+    { 29, 17, -1 },
+    { 29, 19, -1 },
+    { 29, 31, -1 },
+    { 29, 56, -1 },
+    { 29, 58, -1 },
+    { 29, 100, -1 },
+    { 29, 211, -1 },
+    { 30, 17, -1 },
+    { 30, 19, -1 },
+    { 30, 31, -1 },
+    { 30, 56, -1 },
+    { 30, 58, -1 },
+    { 30, 100, -1 },
+    { 30, 211, -1 },
+    { 31, 3, -1 },
+    { 31, 6, -1 },
+    { 31, 15, -2 },
+    { 31, 31, -1 },
+    { 31, 63, -3 },
+    { 31, 106, -1 },
+    { 31, 122, -1 },
+    { 31, 126, -3 },
+    { 31, 207, -1 },
+    { 31, 208, -1 },
+    { 31, 209, -3 },
+    { 32, 2, -1 },
+    { 32, 6, -1 },
+    { 32, 7, -1 },
+    { 32, 10, -1 },
+    { 32, 17, -1 },
+    { 32, 18, -1 },
+    { 32, 19, -1 },
+    { 32, 23, -1 },
+    { 32, 31, -1 },
+    { 32, 52, -1 },
+    { 32, 56, -1 },
+    { 32, 57, -1 },
+    { 32, 58, -1 },
+    { 32, 60, -1 },
+    { 32, 63, -1 },
+    { 32, 100, -1 },
+    { 32, 109, -1 },
+    { 32, 122, -1 },
+    { 32, 133, -1 },
+    { 32, 156, -1 },
+    { 32, 196, -1 },
+    { 32, 197, -1 },
+    { 32, 199, -1 },
+    { 32, 200, -1 },
+    { 32, 208, -1 },
+    { 32, 209, -1 },
+    { 32, 211, -1 },
+    { 33, 2, -1 },
+    { 33, 7, -1 },
+    { 33, 10, -1 },
+    { 33, 17, -1 },
+    { 33, 20, -1 },
+    { 33, 23, -1 },
+    { 33, 31, -1 },
+    { 33, 52, -1 },
+    { 33, 57, -1 },
+    { 33, 60, -1 },
+    { 33, 109, -1 },
+    { 33, 156, -1 },
+    { 33, 196, -1 },
+    { 33, 197, -1 },
+    { 33, 199, -1 },
+    { 33, 200, -1 },
+    { 33, 211, -1 },
+    { 34, 4, -1 },
+    { 34, 17, -1 },
+    { 34, 23, -1 },
+    { 34, 25, -1 },
+    { 34, 31, -1 },
+    { 34, 51, -1 },
+    { 34, 52, -1 },
+    { 34, 57, -1 },
+    { 34, 60, -1 },
+    { 34, 63, -1 },
+    { 34, 156, -1 },
+    { 34, 209, -1 },
+    { 34, 211, -1 },
+    { 35, 11, -2 },
+    { 35, 13, -2 },
+    { 35, 16, -1 },
+    { 35, 17, -2 },
+    { 35, 20, -1 },
+    { 35, 22, -1 },
+    { 35, 24, -1 },
+    { 35, 25, -1 },
+    { 35, 28, -2 },
+    { 35, 29, -2 },
+    { 35, 30, -2 },
+    { 35, 32, -1 },
+    { 35, 35, -1 },
+    { 35, 39, -1 },
+    { 35, 47, -1 },
+    { 35, 49, -1 },
+    { 35, 60, -1 },
+    { 35, 67, -1 },
+    { 35, 68, -1 },
+    { 35, 69, -1 },
+    { 35, 70, -1 },
+    { 35, 71, -1 },
+    { 35, 79, -1 },
+    { 35, 81, -1 },
+    { 35, 84, -1 },
+    { 35, 86, -1 },
+    { 35, 87, -1 },
+    { 35, 89, -1 },
+    { 35, 94, -2 },
+    { 35, 97, -1 },
+    { 35, 106, -1 },
+    { 35, 107, -2 },
+    { 35, 108, -2 },
+    { 35, 118, -2 },
+    { 35, 122, -1 },
+    { 35, 134, -1 },
+    { 35, 145, -1 },
+    { 35, 146, -1 },
+    { 35, 147, -1 },
+    { 35, 148, -1 },
+    { 35, 149, -1 },
+    { 35, 150, -2 },
+    { 35, 151, -1 },
+    { 35, 166, -1 },
+    { 35, 167, -1 },
+    { 35, 168, -1 },
+    { 35, 169, -1 },
+    { 35, 170, -1 },
+    { 35, 175, -1 },
+    { 35, 177, -1 },
+    { 35, 178, -1 },
+    { 35, 179, -1 },
+    { 35, 180, -1 },
+    { 35, 181, -1 },
+    { 35, 182, -2 },
+    { 35, 183, -1 },
+    { 35, 188, -1 },
+    { 35, 190, -1 },
+    { 35, 191, -2 },
+    { 35, 192, -2 },
+    { 35, 193, -2 },
+    { 35, 194, -2 },
+    { 35, 204, -2 },
+    { 35, 207, -1 },
+    { 35, 208, -1 },
+    { 35, 211, -1 },
+    { 36, 12, -1 },
+    { 36, 14, -1 },
+    { 36, 18, -1 },
+    { 36, 19, -1 },
+    { 36, 23, -1 },
+    { 36, 31, -1 },
+    { 36, 52, -1 },
+    { 36, 57, -1 },
+    { 36, 58, -1 },
+    { 36, 60, -1 },
+    { 36, 63, -1 },
+    { 36, 133, -1 },
+    { 36, 156, -1 },
+    { 36, 198, -1 },
+    { 36, 201, -1 },
+    { 36, 205, -1 },
+    { 36, 209, -1 },
+    { 37, 11, -1 },
+    { 37, 13, -1 },
+    { 37, 17, -1 },
+    { 37, 20, -1 },
+    { 37, 60, -1 },
+    { 37, 67, -1 },
+    { 37, 68, -1 },
+    { 37, 69, -1 },
+    { 37, 70, -1 },
+    { 37, 71, -1 },
+    { 37, 79, -1 },
+    { 37, 81, -1 },
+    { 37, 86, -1 },
+    { 37, 89, -1 },
+    { 37, 94, -1 },
+    { 37, 97, -1 },
+    { 37, 106, -1 },
+    { 37, 107, -1 },
+    { 37, 108, -1 },
+    { 37, 118, -1 },
+    { 37, 166, -1 },
+    { 37, 167, -1 },
+    { 37, 168, -1 },
+    { 37, 169, -1 },
+    { 37, 170, -1 },
+    { 37, 175, -1 },
+    { 37, 177, -1 },
+    { 37, 178, -1 },
+    { 37, 179, -1 },
+    { 37, 180, -1 },
+    { 37, 181, -1 },
+    { 37, 182, -1 },
+    { 37, 183, -1 },
+    { 37, 188, -1 },
+    { 37, 190, -1 },
+    { 37, 191, -1 },
+    { 37, 192, -1 },
+    { 37, 193, -1 },
+    { 37, 194, -1 },
+    { 37, 207, -1 },
+    { 37, 211, -1 },
+    { 38, 3, -1 },
+    { 38, 4, -1 },
+    { 38, 6, -1 },
+    { 38, 12, -2 },
+    { 38, 14, -2 },
+    { 38, 15, -1 },
+    { 38, 17, -1 },
+    { 38, 20, -1 },
+    { 38, 21, -1 },
+    { 38, 24, -1 },
+    { 38, 25, -1 },
+    { 38, 26, -1 },
+    { 38, 27, -1 },
+    { 38, 28, -1 },
+    { 38, 29, -1 },
+    { 38, 30, -1 },
+    { 38, 32, -1 },
+    { 38, 33, -1 },
+    { 38, 45, -1 },
+    { 38, 51, -1 },
+    { 38, 58, -1 },
+    { 38, 63, -3 },
+    { 38, 65, -2 },
+    { 38, 67, -1 },
+    { 38, 68, -1 },
+    { 38, 69, -1 },
+    { 38, 70, -1 },
+    { 38, 71, -1 },
+    { 38, 73, -1 },
+    { 38, 74, -1 },
+    { 38, 77, -1 },
+    { 38, 78, -1 },
+    { 38, 79, -1 },
+    { 38, 80, -1 },
+    { 38, 81, -1 },
+    { 38, 82, -1 },
+    { 38, 83, -1 },
+    { 38, 85, -1 },
+    { 38, 86, -1 },
+    { 38, 87, -1 },
+    { 38, 88, -2 },
+    { 38, 89, -1 },
+    { 38, 90, -1 },
+    { 38, 97, -1 },
+    { 38, 106, -1 },
+    { 38, 116, -1 },
+    { 38, 122, -1 },
+    { 38, 127, -1 },
+    { 38, 128, -1 },
+    { 38, 129, -1 },
+    { 38, 130, -1 },
+    { 38, 131, -1 },
+    { 38, 132, -1 },
+    { 38, 133, -2 },
+    { 38, 150, -1 },
+    { 38, 159, -2 },
+    { 38, 160, -2 },
+    { 38, 161, -2 },
+    { 38, 162, -2 },
+    { 38, 163, -2 },
+    { 38, 164, -2 },
+    { 38, 165, -2 },
+    { 38, 166, -1 },
+    { 38, 167, -1 },
+    { 38, 168, -1 },
+    { 38, 169, -1 },
+    { 38, 170, -1 },
+    { 38, 175, -1 },
+    { 38, 176, -1 },
+    { 38, 177, -1 },
+    { 38, 178, -1 },
+    { 38, 179, -1 },
+    { 38, 180, -1 },
+    { 38, 181, -1 },
+    { 38, 183, -1 },
+    { 38, 184, -1 },
+    { 38, 185, -1 },
+    { 38, 186, -1 },
+    { 38, 187, -1 },
+    { 38, 188, -1 },
+    { 38, 190, -1 },
+    { 38, 198, -2 },
+    { 38, 201, -2 },
+    { 38, 205, -2 },
+    { 38, 207, -1 },
+    { 38, 208, -1 },
+    { 38, 209, -3 },
+    { 38, 211, -1 },
+    { 39, 17, -1 },
+    { 39, 52, -1 },
+    { 39, 57, -1 },
+    { 39, 156, -1 },
+    { 42, 63, -1 },
+    { 42, 209, -1 },
+    { 43, 11, -1 },
+    { 43, 13, -1 },
+    { 43, 17, -1 },
+    { 43, 20, -1 },
+    { 43, 22, -1 },
+    { 43, 28, -1 },
+    { 43, 29, -1 },
+    { 43, 30, -1 },
+    { 43, 31, -1 },
+    { 43, 32, -1 },
+    { 43, 60, -1 },
+    { 43, 94, -1 },
+    { 43, 107, -1 },
+    { 43, 108, -1 },
+    { 43, 118, -1 },
+    { 43, 150, -1 },
+    { 43, 182, -1 },
+    { 43, 191, -1 },
+    { 43, 192, -1 },
+    { 43, 193, -1 },
+    { 43, 194, -1 },
+    { 43, 204, -1 },
+    { 43, 211, -1 },
+    { 44, 2, -3 },
+    { 44, 6, -1 },
+    { 44, 7, -3 },
+    { 44, 10, -2 },
+    { 44, 11, -3 },
+    { 44, 13, -3 },
+    { 44, 15, -1 },
+    { 44, 16, -1 },
+    { 44, 17, -4 },
+    { 44, 20, -1 },
+    { 44, 22, -1 },
+    { 44, 23, -1 },
+    { 44, 25, -2 },
+    { 44, 28, -1 },
+    { 44, 29, -1 },
+    { 44, 30, -1 },
+    { 44, 31, -2 },
+    { 44, 35, -1 },
+    { 44, 39, -1 },
+    { 44, 42, -1 },
+    { 44, 47, -1 },
+    { 44, 49, -1 },
+    { 44, 52, -2 },
+    { 44, 53, -1 },
+    { 44, 54, -2 },
+    { 44, 55, -1 },
+    { 44, 57, -3 },
+    { 44, 60, -3 },
+    { 44, 67, -1 },
+    { 44, 68, -1 },
+    { 44, 69, -1 },
+    { 44, 70, -1 },
+    { 44, 71, -1 },
+    { 44, 79, -1 },
+    { 44, 81, -1 },
+    { 44, 84, -1 },
+    { 44, 86, -2 },
+    { 44, 87, -1 },
+    { 44, 89, -2 },
+    { 44, 94, -3 },
+    { 44, 97, -1 },
+    { 44, 104, -2 },
+    { 44, 106, -2 },
+    { 44, 107, -3 },
+    { 44, 108, -3 },
+    { 44, 109, -2 },
+    { 44, 113, -3 },
+    { 44, 114, -3 },
+    { 44, 118, -3 },
+    { 44, 120, -3 },
+    { 44, 122, -1 },
+    { 44, 123, -3 },
+    { 44, 124, -3 },
+    { 44, 125, -3 },
+    { 44, 134, -1 },
+    { 44, 145, -1 },
+    { 44, 146, -1 },
+    { 44, 147, -1 },
+    { 44, 148, -1 },
+    { 44, 149, -1 },
+    { 44, 150, -1 },
+    { 44, 151, -1 },
+    { 44, 152, -1 },
+    { 44, 153, -1 },
+    { 44, 154, -1 },
+    { 44, 155, -1 },
+    { 44, 156, -3 },
+    { 44, 166, -1 },
+    { 44, 167, -1 },
+    { 44, 168, -1 },
+    { 44, 169, -1 },
+    { 44, 170, -1 },
+    { 44, 175, -1 },
+    { 44, 177, -1 },
+    { 44, 178, -1 },
+    { 44, 179, -1 },
+    { 44, 180, -1 },
+    { 44, 181, -1 },
+    { 44, 182, -3 },
+    { 44, 183, -1 },
+    { 44, 188, -2 },
+    { 44, 190, -2 },
+    { 44, 191, -3 },
+    { 44, 192, -3 },
+    { 44, 193, -3 },
+    { 44, 194, -3 },
+    { 44, 196, -3 },
+    { 44, 197, -3 },
+    { 44, 199, -3 },
+    { 44, 200, -3 },
+    { 44, 204, -2 },
+    { 44, 207, -2 },
+    { 44, 208, -1 },
+    { 44, 211, -1 },
+    { 47, 12, -1 },
+    { 47, 14, -1 },
+    { 47, 18, -1 },
+    { 47, 19, -1 },
+    { 47, 23, -1 },
+    { 47, 31, -1 },
+    { 47, 52, -1 },
+    { 47, 57, -1 },
+    { 47, 58, -1 },
+    { 47, 60, -1 },
+    { 47, 63, -1 },
+    { 47, 133, -1 },
+    { 47, 156, -1 },
+    { 47, 198, -1 },
+    { 47, 201, -1 },
+    { 47, 205, -1 },
+    { 47, 209, -1 },
+    { 48, 3, -1 },
+    { 48, 4, -1 },
+    { 48, 6, -1 },
+    { 48, 12, -4 },
+    { 48, 14, -4 },
+    { 48, 15, -1 },
+    { 48, 18, -1 },
+    { 48, 19, -1 },
+    { 48, 20, -1 },
+    { 48, 23, -1 },
+    { 48, 24, -1 },
+    { 48, 31, -1 },
+    { 48, 32, -1 },
+    { 48, 33, -2 },
+    { 48, 42, -1 },
+    { 48, 45, -1 },
+    { 48, 51, -1 },
+    { 48, 52, -1 },
+    { 48, 54, -1 },
+    { 48, 56, -1 },
+    { 48, 57, -1 },
+    { 48, 58, -1 },
+    { 48, 60, -1 },
+    { 48, 63, -3 },
+    { 48, 65, -2 },
+    { 48, 66, -1 },
+    { 48, 67, -1 },
+    { 48, 68, -1 },
+    { 48, 69, -1 },
+    { 48, 71, -1 },
+    { 48, 72, -1 },
+    { 48, 74, -1 },
+    { 48, 75, -1 },
+    { 48, 77, -1 },
+    { 48, 78, -1 },
+    { 48, 79, -1 },
+    { 48, 80, -1 },
+    { 48, 81, -1 },
+    { 48, 82, -1 },
+    { 48, 83, -1 },
+    { 48, 85, -1 },
+    { 48, 90, -1 },
+    { 48, 97, -1 },
+    { 48, 116, -1 },
+    { 48, 127, -2 },
+    { 48, 128, -2 },
+    { 48, 129, -2 },
+    { 48, 130, -2 },
+    { 48, 131, -2 },
+    { 48, 132, -2 },
+    { 48, 133, -2 },
+    { 48, 156, -1 },
+    { 48, 158, -1 },
+    { 48, 159, -2 },
+    { 48, 160, -2 },
+    { 48, 161, -2 },
+    { 48, 162, -2 },
+    { 48, 163, -2 },
+    { 48, 164, -2 },
+    { 48, 165, -2 },
+    { 48, 166, -1 },
+    { 48, 167, -1 },
+    { 48, 168, -1 },
+    { 48, 169, -1 },
+    { 48, 170, -1 },
+    { 48, 175, -1 },
+    { 48, 176, -1 },
+    { 48, 177, -1 },
+    { 48, 178, -1 },
+    { 48, 179, -1 },
+    { 48, 180, -1 },
+    { 48, 181, -1 },
+    { 48, 183, -1 },
+    { 48, 184, -1 },
+    { 48, 185, -1 },
+    { 48, 186, -1 },
+    { 48, 187, -1 },
+    { 48, 189, -1 },
+    { 48, 198, -4 },
+    { 48, 201, -4 },
+    { 48, 205, -4 },
+    { 48, 209, -3 },
+    { 49, 12, -1 },
+    { 49, 14, -1 },
+    { 49, 18, -1 },
+    { 49, 19, -1 },
+    { 49, 23, -1 },
+    { 49, 31, -1 },
+    { 49, 52, -1 },
+    { 49, 57, -1 },
+    { 49, 58, -1 },
+    { 49, 60, -1 },
+    { 49, 63, -1 },
+    { 49, 133, -1 },
+    { 49, 156, -1 },
+    { 49, 198, -1 },
+    { 49, 201, -1 },
+    { 49, 205, -1 },
+    { 49, 209, -1 },
+    { 50, 11, -1 },
+    { 50, 13, -1 },
+    { 50, 20, -1 },
+    { 50, 31, -1 },
+    { 50, 52, -1 },
+    { 50, 57, -1 },
+    { 50, 60, -1 },
+    { 50, 94, -1 },
+    { 50, 107, -1 },
+    { 50, 108, -1 },
+    { 50, 118, -1 },
+    { 50, 156, -1 },
+    { 50, 182, -1 },
+    { 50, 191, -1 },
+    { 50, 192, -1 },
+    { 50, 193, -1 },
+    { 50, 194, -1 },
+    { 50, 204, -1 },
+    { 51, 17, -1 },
+    { 51, 23, -1 },
+    { 51, 31, -1 },
+    { 51, 52, -1 },
+    { 51, 54, -1 },
+    { 51, 57, -1 },
+    { 51, 60, -1 },
+    { 51, 63, -1 },
+    { 51, 113, -1 },
+    { 51, 114, -1 },
+    { 51, 120, -1 },
+    { 51, 123, -1 },
+    { 51, 124, -1 },
+    { 51, 125, -1 },
+    { 51, 156, -1 },
+    { 51, 209, -1 },
+    { 51, 211, -1 },
+    { 52, 3, -1 },
+    { 52, 4, -1 },
+    { 52, 6, -1 },
+    { 52, 11, -1 },
+    { 52, 12, -2 },
+    { 52, 13, -1 },
+    { 52, 14, -2 },
+    { 52, 15, -1 },
+    { 52, 16, -1 },
+    { 52, 17, -1 },
+    { 52, 20, -1 },
+    { 52, 21, -1 },
+    { 52, 22, -1 },
+    { 52, 24, -1 },
+    { 52, 25, -1 },
+    { 52, 26, -1 },
+    { 52, 27, -1 },
+    { 52, 32, -1 },
+    { 52, 33, -1 },
+    { 52, 35, -1 },
+    { 52, 39, -1 },
+    { 52, 45, -1 },
+    { 52, 47, -1 },
+    { 52, 49, -1 },
+    { 52, 51, -1 },
+    { 52, 58, -1 },
+    { 52, 60, -1 },
+    { 52, 63, -1 },
+    { 52, 65, -1 },
+    { 52, 67, -2 },
+    { 52, 68, -2 },
+    { 52, 69, -2 },
+    { 52, 70, -1 },
+    { 52, 71, -1 },
+    { 52, 74, -1 },
+    { 52, 77, -1 },
+    { 52, 78, -1 },
+    { 52, 79, -2 },
+    { 52, 80, -1 },
+    { 52, 81, -2 },
+    { 52, 82, -1 },
+    { 52, 83, -1 },
+    { 52, 84, -1 },
+    { 52, 85, -1 },
+    { 52, 86, -1 },
+    { 52, 87, -1 },
+    { 52, 88, -1 },
+    { 52, 89, -1 },
+    { 52, 90, -1 },
+    { 52, 94, -1 },
+    { 52, 97, -2 },
+    { 52, 106, -1 },
+    { 52, 107, -1 },
+    { 52, 108, -1 },
+    { 52, 116, -1 },
+    { 52, 118, -1 },
+    { 52, 122, -1 },
+    { 52, 127, -1 },
+    { 52, 128, -1 },
+    { 52, 129, -1 },
+    { 52, 130, -1 },
+    { 52, 131, -1 },
+    { 52, 132, -1 },
+    { 52, 133, -2 },
+    { 52, 134, -1 },
+    { 52, 145, -1 },
+    { 52, 146, -1 },
+    { 52, 147, -1 },
+    { 52, 148, -1 },
+    { 52, 149, -1 },
+    { 52, 151, -1 },
+    { 52, 159, -1 },
+    { 52, 160, -1 },
+    { 52, 161, -1 },
+    { 52, 162, -1 },
+    { 52, 163, -1 },
+    { 52, 164, -1 },
+    { 52, 165, -1 },
+    { 52, 166, -2 },
+    { 52, 167, -2 },
+    { 52, 168, -2 },
+    { 52, 169, -2 },
+    { 52, 170, -2 },
+    { 52, 175, -2 },
+    { 52, 176, -1 },
+    { 52, 177, -2 },
+    { 52, 178, -2 },
+    { 52, 179, -2 },
+    { 52, 180, -2 },
+    { 52, 181, -2 },
+    { 52, 182, -1 },
+    { 52, 183, -2 },
+    { 52, 184, -1 },
+    { 52, 185, -1 },
+    { 52, 186, -1 },
+    { 52, 187, -1 },
+    { 52, 188, -1 },
+    { 52, 190, -1 },
+    { 52, 191, -1 },
+    { 52, 192, -1 },
+    { 52, 193, -1 },
+    { 52, 194, -1 },
+    { 52, 198, -2 },
+    { 52, 201, -2 },
+    { 52, 204, -1 },
+    { 52, 205, -2 },
+    { 52, 207, -1 },
+    { 52, 208, -1 },
+    { 52, 209, -1 },
+    { 53, 63, -1 },
+    { 53, 133, -1 },
+    { 53, 209, -1 },
+    { 54, 6, -1 },
+    { 54, 11, -1 },
+    { 54, 12, -1 },
+    { 54, 13, -1 },
+    { 54, 14, -1 },
+    { 54, 15, -1 },
+    { 54, 17, -1 },
+    { 54, 20, -1 },
+    { 54, 58, -1 },
+    { 54, 63, -1 },
+    { 54, 65, -1 },
+    { 54, 67, -1 },
+    { 54, 68, -1 },
+    { 54, 69, -1 },
+    { 54, 71, -1 },
+    { 54, 79, -1 },
+    { 54, 81, -1 },
+    { 54, 83, -1 },
+    { 54, 85, -1 },
+    { 54, 90, -1 },
+    { 54, 94, -1 },
+    { 54, 97, -1 },
+    { 54, 106, -1 },
+    { 54, 107, -1 },
+    { 54, 108, -1 },
+    { 54, 118, -1 },
+    { 54, 133, -1 },
+    { 54, 159, -1 },
+    { 54, 160, -1 },
+    { 54, 161, -1 },
+    { 54, 162, -1 },
+    { 54, 163, -1 },
+    { 54, 164, -1 },
+    { 54, 165, -1 },
+    { 54, 166, -1 },
+    { 54, 167, -1 },
+    { 54, 168, -1 },
+    { 54, 169, -1 },
+    { 54, 170, -1 },
+    { 54, 175, -1 },
+    { 54, 177, -1 },
+    { 54, 178, -1 },
+    { 54, 179, -1 },
+    { 54, 180, -1 },
+    { 54, 181, -1 },
+    { 54, 182, -1 },
+    { 54, 183, -1 },
+    { 54, 184, -1 },
+    { 54, 185, -1 },
+    { 54, 186, -1 },
+    { 54, 187, -1 },
+    { 54, 191, -1 },
+    { 54, 192, -1 },
+    { 54, 193, -1 },
+    { 54, 194, -1 },
+    { 54, 198, -1 },
+    { 54, 201, -1 },
+    { 54, 205, -1 },
+    { 54, 207, -1 },
+    { 54, 209, -1 },
+    { 55, 12, -1 },
+    { 55, 14, -1 },
+    { 55, 17, -1 },
+    { 55, 58, -1 },
+    { 55, 63, -2 },
+    { 55, 65, -1 },
+    { 55, 159, -1 },
+    { 55, 160, -1 },
+    { 55, 161, -1 },
+    { 55, 162, -1 },
+    { 55, 163, -1 },
+    { 55, 164, -1 },
+    { 55, 165, -1 },
+    { 55, 198, -1 },
+    { 55, 201, -1 },
+    { 55, 205, -1 },
+    { 55, 209, -2 },
+    { 56, 11, -1 },
+    { 56, 13, -1 },
+    { 56, 17, -1 },
+    { 56, 20, -1 },
+    { 56, 22, -1 },
+    { 56, 28, -1 },
+    { 56, 29, -1 },
+    { 56, 30, -1 },
+    { 56, 31, -1 },
+    { 56, 32, -1 },
+    { 56, 60, -1 },
+    { 56, 94, -1 },
+    { 56, 107, -1 },
+    { 56, 108, -1 },
+    { 56, 118, -1 },
+    { 56, 150, -1 },
+    { 56, 182, -1 },
+    { 56, 191, -1 },
+    { 56, 192, -1 },
+    { 56, 193, -1 },
+    { 56, 194, -1 },
+    { 56, 204, -1 },
+    { 56, 211, -1 },
+    { 57, 3, -1 },
+    { 57, 4, -1 },
+    { 57, 6, -1 },
+    { 57, 11, -2 },
+    { 57, 12, -3 },
+    { 57, 13, -2 },
+    { 57, 14, -3 },
+    { 57, 15, -2 },
+    { 57, 16, -1 },
+    { 57, 17, -1 },
+    { 57, 18, -1 },
+    { 57, 19, -1 },
+    { 57, 20, -1 },
+    { 57, 21, -1 },
+    { 57, 22, -1 },
+    { 57, 24, -1 },
+    { 57, 25, -1 },
+    { 57, 26, -2 },
+    { 57, 27, -2 },
+    { 57, 32, -1 },
+    { 57, 33, -1 },
+    { 57, 35, -1 },
+    { 57, 39, -1 },
+    { 57, 47, -1 },
+    { 57, 49, -1 },
+    { 57, 51, -1 },
+    { 57, 63, -2 },
+    { 57, 65, -2 },
+    { 57, 67, -2 },
+    { 57, 68, -2 },
+    { 57, 69, -2 },
+    { 57, 70, -1 },
+    { 57, 71, -1 },
+    { 57, 74, -1 },
+    { 57, 77, -1 },
+    { 57, 78, -1 },
+    { 57, 79, -2 },
+    { 57, 80, -1 },
+    { 57, 81, -2 },
+    { 57, 82, -1 },
+    { 57, 83, -2 },
+    { 57, 84, -1 },
+    { 57, 85, -1 },
+    { 57, 86, -1 },
+    { 57, 87, -1 },
+    { 57, 88, -1 },
+    { 57, 89, -1 },
+    { 57, 90, -2 },
+    { 57, 94, -2 },
+    { 57, 97, -2 },
+    { 57, 106, -1 },
+    { 57, 107, -2 },
+    { 57, 108, -2 },
+    { 57, 116, -1 },
+    { 57, 118, -2 },
+    { 57, 122, -1 },
+    { 57, 127, -1 },
+    { 57, 128, -1 },
+    { 57, 129, -1 },
+    { 57, 130, -1 },
+    { 57, 131, -1 },
+    { 57, 132, -1 },
+    { 57, 133, -2 },
+    { 57, 134, -1 },
+    { 57, 145, -1 },
+    { 57, 146, -1 },
+    { 57, 147, -1 },
+    { 57, 148, -1 },
+    { 57, 149, -1 },
+    { 57, 151, -1 },
+    { 57, 159, -2 },
+    { 57, 160, -2 },
+    { 57, 161, -2 },
+    { 57, 162, -2 },
+    { 57, 163, -2 },
+    { 57, 164, -2 },
+    { 57, 165, -2 },
+    { 57, 166, -2 },
+    { 57, 167, -2 },
+    { 57, 168, -2 },
+    { 57, 169, -2 },
+    { 57, 170, -2 },
+    { 57, 175, -2 },
+    { 57, 176, -1 },
+    { 57, 177, -2 },
+    { 57, 178, -2 },
+    { 57, 179, -2 },
+    { 57, 180, -2 },
+    { 57, 181, -2 },
+    { 57, 182, -2 },
+    { 57, 183, -2 },
+    { 57, 184, -1 },
+    { 57, 185, -1 },
+    { 57, 186, -1 },
+    { 57, 187, -1 },
+    { 57, 188, -1 },
+    { 57, 190, -1 },
+    { 57, 191, -2 },
+    { 57, 192, -2 },
+    { 57, 193, -2 },
+    { 57, 194, -2 },
+    { 57, 198, -3 },
+    { 57, 201, -3 },
+    { 57, 204, -1 },
+    { 57, 205, -3 },
+    { 57, 207, -1 },
+    { 57, 208, -1 },
+    { 57, 209, -2 },
+    { 57, 211, -1 },
+    { 58, 6, -1 },
+    { 58, 11, -2 },
+    { 58, 13, -2 },
+    { 58, 17, -1 },
+    { 58, 20, -1 },
+    { 58, 22, -1 },
+    { 58, 25, -1 },
+    { 58, 28, -1 },
+    { 58, 29, -1 },
+    { 58, 30, -1 },
+    { 58, 32, -1 },
+    { 58, 35, -1 },
+    { 58, 39, -1 },
+    { 58, 47, -1 },
+    { 58, 49, -1 },
+    { 58, 60, -1 },
+    { 58, 67, -1 },
+    { 58, 68, -1 },
+    { 58, 69, -1 },
+    { 58, 70, -1 },
+    { 58, 71, -1 },
+    { 58, 79, -1 },
+    { 58, 81, -1 },
+    { 58, 84, -1 },
+    { 58, 85, -1 },
+    { 58, 88, -1 },
+    { 58, 94, -2 },
+    { 58, 97, -1 },
+    { 58, 106, -1 },
+    { 58, 107, -2 },
+    { 58, 108, -2 },
+    { 58, 118, -2 },
+    { 58, 122, -1 },
+    { 58, 134, -1 },
+    { 58, 145, -1 },
+    { 58, 146, -1 },
+    { 58, 147, -1 },
+    { 58, 148, -1 },
+    { 58, 149, -1 },
+    { 58, 150, -1 },
+    { 58, 151, -1 },
+    { 58, 166, -1 },
+    { 58, 167, -1 },
+    { 58, 168, -1 },
+    { 58, 169, -1 },
+    { 58, 170, -1 },
+    { 58, 175, -1 },
+    { 58, 177, -1 },
+    { 58, 178, -1 },
+    { 58, 179, -1 },
+    { 58, 180, -1 },
+    { 58, 181, -1 },
+    { 58, 182, -2 },
+    { 58, 183, -1 },
+    { 58, 184, -1 },
+    { 58, 185, -1 },
+    { 58, 186, -1 },
+    { 58, 187, -1 },
+    { 58, 191, -2 },
+    { 58, 192, -2 },
+    { 58, 193, -2 },
+    { 58, 194, -2 },
+    { 58, 204, -1 },
+    { 58, 207, -1 },
+    { 58, 208, -1 },
+    { 58, 211, -1 },
+    { 59, 17, -1 },
+    { 59, 74, 1 },
+    { 59, 140, 1 },
+    { 59, 141, 1 },
+    { 59, 142, 1 },
+    { 59, 171, 1 },
+    { 59, 172, 1 },
+    { 59, 173, 1 },
+    { 59, 174, 1 },
+    { 60, 2, -3 },
+    { 60, 5, -2 },
+    { 60, 6, -2 },
+    { 60, 7, -3 },
+    { 60, 10, -2 },
+    { 60, 17, -1 },
+    { 60, 19, -1 },
+    { 60, 20, -1 },
+    { 60, 22, -1 },
+    { 60, 23, -1 },
+    { 60, 25, -1 },
+    { 60, 31, -2 },
+    { 60, 32, -1 },
+    { 60, 52, -1 },
+    { 60, 54, -1 },
+    { 60, 57, -2 },
+    { 60, 58, -1 },
+    { 60, 60, -4 },
+    { 60, 65, -1 },
+    { 60, 70, -1 },
+    { 60, 74, 1 },
+    { 60, 84, -1 },
+    { 60, 100, -1 },
+    { 60, 104, -1 },
+    { 60, 106, -1 },
+    { 60, 109, -2 },
+    { 60, 111, -3 },
+    { 60, 113, -2 },
+    { 60, 114, -2 },
+    { 60, 120, -2 },
+    { 60, 123, -2 },
+    { 60, 124, -2 },
+    { 60, 125, -2 },
+    { 60, 156, -2 },
+    { 60, 159, -1 },
+    { 60, 160, -1 },
+    { 60, 161, -1 },
+    { 60, 162, -1 },
+    { 60, 163, -1 },
+    { 60, 164, -1 },
+    { 60, 165, -1 },
+    { 60, 196, -3 },
+    { 60, 197, -3 },
+    { 60, 199, -3 },
+    { 60, 200, -3 },
+    { 60, 202, -1 },
+    { 60, 204, -1 },
+    { 60, 206, -2 },
+    { 60, 207, -1 },
+    { 60, 211, -1 },
+    { 63, 2, -3 },
+    { 63, 4, -1 },
+    { 63, 5, -2 },
+    { 63, 6, -1 },
+    { 63, 7, -3 },
+    { 63, 10, -3 },
+    { 63, 16, -1 },
+    { 63, 17, -3 },
+    { 63, 20, -4 },
+    { 63, 22, -1 },
+    { 63, 24, -1 },
+    { 63, 31, -2 },
+    { 63, 32, -1 },
+    { 63, 35, -1 },
+    { 63, 39, -1 },
+    { 63, 42, 1 },
+    { 63, 47, -1 },
+    { 63, 49, -1 },
+    { 63, 51, -1 },
+    { 63, 52, -1 },
+    { 63, 53, -1 },
+    { 63, 54, -1 },
+    { 63, 55, -2 },
+    { 63, 57, -2 },
+    { 63, 60, -4 },
+    { 63, 65, -1 },
+    { 63, 67, -1 },
+    { 63, 68, -1 },
+    { 63, 69, -1 },
+    { 63, 70, -1 },
+    { 63, 74, 1 },
+    { 63, 79, -1 },
+    { 63, 81, -1 },
+    { 63, 84, -1 },
+    { 63, 85, -1 },
+    { 63, 86, -1 },
+    { 63, 87, -1 },
+    { 63, 97, -1 },
+    { 63, 100, -2 },
+    { 63, 104, -3 },
+    { 63, 106, -1 },
+    { 63, 109, -3 },
+    { 63, 113, -2 },
+    { 63, 114, -2 },
+    { 63, 120, -2 },
+    { 63, 123, -2 },
+    { 63, 124, -2 },
+    { 63, 125, -2 },
+    { 63, 134, -1 },
+    { 63, 145, -1 },
+    { 63, 146, -1 },
+    { 63, 147, -1 },
+    { 63, 148, -1 },
+    { 63, 149, -1 },
+    { 63, 151, -1 },
+    { 63, 152, -1 },
+    { 63, 153, -1 },
+    { 63, 154, -1 },
+    { 63, 155, -1 },
+    { 63, 156, -2 },
+    { 63, 159, -1 },
+    { 63, 160, -1 },
+    { 63, 161, -1 },
+    { 63, 162, -1 },
+    { 63, 163, -1 },
+    { 63, 164, -1 },
+    { 63, 165, -1 },
+    { 63, 166, -1 },
+    { 63, 167, -1 },
+    { 63, 168, -1 },
+    { 63, 169, -1 },
+    { 63, 170, -1 },
+    { 63, 175, -1 },
+    { 63, 177, -1 },
+    { 63, 178, -1 },
+    { 63, 179, -1 },
+    { 63, 180, -1 },
+    { 63, 181, -1 },
+    { 63, 183, -1 },
+    { 63, 184, -1 },
+    { 63, 185, -1 },
+    { 63, 186, -1 },
+    { 63, 187, -1 },
+    { 63, 188, -1 },
+    { 63, 190, -1 },
+    { 63, 196, -3 },
+    { 63, 197, -3 },
+    { 63, 199, -3 },
+    { 63, 200, -3 },
+    { 63, 202, -3 },
+    { 63, 206, -2 },
+    { 63, 207, -1 },
+    { 65, 17, -1 },
+    { 65, 23, -1 },
+    { 65, 31, -1 },
+    { 65, 60, -1 },
+    { 66, 17, -1 },
+    { 66, 18, -1 },
+    { 66, 19, -1 },
+    { 66, 23, -1 },
+    { 66, 31, -1 },
+    { 66, 60, -1 },
+    { 66, 63, -1 },
+    { 66, 122, -1 },
+    { 66, 208, -1 },
+    { 66, 209, -1 },
+    { 66, 211, -1 },
+    { 67, 11, -1 },
+    { 67, 13, -1 },
+    { 67, 20, -1 },
+    { 67, 23, -1 },
+    { 67, 28, -1 },
+    { 67, 29, -1 },
+    { 67, 30, -1 },
+    { 67, 31, -1 },
+    { 67, 32, -1 },
+    { 67, 60, -1 },
+    { 67, 67, -1 },
+    { 67, 68, -1 },
+    { 67, 69, -1 },
+    { 67, 79, -1 },
+    { 67, 81, -1 },
+    { 67, 94, -1 },
+    { 67, 97, -1 },
+    { 67, 100, -1 },
+    { 67, 106, -1 },
+    { 67, 107, -1 },
+    { 67, 108, -1 },
+    { 67, 118, -1 },
+    { 67, 150, -1 },
+    { 67, 166, -1 },
+    { 67, 167, -1 },
+    { 67, 168, -1 },
+    { 67, 169, -1 },
+    { 67, 170, -1 },
+    { 67, 175, -1 },
+    { 67, 177, -1 },
+    { 67, 178, -1 },
+    { 67, 179, -1 },
+    { 67, 180, -1 },
+    { 67, 181, -1 },
+    { 67, 182, -1 },
+    { 67, 183, -1 },
+    { 67, 191, -1 },
+    { 67, 192, -1 },
+    { 67, 193, -1 },
+    { 67, 194, -1 },
+    { 67, 204, -1 },
+    { 67, 207, -1 },
+    { 69, 17, -1 },
+    { 69, 18, -1 },
+    { 69, 19, -1 },
+    { 69, 23, -1 },
+    { 69, 31, -1 },
+    { 69, 60, -1 },
+    { 69, 63, -1 },
+    { 69, 122, -1 },
+    { 69, 208, -1 },
+    { 69, 209, -1 },
+    { 69, 211, -1 },
+    { 70, 1, 1 },
+    { 70, 2, 2 },
+    { 70, 5, 1 },
+    { 70, 7, 2 },
+    { 70, 9, 2 },
+    { 70, 10, 1 },
+    { 70, 11, -1 },
+    { 70, 12, -1 },
+    { 70, 13, -1 },
+    { 70, 14, -1 },
+    { 70, 15, -1 },
+    { 70, 17, 1 },
+    { 70, 18, 1 },
+    { 70, 19, 1 },
+    { 70, 21, 1 },
+    { 70, 23, 2 },
+    { 70, 25, 1 },
+    { 70, 31, 1 },
+    { 70, 61, 1 },
+    { 70, 63, -1 },
+    { 70, 65, -1 },
+    { 70, 93, 1 },
+    { 70, 94, -1 },
+    { 70, 104, 1 },
+    { 70, 106, -1 },
+    { 70, 107, -1 },
+    { 70, 108, -1 },
+    { 70, 109, 1 },
+    { 70, 113, 1 },
+    { 70, 114, 1 },
+    { 70, 118, -1 },
+    { 70, 120, 1 },
+    { 70, 123, 1 },
+    { 70, 124, 1 },
+    { 70, 125, 1 },
+    { 70, 159, -1 },
+    { 70, 160, -1 },
+    { 70, 161, -1 },
+    { 70, 162, -1 },
+    { 70, 163, -1 },
+    { 70, 164, -1 },
+    { 70, 165, -1 },
+    { 70, 171, 2 },
+    { 70, 172, 2 },
+    { 70, 173, 2 },
+    { 70, 174, 2 },
+    { 70, 182, -1 },
+    { 70, 191, -1 },
+    { 70, 192, -1 },
+    { 70, 193, -1 },
+    { 70, 194, -1 },
+    { 70, 196, 2 },
+    { 70, 197, 2 },
+    { 70, 198, -1 },
+    { 70, 199, 2 },
+    { 70, 200, 2 },
+    { 70, 201, -1 },
+    { 70, 205, -1 },
+    { 70, 206, 1 },
+    { 70, 207, -1 },
+    { 70, 209, -1 },
+    { 70, 211, 1 },
+    { 71, 31, -1 },
+    { 71, 60, -1 },
+    { 71, 65, -1 },
+    { 71, 159, -1 },
+    { 71, 160, -1 },
+    { 71, 161, -1 },
+    { 71, 162, -1 },
+    { 71, 163, -1 },
+    { 71, 164, -1 },
+    { 71, 165, -1 },
+    { 72, 17, -1 },
+    { 72, 23, -1 },
+    { 72, 31, -1 },
+    { 72, 57, -1 },
+    { 72, 60, -1 },
+    { 72, 156, -1 },
+    { 72, 211, -1 },
+    { 75, 6, -1 },
+    { 75, 11, -1 },
+    { 75, 13, -1 },
+    { 75, 31, -1 },
+    { 75, 60, -1 },
+    { 75, 94, -1 },
+    { 75, 106, -1 },
+    { 75, 107, -1 },
+    { 75, 108, -1 },
+    { 75, 118, -1 },
+    { 75, 182, -1 },
+    { 75, 191, -1 },
+    { 75, 192, -1 },
+    { 75, 193, -1 },
+    { 75, 194, -1 },
+    { 75, 204, -1 },
+    { 75, 207, -1 },
+    { 76, 17, -1 },
+    { 76, 60, -1 },
+    { 77, 17, -1 },
+    { 77, 23, -1 },
+    { 77, 31, -1 },
+    { 77, 57, -1 },
+    { 77, 60, -1 },
+    { 77, 156, -1 },
+    { 77, 211, -1 },
+    { 78, 17, -1 },
+    { 78, 23, -1 },
+    { 78, 31, -1 },
+    { 78, 57, -1 },
+    { 78, 60, -1 },
+    { 78, 156, -1 },
+    { 78, 211, -1 },
+    { 79, 17, -1 },
+    { 79, 18, -1 },
+    { 79, 19, -1 },
+    { 79, 23, -1 },
+    { 79, 31, -1 },
+    { 79, 60, -1 },
+    { 79, 63, -1 },
+    { 79, 122, -1 },
+    { 79, 208, -1 },
+    { 79, 209, -1 },
+    { 79, 211, -1 },
+    { 80, 17, -1 },
+    { 80, 18, -1 },
+    { 80, 19, -1 },
+    { 80, 23, -1 },
+    { 80, 31, -1 },
+    { 80, 60, -1 },
+    { 80, 63, -1 },
+    { 80, 122, -1 },
+    { 80, 208, -1 },
+    { 80, 209, -1 },
+    { 80, 211, -1 },
+    { 81, 31, -1 },
+    { 81, 60, -1 },
+    { 82, 3, -1 },
+    { 82, 6, -1 },
+    { 82, 10, 1 },
+    { 82, 11, -1 },
+    { 82, 12, -2 },
+    { 82, 13, -1 },
+    { 82, 14, -2 },
+    { 82, 15, -2 },
+    { 82, 19, -1 },
+    { 82, 20, -1 },
+    { 82, 31, -1 },
+    { 82, 60, -1 },
+    { 82, 63, -2 },
+    { 82, 65, -1 },
+    { 82, 67, -1 },
+    { 82, 68, -1 },
+    { 82, 69, -1 },
+    { 82, 79, -1 },
+    { 82, 81, -1 },
+    { 82, 94, -1 },
+    { 82, 97, -1 },
+    { 82, 106, -1 },
+    { 82, 107, -1 },
+    { 82, 108, -1 },
+    { 82, 109, 1 },
+    { 82, 113, 1 },
+    { 82, 114, 1 },
+    { 82, 118, -1 },
+    { 82, 120, 1 },
+    { 82, 123, 1 },
+    { 82, 124, 1 },
+    { 82, 125, 1 },
+    { 82, 159, -1 },
+    { 82, 160, -1 },
+    { 82, 161, -1 },
+    { 82, 162, -1 },
+    { 82, 163, -1 },
+    { 82, 164, -1 },
+    { 82, 165, -1 },
+    { 82, 166, -1 },
+    { 82, 167, -1 },
+    { 82, 168, -1 },
+    { 82, 169, -1 },
+    { 82, 170, -1 },
+    { 82, 175, -1 },
+    { 82, 177, -1 },
+    { 82, 178, -1 },
+    { 82, 179, -1 },
+    { 82, 180, -1 },
+    { 82, 181, -1 },
+    { 82, 182, -1 },
+    { 82, 183, -1 },
+    { 82, 191, -1 },
+    { 82, 192, -1 },
+    { 82, 193, -1 },
+    { 82, 194, -1 },
+    { 82, 198, -2 },
+    { 82, 201, -2 },
+    { 82, 205, -2 },
+    { 82, 207, -1 },
+    { 82, 209, -2 },
+    { 83, 17, -1 },
+    { 83, 23, -1 },
+    { 83, 31, -1 },
+    { 83, 60, -1 },
+    { 83, 63, -1 },
+    { 83, 209, -1 },
+    { 84, 11, -1 },
+    { 84, 13, -1 },
+    { 84, 17, -1 },
+    { 84, 20, -1 },
+    { 84, 23, -1 },
+    { 84, 31, -1 },
+    { 84, 60, -1 },
+    { 84, 94, -1 },
+    { 84, 106, -1 },
+    { 84, 107, -1 },
+    { 84, 108, -1 },
+    { 84, 118, -1 },
+    { 84, 182, -1 },
+    { 84, 191, -1 },
+    { 84, 192, -1 },
+    { 84, 193, -1 },
+    { 84, 194, -1 },
+    { 84, 204, -1 },
+    { 84, 207, -1 },
+    { 85, 17, -1 },
+    { 85, 23, -1 },
+    { 85, 31, -1 },
+    { 85, 60, -1 },
+    { 86, 12, -1 },
+    { 86, 14, -1 },
+    { 86, 31, -1 },
+    { 86, 60, -1 },
+    { 86, 63, -1 },
+    { 86, 198, -1 },
+    { 86, 201, -1 },
+    { 86, 205, -1 },
+    { 86, 209, -1 },
+    { 87, 12, -1 },
+    { 87, 14, -1 },
+    { 87, 31, -1 },
+    { 87, 60, -1 },
+    { 87, 63, -1 },
+    { 87, 198, -1 },
+    { 87, 201, -1 },
+    { 87, 205, -1 },
+    { 87, 209, -1 },
+    { 88, 6, -1 },
+    { 88, 11, -1 },
+    { 88, 13, -1 },
+    { 88, 31, -1 },
+    { 88, 60, -1 },
+    { 88, 94, -1 },
+    { 88, 106, -1 },
+    { 88, 107, -1 },
+    { 88, 108, -1 },
+    { 88, 118, -1 },
+    { 88, 182, -1 },
+    { 88, 191, -1 },
+    { 88, 192, -1 },
+    { 88, 193, -1 },
+    { 88, 194, -1 },
+    { 88, 204, -1 },
+    { 88, 207, -1 },
+    { 89, 12, -1 },
+    { 89, 14, -1 },
+    { 89, 31, -1 },
+    { 89, 60, -1 },
+    { 89, 63, -1 },
+    { 89, 198, -1 },
+    { 89, 201, -1 },
+    { 89, 205, -1 },
+    { 89, 209, -1 },
+    { 90, 6, -1 },
+    { 90, 11, -1 },
+    { 90, 13, -1 },
+    { 90, 20, -1 },
+    { 90, 31, -1 },
+    { 90, 60, -1 },
+    { 90, 94, -1 },
+    { 90, 106, -1 },
+    { 90, 107, -1 },
+    { 90, 108, -1 },
+    { 90, 118, -1 },
+    { 90, 182, -1 },
+    { 90, 191, -1 },
+    { 90, 192, -1 },
+    { 90, 193, -1 },
+    { 90, 194, -1 },
+    { 90, 207, -1 },
+    { 91, 74, 1 },
+    { 91, 140, 1 },
+    { 91, 141, 1 },
+    { 91, 142, 1 },
+    { 91, 171, 1 },
+    { 91, 172, 1 },
+    { 91, 173, 1 },
+    { 91, 174, 1 },
+    { 94, 4, -1 },
+    { 94, 5, -1 },
+    { 94, 6, -1 },
+    { 94, 12, -1 },
+    { 94, 14, -1 },
+    { 94, 15, -2 },
+    { 94, 17, -2 },
+    { 94, 18, -2 },
+    { 94, 19, -2 },
+    { 94, 23, -2 },
+    { 94, 31, -2 },
+    { 94, 51, -1 },
+    { 94, 52, -1 },
+    { 94, 54, -1 },
+    { 94, 56, -1 },
+    { 94, 57, -2 },
+    { 94, 58, -1 },
+    { 94, 60, -2 },
+    { 94, 63, -2 },
+    { 94, 88, -1 },
+    { 94, 90, -1 },
+    { 94, 100, -1 },
+    { 94, 122, -1 },
+    { 94, 126, -2 },
+    { 94, 133, -1 },
+    { 94, 156, -2 },
+    { 94, 198, -1 },
+    { 94, 201, -1 },
+    { 94, 205, -1 },
+    { 94, 206, -1 },
+    { 94, 208, -1 },
+    { 94, 209, -2 },
+    { 94, 211, -1 },
+    { 96, 17, -1 },
+    { 96, 23, -1 },
+    { 96, 31, -1 },
+    { 96, 52, -1 },
+    { 96, 54, -1 },
+    { 96, 57, -1 },
+    { 96, 60, -1 },
+    { 96, 74, 1 },
+    { 96, 156, -1 },
+    { 97, 11, -1 },
+    { 97, 13, -1 },
+    { 97, 20, -1 },
+    { 97, 23, -1 },
+    { 97, 28, -1 },
+    { 97, 29, -1 },
+    { 97, 30, -1 },
+    { 97, 31, -1 },
+    { 97, 32, -1 },
+    { 97, 60, -1 },
+    { 97, 67, -1 },
+    { 97, 68, -1 },
+    { 97, 69, -1 },
+    { 97, 79, -1 },
+    { 97, 81, -1 },
+    { 97, 94, -1 },
+    { 97, 97, -1 },
+    { 97, 100, -1 },
+    { 97, 106, -1 },
+    { 97, 107, -1 },
+    { 97, 108, -1 },
+    { 97, 118, -1 },
+    { 97, 150, -1 },
+    { 97, 166, -1 },
+    { 97, 167, -1 },
+    { 97, 168, -1 },
+    { 97, 169, -1 },
+    { 97, 170, -1 },
+    { 97, 175, -1 },
+    { 97, 177, -1 },
+    { 97, 178, -1 },
+    { 97, 179, -1 },
+    { 97, 180, -1 },
+    { 97, 181, -1 },
+    { 97, 182, -1 },
+    { 97, 183, -1 },
+    { 97, 191, -1 },
+    { 97, 192, -1 },
+    { 97, 193, -1 },
+    { 97, 194, -1 },
+    { 97, 204, -1 },
+    { 97, 207, -1 },
+    { 98, 6, -1 },
+    { 98, 16, -1 },
+    { 98, 17, -1 },
+    { 98, 20, -1 },
+    { 98, 22, -1 },
+    { 98, 24, -1 },
+    { 98, 25, -1 },
+    { 98, 28, -1 },
+    { 98, 29, -1 },
+    { 98, 30, -1 },
+    { 98, 32, -1 },
+    { 98, 35, -1 },
+    { 98, 39, -1 },
+    { 98, 47, -1 },
+    { 98, 49, -1 },
+    { 98, 60, -1 },
+    { 98, 106, -1 },
+    { 98, 122, -1 },
+    { 98, 134, -1 },
+    { 98, 145, -1 },
+    { 98, 146, -1 },
+    { 98, 147, -1 },
+    { 98, 148, -1 },
+    { 98, 149, -1 },
+    { 98, 150, -1 },
+    { 98, 151, -1 },
+    { 98, 204, -1 },
+    { 98, 207, -1 },
+    { 98, 208, -1 },
+    { 98, 211, -1 },
+    { 100, 1, 1 },
+    { 100, 4, -1 },
+    { 100, 6, -1 },
+    { 100, 15, -1 },
+    { 100, 17, -1 },
+    { 100, 20, -1 },
+    { 100, 22, -1 },
+    { 100, 28, -1 },
+    { 100, 29, -1 },
+    { 100, 30, -1 },
+    { 100, 32, -1 },
+    { 100, 35, -1 },
+    { 100, 39, -1 },
+    { 100, 47, -1 },
+    { 100, 49, -1 },
+    { 100, 51, -1 },
+    { 100, 63, -2 },
+    { 100, 67, -1 },
+    { 100, 68, -1 },
+    { 100, 69, -1 },
+    { 100, 79, -1 },
+    { 100, 81, -1 },
+    { 100, 97, -1 },
+    { 100, 98, -1 },
+    { 100, 106, -1 },
+    { 100, 122, -1 },
+    { 100, 134, -1 },
+    { 100, 145, -1 },
+    { 100, 146, -1 },
+    { 100, 147, -1 },
+    { 100, 148, -1 },
+    { 100, 149, -1 },
+    { 100, 150, -1 },
+    { 100, 151, -1 },
+    { 100, 166, -1 },
+    { 100, 167, -1 },
+    { 100, 168, -1 },
+    { 100, 169, -1 },
+    { 100, 170, -1 },
+    { 100, 175, -1 },
+    { 100, 177, -1 },
+    { 100, 178, -1 },
+    { 100, 179, -1 },
+    { 100, 180, -1 },
+    { 100, 181, -1 },
+    { 100, 183, -1 },
+    { 100, 204, -1 },
+    { 100, 207, -1 },
+    { 100, 208, -1 },
+    { 100, 209, -2 },
+    { 102, 17, -1 },
+    { 102, 20, -1 },
+    { 102, 23, -1 },
+    { 102, 211, -1 },
+    { 104, 12, -2 },
+    { 104, 14, -2 },
+    { 104, 15, -1 },
+    { 104, 63, -3 },
+    { 104, 198, -2 },
+    { 104, 201, -2 },
+    { 104, 205, -2 },
+    { 104, 209, -3 },
+    { 106, 17, -1 },
+    { 106, 20, -1 },
+    { 106, 23, -1 },
+    { 106, 32, -1 },
+    { 106, 52, -1 },
+    { 106, 57, -1 },
+    { 106, 58, -1 },
+    { 106, 60, -1 },
+    { 106, 67, -1 },
+    { 106, 68, -1 },
+    { 106, 69, -1 },
+    { 106, 79, -1 },
+    { 106, 81, -1 },
+    { 106, 97, -1 },
+    { 106, 100, -1 },
+    { 106, 106, -1 },
+    { 106, 156, -1 },
+    { 106, 166, -1 },
+    { 106, 167, -1 },
+    { 106, 168, -1 },
+    { 106, 169, -1 },
+    { 106, 170, -1 },
+    { 106, 175, -1 },
+    { 106, 177, -1 },
+    { 106, 178, -1 },
+    { 106, 179, -1 },
+    { 106, 180, -1 },
+    { 106, 181, -1 },
+    { 106, 183, -1 },
+    { 106, 204, -1 },
+    { 106, 207, -1 },
+    { 106, 211, -1 },
+    { 108, 4, -1 },
+    { 108, 5, -1 },
+    { 108, 6, -1 },
+    { 108, 12, -1 },
+    { 108, 14, -1 },
+    { 108, 15, -2 },
+    { 108, 17, -2 },
+    { 108, 18, -2 },
+    { 108, 19, -2 },
+    { 108, 23, -2 },
+    { 108, 31, -2 },
+    { 108, 51, -1 },
+    { 108, 52, -1 },
+    { 108, 54, -1 },
+    { 108, 56, -1 },
+    { 108, 57, -2 },
+    { 108, 58, -1 },
+    { 108, 60, -2 },
+    { 108, 63, -2 },
+    { 108, 88, -1 },
+    { 108, 90, -1 },
+    { 108, 100, -1 },
+    { 108, 122, -1 },
+    { 108, 126, -2 },
+    { 108, 133, -1 },
+    { 108, 156, -2 },
+    { 108, 198, -1 },
+    { 108, 201, -1 },
+    { 108, 205, -1 },
+    { 108, 206, -1 },
+    { 108, 208, -1 },
+    { 108, 209, -2 },
+    { 108, 211, -1 },
+    { 109, 3, -1 },
+    { 109, 15, -2 },
+    { 109, 20, -1 },
+    { 109, 32, -1 },
+    { 109, 33, -1 },
+    { 109, 63, -3 },
+    { 109, 65, -1 },
+    { 109, 98, -1 },
+    { 109, 106, -1 },
+    { 109, 126, -2 },
+    { 109, 127, -1 },
+    { 109, 128, -1 },
+    { 109, 129, -1 },
+    { 109, 130, -1 },
+    { 109, 131, -1 },
+    { 109, 132, -1 },
+    { 109, 133, -1 },
+    { 109, 159, -1 },
+    { 109, 160, -1 },
+    { 109, 161, -1 },
+    { 109, 162, -1 },
+    { 109, 163, -1 },
+    { 109, 164, -1 },
+    { 109, 165, -1 },
+    { 109, 171, 1 },
+    { 109, 172, 1 },
+    { 109, 173, 1 },
+    { 109, 174, 1 },
+    { 109, 207, -1 },
+    { 109, 209, -3 },
+    { 111, 1, -2 },
+    { 111, 2, -2 },
+    { 111, 7, -2 },
+    { 111, 10, -2 },
+    { 111, 15, -5 },
+    { 111, 31, -3 },
+    { 111, 60, -3 },
+    { 111, 63, -3 },
+    { 111, 109, -2 },
+    { 111, 196, -2 },
+    { 111, 197, -2 },
+    { 111, 199, -2 },
+    { 111, 200, -2 },
+    { 111, 209, -3 },
+    { 113, 15, -2 },
+    { 113, 63, -2 },
+    { 113, 65, -1 },
+    { 113, 126, -2 },
+    { 113, 133, -1 },
+    { 113, 159, -1 },
+    { 113, 160, -1 },
+    { 113, 161, -1 },
+    { 113, 162, -1 },
+    { 113, 163, -1 },
+    { 113, 164, -1 },
+    { 113, 165, -1 },
+    { 113, 209, -2 },
+    { 114, 15, -2 },
+    { 114, 63, -2 },
+    { 114, 65, -1 },
+    { 114, 126, -2 },
+    { 114, 133, -1 },
+    { 114, 159, -1 },
+    { 114, 160, -1 },
+    { 114, 161, -1 },
+    { 114, 162, -1 },
+    { 114, 163, -1 },
+    { 114, 164, -1 },
+    { 114, 165, -1 },
+    { 114, 209, -2 },
+    { 116, 17, -1 },
+    { 116, 23, -1 },
+    { 116, 31, -1 },
+    { 116, 60, -1 },
+    { 118, 4, -1 },
+    { 118, 5, -1 },
+    { 118, 6, -1 },
+    { 118, 12, -1 },
+    { 118, 14, -1 },
+    { 118, 15, -2 },
+    { 118, 17, -2 },
+    { 118, 18, -2 },
+    { 118, 19, -2 },
+    { 118, 23, -2 },
+    { 118, 31, -2 },
+    { 118, 51, -1 },
+    { 118, 52, -1 },
+    { 118, 54, -1 },
+    { 118, 56, -1 },
+    { 118, 57, -2 },
+    { 118, 58, -1 },
+    { 118, 60, -2 },
+    { 118, 63, -2 },
+    { 118, 88, -1 },
+    { 118, 90, -1 },
+    { 118, 100, -1 },
+    { 118, 122, -1 },
+    { 118, 126, -2 },
+    { 118, 133, -1 },
+    { 118, 156, -2 },
+    { 118, 198, -1 },
+    { 118, 201, -1 },
+    { 118, 205, -1 },
+    { 118, 206, -1 },
+    { 118, 208, -1 },
+    { 118, 209, -2 },
+    { 118, 211, -1 },
+    { 120, 15, -2 },
+    { 120, 63, -2 },
+    { 120, 65, -1 },
+    { 120, 126, -2 },
+    { 120, 133, -1 },
+    { 120, 159, -1 },
+    { 120, 160, -1 },
+    { 120, 161, -1 },
+    { 120, 162, -1 },
+    { 120, 163, -1 },
+    { 120, 164, -1 },
+    { 120, 165, -1 },
+    { 120, 209, -2 },
+    { 122, 2, -1 },
+    { 122, 4, -1 },
+    { 122, 7, -1 },
+    { 122, 10, -1 },
+    { 122, 15, -1 },
+    { 122, 17, -1 },
+    { 122, 18, -1 },
+    { 122, 19, -1 },
+    { 122, 21, -1 },
+    { 122, 23, -1 },
+    { 122, 25, -1 },
+    { 122, 31, -1 },
+    { 122, 51, -1 },
+    { 122, 52, -1 },
+    { 122, 54, -1 },
+    { 122, 57, -1 },
+    { 122, 58, -1 },
+    { 122, 60, -1 },
+    { 122, 63, -1 },
+    { 122, 88, -1 },
+    { 122, 100, -1 },
+    { 122, 109, -1 },
+    { 122, 122, -3 },
+    { 122, 126, -1 },
+    { 122, 156, -1 },
+    { 122, 196, -1 },
+    { 122, 197, -1 },
+    { 122, 199, -1 },
+    { 122, 200, -1 },
+    { 122, 202, -1 },
+    { 122, 208, -3 },
+    { 122, 209, -1 },
+    { 122, 211, -1 },
+    { 123, 2, -1 },
+    { 123, 5, -1 },
+    { 123, 7, -1 },
+    { 123, 10, -1 },
+    { 123, 17, -2 },
+    { 123, 23, -1 },
+    { 123, 31, -1 },
+    { 123, 52, -2 },
+    { 123, 54, -1 },
+    { 123, 57, -2 },
+    { 123, 60, -2 },
+    { 123, 63, -1 },
+    { 123, 109, -1 },
+    { 123, 156, -2 },
+    { 123, 196, -1 },
+    { 123, 197, -1 },
+    { 123, 199, -1 },
+    { 123, 200, -1 },
+    { 123, 206, -1 },
+    { 123, 209, -1 },
+    { 123, 211, -1 },
+    { 124, 2, -1 },
+    { 124, 5, -1 },
+    { 124, 7, -1 },
+    { 124, 10, -1 },
+    { 124, 17, -2 },
+    { 124, 23, -1 },
+    { 124, 31, -1 },
+    { 124, 52, -2 },
+    { 124, 54, -1 },
+    { 124, 57, -2 },
+    { 124, 60, -2 },
+    { 124, 63, -1 },
+    { 124, 109, -1 },
+    { 124, 156, -2 },
+    { 124, 196, -1 },
+    { 124, 197, -1 },
+    { 124, 199, -1 },
+    { 124, 200, -1 },
+    { 124, 206, -1 },
+    { 124, 209, -1 },
+    { 124, 211, -1 },
+    { 125, 2, -1 },
+    { 125, 5, -1 },
+    { 125, 7, -1 },
+    { 125, 10, -1 },
+    { 125, 17, -2 },
+    { 125, 23, -1 },
+    { 125, 31, -1 },
+    { 125, 52, -2 },
+    { 125, 54, -1 },
+    { 125, 57, -2 },
+    { 125, 60, -2 },
+    { 125, 63, -1 },
+    { 125, 109, -1 },
+    { 125, 156, -2 },
+    { 125, 196, -1 },
+    { 125, 197, -1 },
+    { 125, 199, -1 },
+    { 125, 200, -1 },
+    { 125, 206, -1 },
+    { 125, 209, -1 },
+    { 125, 211, -1 },
+    { 126, 1, -1 },
+    { 126, 2, -1 },
+    { 126, 3, -1 },
+    { 126, 4, -1 },
+    { 126, 5, -1 },
+    { 126, 6, -1 },
+    { 126, 7, -1 },
+    { 126, 10, -1 },
+    { 126, 16, -1 },
+    { 126, 17, -2 },
+    { 126, 18, -1 },
+    { 126, 19, -1 },
+    { 126, 20, -1 },
+    { 126, 21, -1 },
+    { 126, 22, -1 },
+    { 126, 23, -1 },
+    { 126, 24, -1 },
+    { 126, 25, -1 },
+    { 126, 31, -3 },
+    { 126, 32, -1 },
+    { 126, 33, -1 },
+    { 126, 35, -1 },
+    { 126, 39, -1 },
+    { 126, 47, -1 },
+    { 126, 49, -1 },
+    { 126, 51, -1 },
+    { 126, 52, -2 },
+    { 126, 54, -1 },
+    { 126, 55, -1 },
+    { 126, 56, -1 },
+    { 126, 57, -3 },
+    { 126, 60, -3 },
+    { 126, 65, -1 },
+    { 126, 67, -1 },
+    { 126, 68, -1 },
+    { 126, 69, -1 },
+    { 126, 70, -1 },
+    { 126, 77, -1 },
+    { 126, 78, -1 },
+    { 126, 79, -1 },
+    { 126, 80, -1 },
+    { 126, 81, -1 },
+    { 126, 82, -1 },
+    { 126, 84, -1 },
+    { 126, 86, -1 },
+    { 126, 87, -1 },
+    { 126, 89, -1 },
+    { 126, 96, -1 },
+    { 126, 97, -1 },
+    { 126, 106, -1 },
+    { 126, 109, -1 },
+    { 126, 113, -2 },
+    { 126, 114, -2 },
+    { 126, 116, -1 },
+    { 126, 120, -2 },
+    { 126, 122, -1 },
+    { 126, 123, -2 },
+    { 126, 124, -2 },
+    { 126, 125, -2 },
+    { 126, 126, -1 },
+    { 126, 127, -1 },
+    { 126, 128, -1 },
+    { 126, 129, -1 },
+    { 126, 130, -1 },
+    { 126, 131, -1 },
+    { 126, 132, -1 },
+    { 126, 133, -1 },
+    { 126, 134, -1 },
+    { 126, 145, -1 },
+    { 126, 146, -1 },
+    { 126, 147, -1 },
+    { 126, 148, -1 },
+    { 126, 149, -1 },
+    { 126, 151, -1 },
+    { 126, 156, -3 },
+    { 126, 159, -1 },
+    { 126, 160, -1 },
+    { 126, 161, -1 },
+    { 126, 162, -1 },
+    { 126, 163, -1 },
+    { 126, 164, -1 },
+    { 126, 165, -1 },
+    { 126, 166, -1 },
+    { 126, 167, -1 },
+    { 126, 168, -1 },
+    { 126, 169, -1 },
+    { 126, 170, -1 },
+    { 126, 175, -1 },
+    { 126, 176, -1 },
+    { 126, 177, -1 },
+    { 126, 178, -1 },
+    { 126, 179, -1 },
+    { 126, 180, -1 },
+    { 126, 181, -1 },
+    { 126, 183, -1 },
+    { 126, 188, -1 },
+    { 126, 190, -1 },
+    { 126, 196, -1 },
+    { 126, 197, -1 },
+    { 126, 199, -1 },
+    { 126, 200, -1 },
+    { 126, 204, -1 },
+    { 126, 206, -1 },
+    { 126, 207, -1 },
+    { 126, 208, -1 },
+    { 126, 211, -1 },
+    { 127, 2, -1 },
+    { 127, 7, -1 },
+    { 127, 10, -1 },
+    { 127, 17, -1 },
+    { 127, 20, -1 },
+    { 127, 23, -1 },
+    { 127, 31, -1 },
+    { 127, 52, -1 },
+    { 127, 57, -1 },
+    { 127, 60, -1 },
+    { 127, 109, -1 },
+    { 127, 156, -1 },
+    { 127, 196, -1 },
+    { 127, 197, -1 },
+    { 127, 199, -1 },
+    { 127, 200, -1 },
+    { 127, 211, -1 },
+    { 128, 2, -1 },
+    { 128, 7, -1 },
+    { 128, 10, -1 },
+    { 128, 17, -1 },
+    { 128, 20, -1 },
+    { 128, 23, -1 },
+    { 128, 31, -1 },
+    { 128, 52, -1 },
+    { 128, 57, -1 },
+    { 128, 60, -1 },
+    { 128, 109, -1 },
+    { 128, 156, -1 },
+    { 128, 196, -1 },
+    { 128, 197, -1 },
+    { 128, 199, -1 },
+    { 128, 200, -1 },
+    { 128, 211, -1 },
+    { 129, 2, -1 },
+    { 129, 7, -1 },
+    { 129, 10, -1 },
+    { 129, 17, -1 },
+    { 129, 20, -1 },
+    { 129, 23, -1 },
+    { 129, 31, -1 },
+    { 129, 52, -1 },
+    { 129, 57, -1 },
+    { 129, 60, -1 },
+    { 129, 109, -1 },
+    { 129, 156, -1 },
+    { 129, 196, -1 },
+    { 129, 197, -1 },
+    { 129, 199, -1 },
+    { 129, 200, -1 },
+    { 129, 211, -1 },
+    { 130, 2, -1 },
+    { 130, 7, -1 },
+    { 130, 10, -1 },
+    { 130, 17, -1 },
+    { 130, 20, -1 },
+    { 130, 23, -1 },
+    { 130, 31, -1 },
+    { 130, 52, -1 },
+    { 130, 57, -1 },
+    { 130, 60, -1 },
+    { 130, 109, -1 },
+    { 130, 156, -1 },
+    { 130, 196, -1 },
+    { 130, 197, -1 },
+    { 130, 199, -1 },
+    { 130, 200, -1 },
+    { 130, 211, -1 },
+    { 131, 2, -1 },
+    { 131, 7, -1 },
+    { 131, 10, -1 },
+    { 131, 17, -1 },
+    { 131, 20, -1 },
+    { 131, 23, -1 },
+    { 131, 31, -1 },
+    { 131, 52, -1 },
+    { 131, 57, -1 },
+    { 131, 60, -1 },
+    { 131, 109, -1 },
+    { 131, 156, -1 },
+    { 131, 196, -1 },
+    { 131, 197, -1 },
+    { 131, 199, -1 },
+    { 131, 200, -1 },
+    { 131, 211, -1 },
+    { 132, 2, -1 },
+    { 132, 7, -1 },
+    { 132, 10, -1 },
+    { 132, 17, -1 },
+    { 132, 20, -1 },
+    { 132, 23, -1 },
+    { 132, 31, -1 },
+    { 132, 52, -1 },
+    { 132, 57, -1 },
+    { 132, 60, -1 },
+    { 132, 109, -1 },
+    { 132, 156, -1 },
+    { 132, 196, -1 },
+    { 132, 197, -1 },
+    { 132, 199, -1 },
+    { 132, 200, -1 },
+    { 132, 211, -1 },
+    { 133, 11, -1 },
+    { 133, 13, -1 },
+    { 133, 17, -1 },
+    { 133, 20, -1 },
+    { 133, 60, -1 },
+    { 133, 67, -1 },
+    { 133, 68, -1 },
+    { 133, 69, -1 },
+    { 133, 70, -1 },
+    { 133, 71, -1 },
+    { 133, 79, -1 },
+    { 133, 81, -1 },
+    { 133, 86, -1 },
+    { 133, 89, -1 },
+    { 133, 94, -1 },
+    { 133, 97, -1 },
+    { 133, 106, -1 },
+    { 133, 107, -1 },
+    { 133, 108, -1 },
+    { 133, 118, -1 },
+    { 133, 166, -1 },
+    { 133, 167, -1 },
+    { 133, 168, -1 },
+    { 133, 169, -1 },
+    { 133, 170, -1 },
+    { 133, 175, -1 },
+    { 133, 177, -1 },
+    { 133, 178, -1 },
+    { 133, 179, -1 },
+    { 133, 180, -1 },
+    { 133, 181, -1 },
+    { 133, 182, -1 },
+    { 133, 183, -1 },
+    { 133, 188, -1 },
+    { 133, 190, -1 },
+    { 133, 191, -1 },
+    { 133, 192, -1 },
+    { 133, 193, -1 },
+    { 133, 194, -1 },
+    { 133, 207, -1 },
+    { 133, 211, -1 },
+    { 134, 11, -2 },
+    { 134, 13, -2 },
+    { 134, 16, -1 },
+    { 134, 17, -2 },
+    { 134, 20, -1 },
+    { 134, 22, -1 },
+    { 134, 24, -1 },
+    { 134, 25, -1 },
+    { 134, 28, -2 },
+    { 134, 29, -2 },
+    { 134, 30, -2 },
+    { 134, 32, -1 },
+    { 134, 35, -1 },
+    { 134, 39, -1 },
+    { 134, 47, -1 },
+    { 134, 49, -1 },
+    { 134, 60, -1 },
+    { 134, 67, -1 },
+    { 134, 68, -1 },
+    { 134, 69, -1 },
+    { 134, 70, -1 },
+    { 134, 71, -1 },
+    { 134, 79, -1 },
+    { 134, 81, -1 },
+    { 134, 84, -1 },
+    { 134, 86, -1 },
+    { 134, 87, -1 },
+    { 134, 89, -1 },
+    { 134, 94, -2 },
+    { 134, 97, -1 },
+    { 134, 106, -1 },
+    { 134, 107, -2 },
+    { 134, 108, -2 },
+    { 134, 118, -2 },
+    { 134, 122, -1 },
+    { 134, 134, -1 },
+    { 134, 145, -1 },
+    { 134, 146, -1 },
+    { 134, 147, -1 },
+    { 134, 148, -1 },
+    { 134, 149, -1 },
+    { 134, 150, -2 },
+    { 134, 151, -1 },
+    { 134, 166, -1 },
+    { 134, 167, -1 },
+    { 134, 168, -1 },
+    { 134, 169, -1 },
+    { 134, 170, -1 },
+    { 134, 175, -1 },
+    { 134, 177, -1 },
+    { 134, 178, -1 },
+    { 134, 179, -1 },
+    { 134, 180, -1 },
+    { 134, 181, -1 },
+    { 134, 182, -2 },
+    { 134, 183, -1 },
+    { 134, 188, -1 },
+    { 134, 190, -1 },
+    { 134, 191, -2 },
+    { 134, 192, -2 },
+    { 134, 193, -2 },
+    { 134, 194, -2 },
+    { 134, 204, -2 },
+    { 134, 207, -1 },
+    { 134, 208, -1 },
+    { 134, 211, -1 },
+    { 135, 11, -1 },
+    { 135, 13, -1 },
+    { 135, 17, -1 },
+    { 135, 20, -1 },
+    { 135, 60, -1 },
+    { 135, 67, -1 },
+    { 135, 68, -1 },
+    { 135, 69, -1 },
+    { 135, 70, -1 },
+    { 135, 71, -1 },
+    { 135, 79, -1 },
+    { 135, 81, -1 },
+    { 135, 86, -1 },
+    { 135, 89, -1 },
+    { 135, 94, -1 },
+    { 135, 97, -1 },
+    { 135, 106, -1 },
+    { 135, 107, -1 },
+    { 135, 108, -1 },
+    { 135, 118, -1 },
+    { 135, 166, -1 },
+    { 135, 167, -1 },
+    { 135, 168, -1 },
+    { 135, 169, -1 },
+    { 135, 170, -1 },
+    { 135, 175, -1 },
+    { 135, 177, -1 },
+    { 135, 178, -1 },
+    { 135, 179, -1 },
+    { 135, 180, -1 },
+    { 135, 181, -1 },
+    { 135, 182, -1 },
+    { 135, 183, -1 },
+    { 135, 188, -1 },
+    { 135, 190, -1 },
+    { 135, 191, -1 },
+    { 135, 192, -1 },
+    { 135, 193, -1 },
+    { 135, 194, -1 },
+    { 135, 207, -1 },
+    { 135, 211, -1 },
+    { 136, 11, -1 },
+    { 136, 13, -1 },
+    { 136, 17, -1 },
+    { 136, 20, -1 },
+    { 136, 60, -1 },
+    { 136, 67, -1 },
+    { 136, 68, -1 },
+    { 136, 69, -1 },
+    { 136, 70, -1 },
+    { 136, 71, -1 },
+    { 136, 79, -1 },
+    { 136, 81, -1 },
+    { 136, 86, -1 },
+    { 136, 89, -1 },
+    { 136, 94, -1 },
+    { 136, 97, -1 },
+    { 136, 106, -1 },
+    { 136, 107, -1 },
+    { 136, 108, -1 },
+    { 136, 118, -1 },
+    { 136, 166, -1 },
+    { 136, 167, -1 },
+    { 136, 168, -1 },
+    { 136, 169, -1 },
+    { 136, 170, -1 },
+    { 136, 175, -1 },
+    { 136, 177, -1 },
+    { 136, 178, -1 },
+    { 136, 179, -1 },
+    { 136, 180, -1 },
+    { 136, 181, -1 },
+    { 136, 182, -1 },
+    { 136, 183, -1 },
+    { 136, 188, -1 },
+    { 136, 190, -1 },
+    { 136, 191, -1 },
+    { 136, 192, -1 },
+    { 136, 193, -1 },
+    { 136, 194, -1 },
+    { 136, 207, -1 },
+    { 136, 211, -1 },
+    { 137, 11, -1 },
+    { 137, 13, -1 },
+    { 137, 17, -1 },
+    { 137, 20, -1 },
+    { 137, 60, -1 },
+    { 137, 67, -1 },
+    { 137, 68, -1 },
+    { 137, 69, -1 },
+    { 137, 70, -1 },
+    { 137, 71, -1 },
+    { 137, 79, -1 },
+    { 137, 81, -1 },
+    { 137, 86, -1 },
+    { 137, 89, -1 },
+    { 137, 94, -1 },
+    { 137, 97, -1 },
+    { 137, 106, -1 },
+    { 137, 107, -1 },
+    { 137, 108, -1 },
+    { 137, 118, -1 },
+    { 137, 166, -1 },
+    { 137, 167, -1 },
+    { 137, 168, -1 },
+    { 137, 169, -1 },
+    { 137, 170, -1 },
+    { 137, 175, -1 },
+    { 137, 177, -1 },
+    { 137, 178, -1 },
+    { 137, 179, -1 },
+    { 137, 180, -1 },
+    { 137, 181, -1 },
+    { 137, 182, -1 },
+    { 137, 183, -1 },
+    { 137, 188, -1 },
+    { 137, 190, -1 },
+    { 137, 191, -1 },
+    { 137, 192, -1 },
+    { 137, 193, -1 },
+    { 137, 194, -1 },
+    { 137, 207, -1 },
+    { 137, 211, -1 },
+    { 138, 11, -1 },
+    { 138, 13, -1 },
+    { 138, 17, -1 },
+    { 138, 20, -1 },
+    { 138, 60, -1 },
+    { 138, 67, -1 },
+    { 138, 68, -1 },
+    { 138, 69, -1 },
+    { 138, 70, -1 },
+    { 138, 71, -1 },
+    { 138, 79, -1 },
+    { 138, 81, -1 },
+    { 138, 86, -1 },
+    { 138, 89, -1 },
+    { 138, 94, -1 },
+    { 138, 97, -1 },
+    { 138, 106, -1 },
+    { 138, 107, -1 },
+    { 138, 108, -1 },
+    { 138, 118, -1 },
+    { 138, 166, -1 },
+    { 138, 167, -1 },
+    { 138, 168, -1 },
+    { 138, 169, -1 },
+    { 138, 170, -1 },
+    { 138, 175, -1 },
+    { 138, 177, -1 },
+    { 138, 178, -1 },
+    { 138, 179, -1 },
+    { 138, 180, -1 },
+    { 138, 181, -1 },
+    { 138, 182, -1 },
+    { 138, 183, -1 },
+    { 138, 188, -1 },
+    { 138, 190, -1 },
+    { 138, 191, -1 },
+    { 138, 192, -1 },
+    { 138, 193, -1 },
+    { 138, 194, -1 },
+    { 138, 207, -1 },
+    { 138, 211, -1 },
+    { 140, 9, 1 },
+    { 140, 61, 1 },
+    { 140, 93, 1 },
+    { 141, 9, 1 },
+    { 141, 61, 1 },
+    { 141, 93, 1 },
+    { 142, 9, 1 },
+    { 142, 61, 1 },
+    { 142, 93, 1 },
+    { 143, 12, -1 },
+    { 143, 14, -1 },
+    { 143, 18, -1 },
+    { 143, 19, -1 },
+    { 143, 23, -1 },
+    { 143, 31, -1 },
+    { 143, 52, -1 },
+    { 143, 57, -1 },
+    { 143, 58, -1 },
+    { 143, 60, -1 },
+    { 143, 63, -1 },
+    { 143, 133, -1 },
+    { 143, 156, -1 },
+    { 143, 198, -1 },
+    { 143, 201, -1 },
+    { 143, 205, -1 },
+    { 143, 209, -1 },
+    { 145, 12, -1 },
+    { 145, 14, -1 },
+    { 145, 18, -1 },
+    { 145, 19, -1 },
+    { 145, 23, -1 },
+    { 145, 31, -1 },
+    { 145, 52, -1 },
+    { 145, 57, -1 },
+    { 145, 58, -1 },
+    { 145, 60, -1 },
+    { 145, 63, -1 },
+    { 145, 133, -1 },
+    { 145, 156, -1 },
+    { 145, 198, -1 },
+    { 145, 201, -1 },
+    { 145, 205, -1 },
+    { 145, 209, -1 },
+    { 146, 12, -1 },
+    { 146, 14, -1 },
+    { 146, 18, -1 },
+    { 146, 19, -1 },
+    { 146, 23, -1 },
+    { 146, 31, -1 },
+    { 146, 52, -1 },
+    { 146, 57, -1 },
+    { 146, 58, -1 },
+    { 146, 60, -1 },
+    { 146, 63, -1 },
+    { 146, 133, -1 },
+    { 146, 156, -1 },
+    { 146, 198, -1 },
+    { 146, 201, -1 },
+    { 146, 205, -1 },
+    { 146, 209, -1 },
+    { 147, 12, -1 },
+    { 147, 14, -1 },
+    { 147, 18, -1 },
+    { 147, 19, -1 },
+    { 147, 23, -1 },
+    { 147, 31, -1 },
+    { 147, 52, -1 },
+    { 147, 57, -1 },
+    { 147, 58, -1 },
+    { 147, 60, -1 },
+    { 147, 63, -1 },
+    { 147, 133, -1 },
+    { 147, 156, -1 },
+    { 147, 198, -1 },
+    { 147, 201, -1 },
+    { 147, 205, -1 },
+    { 147, 209, -1 },
+    { 148, 12, -1 },
+    { 148, 14, -1 },
+    { 148, 18, -1 },
+    { 148, 19, -1 },
+    { 148, 23, -1 },
+    { 148, 31, -1 },
+    { 148, 52, -1 },
+    { 148, 57, -1 },
+    { 148, 58, -1 },
+    { 148, 60, -1 },
+    { 148, 63, -1 },
+    { 148, 133, -1 },
+    { 148, 156, -1 },
+    { 148, 198, -1 },
+    { 148, 201, -1 },
+    { 148, 205, -1 },
+    { 148, 209, -1 },
+    { 149, 12, -1 },
+    { 149, 14, -1 },
+    { 149, 18, -1 },
+    { 149, 19, -1 },
+    { 149, 23, -1 },
+    { 149, 31, -1 },
+    { 149, 52, -1 },
+    { 149, 57, -1 },
+    { 149, 58, -1 },
+    { 149, 60, -1 },
+    { 149, 63, -1 },
+    { 149, 133, -1 },
+    { 149, 156, -1 },
+    { 149, 198, -1 },
+    { 149, 201, -1 },
+    { 149, 205, -1 },
+    { 149, 209, -1 },
+    { 150, 17, -1 },
+    { 150, 19, -1 },
+    { 150, 31, -1 },
+    { 150, 56, -1 },
+    { 150, 58, -1 },
+    { 150, 100, -1 },
+    { 150, 211, -1 },
+    { 151, 12, -1 },
+    { 151, 14, -1 },
+    { 151, 18, -1 },
+    { 151, 19, -1 },
+    { 151, 23, -1 },
+    { 151, 31, -1 },
+    { 151, 52, -1 },
+    { 151, 57, -1 },
+    { 151, 58, -1 },
+    { 151, 60, -1 },
+    { 151, 63, -1 },
+    { 151, 133, -1 },
+    { 151, 156, -1 },
+    { 151, 198, -1 },
+    { 151, 201, -1 },
+    { 151, 205, -1 },
+    { 151, 209, -1 },
+    { 152, 63, -1 },
+    { 152, 133, -1 },
+    { 152, 209, -1 },
+    { 153, 63, -1 },
+    { 153, 133, -1 },
+    { 153, 209, -1 },
+    { 154, 63, -1 },
+    { 154, 133, -1 },
+    { 154, 209, -1 },
+    { 155, 63, -1 },
+    { 155, 133, -1 },
+    { 155, 209, -1 },
+    { 156, 3, -1 },
+    { 156, 4, -1 },
+    { 156, 6, -1 },
+    { 156, 11, -2 },
+    { 156, 12, -3 },
+    { 156, 13, -2 },
+    { 156, 14, -3 },
+    { 156, 15, -2 },
+    { 156, 16, -1 },
+    { 156, 17, -1 },
+    { 156, 18, -1 },
+    { 156, 19, -1 },
+    { 156, 20, -1 },
+    { 156, 21, -1 },
+    { 156, 22, -1 },
+    { 156, 24, -1 },
+    { 156, 25, -1 },
+    { 156, 26, -2 },
+    { 156, 27, -2 },
+    { 156, 32, -1 },
+    { 156, 33, -1 },
+    { 156, 35, -1 },
+    { 156, 39, -1 },
+    { 156, 47, -1 },
+    { 156, 49, -1 },
+    { 156, 51, -1 },
+    { 156, 63, -2 },
+    { 156, 65, -2 },
+    { 156, 67, -2 },
+    { 156, 68, -2 },
+    { 156, 69, -2 },
+    { 156, 70, -1 },
+    { 156, 71, -1 },
+    { 156, 74, -1 },
+    { 156, 77, -1 },
+    { 156, 78, -1 },
+    { 156, 79, -2 },
+    { 156, 80, -1 },
+    { 156, 81, -2 },
+    { 156, 82, -1 },
+    { 156, 83, -2 },
+    { 156, 84, -1 },
+    { 156, 85, -1 },
+    { 156, 86, -1 },
+    { 156, 87, -1 },
+    { 156, 88, -1 },
+    { 156, 89, -1 },
+    { 156, 90, -2 },
+    { 156, 94, -2 },
+    { 156, 97, -2 },
+    { 156, 106, -1 },
+    { 156, 107, -2 },
+    { 156, 108, -2 },
+    { 156, 116, -1 },
+    { 156, 118, -2 },
+    { 156, 122, -1 },
+    { 156, 127, -1 },
+    { 156, 128, -1 },
+    { 156, 129, -1 },
+    { 156, 130, -1 },
+    { 156, 131, -1 },
+    { 156, 132, -1 },
+    { 156, 133, -2 },
+    { 156, 134, -1 },
+    { 156, 145, -1 },
+    { 156, 146, -1 },
+    { 156, 147, -1 },
+    { 156, 148, -1 },
+    { 156, 149, -1 },
+    { 156, 151, -1 },
+    { 156, 159, -2 },
+    { 156, 160, -2 },
+    { 156, 161, -2 },
+    { 156, 162, -2 },
+    { 156, 163, -2 },
+    { 156, 164, -2 },
+    { 156, 165, -2 },
+    { 156, 166, -2 },
+    { 156, 167, -2 },
+    { 156, 168, -2 },
+    { 156, 169, -2 },
+    { 156, 170, -2 },
+    { 156, 175, -2 },
+    { 156, 176, -1 },
+    { 156, 177, -2 },
+    { 156, 178, -2 },
+    { 156, 179, -2 },
+    { 156, 180, -2 },
+    { 156, 181, -2 },
+    { 156, 182, -2 },
+    { 156, 183, -2 },
+    { 156, 184, -1 },
+    { 156, 185, -1 },
+    { 156, 186, -1 },
+    { 156, 187, -1 },
+    { 156, 188, -1 },
+    { 156, 190, -1 },
+    { 156, 191, -2 },
+    { 156, 192, -2 },
+    { 156, 193, -2 },
+    { 156, 194, -2 },
+    { 156, 198, -3 },
+    { 156, 201, -3 },
+    { 156, 204, -1 },
+    { 156, 205, -3 },
+    { 156, 207, -1 },
+    { 156, 208, -1 },
+    { 156, 209, -2 },
+    { 156, 211, -1 },
+    { 157, 3, -1 },
+    { 157, 4, -1 },
+    { 157, 6, -1 },
+    { 157, 12, -2 },
+    { 157, 14, -2 },
+    { 157, 15, -1 },
+    { 157, 17, -1 },
+    { 157, 18, -1 },
+    { 157, 19, -1 },
+    { 157, 23, -1 },
+    { 157, 31, -1 },
+    { 157, 33, -1 },
+    { 157, 42, -1 },
+    { 157, 51, -1 },
+    { 157, 52, -1 },
+    { 157, 54, -1 },
+    { 157, 56, -1 },
+    { 157, 57, -1 },
+    { 157, 58, -1 },
+    { 157, 60, -1 },
+    { 157, 63, -3 },
+    { 157, 65, -1 },
+    { 157, 77, -1 },
+    { 157, 78, -1 },
+    { 157, 80, -1 },
+    { 157, 82, -1 },
+    { 157, 83, -1 },
+    { 157, 90, -1 },
+    { 157, 116, -1 },
+    { 157, 127, -1 },
+    { 157, 128, -1 },
+    { 157, 129, -1 },
+    { 157, 130, -1 },
+    { 157, 131, -1 },
+    { 157, 132, -1 },
+    { 157, 133, -1 },
+    { 157, 156, -1 },
+    { 157, 159, -1 },
+    { 157, 160, -1 },
+    { 157, 161, -1 },
+    { 157, 162, -1 },
+    { 157, 163, -1 },
+    { 157, 164, -1 },
+    { 157, 165, -1 },
+    { 157, 176, -1 },
+    { 157, 198, -2 },
+    { 157, 201, -2 },
+    { 157, 205, -2 },
+    { 157, 209, -3 },
+    { 157, 211, -1 },
+    { 158, 2, -1 },
+    { 158, 7, -1 },
+    { 158, 10, -1 },
+    { 158, 17, -1 },
+    { 158, 23, -1 },
+    { 158, 25, -1 },
+    { 158, 31, -1 },
+    { 158, 60, -1 },
+    { 158, 63, -1 },
+    { 158, 109, -1 },
+    { 158, 113, -1 },
+    { 158, 114, -1 },
+    { 158, 120, -1 },
+    { 158, 123, -1 },
+    { 158, 124, -1 },
+    { 158, 125, -1 },
+    { 158, 196, -1 },
+    { 158, 197, -1 },
+    { 158, 199, -1 },
+    { 158, 200, -1 },
+    { 158, 209, -1 },
+    { 158, 211, -1 },
+    { 159, 17, -1 },
+    { 159, 23, -1 },
+    { 159, 31, -1 },
+    { 159, 60, -1 },
+    { 160, 17, -1 },
+    { 160, 23, -1 },
+    { 160, 31, -1 },
+    { 160, 60, -1 },
+    { 161, 17, -1 },
+    { 161, 23, -1 },
+    { 161, 31, -1 },
+    { 161, 60, -1 },
+    { 162, 17, -1 },
+    { 162, 23, -1 },
+    { 162, 31, -1 },
+    { 162, 60, -1 },
+    { 163, 17, -1 },
+    { 163, 23, -1 },
+    { 163, 31, -1 },
+    { 163, 60, -1 },
+    { 164, 17, -1 },
+    { 164, 23, -1 },
+    { 164, 31, -1 },
+    { 164, 60, -1 },
+    { 165, 17, -1 },
+    { 165, 18, -1 },
+    { 165, 19, -1 },
+    { 165, 23, -1 },
+    { 165, 31, -1 },
+    { 165, 60, -1 },
+    { 165, 63, -1 },
+    { 165, 122, -1 },
+    { 165, 208, -1 },
+    { 165, 209, -1 },
+    { 165, 211, -1 },
+    { 166, 11, -1 },
+    { 166, 13, -1 },
+    { 166, 20, -1 },
+    { 166, 23, -1 },
+    { 166, 28, -1 },
+    { 166, 29, -1 },
+    { 166, 30, -1 },
+    { 166, 31, -1 },
+    { 166, 32, -1 },
+    { 166, 60, -1 },
+    { 166, 67, -1 },
+    { 166, 68, -1 },
+    { 166, 69, -1 },
+    { 166, 79, -1 },
+    { 166, 81, -1 },
+    { 166, 94, -1 },
+    { 166, 97, -1 },
+    { 166, 100, -1 },
+    { 166, 106, -1 },
+    { 166, 107, -1 },
+    { 166, 108, -1 },
+    { 166, 118, -1 },
+    { 166, 150, -1 },
+    { 166, 166, -1 },
+    { 166, 167, -1 },
+    { 166, 168, -1 },
+    { 166, 169, -1 },
+    { 166, 170, -1 },
+    { 166, 175, -1 },
+    { 166, 177, -1 },
+    { 166, 178, -1 },
+    { 166, 179, -1 },
+    { 166, 180, -1 },
+    { 166, 181, -1 },
+    { 166, 182, -1 },
+    { 166, 183, -1 },
+    { 166, 191, -1 },
+    { 166, 192, -1 },
+    { 166, 193, -1 },
+    { 166, 194, -1 },
+    { 166, 204, -1 },
+    { 166, 207, -1 },
+    { 167, 17, -1 },
+    { 167, 18, -1 },
+    { 167, 19, -1 },
+    { 167, 23, -1 },
+    { 167, 31, -1 },
+    { 167, 60, -1 },
+    { 167, 63, -1 },
+    { 167, 122, -1 },
+    { 167, 208, -1 },
+    { 167, 209, -1 },
+    { 167, 211, -1 },
+    { 168, 17, -1 },
+    { 168, 18, -1 },
+    { 168, 19, -1 },
+    { 168, 23, -1 },
+    { 168, 31, -1 },
+    { 168, 60, -1 },
+    { 168, 63, -1 },
+    { 168, 122, -1 },
+    { 168, 208, -1 },
+    { 168, 209, -1 },
+    { 168, 211, -1 },
+    { 169, 17, -1 },
+    { 169, 18, -1 },
+    { 169, 19, -1 },
+    { 169, 23, -1 },
+    { 169, 31, -1 },
+    { 169, 60, -1 },
+    { 169, 63, -1 },
+    { 169, 122, -1 },
+    { 169, 208, -1 },
+    { 169, 209, -1 },
+    { 169, 211, -1 },
+    { 170, 17, -1 },
+    { 170, 18, -1 },
+    { 170, 19, -1 },
+    { 170, 23, -1 },
+    { 170, 31, -1 },
+    { 170, 60, -1 },
+    { 170, 63, -1 },
+    { 170, 122, -1 },
+    { 170, 208, -1 },
+    { 170, 209, -1 },
+    { 170, 211, -1 },
+    { 171, 1, 1 },
+    { 171, 2, 1 },
+    { 171, 7, 1 },
+    { 171, 9, 1 },
+    { 171, 10, 1 },
+    { 171, 23, 1 },
+    { 171, 60, 1 },
+    { 171, 61, 1 },
+    { 171, 93, 1 },
+    { 171, 109, 1 },
+    { 171, 196, 1 },
+    { 171, 197, 1 },
+    { 171, 199, 1 },
+    { 171, 200, 1 },
+    { 172, 1, 1 },
+    { 172, 2, 1 },
+    { 172, 7, 1 },
+    { 172, 9, 1 },
+    { 172, 10, 1 },
+    { 172, 23, 1 },
+    { 172, 60, 1 },
+    { 172, 61, 1 },
+    { 172, 93, 1 },
+    { 172, 109, 1 },
+    { 172, 196, 1 },
+    { 172, 197, 1 },
+    { 172, 199, 1 },
+    { 172, 200, 1 },
+    { 173, 1, 1 },
+    { 173, 2, 1 },
+    { 173, 7, 1 },
+    { 173, 9, 1 },
+    { 173, 10, 1 },
+    { 173, 23, 1 },
+    { 173, 60, 1 },
+    { 173, 61, 1 },
+    { 173, 93, 1 },
+    { 173, 109, 1 },
+    { 173, 196, 1 },
+    { 173, 197, 1 },
+    { 173, 199, 1 },
+    { 173, 200, 1 },
+    { 174, 1, 1 },
+    { 174, 2, 1 },
+    { 174, 7, 1 },
+    { 174, 9, 1 },
+    { 174, 10, 1 },
+    { 174, 23, 1 },
+    { 174, 60, 1 },
+    { 174, 61, 1 },
+    { 174, 93, 1 },
+    { 174, 109, 1 },
+    { 174, 196, 1 },
+    { 174, 197, 1 },
+    { 174, 199, 1 },
+    { 174, 200, 1 },
+    { 175, 17, -1 },
+    { 175, 18, -1 },
+    { 175, 19, -1 },
+    { 175, 23, -1 },
+    { 175, 31, -1 },
+    { 175, 60, -1 },
+    { 175, 63, -1 },
+    { 175, 122, -1 },
+    { 175, 208, -1 },
+    { 175, 209, -1 },
+    { 175, 211, -1 },
+    { 176, 17, -1 },
+    { 176, 23, -1 },
+    { 176, 31, -1 },
+    { 176, 57, -1 },
+    { 176, 60, -1 },
+    { 176, 156, -1 },
+    { 176, 211, -1 },
+    { 177, 17, -1 },
+    { 177, 18, -1 },
+    { 177, 19, -1 },
+    { 177, 23, -1 },
+    { 177, 31, -1 },
+    { 177, 60, -1 },
+    { 177, 63, -1 },
+    { 177, 122, -1 },
+    { 177, 208, -1 },
+    { 177, 209, -1 },
+    { 177, 211, -1 },
+    { 178, 17, -1 },
+    { 178, 18, -1 },
+    { 178, 19, -1 },
+    { 178, 23, -1 },
+    { 178, 31, -1 },
+    { 178, 60, -1 },
+    { 178, 63, -1 },
+    { 178, 122, -1 },
+    { 178, 208, -1 },
+    { 178, 209, -1 },
+    { 178, 211, -1 },
+    { 179, 17, -1 },
+    { 179, 18, -1 },
+    { 179, 19, -1 },
+    { 179, 23, -1 },
+    { 179, 31, -1 },
+    { 179, 60, -1 },
+    { 179, 63, -1 },
+    { 179, 122, -1 },
+    { 179, 208, -1 },
+    { 179, 209, -1 },
+    { 179, 211, -1 },
+    { 180, 17, -1 },
+    { 180, 18, -1 },
+    { 180, 19, -1 },
+    { 180, 23, -1 },
+    { 180, 31, -1 },
+    { 180, 60, -1 },
+    { 180, 63, -1 },
+    { 180, 122, -1 },
+    { 180, 208, -1 },
+    { 180, 209, -1 },
+    { 180, 211, -1 },
+    { 181, 17, -1 },
+    { 181, 18, -1 },
+    { 181, 19, -1 },
+    { 181, 23, -1 },
+    { 181, 31, -1 },
+    { 181, 60, -1 },
+    { 181, 63, -1 },
+    { 181, 122, -1 },
+    { 181, 208, -1 },
+    { 181, 209, -1 },
+    { 181, 211, -1 },
+    { 182, 4, -1 },
+    { 182, 5, -1 },
+    { 182, 6, -1 },
+    { 182, 12, -1 },
+    { 182, 14, -1 },
+    { 182, 15, -2 },
+    { 182, 17, -2 },
+    { 182, 18, -2 },
+    { 182, 19, -2 },
+    { 182, 23, -2 },
+    { 182, 31, -2 },
+    { 182, 51, -1 },
+    { 182, 52, -1 },
+    { 182, 54, -1 },
+    { 182, 56, -1 },
+    { 182, 57, -2 },
+    { 182, 58, -1 },
+    { 182, 60, -2 },
+    { 182, 63, -2 },
+    { 182, 88, -1 },
+    { 182, 90, -1 },
+    { 182, 100, -1 },
+    { 182, 122, -1 },
+    { 182, 126, -2 },
+    { 182, 133, -1 },
+    { 182, 156, -2 },
+    { 182, 198, -1 },
+    { 182, 201, -1 },
+    { 182, 205, -1 },
+    { 182, 206, -1 },
+    { 182, 208, -1 },
+    { 182, 209, -2 },
+    { 182, 211, -1 },
+    { 183, 17, -1 },
+    { 183, 18, -1 },
+    { 183, 19, -1 },
+    { 183, 23, -1 },
+    { 183, 31, -1 },
+    { 183, 60, -1 },
+    { 183, 63, -1 },
+    { 183, 122, -1 },
+    { 183, 208, -1 },
+    { 183, 209, -1 },
+    { 183, 211, -1 },
+    { 184, 17, -1 },
+    { 184, 23, -1 },
+    { 184, 31, -1 },
+    { 184, 60, -1 },
+    { 185, 17, -1 },
+    { 185, 23, -1 },
+    { 185, 31, -1 },
+    { 185, 60, -1 },
+    { 186, 17, -1 },
+    { 186, 23, -1 },
+    { 186, 31, -1 },
+    { 186, 60, -1 },
+    { 187, 17, -1 },
+    { 187, 23, -1 },
+    { 187, 31, -1 },
+    { 187, 60, -1 },
+    { 188, 12, -1 },
+    { 188, 14, -1 },
+    { 188, 31, -1 },
+    { 188, 60, -1 },
+    { 188, 63, -1 },
+    { 188, 198, -1 },
+    { 188, 201, -1 },
+    { 188, 205, -1 },
+    { 188, 209, -1 },
+    { 189, 17, -1 },
+    { 189, 18, -1 },
+    { 189, 19, -1 },
+    { 189, 23, -1 },
+    { 189, 31, -1 },
+    { 189, 60, -1 },
+    { 189, 63, -1 },
+    { 189, 122, -1 },
+    { 189, 208, -1 },
+    { 189, 209, -1 },
+    { 189, 211, -1 },
+    { 190, 12, -1 },
+    { 190, 14, -1 },
+    { 190, 31, -1 },
+    { 190, 60, -1 },
+    { 190, 63, -1 },
+    { 190, 198, -1 },
+    { 190, 201, -1 },
+    { 190, 205, -1 },
+    { 190, 209, -1 },
+    { 191, 4, -1 },
+    { 191, 5, -1 },
+    { 191, 6, -1 },
+    { 191, 12, -1 },
+    { 191, 14, -1 },
+    { 191, 15, -2 },
+    { 191, 17, -2 },
+    { 191, 18, -2 },
+    { 191, 19, -2 },
+    { 191, 23, -2 },
+    { 191, 31, -2 },
+    { 191, 51, -1 },
+    { 191, 52, -1 },
+    { 191, 54, -1 },
+    { 191, 56, -1 },
+    { 191, 57, -2 },
+    { 191, 58, -1 },
+    { 191, 60, -2 },
+    { 191, 63, -2 },
+    { 191, 88, -1 },
+    { 191, 90, -1 },
+    { 191, 100, -1 },
+    { 191, 122, -1 },
+    { 191, 126, -2 },
+    { 191, 133, -1 },
+    { 191, 156, -2 },
+    { 191, 198, -1 },
+    { 191, 201, -1 },
+    { 191, 205, -1 },
+    { 191, 206, -1 },
+    { 191, 208, -1 },
+    { 191, 209, -2 },
+    { 191, 211, -1 },
+    { 192, 4, -1 },
+    { 192, 5, -1 },
+    { 192, 6, -1 },
+    { 192, 12, -1 },
+    { 192, 14, -1 },
+    { 192, 15, -2 },
+    { 192, 17, -2 },
+    { 192, 18, -2 },
+    { 192, 19, -2 },
+    { 192, 23, -2 },
+    { 192, 31, -2 },
+    { 192, 51, -1 },
+    { 192, 52, -1 },
+    { 192, 54, -1 },
+    { 192, 56, -1 },
+    { 192, 57, -2 },
+    { 192, 58, -1 },
+    { 192, 60, -2 },
+    { 192, 63, -2 },
+    { 192, 88, -1 },
+    { 192, 90, -1 },
+    { 192, 100, -1 },
+    { 192, 122, -1 },
+    { 192, 126, -2 },
+    { 192, 133, -1 },
+    { 192, 156, -2 },
+    { 192, 198, -1 },
+    { 192, 201, -1 },
+    { 192, 205, -1 },
+    { 192, 206, -1 },
+    { 192, 208, -1 },
+    { 192, 209, -2 },
+    { 192, 211, -1 },
+    { 193, 4, -1 },
+    { 193, 5, -1 },
+    { 193, 6, -1 },
+    { 193, 12, -1 },
+    { 193, 14, -1 },
+    { 193, 15, -2 },
+    { 193, 17, -2 },
+    { 193, 18, -2 },
+    { 193, 19, -2 },
+    { 193, 23, -2 },
+    { 193, 31, -2 },
+    { 193, 51, -1 },
+    { 193, 52, -1 },
+    { 193, 54, -1 },
+    { 193, 56, -1 },
+    { 193, 57, -2 },
+    { 193, 58, -1 },
+    { 193, 60, -2 },
+    { 193, 63, -2 },
+    { 193, 88, -1 },
+    { 193, 90, -1 },
+    { 193, 100, -1 },
+    { 193, 122, -1 },
+    { 193, 126, -2 },
+    { 193, 133, -1 },
+    { 193, 156, -2 },
+    { 193, 198, -1 },
+    { 193, 201, -1 },
+    { 193, 205, -1 },
+    { 193, 206, -1 },
+    { 193, 208, -1 },
+    { 193, 209, -2 },
+    { 193, 211, -1 },
+    { 194, 4, -1 },
+    { 194, 5, -1 },
+    { 194, 6, -1 },
+    { 194, 12, -1 },
+    { 194, 14, -1 },
+    { 194, 15, -2 },
+    { 194, 17, -2 },
+    { 194, 18, -2 },
+    { 194, 19, -2 },
+    { 194, 23, -2 },
+    { 194, 31, -2 },
+    { 194, 51, -1 },
+    { 194, 52, -1 },
+    { 194, 54, -1 },
+    { 194, 56, -1 },
+    { 194, 57, -2 },
+    { 194, 58, -1 },
+    { 194, 60, -2 },
+    { 194, 63, -2 },
+    { 194, 88, -1 },
+    { 194, 90, -1 },
+    { 194, 100, -1 },
+    { 194, 122, -1 },
+    { 194, 126, -2 },
+    { 194, 133, -1 },
+    { 194, 156, -2 },
+    { 194, 198, -1 },
+    { 194, 201, -1 },
+    { 194, 205, -1 },
+    { 194, 206, -1 },
+    { 194, 208, -1 },
+    { 194, 209, -2 },
+    { 194, 211, -1 },
+    { 196, 3, -1 },
+    { 196, 12, -3 },
+    { 196, 14, -3 },
+    { 196, 15, -3 },
+    { 196, 20, -1 },
+    { 196, 32, -1 },
+    { 196, 33, -1 },
+    { 196, 42, -1 },
+    { 196, 63, -3 },
+    { 196, 98, -1 },
+    { 196, 106, -1 },
+    { 196, 126, -3 },
+    { 196, 127, -1 },
+    { 196, 128, -1 },
+    { 196, 129, -1 },
+    { 196, 130, -1 },
+    { 196, 131, -1 },
+    { 196, 132, -1 },
+    { 196, 133, -2 },
+    { 196, 171, 1 },
+    { 196, 172, 1 },
+    { 196, 173, 1 },
+    { 196, 174, 1 },
+    { 196, 198, -3 },
+    { 196, 201, -3 },
+    { 196, 202, 1 },
+    { 196, 205, -3 },
+    { 196, 207, -1 },
+    { 196, 209, -3 },
+    { 196, 211, 1 },
+    { 197, 3, -1 },
+    { 197, 12, -3 },
+    { 197, 14, -3 },
+    { 197, 15, -3 },
+    { 197, 20, -1 },
+    { 197, 32, -1 },
+    { 197, 33, -1 },
+    { 197, 42, -1 },
+    { 197, 63, -3 },
+    { 197, 98, -1 },
+    { 197, 106, -1 },
+    { 197, 126, -3 },
+    { 197, 127, -1 },
+    { 197, 128, -1 },
+    { 197, 129, -1 },
+    { 197, 130, -1 },
+    { 197, 131, -1 },
+    { 197, 132, -1 },
+    { 197, 133, -2 },
+    { 197, 171, 1 },
+    { 197, 172, 1 },
+    { 197, 173, 1 },
+    { 197, 174, 1 },
+    { 197, 198, -3 },
+    { 197, 201, -3 },
+    { 197, 202, 1 },
+    { 197, 205, -3 },
+    { 197, 207, -1 },
+    { 197, 209, -3 },
+    { 197, 211, 1 },
+    { 198, 2, -3 },
+    { 198, 5, -3 },
+    { 198, 7, -3 },
+    { 198, 10, -3 },
+    { 198, 11, -1 },
+    { 198, 13, -1 },
+    { 198, 17, -3 },
+    { 198, 20, -1 },
+    { 198, 25, -1 },
+    { 198, 31, -1 },
+    { 198, 35, -1 },
+    { 198, 39, -1 },
+    { 198, 47, -1 },
+    { 198, 49, -1 },
+    { 198, 52, -2 },
+    { 198, 54, -1 },
+    { 198, 55, -1 },
+    { 198, 57, -3 },
+    { 198, 60, -4 },
+    { 198, 84, -1 },
+    { 198, 86, -1 },
+    { 198, 87, -1 },
+    { 198, 89, -1 },
+    { 198, 94, -1 },
+    { 198, 100, -1 },
+    { 198, 104, -2 },
+    { 198, 106, -1 },
+    { 198, 107, -1 },
+    { 198, 108, -1 },
+    { 198, 109, -3 },
+    { 198, 113, -1 },
+    { 198, 114, -1 },
+    { 198, 118, -1 },
+    { 198, 120, -1 },
+    { 198, 123, -1 },
+    { 198, 124, -1 },
+    { 198, 125, -1 },
+    { 198, 134, -1 },
+    { 198, 145, -1 },
+    { 198, 146, -1 },
+    { 198, 147, -1 },
+    { 198, 148, -1 },
+    { 198, 149, -1 },
+    { 198, 151, -1 },
+    { 198, 156, -3 },
+    { 198, 182, -1 },
+    { 198, 188, -1 },
+    { 198, 190, -1 },
+    { 198, 191, -1 },
+    { 198, 192, -1 },
+    { 198, 193, -1 },
+    { 198, 194, -1 },
+    { 198, 196, -3 },
+    { 198, 197, -3 },
+    { 198, 199, -3 },
+    { 198, 200, -3 },
+    { 198, 202, -3 },
+    { 198, 206, -3 },
+    { 198, 207, -1 },
+    { 198, 211, -1 },
+    { 199, 3, -1 },
+    { 199, 12, -3 },
+    { 199, 14, -3 },
+    { 199, 15, -3 },
+    { 199, 20, -1 },
+    { 199, 32, -1 },
+    { 199, 33, -1 },
+    { 199, 42, -1 },
+    { 199, 63, -3 },
+    { 199, 98, -1 },
+    { 199, 106, -1 },
+    { 199, 126, -3 },
+    { 199, 127, -1 },
+    { 199, 128, -1 },
+    { 199, 129, -1 },
+    { 199, 130, -1 },
+    { 199, 131, -1 },
+    { 199, 132, -1 },
+    { 199, 133, -2 },
+    { 199, 171, 1 },
+    { 199, 172, 1 },
+    { 199, 173, 1 },
+    { 199, 174, 1 },
+    { 199, 198, -3 },
+    { 199, 201, -3 },
+    { 199, 202, 1 },
+    { 199, 205, -3 },
+    { 199, 207, -1 },
+    { 199, 209, -3 },
+    { 199, 211, 1 },
+    { 200, 3, -1 },
+    { 200, 12, -3 },
+    { 200, 14, -3 },
+    { 200, 15, -3 },
+    { 200, 20, -1 },
+    { 200, 32, -1 },
+    { 200, 33, -1 },
+    { 200, 42, -1 },
+    { 200, 63, -3 },
+    { 200, 98, -1 },
+    { 200, 106, -1 },
+    { 200, 126, -3 },
+    { 200, 127, -1 },
+    { 200, 128, -1 },
+    { 200, 129, -1 },
+    { 200, 130, -1 },
+    { 200, 131, -1 },
+    { 200, 132, -1 },
+    { 200, 133, -2 },
+    { 200, 171, 1 },
+    { 200, 172, 1 },
+    { 200, 173, 1 },
+    { 200, 174, 1 },
+    { 200, 198, -3 },
+    { 200, 201, -3 },
+    { 200, 202, 1 },
+    { 200, 205, -3 },
+    { 200, 207, -1 },
+    { 200, 209, -3 },
+    { 200, 211, 1 },
+    { 201, 2, -3 },
+    { 201, 5, -3 },
+    { 201, 7, -3 },
+    { 201, 10, -3 },
+    { 201, 11, -1 },
+    { 201, 13, -1 },
+    { 201, 17, -3 },
+    { 201, 20, -1 },
+    { 201, 25, -1 },
+    { 201, 31, -1 },
+    { 201, 35, -1 },
+    { 201, 39, -1 },
+    { 201, 47, -1 },
+    { 201, 49, -1 },
+    { 201, 52, -2 },
+    { 201, 54, -1 },
+    { 201, 55, -1 },
+    { 201, 57, -3 },
+    { 201, 60, -4 },
+    { 201, 84, -1 },
+    { 201, 86, -1 },
+    { 201, 87, -1 },
+    { 201, 89, -1 },
+    { 201, 94, -1 },
+    { 201, 100, -1 },
+    { 201, 104, -2 },
+    { 201, 106, -1 },
+    { 201, 107, -1 },
+    { 201, 108, -1 },
+    { 201, 109, -3 },
+    { 201, 113, -1 },
+    { 201, 114, -1 },
+    { 201, 118, -1 },
+    { 201, 120, -1 },
+    { 201, 123, -1 },
+    { 201, 124, -1 },
+    { 201, 125, -1 },
+    { 201, 134, -1 },
+    { 201, 145, -1 },
+    { 201, 146, -1 },
+    { 201, 147, -1 },
+    { 201, 148, -1 },
+    { 201, 149, -1 },
+    { 201, 151, -1 },
+    { 201, 156, -3 },
+    { 201, 182, -1 },
+    { 201, 188, -1 },
+    { 201, 190, -1 },
+    { 201, 191, -1 },
+    { 201, 192, -1 },
+    { 201, 193, -1 },
+    { 201, 194, -1 },
+    { 201, 196, -3 },
+    { 201, 197, -3 },
+    { 201, 199, -3 },
+    { 201, 200, -3 },
+    { 201, 202, -3 },
+    { 201, 206, -3 },
+    { 201, 207, -1 },
+    { 201, 211, -1 },
+    { 202, 2, 1 },
+    { 202, 7, 1 },
+    { 202, 15, -1 },
+    { 202, 19, -1 },
+    { 202, 31, -1 },
+    { 202, 63, -3 },
+    { 202, 106, -1 },
+    { 202, 196, 1 },
+    { 202, 197, 1 },
+    { 202, 199, 1 },
+    { 202, 200, 1 },
+    { 202, 207, -1 },
+    { 202, 209, -3 },
+    { 204, 4, -1 },
+    { 204, 6, -1 },
+    { 204, 15, -1 },
+    { 204, 17, -2 },
+    { 204, 18, -1 },
+    { 204, 19, -1 },
+    { 204, 23, -2 },
+    { 204, 31, -1 },
+    { 204, 51, -1 },
+    { 204, 52, -1 },
+    { 204, 56, -1 },
+    { 204, 57, -1 },
+    { 204, 58, -1 },
+    { 204, 60, -1 },
+    { 204, 88, -1 },
+    { 204, 100, -1 },
+    { 204, 122, -1 },
+    { 204, 126, -2 },
+    { 204, 156, -1 },
+    { 204, 208, -1 },
+    { 205, 2, -3 },
+    { 205, 5, -3 },
+    { 205, 7, -3 },
+    { 205, 10, -3 },
+    { 205, 11, -1 },
+    { 205, 13, -1 },
+    { 205, 17, -3 },
+    { 205, 20, -1 },
+    { 205, 25, -1 },
+    { 205, 31, -1 },
+    { 205, 35, -1 },
+    { 205, 39, -1 },
+    { 205, 47, -1 },
+    { 205, 49, -1 },
+    { 205, 52, -2 },
+    { 205, 54, -1 },
+    { 205, 55, -1 },
+    { 205, 57, -3 },
+    { 205, 60, -4 },
+    { 205, 84, -1 },
+    { 205, 86, -1 },
+    { 205, 87, -1 },
+    { 205, 89, -1 },
+    { 205, 94, -1 },
+    { 205, 100, -1 },
+    { 205, 104, -2 },
+    { 205, 106, -1 },
+    { 205, 107, -1 },
+    { 205, 108, -1 },
+    { 205, 109, -3 },
+    { 205, 113, -1 },
+    { 205, 114, -1 },
+    { 205, 118, -1 },
+    { 205, 120, -1 },
+    { 205, 123, -1 },
+    { 205, 124, -1 },
+    { 205, 125, -1 },
+    { 205, 134, -1 },
+    { 205, 145, -1 },
+    { 205, 146, -1 },
+    { 205, 147, -1 },
+    { 205, 148, -1 },
+    { 205, 149, -1 },
+    { 205, 151, -1 },
+    { 205, 156, -3 },
+    { 205, 182, -1 },
+    { 205, 188, -1 },
+    { 205, 190, -1 },
+    { 205, 191, -1 },
+    { 205, 192, -1 },
+    { 205, 193, -1 },
+    { 205, 194, -1 },
+    { 205, 196, -3 },
+    { 205, 197, -3 },
+    { 205, 199, -3 },
+    { 205, 200, -3 },
+    { 205, 202, -3 },
+    { 205, 206, -3 },
+    { 205, 207, -1 },
+    { 205, 211, -1 },
+    { 206, 2, -2 },
+    { 206, 7, -2 },
+    { 206, 10, -1 },
+    { 206, 17, -3 },
+    { 206, 31, -2 },
+    { 206, 60, -2 },
+    { 206, 109, -1 },
+    { 206, 196, -2 },
+    { 206, 197, -2 },
+    { 206, 199, -2 },
+    { 206, 200, -2 },
+    { 207, 17, -1 },
+    { 207, 20, -1 },
+    { 207, 23, -1 },
+    { 207, 32, -1 },
+    { 207, 52, -1 },
+    { 207, 57, -1 },
+    { 207, 58, -1 },
+    { 207, 60, -1 },
+    { 207, 67, -1 },
+    { 207, 68, -1 },
+    { 207, 69, -1 },
+    { 207, 79, -1 },
+    { 207, 81, -1 },
+    { 207, 97, -1 },
+    { 207, 100, -1 },
+    { 207, 106, -1 },
+    { 207, 156, -1 },
+    { 207, 166, -1 },
+    { 207, 167, -1 },
+    { 207, 168, -1 },
+    { 207, 169, -1 },
+    { 207, 170, -1 },
+    { 207, 175, -1 },
+    { 207, 177, -1 },
+    { 207, 178, -1 },
+    { 207, 179, -1 },
+    { 207, 180, -1 },
+    { 207, 181, -1 },
+    { 207, 183, -1 },
+    { 207, 204, -1 },
+    { 207, 207, -1 },
+    { 207, 211, -1 },
+    { 208, 2, -1 },
+    { 208, 4, -1 },
+    { 208, 7, -1 },
+    { 208, 10, -1 },
+    { 208, 15, -1 },
+    { 208, 17, -1 },
+    { 208, 18, -1 },
+    { 208, 19, -1 },
+    { 208, 21, -1 },
+    { 208, 23, -1 },
+    { 208, 25, -1 },
+    { 208, 31, -1 },
+    { 208, 51, -1 },
+    { 208, 52, -1 },
+    { 208, 54, -1 },
+    { 208, 57, -1 },
+    { 208, 58, -1 },
+    { 208, 60, -1 },
+    { 208, 63, -1 },
+    { 208, 88, -1 },
+    { 208, 100, -1 },
+    { 208, 109, -1 },
+    { 208, 122, -3 },
+    { 208, 126, -1 },
+    { 208, 156, -1 },
+    { 208, 196, -1 },
+    { 208, 197, -1 },
+    { 208, 199, -1 },
+    { 208, 200, -1 },
+    { 208, 202, -1 },
+    { 208, 208, -3 },
+    { 208, 209, -1 },
+    { 208, 211, -1 },
+    { 209, 2, -3 },
+    { 209, 4, -1 },
+    { 209, 5, -2 },
+    { 209, 6, -1 },
+    { 209, 7, -3 },
+    { 209, 10, -3 },
+    { 209, 16, -1 },
+    { 209, 17, -3 },
+    { 209, 20, -4 },
+    { 209, 22, -1 },
+    { 209, 24, -1 },
+    { 209, 31, -2 },
+    { 209, 32, -1 },
+    { 209, 35, -1 },
+    { 209, 39, -1 },
+    { 209, 42, 1 },
+    { 209, 47, -1 },
+    { 209, 49, -1 },
+    { 209, 51, -1 },
+    { 209, 52, -1 },
+    { 209, 53, -1 },
+    { 209, 54, -1 },
+    { 209, 55, -2 },
+    { 209, 57, -2 },
+    { 209, 60, -4 },
+    { 209, 65, -1 },
+    { 209, 67, -1 },
+    { 209, 68, -1 },
+    { 209, 69, -1 },
+    { 209, 70, -1 },
+    { 209, 74, 1 },
+    { 209, 79, -1 },
+    { 209, 81, -1 },
+    { 209, 84, -1 },
+    { 209, 85, -1 },
+    { 209, 86, -1 },
+    { 209, 87, -1 },
+    { 209, 97, -1 },
+    { 209, 100, -2 },
+    { 209, 104, -3 },
+    { 209, 106, -1 },
+    { 209, 109, -3 },
+    { 209, 113, -2 },
+    { 209, 114, -2 },
+    { 209, 120, -2 },
+    { 209, 123, -2 },
+    { 209, 124, -2 },
+    { 209, 125, -2 },
+    { 209, 134, -1 },
+    { 209, 145, -1 },
+    { 209, 146, -1 },
+    { 209, 147, -1 },
+    { 209, 148, -1 },
+    { 209, 149, -1 },
+    { 209, 151, -1 },
+    { 209, 152, -1 },
+    { 209, 153, -1 },
+    { 209, 154, -1 },
+    { 209, 155, -1 },
+    { 209, 156, -2 },
+    { 209, 159, -1 },
+    { 209, 160, -1 },
+    { 209, 161, -1 },
+    { 209, 162, -1 },
+    { 209, 163, -1 },
+    { 209, 164, -1 },
+    { 209, 165, -1 },
+    { 209, 166, -1 },
+    { 209, 167, -1 },
+    { 209, 168, -1 },
+    { 209, 169, -1 },
+    { 209, 170, -1 },
+    { 209, 175, -1 },
+    { 209, 177, -1 },
+    { 209, 178, -1 },
+    { 209, 179, -1 },
+    { 209, 180, -1 },
+    { 209, 181, -1 },
+    { 209, 183, -1 },
+    { 209, 184, -1 },
+    { 209, 185, -1 },
+    { 209, 186, -1 },
+    { 209, 187, -1 },
+    { 209, 188, -1 },
+    { 209, 190, -1 },
+    { 209, 196, -3 },
+    { 209, 197, -3 },
+    { 209, 199, -3 },
+    { 209, 200, -3 },
+    { 209, 202, -3 },
+    { 209, 206, -2 },
+    { 209, 207, -1 },
+    { 211, 6, -1 },
+    { 211, 15, -1 },
+    { 211, 32, -1 },
+    { 211, 33, -1 },
+    { 211, 56, -1 },
+    { 211, 57, -1 },
+    { 211, 58, -1 },
+    { 211, 60, -1 },
+    { 211, 63, -2 },
+    { 211, 106, -1 },
+    { 211, 127, -1 },
+    { 211, 128, -1 },
+    { 211, 129, -1 },
+    { 211, 130, -1 },
+    { 211, 131, -1 },
+    { 211, 132, -1 },
+    { 211, 133, -1 },
+    { 211, 156, -1 },
+    { 211, 207, -1 },
+    { 211, 209, -2 },
 };
 const GFXfont FiraSans = {
-    (uint8_t *)FiraSans_Bitmaps,           // (*bitmap) Glyph bitmap pointer, all concatenated together
-    (GFXglyph *)FiraSans_Glyphs,           // glyphs Glyph array
+    (uint8_t *)FiraSans_Bitmaps, // (*bitmap) Glyph bitmap pointer, all concatenated together
+    (GFXglyph *)FiraSans_Glyphs, // glyphs Glyph array
     (UnicodeInterval *)FiraSans_Intervals, // intervals Valid unicode intervals for this font
-    8,                                     // interval_count Number of unicode intervals.intervals
-    1,                                     // compressed Does this font use compressed glyph bitmaps?
-    35,                                    // advance_y Newline distance (y axis)
-    28,                                    // ascender Maximal height of a glyph above the base line
-    -8,                                    // descender Maximal height of a glyph below the base line
+    19,   // interval_count Number of unicode intervals.intervals
+    1, // compressed Does this font use compressed glyph bitmaps?
+    35, // advance_y Newline distance (y axis)
+    28, // ascender Maximal height of a glyph above the base line
+    -8, // descender Maximal height of a glyph below the base line
+    FiraSans_AsciiGlyphs, // ascii_glyphs Glyph index of each code point below 128
+    0, // format Glyph bitmap storage, FontFormat_t
+    0, // atlas_stride Bytes per atlas row
+    FiraSans_Kerning, // kerning Sorted kerning pairs
+    4412, // kerning_count Number of kerning pairs
 };
 /*
 Included intervals
     ( 32, 126), ie. ' ' -  '~'
-    ( 160, 255), ie. '┬á' -  '├┐'
-    ( 8208, 8287), ie. 'ΓÇÉ' -  'Γüƒ'
-    ( 8592, 8703), ie. 'ΓåÉ' -  'Γç┐'
-    ( 8960, 9215), ie. 'ΓîÇ' -  'ΓÅ┐'
-    ( 9632, 9727), ie. 'Γûá' -  'Γù┐'
-    ( 9728, 9968), ie. 'ΓÿÇ' -  'Γ¢░'
-    ( 9984, 10175), ie. 'Γ£Ç' -  'Γ₧┐'
+    ( 160, 255), ie. ' ' -  'ÿ'
+    ( 8210, 8214), ie. '‒' -  '‖'
+    ( 8216, 8218), ie. '‘' -  '‚'
+    ( 8220, 8222), ie. '“' -  '„'
+    ( 8224, 8226), ie. '†' -  '•'
+    ( 8230, 8230), ie. '…' -  '…'
+    ( 8240, 8240), ie. '‰' -  '‰'
+    ( 8249, 8250), ie. '‹' -  '›'
+    ( 8255, 8255), ie. '‿' -  '‿'
+    ( 8260, 8260), ie. '⁄' -  '⁄'
+    ( 8266, 8266), ie. '⁊' -  '⁊'
+    ( 8592, 8595), ie. '←' -  '↓'
+    ( 8678, 8682), ie. '⇦' -  '⇪'
+    ( 8998, 9000), ie. '⌦' -  '⌨'
+    ( 9003, 9003), ie. '⌫' -  '⌫'
+    ( 9166, 9166), ie. '⏎' -  '⏎'
+    ( 9647, 9647), ie. '▯' -  '▯'
+    ( 9674, 9674), ie. '◊' -  '◊'
 
 */
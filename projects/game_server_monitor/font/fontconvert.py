@@ -40,14 +40,17 @@ import zlib
 import sys
 import re
 import math
+import struct
 import argparse
 from collections import namedtuple
 #see https://freetype-py.readthedocs.io/en/latest/ for documentation
 parser = argparse.ArgumentParser(description="Generate a header file from a font to be used with epdiy.")
 parser.add_argument("name", action="store", help="name of the font.")
-parser.add_argument("size", type=int, help="font size to use.")
+parser.add_argument("size", type=str, help="font size to use, or a comma separated list of sizes to export as a font family.")
 parser.add_argument("fontstack", action="store", nargs='+', help="list of font files, ordered by descending priority. This is not actually implemented please just use one file for now.")
 parser.add_argument("--compress", dest="compress", action="store_true", help="compress glyph bitmaps.")
+parser.add_argument("--kerning", dest="kerning", action="store_true", help="export the kerning pairs of the exported glyphs.")
+parser.add_argument("--format", dest="format", choices=["glyphs", "atlas", "atlas-rle"], default="glyphs", help="glyph bitmap storage: one bitmap per glyph (zlib streams with --compress), an uncompressed 4bpp atlas, or run-length encoded glyphs.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
 parser.add_argument("--string", action="store", help="A string of all required characters. intervals are made up of this" )
 
@@ -68,8 +71,10 @@ font_stack = [freetype.Face(f) for f in args.fontstack]
 font_files =  args.fontstack
 face_index = 0
 font_file =  font_files[face_index]
-compress = args.compress
-size = args.size
+compress = args.compress and args.format == "glyphs"
+font_format = args.format
+sizes = sorted(int(n) for n in args.size.split(","))
+size = sizes[0]
 font_name = args.name
 
 for face in font_stack:
@@ -137,11 +142,6 @@ def norm_floor(val):
 def norm_ceil(val):
     return int(math.ceil(val / (1 << 6)))
 
-for face in font_stack:
-    # shift by 6 bytes, because sizes are given as 6-bit fractions
-    # the display has about 150 dpi.
-    face.set_char_size(size << 6, size << 6, 150, 150)
-
 def chunks(l, n):
     for i in range(0, len(l), n):
         yield l[i:i + n]
@@ -186,107 +186,387 @@ def load_glyph(code_point):
         print (f"falling back to font {face_index} for {chr(code_point)}.", file=sys.stderr)
     raise ValueError(f"code point {code_point} not found in font stack!")
 
-for i_start, i_end in intervals:
-    for code_point in range(i_start, i_end + 1):
-        # handle missing characters in font file
-        if( face.get_char_index(code_point) == 0 ):
-            print("Character ", chr(code_point), "(", code_point, ") is not in ", font_file, file=sys.stderr)
-            continue
-        face = load_glyph(code_point)
-        bitmap = face.glyph.bitmap
-        pixels = []
-        px = 0
-        for i, v in enumerate(bitmap.buffer):
-            y = i / bitmap.width
-            x = i % bitmap.width
-            if x % 2 == 0:
-                px = (v >> 4)
-            else:
-                px = px | (v & 0xF0)
-                pixels.append(px);
-                px = 0
-            # eol
-            if x == bitmap.width - 1 and bitmap.width % 2 > 0:
-                pixels.append(px)
-                px = 0
-
-        packed = bytes(pixels);
-        total_packed += len(packed)
-        compressed = packed
-        if compress:
-            compressed = zlib.compress(packed)
-
-        glyph = GlyphProps(
-            width = bitmap.width,
-            height = bitmap.rows,
-            advance_x = norm_floor(face.glyph.advance.x),
-            left = face.glyph.bitmap_left,
-            top = face.glyph.bitmap_top,
-            compressed_size = len(compressed),
-            data_offset = total_size,
-            code_point = code_point,
-        )
-        total_size += len(compressed)
-        all_glyphs.append((glyph, compressed))
+def convert(size):
+    """ render all glyphs at one size, returns the glyphs with their packed bitmaps """
+    global total_size, total_packed, all_glyphs, total_chars, ascender, descender, f_height
+    for face in font_stack:
+        # shift by 6 bytes, because sizes are given as 6-bit fractions
+        # the display has about 150 dpi.
+        face.set_char_size(size << 6, size << 6, 150, 150)
+    total_size = 0
+    total_packed = 0
+    all_glyphs = []
+    total_chars = 0
+    ascender = 0
+    descender = 100
+    f_height = 0
+    for i_start, i_end in intervals:
+        for code_point in range(i_start, i_end + 1):
+            # handle missing characters in font file
+            if( face.get_char_index(code_point) == 0 ):
+                print("Character ", chr(code_point), "(", code_point, ") is not in ", font_file, file=sys.stderr)
+                continue
+            face = load_glyph(code_point)
+            bitmap = face.glyph.bitmap
+            pixels = []
+            px = 0
+            for i, v in enumerate(bitmap.buffer):
+                y = i / bitmap.width
+                x = i % bitmap.width
+                if x % 2 == 0:
+                    px = (v >> 4)
+                else:
+                    px = px | (v & 0xF0)
+                    pixels.append(px);
+                    px = 0
+                # eol
+                if x == bitmap.width - 1 and bitmap.width % 2 > 0:
+                    pixels.append(px)
+                    px = 0
+
+            packed = bytes(pixels);
+            total_packed += len(packed)
+            compressed = packed
+            if compress:
+                compressed = zlib.compress(packed)
+
+            glyph = GlyphProps(
+                width = bitmap.width,
+                height = bitmap.rows,
+                advance_x = norm_floor(face.glyph.advance.x),
+                left = face.glyph.bitmap_left,
+                top = face.glyph.bitmap_top,
+                compressed_size = len(compressed),
+                data_offset = total_size,
+                code_point = code_point,
+            )
+            total_size += len(compressed)
+            all_glyphs.append((glyph, packed))
+    return all_glyphs
 
 # pipe seems to be a good heuristic for the "real" descender
 # face = load_glyph(ord('|'))
 # removed as max descender and assender are handled above
 
-glyph_data = []
-glyph_props = []
-for index, glyph in enumerate(all_glyphs):
-    props, compressed = glyph
-    glyph_data.extend([b for b in compressed])
-    glyph_props.append(props)
-print("", file=sys.stderr)
-print(f"Original font file {font_file} as {font_name} using {total_chars} characters", file=sys.stderr)
-
-print("total", total_packed, file=sys.stderr)
-print("compressed", total_size, file=sys.stderr)
+# atlas width in pixels, glyphs are placed on shelves at even columns
+ATLAS_WIDTH = 512
+
+def rle_encode(data):
+    # control byte n < 0x80: n + 1 literal bytes follow
+    # control byte n >= 0x80: the next byte repeats (n & 0x7F) + 1 times
+    out = []
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run > 2:
+            out.extend([0x80 | (run - 1), data[i]])
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out.extend(data[start:i])
+    return bytes(out)
+
+def encode_glyphs(all_glyphs, fmt):
+    """ returns glyph properties, bitmap data and atlas stride """
+    props = []
+    data = bytearray()
+    if fmt == "atlas":
+        stride = ATLAS_WIDTH // 2
+        placed = [None] * len(all_glyphs)
+        x = y = shelf = 0
+        # tallest first, so glyphs on a shelf are of similar height
+        for i in sorted(range(len(all_glyphs)), key = lambda i: -all_glyphs[i][0].height):
+            g = all_glyphs[i][0]
+            if x + g.width > ATLAS_WIDTH:
+                x, y, shelf = 0, y + shelf, 0
+            placed[i] = (x, y)
+            shelf = max(shelf, g.height)
+            x += g.width + g.width % 2
+        data = bytearray(stride * (y + shelf))
+        for (g, packed), (gx, gy) in zip(all_glyphs, placed):
+            byte_width = (g.width + 1) // 2
+            offset = gy * stride + gx // 2
+            for row in range(g.height):
+                data[offset + row * stride:offset + row * stride + byte_width] = packed[row * byte_width:(row + 1) * byte_width]
+            props.append(g._replace(compressed_size = len(packed), data_offset = offset))
+        return props, data, stride
+    for g, packed in all_glyphs:
+        if fmt == "atlas-rle":
+            encoded = rle_encode(packed)
+        elif fmt == "zlib":
+            encoded = zlib.compress(packed)
+        else:
+            encoded = packed
+        props.append(g._replace(compressed_size = len(encoded), data_offset = len(data)))
+        data.extend(encoded)
+    return props, data, 0
+
+def font_tables(path):
+    """ table tag -> table bytes of a TrueType/OpenType font file """
+    with open(path, "rb") as f:
+        data = f.read()
+    num_tables = struct.unpack_from(">H", data, 4)[0]
+    tables = {}
+    for i in range(num_tables):
+        tag, _, offset, length = struct.unpack_from(">4sIII", data, 12 + 16 * i)
+        tables[tag.decode("latin-1")] = data[offset:offset + length]
+    return tables
+
+def gpos_coverage(t, off):
+    """ glyph id -> coverage index """
+    fmt, count = struct.unpack_from(">HH", t, off)
+    if fmt == 1:
+        return {g: i for i, g in enumerate(struct.unpack_from(f">{count}H", t, off + 4))}
+    coverage = {}
+    for r in range(count):
+        start, end, index = struct.unpack_from(">HHH", t, off + 4 + 6 * r)
+        for g in range(start, end + 1):
+            coverage[g] = index + g - start
+    return coverage
+
+def gpos_class_def(t, off):
+    """ glyph id -> class, glyphs not in the table are class 0 """
+    fmt = struct.unpack_from(">H", t, off)[0]
+    classes = {}
+    if fmt == 1:
+        start, count = struct.unpack_from(">HH", t, off + 2)
+        for i, c in enumerate(struct.unpack_from(f">{count}H", t, off + 6)):
+            classes[start + i] = c
+        return classes
+    count = struct.unpack_from(">H", t, off + 2)[0]
+    for r in range(count):
+        start, end, c = struct.unpack_from(">HHH", t, off + 4 + 6 * r)
+        for g in range(start, end + 1):
+            classes[g] = c
+    return classes
+
+def value_record(t, off, fmt):
+    """ x advance of a value record and the record size """
+    size = 2 * bin(fmt).count("1")
+    if not fmt & 0x0004:
+        return 0, size
+    return struct.unpack_from(">h", t, off + 2 * bin(fmt & 0x0003).count("1"))[0], size
+
+def gpos_pair_subtable(t, off, glyph_ids):
+    """ {(left, right): x advance} of one pair adjustment subtable, for the given glyphs """
+    fmt, coverage_off, fmt1, fmt2 = struct.unpack_from(">HHHH", t, off)
+    coverage = gpos_coverage(t, off + coverage_off)
+    size1 = 2 * bin(fmt1).count("1")
+    size2 = 2 * bin(fmt2).count("1")
+    pairs = {}
+    if fmt == 1:
+        set_count = struct.unpack_from(">H", t, off + 8)[0]
+        set_offsets = struct.unpack_from(f">{set_count}H", t, off + 10)
+        for left in glyph_ids:
+            if left not in coverage:
+                continue
+            set_off = off + set_offsets[coverage[left]]
+            count = struct.unpack_from(">H", t, set_off)[0]
+            rec = set_off + 2
+            for _ in range(count):
+                right = struct.unpack_from(">H", t, rec)[0]
+                if right in glyph_ids:
+                    pairs[(left, right)] = value_record(t, rec + 2, fmt1)[0]
+                rec += 2 + size1 + size2
+        return pairs
+    class1_off, class2_off, class1_count, class2_count = struct.unpack_from(">HHHH", t, off + 8)
+    class1 = gpos_class_def(t, off + class1_off)
+    class2 = gpos_class_def(t, off + class2_off)
+    records = off + 16
+    for left in glyph_ids:
+        if left not in coverage:
+            continue
+        row = records + class1.get(left, 0) * class2_count * (size1 + size2)
+        for right in glyph_ids:
+            pairs[(left, right)] = value_record(t, row + class2.get(right, 0) * (size1 + size2), fmt1)[0]
+    return pairs
+
+def gpos_kerning(path, glyph_ids):
+    """ {(left, right): x advance in font units} of the 'kern' feature of the GPOS table
+        within a lookup the first subtable covering a pair wins, lookups add up """
+    tables = font_tables(path)
+    if "GPOS" not in tables:
+        return {}
+    t = tables["GPOS"]
+    feature_list, lookup_list = struct.unpack_from(">HH", t, 6)
+    lookup_indices = set()
+    for i in range(struct.unpack_from(">H", t, feature_list)[0]):
+        tag, feature_off = struct.unpack_from(">4sH", t, feature_list + 2 + 6 * i)
+        if tag != b"kern":
+            continue
+        feature = feature_list + feature_off
+        count = struct.unpack_from(">H", t, feature + 2)[0]
+        lookup_indices.update(struct.unpack_from(f">{count}H", t, feature + 4))
+    kerning = {}
+    for index in sorted(lookup_indices):
+        lookup = lookup_list + struct.unpack_from(">H", t, lookup_list + 2 + 2 * index)[0]
+        lookup_type, _, count = struct.unpack_from(">HHH", t, lookup)
+        lookup_pairs = {}
+        for sub in struct.unpack_from(f">{count}H", t, lookup + 6):
+            sub_off = lookup + sub
+            sub_type = lookup_type
+            if lookup_type == 9:
+                # extension subtable
+                _, sub_type, ext_off = struct.unpack_from(">HHI", t, sub_off)
+                sub_off += ext_off
+            if sub_type != 2:
+                continue
+            for pair, adjust in gpos_pair_subtable(t, sub_off, glyph_ids).items():
+                lookup_pairs.setdefault(pair, adjust)
+        for pair, adjust in lookup_pairs.items():
+            kerning[pair] = kerning.get(pair, 0) + adjust
+    return kerning
+
+def kerning_pairs(glyph_props, size):
+    """ kerning pairs (glyph index, glyph index, adjustment), sorted by glyph index
+        read from the GPOS 'kern' feature of the first font, or its legacy 'kern' table """
+    pairs = []
+    face = font_stack[0]
+    if not args.kerning:
+        return pairs
+    ft_indices = [face.get_char_index(g.code_point) for g in glyph_props]
+    gpos = gpos_kerning(font_files[0], set(ft_indices))
+    if gpos:
+        units_per_em = struct.unpack_from(">H", font_tables(font_files[0])["head"], 18)[0]
+        # the display has about 150 dpi, see set_char_size()
+        scale = size * 150 / 72 / units_per_em
+    elif not face.has_kerning:
+        return pairs
+    for left, left_ft in enumerate(ft_indices):
+        for right, right_ft in enumerate(ft_indices):
+            if gpos:
+                adjust = int(round(gpos.get((left_ft, right_ft), 0) * scale))
+            else:
+                adjust = int(round(face.get_kerning(left_ft, right_ft).x / 64))
+            if adjust != 0:
+                pairs.append((left, right, adjust))
+    return pairs
+
+# render every size, the glyph set is the same for all of them
+fonts = []
+for size in sizes:
+    glyphs = convert(size)
+    glyph_props, glyph_data, atlas_stride = encode_glyphs(glyphs, "zlib" if compress else font_format)
+    fonts.append(dict(
+        size = size,
+        name = font_name if len(sizes) == 1 else f"{font_name}_{size}",
+        glyph_props = glyph_props,
+        glyph_data = glyph_data,
+        atlas_stride = atlas_stride,
+        kerning = kerning_pairs(glyph_props, size),
+        advance_y = norm_ceil(f_height),
+        ascender = norm_ceil(ascender),
+        descender = norm_floor(descender),
+    ))
+
+    print("", file=sys.stderr)
+    print(f"Original font file {font_file} as {font_name} size {size} using {total_chars} characters", file=sys.stderr)
+    print("total", total_packed, file=sys.stderr)
+    print("compressed", total_size, file=sys.stderr)
+    print("kerning pairs", len(fonts[-1]["kerning"]), file=sys.stderr)
+    print("bitmap size by format", file=sys.stderr)
+    for fmt in ["glyphs", "zlib", "atlas", "atlas-rle"]:
+        print(f"    {fmt:10} {len(encode_glyphs(glyphs, fmt)[1]):8} bytes", file=sys.stderr)
+
+# the exported intervals, split where the font lacks code points
+code_points = [g.code_point for g in fonts[0]["glyph_props"]]
+intervals = []
+for code_point in code_points:
+    if intervals and intervals[-1][1] == code_point - 1:
+        intervals[-1] = (intervals[-1][0], code_point)
+    else:
+        intervals.append((code_point, code_point))
 
 print("#pragma once")
-print("#include \"epdiy.h\"")
+print("#include \"epd_driver.h\"")
 
 # add font file origin and characters at the head of the output file
 print("/*")
 print ( "Created with")
 print(command_line)
 print(f"As '{font_name}' with available {total_chars} characters")
-for i, g in enumerate(glyph_props):
-    print (f"{chr(g.code_point)}", end ="" )
+for code_point in code_points:
+    print (f"{chr(code_point)}", end ="" )
 print("")
 print("*/")
 
-print(f"const uint8_t {font_name}_Bitmaps[{len(glyph_data)}] = {{")
-for c in chunks(glyph_data, 16):
-    print ("    " + " ".join(f"0x{b:02X}," for b in c))
-print ("};");
-
-
-print ('// GlyphProps[width, height, advance_x, left, top, compressed_size, data_offset, code_point]')
-print(f"const EpdGlyph {font_name}_Glyphs[] = {{")
-for i, g in enumerate(glyph_props):
-    print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// '{chr(g.code_point) if g.code_point != 92 else '<backslash>'}'")
-print ("};");
-
-print(f"const EpdUnicodeInterval {font_name}_Intervals[] = {{")
+# interval table and code point map, shared by all sizes
+print(f"const UnicodeInterval {font_name}_Intervals[] = {{")
 offset = 0
 for i_start, i_end in intervals:
     print (f"    {{ 0x{i_start:X}, 0x{i_end:X}, 0x{offset:X} }},")
     offset += i_end - i_start + 1
 print ("};");
 
-print(f"const EpdFont {font_name} = {{")
-print(f"    {font_name}_Bitmaps, // (*bitmap) Glyph bitmap pointer, all concatenated together")
-print(f"    {font_name}_Glyphs, // glyphs Glyph array")
-print(f"    {font_name}_Intervals, // intervals Valid unicode intervals for this font")
-print(f"    {len(intervals)},   // interval_count Number of unicode intervals.intervals")
-print(f"    {1 if compress else 0}, // compressed Does this font use compressed glyph bitmaps?")
-print(f"    {norm_ceil(f_height)}, // advance_y Newline distance (y axis)")
-print(f"    {norm_ceil(ascender)}, // ascender Maximal height of a glyph above the base line")
-print(f"    {norm_floor(descender)}, // descender Maximal height of a glyph below the base line")
-print("};")
+# direct glyph index for code points below 128, 0xFFFF if not in the font
+ascii_glyphs = [0xFFFF] * 128
+for i, code_point in enumerate(code_points):
+    if code_point < 128:
+        ascii_glyphs[code_point] = i
+print(f"const uint16_t {font_name}_AsciiGlyphs[128] = {{")
+for c in chunks(ascii_glyphs, 8):
+    print ("    " + " ".join(f"0x{i:04X}," for i in c))
+print ("};");
+
+for font in fonts:
+    name = font["name"]
+    print(f"const uint8_t {name}_Bitmaps[{len(font['glyph_data'])}] = {{")
+    for c in chunks(font["glyph_data"], 16):
+        print ("    " + " ".join(f"0x{b:02X}," for b in c))
+    print ("};");
+
+    print ('// GlyphProps[width, height, advance_x, left, top, compressed_size, data_offset, code_point]')
+    print(f"const GFXglyph {name}_Glyphs[] = {{")
+    for i, g in enumerate(font["glyph_props"]):
+        print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// '{chr(g.code_point) if g.code_point != 92 else '<backslash>'}'")
+    print ("};");
+
+    if font["kerning"]:
+        print(f"const KerningPair {name}_Kerning[] = {{")
+        for left, right, adjust in font["kerning"]:
+            print (f"    {{ {left}, {right}, {adjust} }},")
+        print ("};");
+
+def print_font(font, indent):
+    name = font["name"]
+    print(f"{indent}(uint8_t *){name}_Bitmaps, // (*bitmap) Glyph bitmap pointer, all concatenated together")
+    print(f"{indent}(GFXglyph *){name}_Glyphs, // glyphs Glyph array")
+    print(f"{indent}(UnicodeInterval *){font_name}_Intervals, // intervals Valid unicode intervals for this font")
+    print(f"{indent}{len(intervals)},   // interval_count Number of unicode intervals.intervals")
+    print(f"{indent}{1 if compress else 0}, // compressed Does this font use compressed glyph bitmaps?")
+    print(f"{indent}{font['advance_y']}, // advance_y Newline distance (y axis)")
+    print(f"{indent}{font['ascender']}, // ascender Maximal height of a glyph above the base line")
+    print(f"{indent}{font['descender']}, // descender Maximal height of a glyph below the base line")
+    print(f"{indent}{font_name}_AsciiGlyphs, // ascii_glyphs Glyph index of each code point below 128")
+    print(f"{indent}{['glyphs', 'atlas', 'atlas-rle'].index(font_format)}, // format Glyph bitmap storage, FontFormat_t")
+    print(f"{indent}{font['atlas_stride']}, // atlas_stride Bytes per atlas row")
+    print(f"{indent}{name + '_Kerning' if font['kerning'] else 'NULL'}, // kerning Sorted kerning pairs")
+    print(f"{indent}{len(font['kerning'])}, // kerning_count Number of kerning pairs")
+
+if len(fonts) == 1:
+    print(f"const GFXfont {font_name} = {{")
+    print_font(fonts[0], "    ")
+    print("};")
+else:
+    print(f"const GFXfont {font_name}_Fonts[] = {{")
+    for font in fonts:
+        print("    {")
+        print_font(font, "        ")
+        print("    },")
+    print("};")
+    print(f"const uint8_t {font_name}_Sizes[] = {{ " + ", ".join(f"{font['size']}" for font in fonts) + " };")
+    print(f"const FontFamily {font_name} = {{")
+    print(f"    {font_name}_Fonts, // fonts One font per size, by ascending size")
+    print(f"    {font_name}_Sizes, // sizes Font size of each font")
+    print(f"    {len(fonts)}, // font_count Number of sizes")
+    print("};")
 print("/*")
 print("Included intervals")
 for i_start, i_end in intervals:
@@ -296,4 +576,3 @@ for i_start, i_end in intervals:
     print (f"    ( {i_start}, {i_end}), ie. '{chr(i_start)}' -  '{chr(i_end)}'", file=sys.stderr)
 print("")
 print("*/")
-
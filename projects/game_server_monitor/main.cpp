@@ -11,6 +11,7 @@
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include "epd_driver.h"
+#include "text_wrap.h"
 #include "font/firasans_small.h"
 #include "utilities.h"
 #include "credentials.h"
@@ -27,6 +28,7 @@ const unsigned long UPDATE_INTERVAL = 5000;
 // ============================================================================
 
 uint8_t *framebuffer = NULL;
+uint8_t *shownFramebuffer = NULL; // what the panel currently shows
 unsigned long lastUpdate = 0;
 bool firstUpdate = true;
 
@@ -75,53 +77,16 @@ int writeText(const char *text, int x, int y)
 }
 
 /**
- * Write text with wrapping within a maximum width
+ * Write text with wrapping at spaces within a maximum width
  * Returns the final Y position after all wrapped lines
  */
 int writeTextWrapped(const char *text, int x, int y, int maxWidth)
 {
-  String str = String(text);
-  int curr_y = y;
-  int start = 0;
-
-  while (start < str.length())
-  {
-    // Find how many chars fit in maxWidth
-    int end = start;
-    int test_len = 1;
-    int32_t text_w, text_h;
-
-    // Binary search for max fitting chars (approximate)
-    int max_chars = min((int)str.length() - start, maxWidth / 8); // rough estimate: 8px per char
-
-    for (int i = 1; i <= max_chars && (start + i) <= str.length(); i++)
-    {
-      String substr = str.substring(start, start + i);
-      int32_t x1, y1;
-      get_text_bounds(&FiraSans, substr.c_str(), &x, &y, &x1, &y1, &text_w, &text_h, NULL);
-
-      if (text_w <= maxWidth)
-      {
-        end = start + i;
-      }
-      else
-      {
-        break;
-      }
-    }
-
-    if (end == start)
-      end = start + 1; // At least 1 char
-
-    // Write this line
-    String line = str.substring(start, end);
-    writeText(line.c_str(), x, curr_y);
-    curr_y += (FiraSans.advance_y / 2) + 1;
-
-    start = end;
-  }
-
-  return curr_y;
+  TextWrap wrap = {
+      .max_width = maxWidth,
+      .line_height = (FiraSans.advance_y / 2) + 1,
+      .max_lines = 0};
+  return write_text_wrapped(&FiraSans, text, x, y, &wrap, framebuffer, NULL);
 }
 
 /**
@@ -132,6 +97,19 @@ void updateDisplay()
   epd_poweron();
   epd_draw_grayscale_image(epd_full_screen(), framebuffer);
   epd_poweroff();
+  epd_damage_reset();
+  memcpy(shownFramebuffer, framebuffer, EPD_WIDTH * EPD_HEIGHT / 2);
+}
+
+/**
+ * Partial display update - only push the areas drawn since the last update,
+ * moving each pixel straight from its old to its new gray level (no flashing)
+ */
+void updateDirty()
+{
+  epd_poweron();
+  epd_flush_dirty_differential(shownFramebuffer);
+  epd_poweroff();
 }
 
 /**
@@ -142,6 +120,7 @@ void clearDisplay()
   epd_poweron();
   epd_clear();
   memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+  memset(shownFramebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
   epd_poweroff();
 }
 
@@ -149,6 +128,20 @@ void clearDisplay()
 // Display Layout Functions
 // ============================================================================
 
+// Screen is 960px wide, divide into 3 columns of ~305px each with gaps
+const int COL_WIDTH = 305;
+const int START_Y = 60;
+const int BOX_HEIGHT = 470;
+const int STATS_X = 700;
+
+/**
+ * Y position of the line under the header
+ */
+int headerLineY()
+{
+  return 20 + (FiraSans.advance_y / 2) + 5;
+}
+
 /**
  * Draw the static header
  */
@@ -158,8 +151,7 @@ void drawHeader()
   writeText("DOCKER MONITOR", 30, y);
 
   // Draw horizontal line under title
-  y += (FiraSans.advance_y / 2) + 5;
-  epd_draw_hline(20, y, EPD_WIDTH - 40, 0, framebuffer);
+  epd_draw_hline(20, headerLineY(), EPD_WIDTH - 40, 0, framebuffer);
 }
 
 /**
@@ -167,7 +159,7 @@ void drawHeader()
  */
 void drawSystemStats(float cpuTemp, float memUsage)
 {
-  int x = 700;
+  int x = STATS_X;
   int y = 20;
 
   // Draw CPU with label and padding
@@ -241,6 +233,25 @@ void drawServerBlock(const char *name, ServerState &current,
   }
 }
 
+/**
+ * Compare two server states for anything that is shown on screen
+ */
+bool stateChanged(const ServerState &a, const ServerState &b)
+{
+  return a.online != b.online || a.players != b.players ||
+         a.log1 != b.log1 || a.log2 != b.log2 || a.log3 != b.log3;
+}
+
+/**
+ * Clear and redraw one server column below the header line
+ */
+void redrawServerBlock(const char *name, ServerState &current, int x, bool hasPlayers)
+{
+  int top = headerLineY() + 1;
+  clearArea(x, top, COL_WIDTH, EPD_HEIGHT - top);
+  drawServerBlock(name, current, x, START_Y, COL_WIDTH, BOX_HEIGHT, hasPlayers);
+}
+
 // ============================================================================
 // Network Functions
 // ============================================================================
@@ -346,24 +357,46 @@ void fetchAndDisplayData(bool forceFullRedraw)
       if (satLogs.size() > 2)
         satisfactory.log3 = satLogs[2].as<String>();
 
-      // Clear framebuffer and redraw everything
-      memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+      if (forceFullRedraw)
+      {
+        // Clear framebuffer and redraw everything
+        memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
 
-      // Draw all sections
-      drawHeader();
-      drawSystemStats(cpuTemp, memUsage);
+        // Draw all sections
+        drawHeader();
+        drawSystemStats(cpuTemp, memUsage);
 
-      // Screen is 960px wide, divide into 3 columns of ~305px each with gaps
-      int colWidth = 305;
-      int startY = 60;
-      int boxHeight = 470;
+        drawServerBlock("MC BINGO", bingo, 20, START_Y, COL_WIDTH, BOX_HEIGHT, true);
+        drawServerBlock("MINECRAFT", minecraft, 335, START_Y, COL_WIDTH, BOX_HEIGHT, true);
+        drawServerBlock("SATISFACTORY", satisfactory, 650, START_Y, COL_WIDTH, BOX_HEIGHT, false);
 
-      drawServerBlock("MC BINGO", bingo, 20, startY, colWidth, boxHeight, true);
-      drawServerBlock("MINECRAFT", minecraft, 335, startY, colWidth, boxHeight, true);
-      drawServerBlock("SATISFACTORY", satisfactory, 650, startY, colWidth, boxHeight, false);
+        // Update the display
+        updateDisplay();
+      }
+      else
+      {
+        // Only redraw the sections that changed, the damage tracker
+        // records what was touched
+        if (cpuTemp != prevCpuTemp || memUsage != prevMemory)
+        {
+          clearArea(STATS_X, 0, EPD_WIDTH - STATS_X, headerLineY());
+          drawSystemStats(cpuTemp, memUsage);
+        }
+        if (stateChanged(bingo, prevBingo))
+          redrawServerBlock("MC BINGO", bingo, 20, true);
+        if (stateChanged(minecraft, prevMinecraft))
+          redrawServerBlock("MINECRAFT", minecraft, 335, true);
+        if (stateChanged(satisfactory, prevSatisfactory))
+          redrawServerBlock("SATISFACTORY", satisfactory, 650, false);
+
+        updateDirty();
+      }
 
-      // Update the display
-      updateDisplay();
+      prevCpuTemp = cpuTemp;
+      prevMemory = memUsage;
+      prevBingo = bingo;
+      prevMinecraft = minecraft;
+      prevSatisfactory = satisfactory;
 
       Serial.println("Display updated");
     }
@@ -398,7 +431,8 @@ void setup()
   // Allocate framebuffer
   Serial.println("Allocating framebuffer...");
   framebuffer = (uint8_t *)ps_calloc(sizeof(uint8_t), EPD_WIDTH * EPD_HEIGHT / 2);
-  if (!framebuffer)
+  shownFramebuffer = (uint8_t *)ps_calloc(sizeof(uint8_t), EPD_WIDTH * EPD_HEIGHT / 2);
+  if (!framebuffer || !shownFramebuffer)
   {
     Serial.println("ERROR: Framebuffer allocation failed!");
     while (1)
@@ -406,6 +440,9 @@ void setup()
   }
   Serial.println("Framebuffer OK");
 
+  // Record what is drawn, so updates only refresh the changed areas
+  epd_damage_track(framebuffer);
+
   // Initialize display
   Serial.println("Initializing display...");
   epd_init();
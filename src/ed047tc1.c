@@ -46,6 +46,35 @@ typedef struct
 
 static epd_config_register_t config_reg;
 
+/**
+ * @brief Shadow of the bits last shifted into the config register, -1 if
+ *        unknown. Pushing the same bits again is skipped.
+ */
+static int32_t pushed_cfg = -1;
+
+/**
+ * @brief Level of the config data pin after the last push.
+ */
+static bool cfg_data_high = false;
+
+/**
+ * @brief CPU cycles spent in the last latch_row(), see EPD_LATCH_MEASURE.
+ */
+static uint32_t latch_cycles = 0;
+
+/**
+ * @brief Vertical driver timing, see epd_set_row_timing().
+ */
+static uint16_t ckv_low_ticks = 50;
+#if defined(CONFIG_EPD_DISPLAY_TYPE_ED097TC2)
+static uint16_t skip_high_ticks = 2;
+static uint16_t skip_low_ticks = 2;
+#else
+// According to the spec, the OC4 maximum CKV frequency is 200kHz.
+static uint16_t skip_high_ticks = 45;
+static uint16_t skip_low_ticks = 5;
+#endif
+
 /******************************************************************************/
 /***        exported functions                                              ***/
 /******************************************************************************/
@@ -64,38 +93,65 @@ inline static void fast_gpio_set_lo(gpio_num_t gpio_num)
     GPIO.out_w1tc = (1 << gpio_num);
 }
 
-inline static void IRAM_ATTR push_cfg_bit(bool bit)
+/*
+ * Config bits in the order they are pushed, the first one in the MSB.
+ */
+inline static uint8_t IRAM_ATTR cfg_bits(const epd_config_register_t *cfg)
 {
-    fast_gpio_set_lo(CFG_CLK);
-    if (bit)
-    {
-        fast_gpio_set_hi(CFG_DATA);
-    }
-    else
-    {
-        fast_gpio_set_lo(CFG_DATA);
-    }
-    fast_gpio_set_hi(CFG_CLK);
+    return cfg->ep_output_enable << 7 |
+           cfg->ep_mode << 6 |
+           cfg->ep_scan_direction << 5 |
+           cfg->ep_stv << 4 |
+           cfg->neg_power_enable << 3 |
+           cfg->pos_power_enable << 2 |
+           cfg->power_disable << 1 |
+           cfg->ep_latch_enable;
 }
 
-static void IRAM_ATTR push_cfg(epd_config_register_t *cfg)
+/*
+ * Shift out and strobe 8 config bits. The data pin is only written when it
+ * changes. Clearing it shares a register write with the falling clock edge,
+ * setting it happens while the clock is still high.
+ */
+static void IRAM_ATTR shift_cfg_bits(uint8_t bits)
 {
     fast_gpio_set_lo(CFG_STR);
 
-    // push config bits in reverse order
-    push_cfg_bit(cfg->ep_output_enable);
-    push_cfg_bit(cfg->ep_mode);
-    push_cfg_bit(cfg->ep_scan_direction);
-    push_cfg_bit(cfg->ep_stv);
-
-    push_cfg_bit(cfg->neg_power_enable);
-    push_cfg_bit(cfg->pos_power_enable);
-    push_cfg_bit(cfg->power_disable);
-    push_cfg_bit(cfg->ep_latch_enable);
+    bool data = cfg_data_high;
+    for (int32_t i = 7; i >= 0; i--)
+    {
+        bool bit = (bits >> i) & 1;
+        if (bit)
+        {
+            if (!data)
+            {
+                fast_gpio_set_hi(CFG_DATA);
+            }
+            fast_gpio_set_lo(CFG_CLK);
+        }
+        else
+        {
+            GPIO.out_w1tc = (1 << CFG_CLK) | (1 << CFG_DATA);
+        }
+        data = bit;
+        fast_gpio_set_hi(CFG_CLK);
+    }
+    cfg_data_high = data;
 
     fast_gpio_set_hi(CFG_STR);
 }
 
+static void IRAM_ATTR push_cfg(epd_config_register_t *cfg)
+{
+    uint8_t bits = cfg_bits(cfg);
+    if (bits == pushed_cfg)
+    {
+        return;
+    }
+    shift_cfg_bits(bits);
+    pushed_cfg = bits;
+}
+
 
 void IRAM_ATTR busy_delay(uint32_t cycles)
 {
@@ -104,7 +160,7 @@ void IRAM_ATTR busy_delay(uint32_t cycles)
 }
 
 
-void epd_base_init(uint32_t epd_row_width)
+void epd_base_init(uint32_t epd_row_width, uint32_t pclk_hz)
 {
     config_reg.ep_latch_enable = false;
     config_reg.power_disable = true;
@@ -121,12 +177,15 @@ void epd_base_init(uint32_t epd_row_width)
     gpio_set_direction(CFG_STR, GPIO_MODE_OUTPUT);
     fast_gpio_set_lo(CFG_STR);
 
+    // the register contents are unknown after reset
+    pushed_cfg = -1;
     push_cfg(&config_reg);
 
     // Setup I2S
     i2s_bus_config i2s_config;
     // add an offset off dummy bytes to allow for enough timing headroom
     i2s_config.epd_row_width = epd_row_width + 32;
+    i2s_config.pclk_hz = pclk_hz;
     i2s_config.clock = CKH;
     i2s_config.start_pulse = STH;
     i2s_config.data_0 = D0;
@@ -205,23 +264,49 @@ void epd_start_frame()
     pulse_ckv_us(1, 1, true);
 }
 
-static inline void latch_row()
+static inline void IRAM_ATTR latch_row()
 {
-    config_reg.ep_latch_enable = true;
-    push_cfg(&config_reg);
+#if EPD_LATCH_MEASURE
+    uint32_t start = XTHAL_GET_CCOUNT();
+#endif
 
+    // Pulse the latch enable bit, the rest of the register is unchanged.
+    // Both edges take a full 8-bit shift: the config register is a serial
+    // shift register whose strobe copies all eight stages to the outputs.
+    // Shifting fewer bits would move the other bits to different outputs,
+    // and a transparent (held high) strobe would pass every intermediate
+    // shift through to the power enables.
     config_reg.ep_latch_enable = false;
-    push_cfg(&config_reg);
+    uint8_t bits = cfg_bits(&config_reg);
+    shift_cfg_bits(bits | 1);
+    shift_cfg_bits(bits);
+    pushed_cfg = bits;
+
+#if EPD_LATCH_MEASURE
+    latch_cycles = XTHAL_GET_CCOUNT() - start;
+#endif
+}
+
+uint32_t epd_latch_cycles()
+{
+    return latch_cycles;
+}
+
+void epd_set_row_timing(uint16_t ckv_low, uint16_t skip_high, uint16_t skip_low)
+{
+    ckv_low_ticks = ckv_low;
+    skip_high_ticks = skip_high;
+    skip_low_ticks = skip_low;
 }
 
 void  epd_skip()
 {
-#if defined(CONFIG_EPD_DISPLAY_TYPE_ED097TC2)
-    pulse_ckv_ticks(2, 2, false);
-#else
-    // According to the spec, the OC4 maximum CKV frequency is 200kHz.
-    pulse_ckv_ticks(45, 5, false);
-#endif
+    pulse_ckv_ticks(skip_high_ticks, skip_low_ticks, false);
+}
+
+void  epd_skip_rows(uint32_t count)
+{
+    pulse_ckv_repeat(skip_high_ticks, skip_low_ticks, count, false);
 }
 
 void  epd_output_row(uint32_t output_time_dus)
@@ -230,7 +315,7 @@ void  epd_output_row(uint32_t output_time_dus)
 
     latch_row();
 
-    pulse_ckv_ticks(output_time_dus, 50, false);
+    pulse_ckv_ticks(output_time_dus, ckv_low_ticks, false);
 
     i2s_start_line_output();
     i2s_switch_buffer();
@@ -256,6 +341,11 @@ uint8_t *  epd_get_current_buffer()
     return (uint8_t *)i2s_get_current_buffer();
 }
 
+uint32_t epd_bus_time_us()
+{
+    return i2s_bus_time_us();
+}
+
 /******************************************************************************/
 /***        local functions                                                 ***/
 /******************************************************************************/
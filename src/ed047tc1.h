@@ -69,6 +69,15 @@ extern "C" {
     #error "Unknown SOC"
 #endif
 
+/**
+ * @brief Count the CPU cycles of every row latch, see epd_latch_cycles().
+ *        This reads the cycle counter twice per row, so it is meant for
+ *        benchmark builds (-DEPD_LATCH_MEASURE=1).
+ */
+#ifndef EPD_LATCH_MEASURE
+#define EPD_LATCH_MEASURE 0
+#endif
+
 /******************************************************************************/
 /***        type definitions                                                ***/
 /******************************************************************************/
@@ -81,7 +90,23 @@ extern "C" {
 /***        exported functions                                              ***/
 /******************************************************************************/
 
-void epd_base_init(uint32_t epd_row_width);
+/**
+ * @brief Initialize the display control and data bus.
+ *
+ * @param epd_row_width Width of a display row in pixels.
+ * @param pclk_hz       Data bus clock frequency in Hz.
+ */
+void epd_base_init(uint32_t epd_row_width, uint32_t pclk_hz);
+
+/**
+ * @brief Set the vertical driver timing of row output, in RMT ticks.
+ *
+ * @param ckv_low_ticks   CKV low time after the row output time.
+ * @param skip_high_ticks CKV high time when skipping a row.
+ * @param skip_low_ticks  CKV low time when skipping a row.
+ */
+void epd_set_row_timing(uint16_t ckv_low_ticks, uint16_t skip_high_ticks,
+                        uint16_t skip_low_ticks);
 void epd_poweron();
 void epd_poweroff();
 
@@ -118,6 +143,17 @@ void  epd_output_row(uint32_t output_time_dus);
  */
 void  epd_skip();
 
+/**
+ * @brief Skip `count` rows without writing to them, in one RMT transaction.
+ */
+void  epd_skip_rows(uint32_t count);
+
+/**
+ * @brief CPU cycles spent latching the last row into the config register.
+ *        Always 0 unless built with EPD_LATCH_MEASURE.
+ */
+uint32_t epd_latch_cycles();
+
 /**
  * @brief Get the currently writable line buffer.
  */
@@ -131,6 +167,11 @@ uint8_t *  epd_get_current_buffer();
  */
 void  epd_switch_buffer();
 
+/**
+ * @brief Total time row data spent on the data bus, in microseconds.
+ */
+uint32_t epd_bus_time_us();
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,9 +13,11 @@
 #include <esp_assert.h>
 #include <esp_heap_caps.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include <esp_types.h>
 #include <xtensa/core-macros.h>
 
+#include <inttypes.h>
 #include <string.h>
 
 #if ESP_IDF_VERSION_MAJOR >= 5 // IDF 5+ 
@@ -31,6 +33,18 @@
  */
 #define EPD_LINE_BYTES EPD_WIDTH / 4
 
+/**
+ * @brief number of rows in flight between provide_out and feed_display.
+ *        Must be a power of two.
+ */
+#define LINE_QUEUE_LENGTH 64
+
+/**
+ * @brief number of polls of the line queue before a waiting render task
+ *        blocks, so that it does not starve the other tasks of its core.
+ */
+#define LINE_QUEUE_SPIN 256
+
 #define CLEAR_BYTE 0B10101010
 #define DARK_BYTE 0B01010101
 
@@ -50,10 +64,14 @@
 typedef struct
 {
     uint8_t *data_ptr;
+    uint8_t *prev_ptr; /** Previous image for differential updates, or NULL. */
     SemaphoreHandle_t done_smphr;
     Rect_t area;
     int32_t frame;
     DrawMode_t mode;
+    int64_t start_time; /** Frame start, from esp_timer_get_time(). */
+    int32_t col_start;  /** First column converted for output. */
+    int32_t col_end;    /** End of the converted columns, the rest is a no-op. */
 } OutputParams;
 
 /******************************************************************************/
@@ -75,10 +93,68 @@ static void write_row(uint32_t output_time_dus);
  */
 static void skip_row(uint8_t pipeline_finish_time);
 
-static void IRAM_ATTR reset_lut(uint8_t *lut_mem, DrawMode_t mode);
+/**
+ * @brief skip `count` display rows, batching the vertical driver pulses.
+ */
+static void skip_rows(int32_t count, uint8_t pipeline_finish_time);
+
+/**
+ * @brief Number of rows from `row` on which are outside of `area`, up to the
+ *        next row of the area or the end of the display.
+ */
+static int32_t rows_outside(int32_t row, Rect_t area);
 
+/**
+ * @brief Fill the lookup table for frame `k` of an update in `mode`. The
+ *        table only depends on the frame, so it can be built ahead of time.
+ */
 static void IRAM_ATTR update_LUT(uint8_t *lut_mem, uint8_t k, DrawMode_t mode);
 
+/**
+ * @brief Fill the lookup table for frame `k` of a differential update.
+ *        It is indexed by (old byte << 8 | new byte) and yields the drive
+ *        bits of the two pixels in the lower nibble. BLACK_ON_WHITE drives
+ *        the pixels that get darker, WHITE_ON_BLACK the ones that get lighter.
+ */
+static void IRAM_ATTR update_diff_LUT(uint8_t *lut_mem, uint8_t k, DrawMode_t mode);
+
+/**
+ * @brief Convert the 16 pixel words `word_start` to `word_end` of a 4bpp row
+ *        into drive bits through `conversion_lut`. Other words of
+ *        `epd_input` are left alone.
+ */
+static void IRAM_ATTR convert_line_4bpp(uint32_t *line_data, uint8_t *epd_input,
+                                        uint8_t *conversion_lut,
+                                        uint32_t word_start, uint32_t word_end);
+
+/**
+ * @brief Like convert_line_4bpp(), for a differential update from the old
+ *        to the new row through a table filled by update_diff_LUT().
+ */
+static void IRAM_ATTR convert_line_4bpp_diff(uint16_t *old_data, uint16_t *new_data,
+                                             uint8_t *epd_input, uint8_t *diff_lut,
+                                             uint32_t word_start, uint32_t word_end);
+
+/**
+ * @brief Fill the lookup table for the frame of an output job.
+ */
+static void IRAM_ATTR prepare_LUT(OutputParams *params, int32_t frame);
+
+/**
+ * @brief The lookup table used for `frame`.
+ */
+static inline uint8_t *frame_LUT(int32_t frame);
+
+/**
+ * @brief Run all frames of an image update. `prev` is NULL for the regular
+ *        draw modes. A differential update runs a darkening and a lightening
+ *        pass, `mode` is ignored for it. Only the columns from `col_start`
+ *        to `col_end` are converted and driven.
+ */
+static void IRAM_ATTR draw_image_frames(Rect_t area, uint8_t *prev, uint8_t *data,
+                                        DrawMode_t mode, int32_t col_start,
+                                        int32_t col_end);
+
 /**
  * @brief bit-shift a buffer `shift` <= 7 bits to the right.
  */
@@ -86,10 +162,66 @@ static void IRAM_ATTR bit_shift_buffer_right(uint8_t *buf, uint32_t len, int32_t
 
 static void IRAM_ATTR nibble_shift_buffer_right(uint8_t *buf, uint32_t len);
 
+/**
+ * @brief Copy the visible part of a framebuffer row of an image covering
+ *        `area` into a staging line, shifting it for odd x positions.
+ */
+static void IRAM_ATTR crop_line(uint8_t *line, uint8_t *row, Rect_t area);
+
+/**
+ * @brief Wait for a free slot in the line queue and return its staging line.
+ *        The task spins briefly, then blocks until feed_display pops a row.
+ */
+static uint8_t *IRAM_ATTR line_queue_reserve();
+
+/**
+ * @brief Hand a row to feed_display. `line` is either a framebuffer row or
+ *        the staging line returned by line_queue_reserve().
+ */
+static void IRAM_ATTR line_queue_push(uint8_t *line);
+
+/**
+ * @brief Wait for the `n`th queued row and return it. The task spins
+ *        briefly, then blocks until provide_out pushes a row.
+ */
+static uint8_t *IRAM_ATTR line_queue_peek(uint32_t n);
+
+/**
+ * @brief Release the `n` oldest rows once they are converted.
+ */
+static void IRAM_ATTR line_queue_pop(uint32_t n);
+
 static void IRAM_ATTR provide_out(OutputParams *params);
 
 static void IRAM_ATTR feed_display(OutputParams *params);
 
+/**
+ * @brief Render task bodies. Each runs its job once per task notification.
+ */
+static void IRAM_ATTR provide_out_task(void *arg);
+
+static void IRAM_ATTR feed_display_task(void *arg);
+
+/**
+ * @brief Record a changed area of `framebuffer`. The area must already be
+ *        clipped to the display.
+ */
+static void damage_add(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *framebuffer);
+
+/**
+ * @brief Combine the recorded damage into horizontal bands, sorted from top
+ *        to bottom. The bands span the columns of the damage they contain.
+ *
+ * @return The number of bands written to `bands`.
+ */
+static int32_t damage_bands(Rect_t *bands);
+
+/**
+ * @brief Fill `length` pixels of a framebuffer row, starting at `x`, with a
+ *        4 bit gray value. The span must already be clipped to the display.
+ */
+static void IRAM_ATTR fill_span(uint8_t *row, int32_t x, int32_t length, uint8_t gray);
+
 static void epd_fill_circle_helper(int32_t x0, int32_t y0, int32_t r, int32_t corners, int32_t delta,
                             uint8_t color, uint8_t *framebuffer);
 
@@ -111,10 +243,58 @@ static const int32_t contrast_cycles_4[15] = {30, 30, 20, 20, 30, 30, 30, 40, 40
 
 static const int32_t contrast_cycles_4_white[15] = {10, 10, 8, 8, 8, 8, 8, 10, 10, 15, 15, 20, 20, 100, 300};
 
-// Heap space to use for the EPD output lookup table, which
-// is calculated for each cycle.
-static uint8_t *conversion_lut;
-static QueueHandle_t output_queue;
+/**
+ * @brief Timing profile in use, set by epd_init_timing().
+ */
+static EpdTimingProfile timing;
+
+// Heap space to use for the EPD output lookup tables, which are calculated
+// for each cycle. Even and odd frames use different tables, so the next one
+// can be prepared while the current frame is written. If there is not enough
+// memory, both point to the same table.
+static uint8_t *conversion_luts[2];
+
+/**
+ * @brief Single producer / single consumer ring of row pointers. Rows which
+ *        need no cropping are passed straight from the framebuffer, all
+ *        others go through the staging line of their slot.
+ */
+static uint8_t *line_queue[LINE_QUEUE_LENGTH];
+static uint8_t *line_pool;
+static uint32_t line_queue_head; // only written by provide_out
+static uint32_t line_queue_tail; // only written by feed_display
+
+/**
+ * @brief A render task that has to wait sets its flag and blocks on the
+ *        semaphore, the other one gives it after the next push or pop.
+ */
+static SemaphoreHandle_t line_queue_space;
+static SemaphoreHandle_t line_queue_row;
+static uint32_t line_queue_space_waiting;
+static uint32_t line_queue_row_waiting;
+
+/**
+ * @brief Long-lived render tasks and the frame they are working on.
+ */
+static TaskHandle_t provide_out_handle;
+static TaskHandle_t feed_display_handle;
+static OutputParams provide_out_job;
+static OutputParams feed_display_job;
+static SemaphoreHandle_t provide_out_done;
+static SemaphoreHandle_t feed_display_done;
+
+static EpdFrameTiming frame_timing[EPD_FRAME_COUNT];
+
+/**
+ * @brief Framebuffer observed by the damage tracker, NULL if disabled.
+ */
+static uint8_t *damage_framebuffer;
+
+/**
+ * @brief Recorded damage. One spare slot is used while merging.
+ */
+static Rect_t damage_rects[EPD_DAMAGE_MAX_RECTS + 1];
+static int32_t damage_count;
 
 static const DRAM_ATTR uint32_t lut_1bpp[256] = {
     0x0000, 0x0001, 0x0004, 0x0005, 0x0010, 0x0011, 0x0014, 0x0015,
@@ -157,12 +337,120 @@ static const DRAM_ATTR uint32_t lut_1bpp[256] = {
 
 void epd_init()
 {
+    EpdTimingProfile defaults = epd_default_timing();
+    epd_init_timing(&defaults);
+}
+
+
+void epd_init_timing(const EpdTimingProfile *profile)
+{
+    uint32_t bus_pclk_hz = timing.pclk_hz;
+    if (epd_validate_timing(profile))
+    {
+        timing = *profile;
+    }
+    else
+    {
+        ESP_LOGE("epd_driver", "invalid timing profile, using defaults!");
+        timing = epd_default_timing();
+    }
+
+    epd_set_row_timing(timing.ckv_low_ticks, timing.skip_high_ticks,
+                       timing.skip_low_ticks);
+
+    // the bus, tables and render tasks live as long as the program
+    if (provide_out_handle != NULL)
+    {
+        if (timing.pclk_hz != bus_pclk_hz)
+        {
+            ESP_LOGW("epd_driver", "pixel clock is set by the first init, keeping %" PRIu32 " Hz",
+                     bus_pclk_hz);
+            timing.pclk_hz = bus_pclk_hz;
+        }
+        return;
+    }
+
     skipping = 0;
-    epd_base_init(EPD_WIDTH);
+    epd_base_init(EPD_WIDTH, timing.pclk_hz);
+
+    conversion_luts[0] = (uint8_t *)heap_caps_malloc(1 << 16, MALLOC_CAP_8BIT);
+    assert(conversion_luts[0] != NULL);
+    conversion_luts[1] = (uint8_t *)heap_caps_malloc(1 << 16, MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+    if (conversion_luts[1] == NULL)
+    {
+        ESP_LOGW("epd_driver", "no memory for a second lookup table, frames will not overlap");
+        conversion_luts[1] = conversion_luts[0];
+    }
+    line_pool = (uint8_t *)heap_caps_malloc(LINE_QUEUE_LENGTH * EPD_WIDTH / 2,
+                                            MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+    assert(line_pool != NULL);
+
+    provide_out_done = xSemaphoreCreateBinary();
+    feed_display_done = xSemaphoreCreateBinary();
+    assert(provide_out_done != NULL && feed_display_done != NULL);
+    line_queue_space = xSemaphoreCreateBinary();
+    line_queue_row = xSemaphoreCreateBinary();
+    assert(line_queue_space != NULL && line_queue_row != NULL);
+    xTaskCreatePinnedToCore(provide_out_task, "privide_out", 8192, NULL, 10,
+                            &provide_out_handle, 0);
+    xTaskCreatePinnedToCore(feed_display_task, "render", 8192, NULL, 10,
+                            &feed_display_handle, 1);
+    assert(provide_out_handle != NULL && feed_display_handle != NULL);
+}
+
+
+EpdTimingProfile epd_default_timing()
+{
+    EpdTimingProfile profile = {
+        .pclk_hz = 10 * 1000 * 1000,
+        .ckv_low_ticks = 50,
+#if defined(CONFIG_EPD_DISPLAY_TYPE_ED097TC2)
+        .skip_high_ticks = 2,
+        .skip_low_ticks = 2,
+#else
+        // According to the spec, the OC4 maximum CKV frequency is 200kHz.
+        .skip_high_ticks = 45,
+        .skip_low_ticks = 5,
+#endif
+    };
+    memcpy(profile.contrast_cycles, contrast_cycles_4, sizeof(contrast_cycles_4));
+    memcpy(profile.contrast_cycles_white, contrast_cycles_4_white,
+           sizeof(contrast_cycles_4_white));
+    return profile;
+}
+
 
-    conversion_lut = (uint8_t *)heap_caps_malloc(1 << 16, MALLOC_CAP_8BIT);
-    assert(conversion_lut != NULL);
-    output_queue = xQueueCreate(64, EPD_WIDTH / 2);
+bool epd_validate_timing(const EpdTimingProfile *profile)
+{
+    if (profile == NULL)
+    {
+        ESP_LOGE("epd_driver", "timing profile is NULL!");
+        return false;
+    }
+    if (profile->pclk_hz < 1000000 || profile->pclk_hz > 40000000)
+    {
+        ESP_LOGE("epd_driver", "pixel clock %" PRIu32 " Hz out of range!", profile->pclk_hz);
+        return false;
+    }
+    // RMT durations are 15 bit wide
+    if (profile->ckv_low_ticks == 0 || profile->ckv_low_ticks > 0x7FFF ||
+            profile->skip_high_ticks == 0 || profile->skip_high_ticks > 0x7FFF ||
+            profile->skip_low_ticks == 0 || profile->skip_low_ticks > 0x7FFF)
+    {
+        ESP_LOGE("epd_driver", "CKV timing out of range!");
+        return false;
+    }
+    for (int32_t i = 0; i < EPD_FRAME_COUNT; i++)
+    {
+        if (profile->contrast_cycles[i] <= 0 || profile->contrast_cycles[i] > 0x7FFF ||
+                profile->contrast_cycles_white[i] <= 0 ||
+                profile->contrast_cycles_white[i] > 0x7FFF)
+        {
+            ESP_LOGE("epd_driver", "contrast cycles of frame %" PRId32 " out of range!", i);
+            return false;
+        }
+    }
+    return true;
 }
 
 
@@ -185,7 +473,9 @@ void epd_push_pixels(Rect_t area, int16_t time, int32_t color)
         // before are of interest: skip
         if (i < area.y)
         {
-            skip_row(time);
+            int32_t skipped = rows_outside(i, area);
+            skip_rows(skipped, time);
+            i += skipped - 1;
             // start area of interest: set row data
         }
         else if (i == area.y)
@@ -200,7 +490,9 @@ void epd_push_pixels(Rect_t area, int16_t time, int32_t color)
         }
         else if (i >= area.y + area.height)
         {
-            skip_row(time);
+            int32_t skipped = rows_outside(i, area);
+            skip_rows(skipped, time);
+            i += skipped - 1;
             // output the same as before
         }
         else
@@ -256,30 +548,7 @@ void epd_clear()
 void IRAM_ATTR calc_epd_input_4bpp(uint32_t *line_data, uint8_t *epd_input,
                                    uint8_t k, uint8_t *conversion_lut)
 {
-    uint32_t *wide_epd_input = (uint32_t *)epd_input;
-    uint16_t *line_data_16 = (uint16_t *)line_data;
-
-    // this is reversed for little-endian, but this is later compensated
-    // through the output peripheral.
-    for (uint32_t j = 0; j < EPD_WIDTH / 16; j++)
-    {
-        uint16_t v1 = *(line_data_16++);
-        uint16_t v2 = *(line_data_16++);
-        uint16_t v3 = *(line_data_16++);
-        uint16_t v4 = *(line_data_16++);
-#if USER_I2S_REG
-        uint32_t pixel = conversion_lut[v1] << 16 |
-                         conversion_lut[v2] << 24 |
-                         conversion_lut[v3] |
-                         conversion_lut[v4] << 8;
-#else
-        uint32_t pixel = (conversion_lut[v1]) << 0  |
-                         (conversion_lut[v2]) << 8  |
-                         (conversion_lut[v3]) << 16 |
-                         (conversion_lut[v4]) << 24;
-#endif
-        wide_epd_input[j] = pixel;
-    }
+    convert_line_4bpp(line_data, epd_input, conversion_lut, 0, EPD_WIDTH / 16);
 }
 
 
@@ -305,23 +574,75 @@ inline uint32_t min(uint32_t x, uint32_t y)
 }
 
 
+static inline int32_t max(int32_t x, int32_t y)
+{
+    return x > y ? x : y;
+}
+
+
+/**
+ * @brief Clamp `x` to `lo`..`hi` in signed arithmetic, `lo` wins if `hi` is
+ *        below it.
+ */
+static inline int32_t clamp(int32_t x, int32_t lo, int32_t hi)
+{
+    return max(x < hi ? x : hi, lo);
+}
+
+
 void epd_draw_hline(int32_t x, int32_t y, int32_t length, uint8_t color, uint8_t *framebuffer)
 {
-    for (int32_t i = 0; i < length; i++)
+    if (y < 0 || y >= EPD_HEIGHT)
     {
-        int32_t xx = x + i;
-        epd_draw_pixel(xx, y, color, framebuffer);
+        return;
+    }
+    if (x < 0)
+    {
+        length += x;
+        x = 0;
+    }
+    if (x + length > EPD_WIDTH)
+    {
+        length = EPD_WIDTH - x;
+    }
+    if (length <= 0)
+    {
+        return;
     }
+    fill_span(&framebuffer[y * EPD_WIDTH / 2], x, length, color >> 4);
+    damage_add(x, y, length, 1, framebuffer);
 }
 
 
 void epd_draw_vline(int32_t x, int32_t y, int32_t length, uint8_t color, uint8_t *framebuffer)
 {
+    if (x < 0 || x >= EPD_WIDTH)
+    {
+        return;
+    }
+    if (y < 0)
+    {
+        length += y;
+        y = 0;
+    }
+    if (y + length > EPD_HEIGHT)
+    {
+        length = EPD_HEIGHT - y;
+    }
+    if (length <= 0)
+    {
+        return;
+    }
+
+    uint8_t *buf_ptr = &framebuffer[y * EPD_WIDTH / 2 + x / 2];
+    uint8_t keep = (x % 2) ? 0x0F : 0xF0;
+    uint8_t value = (x % 2) ? (color & 0xF0) : (color >> 4);
     for (int32_t i = 0; i < length; i++)
     {
-        int32_t yy = y + i;
-        epd_draw_pixel(x, yy, color, framebuffer);
+        *buf_ptr = (*buf_ptr & keep) | value;
+        buf_ptr += EPD_WIDTH / 2;
     }
+    damage_add(x, y, 1, length, framebuffer);
 }
 
 
@@ -344,6 +665,7 @@ void epd_draw_pixel(int32_t x, int32_t y, uint8_t color, uint8_t *framebuffer)
     {
         *buf_ptr = (*buf_ptr & 0xF0) | (color >> 4);
     }
+    damage_add(x, y, 1, 1, framebuffer);
 }
 
 
@@ -386,7 +708,7 @@ void epd_draw_circle(int32_t x0, int32_t y0, int32_t r, uint8_t color, uint8_t *
 
 void epd_fill_circle(int32_t x0, int32_t y0, int32_t r, uint8_t color, uint8_t *framebuffer)
 {
-    epd_draw_vline(x0, y0 - r, 2 * r + 1, color, framebuffer);
+    epd_draw_hline(x0 - r, y0, 2 * r + 1, color, framebuffer);
     epd_fill_circle_helper(x0, y0, r, 3, 0, color, framebuffer);
 }
 
@@ -417,19 +739,21 @@ static void epd_fill_circle_helper(int32_t x0, int32_t y0, int32_t r, int32_t co
         f += ddF_x;
         // These checks avoid double-drawing certain lines, important
         // for the SSD1306 library which has an INVERT drawing mode.
+        // The circle is symmetric, so the fill is done with horizontal spans
+        // (x and y swapped) which map to whole framebuffer bytes.
         if (x < (y + 1))
         {
             if (corners & 1)
-                epd_draw_vline(x0 + x, y0 - y, 2 * y + delta, color, framebuffer);
+                epd_draw_hline(x0 - y, y0 + x, 2 * y + delta, color, framebuffer);
             if (corners & 2)
-                epd_draw_vline(x0 - x, y0 - y, 2 * y + delta, color, framebuffer);
+                epd_draw_hline(x0 - y, y0 - x, 2 * y + delta, color, framebuffer);
         }
         if (y != py)
         {
             if (corners & 1)
-                epd_draw_vline(x0 + py, y0 - px, 2 * px + delta, color, framebuffer);
+                epd_draw_hline(x0 - px, y0 + py, 2 * px + delta, color, framebuffer);
             if (corners & 2)
-                epd_draw_vline(x0 - py, y0 - px, 2 * px + delta, color, framebuffer);
+                epd_draw_hline(x0 - px, y0 - py, 2 * px + delta, color, framebuffer);
             py = y;
         }
         px = x;
@@ -496,10 +820,37 @@ void epd_draw_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color, ui
 
 void epd_fill_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color, uint8_t *framebuffer)
 {
-    for (int32_t i = x; i < x + w; i++)
+    // clip once, then fill row by row
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (x + w > EPD_WIDTH)
+    {
+        w = EPD_WIDTH - x;
+    }
+    if (y + h > EPD_HEIGHT)
+    {
+        h = EPD_HEIGHT - y;
+    }
+    if (w <= 0 || h <= 0)
+    {
+        return;
+    }
+
+    uint8_t *row = &framebuffer[y * EPD_WIDTH / 2];
+    for (int32_t i = 0; i < h; i++)
     {
-        epd_draw_vline(i, y, h, color, framebuffer);
+        fill_span(row, x, w, color >> 4);
+        row += EPD_WIDTH / 2;
     }
+    damage_add(x, y, w, h, framebuffer);
 }
 
 
@@ -534,17 +885,24 @@ void epd_write_line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint8_t colo
         ystep = -1;
     }
 
+    // Pixels are emitted as runs along the major axis, so shallow lines
+    // become a few horizontal spans instead of single pixel writes.
+    int32_t run_start = x0;
     for (; x0 <= x1; x0++)
     {
-        if (steep)
-        {
-            epd_draw_pixel(y0, x0, color, framebuffer);
-        }
-        else
+        err -= dy;
+        if (err < 0 || x0 == x1)
         {
-            epd_draw_pixel(x0, y0, color, framebuffer);
+            if (steep)
+            {
+                epd_draw_vline(y0, run_start, x0 - run_start + 1, color, framebuffer);
+            }
+            else
+            {
+                epd_draw_hline(run_start, y0, x0 - run_start + 1, color, framebuffer);
+            }
+            run_start = x0 + 1;
         }
-        err -= dy;
         if (err < 0)
         {
             y0 += ystep;
@@ -715,6 +1073,117 @@ void epd_copy_to_framebuffer(Rect_t image_area, uint8_t *image_data,
             *buf_ptr = (*buf_ptr & 0xF0) | val;
         }
     }
+    epd_damage_add(image_area, framebuffer);
+}
+
+
+void epd_damage_track(uint8_t *framebuffer)
+{
+    damage_framebuffer = framebuffer;
+    damage_count = 0;
+}
+
+
+void epd_damage_add(Rect_t area, uint8_t *framebuffer)
+{
+    if (area.x < 0)
+    {
+        area.width += area.x;
+        area.x = 0;
+    }
+    if (area.y < 0)
+    {
+        area.height += area.y;
+        area.y = 0;
+    }
+    if (area.x + area.width > EPD_WIDTH)
+    {
+        area.width = EPD_WIDTH - area.x;
+    }
+    if (area.y + area.height > EPD_HEIGHT)
+    {
+        area.height = EPD_HEIGHT - area.y;
+    }
+    if (area.width <= 0 || area.height <= 0)
+    {
+        return;
+    }
+    damage_add(area.x, area.y, area.width, area.height, framebuffer);
+}
+
+
+void epd_damage_reset()
+{
+    damage_count = 0;
+}
+
+
+int32_t epd_damage_get(Rect_t *rects, int32_t max_rects)
+{
+    int32_t count = clamp(damage_count, 0, max_rects);
+    memcpy(rects, damage_rects, count * sizeof(Rect_t));
+    return count;
+}
+
+
+void epd_flush_dirty(DrawMode_t mode)
+{
+    Rect_t bands[EPD_DAMAGE_MAX_RECTS];
+    int32_t count = damage_bands(bands);
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        // draw whole framebuffer rows, but only convert the damaged columns
+        Rect_t rows = {
+            .x = 0,
+            .y = bands[i].y,
+            .width = EPD_WIDTH,
+            .height = bands[i].height,
+        };
+        // rows are converted 16 pixels at a time, clear all of them
+        int32_t col_start = bands[i].x & ~15;
+        int32_t col_end = clamp((bands[i].x + bands[i].width + 15) & ~15,
+                                col_start, EPD_WIDTH);
+        if (mode == WHITE_ON_BLACK)
+        {
+            // white pixels are driven in this mode, keep the whole rows
+            col_start = 0;
+            col_end = EPD_WIDTH;
+        }
+        Rect_t cleared = {
+            .x = col_start,
+            .y = rows.y,
+            .width = col_end - col_start,
+            .height = rows.height,
+        };
+        epd_clear_area(cleared);
+        draw_image_frames(rows, NULL, &damage_framebuffer[rows.y * EPD_WIDTH / 2], mode,
+                          col_start, col_end);
+    }
+    damage_count = 0;
+}
+
+
+void epd_flush_dirty_differential(uint8_t *prev_framebuffer)
+{
+    Rect_t bands[EPD_DAMAGE_MAX_RECTS];
+    int32_t count = damage_bands(bands);
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        uint32_t offset = bands[i].y * EPD_WIDTH / 2;
+        Rect_t rows = {
+            .x = 0,
+            .y = bands[i].y,
+            .width = EPD_WIDTH,
+            .height = bands[i].height,
+        };
+        draw_image_frames(rows, &prev_framebuffer[offset], &damage_framebuffer[offset],
+                          BLACK_ON_WHITE, bands[i].x, bands[i].x + bands[i].width);
+        memcpy(&prev_framebuffer[offset], &damage_framebuffer[offset],
+               bands[i].height * EPD_WIDTH / 2);
+    }
+    damage_count = 0;
 }
 
 
@@ -746,7 +1215,9 @@ void IRAM_ATTR epd_draw_frame_1bit(Rect_t area, uint8_t *ptr,
     {
         if (i < area.y || i >= area.y + area.height)
         {
-            skip_row(time);
+            int32_t skipped = rows_outside(i, area);
+            skip_rows(skipped, time);
+            i += skipped - 1;
             continue;
         }
 
@@ -815,52 +1286,96 @@ void IRAM_ATTR epd_draw_frame_1bit(Rect_t area, uint8_t *ptr,
 
 void IRAM_ATTR epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode)
 {
-    uint8_t frame_count = 15;
-
-    SemaphoreHandle_t fetch_sem = xSemaphoreCreateBinary();
-    SemaphoreHandle_t feed_sem = xSemaphoreCreateBinary();
-    vTaskDelay(10);
-    for (uint8_t k = 0; k < frame_count; k++)
+    int32_t col_start = clamp(area.x, 0, EPD_WIDTH);
+    int32_t col_end = clamp(area.x + area.width, col_start, EPD_WIDTH);
+    if (mode == WHITE_ON_BLACK)
     {
-        OutputParams p1 = {
-            .area = area,
-            .data_ptr = data,
-            .frame = k,
-            .mode = mode,
-            .done_smphr = fetch_sem,
-        };
-        OutputParams p2 = {
-            .area = area,
-            .data_ptr = data,
-            .frame = k,
-            .mode = mode,
-            .done_smphr = feed_sem,
-        };
-
-        TaskHandle_t t1, t2;
-        xTaskCreatePinnedToCore((void (*)(void *))provide_out, "privide_out", 8192,
-                                &p1, 10, &t1, 0);
-        xTaskCreatePinnedToCore((void (*)(void *))feed_display, "render", 8192, &p2,
-                                10, &t2, 1);
+        // the white padding around the area is driven in this mode
+        col_start = 0;
+        col_end = EPD_WIDTH;
+    }
+    draw_image_frames(area, NULL, data, mode, col_start, col_end);
+}
 
-        xSemaphoreTake(fetch_sem, portMAX_DELAY);
-        xSemaphoreTake(feed_sem, portMAX_DELAY);
 
-        vTaskDelete(t1);
-        vTaskDelete(t2);
-        vTaskDelay(5);
-    }
-    vSemaphoreDelete(fetch_sem);
-    vSemaphoreDelete(feed_sem);
+void IRAM_ATTR epd_draw_image_differential(Rect_t area, uint8_t *old_data, uint8_t *new_data)
+{
+    int32_t col_start = clamp(area.x, 0, EPD_WIDTH);
+    int32_t col_end = clamp(area.x + area.width, col_start, EPD_WIDTH);
+    draw_image_frames(area, old_data, new_data, BLACK_ON_WHITE, col_start, col_end);
 }
 
-/******************************************************************************/
-/***        local functions                                                 ***/
-/******************************************************************************/
 
-static void write_row(uint32_t output_time_dus)
+const EpdFrameTiming *epd_frame_timing()
 {
-    // avoid too light output after skipping on some displays
+    return frame_timing;
+}
+
+
+void epd_log_frame_timing()
+{
+    uint32_t total_us = 0;
+    for (int32_t i = 0; i < EPD_FRAME_COUNT; i++)
+    {
+        const EpdFrameTiming *t = &frame_timing[i];
+        ESP_LOGI("epd_driver", "frame %2" PRId32 ": lut %" PRIu32 " us, fetch %" PRIu32
+                 " us, output %" PRIu32 " us (convert %" PRIu32 " us, bus %" PRIu32 " us)",
+                 i, t->lut_us, t->fetch_us, t->output_us, t->convert_us, t->bus_us);
+        total_us += t->output_us;
+    }
+    ESP_LOGI("epd_driver", "update took %" PRIu32 " us", total_us);
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void IRAM_ATTR draw_image_frames(Rect_t area, uint8_t *prev, uint8_t *data,
+                                        DrawMode_t mode, int32_t col_start,
+                                        int32_t col_end)
+{
+    // Darkening and lightening need different frame times, so a
+    // differential update drives them in two passes with their own tables
+    DrawMode_t modes[2] = { BLACK_ON_WHITE, WHITE_ON_BLACK };
+    int32_t passes = 2;
+    if (prev == NULL)
+    {
+        modes[0] = mode;
+        passes = 1;
+    }
+
+    for (int32_t pass = 0; pass < passes; pass++)
+    {
+        for (uint8_t k = 0; k < EPD_FRAME_COUNT; k++)
+        {
+            OutputParams job = {
+                .area = area,
+                .data_ptr = data,
+                .prev_ptr = prev,
+                .frame = k,
+                .mode = modes[pass],
+                .start_time = esp_timer_get_time(),
+                .col_start = col_start,
+                .col_end = col_end,
+            };
+            provide_out_job = job;
+            provide_out_job.done_smphr = provide_out_done;
+            feed_display_job = job;
+            feed_display_job.done_smphr = feed_display_done;
+
+            xTaskNotifyGive(provide_out_handle);
+            xTaskNotifyGive(feed_display_handle);
+
+            xSemaphoreTake(provide_out_done, portMAX_DELAY);
+            xSemaphoreTake(feed_display_done, portMAX_DELAY);
+        }
+    }
+}
+
+
+static void write_row(uint32_t output_time_dus)
+{
+    // avoid too light output after skipping on some displays
     if (skipping)
     {
         // vTaskDelay(20);
@@ -902,6 +1417,32 @@ static void skip_row(uint8_t pipeline_finish_time)
 }
 
 
+static void skip_rows(int32_t count, uint8_t pipeline_finish_time)
+{
+    // the first two skipped rows still flush the pipeline
+    while (count > 0 && skipping < 2)
+    {
+        skip_row(pipeline_finish_time);
+        count--;
+    }
+    if (count > 0)
+    {
+        epd_skip_rows(count);
+        skipping += count;
+    }
+}
+
+
+static int32_t rows_outside(int32_t row, Rect_t area)
+{
+    if (row < area.y)
+    {
+        return (area.y < EPD_HEIGHT ? area.y : EPD_HEIGHT) - row;
+    }
+    return EPD_HEIGHT - row;
+}
+
+
 static void reorder_line_buffer(uint32_t *line_data)
 {
     for (uint32_t i = 0; i < EPD_LINE_BYTES / 4; i++)
@@ -912,55 +1453,270 @@ static void reorder_line_buffer(uint32_t *line_data)
 }
 
 
-static void IRAM_ATTR reset_lut(uint8_t *lut_mem, DrawMode_t mode)
+static void IRAM_ATTR update_LUT(uint8_t *lut_mem, uint8_t k, DrawMode_t mode)
 {
-    switch (mode)
+    // Drive bits for a single pixel. Black on white darkens a pixel of value v
+    // in frames 0 .. 14 - v, white on white lightens it in the same frames,
+    // white on black lightens it in frames 0 .. v - 1.
+    uint8_t pixel_lut[16];
+    for (uint32_t v = 0; v < 16; v++)
     {
-    case BLACK_ON_WHITE:
-        memset(lut_mem, 0x55, (1 << 16));
-        break;
-    case WHITE_ON_BLACK:
-    case WHITE_ON_WHITE:
-        memset(lut_mem, 0xAA, (1 << 16));
-        break;
-    default:
-        ESP_LOGW("epd_driver", "unknown draw mode %d!", mode);
-        break;
+        switch (mode)
+        {
+        case BLACK_ON_WHITE:
+            pixel_lut[v] = v + k <= 14 ? 0x1 : 0x0;
+            break;
+        case WHITE_ON_WHITE:
+            pixel_lut[v] = v + k <= 14 ? 0x2 : 0x0;
+            break;
+        case WHITE_ON_BLACK:
+            pixel_lut[v] = v > k ? 0x2 : 0x0;
+            break;
+        default:
+            pixel_lut[v] = 0x0;
+            break;
+        }
+    }
+
+    // each index holds four pixels, build it from two pixel pairs
+    uint8_t byte_lut[256];
+    for (uint32_t b = 0; b < 256; b++)
+    {
+        byte_lut[b] = pixel_lut[b & 0x0F] | pixel_lut[b >> 4] << 2;
+    }
+
+    uint32_t *wide_lut = (uint32_t *)lut_mem;
+    for (uint32_t hi = 0; hi < 256; hi++)
+    {
+        uint32_t high = (uint32_t)(byte_lut[hi] << 4) * 0x01010101;
+        for (uint32_t lo = 0; lo < 256; lo += 4)
+        {
+            *(wide_lut++) = high | byte_lut[lo] | byte_lut[lo + 1] << 8 |
+                            byte_lut[lo + 2] << 16 | byte_lut[lo + 3] << 24;
+        }
     }
 }
 
 
-static void IRAM_ATTR update_LUT(uint8_t *lut_mem, uint8_t k, DrawMode_t mode)
+static void IRAM_ATTR prepare_LUT(OutputParams *params, int32_t frame)
+{
+    if (params->prev_ptr != NULL)
+    {
+        update_diff_LUT(frame_LUT(frame), frame, params->mode);
+    }
+    else
+    {
+        update_LUT(frame_LUT(frame), frame, params->mode);
+    }
+}
+
+
+static inline uint8_t *frame_LUT(int32_t frame)
+{
+    return conversion_luts[frame % 2];
+}
+
+
+static void damage_add(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t *framebuffer)
 {
-    if (mode == BLACK_ON_WHITE || mode == WHITE_ON_WHITE)
+    if (framebuffer != damage_framebuffer || framebuffer == NULL)
     {
-        k = 15 - k;
+        return;
+    }
+
+    // nothing to do if already covered
+    for (int32_t i = 0; i < damage_count; i++)
+    {
+        Rect_t *r = &damage_rects[i];
+        if (x >= r->x && y >= r->y &&
+                x + w <= r->x + r->width && y + h <= r->y + r->height)
+        {
+            return;
+        }
+    }
+
+    // absorb every rectangle that overlaps or touches the new one
+    int32_t x2 = x + w;
+    int32_t y2 = y + h;
+    int32_t i = 0;
+    while (i < damage_count)
+    {
+        Rect_t *r = &damage_rects[i];
+        if (x <= r->x + r->width && r->x <= x2 &&
+                y <= r->y + r->height && r->y <= y2)
+        {
+            x = min(x, r->x);
+            y = min(y, r->y);
+            x2 = max(x2, r->x + r->width);
+            y2 = max(y2, r->y + r->height);
+            damage_rects[i] = damage_rects[--damage_count];
+            // the grown rectangle may now touch one that was already checked
+            i = 0;
+            continue;
+        }
+        i++;
     }
 
-    // reset the pixels which are not to be lightened / darkened
-    // any longer in the current frame
-    for (uint32_t l = k; l < (1 << 16); l += 16)
+    Rect_t area = {.x = x, .y = y, .width = x2 - x, .height = y2 - y};
+    damage_rects[damage_count++] = area;
+    if (damage_count <= EPD_DAMAGE_MAX_RECTS)
     {
-        lut_mem[l] &= 0xFC;
+        return;
     }
 
-    for (uint32_t l = (k << 4); l < (1 << 16); l += (1 << 8))
+    // over the limit: merge the pair that wastes the least area
+    int32_t best_a = 0, best_b = 1;
+    int64_t best_cost = INT64_MAX;
+    for (int32_t a = 0; a < damage_count; a++)
     {
-        for (uint32_t p = 0; p < 16; p++)
+        for (int32_t b = a + 1; b < damage_count; b++)
         {
-            lut_mem[l + p] &= 0xF3;
+            Rect_t *ra = &damage_rects[a];
+            Rect_t *rb = &damage_rects[b];
+            int64_t uw = max(ra->x + ra->width, rb->x + rb->width) - min(ra->x, rb->x);
+            int64_t uh = max(ra->y + ra->height, rb->y + rb->height) - min(ra->y, rb->y);
+            int64_t cost = uw * uh - (int64_t)ra->width * ra->height
+                           - (int64_t)rb->width * rb->height;
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best_a = a;
+                best_b = b;
+            }
         }
     }
-    for (uint32_t l = (k << 8); l < (1 << 16); l += (1 << 12))
+    Rect_t *ra = &damage_rects[best_a];
+    Rect_t *rb = &damage_rects[best_b];
+    int32_t ux = min(ra->x, rb->x);
+    int32_t uy = min(ra->y, rb->y);
+    ra->width = max(ra->x + ra->width, rb->x + rb->width) - ux;
+    ra->height = max(ra->y + ra->height, rb->y + rb->height) - uy;
+    ra->x = ux;
+    ra->y = uy;
+    damage_rects[best_b] = damage_rects[--damage_count];
+}
+
+
+static int32_t damage_bands(Rect_t *bands)
+{
+    if (damage_framebuffer == NULL || damage_count == 0)
+    {
+        return 0;
+    }
+
+    // sort by top edge, there are only a few rectangles
+    Rect_t rects[EPD_DAMAGE_MAX_RECTS];
+    int32_t count = damage_count;
+    memcpy(rects, damage_rects, count * sizeof(Rect_t));
+    for (int32_t i = 1; i < count; i++)
     {
-        for (uint32_t p = 0; p < (1 << 8); p++)
+        Rect_t r = rects[i];
+        int32_t j = i - 1;
+        while (j >= 0 && rects[j].y > r.y)
         {
-            lut_mem[l + p] &= 0xCF;
+            rects[j + 1] = rects[j];
+            j--;
         }
+        rects[j + 1] = r;
     }
-    for (uint32_t p = (k << 12); p < ((k + 1) << 12); p++)
+
+    int32_t band_count = 0;
+    int32_t band_start = rects[0].y;
+    int32_t band_end = rects[0].y + rects[0].height;
+    int32_t band_left = rects[0].x;
+    int32_t band_right = rects[0].x + rects[0].width;
+    for (int32_t i = 1; i <= count; i++)
     {
-        lut_mem[p] &= 0x3F;
+        if (i < count && rects[i].y <= band_end)
+        {
+            band_end = max(band_end, rects[i].y + rects[i].height);
+            band_left = min(band_left, rects[i].x);
+            band_right = max(band_right, rects[i].x + rects[i].width);
+            continue;
+        }
+
+        Rect_t band = {
+            .x = band_left,
+            .y = band_start,
+            .width = band_right - band_left,
+            .height = band_end - band_start,
+        };
+        bands[band_count++] = band;
+
+        if (i < count)
+        {
+            band_start = rects[i].y;
+            band_end = rects[i].y + rects[i].height;
+            band_left = rects[i].x;
+            band_right = rects[i].x + rects[i].width;
+        }
+    }
+    return band_count;
+}
+
+
+static void IRAM_ATTR fill_span(uint8_t *row, int32_t x, int32_t length, uint8_t gray)
+{
+    uint8_t *buf_ptr = &row[x / 2];
+
+    // leading odd pixel lives in the upper nibble
+    if (x % 2)
+    {
+        *buf_ptr = (*buf_ptr & 0x0F) | (gray << 4);
+        buf_ptr++;
+        length--;
+    }
+
+    // whole bytes in the middle
+    uint32_t bytes = length / 2;
+    if (bytes > 0)
+    {
+        memset(buf_ptr, gray | (gray << 4), bytes);
+        buf_ptr += bytes;
+    }
+
+    // trailing even pixel lives in the lower nibble
+    if (length % 2)
+    {
+        *buf_ptr = (*buf_ptr & 0xF0) | gray;
+    }
+}
+
+
+static void IRAM_ATTR update_diff_LUT(uint8_t *lut_mem, uint8_t k, DrawMode_t mode)
+{
+    // Drive bits for a single (old, new) pixel pair. In the BLACK_ON_WHITE
+    // pass a pixel that gets darker is darkened in the frames a
+    // BLACK_ON_WHITE update would darken `new` but not `old`. In the
+    // WHITE_ON_BLACK pass a pixel that gets lighter is lightened in the frames
+    // a WHITE_ON_BLACK update would lighten `new` but not `old`. Each pass is
+    // timed from the contrast table of its mode.
+    uint8_t pixel_lut[256];
+    for (uint32_t o = 0; o < 16; o++)
+    {
+        for (uint32_t n = 0; n < 16; n++)
+        {
+            uint8_t drive = 0x0;
+            if (mode == BLACK_ON_WHITE && n < o && o + k >= 15 && n + k <= 14)
+            {
+                drive = 0x1;
+            }
+            else if (mode == WHITE_ON_BLACK && n > o && k >= o && k < n)
+            {
+                drive = 0x2;
+            }
+            pixel_lut[o << 4 | n] = drive;
+        }
+    }
+
+    for (uint32_t o = 0; o < 256; o++)
+    {
+        uint8_t *lut_row = &lut_mem[o << 8];
+        for (uint32_t n = 0; n < 256; n++)
+        {
+            lut_row[n] = pixel_lut[(o & 0x0F) << 4 | (n & 0x0F)] |
+                         pixel_lut[(o & 0xF0) | n >> 4] << 2;
+        }
     }
 }
 
@@ -987,29 +1743,153 @@ static void IRAM_ATTR nibble_shift_buffer_right(uint8_t *buf, uint32_t len)
     }
 }
 
+static void IRAM_ATTR crop_line(uint8_t *line, uint8_t *row, Rect_t area)
+{
+    uint8_t *buf_start = line;
+    uint32_t line_bytes = area.width / 2 + area.width % 2;
+    if (area.x >= 0)
+    {
+        buf_start += area.x / 2;
+    }
+    else
+    {
+        // reduce line_bytes to actually used bytes
+        line_bytes += area.x / 2;
+    }
+    uint32_t available = EPD_WIDTH / 2 - (uint32_t)(buf_start - line);
+    line_bytes = min(line_bytes, available);
+
+    bool shifted = area.x % 2 == 1 && area.x < EPD_WIDTH;
+    if (shifted && line_bytes < available)
+    {
+        // the previous shift of this line carried a nibble into this byte
+        buf_start[line_bytes] = 0xFF;
+    }
+    memcpy(buf_start, row, line_bytes);
+
+    // mask last nibble for uneven width
+    if (area.width % 2 == 1 && area.x / 2 + area.width / 2 + 1 < EPD_WIDTH)
+    {
+        *(buf_start + line_bytes - 1) |= 0xF0;
+    }
+    if (shifted)
+    {
+        // shift one nibble to right
+        nibble_shift_buffer_right(buf_start, min(line_bytes + 1, available));
+    }
+}
+
+
+static uint8_t *IRAM_ATTR line_queue_reserve()
+{
+    uint32_t head = line_queue_head;
+    uint32_t spins = 0;
+    while (head - __atomic_load_n(&line_queue_tail, __ATOMIC_SEQ_CST) >= LINE_QUEUE_LENGTH)
+    {
+        // the consumer runs on the other core, spin a little before sleeping
+        // until it frees a slot
+        if (++spins < LINE_QUEUE_SPIN)
+        {
+            continue;
+        }
+        __atomic_store_n(&line_queue_space_waiting, 1, __ATOMIC_SEQ_CST);
+        // a pop between the check above and the flag did not see the flag
+        if (head - __atomic_load_n(&line_queue_tail, __ATOMIC_SEQ_CST) >= LINE_QUEUE_LENGTH)
+        {
+            xSemaphoreTake(line_queue_space, portMAX_DELAY);
+        }
+        __atomic_store_n(&line_queue_space_waiting, 0, __ATOMIC_SEQ_CST);
+    }
+    return &line_pool[(head % LINE_QUEUE_LENGTH) * EPD_WIDTH / 2];
+}
+
+
+static void IRAM_ATTR line_queue_push(uint8_t *line)
+{
+    uint32_t head = line_queue_head;
+    line_queue[head % LINE_QUEUE_LENGTH] = line;
+    __atomic_store_n(&line_queue_head, head + 1, __ATOMIC_SEQ_CST);
+    if (__atomic_exchange_n(&line_queue_row_waiting, 0, __ATOMIC_SEQ_CST))
+    {
+        xSemaphoreGive(line_queue_row);
+    }
+}
+
+
+static uint8_t *IRAM_ATTR line_queue_peek(uint32_t n)
+{
+    uint32_t tail = line_queue_tail;
+    uint32_t spins = 0;
+    while (__atomic_load_n(&line_queue_head, __ATOMIC_SEQ_CST) - tail <= n)
+    {
+        // the producer runs on the other core, spin a little before sleeping
+        // until the row is queued
+        if (++spins < LINE_QUEUE_SPIN)
+        {
+            continue;
+        }
+        __atomic_store_n(&line_queue_row_waiting, 1, __ATOMIC_SEQ_CST);
+        // a push between the check above and the flag did not see the flag
+        if (__atomic_load_n(&line_queue_head, __ATOMIC_SEQ_CST) - tail <= n)
+        {
+            xSemaphoreTake(line_queue_row, portMAX_DELAY);
+        }
+        __atomic_store_n(&line_queue_row_waiting, 0, __ATOMIC_SEQ_CST);
+    }
+    return line_queue[(tail + n) % LINE_QUEUE_LENGTH];
+}
+
+
+static void IRAM_ATTR line_queue_pop(uint32_t n)
+{
+    __atomic_store_n(&line_queue_tail, line_queue_tail + n, __ATOMIC_SEQ_CST);
+    if (__atomic_exchange_n(&line_queue_space_waiting, 0, __ATOMIC_SEQ_CST))
+    {
+        xSemaphoreGive(line_queue_space);
+    }
+}
+
+
 static void IRAM_ATTR provide_out(OutputParams *params)
 {
-    uint8_t line[EPD_WIDTH / 2];
-    memset(line, 255, EPD_WIDTH / 2);
     Rect_t area = params->area;
-    uint8_t *ptr = params->data_ptr;
 
-    if (params->frame == 0)
+    // differential updates send the old row ahead of the new one
+    uint8_t *sources[2] = { params->prev_ptr, params->data_ptr };
+
+    // with two tables, the table of the following frames is prepared
+    // at the end of the previous one
+    bool double_buffered = conversion_luts[0] != conversion_luts[1];
+    if (params->frame == 0 || !double_buffered)
     {
-        reset_lut(conversion_lut, params->mode);
+        prepare_LUT(params, params->frame);
     }
+    frame_timing[params->frame].lut_us = esp_timer_get_time() - params->start_time;
 
-    update_LUT(conversion_lut, params->frame, params->mode);
-
-    if (area.x < 0)
+    if (params->frame == 0)
     {
-        ptr += -area.x / 2;
+        // crop_line only writes the bytes covered by the area, the rest of
+        // the staging lines stays white for the whole update
+        memset(line_pool, 255, LINE_QUEUE_LENGTH * EPD_WIDTH / 2);
     }
-    if (area.y < 0)
+
+    for (int32_t s = 0; s < 2; s++)
     {
-        ptr += (area.width / 2 + area.width % 2) * -area.y;
+        if (sources[s] == NULL)
+        {
+            continue;
+        }
+        if (area.x < 0)
+        {
+            sources[s] += -area.x / 2;
+        }
+        if (area.y < 0)
+        {
+            sources[s] += (area.width / 2 + area.width % 2) * -area.y;
+        }
     }
 
+    bool full_width = area.width == EPD_WIDTH && area.x == 0;
     for (int32_t i = 0; i < EPD_HEIGHT; i++)
     {
         if (i < area.y || i >= area.y + area.height)
@@ -1017,85 +1897,96 @@ static void IRAM_ATTR provide_out(OutputParams *params)
             continue;
         }
 
-        uint32_t *lp;
-        bool shifted = false;
-        if (area.width == EPD_WIDTH && area.x == 0)
+        for (int32_t s = 0; s < 2; s++)
         {
-            lp = (uint32_t *)ptr;
-            ptr += EPD_WIDTH / 2;
-        }
-        else
-        {
-            uint8_t *buf_start = (uint8_t *)line;
-            uint32_t line_bytes = area.width / 2 + area.width % 2;
-            if (area.x >= 0)
+            if (sources[s] == NULL)
             {
-                buf_start += area.x / 2;
+                continue;
             }
-            else
-            {
-                // reduce line_bytes to actually used bytes
-                line_bytes += area.x / 2;
-            }
-            line_bytes =
-                min(line_bytes, EPD_WIDTH / 2 - (uint32_t)(buf_start - line));
-            memcpy(buf_start, ptr, line_bytes);
-            ptr += area.width / 2 + area.width % 2;
 
-            // mask last nibble for uneven width
-            if (area.width % 2 == 1 && area.x / 2 + area.width / 2 + 1 < EPD_WIDTH)
+            uint8_t *line = line_queue_reserve();
+            if (full_width)
             {
-                *(buf_start + line_bytes - 1) |= 0xF0;
+                line = sources[s];
             }
-            if (area.x % 2 == 1 && area.x < EPD_WIDTH)
+            else
             {
-                shifted = true;
-                // shift one nibble to right
-                nibble_shift_buffer_right(
-                    buf_start, min(line_bytes + 1, (uint32_t)line + EPD_WIDTH / 2 -
-                                                       (uint32_t)buf_start));
+                crop_line(line, sources[s], area);
             }
-            lp = (uint32_t *)line;
-        }
-        xQueueSendToBack(output_queue, lp, portMAX_DELAY);
-        if (shifted)
-        {
-            memset(line, 255, EPD_WIDTH / 2);
+            sources[s] += area.width / 2 + area.width % 2;
+            line_queue_push(line);
         }
     }
 
+    frame_timing[params->frame].fetch_us = esp_timer_get_time() - params->start_time;
+
+    // feed_display only uses the table of the current frame
+    if (double_buffered && params->frame + 1 < EPD_FRAME_COUNT)
+    {
+        prepare_LUT(params, params->frame + 1);
+    }
     xSemaphoreGive(params->done_smphr);
-    vTaskDelay(portMAX_DELAY);
 }
 
 
 static void IRAM_ATTR feed_display(OutputParams *params)
 {
     Rect_t area = params->area;
-    const int32_t *contrast_lut = contrast_cycles_4;
+    const int32_t *contrast_lut = timing.contrast_cycles;
     switch (params->mode)
     {
     case WHITE_ON_WHITE:
     case BLACK_ON_WHITE:
-        contrast_lut = contrast_cycles_4;
+        contrast_lut = timing.contrast_cycles;
         break;
     case WHITE_ON_BLACK:
-        contrast_lut = contrast_cycles_4_white;
+        contrast_lut = timing.contrast_cycles_white;
         break;
     }
 
+    // 16 pixels per output word
+    uint32_t word_start = params->col_start / 16;
+    uint32_t word_end = (params->col_end + 15) / 16;
+    if (word_start > 0 || word_end < EPD_WIDTH / 16)
+    {
+        // words outside the window are never written, they stay no-ops
+        epd_switch_buffer();
+        memset(epd_get_current_buffer(), 0, EPD_LINE_BYTES);
+        epd_switch_buffer();
+        memset(epd_get_current_buffer(), 0, EPD_LINE_BYTES);
+    }
+
+    uint32_t bus_start = epd_bus_time_us();
+    uint32_t convert_us = 0;
+
     epd_start_frame();
     for (int32_t i = 0; i < EPD_HEIGHT; i++)
     {
         if (i < area.y || i >= area.y + area.height)
         {
-            skip_row(contrast_lut[params->frame]);
+            int32_t skipped = rows_outside(i, area);
+            skip_rows(skipped, contrast_lut[params->frame]);
+            i += skipped - 1;
             continue;
         }
-        uint8_t output[EPD_WIDTH / 2];
-        xQueueReceive(output_queue, output, portMAX_DELAY);
-        calc_epd_input_4bpp((uint32_t *)output, epd_get_current_buffer(),
-                            params->frame, conversion_lut);
+        int64_t convert_start = esp_timer_get_time();
+        if (params->prev_ptr != NULL)
+        {
+            uint8_t *previous = line_queue_peek(0);
+            uint8_t *output = line_queue_peek(1);
+            convert_line_4bpp_diff((uint16_t *)previous, (uint16_t *)output,
+                                   epd_get_current_buffer(), frame_LUT(params->frame),
+                                   word_start, word_end);
+            line_queue_pop(2);
+        }
+        else
+        {
+            uint8_t *output = line_queue_peek(0);
+            convert_line_4bpp((uint32_t *)output, epd_get_current_buffer(),
+                              frame_LUT(params->frame), word_start, word_end);
+            line_queue_pop(1);
+        }
+        convert_us += esp_timer_get_time() - convert_start;
         write_row(contrast_lut[params->frame]);
     }
     if (!skipping)
@@ -1105,8 +1996,90 @@ static void IRAM_ATTR feed_display(OutputParams *params)
     }
     epd_end_frame();
 
+    frame_timing[params->frame].output_us = esp_timer_get_time() - params->start_time;
+    frame_timing[params->frame].convert_us = convert_us;
+    frame_timing[params->frame].bus_us = epd_bus_time_us() - bus_start;
     xSemaphoreGive(params->done_smphr);
-    vTaskDelay(portMAX_DELAY);
+}
+
+
+static void IRAM_ATTR provide_out_task(void *arg)
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        provide_out(&provide_out_job);
+    }
+}
+
+
+static void IRAM_ATTR feed_display_task(void *arg)
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        feed_display(&feed_display_job);
+    }
+}
+
+
+static void IRAM_ATTR convert_line_4bpp(uint32_t *line_data, uint8_t *epd_input,
+                                        uint8_t *conversion_lut,
+                                        uint32_t word_start, uint32_t word_end)
+{
+    uint32_t *wide_epd_input = (uint32_t *)epd_input;
+    uint16_t *line_data_16 = (uint16_t *)line_data + word_start * 4;
+
+    // this is reversed for little-endian, but this is later compensated
+    // through the output peripheral.
+    for (uint32_t j = word_start; j < word_end; j++)
+    {
+        uint16_t v1 = *(line_data_16++);
+        uint16_t v2 = *(line_data_16++);
+        uint16_t v3 = *(line_data_16++);
+        uint16_t v4 = *(line_data_16++);
+#if USER_I2S_REG
+        uint32_t pixel = conversion_lut[v1] << 16 |
+                         conversion_lut[v2] << 24 |
+                         conversion_lut[v3] |
+                         conversion_lut[v4] << 8;
+#else
+        uint32_t pixel = (conversion_lut[v1]) << 0  |
+                         (conversion_lut[v2]) << 8  |
+                         (conversion_lut[v3]) << 16 |
+                         (conversion_lut[v4]) << 24;
+#endif
+        wide_epd_input[j] = pixel;
+    }
+}
+
+
+static void IRAM_ATTR convert_line_4bpp_diff(uint16_t *old_data, uint16_t *new_data,
+                                             uint8_t *epd_input, uint8_t *diff_lut,
+                                             uint32_t word_start, uint32_t word_end)
+{
+    uint32_t *wide_epd_input = (uint32_t *)epd_input;
+    uint8_t out[4];
+
+    old_data += word_start * 4;
+    new_data += word_start * 4;
+    for (uint32_t j = word_start; j < word_end; j++)
+    {
+        // each 16 bit word holds four pixels, looked up a byte pair at a time
+        for (uint32_t w = 0; w < 4; w++)
+        {
+            uint16_t o = *(old_data++);
+            uint16_t n = *(new_data++);
+            out[w] = diff_lut[(o & 0xFF) << 8 | (n & 0xFF)] |
+                     diff_lut[(o & 0xFF00) | (n >> 8)] << 4;
+        }
+#if USER_I2S_REG
+        uint32_t pixel = out[0] << 16 | out[1] << 24 | out[2] | out[3] << 8;
+#else
+        uint32_t pixel = out[0] | out[1] << 8 | out[2] << 16 | out[3] << 24;
+#endif
+        wide_epd_input[j] = pixel;
+    }
 }
 
 /******************************************************************************/
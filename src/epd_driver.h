@@ -16,6 +16,7 @@ extern "C" {
 #include <esp_attr.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "utilities.h"
 /******************************************************************************/
@@ -32,6 +33,17 @@ extern "C" {
  */
 #define EPD_HEIGHT 540
 
+/**
+ * @brief Number of rectangles the damage tracker keeps before merging the
+ *        two closest ones.
+ */
+#define EPD_DAMAGE_MAX_RECTS 8
+
+/**
+ * @brief Number of frames an image update is drawn in.
+ */
+#define EPD_FRAME_COUNT 15
+
 /******************************************************************************/
 /***        type definitions                                                ***/
 /******************************************************************************/
@@ -63,6 +75,7 @@ typedef enum
 enum DrawFlags
 {
     DRAW_BACKGROUND = 1 << 0, /** Draw a background. Take the background into account when calculating the size. */
+    NO_KERNING = 1 << 1,      /** Ignore the kerning table of the font. */
 };
 
 /**
@@ -76,6 +89,34 @@ typedef struct
     uint32_t flags;          /** Additional flags, reserved for future use */
 } FontProperties;
 
+/**
+ * @brief Display timing, to trade refresh speed against image quality.
+ *
+ * @note Times are given in RMT ticks of 0.1 microseconds.
+ */
+typedef struct
+{
+    uint32_t pclk_hz;         /** Data bus clock in Hz. */
+    uint16_t ckv_low_ticks;   /** CKV low time after each row. */
+    uint16_t skip_high_ticks; /** CKV high time of a skipped row. */
+    uint16_t skip_low_ticks;  /** CKV low time of a skipped row. */
+    int32_t contrast_cycles[EPD_FRAME_COUNT];       /** CKV high time of a row in each frame, darkest first. */
+    int32_t contrast_cycles_white[EPD_FRAME_COUNT]; /** Same for WHITE_ON_BLACK updates. */
+} EpdTimingProfile;
+
+/**
+ * @brief Time spent on one frame of an image update, in microseconds. The
+ *        first three are measured from the start of the frame.
+ */
+typedef struct
+{
+    uint32_t lut_us;     /** Lookup table for the frame is ready. */
+    uint32_t fetch_us;   /** All rows have been handed to the output task. */
+    uint32_t output_us;  /** The frame has been written to the display. */
+    uint32_t convert_us; /** Total time spent converting rows. */
+    uint32_t bus_us;     /** Total time rows spent on the data bus. */
+} EpdFrameTiming;
+
 /******************************************************************************/
 /***        exported variables                                              ***/
 /******************************************************************************/
@@ -86,9 +127,36 @@ typedef struct
 
 /**
  * @brief Initialize the ePaper display
+ *
+ * @note Also starts the two render tasks used by `epd_draw_image`, pinned to
+ *       core 0 and core 1.
  */
 void epd_init();
 
+/**
+ * @brief Initialize the ePaper display with a custom timing profile.
+ *
+ * @note An invalid profile is rejected with an error message and the default
+ *       timing is used instead. The bus, lookup tables and render tasks are
+ *       set up by the first call. Later calls, between updates, only switch
+ *       the row timing and contrast tables; the pixel clock stays as it is.
+ *
+ * @param timing The timing profile, usually a modified `epd_default_timing()`.
+ */
+void epd_init_timing(const EpdTimingProfile *timing);
+
+/**
+ * @brief The timing profile used by `epd_init()`.
+ */
+EpdTimingProfile epd_default_timing();
+
+/**
+ * @brief Check a timing profile.
+ *
+ * @return true if all values are within the range the hardware supports.
+ */
+bool epd_validate_timing(const EpdTimingProfile *timing);
+
 /**
  * @brief Enable display power supply.
  */
@@ -159,6 +227,25 @@ void IRAM_ATTR epd_draw_grayscale_image(Rect_t area, uint8_t *data);
  */
 void IRAM_ATTR epd_draw_image(Rect_t area, uint8_t *data, DrawMode_t mode);
 
+/**
+ * @brief Update an area from one picture to another without clearing it.
+ *
+ * @note Every pixel is darkened or lightened from its old gray value directly
+ *       to the new one. Pixels which are the same in both pictures are not
+ *       driven at all, so there is no flashing. Darkening and lightening run
+ *       as two passes, timed like BLACK_ON_WHITE and WHITE_ON_BLACK updates.
+ *
+ * @param area     The display area to draw to. `width` and `height` of the
+ *                 area must correspond to the image dimensions in pixels.
+ * @param old_data The picture currently shown in the area, in the same format
+ *                 as `new_data`.
+ * @param new_data The picture to show, as a buffer of 4 bit wide brightness
+ *                 values. Pixel data is packed (two pixels per byte). A byte
+ *                 cannot wrap over multiple rows, images of uneven width must
+ *                 add a padding nibble per line.
+ */
+void IRAM_ATTR epd_draw_image_differential(Rect_t area, uint8_t *old_data, uint8_t *new_data);
+
 void IRAM_ATTR epd_draw_frame_1bit(Rect_t area, uint8_t *ptr, DrawMode_t mode, int32_t time);
 
 /**
@@ -181,6 +268,83 @@ Rect_t epd_full_screen();
 void epd_copy_to_framebuffer(Rect_t image_area, uint8_t *image_data,
                              uint8_t *framebuffer);
 
+/**
+ * @brief Start recording which areas of a framebuffer are drawn to.
+ *
+ * @note Only draw calls targeting this framebuffer are recorded. Overlapping
+ *       or touching areas are merged, and at most `EPD_DAMAGE_MAX_RECTS`
+ *       rectangles are kept. Pass NULL to stop tracking.
+ *
+ * @param framebuffer The framebuffer to track, which must
+ *                    be `EPD_WIDTH / 2 * EPD_HEIGHT` bytes large.
+ */
+void epd_damage_track(uint8_t *framebuffer);
+
+/**
+ * @brief Mark an area of a framebuffer as changed.
+ *
+ * @note The drawing functions of this library do this automatically, this is
+ *       only needed after writing to the framebuffer directly.
+ *
+ * @param area        The changed area, it is clipped to the display.
+ * @param framebuffer The framebuffer that was written to.
+ */
+void epd_damage_add(Rect_t area, uint8_t *framebuffer);
+
+/**
+ * @brief Forget all recorded damage.
+ */
+void epd_damage_reset();
+
+/**
+ * @brief Get the currently recorded damage.
+ *
+ * @param rects     Output array for the damaged rectangles.
+ * @param max_rects Size of `rects`.
+ *
+ * @return The number of rectangles written to `rects`, none if `max_rects`
+ *         is not positive.
+ */
+int32_t epd_damage_get(Rect_t *rects, int32_t max_rects);
+
+/**
+ * @brief Push the damaged parts of the tracked framebuffer to the display.
+ *
+ * @note Damaged rectangles are combined into horizontal bands. Each band is
+ *       cleared and then drawn from the framebuffer, only the damaged columns
+ *       of a band are driven. The recorded damage is reset afterwards. The
+ *       display must be powered on.
+ *
+ * @param mode The draw mode used for the bands.
+ */
+void epd_flush_dirty(DrawMode_t mode);
+
+/**
+ * @brief Push the damaged parts of the tracked framebuffer to the display,
+ *        using differential updates instead of clearing.
+ *
+ * @note Each damaged band is drawn with `epd_draw_image_differential` and then
+ *       copied into `prev_framebuffer`, which keeps it in sync with the
+ *       display. The recorded damage is reset afterwards. The display must be
+ *       powered on.
+ *
+ * @param prev_framebuffer A framebuffer holding what is currently shown on
+ *                         the display.
+ */
+void epd_flush_dirty_differential(uint8_t *prev_framebuffer);
+
+/**
+ * @brief Get the per-frame timing of the last image update.
+ *
+ * @return An array of `EPD_FRAME_COUNT` frame timings.
+ */
+const EpdFrameTiming *epd_frame_timing();
+
+/**
+ * @brief Log the per-frame timing of the last image update.
+ */
+void epd_log_frame_timing();
+
 /**
  * @brief Draw a pixel a given framebuffer.
  *
@@ -337,10 +501,35 @@ typedef struct
     uint8_t advance_x;        /** Distance to advance cursor (x axis) */
     int16_t left;             /** X dist from cursor pos to UL corner */
     int16_t top;              /** Y dist from cursor pos to UL corner */
-    uint16_t compressed_size; /** Size of the zlib-compressed font data. */
+    uint16_t compressed_size; /** Size of the zlib-compressed or run-length encoded font data. */
     uint32_t data_offset;     /** Pointer into GFXfont->bitmap */
 } GFXglyph;
 
+/**
+ * @brief Kerning of a glyph pair, sorted by `left`, then `right`.
+ */
+typedef struct
+{
+    uint16_t left;     /** Index of the first glyph in the glyph array */
+    uint16_t right;    /** Index of the second glyph in the glyph array */
+    int16_t  x_adjust; /** Added to the advance of the first glyph */
+} KerningPair;
+
+/**
+ * @brief Storage of the glyph bitmaps of a font.
+ */
+typedef enum
+{
+    FONT_GLYPHS = 0,    /** One bitmap per glyph, zlib streams if `compressed` is set */
+    FONT_ATLAS = 1,     /** One 4bpp atlas, `data_offset` is the glyph's first byte in it */
+    FONT_ATLAS_RLE = 2, /** One run-length encoded bitmap per glyph */
+} FontFormat_t;
+
+/**
+ * @brief Entry of `GFXfont->ascii_glyphs` for code points the font lacks.
+ */
+#define ASCII_GLYPH_MISSING 0xFFFF
+
 /**
  * @brief Glyph interval structure
  */
@@ -364,8 +553,57 @@ typedef struct
     uint8_t          advance_y;      /** Newline distance (y axis) */
     int32_t          ascender;       /** Maximal height of a glyph above the base line */
     int32_t          descender;      /** Maximal height of a glyph below the base line */
+    const uint16_t  *ascii_glyphs;   /** Glyph index of each code point below 128, or NULL */
+    uint8_t          format;         /** FontFormat_t of the glyph bitmaps */
+    uint16_t         atlas_stride;   /** Bytes per atlas row, for FONT_ATLAS */
+    const KerningPair *kerning;      /** Sorted kerning pairs, or NULL */
+    uint32_t         kerning_count;  /** Number of kerning pairs */
 } GFXfont;
 
+/**
+ * @brief Several sizes of a font, sharing intervals and code point maps.
+ */
+typedef struct
+{
+    const GFXfont *fonts;      /** One font per size, by ascending size */
+    const uint8_t *sizes;      /** Font size of each font */
+    uint32_t       font_count; /** Number of sizes */
+} FontFamily;
+
+/**
+ * @brief Glyph cache counters.
+ */
+typedef struct
+{
+    uint32_t hits;    /** Lookups served from the cache. */
+    uint32_t misses;  /** Glyph searches and bitmap decompressions. */
+    uint32_t entries; /** Glyphs currently cached. */
+    uint32_t bytes;   /** Bytes used by cached glyph bitmaps. */
+} GlyphCacheStats;
+
+/**
+ * @brief A glyph placed on a line of text.
+ */
+typedef struct
+{
+    uint32_t  code_point; /** Code point drawn, after fallback substitution */
+    GFXglyph *glyph;      /** Glyph of the code point */
+    int32_t   x;          /** Cursor position of the glyph on the laid out line */
+    uint32_t  offset;     /** Byte offset of the code point in the string */
+} GlyphRef;
+
+/**
+ * @brief A line of text decoded into positioned glyphs.
+ */
+typedef struct
+{
+    const GFXfont *font;      /** Font of the glyphs */
+    GlyphRef      *glyphs;    /** Glyph array, owned by the caller */
+    uint32_t       count;     /** Number of glyphs placed */
+    int32_t        advance_x; /** Cursor advance of the whole line */
+    Rect_t         bounds;    /** Drawn area, relative to the start cursor on the base line */
+} TextLayout;
+
 /**
  * @brief Get the text bounds for string, when drawn at (x, y).
  *        Set font properties to NULL to use the defaults.
@@ -389,6 +627,43 @@ void write_mode(const GFXfont *font, const char *string, int32_t *cursor_x,
                 int32_t *cursor_y, uint8_t *framebuffer, DrawMode_t mode,
                 const FontProperties *properties);
 
+/**
+ * @brief Decode a single line of text into positioned glyphs.
+ *        Set font properties to NULL to use the defaults.
+ *
+ * @param glyphs     Glyph array, one entry per code point is enough.
+ * @param max_glyphs Number of entries in `glyphs`.
+ * @param layout     The layout to fill in. It refers to `glyphs`.
+ * @return Number of bytes of `string` laid out. This is less than its length
+ *         if `glyphs` is too short.
+ */
+uint32_t layout_text(const GFXfont *font, const char *string, GlyphRef *glyphs,
+                     uint32_t max_glyphs, TextLayout *layout,
+                     const FontProperties *properties);
+
+/**
+ * @brief Take `count` glyphs of a layout, starting at glyph `first`, as a
+ *        layout of their own. The first of them is at the start cursor.
+ *        Set font properties to NULL to use the defaults.
+ */
+void layout_slice(const TextLayout *layout, uint32_t first, uint32_t count,
+                  TextLayout *slice, const FontProperties *properties);
+
+/**
+ * @brief Write a laid out line of text to the EPD and advance the cursor.
+ *
+ * @note If framebuffer is NULL, draw mode `mode` is used for direct drawing.
+ */
+void write_layout(const TextLayout *layout, int32_t *cursor_x, int32_t *cursor_y,
+                  uint8_t *framebuffer, DrawMode_t mode,
+                  const FontProperties *properties);
+
+/**
+ * @brief Get the font of a family for a size: the largest one not above
+ *        `size`, or the smallest one if all are larger.
+ */
+const GFXfont *get_family_font(const FontFamily *family, uint32_t size);
+
 /**
  * @brief Get the font glyph for a unicode code point.
  */
@@ -400,6 +675,26 @@ void get_glyph(const GFXfont *font, uint32_t code_point, GFXglyph **glyph);
 void write_string(const GFXfont *font, const char *string, int32_t *cursor_x,
                   int32_t *cursor_y, uint8_t *framebuffer);
 
+/**
+ * @brief Set the memory limit for decompressed glyph bitmaps. Least recently
+ *        used glyphs are dropped to stay below it.
+ *
+ * @note Glyph lookups and decompressed bitmaps of compressed fonts are
+ *       cached, preferably in PSRAM. The cache is not thread-safe, text must
+ *       be drawn from one task at a time.
+ */
+void glyph_cache_set_limit(uint32_t max_bytes);
+
+/**
+ * @brief Drop all cached glyphs, e.g. before freeing a font.
+ */
+void glyph_cache_clear();
+
+/**
+ * @brief Get the glyph cache counters.
+ */
+void glyph_cache_get_stats(GlyphCacheStats *stats);
+
 #ifdef __cplusplus
 }
 #endif
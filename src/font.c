@@ -19,6 +19,23 @@
 /***        macro definitions                                               ***/
 /******************************************************************************/
 
+/**
+ * @brief Number of glyphs in the glyph cache and its hash buckets.
+ */
+#define GLYPH_CACHE_ENTRIES 128
+#define GLYPH_CACHE_BUCKETS 128
+
+/**
+ * @brief Default memory limit for decompressed glyph bitmaps.
+ */
+#define GLYPH_CACHE_DEFAULT_BYTES (32 * 1024)
+
+/**
+ * @brief Glyphs `write_mode` lays out on the stack. Longer strings are laid
+ *        out on the heap.
+ */
+#define TEXT_LAYOUT_STACK_GLYPHS 32
+
 /******************************************************************************/
 /***        type definitions                                                ***/
 /******************************************************************************/
@@ -32,6 +49,18 @@ typedef struct
     int32_t  bits_stored; /* the number of bits from the codepoint that fits in char */
 } utf_t;
 
+typedef struct
+{
+    const GFXfont *font;       /* font the glyph belongs to, NULL if unused */
+    uint32_t       code_point;
+    GFXglyph      *glyph;      /* glyph of the code point, NULL if missing */
+    uint8_t       *bitmap;     /* decompressed bitmap, NULL until drawn */
+    uint32_t       bitmap_size;
+    int16_t        hash_next;  /* next entry in the same bucket */
+    int16_t        lru_prev;   /* more recently used entry */
+    int16_t        lru_next;   /* less recently used entry */
+} glyph_cache_entry_t;
+
 /******************************************************************************/
 /***        local function prototypes                                       ***/
 /******************************************************************************/
@@ -52,21 +81,101 @@ static uint32_t next_cp(uint8_t **string);
 
 static FontProperties font_properties_default();
 
-static void IRAM_ATTR draw_char(const GFXfont *font,
-                                uint8_t *buffer,
-                                int32_t *cursor_x,
-                                int32_t cursor_y,
-                                uint16_t buf_width,
-                                uint16_t buf_height,
-                                uint32_t cp,
-                                const FontProperties *props);
+/**
+ * @brief Find the cache entry of a code point, looking up and inserting the
+ *        glyph on a miss. The entry becomes the most recently used one.
+ */
+static glyph_cache_entry_t *glyph_cache_get(const GFXfont *font, uint32_t cp);
+
+/**
+ * @brief Get the bitmap of a cached glyph, decompressing it if needed. The
+ *        pointer is valid until the next cache lookup.
+ *
+ * @param stride Set to the distance between bitmap rows in bytes.
+ */
+static uint8_t *glyph_cache_bitmap(glyph_cache_entry_t *entry, int32_t *stride);
+
+/**
+ * @brief Decode a run-length encoded glyph bitmap.
+ *
+ * @note A control byte n below 0x80 is followed by n + 1 literal bytes, any
+ *       other by one byte repeated (n & 0x7F) + 1 times.
+ */
+static void rle_decode(uint8_t *dst, uint32_t dst_size,
+                       const uint8_t *src, uint32_t src_size);
+
+/**
+ * @brief Free the least recently used bitmaps until `extra` more bytes fit
+ *        into the limit. The bitmap of entry `keep` is never freed.
+ */
+static void glyph_cache_trim(uint32_t extra, int16_t keep);
+
+/**
+ * @brief Drop an entry from the cache and free its bitmap.
+ */
+static void glyph_cache_evict(int16_t index);
+
+/**
+ * @brief Resolve the glyph of a code point through the cache, using the
+ *        fallback glyph for missing code points.
+ */
+static glyph_cache_entry_t *cached_glyph(const GFXfont *font, uint32_t cp,
+                                         const FontProperties *props);
+
+/**
+ * @brief Build the color table for a string: each glyph bitmap byte (two
+ *        pixels) maps to the two colors it is drawn with.
+ */
+static void build_color_lut(uint8_t *color_lut, const FontProperties *props);
+
+/**
+ * @brief Kerning between two glyphs of a font, 0 if the pair has none.
+ */
+static int32_t kerning_adjust(const GFXfont *font, const GFXglyph *left,
+                              const GFXglyph *right);
+
+/**
+ * @brief Draw a cached glyph with its cursor at (cursor_x, cursor_y).
+ *        If `transparent` is set, pixels of value 0 are skipped, otherwise
+ *        the whole glyph box is filled with the background color.
+ */
+static void IRAM_ATTR draw_glyph(glyph_cache_entry_t *entry,
+                                 uint8_t *buffer,
+                                 int32_t cursor_x,
+                                 int32_t cursor_y,
+                                 int32_t buf_width,
+                                 int32_t buf_height,
+                                 const uint8_t *color_lut,
+                                 bool transparent);
+
+/**
+ * @brief Draw a pair of glyph pixels onto a framebuffer byte, skipping
+ *        pixels of value 0 if `transparent` is set.
+ */
+static inline void blit_pair(uint8_t *dst, uint8_t pair, const uint8_t *color_lut,
+                             bool transparent);
+
+/**
+ * @brief Set the advance and bounds of a layout from its glyphs. They are
+ *        relative to the cursor position of the first glyph.
+ */
+static void measure_layout(TextLayout *layout, const FontProperties *props);
 
 /**
- * @brief Calculate the bounds of a character when drawn at (x, y), move the
+ * @brief Fill an area of a 4bpp buffer with a color, clipped to the buffer.
+ */
+static void fill_background(uint8_t *buffer,
+                            int32_t buf_width,
+                            int32_t buf_height,
+                            Rect_t area,
+                            uint8_t color);
+
+/**
+ * @brief Calculate the bounds of a glyph when drawn at (x, y), move the
  *        cursor (*x) forward, adjust the given bounds.
  */
 static void get_char_bounds(const GFXfont *font,
-                            uint32_t cp,
+                            const GFXglyph *glyph,
                             int32_t *x,
                             int32_t *y,
                             int32_t *minx,
@@ -98,28 +207,67 @@ static utf_t *utf[] = {
     &(utf_t){0},
 };
 
+static glyph_cache_entry_t glyph_cache[GLYPH_CACHE_ENTRIES];
+static int16_t glyph_cache_buckets[GLYPH_CACHE_BUCKETS];
+static bool glyph_cache_ready = false;
+static int16_t glyph_cache_lru_head = -1;  /* most recently used */
+static int16_t glyph_cache_lru_tail = -1;  /* least recently used */
+static int16_t glyph_cache_free = 0;       /* next never used entry */
+static uint32_t glyph_cache_bytes = 0;
+static uint32_t glyph_cache_limit = GLYPH_CACHE_DEFAULT_BYTES;
+static uint32_t glyph_cache_hits = 0;
+static uint32_t glyph_cache_misses = 0;
+
 /******************************************************************************/
 /***        exported functions                                              ***/
 /******************************************************************************/
 
 void get_glyph(const GFXfont *font, uint32_t code_point, GFXglyph **glyph)
 {
-    UnicodeInterval *intervals = font->intervals;
     *glyph = NULL;
-    for (int32_t i = 0; i < font->interval_count; i++)
+    if (font->ascii_glyphs != NULL && code_point < 128)
     {
-        UnicodeInterval *interval = &intervals[i];
-        if (code_point >= interval->first && code_point <= interval->last)
+        uint16_t index = font->ascii_glyphs[code_point];
+        if (index != ASCII_GLYPH_MISSING)
         {
-            *glyph = &font->glyph[interval->offset + (code_point - interval->first)];
-            return;
+            *glyph = &font->glyph[index];
         }
+        return;
+    }
+
+    // intervals are sorted and disjoint
+    UnicodeInterval *intervals = font->intervals;
+    int32_t low = 0;
+    int32_t high = (int32_t)font->interval_count - 1;
+    while (low <= high)
+    {
+        int32_t mid = low + (high - low) / 2;
+        UnicodeInterval *interval = &intervals[mid];
         if (code_point < interval->first)
         {
+            high = mid - 1;
+        }
+        else if (code_point > interval->last)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            *glyph = &font->glyph[interval->offset + (code_point - interval->first)];
             return;
         }
     }
-    return;
+}
+
+
+const GFXfont *get_family_font(const FontFamily *family, uint32_t size)
+{
+    uint32_t i = 0;
+    while (i + 1 < family->font_count && family->sizes[i + 1] <= size)
+    {
+        i++;
+    }
+    return &family->fonts[i];
 }
 
 
@@ -153,10 +301,21 @@ void get_text_bounds(const GFXfont *font,
     }
     int32_t minx = 100000, miny = 100000, maxx = -1, maxy = -1;
     int32_t original_x = *x;
+    bool kerning = font->kerning != NULL && !(props.flags & NO_KERNING);
+    GFXglyph *previous = NULL;
     uint32_t c;
     while ((c = next_cp((uint8_t **)&string)))
     {
-        get_char_bounds(font, c, x, y, &minx, &miny, &maxx, &maxy, &props);
+        glyph_cache_entry_t *entry = cached_glyph(font, c, &props);
+        if (entry)
+        {
+            if (kerning && previous != NULL)
+            {
+                *x += kerning_adjust(font, previous, entry->glyph);
+            }
+            get_char_bounds(font, entry->glyph, x, y, &minx, &miny, &maxx, &maxy, &props);
+            previous = entry->glyph;
+        }
     }
     *x1 = min(original_x, minx);
     *w = maxx - *x1;
@@ -164,88 +323,193 @@ void get_text_bounds(const GFXfont *font,
     *h = maxy - miny;
 }
 
-void write_mode(const GFXfont *font,
-                const char *string,
-                int32_t *cursor_x,
-                int32_t *cursor_y,
-                uint8_t *framebuffer,
-                DrawMode_t mode,
-                const FontProperties *properties)
+uint32_t layout_text(const GFXfont *font,
+                     const char *string,
+                     GlyphRef *glyphs,
+                     uint32_t max_glyphs,
+                     TextLayout *layout,
+                     const FontProperties *properties)
 {
-    if (*string == '\0') return ;
+    FontProperties props = (properties == NULL) ? font_properties_default() \
+                                                : *properties;
+
+    bool kerning = font->kerning != NULL && !(props.flags & NO_KERNING);
+    int32_t x = 0;
+    uint32_t count = 0;
+    uint8_t *pos = (uint8_t *)string;
+    while (*pos != '\0' && count < max_glyphs)
+    {
+        uint32_t offset = pos - (uint8_t *)string;
+        uint32_t c = next_cp(&pos);
+        glyph_cache_entry_t *entry = cached_glyph(font, c, &props);
+        if (!entry)
+        {
+            continue;
+        }
+        if (kerning && count > 0)
+        {
+            x += kerning_adjust(font, glyphs[count - 1].glyph, entry->glyph);
+        }
+        glyphs[count].code_point = entry->code_point;
+        glyphs[count].glyph = entry->glyph;
+        glyphs[count].x = x;
+        glyphs[count].offset = offset;
+        count++;
+        x += entry->glyph->advance_x;
+    }
 
+    layout->font = font;
+    layout->glyphs = glyphs;
+    layout->count = count;
+    measure_layout(layout, &props);
+    return pos - (uint8_t *)string;
+}
+
+
+void layout_slice(const TextLayout *layout,
+                  uint32_t first,
+                  uint32_t count,
+                  TextLayout *slice,
+                  const FontProperties *properties)
+{
     FontProperties props = (properties == NULL) ? font_properties_default() \
                                                 : *properties;
 
-    int32_t x1 = 0, y1 = 0, w = 0, h = 0;
-    int32_t tmp_cur_x = *cursor_x;
-    int32_t tmp_cur_y = *cursor_y;
-    get_text_bounds(font, string, &tmp_cur_x, &tmp_cur_y, &x1, &y1, &w, &h, &props);
+    first = min(first, layout->count);
+    slice->font = layout->font;
+    slice->glyphs = &layout->glyphs[first];
+    slice->count = min(count, layout->count - first);
+    measure_layout(slice, &props);
+}
+
+
+void write_layout(const TextLayout *layout,
+                  int32_t *cursor_x,
+                  int32_t *cursor_y,
+                  uint8_t *framebuffer,
+                  DrawMode_t mode,
+                  const FontProperties *properties)
+{
+    if (layout->count == 0) return ;
+
+    FontProperties props = (properties == NULL) ? font_properties_default() \
+                                                : *properties;
+    const GFXfont *font = layout->font;
+
+    Rect_t area = {
+        .x = *cursor_x + layout->bounds.x,
+        .y = *cursor_y + layout->bounds.y,
+        .width = layout->bounds.width,
+        .height = layout->bounds.height
+    };
 
     uint8_t *buffer;
     int32_t buf_width;
     int32_t buf_height;
-    int32_t baseline_height = *cursor_y - y1;
 
-    // The local cursor position:
-    // 0, if drawing to a local temporary buffer
+    // The position of the start cursor in the buffer:
+    // the area origin, if drawing to a local temporary buffer
     // the given cursor position, if drawing to a full frame buffer
-    int32_t local_cursor_x = 0;
-    int32_t local_cursor_y = 0;
+    int32_t origin_x;
+    int32_t origin_y;
 
     if (framebuffer == NULL)
     {
-        buf_width = (w / 2 + w % 2);
-        buf_height = h;
+        buf_width = (area.width / 2 + area.width % 2);
+        buf_height = area.height;
         buffer = (uint8_t *)malloc(buf_width * buf_height);
+        if (buffer == NULL)
+        {
+            ESP_LOGE("font.c", "cannot allocate text buffer!");
+            return;
+        }
         memset(buffer, 255, buf_width * buf_height);
-        local_cursor_y = buf_height - baseline_height;
+        origin_x = -layout->bounds.x;
+        origin_y = -layout->bounds.y;
     }
     else
     {
         buf_width = EPD_WIDTH / 2;
         buf_height = EPD_HEIGHT;
         buffer = framebuffer;
-        local_cursor_x = *cursor_x;
-        local_cursor_y = *cursor_y;
+        origin_x = *cursor_x;
+        origin_y = *cursor_y;
     }
 
-    uint32_t c;
-
-    int32_t cursor_x_init = local_cursor_x;
-    int32_t cursor_y_init = local_cursor_y;
-
-    uint8_t bg = props.bg_color;
     if (props.flags & DRAW_BACKGROUND)
     {
-        for (int32_t l = 0; l < font->advance_y; l++)
-        {
-            epd_draw_hline(local_cursor_x,
-                           local_cursor_y - (font->advance_y - baseline_height) + l,
-                           w,
-                           bg << 4,
-                           buffer);
-        }
+        Rect_t background = {
+            .x = origin_x + layout->bounds.x,
+            .y = origin_y - font->descender - font->advance_y,
+            .width = layout->bounds.width,
+            .height = font->advance_y
+        };
+        fill_background(buffer, buf_width, buf_height, background, props.bg_color);
     }
-    while ((c = next_cp((uint8_t **)&string)))
+
+    uint8_t color_lut[256];
+    build_color_lut(color_lut, &props);
+    // A white glyph background would only repaint white paper, so it is
+    // skipped and overlapping glyph boxes keep each other's ink. Any other
+    // background fills the glyph boxes.
+    bool transparent = props.bg_color == 15;
+    for (uint32_t i = 0; i < layout->count; i++)
     {
-        draw_char(font, buffer, &local_cursor_x, local_cursor_y, buf_width, buf_height, c, &props);
+        const GlyphRef *ref = &layout->glyphs[i];
+        draw_glyph(glyph_cache_get(font, ref->code_point), buffer,
+                   origin_x + ref->x - layout->glyphs[0].x, origin_y,
+                   buf_width, buf_height, color_lut, transparent);
     }
 
-    *cursor_x += local_cursor_x - cursor_x_init;
-    *cursor_y += local_cursor_y - cursor_y_init;
+    *cursor_x += layout->advance_x;
 
     if (framebuffer == NULL)
     {
-        Rect_t area = {
-            .x = x1,
-            .y = *cursor_y - h + baseline_height,
-            .width = w,
-            .height = h
-        };
         epd_draw_image(area, buffer, mode);
         free(buffer);
     }
+    else
+    {
+        epd_damage_add(area, framebuffer);
+    }
+}
+
+
+void write_mode(const GFXfont *font,
+                const char *string,
+                int32_t *cursor_x,
+                int32_t *cursor_y,
+                uint8_t *framebuffer,
+                DrawMode_t mode,
+                const FontProperties *properties)
+{
+    if (*string == '\0') return ;
+
+    GlyphRef stack_glyphs[TEXT_LAYOUT_STACK_GLYPHS];
+    GlyphRef *glyphs = stack_glyphs;
+    uint32_t max_glyphs = TEXT_LAYOUT_STACK_GLYPHS;
+
+    // a string never has more code points than bytes
+    uint32_t length = strlen(string);
+    if (length > max_glyphs)
+    {
+        glyphs = (GlyphRef *)malloc(length * sizeof(GlyphRef));
+        if (glyphs == NULL)
+        {
+            ESP_LOGE("font.c", "cannot allocate text layout!");
+            return;
+        }
+        max_glyphs = length;
+    }
+
+    TextLayout layout;
+    layout_text(font, string, glyphs, max_glyphs, &layout, properties);
+    write_layout(&layout, cursor_x, cursor_y, framebuffer, mode, properties);
+
+    if (glyphs != stack_glyphs)
+    {
+        free(glyphs);
+    }
 }
 
 
@@ -290,6 +554,37 @@ void write_string(const GFXfont *font,
     free(tofree);
 }
 
+
+void glyph_cache_set_limit(uint32_t max_bytes)
+{
+    glyph_cache_limit = max_bytes;
+    glyph_cache_trim(0, -1);
+}
+
+
+void glyph_cache_clear()
+{
+    while (glyph_cache_lru_tail >= 0)
+    {
+        glyph_cache_evict(glyph_cache_lru_tail);
+    }
+    glyph_cache_ready = false;
+}
+
+
+void glyph_cache_get_stats(GlyphCacheStats *stats)
+{
+    uint32_t entries = 0;
+    for (int16_t i = glyph_cache_lru_head; i >= 0; i = glyph_cache[i].lru_next)
+    {
+        entries++;
+    }
+    stats->hits = glyph_cache_hits;
+    stats->misses = glyph_cache_misses;
+    stats->entries = entries;
+    stats->bytes = glyph_cache_bytes;
+}
+
 /******************************************************************************/
 /***        local functions                                                 ***/
 /******************************************************************************/
@@ -345,100 +640,441 @@ static FontProperties font_properties_default()
 }
 
 
-static void IRAM_ATTR draw_char(const GFXfont *font,
-                                uint8_t *buffer,
-                                int32_t *cursor_x,
-                                int32_t cursor_y,
-                                uint16_t buf_width,
-                                uint16_t buf_height,
-                                uint32_t cp,
-                                const FontProperties *props)
+static glyph_cache_entry_t *glyph_cache_get(const GFXfont *font, uint32_t cp)
+{
+    if (!glyph_cache_ready)
+    {
+        memset(glyph_cache_buckets, 0xFF, sizeof(glyph_cache_buckets));
+        glyph_cache_lru_head = -1;
+        glyph_cache_lru_tail = -1;
+        glyph_cache_free = 0;
+        glyph_cache_ready = true;
+    }
+
+    uint32_t bucket = ((uint32_t)(uintptr_t)font ^ (cp * 2654435761u)) % GLYPH_CACHE_BUCKETS;
+    int16_t index = glyph_cache_buckets[bucket];
+    while (index >= 0 && (glyph_cache[index].font != font ||
+                          glyph_cache[index].code_point != cp))
+    {
+        index = glyph_cache[index].hash_next;
+    }
+
+    glyph_cache_entry_t *entry;
+    if (index >= 0)
+    {
+        entry = &glyph_cache[index];
+        glyph_cache_hits++;
+        if (index == glyph_cache_lru_head)
+        {
+            return entry;
+        }
+        // unlink from the LRU list, it is linked in again at the head
+        glyph_cache[entry->lru_prev].lru_next = entry->lru_next;
+        if (entry->lru_next >= 0)
+        {
+            glyph_cache[entry->lru_next].lru_prev = entry->lru_prev;
+        }
+        else
+        {
+            glyph_cache_lru_tail = entry->lru_prev;
+        }
+    }
+    else
+    {
+        if (glyph_cache_free < GLYPH_CACHE_ENTRIES)
+        {
+            index = glyph_cache_free++;
+        }
+        else
+        {
+            index = glyph_cache_lru_tail;
+            glyph_cache_evict(index);
+        }
+        entry = &glyph_cache[index];
+        entry->font = font;
+        entry->code_point = cp;
+        entry->bitmap = NULL;
+        entry->bitmap_size = 0;
+        get_glyph(font, cp, &entry->glyph);
+        entry->hash_next = glyph_cache_buckets[bucket];
+        glyph_cache_buckets[bucket] = index;
+        glyph_cache_misses++;
+    }
+
+    entry->lru_prev = -1;
+    entry->lru_next = glyph_cache_lru_head;
+    if (glyph_cache_lru_head >= 0)
+    {
+        glyph_cache[glyph_cache_lru_head].lru_prev = index;
+    }
+    glyph_cache_lru_head = index;
+    if (glyph_cache_lru_tail < 0)
+    {
+        glyph_cache_lru_tail = index;
+    }
+    return entry;
+}
+
+
+static uint8_t *glyph_cache_bitmap(glyph_cache_entry_t *entry, int32_t *stride)
 {
-    GFXglyph *glyph;
-    get_glyph(font, cp, &glyph);
+    const GFXfont *font = entry->font;
+    GFXglyph *glyph = entry->glyph;
+    *stride = glyph->width / 2 + glyph->width % 2;
+    if (font->format == FONT_ATLAS)
+    {
+        *stride = font->atlas_stride;
+        return &font->bitmap[glyph->data_offset];
+    }
+    if (font->format == FONT_GLYPHS && !font->compressed)
+    {
+        return &font->bitmap[glyph->data_offset];
+    }
+    if (entry->bitmap != NULL)
+    {
+        return entry->bitmap;
+    }
+    glyph_cache_misses++;
+
+    unsigned long bitmap_size = *stride * glyph->height;
+
+    // never drop the entry being drawn, it is the LRU head
+    glyph_cache_trim(bitmap_size, glyph_cache_lru_head);
+
+    uint8_t *bitmap = (uint8_t *)heap_caps_malloc(bitmap_size, MALLOC_CAP_SPIRAM);
+    if (bitmap == NULL)
+    {
+        bitmap = (uint8_t *)heap_caps_malloc(bitmap_size, MALLOC_CAP_8BIT);
+    }
+    if (bitmap == NULL)
+    {
+        ESP_LOGE("font.c", "cannot allocate glyph bitmap!");
+        return NULL;
+    }
+    if (font->format == FONT_ATLAS_RLE)
+    {
+        rle_decode(bitmap, bitmap_size, &font->bitmap[glyph->data_offset],
+                   glyph->compressed_size);
+    }
+    else
+    {
+        uncompress(bitmap, &bitmap_size, &font->bitmap[glyph->data_offset],
+                   glyph->compressed_size);
+    }
 
-    if (!glyph)
+    entry->bitmap = bitmap;
+    entry->bitmap_size = bitmap_size;
+    glyph_cache_bytes += bitmap_size;
+    return bitmap;
+}
+
+
+static void rle_decode(uint8_t *dst, uint32_t dst_size,
+                       const uint8_t *src, uint32_t src_size)
+{
+    const uint8_t *src_end = src + src_size;
+    uint8_t *dst_end = dst + dst_size;
+    while (src < src_end && dst < dst_end)
     {
-        get_glyph(font, props->fallback_glyph, &glyph);
+        uint8_t control = *src++;
+        uint32_t count = (control & 0x7F) + 1;
+        count = min(count, dst_end - dst);
+        if (control & 0x80)
+        {
+            if (src == src_end)
+            {
+                break;
+            }
+            memset(dst, *src++, count);
+        }
+        else
+        {
+            count = min(count, src_end - src);
+            memcpy(dst, src, count);
+            src += count;
+        }
+        dst += count;
     }
+    /* a truncated stream leaves the rest of the glyph blank */
+    memset(dst, 0, dst_end - dst);
+}
 
-    if (!glyph)
+
+static void glyph_cache_trim(uint32_t extra, int16_t keep)
+{
+    for (int16_t i = glyph_cache_lru_tail;
+            i >= 0 && glyph_cache_bytes + extra > glyph_cache_limit;
+            i = glyph_cache[i].lru_prev)
     {
-        return;
+        if (i != keep && glyph_cache[i].bitmap != NULL)
+        {
+            free(glyph_cache[i].bitmap);
+            glyph_cache[i].bitmap = NULL;
+            glyph_cache_bytes -= glyph_cache[i].bitmap_size;
+        }
     }
+}
+
 
-    uint32_t offset = glyph->data_offset;
-    uint8_t width = glyph->width;
-    uint8_t height = glyph->height;
-    int32_t left = glyph->left;
+static void glyph_cache_evict(int16_t index)
+{
+    glyph_cache_entry_t *entry = &glyph_cache[index];
+
+    // unlink from its bucket
+    uint32_t bucket = ((uint32_t)(uintptr_t)entry->font ^
+                       (entry->code_point * 2654435761u)) % GLYPH_CACHE_BUCKETS;
+    int16_t *link = &glyph_cache_buckets[bucket];
+    while (*link != index)
+    {
+        link = &glyph_cache[*link].hash_next;
+    }
+    *link = entry->hash_next;
 
-    int32_t byte_width = (width / 2 + width % 2);
-    unsigned long bitmap_size = byte_width * height;
-    uint8_t *bitmap = NULL;
-    if (font->compressed)
+    // unlink from the LRU list
+    if (entry->lru_prev >= 0)
+    {
+        glyph_cache[entry->lru_prev].lru_next = entry->lru_next;
+    }
+    else
+    {
+        glyph_cache_lru_head = entry->lru_next;
+    }
+    if (entry->lru_next >= 0)
     {
-        bitmap = (uint8_t *)malloc(bitmap_size);
-        uncompress(bitmap, &bitmap_size, &font->bitmap[offset], glyph->compressed_size);
+        glyph_cache[entry->lru_next].lru_prev = entry->lru_prev;
     }
     else
     {
-        bitmap = &font->bitmap[offset];
+        glyph_cache_lru_tail = entry->lru_prev;
+    }
+
+    if (entry->bitmap != NULL)
+    {
+        free(entry->bitmap);
+        glyph_cache_bytes -= entry->bitmap_size;
+    }
+    entry->font = NULL;
+    entry->bitmap = NULL;
+}
+
+
+static glyph_cache_entry_t *cached_glyph(const GFXfont *font, uint32_t cp,
+                                         const FontProperties *props)
+{
+    glyph_cache_entry_t *entry = glyph_cache_get(font, cp);
+    if (!entry->glyph)
+    {
+        entry = glyph_cache_get(font, props->fallback_glyph);
     }
+    return entry->glyph ? entry : NULL;
+}
+
 
-    uint8_t color_lut[16];
+static int32_t kerning_adjust(const GFXfont *font, const GFXglyph *left,
+                              const GFXglyph *right)
+{
+    uint32_t key = ((uint32_t)(left - font->glyph) << 16) | (uint32_t)(right - font->glyph);
+    int32_t low = 0;
+    int32_t high = (int32_t)font->kerning_count - 1;
+    while (low <= high)
+    {
+        int32_t mid = low + (high - low) / 2;
+        const KerningPair *pair = &font->kerning[mid];
+        uint32_t pair_key = ((uint32_t)pair->left << 16) | pair->right;
+        if (key < pair_key)
+        {
+            high = mid - 1;
+        }
+        else if (key > pair_key)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            return pair->x_adjust;
+        }
+    }
+    return 0;
+}
+
+
+static void build_color_lut(uint8_t *color_lut, const FontProperties *props)
+{
+    uint8_t colors[16];
+    int32_t color_difference = (int32_t)props->fg_color - (int32_t)props->bg_color;
     for (int32_t c = 0; c < 16; c++)
     {
-        int32_t color_difference = (int32_t)props->fg_color - (int32_t)props->bg_color;
-        color_lut[c] = max(0, min(15, props->bg_color + c * color_difference / 15));
+        colors[c] = max(0, min(15, props->bg_color + c * color_difference / 15));
+    }
+    for (int32_t i = 0; i < 256; i++)
+    {
+        color_lut[i] = colors[i & 0x0F] | (colors[i >> 4] << 4);
+    }
+}
+
+
+static inline void blit_pair(uint8_t *dst, uint8_t pair, const uint8_t *color_lut,
+                             bool transparent)
+{
+    if (!transparent || ((pair & 0x0F) && (pair & 0xF0)))
+    {
+        *dst = color_lut[pair];
+    }
+    else if (pair == 0)
+    {
+        return;
+    }
+    else
+    {
+        uint8_t mask = (pair & 0x0F) ? 0x0F : 0xF0;
+        *dst = (*dst & ~mask) | (color_lut[pair] & mask);
+    }
+}
+
+
+static void IRAM_ATTR draw_glyph(glyph_cache_entry_t *entry,
+                                 uint8_t *buffer,
+                                 int32_t cursor_x,
+                                 int32_t cursor_y,
+                                 int32_t buf_width,
+                                 int32_t buf_height,
+                                 const uint8_t *color_lut,
+                                 bool transparent)
+{
+    GFXglyph *glyph = entry->glyph;
+    int32_t start_pos = cursor_x + glyph->left;
+
+    // horizontally visible range, in glyph pixels
+    int32_t x_start = max(0, -start_pos);
+    int32_t x_end = min(glyph->width, buf_width * 2 - start_pos);
+    if (x_start >= x_end)
+    {
+        return;
+    }
+
+    int32_t stride;
+    uint8_t *bitmap = glyph_cache_bitmap(entry, &stride);
+    if (bitmap == NULL)
+    {
+        return;
     }
 
-    for (int32_t y = 0; y < height; y++)
+    // destination pixels of even x take the low nibble; after an odd first
+    // pixel, source and destination share nibble parity iff x_pair is even
+    bool odd_start = (start_pos + x_start) & 1;
+    int32_t x_pair = x_start + odd_start;
+    bool aligned = (x_pair & 1) == 0;
+
+    for (int32_t y = 0; y < glyph->height; y++)
     {
         int32_t yy = cursor_y - glyph->top + y;
         if (yy < 0 || yy >= buf_height)
         {
             continue;
         }
-        int32_t start_pos = *cursor_x + left;
-        bool byte_complete = start_pos % 2;
-        int32_t x = max(0, -start_pos);
-        int32_t max_x = min(start_pos + width, buf_width * 2);
-        for (int32_t xx = start_pos; xx < max_x; xx++)
+        const uint8_t *src = &bitmap[y * stride];
+        uint8_t *dst = &buffer[yy * buf_width + (start_pos + x_pair) / 2];
+
+        if (odd_start)
         {
-            uint32_t buf_pos = yy * buf_width + xx / 2;
-            uint8_t old = buffer[buf_pos];
-            uint8_t bm = bitmap[y * byte_width + x / 2];
-            if ((x & 1) == 0)
+            uint8_t c = (x_start & 1) ? src[x_start / 2] >> 4 : src[x_start / 2] & 0x0F;
+            if (c || !transparent)
             {
-                bm = bm & 0xF;
+                dst[-1] = (dst[-1] & 0x0F) | (color_lut[c] << 4);
             }
-            else
+        }
+
+        int32_t x = x_pair;
+        if (aligned)
+        {
+            for (; x + 1 < x_end; x += 2)
             {
-                bm = bm >> 4;
+                blit_pair(dst++, src[x / 2], color_lut, transparent);
             }
-
-            if ((xx & 1) == 0)
+        }
+        else
+        {
+            for (; x + 1 < x_end; x += 2)
             {
-                buffer[buf_pos] = (old & 0xF0) | color_lut[bm];
+                uint8_t pair = (src[x / 2] >> 4) | (src[x / 2 + 1] << 4);
+                blit_pair(dst++, pair, color_lut, transparent);
             }
-            else
+        }
+
+        if (x < x_end)
+        {
+            uint8_t c = (x & 1) ? src[x / 2] >> 4 : src[x / 2] & 0x0F;
+            if (c || !transparent)
             {
-                buffer[buf_pos] = (old & 0x0F) | (color_lut[bm] << 4);
+                *dst = (*dst & 0xF0) | (color_lut[c] & 0x0F);
             }
-            byte_complete = !byte_complete;
-            x++;
         }
     }
-    if (font->compressed)
+}
+
+
+static void measure_layout(TextLayout *layout, const FontProperties *props)
+{
+    if (layout->count == 0)
+    {
+        layout->advance_x = 0;
+        layout->bounds = (Rect_t){ .x = 0, .y = 0, .width = 0, .height = 0 };
+        return;
+    }
+
+    // bounds are collected with y pointing up
+    int32_t minx = 100000, miny = 100000, maxx = -100000, maxy = -100000;
+    int32_t start = layout->glyphs[0].x;
+    int32_t x = 0;
+    int32_t y = 0;
+    for (uint32_t i = 0; i < layout->count; i++)
     {
-        free(bitmap);
+        x = layout->glyphs[i].x - start;
+        get_char_bounds(layout->font, layout->glyphs[i].glyph, &x, &y,
+                        &minx, &miny, &maxx, &maxy, props);
+    }
+
+    int32_t x1 = min(0, minx);
+    layout->advance_x = x;
+    layout->bounds = (Rect_t){
+        .x = x1,
+        .y = -maxy,
+        .width = maxx - x1,
+        .height = maxy - miny
+    };
+}
+
+
+static void fill_background(uint8_t *buffer,
+                            int32_t buf_width,
+                            int32_t buf_height,
+                            Rect_t area,
+                            uint8_t color)
+{
+    int32_t x_start = max(0, area.x);
+    int32_t x_end = min(buf_width * 2, area.x + area.width);
+    int32_t y_start = max(0, area.y);
+    int32_t y_end = min(buf_height, area.y + area.height);
+    for (int32_t y = y_start; y < y_end; y++)
+    {
+        uint8_t *row = &buffer[y * buf_width];
+        for (int32_t x = x_start; x < x_end; x++)
+        {
+            if (x & 1)
+            {
+                row[x / 2] = (row[x / 2] & 0x0F) | (color << 4);
+            }
+            else
+            {
+                row[x / 2] = (row[x / 2] & 0xF0) | color;
+            }
+        }
     }
-    *cursor_x += glyph->advance_x;
 }
 
 
 static void get_char_bounds(const GFXfont *font,
-                            uint32_t cp,
+                            const GFXglyph *glyph,
                             int32_t *x,
                             int32_t *y,
                             int32_t *minx,
@@ -447,16 +1083,6 @@ static void get_char_bounds(const GFXfont *font,
                             int32_t *maxy,
                             const FontProperties *props)
 {
-    GFXglyph *glyph;
-    get_glyph(font, cp, &glyph);
-
-    if (!glyph)
-    {
-        get_glyph(font, props->fallback_glyph, &glyph);
-    }
-
-    if (!glyph) return ;
-
     int32_t x1 = *x + glyph->left;
     int32_t y1 = *y + (glyph->top - glyph->height);
     int32_t x2 = x1 + glyph->width;
@@ -468,7 +1094,7 @@ static void get_char_bounds(const GFXfont *font,
         *minx = min(*x, min(*minx, x1));
         *maxx = max(max(*x + glyph->advance_x, x2), *maxx);
         *miny = min(*y + font->descender, min(*miny, y1));
-        *maxy = max(font->descender + font->advance_y, max(*maxy, y2));
+        *maxy = max(*y + font->descender + font->advance_y, max(*maxy, y2));
     }
     else
     {
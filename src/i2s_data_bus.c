@@ -5,6 +5,7 @@
 
 #include "i2s_data_bus.h"
 
+#include <assert.h>
 #include <driver/periph_ctrl.h>
 #include <esp_heap_caps.h>
 #include <rom/lldesc.h>
@@ -14,6 +15,7 @@
 #include "esp_lcd_panel_io.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 /******************************************************************************/
 /***        macro definitions                                               ***/
@@ -78,12 +80,10 @@ static void IRAM_ATTR i2s_int_hdl(void *arg);
 /******************************************************************************/
 /***        local variables                                                 ***/
 /******************************************************************************/
-#if USER_I2S_REG
 /**
  * @brief Indicates which line buffer is currently back / front.
  */
 static int32_t current_buffer = 0;
-#endif
 
 /**
  * @brief The I2S state instance.
@@ -92,10 +92,12 @@ static i2s_parallel_state_t i2s_state;
 
 static intr_handle_t gI2S_intr_handle = NULL;
 
+#if USER_I2S_REG
 /**
  * @brief Indicates the device has finished its transmission and is ready again.
  */
 static volatile bool output_done = true;
+#endif
 
 /**
  * @brief The start pulse pin extracted from the configuration for use in
@@ -103,7 +105,27 @@ static volatile bool output_done = true;
  */
 // static gpio_num_t start_pulse_pin;
 
-static uint8_t buffer[(960 + 32) / 4] = { 0 };
+#if !USER_I2S_REG
+/**
+ * @brief Size of a line transfer, including the padding clocked out after
+ *        the row data.
+ */
+static uint32_t line_bytes;
+
+/**
+ * @brief Number of line transfers queued and completed. Their difference is
+ *        the number of transfers in flight.
+ */
+static volatile uint32_t lines_started = 0;
+static volatile uint32_t lines_done = 0;
+
+/**
+ * @brief Start time of the transfers of both line buffers and the total time
+ *        spent on the bus.
+ */
+static volatile int64_t line_start_time[2];
+static volatile uint32_t bus_time_us = 0;
+#endif
 
 /******************************************************************************/
 /***        exported functions                                              ***/
@@ -118,7 +140,7 @@ volatile uint8_t IRAM_ATTR *i2s_get_current_buffer()
 #else
 volatile uint8_t IRAM_ATTR *i2s_get_current_buffer()
 {
-    return buffer;
+    return current_buffer ? i2s_state.buf_a : i2s_state.buf_b;
 }
 #endif
 
@@ -140,7 +162,7 @@ bool IRAM_ATTR i2s_is_busy()
 #else
 bool IRAM_ATTR i2s_is_busy()
 {
-    return !output_done;
+    return lines_started != lines_done;
 }
 #endif
 
@@ -162,6 +184,9 @@ void IRAM_ATTR i2s_switch_buffer()
 #else
 void IRAM_ATTR i2s_switch_buffer()
 {
+    // the transfer before the last one still reads from the switched-to buffer
+    while (lines_started - lines_done > 1) ;
+    current_buffer = !current_buffer;
 }
 #endif
 
@@ -195,19 +220,34 @@ void IRAM_ATTR i2s_start_line_output()
 #else
 void IRAM_ATTR i2s_start_line_output()
 {
-    output_done = false;
+    line_start_time[lines_started % 2] = esp_timer_get_time();
+    lines_started++;
 
-    esp_lcd_panel_io_tx_color(io_handle, 0, buffer, (960 + 32) / 4);
+    esp_lcd_panel_io_tx_color(io_handle, 0, (void *)i2s_get_current_buffer(), line_bytes);
+}
+#endif
+
+
+#if USER_I2S_REG
+uint32_t IRAM_ATTR i2s_bus_time_us()
+{
+    return 0;
+}
+#else
+uint32_t IRAM_ATTR i2s_bus_time_us()
+{
+    return bus_time_us;
 }
 #endif
 
 
 #if !USER_I2S_REG
-static bool notify_trans_done(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+static bool IRAM_ATTR notify_trans_done(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
     // gpio_set_level(start_pulse_pin, 1);
-    output_done = true;
-    return output_done;
+    bus_time_us += esp_timer_get_time() - line_start_time[lines_done % 2];
+    lines_done++;
+    return false;
 }
 #endif
 
@@ -366,6 +406,13 @@ void i2s_bus_init(i2s_bus_config *cfg)
     // // store pin in global variable for use in interrupt.
     // start_pulse_pin = cfg->start_pulse;
 
+    // two DMA capable line buffers, one is converted while the other is sent
+    // epd_row_width already includes the padding
+    line_bytes = cfg->epd_row_width / 4;
+    i2s_state.buf_a = heap_caps_calloc(1, line_bytes, MALLOC_CAP_DMA);
+    i2s_state.buf_b = heap_caps_calloc(1, line_bytes, MALLOC_CAP_DMA);
+    assert(i2s_state.buf_a != NULL && i2s_state.buf_b != NULL);
+
     ESP_LOGI(TAG, "Initialize Intel 8080 bus");
     esp_lcd_i80_bus_handle_t i80_bus = NULL;
     esp_lcd_i80_bus_config_t bus_config = {
@@ -388,7 +435,7 @@ void i2s_bus_init(i2s_bus_config *cfg)
 
     esp_lcd_panel_io_i80_config_t io_config = {
         .cs_gpio_num = -1,
-        .pclk_hz = 10 * 1000 * 1000,
+        .pclk_hz = cfg->pclk_hz,
         .trans_queue_depth = 10,
         .dc_levels = {
             .dc_idle_level = 0,
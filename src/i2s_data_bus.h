@@ -50,6 +50,8 @@ typedef struct
 
     // Width of a display row in pixels.
     uint32_t epd_row_width;
+    /// Data clock frequency in Hz, only used by the esp_lcd bus.
+    uint32_t pclk_hz;
 } i2s_bus_config;
 
 /******************************************************************************/
@@ -89,6 +91,13 @@ void IRAM_ATTR i2s_start_line_output();
  */
 bool IRAM_ATTR i2s_is_busy();
 
+/**
+ * @brief Total time line transfers spent on the bus, in microseconds.
+ *
+ * @note Only measured on the esp_lcd bus, always 0 otherwise.
+ */
+uint32_t IRAM_ATTR i2s_bus_time_us();
+
 /**
  * @brief Give up allocated resources.
  */
@@ -0,0 +1,125 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "image_source.h"
+
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Bytes skipped per callback read.
+ */
+#define SKIP_CHUNK 64
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+static size_t read_file(void *ctx, uint8_t *buf, size_t len);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+void image_source_init_buffer(ImageSource *src, const uint8_t *data, size_t size)
+{
+    src->data = data;
+    src->size = data != NULL ? size : 0;
+    src->pos = 0;
+    src->read = NULL;
+    src->ctx = NULL;
+}
+
+
+void image_source_init_callback(ImageSource *src, ImageSourceRead read, void *ctx)
+{
+    src->data = NULL;
+    src->size = 0;
+    src->pos = 0;
+    src->read = read;
+    src->ctx = ctx;
+}
+
+
+void image_source_init_file(ImageSource *src, FILE *file)
+{
+    image_source_init_callback(src, read_file, file);
+}
+
+
+size_t image_source_read(ImageSource *src, uint8_t *buf, size_t len)
+{
+    if (src->read == NULL)
+    {
+        size_t left = src->size - src->pos;
+        if (len > left)
+        {
+            len = left;
+        }
+        if (buf != NULL)
+        {
+            memcpy(buf, src->data + src->pos, len);
+        }
+        src->pos += len;
+        return len;
+    }
+
+    size_t count = 0;
+    if (buf != NULL)
+    {
+        while (count < len)
+        {
+            size_t n = src->read(src->ctx, buf + count, len - count);
+            if (n == 0)
+            {
+                break;
+            }
+            count += n;
+        }
+    }
+    else
+    {
+        uint8_t skip[SKIP_CHUNK];
+        while (count < len)
+        {
+            size_t chunk = len - count < SKIP_CHUNK ? len - count : SKIP_CHUNK;
+            size_t n = src->read(src->ctx, skip, chunk);
+            if (n == 0)
+            {
+                break;
+            }
+            count += n;
+        }
+    }
+    src->pos += count;
+    return count;
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static size_t read_file(void *ctx, uint8_t *buf, size_t len)
+{
+    return fread(buf, 1, len, (FILE *)ctx);
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,87 @@
+#ifndef _IMAGE_SOURCE_H_
+#define _IMAGE_SOURCE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Reads up to `len` bytes of an image into `buf`.
+ *
+ * @note Called with whatever the decoder asks for. A HTTP chunk callback
+ *       can hand out what it has received and block for the rest.
+ *
+ * @return Bytes read, 0 at the end of the image or on errors.
+ */
+typedef size_t (*ImageSourceRead)(void *ctx, uint8_t *buf, size_t len);
+
+/**
+ * @brief Where a decoder reads an encoded image from.
+ *
+ * @note A source is either a buffer holding the whole image or a read
+ *       callback. All read state lives in here, so decoders can run on
+ *       several sources at once.
+ */
+typedef struct
+{
+    const uint8_t  *data; /** Image in memory, NULL for a callback source */
+    size_t          size; /** Bytes in data */
+    size_t          pos;  /** Bytes read so far */
+    ImageSourceRead read; /** Read callback, if data is NULL */
+    void           *ctx;  /** Passed to read */
+} ImageSource;
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Read an image from memory. Reads stop at `size`.
+ */
+void image_source_init_buffer(ImageSource *src, const uint8_t *data, size_t size);
+
+/**
+ * @brief Read an image through a callback, e.g. from a HTTP client.
+ */
+void image_source_init_callback(ImageSource *src, ImageSourceRead read, void *ctx);
+
+/**
+ * @brief Read an image from an open file, starting at its current position.
+ */
+void image_source_init_file(ImageSource *src, FILE *file);
+
+/**
+ * @brief Copy up to `len` bytes to `buf`, or skip them if `buf` is NULL.
+ *
+ * @return Bytes read or skipped, less than `len` only at the end.
+ */
+size_t image_source_read(ImageSource *src, uint8_t *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
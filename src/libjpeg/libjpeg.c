@@ -21,7 +21,9 @@
 #include "rom/tjpgd.h"
 #endif
 
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
@@ -38,28 +40,75 @@
 
 #define EP_HEIGHT EPD_HEIGHT
 
+/**
+ * @brief Size of the tjpgd work area of a context.
+ */
+#define LIBJPEG_WORK_SIZE 4096
+
 /******************************************************************************/
 /***        type definitions                                                ***/
 /******************************************************************************/
 
-/******************************************************************************/
-/***        local function prototypes                                       ***/
-/******************************************************************************/
+/**
+ * @brief A 4bpp destination the decoder writes to while it decodes.
+ */
+typedef struct
+{
+    uint8_t *data;   /** Top left byte of the destination */
+    uint32_t stride; /** Bytes per destination row */
+    int32_t  x;      /** Position of the image's left edge in the destination */
+    int32_t  y;      /** Position of the image's top edge in the destination */
+    Rect_t   clip;   /** Pixels outside of this destination rectangle are dropped */
+} jpeg_target_t;
 
-#if JPG_DITHERING
-static uint8_t find_closest_palette_color(uint8_t oldpixel);
-#endif
+/**
+ * @brief Box filter state for shrinking the decoded image further.
+ *
+ * @note Each decoded pixel is added to the output pixel it falls into. Only
+ *       the output rows touched by the current MCU row are kept, in a ring.
+ */
+typedef struct
+{
+    uint32_t *sum;      /** Gray sums, `rows` rows of `dst_w` */
+    uint32_t  rows;     /** Rows in the ring */
+    int32_t   src_w;    /** Decoded size */
+    int32_t   src_h;
+    int32_t   dst_w;    /** Output size */
+    int32_t   dst_h;
+    int32_t   next_row; /** First output row not written yet */
+    uint8_t  *line;     /** Gray values of the output row being written */
+    int16_t  *error;    /** Two rows of diffused errors times 16, with a
+                            column of padding on either side */
+} jpeg_scaler_t;
 
 /**
- * @brief Decode and paint onto the Epaper screen
+ * @brief Everything one decode needs. Buffers are allocated on first use.
  */
-static void jpeg_render(Rect_t area);
+struct libjpeg_ctx
+{
+    uint8_t       *work;             /** tjpgd work area */
+    ImageSource   *src;              /** Source of the current decode */
+    jpeg_target_t  target;
+    jpeg_scaler_t  scaler;
+    uint8_t        gamme_curve[256];
+    JpegDither_t   dither;
+#if LIBJPEG_MEASURE
+    uint32_t       time_decomp;
+    uint32_t       time_update_screen;
+    uint32_t       time_render;
+#endif
+};
 
-static void epd_draw_pixel_area(int x, int y, uint8_t color, uint8_t *framebuffer, Rect_t area);
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
 
 /**
  * @brief 用户定义的从输入流读取数据的输入函数。
- * 
+ *
+ * @note Reads from the source of the context in jd->device. Skips if buff
+ *       is NULL.
+ *
  * @param jd   Decompressor object of current session
  * @param buff Pointer to buffer to store the read data
  * @param nd   Number of bytes to read
@@ -71,23 +120,97 @@ static uint32_t feed_buffer(JDEC *jd, uint8_t *buff, uint32_t nd);
 #endif
 
 /**
- * @brief User defined call-back function to output decoded RGB bitmap in
- *        decoded_image buffer
+ * @brief User defined call-back function to output decoded RGB bitmap as
+ *        gamma corrected 4bpp pixels into the context's target
+ *
+ * @note Pixels outside of the target are dropped. Error diffusion needs
+ *       whole rows and goes through tjd_output_scaled instead.
  *
  * @param jd     Decompressor object of current session
  * @param bitmap Bitmap data to be output
  * @param rect   Rectangular region to output
  */
 #if ESP_IDF_VERSION_MAJOR >= 5 // IDF 5+
-static UINT tjd_output(JDEC *jd, void *bitmap, JRECT *rect);
+static UINT tjd_output_4bpp(JDEC *jd, void *bitmap, JRECT *rect);
+#else
+static uint32_t tjd_output_4bpp(JDEC *jd, void *bitmap, JRECT *rect);
+#endif
+
+/**
+ * @brief User defined call-back function to output decoded RGB bitmap into
+ *        the box filter of the context's scaler
+ */
+#if ESP_IDF_VERSION_MAJOR >= 5 // IDF 5+
+static UINT tjd_output_scaled(JDEC *jd, void *bitmap, JRECT *rect);
+#else
+static uint32_t tjd_output_scaled(JDEC *jd, void *bitmap, JRECT *rect);
+#endif
+
+/**
+ * @brief Write output rows [scaler.next_row, end) of the box filter to the
+ *        target.
+ */
+static void flush_scaled_rows(libjpeg_ctx_t *ctx, int32_t end);
+
+/**
+ * @brief Dither output row `oy` from scaler.line and write it to the target.
+ */
+static void write_row(libjpeg_ctx_t *ctx, int32_t oy);
+
+/**
+ * @brief Quantize a gamma corrected gray value at target position x, y to
+ *        4 bits, with ordered dithering if the context uses it.
+ */
+static inline uint8_t to_nibble(const libjpeg_ctx_t *ctx, uint8_t gray,
+                                int32_t x, int32_t y);
+
+static inline void put_nibble(const jpeg_target_t *t, int32_t x, int32_t y,
+                              uint8_t nibble);
+
+/**
+ * @brief This function opens a Jpeg image source and primes the decoder
+ *
+ * @param area Its width and height are set to the size of the image.
+ */
+static int prepare_jpeg(libjpeg_ctx_t *ctx, JDEC *jd, ImageSource *src,
+                        Rect_t *area);
+
+/**
+ * @brief Decompress a prepared image through `output`.
+ *
+ * @param scale tjpgd output scale, 1/2^scale.
+ */
+#if ESP_IDF_VERSION_MAJOR >= 5 // IDF 5+
+static int decompress_jpeg(libjpeg_ctx_t *ctx, JDEC *jd,
+                           UINT (*output)(JDEC *, void *, JRECT *), uint8_t scale);
 #else
-static uint32_t tjd_output(JDEC *jd, void *bitmap, JRECT *rect);
+static int decompress_jpeg(libjpeg_ctx_t *ctx, JDEC *jd,
+                           uint32_t (*output)(JDEC *, void *, JRECT *), uint8_t scale);
 #endif
 
 /**
- * @brief This function opens jpeg_buf Jpeg image file and primes the decoder
+ * @brief Decode the image into a 4bpp destination.
+ *
+ * @param x, y Position of the image in the destination.
+ * @param clip Part of the destination that is written.
+ */
+static int stream_jpeg(libjpeg_ctx_t *ctx, JDEC *jd, uint8_t *data,
+                       uint32_t stride, int32_t x, int32_t y, Rect_t clip);
+
+/**
+ * @brief Decode the image shrunk to width x height into a 4bpp destination.
+ *
+ * @note tjpgd scales by 1/2, 1/4 or 1/8 while decoding, the box filter
+ *       takes care of the rest.
  */
-static int draw_jpeg(uint8_t *jpeg_buf, Rect_t *area);
+static int stream_jpeg_scaled(libjpeg_ctx_t *ctx, JDEC *jd, uint8_t *data,
+                              uint32_t stride, int32_t x, int32_t y,
+                              int32_t width, int32_t height, Rect_t clip);
+
+/**
+ * @brief The context of the functions without one, created on first use.
+ */
+static libjpeg_ctx_t *default_context(void);
 
 /******************************************************************************/
 /***        exported variables                                              ***/
@@ -113,19 +236,17 @@ const char *jd_errors[] = {
 // Nice test values: 0.9 1.2 1.4 higher and is too bright
 static double gamma_value = 0.9;
 
-static uint32_t jpeg_buf_pos;
+static libjpeg_ctx_t *default_ctx;
 
-static uint8_t *decoded_image;   // RAW decoded image
-static uint8_t tjpgd_work[4096]; // tjpgd 4Kb buffer
-
-#if LIBJPEG_MEASURE
-// static uint32_t time_epd_fullclear = 0;
-static uint32_t time_decomp = 0;
-static uint32_t time_update_screen = 0;
-static uint32_t time_render = 0;
-#endif
-
-static uint8_t gamme_curve[256];
+/**
+ * @brief 4x4 Bayer threshold matrix.
+ */
+static const uint8_t bayer_matrix[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 },
+};
 
 const char *TAG = "JPEG";
 
@@ -135,19 +256,53 @@ const char *TAG = "JPEG";
 
 void libjpeg_init(void)
 {
-    //解码图像内存申请， 来自PSRAM
-    decoded_image = (uint8_t *)heap_caps_malloc(EPD_WIDTH * EPD_HEIGHT, MALLOC_CAP_SPIRAM);
-    if (decoded_image == NULL)
+    default_ctx = libjpeg_ctx_create();
+}
+
+
+libjpeg_ctx_t *libjpeg_ctx_create(void)
+{
+    libjpeg_ctx_t *ctx = (libjpeg_ctx_t *)calloc(1, sizeof(libjpeg_ctx_t));
+    if (ctx == NULL)
     {
-        ESP_LOGE(TAG, "Initial alloc decoded_image failed!");
+        ESP_LOGE(TAG, "alloc context failed!");
+        return NULL;
     }
-    memset(decoded_image, 255, EPD_WIDTH * EPD_HEIGHT);
-
-    ESP_LOGI(TAG, "Free heap after buffers allocation: %d", xPortGetFreeHeapSize());
 
     double gammaCorrection = 1.0 / gamma_value;
     for (int gray_value = 0; gray_value < 256; gray_value++)
-        gamme_curve[gray_value] = round(255 * pow(gray_value / 255.0, gammaCorrection));
+        ctx->gamme_curve[gray_value] = round(255 * pow(gray_value / 255.0, gammaCorrection));
+
+    ctx->dither = JPG_DITHERING;
+
+    return ctx;
+}
+
+
+void libjpeg_ctx_destroy(libjpeg_ctx_t *ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    heap_caps_free(ctx->work);
+    free(ctx);
+}
+
+
+void libjpeg_ctx_set_dither(libjpeg_ctx_t *ctx, JpegDither_t dither)
+{
+    ctx->dither = dither;
+}
+
+
+void libjpeg_set_dither(JpegDither_t dither)
+{
+    libjpeg_ctx_t *ctx = default_context();
+    if (ctx != NULL)
+    {
+        libjpeg_ctx_set_dither(ctx, dither);
+    }
 }
 
 
@@ -211,191 +366,470 @@ void show_jpg_from_buff(uint8_t *buff, uint32_t buff_size, Rect_t area)
 
     ESP_LOGI(TAG, "jpeg size: %d Byte", buff_size);
 
-    memset(decoded_image, 255, EPD_WIDTH * EPD_HEIGHT);
+    libjpeg_ctx_t *ctx = default_context();
+    if (ctx == NULL)
+    {
+        return;
+    }
 
-    draw_jpeg(buff, &area);
+    ImageSource src;
+    image_source_init_buffer(&src, buff, buff_size);
+
+    JDEC jd;
+    if (prepare_jpeg(ctx, &jd, &src, &area) != 1)
+    {
+        return;
+    }
+
+    // Only the image's own region is buffered, already packed to 4bpp
+    uint32_t stride = area.width / 2 + area.width % 2;
+    uint8_t *image = (uint8_t *)heap_caps_malloc(stride * area.height, MALLOC_CAP_SPIRAM);
+    if (image == NULL)
+    {
+        ESP_LOGE(TAG, "alloc image region failed!");
+        return;
+    }
+    memset(image, 255, stride * area.height);
+
+    Rect_t clip = { .x = 0, .y = 0, .width = area.width, .height = area.height };
+    if (stream_jpeg(ctx, &jd, image, stride, 0, 0, clip) != 1)
+    {
+        heap_caps_free(image);
+        return;
+    }
 
 #if LIBJPEG_MEASURE
-    time_update_screen = esp_timer_get_time();
+    ctx->time_update_screen = esp_timer_get_time();
 #endif
 
     epd_clear_area(area);
-    epd_draw_grayscale_image(area, decoded_image);
+    epd_draw_grayscale_image(area, image);
 
 #if LIBJPEG_MEASURE
-    time_update_screen = (esp_timer_get_time() - time_update_screen) / 1000;
-    ESP_LOGI(TAG, "%d ms - screen", time_update_screen);
-    ESP_LOGI(TAG, "%d ms - total time spend", time_update_screen + time_decomp + time_render);
+    ctx->time_update_screen = (esp_timer_get_time() - ctx->time_update_screen) / 1000;
+    ESP_LOGI(TAG, "%d ms - screen", ctx->time_update_screen);
+    ESP_LOGI(TAG, "%d ms - total time spend",
+             ctx->time_update_screen + ctx->time_decomp + ctx->time_render);
 #endif
+
+    heap_caps_free(image);
 }
 
 
-void libjpeg_deinit(void)
+int draw_jpg_from_buff(uint8_t *buff, uint32_t buff_size, Rect_t *area,
+                       uint8_t *framebuffer)
 {
-    free(decoded_image);
+    if (!buff || buff_size == 0)
+    {
+        ESP_LOGE(TAG, "jpeg file is NULL");
+        return ESP_FAIL;
+    }
+
+    ImageSource src;
+    image_source_init_buffer(&src, buff, buff_size);
+    return draw_jpg_from_source(&src, area, framebuffer);
 }
 
-/******************************************************************************/
-/***        local functions                                                 ***/
-/******************************************************************************/
 
-#if JPG_DITHERING
-static uint8_t find_closest_palette_color(uint8_t oldpixel)
+int draw_jpg_from_source(ImageSource *src, Rect_t *area, uint8_t *framebuffer)
 {
-    return oldpixel & 0xF0;
+    libjpeg_ctx_t *ctx = default_context();
+    if (ctx == NULL)
+    {
+        return ESP_FAIL;
+    }
+    return libjpeg_ctx_draw(ctx, src, area, framebuffer);
 }
-#endif
 
-static void jpeg_render(Rect_t area)
+
+int libjpeg_ctx_draw(libjpeg_ctx_t *ctx, ImageSource *src, Rect_t *area,
+                     uint8_t *framebuffer)
 {
-#if LIBJPEG_MEASURE
-    time_render = esp_timer_get_time();
-#endif
+    if (framebuffer == NULL)
+    {
+        ESP_LOGE(TAG, "framebuffer is NULL");
+        return ESP_FAIL;
+    }
 
-#if JPG_DITHERING
-    unsigned long pixel = 0;
-    for (uint16_t by = 0; by < EP_HEIGHT; by++)
+    JDEC jd;
+    if (prepare_jpeg(ctx, &jd, src, area) != 1)
     {
-        for (uint16_t bx = 0; bx < EP_WIDTH; bx++)
-        {
-            int oldpixel = decoded_image[pixel];
-            int newpixel = find_closest_palette_color(oldpixel);
-            int quant_error = oldpixel - newpixel;
-            decoded_image[pixel] = newpixel;
-            if (bx < (EP_WIDTH - 1))
-                decoded_image[pixel + 1] = minimum(255, decoded_image[pixel + 1] + quant_error * 7 / 16);
-
-            if (by < (EP_HEIGHT - 1))
-            {
-                if (bx > 0)
-                    decoded_image[pixel + EP_WIDTH - 1] = minimum(255, decoded_image[pixel + EP_WIDTH - 1] + quant_error * 3 / 16);
+        return ESP_FAIL;
+    }
 
-                decoded_image[pixel + EP_WIDTH] = minimum(255, decoded_image[pixel + EP_WIDTH] + quant_error * 5 / 16);
-                if (bx < (EP_WIDTH - 1))
-                    decoded_image[pixel + EP_WIDTH + 1] = minimum(255, decoded_image[pixel + EP_WIDTH + 1] + quant_error * 1 / 16);
-            }
-            pixel++;
-        }
+    return stream_jpeg(ctx, &jd, framebuffer, EPD_WIDTH / 2, area->x, area->y,
+                       epd_full_screen());
+}
+
+
+int draw_jpg_scaled(uint8_t *buff, uint32_t buff_size, Rect_t area,
+                    JpegScale_t mode, uint8_t *framebuffer)
+{
+    if (!buff || buff_size == 0)
+    {
+        ESP_LOGE(TAG, "jpeg file is NULL");
+        return ESP_FAIL;
     }
-#endif
 
-    for (uint32_t by = 0; by < area.height; by++)
+    ImageSource src;
+    image_source_init_buffer(&src, buff, buff_size);
+    return draw_jpg_scaled_from_source(&src, area, mode, framebuffer);
+}
+
+
+int draw_jpg_scaled_from_source(ImageSource *src, Rect_t area, JpegScale_t mode,
+                                uint8_t *framebuffer)
+{
+    libjpeg_ctx_t *ctx = default_context();
+    if (ctx == NULL)
+    {
+        return ESP_FAIL;
+    }
+    return libjpeg_ctx_draw_scaled(ctx, src, area, mode, framebuffer);
+}
+
+
+int libjpeg_ctx_draw_scaled(libjpeg_ctx_t *ctx, ImageSource *src, Rect_t area,
+                            JpegScale_t mode, uint8_t *framebuffer)
+{
+    if (framebuffer == NULL)
     {
-        for (uint32_t bx = 0; bx < area.width; bx++)
+        ESP_LOGE(TAG, "framebuffer is NULL");
+        return ESP_FAIL;
+    }
+    if (area.width <= 0 || area.height <= 0)
+    {
+        ESP_LOGE(TAG, "empty target area");
+        return ESP_FAIL;
+    }
+
+    JDEC jd;
+    Rect_t image;
+    if (prepare_jpeg(ctx, &jd, src, &image) != 1)
+    {
+        return ESP_FAIL;
+    }
+
+    // The image is shrunk, never enlarged
+    int32_t width = image.width;
+    int32_t height = image.height;
+    bool wider = (int64_t)image.width * area.height > (int64_t)image.height * area.width;
+    if (mode == JPEG_SCALE_FIT
+            && (image.width > area.width || image.height > area.height))
+    {
+        if (wider)
+        {
+            width = area.width;
+            height = (int64_t)image.height * area.width / image.width;
+        }
+        else
         {
-            epd_draw_pixel_area(bx, by, decoded_image[by * area.width + bx], decoded_image, area);
+            height = area.height;
+            width = (int64_t)image.width * area.height / image.height;
         }
     }
+    else if (mode == JPEG_SCALE_FILL
+            && image.width > area.width && image.height > area.height)
+    {
+        if (wider)
+        {
+            height = area.height;
+            width = ((int64_t)image.width * area.height + image.height - 1) / image.height;
+        }
+        else
+        {
+            width = area.width;
+            height = ((int64_t)image.height * area.width + image.width - 1) / image.width;
+        }
+    }
+    if (width < 1) width = 1;
+    if (height < 1) height = 1;
+
+    // Centered in the area, whatever sticks out of it is cut off
+    Rect_t clip = epd_full_screen();
+    int32_t right = minimum(clip.x + clip.width, area.x + area.width);
+    int32_t bottom = minimum(clip.y + clip.height, area.y + area.height);
+    if (area.x > clip.x) clip.x = area.x;
+    if (area.y > clip.y) clip.y = area.y;
+    clip.width = right - clip.x;
+    clip.height = bottom - clip.y;
+    if (clip.width <= 0 || clip.height <= 0)
+    {
+        return 1;
+    }
 
-#if LIBJPEG_MEASURE
-    // calculate how long it took to draw the image
-    time_render = (esp_timer_get_time() - time_render) / 1000;
-    ESP_LOGI(TAG, "%d ms - rgb to bitmap", time_render);
-#endif
+    return stream_jpeg_scaled(ctx, &jd, framebuffer, EPD_WIDTH / 2,
+                              area.x + (area.width - width) / 2,
+                              area.y + (area.height - height) / 2,
+                              width, height, clip);
 }
 
 
-static void epd_draw_pixel_area(int x, int y, uint8_t color, uint8_t *framebuffer, Rect_t area)
+void libjpeg_deinit(void)
 {
-    if (x < 0 || x >= EP_WIDTH) return;
-    if (y < 0 || y >= EP_HEIGHT) return;
-
-    uint8_t *buf_ptr = &framebuffer[y * area.width / 2 + x / 2];
-    if (x % 2) {
-        *buf_ptr = (*buf_ptr & 0x0F) | (color & 0xF0);
-    } else {
-        *buf_ptr = (*buf_ptr & 0xF0) | (color >> 4);
-    }
+    libjpeg_ctx_destroy(default_ctx);
+    default_ctx = NULL;
 }
 
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
 #if ESP_IDF_VERSION_MAJOR >= 5 // IDF 5+
 static UINT feed_buffer(JDEC *jd, BYTE *buff, UINT nd)
 #else
 static uint32_t feed_buffer(JDEC *jd, uint8_t *buff, uint32_t nd)
 #endif
 {
-    uint8_t *device = (uint8_t *)jd->device;
-    uint32_t count = 0;
-    while (count < nd)
+    return image_source_read(((libjpeg_ctx_t *)jd->device)->src, buff, nd);
+}
+
+#if ESP_IDF_VERSION_MAJOR >= 5 // IDF 5+
+static UINT tjd_output_4bpp(JDEC *jd, void *bitmap, JRECT *rect)
+#else
+static uint32_t tjd_output_4bpp(JDEC *jd, void *bitmap, JRECT *rect)
+#endif
+{
+    esp_task_wdt_reset();
+
+    libjpeg_ctx_t *ctx = (libjpeg_ctx_t *)jd->device;
+    const jpeg_target_t *t = &ctx->target;
+    int32_t w = rect->right - rect->left + 1;
+
+    // Clip the block to the image and the target, in image coordinates
+    int32_t left = rect->left;
+    int32_t right = minimum((int32_t)rect->right + 1, (int32_t)jd->width);
+    right = minimum(right, t->clip.x + t->clip.width - t->x);
+    if (left < t->clip.x - t->x) left = t->clip.x - t->x;
+    int32_t top = rect->top;
+    int32_t bottom = minimum((int32_t)rect->bottom + 1, (int32_t)jd->height);
+    bottom = minimum(bottom, t->clip.y + t->clip.height - t->y);
+    if (top < t->clip.y - t->y) top = t->clip.y - t->y;
+
+    for (int32_t yy = top; yy < bottom; yy++)
     {
-        if (buff != NULL)
+        const uint8_t *src = (const uint8_t *)bitmap
+                             + ((yy - rect->top) * w + (left - rect->left)) * 3;
+        int32_t dy = yy + t->y;
+        uint8_t *row = t->data + dy * t->stride;
+        int32_t xx = left;
+        int32_t dx = left + t->x;
+
+        if ((dx & 1) && xx < right)
         {
-            *buff++ = device[jpeg_buf_pos];
+            uint32_t val = (src[0] * 38 + src[1] * 75 + src[2] * 15) >> 7;
+            uint8_t n = to_nibble(ctx, ctx->gamme_curve[val], dx, dy);
+            row[dx / 2] = (row[dx / 2] & 0x0F) | (n << 4);
+            src += 3;
+            xx++;
+            dx++;
+        }
+        // Two pixels make a whole byte
+        for (; xx + 1 < right; xx += 2, dx += 2)
+        {
+            uint32_t v0 = (src[0] * 38 + src[1] * 75 + src[2] * 15) >> 7;
+            uint32_t v1 = (src[3] * 38 + src[4] * 75 + src[5] * 15) >> 7;
+            row[dx / 2] = (to_nibble(ctx, ctx->gamme_curve[v1], dx + 1, dy) << 4)
+                          | to_nibble(ctx, ctx->gamme_curve[v0], dx, dy);
+            src += 6;
+        }
+        if (xx < right)
+        {
+            uint32_t val = (src[0] * 38 + src[1] * 75 + src[2] * 15) >> 7;
+            uint8_t n = to_nibble(ctx, ctx->gamme_curve[val], dx, dy);
+            row[dx / 2] = (row[dx / 2] & 0xF0) | n;
         }
-        count++;
-        jpeg_buf_pos++;
     }
 
-    return count;
+    return 1;
 }
 
+
 #if ESP_IDF_VERSION_MAJOR >= 5 // IDF 5+
-static UINT tjd_output(JDEC *jd, void *bitmap, JRECT *rect)
+static UINT tjd_output_scaled(JDEC *jd, void *bitmap, JRECT *rect)
 #else
-static uint32_t tjd_output(JDEC *jd, void *bitmap, JRECT *rect)
+static uint32_t tjd_output_scaled(JDEC *jd, void *bitmap, JRECT *rect)
 #endif
 {
     esp_task_wdt_reset();
 
-    uint32_t w = rect->right - rect->left + 1;
-    uint32_t h = rect->bottom - rect->top + 1;
-    uint8_t *bitmap_ptr = (uint8_t *)bitmap;
+    libjpeg_ctx_t *ctx = (libjpeg_ctx_t *)jd->device;
+    jpeg_scaler_t *s = &ctx->scaler;
+    int32_t w = rect->right - rect->left + 1;
+
+    // Rows above this MCU row are complete
+    flush_scaled_rows(ctx, (int64_t)rect->top * s->dst_h / s->src_h);
+
+    int32_t right = minimum((int32_t)rect->right + 1, s->src_w);
+    int32_t bottom = minimum((int32_t)rect->bottom + 1, s->src_h);
+    for (int32_t yy = rect->top; yy < bottom; yy++)
+    {
+        const uint8_t *src = (const uint8_t *)bitmap + (yy - rect->top) * w * 3;
+        int32_t oy = (int64_t)yy * s->dst_h / s->src_h;
+        uint32_t *sum = s->sum + (oy % s->rows) * s->dst_w;
+        if (s->src_w == s->dst_w && s->src_h == s->dst_h)
+        {
+            // Not scaled, only buffered for error diffusion
+            for (int32_t xx = rect->left; xx < right; xx++)
+            {
+                sum[xx] = (src[0] * 38 + src[1] * 75 + src[2] * 15) >> 7;
+                src += 3;
+            }
+            continue;
+        }
+        for (int32_t xx = rect->left; xx < right; xx++)
+        {
+            sum[(int64_t)xx * s->dst_w / s->src_w]
+                += (src[0] * 38 + src[1] * 75 + src[2] * 15) >> 7;
+            src += 3;
+        }
+    }
+
+    return 1;
+}
+
+
+static void flush_scaled_rows(libjpeg_ctx_t *ctx, int32_t end)
+{
+    jpeg_scaler_t *s = &ctx->scaler;
+    for (; s->next_row < end; s->next_row++)
+    {
+        int32_t oy = s->next_row;
+        uint32_t *sum = s->sum + (oy % s->rows) * s->dst_w;
+        if (s->src_w == s->dst_w && s->src_h == s->dst_h)
+        {
+            for (int32_t ox = 0; ox < s->dst_w; ox++)
+            {
+                s->line[ox] = ctx->gamme_curve[sum[ox]];
+            }
+            write_row(ctx, oy);
+            continue;
+        }
+        // Decoded rows and columns that fall into output row oy and column ox
+        int64_t rows = ((int64_t)(oy + 1) * s->src_h + s->dst_h - 1) / s->dst_h
+                       - ((int64_t)oy * s->src_h + s->dst_h - 1) / s->dst_h;
+        int64_t first = 0;
+        for (int32_t ox = 0; ox < s->dst_w; ox++)
+        {
+            int64_t next = ((int64_t)(ox + 1) * s->src_w + s->dst_w - 1) / s->dst_w;
+            uint32_t count = rows * (next - first);
+            s->line[ox] = ctx->gamme_curve[sum[ox] / count];
+            first = next;
+        }
+        memset(sum, 0, s->dst_w * sizeof(uint32_t));
+        write_row(ctx, oy);
+    }
+}
+
 
-    // printf("right: %d, left: %d, bottom: %d, top: %d\n", rect->right, rect->left, rect->bottom, rect->top);
+static void write_row(libjpeg_ctx_t *ctx, int32_t oy)
+{
+    const jpeg_scaler_t *s = &ctx->scaler;
+    const jpeg_target_t *t = &ctx->target;
+    int32_t y = t->y + oy;
 
-    /**
-     * @todo 8bit 16bit 32bit
-     */
-    for (uint32_t i = 0; i < w * h; i++)
+    if (ctx->dither != JPEG_DITHER_ERROR_DIFFUSION)
     {
-        uint8_t r = *(bitmap_ptr++);
-        uint8_t g = *(bitmap_ptr++);
-        uint8_t b = *(bitmap_ptr++);
+        for (int32_t ox = 0; ox < s->dst_w; ox++)
+        {
+            put_nibble(t, t->x + ox, y, to_nibble(ctx, s->line[ox], t->x + ox, y));
+        }
+        return;
+    }
 
-        /** Calculate weighted grayscale */
-        //uint32_t val = ((r * 30 + g * 59 + b * 11) / 100); // original formula
-        uint32_t val = (r * 38 + g * 75 + b * 15) >> 7; // @vroland recommended formula
+    // Floyd-Steinberg, every other row from right to left
+    int32_t padded = s->dst_w + 2;
+    int16_t *cur = s->error + (oy & 1) * padded + 1;
+    int16_t *next = s->error + ((oy + 1) & 1) * padded + 1;
+    memset(next - 1, 0, padded * sizeof(int16_t));
 
-        int xx = rect->left + i % w;
-        if (xx < 0 || xx >= jd->width) continue ;
+    int32_t dir = (oy & 1) ? -1 : 1;
+    int32_t ox = (oy & 1) ? s->dst_w - 1 : 0;
+    for (int32_t i = 0; i < s->dst_w; i++, ox += dir)
+    {
+        int32_t v = s->line[ox] + ((cur[ox] + 8) >> 4);
+        if (v < 0) v = 0;
+        if (v > 255) v = 255;
+        int32_t q = (v * 15 + 127) / 255;
+        int32_t err = v - q * 17;
+        cur[ox + dir] += err * 7;
+        next[ox - dir] += err * 3;
+        next[ox] += err * 5;
+        next[ox + dir] += err;
+        put_nibble(t, t->x + ox, y, q);
+    }
+}
 
-        int yy = rect->top + i / w;
-        if (yy < 0 || yy >= jd->height) continue ;
 
-        /**
-         * Optimization note: If we manage to apply here the epd_draw_pixel
-         * directly then it will be no need to keep a huge raw buffer (But will
-         * loose dither)
-         */
-        decoded_image[yy * jd->width + xx] = gamme_curve[val];
+static inline uint8_t to_nibble(const libjpeg_ctx_t *ctx, uint8_t gray,
+                                int32_t x, int32_t y)
+{
+    if (ctx->dither == JPEG_DITHER_BAYER)
+    {
+        return (gray * 15 + bayer_matrix[y & 3][x & 3] * 16 + 8) >> 8;
     }
+    return gray >> 4;
+}
 
-    return 1;
+
+static inline void put_nibble(const jpeg_target_t *t, int32_t x, int32_t y,
+                              uint8_t nibble)
+{
+    if (x < t->clip.x || x >= t->clip.x + t->clip.width) return;
+    if (y < t->clip.y || y >= t->clip.y + t->clip.height) return;
+
+    uint8_t *buf_ptr = &t->data[y * t->stride + x / 2];
+    if (x % 2) {
+        *buf_ptr = (*buf_ptr & 0x0F) | (nibble << 4);
+    } else {
+        *buf_ptr = (*buf_ptr & 0xF0) | nibble;
+    }
 }
 
 
-static int draw_jpeg(uint8_t *jpeg_buf, Rect_t *area)
+static int prepare_jpeg(libjpeg_ctx_t *ctx, JDEC *jd, ImageSource *src,
+                        Rect_t *area)
 {
-    JDEC jd;
     JRESULT rc;
 
-    jpeg_buf_pos = 0; //此值不要忘了初始化
+    if (ctx->work == NULL)
+    {
+        ctx->work = (uint8_t *)heap_caps_malloc(LIBJPEG_WORK_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (ctx->work == NULL)
+        {
+            ESP_LOGE(TAG, "alloc tjpgd work area failed!");
+            return ESP_FAIL;
+        }
+    }
 
-    rc = jd_prepare(&jd, feed_buffer, tjpgd_work, sizeof(tjpgd_work), jpeg_buf);
+    ctx->src = src;
+    rc = jd_prepare(jd, feed_buffer, ctx->work, LIBJPEG_WORK_SIZE, ctx);
     if (rc != JDR_OK)
     {
         ESP_LOGE(TAG, "prepare error: %s", jd_errors[rc]);
         return ESP_FAIL;
     }
 
-    area->width = jd.width;
-    area->height = jd.height;
+    area->width = jd->width;
+    area->height = jd->height;
+
+    return 1;
+}
+
 
+#if ESP_IDF_VERSION_MAJOR >= 5 // IDF 5+
+static int decompress_jpeg(libjpeg_ctx_t *ctx, JDEC *jd,
+                           UINT (*output)(JDEC *, void *, JRECT *), uint8_t scale)
+#else
+static int decompress_jpeg(libjpeg_ctx_t *ctx, JDEC *jd,
+                           uint32_t (*output)(JDEC *, void *, JRECT *), uint8_t scale)
+#endif
+{
 #if LIBJPEG_MEASURE
     uint32_t decode_start = esp_timer_get_time();
 #endif
 
-    rc = jd_decomp(&jd, tjd_output, 0);
+    JRESULT rc = jd_decomp(jd, output, scale);
     if (rc != JDR_OK)
     {
         ESP_LOGE(TAG, "decomp error: %s", jd_errors[rc]);
@@ -403,18 +837,125 @@ static int draw_jpeg(uint8_t *jpeg_buf, Rect_t *area)
     }
 
 #if LIBJPEG_MEASURE
-    time_decomp = (esp_timer_get_time() - decode_start) / 1000;
-    ESP_LOGI(TAG, "jpeg file width: %d, height: %d", jd.width, jd.height);
-    ESP_LOGI(TAG, "%d ms - image decompression", time_decomp);
+    ctx->time_decomp = (esp_timer_get_time() - decode_start) / 1000;
+    ESP_LOGI(TAG, "jpeg file width: %d, height: %d, scale: 1/%d", jd->width,
+             jd->height, 1 << scale);
+    ESP_LOGI(TAG, "%d ms - image decompression", ctx->time_decomp);
 #endif
 
-    // Render the image onto the screen at given coordinates
-    jpeg_render(*area);
-
     return 1;
 }
 
 
+static int stream_jpeg(libjpeg_ctx_t *ctx, JDEC *jd, uint8_t *data,
+                       uint32_t stride, int32_t x, int32_t y, Rect_t clip)
+{
+    return stream_jpeg_scaled(ctx, jd, data, stride, x, y, jd->width,
+                              jd->height, clip);
+}
+
+
+static int stream_jpeg_scaled(libjpeg_ctx_t *ctx, JDEC *jd, uint8_t *data,
+                              uint32_t stride, int32_t x, int32_t y,
+                              int32_t width, int32_t height, Rect_t clip)
+{
+    ctx->target.data = data;
+    ctx->target.stride = stride;
+    ctx->target.x = x;
+    ctx->target.y = y;
+    ctx->target.clip = clip;
+
+#if LIBJPEG_MEASURE
+    // Packing happens while decoding
+    ctx->time_render = 0;
+#endif
+
+    // The box filter only shrinks, every output pixel needs a source pixel
+    if (width > jd->width || height > jd->height)
+    {
+        ESP_LOGE(TAG, "scaled size larger than the image!");
+        ctx->target.data = NULL;
+        return ESP_FAIL;
+    }
+
+    // Largest tjpgd scale that still leaves at least width x height pixels.
+    // tjpgd rounds down: an odd sized image loses its last column or row.
+    uint8_t scale = 0;
+    int32_t src_w = jd->width;
+    int32_t src_h = jd->height;
+    while (scale < 3)
+    {
+        int32_t w = (int32_t)jd->width >> (scale + 1);
+        int32_t h = (int32_t)jd->height >> (scale + 1);
+        if (w < width || h < height)
+        {
+            break;
+        }
+        scale++;
+        src_w = w;
+        src_h = h;
+    }
+
+    int ret;
+    if (src_w == width && src_h == height
+            && ctx->dither != JPEG_DITHER_ERROR_DIFFUSION)
+    {
+        ret = decompress_jpeg(ctx, jd, tjd_output_4bpp, scale);
+    }
+    else
+    {
+        // Enough rows for every output row one MCU row can touch, the
+        // output row and two error rows
+        int32_t mcu_rows = (8 * jd->msy) >> scale;
+        ctx->scaler.rows = (mcu_rows > 0 ? mcu_rows : 1) + 1;
+        size_t sum_size = ctx->scaler.rows * width * sizeof(uint32_t);
+        size_t error_size = 2 * (width + 2) * sizeof(int16_t);
+        size_t size = sum_size + error_size + width;
+        ctx->scaler.sum = (uint32_t *)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (ctx->scaler.sum == NULL)
+        {
+            ctx->scaler.sum = (uint32_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        }
+        if (ctx->scaler.sum == NULL)
+        {
+            ESP_LOGE(TAG, "alloc scaler rows failed!");
+            ctx->target.data = NULL;
+            return ESP_FAIL;
+        }
+        memset(ctx->scaler.sum, 0, size);
+        ctx->scaler.error = (int16_t *)((uint8_t *)ctx->scaler.sum + sum_size);
+        ctx->scaler.line = (uint8_t *)ctx->scaler.sum + sum_size + error_size;
+        ctx->scaler.src_w = src_w;
+        ctx->scaler.src_h = src_h;
+        ctx->scaler.dst_w = width;
+        ctx->scaler.dst_h = height;
+        ctx->scaler.next_row = 0;
+
+        ret = decompress_jpeg(ctx, jd, tjd_output_scaled, scale);
+        if (ret == 1)
+        {
+            flush_scaled_rows(ctx, height);
+        }
+        heap_caps_free(ctx->scaler.sum);
+        ctx->scaler.sum = NULL;
+    }
+
+    ctx->target.data = NULL;
+    return ret;
+}
+
+
+
+static libjpeg_ctx_t *default_context(void)
+{
+    if (default_ctx == NULL)
+    {
+        default_ctx = libjpeg_ctx_create();
+    }
+    return default_ctx;
+}
+
+
 /******************************************************************************/
 /***        END OF FILE                                                     ***/
 /******************************************************************************/
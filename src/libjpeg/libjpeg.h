@@ -11,6 +11,7 @@ extern "C" {
 /******************************************************************************/
 
 #include "epd_driver.h"
+#include "image_source.h"
 
 #include <stdint.h>
 
@@ -19,9 +20,10 @@ extern "C" {
 /******************************************************************************/
 
 /**
- * @brief Adds dithering to image rendering (Makes grayscale smoother on transitions)
+ * @brief Dithering of new contexts, see JpegDither_t (Makes grayscale
+ *        smoother on transitions)
  */
-#define JPG_DITHERING 0
+#define JPG_DITHERING JPEG_DITHER_NONE
 
 /**
  * @brief Measure the time consumed by jpeg image processing.
@@ -32,6 +34,35 @@ extern "C" {
 /***        type definitions                                                ***/
 /******************************************************************************/
 
+/**
+ * @brief How an image is shrunk into a target area.
+ */
+typedef enum
+{
+    JPEG_SCALE_FIT = 0, /** The whole image fits into the area */
+    JPEG_SCALE_FILL,    /** The image covers the area, the overhang is cut off */
+} JpegScale_t;
+
+/**
+ * @brief How gray values are reduced to the 16 levels of the display.
+ *
+ * @note All modes work on the rows as they are decoded, no full 8-bit image
+ *       is kept.
+ */
+typedef enum
+{
+    JPEG_DITHER_NONE = 0,         /** Cut off the low 4 bits, fastest */
+    JPEG_DITHER_BAYER,            /** 4x4 ordered dithering, as fast as none */
+    JPEG_DITHER_ERROR_DIFFUSION,  /** Serpentine Floyd-Steinberg, buffers an
+                                      MCU row */
+} JpegDither_t;
+
+/**
+ * @brief Decoder state. Contexts can decode at the same time, e.g. one per
+ *        core.
+ */
+typedef struct libjpeg_ctx libjpeg_ctx_t;
+
 /******************************************************************************/
 /***        exported variables                                              ***/
 /******************************************************************************/
@@ -40,8 +71,102 @@ extern "C" {
 /***        exported functions                                              ***/
 /******************************************************************************/
 
+/**
+ * @brief Create the context used by the functions that do not take one.
+ *
+ * @note Nothing large is allocated until an image is decoded.
+ */
 void libjpeg_init(void);
+
+/**
+ * @brief Create a decoder context.
+ *
+ * @note The tjpgd work area is allocated by the first decode and kept for
+ *       the next ones.
+ *
+ * @return NULL if out of memory.
+ */
+libjpeg_ctx_t *libjpeg_ctx_create(void);
+
+/**
+ * @brief Free a context and its buffers.
+ */
+void libjpeg_ctx_destroy(libjpeg_ctx_t *ctx);
+
+/**
+ * @brief Select the dithering of later decodes with this context.
+ */
+void libjpeg_ctx_set_dither(libjpeg_ctx_t *ctx, JpegDither_t dither);
+
+/**
+ * @brief Select the dithering of the functions without a context.
+ */
+void libjpeg_set_dither(JpegDither_t dither);
+
+/**
+ * @brief draw_jpg_from_source() with its own context.
+ *
+ * @note Contexts drawing into the same framebuffer at the same time must
+ *       not share framebuffer bytes, i.e. areas should start and end on even
+ *       columns.
+ */
+int libjpeg_ctx_draw(libjpeg_ctx_t *ctx, ImageSource *src, Rect_t *area,
+                     uint8_t *framebuffer);
+
+/**
+ * @brief draw_jpg_scaled_from_source() with its own context.
+ */
+int libjpeg_ctx_draw_scaled(libjpeg_ctx_t *ctx, ImageSource *src, Rect_t area,
+                            JpegScale_t mode, uint8_t *framebuffer);
+
 void show_jpg_from_buff(uint8_t *buff, uint32_t buff_size, Rect_t area);
+
+/**
+ * @brief Decode a jpeg image straight into a 4bpp framebuffer.
+ *
+ * @note Each decoded block is converted to gamma corrected gray and packed
+ *       into the framebuffer as it is decoded, no intermediate image is
+ *       kept. Gray is reduced to 4 bits with the dithering selected by
+ *       libjpeg_set_dither(), JPG_DITHERING (JPEG_DITHER_NONE) until then.
+ *       Error diffusion buffers an MCU row. Pixels outside of the screen are
+ *       clipped.
+ *
+ * @param area        The image's top left corner goes to area->x, area->y.
+ *                    Width and height are set to the size of the image.
+ * @param framebuffer A EPD_WIDTH x EPD_HEIGHT 4bpp framebuffer.
+ * @return 1 on success, ESP_FAIL otherwise.
+ */
+int draw_jpg_from_buff(uint8_t *buff, uint32_t buff_size, Rect_t *area,
+                       uint8_t *framebuffer);
+
+/**
+ * @brief Same as draw_jpg_from_buff(), reading the image from `src`.
+ *
+ * @note The image is read in pieces while it is decoded, so it does not
+ *       have to be in memory as a whole.
+ */
+int draw_jpg_from_source(ImageSource *src, Rect_t *area, uint8_t *framebuffer);
+
+/**
+ * @brief Decode a jpeg image shrunk into an area of a 4bpp framebuffer.
+ *
+ * @note The image keeps its aspect ratio and is centered in the area. It is
+ *       never enlarged. tjpgd decodes at 1/2, 1/4 or 1/8 scale where that
+ *       does not go below the target size, which makes large images decode
+ *       faster. A box filter averages the remaining difference. Nothing
+ *       outside of the area is written.
+ *
+ * @param framebuffer A EPD_WIDTH x EPD_HEIGHT 4bpp framebuffer.
+ * @return 1 on success, ESP_FAIL otherwise.
+ */
+int draw_jpg_scaled(uint8_t *buff, uint32_t buff_size, Rect_t area,
+                    JpegScale_t mode, uint8_t *framebuffer);
+
+/**
+ * @brief Same as draw_jpg_scaled(), reading the image from `src`.
+ */
+int draw_jpg_scaled_from_source(ImageSource *src, Rect_t area, JpegScale_t mode,
+                                uint8_t *framebuffer);
 // void show_jpg_from_spiffs(const char *fn);
 void libjpeg_deinit(void);
 
@@ -0,0 +1,772 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "libpng.h"
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_task_wdt.h"
+
+#include "zlib/zlib.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Widest image accepted, bounds the row buffers.
+ */
+#define LIBPNG_MAX_WIDTH 2048
+
+#define PNG_COLOR_GRAY       0
+#define PNG_COLOR_RGB        2
+#define PNG_COLOR_PALETTE    3
+#define PNG_COLOR_GRAY_ALPHA 4
+#define PNG_COLOR_RGBA       6
+
+#define PNG_CHUNK(a, b, c, d) \
+    (((uint32_t)(a) << 24) | ((uint32_t)(b) << 16) | ((uint32_t)(c) << 8) | (uint32_t)(d))
+
+#define PNG_IHDR PNG_CHUNK('I', 'H', 'D', 'R')
+#define PNG_PLTE PNG_CHUNK('P', 'L', 'T', 'E')
+#define PNG_TRNS PNG_CHUNK('t', 'R', 'N', 'S')
+#define PNG_IDAT PNG_CHUNK('I', 'D', 'A', 'T')
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Where the decoded rows go.
+ */
+typedef struct
+{
+    uint8_t *data;   /** The framebuffer */
+    uint32_t stride; /** Bytes per framebuffer row */
+    int32_t  x;      /** Position of the image's left edge */
+    int32_t  y;      /** Position of the image's top edge */
+    Rect_t   clip;   /** Pixels outside of this rectangle are dropped */
+} png_target_t;
+
+/**
+ * @brief Inflates a zlib stream read from an image source.
+ *
+ * @note A PNG stream is split over IDAT chunks, the chunk framing is
+ *       skipped here.
+ */
+typedef struct
+{
+    ImageSource *src;
+    z_stream     zs;
+    uint8_t     *in;         /** LIBPNG_INPUT_SIZE bytes of input */
+    bool         png;        /** The stream is in IDAT chunks */
+    uint32_t     chunk_left; /** IDAT bytes not read yet */
+} inflate_reader_t;
+
+/**
+ * @brief What the PNG header chunks say about the image.
+ */
+typedef struct
+{
+    uint32_t width;
+    uint32_t height;
+    uint8_t  depth;        /** Bits per sample */
+    uint8_t  color_type;
+    uint32_t row_bytes;    /** Bytes per row, without the filter byte */
+    uint32_t bpp;          /** Bytes per pixel for the filters, at least 1 */
+    bool     has_trns;     /** A gray or RGB value is transparent */
+    uint16_t trns[3];      /** The transparent value */
+    uint8_t  palette[256]; /** Palette as gray, blended onto white */
+} png_info_t;
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+/**
+ * @brief Read the PNG signature and the chunks up to the first IDAT.
+ *
+ * @param chunk_left Set to the length of the first IDAT chunk.
+ */
+static int read_png_header(ImageSource *src, png_info_t *info,
+                           uint32_t *chunk_left);
+
+static int reader_init(inflate_reader_t *r, ImageSource *src, bool png,
+                       uint32_t chunk_left);
+
+static void reader_end(inflate_reader_t *r);
+
+/**
+ * @brief Inflate exactly `len` bytes to `out`.
+ */
+static int reader_inflate(inflate_reader_t *r, uint8_t *out, size_t len);
+
+/**
+ * @brief Refill the input buffer of the reader.
+ *
+ * @return Bytes read, 0 at the end of the stream.
+ */
+static size_t reader_fill(inflate_reader_t *r);
+
+/**
+ * @brief Undo the PNG filter of `row` in place.
+ */
+static int unfilter_row(uint8_t filter, uint8_t *row, const uint8_t *prev,
+                        uint32_t row_bytes, uint32_t bpp);
+
+/**
+ * @brief Convert an unfiltered PNG row to one gray byte per pixel.
+ */
+static void png_row_to_gray(const png_info_t *info, const uint8_t *row,
+                            uint8_t *gray);
+
+/**
+ * @brief Write a row of 8-bit gray values to the target.
+ */
+static void write_gray_row(const png_target_t *t, int32_t oy,
+                           const uint8_t *gray, uint32_t width);
+
+/**
+ * @brief Write a row in framebuffer order to the target.
+ */
+static void write_gray4_row(const png_target_t *t, int32_t oy,
+                            const uint8_t *packed, uint32_t width);
+
+static void target_init(png_target_t *t, uint8_t *framebuffer, Rect_t *area);
+
+static inline uint8_t blend_white(uint32_t gray, uint32_t alpha);
+
+static inline uint32_t read_be32(const uint8_t *p);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+static const char *TAG = "PNG";
+
+static const uint8_t png_signature[8] = { 137, 'P', 'N', 'G', '\r', '\n', 26, '\n' };
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+int draw_png_from_buff(uint8_t *buff, uint32_t buff_size, Rect_t *area,
+                       uint8_t *framebuffer)
+{
+    if (!buff || buff_size == 0)
+    {
+        ESP_LOGE(TAG, "png file is NULL");
+        return ESP_FAIL;
+    }
+
+    ImageSource src;
+    image_source_init_buffer(&src, buff, buff_size);
+    return draw_png_from_source(&src, area, framebuffer);
+}
+
+
+int draw_png_from_source(ImageSource *src, Rect_t *area, uint8_t *framebuffer)
+{
+    if (framebuffer == NULL)
+    {
+        ESP_LOGE(TAG, "framebuffer is NULL");
+        return ESP_FAIL;
+    }
+
+    png_info_t *info = (png_info_t *)malloc(sizeof(png_info_t));
+    if (info == NULL)
+    {
+        ESP_LOGE(TAG, "alloc png info failed!");
+        return ESP_FAIL;
+    }
+
+    uint32_t chunk_left;
+    if (read_png_header(src, info, &chunk_left) != 1)
+    {
+        free(info);
+        return ESP_FAIL;
+    }
+    area->width = info->width;
+    area->height = info->height;
+
+    // Filter byte and row, for this row and the one above, then the gray row
+    size_t row_size = info->row_bytes + 1;
+    uint8_t *buffer = (uint8_t *)heap_caps_malloc(2 * row_size + info->width, MALLOC_CAP_8BIT);
+    if (buffer == NULL)
+    {
+        ESP_LOGE(TAG, "alloc png rows failed!");
+        free(info);
+        return ESP_FAIL;
+    }
+    uint8_t *cur = buffer;
+    uint8_t *prev = buffer + row_size;
+    uint8_t *gray = buffer + 2 * row_size;
+    memset(prev, 0, row_size);
+
+    png_target_t target;
+    target_init(&target, framebuffer, area);
+
+    inflate_reader_t reader;
+    int ret = reader_init(&reader, src, true, chunk_left);
+    for (uint32_t y = 0; ret == 1 && y < info->height; y++)
+    {
+        esp_task_wdt_reset();
+
+        ret = reader_inflate(&reader, cur, row_size);
+        if (ret == 1)
+        {
+            ret = unfilter_row(cur[0], cur + 1, prev + 1, info->row_bytes, info->bpp);
+        }
+        if (ret == 1)
+        {
+            png_row_to_gray(info, cur + 1, gray);
+            write_gray_row(&target, y, gray, info->width);
+
+            uint8_t *swap = prev;
+            prev = cur;
+            cur = swap;
+        }
+    }
+    reader_end(&reader);
+
+    heap_caps_free(buffer);
+    free(info);
+    return ret;
+}
+
+
+int draw_gray4_from_buff(uint8_t *buff, uint32_t buff_size, Rect_t *area,
+                         uint8_t *framebuffer)
+{
+    if (!buff || buff_size == 0)
+    {
+        ESP_LOGE(TAG, "gray4 file is NULL");
+        return ESP_FAIL;
+    }
+
+    ImageSource src;
+    image_source_init_buffer(&src, buff, buff_size);
+    return draw_gray4_from_source(&src, area, framebuffer);
+}
+
+
+int draw_gray4_from_source(ImageSource *src, Rect_t *area, uint8_t *framebuffer)
+{
+    if (framebuffer == NULL)
+    {
+        ESP_LOGE(TAG, "framebuffer is NULL");
+        return ESP_FAIL;
+    }
+
+    uint8_t header[8];
+    if (image_source_read(src, header, sizeof(header)) != sizeof(header)
+            || memcmp(header, GRAY4_MAGIC, 4) != 0)
+    {
+        ESP_LOGE(TAG, "not a gray4 image!");
+        return ESP_FAIL;
+    }
+    uint32_t width = header[4] | (header[5] << 8);
+    uint32_t height = header[6] | (header[7] << 8);
+    area->width = width;
+    area->height = height;
+
+    uint32_t stride = (width + 1) / 2;
+    uint8_t *line = (uint8_t *)heap_caps_malloc(stride, MALLOC_CAP_8BIT);
+    if (line == NULL)
+    {
+        ESP_LOGE(TAG, "alloc gray4 row failed!");
+        return ESP_FAIL;
+    }
+
+    png_target_t target;
+    target_init(&target, framebuffer, area);
+    const png_target_t *t = &target;
+    // Rows can be inflated into the framebuffer if they are byte aligned
+    // and not clipped
+    bool direct = (t->x & 1) == 0 && t->x >= t->clip.x
+                  && t->x + (int32_t)width <= t->clip.x + t->clip.width;
+
+    inflate_reader_t reader;
+    int ret = reader_init(&reader, src, false, 0);
+    for (uint32_t y = 0; ret == 1 && y < height; y++)
+    {
+        esp_task_wdt_reset();
+
+        int32_t dy = t->y + y;
+        if (direct && dy >= t->clip.y && dy < t->clip.y + t->clip.height)
+        {
+            // The last byte of an odd width row is half padding
+            uint8_t *row = t->data + dy * t->stride + t->x / 2;
+            ret = reader_inflate(&reader, row, width / 2);
+            if (ret == 1 && (width & 1))
+            {
+                ret = reader_inflate(&reader, line, 1);
+                row[width / 2] = (row[width / 2] & 0xF0) | (line[0] & 0x0F);
+            }
+        }
+        else
+        {
+            ret = reader_inflate(&reader, line, stride);
+            if (ret == 1)
+            {
+                write_gray4_row(t, y, line, width);
+            }
+        }
+    }
+    reader_end(&reader);
+
+    heap_caps_free(line);
+    return ret;
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static int read_png_header(ImageSource *src, png_info_t *info,
+                           uint32_t *chunk_left)
+{
+    uint8_t buf[13];
+    if (image_source_read(src, buf, 8) != 8
+            || memcmp(buf, png_signature, 8) != 0)
+    {
+        ESP_LOGE(TAG, "not a png image!");
+        return ESP_FAIL;
+    }
+
+    memset(info, 0, sizeof(png_info_t));
+    for (int i = 0; i < 256; i++)
+    {
+        info->palette[i] = 255;
+    }
+
+    bool header = false;
+    while (true)
+    {
+        if (image_source_read(src, buf, 8) != 8)
+        {
+            ESP_LOGE(TAG, "png image has no data!");
+            return ESP_FAIL;
+        }
+        uint32_t length = read_be32(buf);
+        uint32_t type = read_be32(buf + 4);
+
+        if (type == PNG_IDAT)
+        {
+            if (!header)
+            {
+                break;
+            }
+            *chunk_left = length;
+            return 1;
+        }
+        else if (type == PNG_IHDR && length == 13)
+        {
+            if (image_source_read(src, buf, 13) != 13)
+            {
+                break;
+            }
+            info->width = read_be32(buf);
+            info->height = read_be32(buf + 4);
+            info->depth = buf[8];
+            info->color_type = buf[9];
+            if (buf[10] != 0 || buf[11] != 0)
+            {
+                ESP_LOGE(TAG, "unknown png compression or filter method!");
+                return ESP_FAIL;
+            }
+            if (buf[12] != 0)
+            {
+                ESP_LOGE(TAG, "interlaced png images are not supported!");
+                return ESP_FAIL;
+            }
+
+            uint32_t channels;
+            switch (info->color_type)
+            {
+            case PNG_COLOR_GRAY:       channels = 1; break;
+            case PNG_COLOR_RGB:        channels = 3; break;
+            case PNG_COLOR_PALETTE:    channels = 1; break;
+            case PNG_COLOR_GRAY_ALPHA: channels = 2; break;
+            case PNG_COLOR_RGBA:       channels = 4; break;
+            default:
+                ESP_LOGE(TAG, "unknown png color type %d!", info->color_type);
+                return ESP_FAIL;
+            }
+            bool sub_byte = info->color_type == PNG_COLOR_GRAY
+                            || info->color_type == PNG_COLOR_PALETTE;
+            if (!(info->depth == 8 || (info->depth == 16 && info->color_type != PNG_COLOR_PALETTE)
+                    || (sub_byte && (info->depth == 1 || info->depth == 2 || info->depth == 4))))
+            {
+                ESP_LOGE(TAG, "unsupported png bit depth %d!", info->depth);
+                return ESP_FAIL;
+            }
+            if (info->width == 0 || info->width > LIBPNG_MAX_WIDTH || info->height == 0)
+            {
+                ESP_LOGE(TAG, "unsupported png size %dx%d!", info->width, info->height);
+                return ESP_FAIL;
+            }
+
+            uint32_t bits = channels * info->depth;
+            info->row_bytes = (info->width * bits + 7) / 8;
+            info->bpp = bits >= 8 ? bits / 8 : 1;
+            header = true;
+        }
+        else if (type == PNG_PLTE && length <= 3 * 256 && length % 3 == 0)
+        {
+            for (uint32_t i = 0; i < length / 3; i++)
+            {
+                if (image_source_read(src, buf, 3) != 3)
+                {
+                    break;
+                }
+                info->palette[i] = (buf[0] * 38 + buf[1] * 75 + buf[2] * 15) >> 7;
+            }
+        }
+        else if (type == PNG_TRNS && info->color_type == PNG_COLOR_PALETTE
+                 && length <= 256)
+        {
+            for (uint32_t i = 0; i < length; i++)
+            {
+                if (image_source_read(src, buf, 1) != 1)
+                {
+                    break;
+                }
+                info->palette[i] = blend_white(info->palette[i], buf[0]);
+            }
+        }
+        else if (type == PNG_TRNS && (info->color_type == PNG_COLOR_GRAY
+                                      || info->color_type == PNG_COLOR_RGB)
+                 && length <= 6 && length % 2 == 0)
+        {
+            if (image_source_read(src, buf, length) != length)
+            {
+                break;
+            }
+            for (uint32_t i = 0; i < length / 2; i++)
+            {
+                info->trns[i] = (buf[2 * i] << 8) | buf[2 * i + 1];
+            }
+            info->has_trns = true;
+        }
+        else
+        {
+            image_source_read(src, NULL, length);
+        }
+
+        // CRC, the zlib stream has its own checksum
+        image_source_read(src, NULL, 4);
+    }
+
+    ESP_LOGE(TAG, "bad png header!");
+    return ESP_FAIL;
+}
+
+
+static int reader_init(inflate_reader_t *r, ImageSource *src, bool png,
+                       uint32_t chunk_left)
+{
+    memset(r, 0, sizeof(inflate_reader_t));
+    r->src = src;
+    r->png = png;
+    r->chunk_left = chunk_left;
+
+    r->in = (uint8_t *)malloc(LIBPNG_INPUT_SIZE);
+    if (r->in == NULL)
+    {
+        ESP_LOGE(TAG, "alloc inflate input failed!");
+        return ESP_FAIL;
+    }
+    if (inflateInit(&r->zs) != Z_OK)
+    {
+        ESP_LOGE(TAG, "inflate init failed!");
+        free(r->in);
+        r->in = NULL;
+        return ESP_FAIL;
+    }
+    return 1;
+}
+
+
+static void reader_end(inflate_reader_t *r)
+{
+    if (r->in != NULL)
+    {
+        inflateEnd(&r->zs);
+        free(r->in);
+        r->in = NULL;
+    }
+}
+
+
+static int reader_inflate(inflate_reader_t *r, uint8_t *out, size_t len)
+{
+    r->zs.next_out = out;
+    r->zs.avail_out = len;
+    while (r->zs.avail_out > 0)
+    {
+        if (r->zs.avail_in == 0)
+        {
+            r->zs.avail_in = reader_fill(r);
+            r->zs.next_in = r->in;
+            if (r->zs.avail_in == 0)
+            {
+                ESP_LOGE(TAG, "image data ends early!");
+                return ESP_FAIL;
+            }
+        }
+
+        int ret = inflate(&r->zs, Z_NO_FLUSH);
+        if (ret == Z_STREAM_END && r->zs.avail_out > 0)
+        {
+            ESP_LOGE(TAG, "image data ends early!");
+            return ESP_FAIL;
+        }
+        if (ret != Z_OK && ret != Z_STREAM_END)
+        {
+            ESP_LOGE(TAG, "inflate error: %d", ret);
+            return ESP_FAIL;
+        }
+    }
+    return 1;
+}
+
+
+static size_t reader_fill(inflate_reader_t *r)
+{
+    if (!r->png)
+    {
+        return image_source_read(r->src, r->in, LIBPNG_INPUT_SIZE);
+    }
+
+    while (r->chunk_left == 0)
+    {
+        // CRC of the last IDAT, and the next chunk which must be an IDAT
+        uint8_t buf[8];
+        image_source_read(r->src, NULL, 4);
+        if (image_source_read(r->src, buf, 8) != 8
+                || read_be32(buf + 4) != PNG_IDAT)
+        {
+            return 0;
+        }
+        r->chunk_left = read_be32(buf);
+    }
+
+    size_t n = r->chunk_left < LIBPNG_INPUT_SIZE ? r->chunk_left : LIBPNG_INPUT_SIZE;
+    n = image_source_read(r->src, r->in, n);
+    r->chunk_left -= n;
+    return n;
+}
+
+
+static int unfilter_row(uint8_t filter, uint8_t *row, const uint8_t *prev,
+                        uint32_t row_bytes, uint32_t bpp)
+{
+    uint32_t i;
+    switch (filter)
+    {
+    case 0: // None
+        break;
+    case 1: // Sub
+        for (i = bpp; i < row_bytes; i++)
+        {
+            row[i] += row[i - bpp];
+        }
+        break;
+    case 2: // Up
+        for (i = 0; i < row_bytes; i++)
+        {
+            row[i] += prev[i];
+        }
+        break;
+    case 3: // Average
+        for (i = 0; i < bpp; i++)
+        {
+            row[i] += prev[i] / 2;
+        }
+        for (; i < row_bytes; i++)
+        {
+            row[i] += (row[i - bpp] + prev[i]) / 2;
+        }
+        break;
+    case 4: // Paeth
+        for (i = 0; i < bpp; i++)
+        {
+            row[i] += prev[i];
+        }
+        for (; i < row_bytes; i++)
+        {
+            int32_t a = row[i - bpp];
+            int32_t b = prev[i];
+            int32_t c = prev[i - bpp];
+            int32_t pa = abs(b - c);
+            int32_t pb = abs(a - c);
+            int32_t pc = abs(a + b - 2 * c);
+            row[i] += (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+        }
+        break;
+    default:
+        ESP_LOGE(TAG, "unknown png filter %d!", filter);
+        return ESP_FAIL;
+    }
+    return 1;
+}
+
+
+static void png_row_to_gray(const png_info_t *info, const uint8_t *row,
+                            uint8_t *gray)
+{
+    uint32_t width = info->width;
+    uint32_t depth = info->depth;
+
+    if (depth < 8)
+    {
+        // Gray or palette, packed from the high bits down
+        uint32_t mask = (1 << depth) - 1;
+        uint32_t scale = 255 / mask;
+        for (uint32_t x = 0; x < width; x++)
+        {
+            uint32_t bit = x * depth;
+            uint32_t v = (row[bit / 8] >> (8 - depth - bit % 8)) & mask;
+            if (info->color_type == PNG_COLOR_PALETTE)
+            {
+                gray[x] = info->palette[v];
+            }
+            else
+            {
+                gray[x] = (info->has_trns && v == info->trns[0]) ? 255 : v * scale;
+            }
+        }
+        return;
+    }
+
+    // Samples are one or two bytes, big endian, only the high byte is used
+    uint32_t step = depth / 8;
+    for (uint32_t x = 0; x < width; x++)
+    {
+        switch (info->color_type)
+        {
+        case PNG_COLOR_PALETTE:
+            gray[x] = info->palette[row[0]];
+            break;
+        case PNG_COLOR_GRAY:
+        {
+            uint32_t v = step == 2 ? (row[0] << 8) | row[1] : row[0];
+            gray[x] = (info->has_trns && v == info->trns[0]) ? 255 : row[0];
+            break;
+        }
+        case PNG_COLOR_GRAY_ALPHA:
+            gray[x] = blend_white(row[0], row[step]);
+            break;
+        case PNG_COLOR_RGB:
+        {
+            uint32_t r = row[0], g = row[step], b = row[2 * step];
+            gray[x] = (r * 38 + g * 75 + b * 15) >> 7;
+            if (info->has_trns)
+            {
+                uint32_t rv = step == 2 ? (r << 8) | row[1] : r;
+                uint32_t gv = step == 2 ? (g << 8) | row[3] : g;
+                uint32_t bv = step == 2 ? (b << 8) | row[5] : b;
+                if (rv == info->trns[0] && gv == info->trns[1] && bv == info->trns[2])
+                {
+                    gray[x] = 255;
+                }
+            }
+            break;
+        }
+        case PNG_COLOR_RGBA:
+        {
+            uint32_t r = row[0], g = row[step], b = row[2 * step];
+            gray[x] = blend_white((r * 38 + g * 75 + b * 15) >> 7, row[3 * step]);
+            break;
+        }
+        }
+        row += info->bpp;
+    }
+}
+
+
+static void write_gray_row(const png_target_t *t, int32_t oy,
+                           const uint8_t *gray, uint32_t width)
+{
+    int32_t y = t->y + oy;
+    if (y < t->clip.y || y >= t->clip.y + t->clip.height) return;
+
+    int32_t start = t->clip.x - t->x;
+    int32_t end = t->clip.x + t->clip.width - t->x;
+    if (start < 0) start = 0;
+    if (end > (int32_t)width) end = width;
+
+    uint8_t *row = t->data + y * t->stride;
+    for (int32_t i = start; i < end; i++)
+    {
+        int32_t x = t->x + i;
+        uint8_t *buf_ptr = &row[x / 2];
+        if (x % 2) {
+            *buf_ptr = (*buf_ptr & 0x0F) | (gray[i] & 0xF0);
+        } else {
+            *buf_ptr = (*buf_ptr & 0xF0) | (gray[i] >> 4);
+        }
+    }
+}
+
+
+static void write_gray4_row(const png_target_t *t, int32_t oy,
+                            const uint8_t *packed, uint32_t width)
+{
+    int32_t y = t->y + oy;
+    if (y < t->clip.y || y >= t->clip.y + t->clip.height) return;
+
+    int32_t start = t->clip.x - t->x;
+    int32_t end = t->clip.x + t->clip.width - t->x;
+    if (start < 0) start = 0;
+    if (end > (int32_t)width) end = width;
+
+    uint8_t *row = t->data + y * t->stride;
+    for (int32_t i = start; i < end; i++)
+    {
+        int32_t x = t->x + i;
+        uint8_t nibble = (i % 2) ? packed[i / 2] >> 4 : packed[i / 2] & 0x0F;
+        uint8_t *buf_ptr = &row[x / 2];
+        if (x % 2) {
+            *buf_ptr = (*buf_ptr & 0x0F) | (nibble << 4);
+        } else {
+            *buf_ptr = (*buf_ptr & 0xF0) | nibble;
+        }
+    }
+}
+
+
+static void target_init(png_target_t *t, uint8_t *framebuffer, Rect_t *area)
+{
+    t->data = framebuffer;
+    t->stride = EPD_WIDTH / 2;
+    t->x = area->x;
+    t->y = area->y;
+    t->clip = epd_full_screen();
+}
+
+
+static inline uint8_t blend_white(uint32_t gray, uint32_t alpha)
+{
+    return (gray * alpha + 255 * (255 - alpha) + 127) / 255;
+}
+
+
+static inline uint32_t read_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
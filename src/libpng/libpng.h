@@ -0,0 +1,89 @@
+#ifndef LIB_PNG_H
+#define LIB_PNG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+#include "image_source.h"
+
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Compressed bytes read from the source at a time.
+ */
+#define LIBPNG_INPUT_SIZE 512
+
+/**
+ * @brief Magic bytes of the packed 4bpp format.
+ *
+ * @note The format is the magic, width and height as little endian uint16_t,
+ *       and a zlib stream of the rows. A row is (width + 1) / 2 bytes in
+ *       framebuffer order: the low nibble is the even pixel, 0xF is white.
+ */
+#define GRAY4_MAGIC "G4Z1"
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Decode a PNG image straight into a 4bpp framebuffer.
+ *
+ * @note Rows are inflated and written one at a time. Working memory is two
+ *       PNG rows plus the zlib window, never the whole image. All color
+ *       types are read at all bit depths; color is turned to gray and
+ *       transparency is blended onto white. Interlaced images are not
+ *       supported. Pixels outside of the screen are clipped.
+ *
+ * @param area        The image's top left corner goes to area->x, area->y.
+ *                    Width and height are set to the size of the image.
+ * @param framebuffer A EPD_WIDTH x EPD_HEIGHT 4bpp framebuffer.
+ * @return 1 on success, ESP_FAIL otherwise.
+ */
+int draw_png_from_buff(uint8_t *buff, uint32_t buff_size, Rect_t *area,
+                       uint8_t *framebuffer);
+
+/**
+ * @brief Same as draw_png_from_buff(), reading the image from `src`.
+ */
+int draw_png_from_source(ImageSource *src, Rect_t *area, uint8_t *framebuffer);
+
+/**
+ * @brief Decode a packed 4bpp image (see GRAY4_MAGIC) into a framebuffer.
+ *
+ * @note Rows at an even x are inflated straight into the framebuffer.
+ */
+int draw_gray4_from_buff(uint8_t *buff, uint32_t buff_size, Rect_t *area,
+                         uint8_t *framebuffer);
+
+/**
+ * @brief Same as draw_gray4_from_buff(), reading the image from `src`.
+ */
+int draw_gray4_from_source(ImageSource *src, Rect_t *area, uint8_t *framebuffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -6,11 +6,17 @@
 #include "rmt_pulse.h"
 
 #include <driver/rmt.h>
+#include <freertos/FreeRTOS.h>
 
 /******************************************************************************/
 /***        macro definitions                                               ***/
 /******************************************************************************/
 
+/**
+ * @brief Maximum number of pulses sent in one RMT transaction.
+ */
+#define PULSE_BATCH_SIZE 128
+
 /******************************************************************************/
 /***        type definitions                                                ***/
 /******************************************************************************/
@@ -39,6 +45,14 @@
  */
 static rmt_config_t row_rmt_config;
 
+/**
+ * @brief Items of batched pulses. The RMT driver reads from here while
+ *        transmitting, so it is only refilled when the pulse shape changes.
+ */
+static rmt_item32_t pulse_batch[PULSE_BATCH_SIZE];
+static uint16_t pulse_batch_high = 0;
+static uint16_t pulse_batch_low = 0;
+
 /**
  * @brief keep track of wether the current pulse is ongoing
  */
@@ -110,6 +124,33 @@ void IRAM_ATTR pulse_ckv_ticks(uint16_t high_time_ticks,
 }
 
 
+void IRAM_ATTR pulse_ckv_repeat(uint16_t high_time_ticks, uint16_t low_time_ticks,
+                                uint32_t count, bool wait)
+{
+    if (high_time_ticks != pulse_batch_high || low_time_ticks != pulse_batch_low)
+    {
+        // the previous batch may still be read by the driver
+        rmt_wait_tx_done(row_rmt_config.channel, portMAX_DELAY);
+        for (uint32_t i = 0; i < PULSE_BATCH_SIZE; i++)
+        {
+            pulse_batch[i].level0 = 1;
+            pulse_batch[i].duration0 = high_time_ticks;
+            pulse_batch[i].level1 = 0;
+            pulse_batch[i].duration1 = low_time_ticks;
+        }
+        pulse_batch_high = high_time_ticks;
+        pulse_batch_low = low_time_ticks;
+    }
+
+    while (count > 0)
+    {
+        uint32_t n = count < PULSE_BATCH_SIZE ? count : PULSE_BATCH_SIZE;
+        count -= n;
+        rmt_write_items(row_rmt_config.channel, pulse_batch, n, wait || count > 0);
+    }
+}
+
+
 void IRAM_ATTR pulse_ckv_us(uint16_t high_time_us, uint16_t low_time_us, bool wait)
 {
     pulse_ckv_ticks(10 * high_time_us, 10 * low_time_us, wait);
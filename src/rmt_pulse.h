@@ -68,6 +68,20 @@ bool IRAM_ATTR rmt_busy();
  */
 void IRAM_ATTR pulse_ckv_ticks(uint16_t high_time_us, uint16_t low_time_us, bool wait);
 
+/**
+ * @brief Outputs `count` identical pulses (high -> low) in as few RMT
+ *        transactions as possible.
+ *
+ * @note Both times must be non-zero.
+ *
+ * @param high_time_ticks Pulse high time in clock ticks.
+ * @param low_time_ticks  Pulse low time in clock ticks.
+ * @param count           Number of pulses.
+ * @param wait            Block until the pulses are finished.
+ */
+void IRAM_ATTR pulse_ckv_repeat(uint16_t high_time_ticks, uint16_t low_time_ticks,
+                                uint32_t count, bool wait);
+
 #ifdef __cplusplus
 }
 #endif
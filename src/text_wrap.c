@@ -0,0 +1,250 @@
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "text_wrap.h"
+
+#include <esp_log.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief U+2026 HORIZONTAL ELLIPSIS, and what is used if a font lacks it.
+ */
+#define ELLIPSIS "\xE2\x80\xA6"
+#define ELLIPSIS_CODE_POINT 0x2026
+#define ELLIPSIS_FALLBACK "..."
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief The window of the string currently laid out.
+ */
+typedef struct
+{
+    const char *start;    /** First byte laid out */
+    uint32_t    consumed; /** Bytes laid out */
+    bool        complete; /** The window reaches the end of the string */
+    TextLayout  layout;
+} wrap_window_t;
+
+/******************************************************************************/
+/***        local function prototypes                                       ***/
+/******************************************************************************/
+
+/**
+ * @brief Lay out as much of the string as fits into `glyphs`, from `start`.
+ */
+static void layout_window(wrap_window_t *window, const char *start,
+                          GlyphRef *glyphs, const FontProperties *props);
+
+/**
+ * @brief Find the end of the line starting at glyph `first`.
+ *
+ * @param end  First glyph after the line.
+ * @param next First glyph of the following line.
+ * @return false if the glyphs ran out before the line was full.
+ */
+static bool find_break(const TextLayout *layout, uint32_t first,
+                       int32_t max_width, uint32_t *end, uint32_t *next);
+
+/**
+ * @brief Shorten the line [first, end) until an ellipsis fits behind it.
+ *
+ * @return The new end of the line.
+ */
+static uint32_t fit_ellipsis(const TextLayout *layout, uint32_t first,
+                             uint32_t end, int32_t max_width,
+                             const TextLayout *ellipsis);
+
+static inline bool is_space(const GlyphRef *glyph);
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        local variables                                                 ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+int32_t write_text_wrapped(const GFXfont *font,
+                           const char *string,
+                           int32_t x,
+                           int32_t y,
+                           const TextWrap *wrap,
+                           uint8_t *framebuffer,
+                           const FontProperties *props)
+{
+    if (framebuffer == NULL)
+    {
+        ESP_LOGE("text_wrap.c", "cannot wrap text without a framebuffer!");
+        return y;
+    }
+    int32_t line_height = wrap->line_height > 0 ? wrap->line_height
+                                                : font->advance_y;
+
+    GlyphRef glyphs[TEXT_WRAP_MAX_GLYPHS];
+    wrap_window_t window;
+    window.layout.font = font;
+    layout_window(&window, string, glyphs, props);
+    TextLayout *layout = &window.layout;
+
+    uint32_t first = 0;
+    int32_t lines = 0;
+    while (wrap->max_lines <= 0 || lines < wrap->max_lines)
+    {
+        while (first < layout->count && is_space(&layout->glyphs[first]))
+        {
+            first++;
+        }
+        if (first == layout->count)
+        {
+            if (window.complete)
+            {
+                break;
+            }
+            layout_window(&window, window.start + window.consumed, glyphs, props);
+            first = 0;
+            continue;
+        }
+
+        uint32_t end, next;
+        if (!find_break(layout, first, wrap->max_width, &end, &next)
+                && !window.complete && first > 0)
+        {
+            // lay out again from the start of this line
+            layout_window(&window, window.start + layout->glyphs[first].offset,
+                          glyphs, props);
+            first = 0;
+            continue;
+        }
+
+        bool more = !window.complete;
+        for (uint32_t i = next; i < layout->count && !more; i++)
+        {
+            more = !is_space(&layout->glyphs[i]);
+        }
+
+        int32_t cursor_x = x;
+        int32_t cursor_y = y;
+        TextLayout slice;
+        if (more && lines + 1 == wrap->max_lines)
+        {
+            GlyphRef ellipsis_glyphs[3];
+            GFXglyph *glyph;
+            get_glyph(font, ELLIPSIS_CODE_POINT, &glyph);
+            TextLayout ellipsis;
+            layout_text(font, glyph ? ELLIPSIS : ELLIPSIS_FALLBACK,
+                        ellipsis_glyphs, 3, &ellipsis, props);
+
+            end = fit_ellipsis(layout, first, end, wrap->max_width, &ellipsis);
+            layout_slice(layout, first, end - first, &slice, props);
+            write_layout(&slice, &cursor_x, &cursor_y, framebuffer, BLACK_ON_WHITE, props);
+            write_layout(&ellipsis, &cursor_x, &cursor_y, framebuffer, BLACK_ON_WHITE, props);
+        }
+        else
+        {
+            layout_slice(layout, first, end - first, &slice, props);
+            write_layout(&slice, &cursor_x, &cursor_y, framebuffer, BLACK_ON_WHITE, props);
+        }
+
+        y += line_height;
+        lines++;
+        first = next;
+    }
+    return y;
+}
+
+/******************************************************************************/
+/***        local functions                                                 ***/
+/******************************************************************************/
+
+static void layout_window(wrap_window_t *window, const char *start,
+                          GlyphRef *glyphs, const FontProperties *props)
+{
+    window->start = start;
+    window->consumed = layout_text(window->layout.font, start, glyphs,
+                                   TEXT_WRAP_MAX_GLYPHS, &window->layout, props);
+    window->complete = start[window->consumed] == '\0';
+}
+
+
+static bool find_break(const TextLayout *layout, uint32_t first,
+                       int32_t max_width, uint32_t *end, uint32_t *next)
+{
+    int32_t start = layout->glyphs[first].x;
+    uint32_t space = first;
+    for (uint32_t i = first; i < layout->count; i++)
+    {
+        const GlyphRef *ref = &layout->glyphs[i];
+        if (is_space(ref))
+        {
+            space = i;
+            continue;
+        }
+        int32_t right = ref->x - start + ref->glyph->left + ref->glyph->width;
+        if (right > max_width && i > first)
+        {
+            if (space > first)
+            {
+                *end = space;
+                *next = space + 1;
+            }
+            else
+            {
+                // no space to break at, break the word
+                *end = i;
+                *next = i;
+            }
+            while (*end > first && is_space(&layout->glyphs[*end - 1]))
+            {
+                (*end)--;
+            }
+            return true;
+        }
+    }
+    *end = layout->count;
+    *next = layout->count;
+    return false;
+}
+
+
+static uint32_t fit_ellipsis(const TextLayout *layout, uint32_t first,
+                             uint32_t end, int32_t max_width,
+                             const TextLayout *ellipsis)
+{
+    int32_t start = layout->glyphs[first].x;
+    int32_t ellipsis_right = ellipsis->bounds.x + ellipsis->bounds.width;
+    while (end > first)
+    {
+        const GlyphRef *last = &layout->glyphs[end - 1];
+        int32_t cursor = last->x + last->glyph->advance_x - start;
+        if (!is_space(last) && cursor + ellipsis_right <= max_width)
+        {
+            break;
+        }
+        end--;
+    }
+    return end;
+}
+
+
+static inline bool is_space(const GlyphRef *glyph)
+{
+    return glyph->code_point == ' ';
+}
+
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
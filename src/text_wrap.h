@@ -0,0 +1,72 @@
+#ifndef _TEXT_WRAP_H_
+#define _TEXT_WRAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+/***        include files                                                   ***/
+/******************************************************************************/
+
+#include "epd_driver.h"
+
+#include <stdint.h>
+
+/******************************************************************************/
+/***        macro definitions                                               ***/
+/******************************************************************************/
+
+/**
+ * @brief Glyphs laid out at a time. Lines with more glyphs than this are
+ *        broken early. The glyph buffer lives on the stack.
+ */
+#define TEXT_WRAP_MAX_GLYPHS 128
+
+/******************************************************************************/
+/***        type definitions                                                ***/
+/******************************************************************************/
+
+/**
+ * @brief Line breaking parameters.
+ */
+typedef struct
+{
+    int32_t max_width;   /** Line width in pixels */
+    int32_t line_height; /** Distance between base lines, 0 for the font's advance_y */
+    int32_t max_lines;   /** Maximum number of lines, 0 for no limit */
+} TextWrap;
+
+/******************************************************************************/
+/***        exported variables                                              ***/
+/******************************************************************************/
+
+/******************************************************************************/
+/***        exported functions                                              ***/
+/******************************************************************************/
+
+/**
+ * @brief Write text to a framebuffer, broken into lines at spaces.
+ *
+ * @note Each glyph is looked up once. Words wider than a line are broken
+ *       between glyphs. If the text needs more than `max_lines` lines, the
+ *       last line ends with an ellipsis. Nothing is allocated on the heap.
+ *
+ * @param x           Start of the lines.
+ * @param y           Base line of the first line.
+ * @param framebuffer The framebuffer to draw to, must not be NULL.
+ * @param props       Font properties, NULL for the defaults.
+ * @return The base line below the last line written.
+ */
+int32_t write_text_wrapped(const GFXfont *font, const char *string,
+                           int32_t x, int32_t y, const TextWrap *wrap,
+                           uint8_t *framebuffer, const FontProperties *props);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/******************************************************************************/
+/***        END OF FILE                                                     ***/
+/******************************************************************************/
@@ -0,0 +1,59 @@
+#pragma once
+/*
+ * Timing for the host benchmarks. Results are host numbers: compare the
+ * rows of one run with each other, not with the ESP32-S3.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+/** Shortest time a measurement runs for, in seconds. */
+#define BENCH_MIN_TIME 0.02
+
+/** Measurements taken, the fastest one counts. */
+#define BENCH_ROUNDS 5
+
+static inline double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * Call `fn(arg)` until BENCH_MIN_TIME has passed, doubling the number of
+ * calls each time, then measure that many calls BENCH_ROUNDS times.
+ * Returns seconds per call of the fastest round.
+ */
+static inline double bench_run(void (*fn)(void *), void *arg)
+{
+    uint32_t calls = 1;
+    double best;
+    for (;; calls *= 2)
+    {
+        double start = bench_now();
+        for (uint32_t i = 0; i < calls; i++)
+        {
+            fn(arg);
+        }
+        best = bench_now() - start;
+        if (best >= BENCH_MIN_TIME)
+        {
+            break;
+        }
+    }
+    for (uint32_t round = 1; round < BENCH_ROUNDS; round++)
+    {
+        double start = bench_now();
+        for (uint32_t i = 0; i < calls; i++)
+        {
+            fn(arg);
+        }
+        double elapsed = bench_now() - start;
+        if (elapsed < best)
+        {
+            best = elapsed;
+        }
+    }
+    return best / calls;
+}
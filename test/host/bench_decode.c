@@ -0,0 +1,132 @@
+/*
+ * Decoding a screen of JPEG thumbnails with one context, against two
+ * threads with a context each, the way the two ESP32-S3 cores would.
+ * Both must draw the same screen.
+ */
+
+#include "bench.h"
+#include "epd_driver.h"
+#include "libjpeg/libjpeg.h"
+#include "test_images.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TILE_W   240
+#define TILE_H   180
+#define TILES    ((EPD_WIDTH / TILE_W) * (EPD_HEIGHT / TILE_H))
+#define THREADS  2
+
+typedef struct
+{
+    uint8_t *jpeg[TILES];
+    size_t   size[TILES];
+    uint8_t *framebuffer;
+} decode_job_t;
+
+typedef struct
+{
+    decode_job_t  *job;
+    libjpeg_ctx_t *ctx;
+    uint32_t       first;
+    uint32_t       step;
+    int            failed;
+} decode_worker_t;
+
+static uint8_t fb_sequential[EPD_WIDTH / 2 * EPD_HEIGHT];
+static uint8_t fb_parallel[EPD_WIDTH / 2 * EPD_HEIGHT];
+
+static void *decode_tiles(void *arg)
+{
+    decode_worker_t *w = (decode_worker_t *)arg;
+    for (uint32_t i = w->first; i < TILES; i += w->step)
+    {
+        ImageSource src;
+        image_source_init_buffer(&src, w->job->jpeg[i], w->job->size[i]);
+        Rect_t area = {
+            .x = (i % (EPD_WIDTH / TILE_W)) * TILE_W,
+            .y = (i / (EPD_WIDTH / TILE_W)) * TILE_H,
+        };
+        if (libjpeg_ctx_draw(w->ctx, &src, &area, w->job->framebuffer) != 1)
+        {
+            w->failed = 1;
+        }
+    }
+    return NULL;
+}
+
+static libjpeg_ctx_t *contexts[THREADS];
+
+static void run_sequential(void *arg)
+{
+    decode_job_t *job = (decode_job_t *)arg;
+    decode_worker_t w = { .job = job, .ctx = contexts[0], .first = 0, .step = 1 };
+    job->framebuffer = fb_sequential;
+    decode_tiles(&w);
+}
+
+static void run_parallel(void *arg)
+{
+    decode_job_t *job = (decode_job_t *)arg;
+    decode_worker_t w[THREADS];
+    pthread_t threads[THREADS];
+
+    job->framebuffer = fb_parallel;
+    for (uint32_t t = 0; t < THREADS; t++)
+    {
+        w[t] = (decode_worker_t){ .job = job, .ctx = contexts[t], .first = t, .step = THREADS };
+        pthread_create(&threads[t], NULL, decode_tiles, &w[t]);
+    }
+    for (uint32_t t = 0; t < THREADS; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+}
+
+int main(void)
+{
+    decode_job_t job;
+    size_t total = 0;
+
+    for (uint32_t i = 0; i < TILES; i++)
+    {
+        uint8_t *pixels = test_image(TILE_W, TILE_H, 3, i);
+        job.size[i] = test_jpeg_encode(pixels, TILE_W, TILE_H, 3, 85, &job.jpeg[i]);
+        total += job.size[i];
+        free(pixels);
+    }
+    for (uint32_t t = 0; t < THREADS; t++)
+    {
+        contexts[t] = libjpeg_ctx_create();
+    }
+
+    memset(fb_sequential, 0xFF, sizeof(fb_sequential));
+    memset(fb_parallel, 0xFF, sizeof(fb_parallel));
+    double t_seq = bench_run(run_sequential, &job);
+    double t_par = bench_run(run_parallel, &job);
+    int failed = memcmp(fb_sequential, fb_parallel, sizeof(fb_sequential)) != 0;
+    if (failed)
+    {
+        printf("the threads drew a different screen\n");
+    }
+
+    printf("%d thumbnails of %dx%d, %zu bytes of JPEG, %ld host CPUs\n",
+           TILES, TILE_W, TILE_H, total, sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-22s %10s %12s\n", "decode", "ms/screen", "ms/thumbnail");
+    printf("%-22s %10.2f %12.2f\n", "1 context", t_seq * 1e3, t_seq * 1e3 / TILES);
+    printf("%-22s %10.2f %12.2f\n", "2 threads, 2 contexts", t_par * 1e3, t_par * 1e3 / TILES);
+    printf("speedup %.2fx\n", t_seq / t_par);
+
+    for (uint32_t t = 0; t < THREADS; t++)
+    {
+        libjpeg_ctx_destroy(contexts[t]);
+    }
+    for (uint32_t i = 0; i < TILES; i++)
+    {
+        free(job.jpeg[i]);
+    }
+    return failed;
+}
@@ -0,0 +1,69 @@
+/*
+ * Cost of each dither mode when decoding a full screen JPEG, drawn at its
+ * own size and shrunk from twice the screen size.
+ */
+
+#include "bench.h"
+#include "epd_driver.h"
+#include "libjpeg/libjpeg.h"
+#include "test_images.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct
+{
+    libjpeg_ctx_t *ctx;
+    uint8_t       *jpeg;
+    size_t         size;
+    int            scaled;
+} dither_case_t;
+
+static uint8_t framebuffer[EPD_WIDTH / 2 * EPD_HEIGHT];
+
+static void run_decode(void *arg)
+{
+    dither_case_t *c = (dither_case_t *)arg;
+    ImageSource src;
+    image_source_init_buffer(&src, c->jpeg, c->size);
+    if (c->scaled)
+    {
+        libjpeg_ctx_draw_scaled(c->ctx, &src, epd_full_screen(), JPEG_SCALE_FIT, framebuffer);
+    }
+    else
+    {
+        Rect_t area = epd_full_screen();
+        libjpeg_ctx_draw(c->ctx, &src, &area, framebuffer);
+    }
+}
+
+int main(void)
+{
+    static const JpegDither_t modes[] = {
+        JPEG_DITHER_NONE, JPEG_DITHER_BAYER, JPEG_DITHER_ERROR_DIFFUSION
+    };
+    static const char *names[] = { "none", "bayer", "error diffusion" };
+    dither_case_t screen = { .ctx = libjpeg_ctx_create() };
+    dither_case_t large = { .ctx = screen.ctx, .scaled = 1 };
+
+    uint8_t *pixels = test_image(EPD_WIDTH, EPD_HEIGHT, 3, 1);
+    screen.size = test_jpeg_encode(pixels, EPD_WIDTH, EPD_HEIGHT, 3, 85, &screen.jpeg);
+    free(pixels);
+    pixels = test_image(EPD_WIDTH * 2, EPD_HEIGHT * 2, 3, 1);
+    large.size = test_jpeg_encode(pixels, EPD_WIDTH * 2, EPD_HEIGHT * 2, 3, 85, &large.jpeg);
+    free(pixels);
+
+    printf("%-16s %14s %14s\n", "dither", "960x540 ms", "1920x1080 ms");
+    for (uint32_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        libjpeg_ctx_set_dither(screen.ctx, modes[m]);
+        double t_screen = bench_run(run_decode, &screen);
+        double t_large = bench_run(run_decode, &large);
+        printf("%-16s %14.2f %14.2f\n", names[m], t_screen * 1e3, t_large * 1e3);
+    }
+
+    libjpeg_ctx_destroy(screen.ctx);
+    free(screen.jpeg);
+    free(large.jpeg);
+    return 0;
+}
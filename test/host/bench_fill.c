@@ -0,0 +1,191 @@
+/*
+ * Span fills against the per-pixel path they replaced, in pixels per
+ * second. Both must leave the same framebuffer.
+ */
+
+#include "bench.h"
+#include "epd_driver.h"
+
+#include <stdio.h>
+#include <string.h>
+
+typedef struct
+{
+    const char *name;
+    int32_t     x, y, w, h; /* rectangle, or center and radius in x, y, w */
+    int         circle;
+    uint8_t    *framebuffer;
+    int         old;
+} fill_case_t;
+
+static uint8_t fb_new[EPD_WIDTH / 2 * EPD_HEIGHT];
+static uint8_t fb_old[EPD_WIDTH / 2 * EPD_HEIGHT];
+
+/* epd_draw_pixel(), epd_draw_vline(), epd_fill_rect() and epd_fill_circle() as they were */
+static void old_draw_pixel(int32_t x, int32_t y, uint8_t color, uint8_t *framebuffer)
+{
+    if (x < 0 || x >= EPD_WIDTH)
+    {
+        return;
+    }
+    if (y < 0 || y >= EPD_HEIGHT)
+    {
+        return;
+    }
+    uint8_t *buf_ptr = &framebuffer[y * EPD_WIDTH / 2 + x / 2];
+    if (x % 2)
+    {
+        *buf_ptr = (*buf_ptr & 0x0F) | (color & 0xF0);
+    }
+    else
+    {
+        *buf_ptr = (*buf_ptr & 0xF0) | (color >> 4);
+    }
+}
+
+static void old_draw_vline(int32_t x, int32_t y, int32_t length, uint8_t color, uint8_t *framebuffer)
+{
+    for (int32_t i = 0; i < length; i++)
+    {
+        old_draw_pixel(x, y + i, color, framebuffer);
+    }
+}
+
+static void old_fill_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t color, uint8_t *framebuffer)
+{
+    for (int32_t i = x; i < x + w; i++)
+    {
+        old_draw_vline(i, y, h, color, framebuffer);
+    }
+}
+
+static void old_fill_circle(int32_t x0, int32_t y0, int32_t r, uint8_t color, uint8_t *framebuffer)
+{
+    old_draw_vline(x0, y0 - r, 2 * r + 1, color, framebuffer);
+
+    int32_t f = 1 - r;
+    int32_t ddF_x = 1;
+    int32_t ddF_y = -2 * r;
+    int32_t x = 0;
+    int32_t y = r;
+    int32_t px = x;
+    int32_t py = y;
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if (x < (y + 1))
+        {
+            old_draw_vline(x0 + x, y0 - y, 2 * y + 1, color, framebuffer);
+            old_draw_vline(x0 - x, y0 - y, 2 * y + 1, color, framebuffer);
+        }
+        if (y != py)
+        {
+            old_draw_vline(x0 + py, y0 - px, 2 * px + 1, color, framebuffer);
+            old_draw_vline(x0 - py, y0 - px, 2 * px + 1, color, framebuffer);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+static void run_case(void *arg)
+{
+    fill_case_t *c = (fill_case_t *)arg;
+    static uint8_t color;
+    color += 0x10;
+    if (c->circle)
+    {
+        if (c->old)
+            old_fill_circle(c->x, c->y, c->w, color, c->framebuffer);
+        else
+            epd_fill_circle(c->x, c->y, c->w, color, c->framebuffer);
+    }
+    else
+    {
+        if (c->old)
+            old_fill_rect(c->x, c->y, c->w, c->h, color, c->framebuffer);
+        else
+            epd_fill_rect(c->x, c->y, c->w, c->h, color, c->framebuffer);
+    }
+}
+
+static int64_t covered_pixels(fill_case_t *c)
+{
+    memset(fb_new, 0xFF, sizeof(fb_new));
+    if (c->circle)
+        epd_fill_circle(c->x, c->y, c->w, 0x00, fb_new);
+    else
+        epd_fill_rect(c->x, c->y, c->w, c->h, 0x00, fb_new);
+
+    int64_t n = 0;
+    for (uint32_t i = 0; i < sizeof(fb_new); i++)
+    {
+        n += (fb_new[i] & 0x0F) == 0;
+        n += (fb_new[i] & 0xF0) == 0;
+    }
+    return n;
+}
+
+int main(void)
+{
+    fill_case_t cases[] = {
+        { "full screen",          0,    0, EPD_WIDTH, EPD_HEIGHT, 0 },
+        { "status cell 100x40",  31,   17,       100,         40, 0 },
+        { "odd edges 301x101",   13,  211,       301,        101, 0 },
+        { "hline 960x1",          0,  270, EPD_WIDTH,          1, 0 },
+        { "vline 1x540",        481,    0,         1, EPD_HEIGHT, 0 },
+        { "clipped 400x400",    800,  300,       400,        400, 0 },
+        { "circle r=200",       480,  270,       200,          0, 1 },
+        { "circle r=10",         50,   50,        10,          0, 1 },
+    };
+    int failed = 0;
+
+    printf("%-20s %10s %12s %12s %8s\n", "fill", "pixels", "old Mpx/s", "new Mpx/s", "speedup");
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        fill_case_t *c = &cases[i];
+
+        for (int gray = 0; gray < 16; gray++)
+        {
+            uint8_t color = gray << 4;
+            memset(fb_new, 0xA5, sizeof(fb_new));
+            memset(fb_old, 0xA5, sizeof(fb_old));
+            if (c->circle)
+            {
+                epd_fill_circle(c->x, c->y, c->w, color, fb_new);
+                old_fill_circle(c->x, c->y, c->w, color, fb_old);
+            }
+            else
+            {
+                epd_fill_rect(c->x, c->y, c->w, c->h, color, fb_new);
+                old_fill_rect(c->x, c->y, c->w, c->h, color, fb_old);
+            }
+            if (memcmp(fb_new, fb_old, sizeof(fb_new)) != 0)
+            {
+                printf("%s: gray %d differs from the per-pixel fill\n", c->name, gray);
+                failed = 1;
+                break;
+            }
+        }
+
+        int64_t pixels = covered_pixels(c);
+        c->framebuffer = fb_old;
+        c->old = 1;
+        double t_old = bench_run(run_case, c);
+        c->framebuffer = fb_new;
+        c->old = 0;
+        double t_new = bench_run(run_case, c);
+        printf("%-20s %10lld %12.1f %12.1f %7.1fx\n", c->name, (long long)pixels,
+               pixels / t_old / 1e6, pixels / t_new / 1e6, t_old / t_new);
+    }
+
+    return failed;
+}
@@ -0,0 +1,86 @@
+/*
+ * One FiraSans line drawn from each glyph bitmap format, with a cold glyph
+ * cache (cleared before every line) and a warm one. All formats must draw
+ * the same framebuffer.
+ *
+ * The fonts under fonts/ hold only the characters of the line. They were
+ * made from projects/game_server_monitor/font/FiraSans-Regular.ttf with
+ * the fontconvert.py command recorded at the top of each file.
+ */
+
+#include "bench.h"
+#include "epd_driver.h"
+#include "fonts/firasans_atlas.h"
+#include "fonts/firasans_glyphs.h"
+#include "fonts/firasans_rle.h"
+#include "fonts/firasans_zlib.h"
+
+#include <stdio.h>
+#include <string.h>
+
+typedef struct
+{
+    const char    *name;
+    const GFXfont *font;
+    uint32_t       bitmap_size;
+} format_case_t;
+
+static const char *text = "World: Vanilla 1.20.6, CPU 37%, RAM 5.2/16 GB, Players 12/64, Uptime 3d 04:17:52";
+
+static uint8_t framebuffer[EPD_WIDTH / 2 * EPD_HEIGHT];
+static uint8_t expected[EPD_WIDTH / 2 * EPD_HEIGHT];
+
+static void draw_line(const GFXfont *font, uint8_t *buffer)
+{
+    int32_t cursor_x = 10;
+    int32_t cursor_y = 50;
+    writeln(font, text, &cursor_x, &cursor_y, buffer);
+}
+
+static void run_cold(void *arg)
+{
+    glyph_cache_clear();
+    draw_line(((format_case_t *)arg)->font, framebuffer);
+}
+
+static void run_warm(void *arg)
+{
+    draw_line(((format_case_t *)arg)->font, framebuffer);
+}
+
+int main(void)
+{
+    format_case_t cases[] = {
+        { "zlib",      &FiraSansZlib,   sizeof(FiraSansZlib_Bitmaps) },
+        { "glyphs",    &FiraSansGlyphs, sizeof(FiraSansGlyphs_Bitmaps) },
+        { "atlas",     &FiraSansAtlas,  sizeof(FiraSansAtlas_Bitmaps) },
+        { "atlas-rle", &FiraSansRle,    sizeof(FiraSansRle_Bitmaps) },
+    };
+    int failed = 0;
+
+    memset(expected, 0xFF, sizeof(expected));
+    draw_line(cases[0].font, expected);
+
+    printf("%zu characters per line\n", strlen(text));
+    printf("%-10s %12s %14s %14s\n", "format", "bitmap bytes", "cold us/line", "warm us/line");
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        format_case_t *c = &cases[i];
+
+        glyph_cache_clear();
+        memset(framebuffer, 0xFF, sizeof(framebuffer));
+        draw_line(c->font, framebuffer);
+        if (memcmp(framebuffer, expected, sizeof(framebuffer)) != 0)
+        {
+            printf("%s: differs from the %s font\n", c->name, cases[0].name);
+            failed = 1;
+        }
+
+        double cold = bench_run(run_cold, c);
+        glyph_cache_clear();
+        double warm = bench_run(run_warm, c);
+        printf("%-10s %12u %14.1f %14.1f\n", c->name, c->bitmap_size, cold * 1e6, warm * 1e6);
+    }
+
+    return failed;
+}
@@ -0,0 +1,180 @@
+/*
+ * Glyph blitting on FiraSans text, against the per-pixel loop of the old
+ * draw_char(). Bitmaps come from a warm glyph cache in both, so only the
+ * blit is timed.
+ */
+
+#include "font.c"
+
+#include "bench.h"
+#include "firasans.h"
+
+#include <stdio.h>
+
+#define LINES      8
+#define MAX_GLYPHS 64
+
+typedef struct
+{
+    const char    *name;
+    int32_t        x;
+    uint8_t        fg;
+    uint8_t        bg;
+    TextLayout    *layouts;
+    FontProperties props;
+} glyph_case_t;
+
+static const char *text[LINES] = {
+    "CPU 37%  RAM 5.2/16 GB  Disk 71%",
+    "Players online: 12 / 64",
+    "Uptime 3d 04:17:52",
+    "Last backup: 2024-06-01 03:00",
+    "Ping 23 ms, jitter 1.8 ms",
+    "World: Vanilla 1.20.6 (survival)",
+    "Quick brown fox jumps over the lazy dog",
+    "AVAWAY Ty Yo To LT 0123456789",
+};
+
+static uint8_t framebuffer[EPD_WIDTH / 2 * EPD_HEIGHT];
+static uint8_t expected[EPD_WIDTH / 2 * EPD_HEIGHT];
+
+/* The inner loop of draw_char() before the byte blitter, bitmap lookup aside */
+static void old_draw_char(glyph_cache_entry_t *entry, uint8_t *buffer, int32_t cursor_x,
+                          int32_t cursor_y, const FontProperties *props, bool transparent)
+{
+    GFXglyph *glyph = entry->glyph;
+    int32_t byte_width;
+    uint8_t *bitmap = glyph_cache_bitmap(entry, &byte_width);
+    if (bitmap == NULL)
+    {
+        return;
+    }
+
+    uint8_t color_lut[16];
+    for (int32_t c = 0; c < 16; c++)
+    {
+        int32_t color_difference = (int32_t)props->fg_color - (int32_t)props->bg_color;
+        color_lut[c] = max(0, min(15, props->bg_color + c * color_difference / 15));
+    }
+
+    for (int32_t y = 0; y < glyph->height; y++)
+    {
+        int32_t yy = cursor_y - glyph->top + y;
+        if (yy < 0 || yy >= EPD_HEIGHT)
+        {
+            continue;
+        }
+        int32_t start_pos = cursor_x + glyph->left;
+        int32_t x = max(0, -start_pos);
+        int32_t max_x = min(start_pos + glyph->width, EPD_WIDTH);
+        for (int32_t xx = start_pos + x; xx < max_x; xx++, x++)
+        {
+            uint32_t buf_pos = yy * EPD_WIDTH / 2 + xx / 2;
+            uint8_t old = buffer[buf_pos];
+            uint8_t bm = bitmap[y * byte_width + x / 2];
+            bm = (x & 1) ? bm >> 4 : bm & 0xF;
+            if (transparent && bm == 0)
+            {
+                continue;
+            }
+            if ((xx & 1) == 0)
+            {
+                buffer[buf_pos] = (old & 0xF0) | color_lut[bm];
+            }
+            else
+            {
+                buffer[buf_pos] = (old & 0x0F) | (color_lut[bm] << 4);
+            }
+        }
+    }
+}
+
+static void draw_old(glyph_case_t *c, uint8_t *buffer, bool transparent)
+{
+    for (int32_t l = 0; l < LINES; l++)
+    {
+        const TextLayout *layout = &c->layouts[l];
+        int32_t cursor_y = 50 + l * FiraSans.advance_y;
+        for (uint32_t i = 0; i < layout->count; i++)
+        {
+            const GlyphRef *ref = &layout->glyphs[i];
+            old_draw_char(glyph_cache_get(&FiraSans, ref->code_point), buffer,
+                          c->x + ref->x - layout->glyphs[0].x, cursor_y, &c->props,
+                          transparent);
+        }
+    }
+}
+
+static void draw_new(glyph_case_t *c, uint8_t *buffer)
+{
+    for (int32_t l = 0; l < LINES; l++)
+    {
+        int32_t cursor_x = c->x;
+        int32_t cursor_y = 50 + l * FiraSans.advance_y;
+        write_layout(&c->layouts[l], &cursor_x, &cursor_y, buffer, BLACK_ON_WHITE, &c->props);
+    }
+}
+
+static void run_old(void *arg)
+{
+    draw_old((glyph_case_t *)arg, framebuffer, false);
+}
+
+static void run_new(void *arg)
+{
+    draw_new((glyph_case_t *)arg, framebuffer);
+}
+
+int main(void)
+{
+    static GlyphRef glyphs[LINES][MAX_GLYPHS];
+    static TextLayout layouts[LINES];
+    glyph_case_t cases[] = {
+        { "black on white",        10,  0, 15 },
+        { "black on white, odd x", 11,  0, 15 },
+        { "gray box",              10,  0,  8 },
+        { "white on black",        11, 15,  0 },
+    };
+    uint32_t glyph_count = 0;
+    uint64_t glyph_pixels = 0;
+    int failed = 0;
+
+    for (int32_t l = 0; l < LINES; l++)
+    {
+        layout_text(&FiraSans, text[l], glyphs[l], MAX_GLYPHS, &layouts[l], NULL);
+        glyph_count += layouts[l].count;
+        for (uint32_t i = 0; i < layouts[l].count; i++)
+        {
+            glyph_pixels += glyphs[l][i].glyph->width * glyphs[l][i].glyph->height;
+        }
+    }
+
+    printf("%u glyphs, %llu glyph box pixels\n", glyph_count, (unsigned long long)glyph_pixels);
+    printf("%-24s %14s %14s %8s\n", "text", "old ns/glyph", "new ns/glyph", "speedup");
+    for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        glyph_case_t *c = &cases[i];
+        c->layouts = layouts;
+        c->props = font_properties_default();
+        c->props.fg_color = c->fg;
+        c->props.bg_color = c->bg;
+
+        // a white background is transparent, every other one fills the glyph box
+        memset(framebuffer, 0xA5, sizeof(framebuffer));
+        memset(expected, 0xA5, sizeof(expected));
+        draw_new(c, framebuffer);
+        draw_old(c, expected, c->bg == 15);
+        if (memcmp(framebuffer, expected, sizeof(framebuffer)) != 0)
+        {
+            printf("%s: differs from the per-pixel blit\n", c->name);
+            failed = 1;
+        }
+
+        double t_old = bench_run(run_old, c);
+        double t_new = bench_run(run_new, c);
+        printf("%-24s %14.1f %14.1f %7.1fx\n", c->name, t_old * 1e9 / glyph_count,
+               t_new * 1e9 / glyph_count, t_old / t_new);
+    }
+
+    return failed;
+}
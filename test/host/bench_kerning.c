@@ -0,0 +1,88 @@
+/*
+ * Cost of kerning in layout_text() on a FiraSans status line: without a
+ * pair table, with the pair table, and with the table turned off by
+ * NO_KERNING. The last must lay out exactly like the first.
+ *
+ * All three use one copy of the font, so they share its glyph cache
+ * entries and only the kerning differs.
+ */
+
+#include "bench.h"
+#include "epd_driver.h"
+#include "firasans.h"
+
+#include <stdio.h>
+
+#define MAX_GLYPHS 64
+
+typedef struct
+{
+    const char        *name;
+    const KerningPair *kerning;
+    uint32_t           kerning_count;
+    FontProperties     props;
+    GlyphRef        glyphs[MAX_GLYPHS];
+    TextLayout      layout;
+} kerning_case_t;
+
+static const char *text = "AVAWAY: Today 23 ms, To LT 71% (Ty Yo) 12/64 ok.";
+
+static GFXfont font;
+
+static void run_layout(void *arg)
+{
+    kerning_case_t *c = (kerning_case_t *)arg;
+    font.kerning = c->kerning;
+    font.kerning_count = c->kerning_count;
+    layout_text(&font, text, c->glyphs, MAX_GLYPHS, &c->layout, &c->props);
+}
+
+int main(void)
+{
+    uint32_t pairs = sizeof(FiraSans_Kerning) / sizeof(FiraSans_Kerning[0]);
+    static kerning_case_t cases[3];
+    cases[0] = (kerning_case_t){ "no table",   NULL,             0,     { .bg_color = 15 } };
+    cases[1] = (kerning_case_t){ "pair table", FiraSans_Kerning, pairs, { .bg_color = 15 } };
+    cases[2] = (kerning_case_t){ "NO_KERNING", FiraSans_Kerning, pairs,
+                                 { .bg_color = 15, .flags = NO_KERNING } };
+    uint32_t count = sizeof(cases) / sizeof(cases[0]);
+    int failed = 0;
+
+    font = FiraSans;
+
+    // warm the glyph cache, so only the layout is timed
+    for (uint32_t i = 0; i < count; i++)
+    {
+        run_layout(&cases[i]);
+    }
+
+    kerning_case_t *plain = &cases[0];
+    kerning_case_t *kerned = &cases[1];
+    kerning_case_t *off = &cases[2];
+    uint32_t chars = plain->layout.count;
+    for (uint32_t i = 0; i < chars; i++)
+    {
+        if (off->glyphs[i].x != plain->glyphs[i].x)
+        {
+            printf("NO_KERNING: glyph %u at x %d, %d without a table\n", i,
+                   off->glyphs[i].x, plain->glyphs[i].x);
+            failed = 1;
+            break;
+        }
+    }
+    if (kerned->layout.advance_x == plain->layout.advance_x)
+    {
+        printf("pair table: no pair of the text was applied\n");
+        failed = 1;
+    }
+
+    printf("%u characters, %u kerning pairs, advance %d kerned, %d plain\n", chars,
+           FiraSans.kerning_count, kerned->layout.advance_x, plain->layout.advance_x);
+    printf("%-12s %10s\n", "layout", "ns/char");
+    for (uint32_t i = 0; i < count; i++)
+    {
+        printf("%-12s %10.1f\n", cases[i].name, bench_run(run_layout, &cases[i]) * 1e9 / chars);
+    }
+
+    return failed;
+}
@@ -0,0 +1,251 @@
+/*
+ * Row latch cost against the two full config pushes it replaced: GPIO
+ * register writes, shift clocks and strobes per latch, and cycles from the
+ * cycle counter the way EPD_LATCH_MEASURE builds read them.
+ *
+ * The GPIO registers are modelled, with the config shift register behind
+ * them, and both latches must move its outputs from the row bits to the
+ * row bits with latch enable and back, without any other output change.
+ * Host cycles come from the host clock at 240 MHz and include the model,
+ * so compare them with each other only.
+ */
+
+#include <hal/gpio_ll.h>
+
+/* every GPIO register write in ed047tc1.c goes through the model */
+#define GPIO (*gpio_model_write())
+static gpio_dev_t *gpio_model_write(void);
+
+#define EPD_LATCH_MEASURE 1
+#include "ed047tc1.c"
+
+#include "epd_driver.h"
+
+#include <stdio.h>
+
+#define LATCHES     10000
+#define MAX_CHANGES 8
+
+typedef struct
+{
+    uint32_t writes;
+    uint32_t clocks;
+    uint32_t strobes;
+    uint32_t changes;
+    uint8_t  outputs[MAX_CHANGES];
+} gpio_trace_t;
+
+static gpio_dev_t gpio_regs;
+static uint32_t pin_levels;
+static uint8_t shift_reg;
+static uint8_t cfg_outputs;
+static gpio_trace_t trace;
+
+/* Apply the last register write to the pins and the shift register */
+static void gpio_model_apply(void)
+{
+    uint32_t before = pin_levels;
+    pin_levels = (pin_levels | gpio_regs.out_w1ts) & ~gpio_regs.out_w1tc;
+    gpio_regs.out_w1ts = 0;
+    gpio_regs.out_w1tc = 0;
+
+    uint32_t rising = pin_levels & ~before;
+    if (rising & (1 << CFG_CLK))
+    {
+        shift_reg = shift_reg << 1 | ((pin_levels >> CFG_DATA) & 1);
+        trace.clocks++;
+    }
+    if (rising & (1 << CFG_STR))
+    {
+        trace.strobes++;
+    }
+    // the outputs follow the shift register while the strobe is high
+    if ((pin_levels & (1 << CFG_STR)) && cfg_outputs != shift_reg)
+    {
+        cfg_outputs = shift_reg;
+        if (trace.changes < MAX_CHANGES)
+        {
+            trace.outputs[trace.changes] = cfg_outputs;
+        }
+        trace.changes++;
+    }
+}
+
+static gpio_dev_t *gpio_model_write(void)
+{
+    gpio_model_apply();
+    trace.writes++;
+    return &gpio_regs;
+}
+
+static gpio_trace_t trace_latch(void (*latch)(void))
+{
+    memset(&trace, 0, sizeof(trace));
+    latch();
+    gpio_model_apply();
+    return trace;
+}
+
+/* The bus and CKV calls of ed047tc1.c, none of which a latch reaches */
+void i2s_bus_init(i2s_bus_config *cfg)
+{
+    (void)cfg;
+}
+
+volatile uint8_t *i2s_get_current_buffer()
+{
+    return NULL;
+}
+
+void i2s_switch_buffer()
+{
+}
+
+void i2s_start_line_output()
+{
+}
+
+bool i2s_is_busy()
+{
+    return false;
+}
+
+uint32_t i2s_bus_time_us()
+{
+    return 0;
+}
+
+void rmt_pulse_init(gpio_num_t pin)
+{
+    (void)pin;
+}
+
+void pulse_ckv_us(uint16_t high_time_us, uint16_t low_time_us, bool wait)
+{
+    (void)high_time_us;
+    (void)low_time_us;
+    (void)wait;
+}
+
+void pulse_ckv_ticks(uint16_t high_time_us, uint16_t low_time_us, bool wait)
+{
+    (void)high_time_us;
+    (void)low_time_us;
+    (void)wait;
+}
+
+void pulse_ckv_repeat(uint16_t high_time_ticks, uint16_t low_time_ticks,
+                      uint32_t count, bool wait)
+{
+    (void)high_time_ticks;
+    (void)low_time_ticks;
+    (void)count;
+    (void)wait;
+}
+
+/* push_cfg() and latch_row() as they were, three GPIO writes per bit */
+static inline void old_push_cfg_bit(bool bit)
+{
+    fast_gpio_set_lo(CFG_CLK);
+    if (bit)
+    {
+        fast_gpio_set_hi(CFG_DATA);
+    }
+    else
+    {
+        fast_gpio_set_lo(CFG_DATA);
+    }
+    fast_gpio_set_hi(CFG_CLK);
+}
+
+static void old_push_cfg(epd_config_register_t *cfg)
+{
+    fast_gpio_set_lo(CFG_STR);
+
+    old_push_cfg_bit(cfg->ep_output_enable);
+    old_push_cfg_bit(cfg->ep_mode);
+    old_push_cfg_bit(cfg->ep_scan_direction);
+    old_push_cfg_bit(cfg->ep_stv);
+
+    old_push_cfg_bit(cfg->neg_power_enable);
+    old_push_cfg_bit(cfg->pos_power_enable);
+    old_push_cfg_bit(cfg->power_disable);
+    old_push_cfg_bit(cfg->ep_latch_enable);
+
+    fast_gpio_set_hi(CFG_STR);
+}
+
+static void old_latch_row(void)
+{
+    config_reg.ep_latch_enable = true;
+    old_push_cfg(&config_reg);
+
+    config_reg.ep_latch_enable = false;
+    old_push_cfg(&config_reg);
+}
+
+static void new_latch_row(void)
+{
+    latch_row();
+}
+
+static int check_trace(const char *name, const gpio_trace_t *t, uint8_t row_bits)
+{
+    if (t->changes == 2 && t->outputs[0] == (row_bits | 1) && t->outputs[1] == row_bits)
+    {
+        return 0;
+    }
+    printf("%s: %u output changes:", name, t->changes);
+    for (uint32_t i = 0; i < t->changes && i < MAX_CHANGES; i++)
+    {
+        printf(" 0x%02x", t->outputs[i]);
+    }
+    printf(", expected 0x%02x 0x%02x\n", row_bits | 1, row_bits);
+    return 1;
+}
+
+static uint32_t fewest_cycles(void (*latch)(void), int measured)
+{
+    uint32_t fewest = UINT32_MAX;
+    for (uint32_t i = 0; i < LATCHES; i++)
+    {
+        uint32_t start = XTHAL_GET_CCOUNT();
+        latch();
+        uint32_t cycles = measured ? epd_latch_cycles() : XTHAL_GET_CCOUNT() - start;
+        fewest = cycles < fewest ? cycles : fewest;
+    }
+    return fewest;
+}
+
+int main(void)
+{
+    // the register as it is while rows are written
+    epd_base_init(EPD_WIDTH, 20000000);
+    epd_poweron();
+    epd_start_frame();
+    gpio_model_apply();
+    uint8_t row_bits = cfg_bits(&config_reg);
+    if (cfg_outputs != row_bits)
+    {
+        printf("config outputs are 0x%02x after the frame start, expected 0x%02x\n",
+               cfg_outputs, row_bits);
+        return 1;
+    }
+
+    gpio_trace_t old_trace = trace_latch(old_latch_row);
+    gpio_trace_t new_trace = trace_latch(new_latch_row);
+    int failed = check_trace("two pushes", &old_trace, row_bits);
+    failed |= check_trace("latch_row", &new_trace, row_bits);
+
+    uint32_t old_cycles = fewest_cycles(old_latch_row, 0);
+    uint32_t new_cycles = fewest_cycles(new_latch_row, 1);
+
+    printf("%-12s %12s %8s %8s %14s\n", "latch", "GPIO writes", "clocks", "strobes",
+           "fewest cycles");
+    printf("%-12s %12u %8u %8u %14u\n", "two pushes", old_trace.writes, old_trace.clocks,
+           old_trace.strobes, old_cycles);
+    printf("%-12s %12u %8u %8u %14u\n", "latch_row", new_trace.writes, new_trace.clocks,
+           new_trace.strobes, new_cycles);
+
+    return failed;
+}
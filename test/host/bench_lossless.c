@@ -0,0 +1,234 @@
+/*
+ * Decode throughput of PNG and the packed 4bpp format (G4Z1) against JPEG,
+ * for a full screen dashboard and a full screen photo. The lossless
+ * formats must reproduce the image exactly at 16 levels.
+ */
+
+#include "bench.h"
+#include "epd_driver.h"
+#include "libjpeg/libjpeg.h"
+#include "libpng/libpng.h"
+#include "test_images.h"
+#include "zlib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define W EPD_WIDTH
+#define H EPD_HEIGHT
+
+typedef int (*draw_fn)(uint8_t *buff, uint32_t buff_size, Rect_t *area, uint8_t *framebuffer);
+
+typedef struct
+{
+    const char *name;
+    draw_fn     draw;
+    uint8_t    *data;
+    size_t      size;
+    int         lossless;
+} format_t;
+
+static uint8_t framebuffer[W / 2 * H];
+
+/* White background, bar charts, a line graph and blocks of "text" */
+static uint8_t *dashboard_image(void)
+{
+    uint8_t *gray = malloc(W * H);
+    memset(gray, 255, W * H);
+    for (int32_t y = 0; y < H; y++)
+    {
+        for (int32_t x = 0; x < W; x++)
+        {
+            uint8_t *p = &gray[y * W + x];
+            if (y < 60 && ((x / 7 + y / 9) % 5 == 0) && (x % 7 < 5) && (y % 9 < 7))
+            {
+                *p = 0;
+            }
+            if (y >= 100 && y < 300 && x >= 40 && x < 440 && (x - 40) % 50 < 30
+                    && y >= 300 - ((x - 40) / 50 * 23 + 40))
+            {
+                *p = 0x10 * ((x - 40) / 50 + 4);
+            }
+            if (x == 40 || x == 520 || y == 300)
+            {
+                *p = 0x30;
+            }
+        }
+    }
+    for (int32_t x = 520; x < 920; x++)
+    {
+        int32_t y = 200 + (int32_t)(80 * ((x * 37 % 101) / 101.0 - 0.5));
+        for (int32_t t = -1; t <= 1; t++)
+        {
+            gray[(y + t) * W + x] = 0;
+        }
+    }
+    return gray;
+}
+
+static size_t png_chunk(uint8_t *out, const char *type, const uint8_t *data, uint32_t len)
+{
+    out[0] = len >> 24;
+    out[1] = len >> 16;
+    out[2] = len >> 8;
+    out[3] = len;
+    memcpy(out + 4, type, 4);
+    if (len > 0)
+    {
+        memcpy(out + 8, data, len);
+    }
+    uint32_t crc = crc32(crc32(0, NULL, 0), out + 4, len + 4);
+    out[8 + len] = crc >> 24;
+    out[9 + len] = crc >> 16;
+    out[10 + len] = crc >> 8;
+    out[11 + len] = crc;
+    return len + 12;
+}
+
+/* Gray PNG at 8 or 4 bits, every row with the Up filter */
+static size_t png_encode(const uint8_t *gray, uint32_t bit_depth, uint8_t **png)
+{
+    uint32_t row_size = W * bit_depth / 8;
+    uint8_t *raw = calloc(H, row_size + 1);
+    for (uint32_t y = 0; y < H; y++)
+    {
+        uint8_t *row = raw + y * (row_size + 1);
+        row[0] = 2;
+        for (uint32_t x = 0; x < W; x++)
+        {
+            uint8_t v = gray[y * W + x];
+            if (bit_depth == 8)
+                row[1 + x] = v;
+            else
+                row[1 + x / 2] |= (v >> 4) << ((x & 1) ? 0 : 4);
+        }
+    }
+    for (uint32_t y = H - 1; y > 0; y--)
+    {
+        uint8_t *row = raw + y * (row_size + 1) + 1;
+        const uint8_t *above = row - (row_size + 1);
+        for (uint32_t i = 0; i < row_size; i++)
+        {
+            row[i] -= above[i];
+        }
+    }
+
+    uLongf zsize = compressBound(H * (row_size + 1));
+    uint8_t *z = malloc(zsize);
+    compress2(z, &zsize, raw, H * (row_size + 1), 9);
+    free(raw);
+
+    uint8_t ihdr[13] = { W >> 24, W >> 16, W >> 8, W & 0xFF, H >> 24, H >> 16, H >> 8, H & 0xFF,
+                         bit_depth, 0, 0, 0, 0 };
+    uint8_t *out = malloc(8 + 25 + zsize + 12 + 12);
+    size_t size = 8;
+    memcpy(out, "\x89PNG\r\n\x1a\n", 8);
+    size += png_chunk(out + size, "IHDR", ihdr, sizeof(ihdr));
+    size += png_chunk(out + size, "IDAT", z, zsize);
+    size += png_chunk(out + size, "IEND", NULL, 0);
+    free(z);
+    *png = out;
+    return size;
+}
+
+/* GRAY4_MAGIC, width, height, and the zlib compressed framebuffer rows */
+static size_t gray4_encode(const uint8_t *gray, uint8_t **gray4)
+{
+    uint32_t stride = (W + 1) / 2;
+    uint8_t *raw = calloc(H, stride);
+    for (uint32_t y = 0; y < H; y++)
+    {
+        for (uint32_t x = 0; x < W; x++)
+        {
+            raw[y * stride + x / 2] |= (gray[y * W + x] >> 4) << ((x & 1) ? 4 : 0);
+        }
+    }
+    uLongf zsize = compressBound(H * stride);
+    uint8_t *out = malloc(8 + zsize);
+    memcpy(out, GRAY4_MAGIC, 4);
+    out[4] = W & 0xFF;
+    out[5] = W >> 8;
+    out[6] = H & 0xFF;
+    out[7] = H >> 8;
+    compress2(out + 8, &zsize, raw, H * stride, 9);
+    free(raw);
+    *gray4 = out;
+    return 8 + zsize;
+}
+
+static int draw_jpg(uint8_t *buff, uint32_t buff_size, Rect_t *area, uint8_t *fb)
+{
+    return draw_jpg_from_buff(buff, buff_size, area, fb);
+}
+
+static void run_draw(void *arg)
+{
+    format_t *f = (format_t *)arg;
+    Rect_t area = { .x = 0, .y = 0 };
+    f->draw(f->data, f->size, &area, framebuffer);
+}
+
+static int bench_image(const char *name, uint8_t *gray)
+{
+    format_t formats[] = {
+        { "PNG 8 bit", draw_png_from_buff, NULL, 0, 1 },
+        { "PNG 4 bit", draw_png_from_buff, NULL, 0, 1 },
+        { "G4Z1",      draw_gray4_from_buff, NULL, 0, 1 },
+        { "JPEG q90",  draw_jpg, NULL, 0, 0 },
+    };
+    int failed = 0;
+
+    formats[0].size = png_encode(gray, 8, &formats[0].data);
+    formats[1].size = png_encode(gray, 4, &formats[1].data);
+    formats[2].size = gray4_encode(gray, &formats[2].data);
+    formats[3].size = test_jpeg_encode(gray, W, H, 1, 90, &formats[3].data);
+
+    printf("%s, %dx%d\n", name, W, H);
+    printf("  %-10s %10s %10s %10s\n", "format", "bytes", "ms", "Mpx/s");
+    for (uint32_t i = 0; i < sizeof(formats) / sizeof(formats[0]); i++)
+    {
+        format_t *f = &formats[i];
+        memset(framebuffer, 0xA5, sizeof(framebuffer));
+        Rect_t area = { .x = 0, .y = 0 };
+        if (f->draw(f->data, f->size, &area, framebuffer) != 1)
+        {
+            printf("  %s: decode failed\n", f->name);
+            failed = 1;
+            continue;
+        }
+        for (uint32_t p = 0; f->lossless && p < W * H; p++)
+        {
+            uint8_t b = framebuffer[p / 2];
+            if (((p & 1) ? b >> 4 : b & 0x0F) != gray[p] >> 4)
+            {
+                printf("  %s: pixel %u,%u differs\n", f->name, p % W, p / W);
+                failed = 1;
+                break;
+            }
+        }
+
+        double t = bench_run(run_draw, f);
+        printf("  %-10s %10zu %10.2f %10.1f\n", f->name, f->size, t * 1e3, W * H / t / 1e6);
+        free(f->data);
+    }
+    return failed;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    libjpeg_init();
+
+    uint8_t *gray = dashboard_image();
+    failed |= bench_image("dashboard", gray);
+    free(gray);
+
+    gray = test_image(W, H, 1, 5);
+    failed |= bench_image("photo", gray);
+    free(gray);
+
+    libjpeg_deinit();
+    return failed;
+}
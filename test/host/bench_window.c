@@ -0,0 +1,110 @@
+/*
+ * Per-row conversion cost of the column window against the area width.
+ * Words outside the window are not converted; the words inside must
+ * come out as they do from a full-width conversion.
+ */
+
+#include "epd_driver.c"
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct
+{
+    uint32_t *line;
+    uint32_t *prev;
+    uint8_t  *out;
+    uint8_t  *lut;
+    uint8_t  *diff_lut;
+    uint32_t  word_start;
+    uint32_t  word_end;
+} window_case_t;
+
+static void run_convert(void *arg)
+{
+    window_case_t *c = (window_case_t *)arg;
+    convert_line_4bpp(c->line, c->out, c->lut, c->word_start, c->word_end);
+}
+
+static void run_convert_diff(void *arg)
+{
+    window_case_t *c = (window_case_t *)arg;
+    convert_line_4bpp_diff((uint16_t *)c->prev, (uint16_t *)c->line, c->out,
+                           c->diff_lut, c->word_start, c->word_end);
+}
+
+int main(void)
+{
+    static uint32_t line[EPD_WIDTH / 8];
+    static uint32_t prev[EPD_WIDTH / 8];
+    static uint32_t full[EPD_WIDTH / 16];
+    static uint32_t out[EPD_WIDTH / 16];
+    static const int32_t widths[] = { 16, 48, 100, 240, 480, 720, EPD_WIDTH };
+    window_case_t c = {
+        .line = line,
+        .prev = prev,
+        .out = (uint8_t *)out,
+        .lut = malloc(1 << 16),
+        .diff_lut = malloc(1 << 16),
+    };
+    int failed = 0;
+
+    srand(1);
+    for (uint32_t i = 0; i < EPD_WIDTH / 8; i++)
+    {
+        line[i] = (uint32_t)rand() << 16 ^ rand();
+        prev[i] = (uint32_t)rand() << 16 ^ rand();
+    }
+    update_LUT(c.lut, 7, BLACK_ON_WHITE);
+    update_diff_LUT(c.diff_lut, 7, BLACK_ON_WHITE);
+    convert_line_4bpp(line, (uint8_t *)full, c.lut, 0, EPD_WIDTH / 16);
+
+    uint32_t count = sizeof(widths) / sizeof(widths[0]);
+    uint32_t words[sizeof(widths) / sizeof(widths[0])];
+    double ns[sizeof(widths) / sizeof(widths[0])];
+    double diff_ns[sizeof(widths) / sizeof(widths[0])];
+    for (uint32_t i = 0; i < count; i++)
+    {
+        // place the area off the word grid, like a status cell would be
+        int32_t x = widths[i] < EPD_WIDTH ? 37 : 0;
+        c.word_start = x / 16;
+        c.word_end = (x + widths[i] + 15) / 16;
+        if (c.word_end > EPD_WIDTH / 16)
+        {
+            c.word_end = EPD_WIDTH / 16;
+        }
+
+        memset(out, 0, sizeof(out));
+        convert_line_4bpp(line, (uint8_t *)out, c.lut, c.word_start, c.word_end);
+        for (uint32_t j = 0; j < EPD_WIDTH / 16; j++)
+        {
+            uint32_t expected = j >= c.word_start && j < c.word_end ? full[j] : 0;
+            if (out[j] != expected)
+            {
+                printf("width %d: word %u is 0x%08x, expected 0x%08x\n",
+                       widths[i], j, out[j], expected);
+                failed = 1;
+                break;
+            }
+        }
+
+        words[i] = c.word_end - c.word_start;
+        ns[i] = bench_run(run_convert, &c) * 1e9;
+        diff_ns[i] = bench_run(run_convert_diff, &c) * 1e9;
+    }
+
+    // the last width is the full row
+    printf("%-6s %-6s %12s %12s %14s %12s\n", "width", "words", "ns/row", "of full",
+           "diff ns/row", "of full");
+    for (uint32_t i = 0; i < count; i++)
+    {
+        printf("%-6d %-6u %12.1f %11.0f%% %14.1f %11.0f%%\n", widths[i], words[i], ns[i],
+               100 * ns[i] / ns[count - 1], diff_ns[i], 100 * diff_ns[i] / diff_ns[count - 1]);
+    }
+
+    free(c.lut);
+    free(c.diff_lut);
+    return failed;
+}
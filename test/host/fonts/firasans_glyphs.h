@@ -0,0 +1,736 @@
+#pragma once
+#include "epd_driver.h"
+/*
+Created with
+ fontconvert.py FiraSansGlyphs 20 FiraSans-Regular.ttf --format glyphs --string World: Vanilla 1.20.6, CPU 37%, RAM 5.2/16 GB, Players 12/64, Uptime 3d 04:17:52
+As 'FiraSansGlyphs' with available 37 characters
+ %,./01234567:ABCGMPRUVWadeilmnoprsty
+*/
+const UnicodeInterval FiraSansGlyphs_Intervals[] = {
+    { 0x20, 0x20, 0x0 },
+    { 0x25, 0x25, 0x1 },
+    { 0x2C, 0x2C, 0x2 },
+    { 0x2E, 0x37, 0x3 },
+    { 0x3A, 0x3A, 0xD },
+    { 0x41, 0x43, 0xE },
+    { 0x47, 0x47, 0x11 },
+    { 0x4D, 0x4D, 0x12 },
+    { 0x50, 0x50, 0x13 },
+    { 0x52, 0x52, 0x14 },
+    { 0x55, 0x57, 0x15 },
+    { 0x61, 0x61, 0x18 },
+    { 0x64, 0x65, 0x19 },
+    { 0x69, 0x69, 0x1B },
+    { 0x6C, 0x70, 0x1C },
+    { 0x72, 0x74, 0x21 },
+    { 0x79, 0x79, 0x24 },
+};
+const uint16_t FiraSansGlyphs_AsciiGlyphs[128] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0002, 0xFFFF, 0x0003, 0x0004,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C,
+    0xFFFF, 0xFFFF, 0x000D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x000E, 0x000F, 0x0010, 0xFFFF, 0xFFFF, 0xFFFF, 0x0011,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0012, 0xFFFF, 0xFFFF,
+    0x0013, 0xFFFF, 0x0014, 0xFFFF, 0xFFFF, 0x0015, 0x0016, 0x0017,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x0018, 0xFFFF, 0xFFFF, 0x0019, 0x001A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x001B, 0xFFFF, 0xFFFF, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0xFFFF, 0x0021, 0x0022, 0x0023, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x0024, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+const uint8_t FiraSansGlyphs_Bitmaps[9803] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xA4, 0xFE, 0xBE, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xEF, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xDF, 0x25, 0xA4, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0x1E, 0x00, 0x00, 0xFB, 0xEF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0x09, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0x00, 0x00, 0xFD, 0xEF, 0x01, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0x05, 0x00, 0x00, 0xF1, 0xFF, 0x05, 0x00, 0x80, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0x04, 0x00, 0x00, 0xF0, 0xFF, 0x06, 0x00, 0xF2, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0x05, 0x00, 0x00, 0xF0, 0xFF, 0x05, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0x08, 0x00, 0x00, 0xF3, 0xFF, 0x02, 0x70, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xFF, 0x0E, 0x00, 0x00, 0xF9, 0xEF, 0x00, 0xF2, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xBF, 0x02, 0x81, 0xFF, 0x7F, 0x00, 0xFC, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x60, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF1, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x82, 0xDC, 0x9C, 0x04, 0x00, 0xFB, 0xFF, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x8F, 0x00, 0x50, 0xFC, 0xFF, 0x9E, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x03, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x9F, 0x00, 0xF3, 0xFF, 0x3C, 0x10, 0xF6, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0x0E, 0x00, 0xF9, 0xFF, 0x01, 0x00, 0x70, 0xFF, 0x2F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x04, 0x00, 0xFD, 0xAF, 0x00, 0x00, 0x10, 0xFF, 0x6F,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xAF, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1E, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFD, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x05, 0x00, 0x00, 0xFE, 0x9F, 0x00, 0x00, 0x00, 0xFF, 0x7F,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xFB, 0xEF, 0x00, 0x00, 0x30, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0xD0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x08, 0x00, 0xD1, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xDF, 0xBA, 0xFF, 0xFF, 0x06,
+    0x00, 0x00, 0x30, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xAF, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0xE4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x77, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE8, 0x8E, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0xD0, 0xFF, 0xFF, 0x0C, 0xD0, 0xFF, 0xFF, 0x0C,
+    0x60, 0xFF, 0xFF, 0x09, 0x00, 0xFD, 0xFF, 0x03, 0x10, 0xFF, 0xCF, 0x00, 0x40, 0xFF, 0x5F, 0x00,
+    0x80, 0xFF, 0x0E, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0xF4, 0x8F, 0x00, 0x00,
+    0x10, 0x66, 0x01, 0xE3, 0xFF, 0x2E, 0xFB, 0xFF, 0xAF, 0xFE, 0xFF, 0xDF, 0xFB, 0xFF, 0xAF, 0xE2,
+    0xFF, 0x2E, 0x10, 0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF,
+    0x1F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0xF3, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0xD0, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0xFE, 0xCE, 0x27, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xBF, 0x25, 0x94, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xFB,
+    0xFF, 0x09, 0x00, 0x00, 0xF5, 0xFF, 0x0E, 0x00, 0x30, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x90, 0xFF,
+    0x7F, 0x00, 0x90, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xDF, 0x00, 0xD0, 0xFF, 0x0F, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0xF1, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x06,
+    0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x08, 0xF6, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0x0B, 0xF8, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF9, 0xFF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x0D, 0xFA, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0x0E, 0xFB, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xFA, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0x0E, 0xFA, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x0E,
+    0xF9, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF7, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0x0C, 0xF5, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x09, 0xF3, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x07, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFB,
+    0xFF, 0x03, 0xB0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x60, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x50, 0xFF, 0xAF, 0x00, 0x00, 0xFE, 0xFF, 0x02, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00,
+    0x00, 0xF7, 0xFF, 0x3E, 0x00, 0x20, 0xFC, 0xFF, 0x0B, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xAD, 0xFC,
+    0xFF, 0xEF, 0x01, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFE, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x76, 0x46, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x20, 0xFC,
+    0xFF, 0xEF, 0xFA, 0xFF, 0x07, 0xF4, 0xFF, 0xFF, 0x1A, 0xF6, 0xFF, 0x07, 0xE1, 0xFF, 0x4D, 0x00,
+    0xF6, 0xFF, 0x07, 0x60, 0x8F, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x02, 0x00, 0x00, 0xF6, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x83,
+    0xFC, 0xFF, 0x8C, 0x02, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x30,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF3, 0xFF, 0xDF, 0x36, 0x42, 0xFA, 0xFF, 0x8F,
+    0x00, 0xFB, 0xFF, 0x08, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x02, 0xA0, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x1D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF,
+    0x7F, 0x22, 0x22, 0x22, 0x22, 0x22, 0x12, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x2F, 0x00, 0x00, 0x30, 0xC8, 0xFE, 0xCE, 0x28, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0x5A, 0x23, 0xA4, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xFA, 0x3D, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0x0E, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x10, 0x32, 0xD6,
+    0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0xFF, 0x9D, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xBF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFC, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF,
+    0xFF, 0x01, 0x20, 0xCD, 0x01, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xBF, 0x00, 0xE2, 0xFF, 0x7F, 0x01,
+    0x00, 0x20, 0xFB, 0xFF, 0x3F, 0x00, 0x90, 0xFF, 0xFF, 0xCF, 0xAA, 0xFD, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x10, 0xE9, 0xFF, 0xFF, 0xFF,
+    0x9F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x77, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDF, 0x00, 0x00, 0xF1, 0xFF, 0x04, 0x00,
+    0x00, 0x60, 0xFF, 0x6F, 0x00, 0x00, 0xF1, 0xFF, 0x04, 0x00, 0x00, 0xD0, 0xFF, 0x0F, 0x00, 0x00,
+    0xF2, 0xFF, 0x04, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF3, 0xFF, 0x04, 0x00, 0x00, 0xFB,
+    0xFF, 0x02, 0x00, 0x00, 0xF3, 0xFF, 0x04, 0x00, 0x20, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xF4, 0xFF,
+    0x04, 0x00, 0x90, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x04, 0x00, 0xF1, 0xFF, 0x2E, 0x22,
+    0x22, 0x22, 0xF7, 0xFF, 0x26, 0x22, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFF,
+    0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAF,
+    0xB6, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0xFF, 0xBF, 0x25, 0x00, 0x93, 0xFF, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xDF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xAF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0x6F, 0x70, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x0E, 0xF7, 0xFF, 0x29, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0x05, 0xF4, 0xFF, 0xFF, 0xBD, 0xCA, 0xFF, 0xFF, 0x9F, 0x00, 0x30, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x65, 0x67, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xEA, 0xFF, 0xAD, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x00, 0xF6, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x5B, 0x32, 0xA5, 0x9F, 0x00, 0x00,
+    0x00, 0xE1, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x08, 0x20,
+    0xD9, 0xFF, 0x8C, 0x01, 0x00, 0x00, 0xF6, 0xFF, 0x05, 0xF8, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0xF8, 0xFF, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFA, 0xCF, 0x36, 0x52,
+    0xFC, 0xFF, 0x2F, 0x00, 0xFA, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xA0, 0xFF, 0xAF, 0x00, 0xFB, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x00, 0xFA, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xFA,
+    0xFF, 0x04, 0xF9, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x07, 0xF9, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0x08, 0xF6, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x08,
+    0xF4, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0xF1, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x05, 0xD0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x02, 0x80, 0xFF,
+    0x5F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xDF, 0x00, 0x10, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xA0, 0xFF,
+    0x6F, 0x00, 0x00, 0xF9, 0xFF, 0x2C, 0x00, 0x00, 0xF9, 0xFF, 0x0D, 0x00, 0x00, 0xD0, 0xFF, 0xFF,
+    0xAC, 0xFB, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x76, 0x47,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xEF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0,
+    0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE6, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x66, 0x01, 0xE3, 0xFF, 0x2E, 0xFB, 0xFF, 0xAF, 0xFE, 0xFF, 0xDF, 0xFB, 0xFF,
+    0xAF, 0xE2, 0xFF, 0x2E, 0x10, 0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x66, 0x01, 0xE3, 0xFF, 0x2E, 0xFB, 0xFF, 0xAF, 0xFE, 0xFF, 0xDF, 0xFB, 0xFF, 0xAF, 0xE2, 0xFF,
+    0x2E, 0x10, 0x66, 0x01, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xEF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xFC, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xFF, 0x3F, 0xF7, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xFF, 0x0E, 0xF2, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x09, 0xD0, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x04, 0x90, 0xFF, 0x2F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF9, 0xFF, 0x00, 0x40, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0xAF, 0x00, 0x00, 0xFE, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x5F, 0x00, 0x00, 0xFA,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0xF5, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x0C, 0x00, 0x00, 0xF0, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0x07, 0x00, 0x00, 0xB0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x02, 0x00, 0x00, 0x60,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xDF, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00,
+    0x00, 0xF5, 0xFF, 0x26, 0x22, 0x22, 0x22, 0x22, 0xA2, 0xFF, 0x4F, 0x00, 0x00, 0xFB, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x9F, 0x00, 0x00, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFF, 0xEF, 0x00, 0x50, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03,
+    0xA0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x08, 0xE0, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0D, 0xF4, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0x2F, 0xF9, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x7F,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xEE, 0x9B, 0x15, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x19, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0xFD, 0xFF,
+    0x23, 0x22, 0x42, 0xA6, 0xFF, 0xFF, 0x2F, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xD2, 0xFF,
+    0xAF, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x00, 0xFD, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0xFE, 0xFF, 0x02, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x03,
+    0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0xCF, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x4F, 0x00, 0xFD, 0xFF,
+    0x02, 0x00, 0x10, 0x94, 0xFF, 0xFF, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D,
+    0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0xFD, 0xFF, 0x23, 0x22, 0x22, 0x84, 0xFD, 0xFF, 0x7F, 0x00,
+    0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x06, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x0E, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x3F, 0xFD, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x6F, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xB0,
+    0xFF, 0x7F, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x6F, 0xFD, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x4F, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x0F,
+    0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x09, 0xFD, 0xFF, 0x23, 0x22, 0x32, 0x85,
+    0xFC, 0xFF, 0xEF, 0x01, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xBE, 0x59, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x75, 0x67, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFD, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x3D, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xBE, 0xBA, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x50,
+    0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x40, 0xFC, 0x2F, 0x00, 0x00, 0xF2, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x04, 0x00, 0x00, 0xFA, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF6, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x50, 0x1D, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x40, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF,
+    0xBE, 0xBA, 0xFE, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x50, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x75, 0x67, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x77, 0x35, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFB, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x10,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xCF, 0xBA, 0xFC,
+    0xFF, 0xFF, 0x2E, 0x00, 0x20, 0xFE, 0xFF, 0x6E, 0x00, 0x00, 0x10, 0xE7, 0xFF, 0x08, 0x00, 0xD0,
+    0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x10, 0x9B, 0x00, 0x00, 0xF8, 0xFF, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x21, 0x22, 0x22, 0x22,
+    0x12, 0xFA, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xBF, 0xFA, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF,
+    0xFF, 0xBF, 0xF9, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xBF, 0xF8, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xBF, 0xF6, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xBF, 0xF3, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xBF, 0xF0, 0xFF,
+    0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xBF, 0xB0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xFF, 0xBF, 0x50, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xBF, 0x00,
+    0xFE, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xBF, 0x00, 0xF4, 0xFF, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xFF, 0xBF, 0x00, 0x90, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x10, 0xD6, 0xFF, 0xBF,
+    0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xBD, 0xBA, 0xFD, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x70, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x91, 0xFE, 0xFF, 0xFF, 0xFF, 0xCF, 0x17,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x65, 0x67, 0x35, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xD0,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF6, 0xEF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFE,
+    0xDF, 0x00, 0x00, 0xF7, 0xCF, 0xFB, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xEF, 0xFA, 0xEF, 0x00,
+    0x00, 0xF9, 0xCF, 0xF7, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFA, 0x9F, 0xFA, 0xFF, 0x00, 0x00, 0xFA,
+    0xCF, 0xF2, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x5F, 0xF9, 0xFF, 0x01, 0x00, 0xFB, 0xBF, 0xD0,
+    0xFF, 0x0B, 0x00, 0x00, 0x30, 0xFF, 0x0F, 0xF8, 0xFF, 0x02, 0x00, 0xFD, 0xBF, 0x80, 0xFF, 0x0F,
+    0x00, 0x00, 0x80, 0xFF, 0x0B, 0xF7, 0xFF, 0x03, 0x00, 0xFE, 0xAF, 0x30, 0xFF, 0x4F, 0x00, 0x00,
+    0xC0, 0xFF, 0x07, 0xF6, 0xFF, 0x05, 0x00, 0xFF, 0x9F, 0x00, 0xFE, 0x9F, 0x00, 0x00, 0xF1, 0xFF,
+    0x02, 0xF5, 0xFF, 0x06, 0x10, 0xFF, 0x8F, 0x00, 0xFA, 0xDF, 0x00, 0x00, 0xF5, 0xEF, 0x00, 0xF4,
+    0xFF, 0x07, 0x20, 0xFF, 0x7F, 0x00, 0xF5, 0xFF, 0x02, 0x00, 0xF9, 0x9F, 0x00, 0xF3, 0xFF, 0x09,
+    0x30, 0xFF, 0x6F, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0xFD, 0x4F, 0x00, 0xF1, 0xFF, 0x0A, 0x50, 0xFF,
+    0x5F, 0x00, 0xB0, 0xFF, 0x0B, 0x20, 0xFF, 0x0F, 0x00, 0xF0, 0xFF, 0x0B, 0x60, 0xFF, 0x4F, 0x00,
+    0x60, 0xFF, 0x0F, 0x60, 0xFF, 0x0B, 0x00, 0xF0, 0xFF, 0x0D, 0x70, 0xFF, 0x3F, 0x00, 0x10, 0xFF,
+    0x4F, 0xB0, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0x0E, 0x90, 0xFF, 0x1F, 0x00, 0x00, 0xFC, 0x9F, 0xF0,
+    0xFF, 0x02, 0x00, 0xC0, 0xFF, 0x0F, 0xA0, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xDF, 0xF3, 0xDF, 0x00,
+    0x00, 0xB0, 0xFF, 0x1F, 0xB0, 0xFF, 0x0F, 0x00, 0x00, 0xF3, 0xFF, 0xFA, 0x9F, 0x00, 0x00, 0xA0,
+    0xFF, 0x2F, 0xC0, 0xFF, 0x0E, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x90, 0xFF, 0x3F,
+    0xE0, 0xFF, 0x0D, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0x4F, 0xF0, 0xFF,
+    0x0B, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x60, 0xFF, 0x6F, 0xF0, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x50, 0xFF, 0x7F, 0xF2, 0xFF, 0x09, 0x00, 0x00, 0x00,
+    0xB8, 0xBB, 0x02, 0x00, 0x00, 0x40, 0xFF, 0x8F, 0xF3, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xFF, 0xAF, 0xF4, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0xBF, 0xF6, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xCF, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0x9C, 0x16, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00,
+    0xFD, 0xFF, 0x23, 0x22, 0x43, 0xC7, 0xFF, 0xFF, 0x3F, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xDF, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x04, 0xFD, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x09, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF7,
+    0xFF, 0x0C, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x0D, 0xFD, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0xFF, 0x0D, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0B,
+    0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x08, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0x03, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xCF, 0x00, 0xFD, 0xFF,
+    0x02, 0x00, 0x20, 0x95, 0xFF, 0xFF, 0x3F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x03, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xBE, 0x17, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x23, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xEF, 0xAD, 0x27, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x06, 0x00, 0x00, 0xFD, 0xFF, 0x23, 0x22, 0x32, 0xA6, 0xFF, 0xFF, 0x4F, 0x00, 0x00,
+    0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xEF, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0x04, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07,
+    0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x09, 0x00, 0xFD, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0x09, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0x07, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x03, 0x00, 0xFD, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0xC1, 0xFF, 0xDF, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x10, 0x83, 0xFE, 0xFF,
+    0x3F, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0xFD, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x23, 0x22, 0xF4, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xFF, 0x02, 0x00, 0xB0, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x20, 0xFF,
+    0xFF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0xFA, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0x02, 0x00, 0x00, 0xF1, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00,
+    0x80, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x07, 0x00,
+    0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x1F, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0x9F, 0x00, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF,
+    0x02, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x0B, 0x00, 0xFD, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x5F, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0xDF, 0x00, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4,
+    0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D,
+    0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF,
+    0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2,
+    0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF4, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0x0D, 0xF3, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0D, 0xF3,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0C, 0xF1, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0xFF, 0x0B, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x08,
+    0xA0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x30, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x90, 0xFF, 0xCF, 0x00, 0x00, 0xFA, 0xFF, 0x5E, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0x3F,
+    0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xBF, 0xBA, 0xFD, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x10, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0x9E, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x65, 0x77, 0x36, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x0C, 0xF4, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFF, 0x07, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0x02, 0xA0, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xDF, 0x00, 0x50, 0xFF, 0xCF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0x2F, 0x00, 0x00, 0xFA, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0D,
+    0x00, 0x00, 0xF5, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x08, 0x00, 0x00, 0xF0, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x03, 0x00, 0x00, 0xB0, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0xEF, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0xFF, 0x02, 0x00, 0x00, 0xB0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x07, 0x00, 0x00,
+    0xF0, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0B, 0x00, 0x00, 0xF5, 0xFF, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xFF, 0x5F, 0x00, 0x00, 0xFE, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x9F, 0x00, 0x30,
+    0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xEF, 0x00, 0x70, 0xFF, 0x1F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03, 0xC0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0x07, 0xF1, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0C, 0xF5,
+    0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x1F, 0xFA, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x6F, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xDF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x04, 0xFA, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0x30, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0xF7, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x70, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDF, 0x00, 0xF4, 0xFF, 0x08, 0x00,
+    0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xAF, 0x00, 0xF0, 0xFF, 0x0B,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x7F, 0x00, 0xD0, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFB, 0x8F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x4F, 0x00, 0xA0,
+    0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF5, 0xCF, 0xF7, 0xBF, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x1F, 0x00,
+    0x70, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xF8, 0x9F, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x0D,
+    0x00, 0x30, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x5F, 0xF0, 0xFF, 0x02, 0x00, 0x00, 0xD0, 0xFF,
+    0x0A, 0x00, 0x00, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFF, 0x2F, 0xC0, 0xFF, 0x06, 0x00, 0x00, 0xF0,
+    0xFF, 0x07, 0x00, 0x00, 0xFD, 0xDF, 0x00, 0x00, 0x30, 0xFF, 0x0E, 0x90, 0xFF, 0x0A, 0x00, 0x00,
+    0xF3, 0xFF, 0x04, 0x00, 0x00, 0xFA, 0xFF, 0x00, 0x00, 0x60, 0xFF, 0x0B, 0x50, 0xFF, 0x0D, 0x00,
+    0x00, 0xF6, 0xFF, 0x01, 0x00, 0x00, 0xF7, 0xFF, 0x02, 0x00, 0xA0, 0xFF, 0x07, 0x20, 0xFF, 0x1F,
+    0x00, 0x00, 0xF9, 0xDF, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x05, 0x00, 0xD0, 0xFF, 0x03, 0x00, 0xFE,
+    0x4F, 0x00, 0x00, 0xFC, 0xAF, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x08, 0x00, 0xF1, 0xFF, 0x00, 0x00,
+    0xFB, 0x8F, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x0B, 0x00, 0xF4, 0xCF, 0x00,
+    0x00, 0xF7, 0xBF, 0x00, 0x20, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x0E, 0x00, 0xF7, 0x9F,
+    0x00, 0x00, 0xF4, 0xFF, 0x00, 0x50, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x1F, 0x00, 0xFB,
+    0x5F, 0x00, 0x00, 0xF0, 0xFF, 0x02, 0x80, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x4F, 0x00,
+    0xFE, 0x2F, 0x00, 0x00, 0xD0, 0xFF, 0x06, 0xB0, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x7F,
+    0x20, 0xFF, 0x0E, 0x00, 0x00, 0x90, 0xFF, 0x0A, 0xE0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFD,
+    0xAF, 0x50, 0xFF, 0x0B, 0x00, 0x00, 0x60, 0xFF, 0x0D, 0xF1, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xDF, 0x90, 0xFF, 0x07, 0x00, 0x00, 0x20, 0xFF, 0x1F, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xC0, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xF7, 0xDF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFF, 0xF3, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x8F, 0xFA, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0xF9, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0xFD, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF,
+    0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x76, 0x67, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0x01, 0x00, 0x00, 0xF0, 0xFF, 0xCF, 0xAA, 0xEB, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x70,
+    0x26, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x20, 0xB7, 0xFD, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x10, 0xFE,
+    0xFF, 0xBF, 0x36, 0x22, 0x32, 0xFF, 0xCF, 0x00, 0x80, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x10, 0xFF,
+    0xCF, 0x00, 0xD0, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xCF, 0x00, 0xF0, 0xFF, 0x1F, 0x00,
+    0x00, 0x00, 0x10, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xCF, 0x00,
+    0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xCF, 0x00, 0xE0, 0xFF, 0x6F, 0x00, 0x00, 0x00,
+    0xF3, 0xFF, 0xDF, 0x00, 0x90, 0xFF, 0xEF, 0x03, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x03, 0x10, 0xFF,
+    0xFF, 0xDF, 0xBA, 0xFE, 0xEF, 0xF7, 0xFF, 0x4E, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xD0,
+    0xFF, 0x5F, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0xAF, 0x01, 0x20, 0xFC, 0x0F, 0x00, 0x00, 0x20, 0x76,
+    0x56, 0x01, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x35, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x40, 0x77, 0x15, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
+    0x2B, 0xE0, 0xFF, 0x0F, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0x0F, 0x00, 0xD0,
+    0xFF, 0xFF, 0xBE, 0xDB, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xF9, 0xFF, 0x6F, 0x00, 0x00, 0xE4, 0xFF,
+    0xFF, 0x0F, 0x10, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x0F, 0x80, 0xFF, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0F, 0xD0, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F,
+    0xF1, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF3, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0x0F, 0xF5, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF6, 0xFF,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF6, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0x0F, 0xF5, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF4, 0xFF, 0x0D, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF1, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F,
+    0xE0, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xA0, 0xFF, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0x0F, 0x40, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0x0F, 0x00, 0xFC,
+    0xFF, 0x3E, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0x0F, 0x00, 0xF2, 0xFF, 0xFF, 0xAD, 0xEB, 0xFF, 0xBB,
+    0xFF, 0x0F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x90, 0xFF, 0x0F, 0x00, 0x00, 0xB2, 0xFF,
+    0xFF, 0xEF, 0x08, 0x70, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x52, 0x67, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x76, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF,
+    0xBF, 0x02, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0xD1,
+    0xFF, 0xFF, 0xAC, 0xEB, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xFA, 0xFF, 0x1B, 0x00, 0x00, 0xF6, 0xFF,
+    0x1E, 0x00, 0x30, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x7F, 0x00, 0xA0, 0xFF, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xDF, 0x00, 0xF0, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01,
+    0xF3, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x05, 0xF6, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0xFF, 0x07, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF9, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0xF8, 0xFF, 0x29, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0xF7, 0xFF, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0xFB,
+    0xFF, 0x6F, 0x00, 0x00, 0x30, 0xFA, 0x0D, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0xBE, 0xBA, 0xFE, 0xFF,
+    0x8F, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x70, 0xFE,
+    0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x75, 0x67, 0x03, 0x00, 0x00, 0x00,
+    0xA0, 0xEE, 0x07, 0xF9, 0xFF, 0x4F, 0xFC, 0xFF, 0x7F, 0xF9, 0xFF, 0x4F, 0xA0, 0xEF, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C,
+    0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0,
+    0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF,
+    0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C, 0xF0, 0xFF, 0x0C,
+    0xF0, 0xFF, 0x0C, 0x81, 0xCA, 0x07, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09,
+    0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00,
+    0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00,
+    0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4,
+    0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF,
+    0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09,
+    0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00,
+    0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00,
+    0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF4, 0xFF, 0x09, 0x00, 0x00, 0xF3, 0xFF, 0x09, 0x00, 0x00, 0xF2,
+    0xFF, 0x0B, 0x00, 0x00, 0xF0, 0xFF, 0xBF, 0x7B, 0x00, 0x80, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0xFA,
+    0xFF, 0xFF, 0x03, 0x00, 0x20, 0x76, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x51, 0x77, 0x05, 0x00, 0x00, 0xF0, 0xFF, 0x04, 0x80, 0xFF, 0xFF, 0xEF, 0x04, 0x00,
+    0x80, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0xF0, 0xFF, 0x16, 0xFC, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xFB,
+    0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF0, 0xFF, 0xB7, 0xFF, 0xBE, 0xFB, 0xFF, 0xEF, 0xA0, 0xFF, 0xBE,
+    0xEB, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xFE, 0x6F, 0x00, 0x10, 0xFD, 0xFF, 0xFB, 0x7F, 0x00, 0x10,
+    0xFC, 0xFF, 0x08, 0xF0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF4,
+    0xFF, 0x0C, 0xF0, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0x0E, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F,
+    0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00,
+    0x00, 0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00,
+    0xE0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0,
+    0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x40, 0x77, 0x26, 0x00, 0x00, 0xF0, 0xFF, 0x04, 0x60, 0xFE, 0xFF,
+    0xFF, 0x2C, 0x00, 0xF0, 0xFF, 0x06, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0xA7, 0xFF,
+    0xBF, 0xDA, 0xFF, 0xFF, 0x0C, 0xF0, 0xFF, 0xFE, 0x8F, 0x00, 0x00, 0xF4, 0xFF, 0x3F, 0xF0, 0xFF,
+    0xFF, 0x06, 0x00, 0x00, 0x80, 0xFF, 0x8F, 0xF0, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x9F,
+    0xF0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00,
+    0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF,
+    0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF,
+    0x00, 0x00, 0x00, 0x20, 0x75, 0x67, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x19, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xC0,
+    0xFF, 0xFF, 0xBE, 0xCA, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xFA, 0xFF, 0x5E, 0x00, 0x00, 0xB2, 0xFF,
+    0xEF, 0x01, 0x30, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x09, 0xA0, 0xFF, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0F, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x6F,
+    0xF4, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x9F, 0xF7, 0xFF, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xFF, 0xCF, 0xF8, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xDF, 0xF9, 0xFF,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0xF9, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0xFF, 0xFF, 0xF8, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xEF, 0xF7, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFF, 0xCF, 0xF4, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x9F,
+    0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x5F, 0xA0, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0xFF, 0x0F, 0x40, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x08, 0x00, 0xFA,
+    0xFF, 0x4E, 0x00, 0x00, 0xB2, 0xFF, 0xEF, 0x01, 0x00, 0xD1, 0xFF, 0xFF, 0xBE, 0xCA, 0xFF, 0xFF,
+    0x3F, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x60, 0xFD,
+    0xFF, 0xFF, 0xEF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x75, 0x67, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x76, 0x25, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x04, 0x80, 0xFF, 0xFF,
+    0xFF, 0x3C, 0x00, 0x00, 0xF0, 0xFF, 0x26, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF0, 0xFF,
+    0xD8, 0xFF, 0xBE, 0xEB, 0xFF, 0xFF, 0x2F, 0x00, 0xF0, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF5, 0xFF,
+    0xBF, 0x00, 0xF0, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x02, 0xF0, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0xFF, 0x07, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0B,
+    0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0E, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0xF0, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x2F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0x2F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0xF0, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xFF, 0x0F, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x0D,
+    0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0A, 0xF0, 0xFF, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0x04, 0xF0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xEF, 0x00, 0xF0, 0xFF,
+    0xFF, 0x19, 0x00, 0x00, 0xF8, 0xFF, 0x6F, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xAC, 0xFB, 0xFF, 0xFF,
+    0x0B, 0x00, 0xF0, 0xFF, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0xE6,
+    0xFF, 0xFF, 0xEF, 0x08, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x64, 0x67, 0x04, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xCE, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x67,
+    0x03, 0xF0, 0xFF, 0x04, 0x80, 0xFF, 0xFF, 0x08, 0xF0, 0xFF, 0x05, 0xF9, 0xFF, 0xFF, 0x06, 0xF0,
+    0xFF, 0x47, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xC8, 0xFF, 0x8C, 0xD9, 0x00, 0xF0, 0xFF, 0xFC,
+    0x5F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0xF0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0,
+    0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x77,
+    0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0x9F, 0x02, 0x00, 0x00, 0xE2, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x10, 0xFE, 0xFF, 0xDF, 0xAB, 0xFC, 0xFF, 0xFF, 0x02, 0x90,
+    0xFF, 0xDF, 0x03, 0x00, 0x00, 0xC5, 0x6F, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xAF,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x6B, 0x01, 0x00, 0x00, 0x00, 0x30,
+    0xFC, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x30, 0xD9, 0xFF, 0xFF, 0xFF, 0x3E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x72, 0xFD, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x0E, 0x30, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0xFF, 0x0C, 0xE1, 0xDF, 0x06, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x06, 0xFB,
+    0xFF, 0xFF, 0xBC, 0xCA, 0xFF, 0xFF, 0xCF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B,
+    0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x30, 0x75, 0x67, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x21, 0x22, 0xFD, 0xFF, 0x22,
+    0x22, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x0A, 0x00, 0x41, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xDF,
+    0xCA, 0xFF, 0x02, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xF7, 0xFF,
+    0xFF, 0xDF, 0x05, 0x00, 0x00, 0x00, 0x10, 0x75, 0x67, 0x02, 0x00, 0xF6, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xEF, 0x00, 0xF1, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x9F,
+    0x00, 0xB0, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x4F, 0x00, 0x60, 0xFF, 0x9F, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0E, 0x00, 0x10, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF,
+    0x09, 0x00, 0x00, 0xFB, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x04, 0x00, 0x00, 0xF6, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0xFD, 0xEF, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x0C, 0x00, 0x00, 0x10, 0xFF,
+    0x9F, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x1F, 0x00, 0x00, 0x60, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x60,
+    0xFF, 0x6F, 0x00, 0x00, 0xB0, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xBF, 0x00, 0x00, 0xF0,
+    0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x00, 0x00, 0xF5, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0x05, 0x00, 0xF9, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x09, 0x00,
+    0xFE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x0E, 0x30, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0x3F, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x8F,
+    0xC0, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDF, 0xF1, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xFA, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x7B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+// GlyphProps[width, height, advance_x, left, top, compressed_size, data_offset, code_point]
+const GFXglyph FiraSansGlyphs_Glyphs[] = {
+    { 0, 0, 11, 0, 0, 0, 0 }, // ' '
+    { 32, 33, 34, 1, 31, 528, 0 }, // '%'
+    { 7, 12, 10, 1, 5, 48, 528 }, // ','
+    { 6, 7, 10, 2, 6, 21, 576 }, // '.'
+    { 14, 39, 22, 4, 34, 273, 597 }, // '/'
+    { 19, 30, 23, 2, 29, 300, 870 }, // '0'
+    { 13, 29, 18, 1, 29, 203, 1170 }, // '1'
+    { 18, 29, 21, 1, 29, 261, 1373 }, // '2'
+    { 19, 30, 21, 0, 29, 300, 1634 }, // '3'
+    { 20, 30, 22, 1, 30, 300, 1934 }, // '4'
+    { 18, 30, 21, 1, 29, 270, 2234 }, // '5'
+    { 19, 30, 22, 2, 29, 300, 2504 }, // '6'
+    { 17, 30, 19, 1, 29, 270, 2804 }, // '7'
+    { 6, 22, 10, 2, 21, 66, 3074 }, // ':'
+    { 24, 29, 24, 0, 29, 348, 3140 }, // 'A'
+    { 20, 29, 25, 4, 29, 290, 3488 }, // 'B'
+    { 21, 31, 23, 2, 30, 341, 3778 }, // 'C'
+    { 22, 31, 26, 2, 30, 341, 4119 }, // 'G'
+    { 28, 29, 32, 2, 29, 406, 4460 }, // 'M'
+    { 19, 29, 24, 4, 29, 290, 4866 }, // 'P'
+    { 21, 29, 25, 4, 29, 319, 5156 }, // 'R'
+    { 21, 30, 28, 3, 29, 330, 5475 }, // 'U'
+    { 23, 29, 23, 0, 29, 348, 5805 }, // 'V'
+    { 33, 29, 34, 1, 29, 493, 6153 }, // 'W'
+    { 20, 24, 23, 1, 23, 240, 6646 }, // 'a'
+    { 19, 33, 25, 2, 32, 330, 6886 }, // 'd'
+    { 19, 24, 23, 2, 23, 240, 7216 }, // 'e'
+    { 6, 33, 12, 3, 33, 99, 7456 }, // 'i'
+    { 9, 33, 12, 3, 32, 165, 7555 }, // 'l'
+    { 29, 23, 36, 3, 23, 345, 7720 }, // 'm'
+    { 18, 23, 24, 3, 23, 207, 8065 }, // 'n'
+    { 20, 24, 24, 2, 23, 240, 8272 }, // 'o'
+    { 20, 33, 25, 3, 23, 330, 8512 }, // 'p'
+    { 13, 23, 16, 3, 23, 161, 8842 }, // 'r'
+    { 17, 24, 19, 1, 23, 216, 9003 }, // 's'
+    { 16, 29, 15, 0, 28, 232, 9219 }, // 't'
+    { 21, 32, 21, 0, 22, 352, 9451 }, // 'y'
+};
+const GFXfont FiraSansGlyphs = {
+    (uint8_t *)FiraSansGlyphs_Bitmaps, // (*bitmap) Glyph bitmap pointer, all concatenated together
+    (GFXglyph *)FiraSansGlyphs_Glyphs, // glyphs Glyph array
+    (UnicodeInterval *)FiraSansGlyphs_Intervals, // intervals Valid unicode intervals for this font
+    17,   // interval_count Number of unicode intervals.intervals
+    0, // compressed Does this font use compressed glyph bitmaps?
+    50, // advance_y Newline distance (y axis)
+    39, // ascender Maximal height of a glyph above the base line
+    -12, // descender Maximal height of a glyph below the base line
+    FiraSansGlyphs_AsciiGlyphs, // ascii_glyphs Glyph index of each code point below 128
+    0, // format Glyph bitmap storage, FontFormat_t
+    0, // atlas_stride Bytes per atlas row
+    NULL, // kerning Sorted kerning pairs
+    0, // kerning_count Number of kerning pairs
+};
+/*
+Included intervals
+    ( 32, 32), ie. ' ' -  ' '
+    ( 37, 37), ie. '%' -  '%'
+    ( 44, 44), ie. ',' -  ','
+    ( 46, 55), ie. '.' -  '7'
+    ( 58, 58), ie. ':' -  ':'
+    ( 65, 67), ie. 'A' -  'C'
+    ( 71, 71), ie. 'G' -  'G'
+    ( 77, 77), ie. 'M' -  'M'
+    ( 80, 80), ie. 'P' -  'P'
+    ( 82, 82), ie. 'R' -  'R'
+    ( 85, 87), ie. 'U' -  'W'
+    ( 97, 97), ie. 'a' -  'a'
+    ( 100, 101), ie. 'd' -  'e'
+    ( 105, 105), ie. 'i' -  'i'
+    ( 108, 112), ie. 'l' -  'p'
+    ( 114, 116), ie. 'r' -  't'
+    ( 121, 121), ie. 'y' -  'y'
+
+*/
@@ -0,0 +1,454 @@
+#pragma once
+#include "epd_driver.h"
+/*
+Created with
+ fontconvert.py FiraSansZlib 20 FiraSans-Regular.ttf --format glyphs --compress --string World: Vanilla 1.20.6, CPU 37%, RAM 5.2/16 GB, Players 12/64, Uptime 3d 04:17:52
+As 'FiraSansZlib' with available 37 characters
+ %,./01234567:ABCGMPRUVWadeilmnoprsty
+*/
+const UnicodeInterval FiraSansZlib_Intervals[] = {
+    { 0x20, 0x20, 0x0 },
+    { 0x25, 0x25, 0x1 },
+    { 0x2C, 0x2C, 0x2 },
+    { 0x2E, 0x37, 0x3 },
+    { 0x3A, 0x3A, 0xD },
+    { 0x41, 0x43, 0xE },
+    { 0x47, 0x47, 0x11 },
+    { 0x4D, 0x4D, 0x12 },
+    { 0x50, 0x50, 0x13 },
+    { 0x52, 0x52, 0x14 },
+    { 0x55, 0x57, 0x15 },
+    { 0x61, 0x61, 0x18 },
+    { 0x64, 0x65, 0x19 },
+    { 0x69, 0x69, 0x1B },
+    { 0x6C, 0x70, 0x1C },
+    { 0x72, 0x74, 0x21 },
+    { 0x79, 0x79, 0x24 },
+};
+const uint16_t FiraSansZlib_AsciiGlyphs[128] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0002, 0xFFFF, 0x0003, 0x0004,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C,
+    0xFFFF, 0xFFFF, 0x000D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x000E, 0x000F, 0x0010, 0xFFFF, 0xFFFF, 0xFFFF, 0x0011,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0012, 0xFFFF, 0xFFFF,
+    0x0013, 0xFFFF, 0x0014, 0xFFFF, 0xFFFF, 0x0015, 0x0016, 0x0017,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x0018, 0xFFFF, 0xFFFF, 0x0019, 0x001A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x001B, 0xFFFF, 0xFFFF, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0xFFFF, 0x0021, 0x0022, 0x0023, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x0024, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+const uint8_t FiraSansZlib_Bitmaps[5295] = {
+    0x78, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x78, 0x9C, 0x55, 0x51, 0x4B, 0x52, 0xC2, 0x40,
+    0x14, 0x7C, 0x42, 0x0C, 0x7E, 0xD0, 0x8A, 0x17, 0x40, 0x36, 0xAE, 0xCD, 0x01, 0xAC, 0xD2, 0x1B,
+    0xC0, 0x0D, 0xB4, 0xBC, 0x80, 0xD9, 0xB9, 0x04, 0xBD, 0x00, 0x1E, 0xC0, 0x12, 0x17, 0xAC, 0xA5,
+    0xDC, 0xBA, 0x90, 0x23, 0xA8, 0x7B, 0xAB, 0x80, 0x2A, 0xF7, 0x11, 0x2D, 0xD1, 0xF0, 0x49, 0xDB,
+    0xEF, 0x4D, 0x02, 0x3A, 0x8B, 0xCE, 0xEB, 0x97, 0x9E, 0x37, 0xDD, 0x33, 0x22, 0xCB, 0xB5, 0x22,
+    0xFF, 0xD7, 0x9D, 0x35, 0x3A, 0xE9, 0xA3, 0x6F, 0xF4, 0x0A, 0xDB, 0x86, 0xC0, 0x93, 0xFD, 0xF8,
+    0xC4, 0x3A, 0x31, 0x21, 0xC7, 0x96, 0xF2, 0x79, 0x4C, 0x08, 0xD1, 0xDF, 0xEB, 0xA0, 0xC5, 0xAA,
+    0x89, 0x1A, 0xF1, 0x16, 0x15, 0x91, 0x69, 0x6C, 0xF2, 0x0D, 0xE2, 0x40, 0x37, 0x7D, 0xA1, 0xA8,
+    0x72, 0x9D, 0xF2, 0x8E, 0x55, 0x91, 0x11, 0xA1, 0x89, 0x63, 0x1D, 0x32, 0x82, 0xA7, 0x4D, 0x5F,
+    0x3E, 0xB0, 0x29, 0xF9, 0x7F, 0x85, 0x19, 0xEC, 0xD0, 0x01, 0xD6, 0x74, 0x54, 0x21, 0xC2, 0xD9,
+    0xD2, 0x54, 0x12, 0xE7, 0x72, 0xA9, 0xA2, 0x57, 0xB8, 0x40, 0x83, 0xF2, 0x82, 0x0B, 0xF1, 0xAD,
+    0xFE, 0xCA, 0x27, 0x6C, 0xB9, 0x15, 0x91, 0x76, 0x79, 0x4C, 0x39, 0x4F, 0x79, 0xF9, 0x7A, 0xED,
+    0xC9, 0x54, 0xE5, 0x3B, 0x8B, 0xE4, 0x75, 0x26, 0xA8, 0xCF, 0x70, 0x93, 0xCD, 0x90, 0x21, 0x13,
+    0x4E, 0xB8, 0xB1, 0x96, 0xF1, 0x09, 0x8A, 0x7A, 0x0F, 0xD0, 0x1C, 0x26, 0x6F, 0xD3, 0xD3, 0x41,
+    0x30, 0xCE, 0xA6, 0x0E, 0x69, 0x2A, 0xA1, 0xDF, 0x08, 0xFB, 0xC6, 0x13, 0x86, 0x9A, 0x77, 0x45,
+    0x02, 0x67, 0xFA, 0x88, 0x06, 0xC4, 0x0C, 0xA5, 0x0D, 0x97, 0xA9, 0x92, 0xF1, 0x79, 0xCB, 0xC9,
+    0x99, 0x39, 0x6D, 0x4B, 0xD6, 0x0C, 0xD1, 0x13, 0x77, 0x87, 0x21, 0x0E, 0x59, 0x3D, 0x63, 0x97,
+    0x38, 0xE6, 0x45, 0xBC, 0xD8, 0x8B, 0xFC, 0xC0, 0xB7, 0x6E, 0xFF, 0x01, 0x5A, 0x39, 0xB9, 0x54,
+    0x53, 0x0B, 0x2A, 0x0B, 0x13, 0xF7, 0xE4, 0x25, 0x2D, 0xDE, 0x4A, 0x2E, 0xC4, 0xE9, 0xB9, 0x67,
+    0xDF, 0xE0, 0xEF, 0x9B, 0xFF, 0x02, 0xAB, 0x42, 0xAA, 0x03, 0x78, 0x9C, 0x63, 0x78, 0xD1, 0xC7,
+    0xD0, 0xF0, 0xFF, 0x3F, 0xFB, 0x85, 0xFF, 0xFF, 0x79, 0x40, 0x38, 0xE1, 0xFF, 0x7F, 0x4E, 0x86,
+    0xBF, 0xFF, 0x99, 0x05, 0xFE, 0x9F, 0x67, 0x70, 0xF8, 0x1F, 0x0F, 0x94, 0xE3, 0x63, 0x38, 0xF0,
+    0x9F, 0x9D, 0xE1, 0xC3, 0x7F, 0x06, 0x86, 0x2F, 0xFD, 0x0C, 0x0C, 0x00, 0x8A, 0x06, 0x18, 0x57,
+    0x78, 0x9C, 0x13, 0x48, 0x63, 0x7C, 0xFC, 0x5F, 0xEF, 0xF7, 0xFF, 0xF5, 0xFF, 0xFE, 0xDF, 0x07,
+    0x92, 0x8F, 0xFE, 0xEB, 0x09, 0xA4, 0x31, 0x02, 0x00, 0x93, 0xE2, 0x0D, 0x3C, 0x78, 0x9C, 0x55,
+    0xCF, 0xCD, 0x15, 0xC1, 0x40, 0x14, 0xC5, 0xF1, 0xF1, 0x15, 0x11, 0x84, 0x0E, 0xA4, 0x83, 0xE8,
+    0x20, 0x5B, 0x4B, 0x1D, 0xD0, 0x01, 0x1D, 0xD0, 0x81, 0x74, 0x40, 0x07, 0x4A, 0xA0, 0x03, 0xD9,
+    0x58, 0x47, 0x07, 0x38, 0xE1, 0x70, 0xC8, 0x71, 0xB9, 0xEF, 0xAE, 0xCC, 0xE2, 0xFD, 0x36, 0xF3,
+    0xE6, 0xFC, 0xC7, 0xB9, 0xDF, 0x19, 0x55, 0x38, 0x87, 0x88, 0xC9, 0x12, 0x21, 0xD9, 0x23, 0x20,
+    0x17, 0x78, 0xE4, 0x86, 0x2A, 0x79, 0x9E, 0x39, 0x5D, 0xB9, 0xE5, 0xEC, 0x63, 0x46, 0xC6, 0x5A,
+    0x4B, 0xD1, 0x25, 0x19, 0x5A, 0xE4, 0x8A, 0x06, 0xB9, 0xC3, 0x5E, 0x7E, 0xE5, 0xB6, 0xF6, 0x59,
+    0x73, 0x46, 0x98, 0x90, 0x29, 0x06, 0x64, 0x83, 0x0E, 0x39, 0xC1, 0x27, 0x05, 0xEA, 0xE4, 0x01,
+    0xBB, 0xFF, 0x3E, 0x18, 0x58, 0xA9, 0x2E, 0x21, 0x73, 0xF4, 0x54, 0xD7, 0x56, 0x5D, 0x53, 0x75,
+    0x35, 0xAB, 0xD3, 0x5A, 0xB9, 0x53, 0xDD, 0xE2, 0xAF, 0x2E, 0x54, 0x5D, 0xA0, 0x3A, 0x4F, 0x75,
+    0xF6, 0xA9, 0xA3, 0x3E, 0xE5, 0x22, 0x9B, 0x5F, 0x87, 0xDF, 0x40, 0xC2, 0x78, 0x9C, 0x45, 0x90,
+    0x3D, 0x12, 0x01, 0x41, 0x10, 0x85, 0xDF, 0xFA, 0xFF, 0x5F, 0x47, 0xD8, 0x44, 0x49, 0x9D, 0x80,
+    0x4C, 0xEC, 0x08, 0x6E, 0x40, 0x24, 0x75, 0x05, 0x81, 0xDC, 0x09, 0x94, 0x8D, 0xA4, 0x6E, 0xA0,
+    0xDC, 0x80, 0x40, 0xEE, 0x67, 0x2D, 0x96, 0xAD, 0x7D, 0xFA, 0x6D, 0x15, 0xBA, 0x66, 0x6A, 0xBE,
+    0x99, 0x37, 0xDD, 0xF5, 0xBA, 0x01, 0xAC, 0x93, 0x6D, 0x1B, 0x8A, 0x23, 0x2D, 0x8A, 0x06, 0x03,
+    0x01, 0x17, 0x46, 0x57, 0x6E, 0x5A, 0x73, 0xB2, 0x00, 0xBC, 0x59, 0x06, 0x42, 0x36, 0xD0, 0xE1,
+    0xDE, 0x84, 0x19, 0xA7, 0xB6, 0x47, 0x46, 0x9E, 0xDD, 0x77, 0x74, 0x55, 0x20, 0xA6, 0x73, 0x61,
+    0x5D, 0x14, 0xB1, 0x70, 0x63, 0x45, 0x74, 0x67, 0xC9, 0x96, 0xE8, 0xC6, 0xEA, 0x53, 0x95, 0x54,
+    0xB5, 0x1E, 0x31, 0x2F, 0xB2, 0xEF, 0xAF, 0x2F, 0x35, 0xDE, 0xCC, 0x89, 0xCE, 0x74, 0xFF, 0x6F,
+    0x7F, 0x8A, 0x7E, 0xB9, 0x8F, 0xD4, 0x24, 0x02, 0xD6, 0x42, 0x99, 0x92, 0xAD, 0x72, 0xC0, 0xAA,
+    0xC8, 0xA4, 0xB3, 0x79, 0x84, 0xFC, 0x66, 0x7D, 0xF6, 0x44, 0x24, 0x86, 0x69, 0x33, 0x03, 0xAE,
+    0x80, 0x84, 0x19, 0xE0, 0x20, 0xE5, 0xC1, 0x2E, 0xBC, 0x58, 0x79, 0x3E, 0xB9, 0x8C, 0x79, 0x72,
+    0x80, 0x66, 0xAC, 0xCE, 0xBB, 0x4A, 0x1B, 0x27, 0x36, 0x02, 0x27, 0x1D, 0x4C, 0x67, 0xD2, 0xD7,
+    0xF1, 0x01, 0x07, 0x1F, 0x7B, 0x7C, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x10, 0xF8, 0xF5, 0x9F, 0x9D,
+    0x81, 0x81, 0xE1, 0xE9, 0x7F, 0x10, 0xB5, 0xF1, 0x3F, 0x88, 0x4A, 0xF8, 0x0F, 0xA2, 0x14, 0xFE,
+    0xFC, 0x7F, 0x0F, 0x94, 0xFB, 0xF2, 0xFF, 0xBF, 0xD4, 0xB7, 0xFF, 0xEC, 0x0F, 0xFF, 0xFB, 0x32,
+    0x00, 0xA9, 0x84, 0x7E, 0x06, 0x10, 0xC5, 0xC0, 0x04, 0xA1, 0x18, 0x06, 0x0F, 0x05, 0x00, 0x46,
+    0x9B, 0x47, 0xE7, 0x78, 0x9C, 0x55, 0x8D, 0x41, 0x0A, 0xC2, 0x30, 0x10, 0x45, 0x3F, 0x51, 0x41,
+    0xAC, 0x82, 0xB8, 0x17, 0xC4, 0x0B, 0xD8, 0x95, 0x5B, 0xC1, 0x0B, 0xB4, 0x37, 0xF1, 0x08, 0x11,
+    0xDC, 0x0A, 0x5E, 0x41, 0x6F, 0xE0, 0x4D, 0xD4, 0x13, 0x14, 0x7A, 0x01, 0xC1, 0xD6, 0x0A, 0xD1,
+    0xFA, 0x4D, 0x26, 0xC9, 0xC2, 0xB7, 0xF9, 0x2F, 0x93, 0xF9, 0x0C, 0xB0, 0xFB, 0x70, 0xAF, 0x00,
+    0x9C, 0x68, 0x39, 0x00, 0xE9, 0xD7, 0x09, 0x13, 0x54, 0x2C, 0x96, 0x6B, 0x63, 0x47, 0x6F, 0xF6,
+    0x81, 0x9C, 0x54, 0x47, 0x6D, 0xF7, 0x60, 0xEC, 0xB3, 0xEB, 0xA4, 0xE6, 0x10, 0xC2, 0x83, 0x23,
+    0x2F, 0x55, 0x94, 0xDA, 0xF6, 0x85, 0x97, 0xEB, 0x3A, 0x5A, 0x4A, 0x07, 0x29, 0x0B, 0x3F, 0x38,
+    0x73, 0xE3, 0xA5, 0x09, 0xA5, 0x19, 0xD9, 0x11, 0xB9, 0x52, 0xFB, 0x1F, 0xC3, 0x81, 0xE4, 0x96,
+    0x97, 0xB8, 0x3A, 0x95, 0xCC, 0x79, 0x57, 0xE1, 0xE0, 0xEA, 0xBF, 0x5B, 0x32, 0x93, 0x1C, 0xB7,
+    0xEC, 0x89, 0xDC, 0xA8, 0xE7, 0x8E, 0xC9, 0x93, 0x1E, 0xDD, 0x04, 0xC9, 0xA2, 0x2C, 0x7E, 0xE4,
+    0x11, 0x5F, 0x53, 0x78, 0x9C, 0x63, 0x60, 0x30, 0x38, 0xF1, 0xEF, 0x9C, 0x06, 0x03, 0x10, 0x18,
+    0xFC, 0xF9, 0x0F, 0x04, 0xEC, 0x40, 0xD6, 0x77, 0x10, 0xE3, 0xFF, 0x7A, 0x06, 0x86, 0x80, 0xFF,
+    0xFF, 0xA3, 0x94, 0x97, 0x80, 0x05, 0x7F, 0xD9, 0x02, 0x25, 0xBE, 0xFE, 0xE7, 0x63, 0x60, 0x68,
+    0x00, 0x29, 0x5E, 0xF0, 0x3F, 0x9E, 0x01, 0x02, 0x02, 0xFE, 0xF7, 0x43, 0x59, 0x06, 0xFF, 0xE7,
+    0x43, 0x59, 0x0E, 0x70, 0xB1, 0x02, 0xB8, 0xBA, 0x0B, 0x20, 0xBD, 0x60, 0xF0, 0xEB, 0x3F, 0x1B,
+    0x88, 0x12, 0x30, 0xBA, 0xF6, 0xBF, 0x1E, 0x2C, 0x70, 0xE0, 0xFF, 0xFF, 0xF3, 0xCC, 0x60, 0xD6,
+    0x83, 0xFF, 0xFF, 0xE7, 0x42, 0x58, 0x1F, 0x80, 0x2E, 0xD8, 0xCF, 0x08, 0xD1, 0x10, 0xF4, 0xE7,
+    0xBF, 0x1C, 0x54, 0xEF, 0x04, 0x90, 0xB3, 0x20, 0xE0, 0xDF, 0x7F, 0x46, 0xB8, 0x81, 0xAC, 0x50,
+    0xD6, 0x0F, 0xB0, 0xFB, 0x51, 0x59, 0xBF, 0x81, 0xB2, 0x60, 0x95, 0x02, 0xFF, 0xFF, 0x33, 0x2A,
+    0x9C, 0x65, 0x04, 0xBB, 0x7E, 0x3F, 0xC3, 0xA3, 0xFF, 0xF5, 0x8C, 0x0C, 0x0A, 0xBF, 0xFF, 0xDB,
+    0x03, 0xCD, 0xFC, 0x7F, 0x7E, 0xD5, 0x5F, 0xB0, 0x2F, 0x21, 0x3E, 0xCF, 0x07, 0x29, 0x7E, 0x09,
+    0x64, 0xCC, 0x67, 0x02, 0x9B, 0x10, 0x5C, 0x6E, 0x06, 0xA2, 0x00, 0x71, 0xAE, 0x5F, 0x14, 0x78,
+    0x9C, 0x63, 0x60, 0x40, 0x06, 0x8F, 0x25, 0x60, 0xAC, 0x5F, 0xFF, 0x19, 0x21, 0x0C, 0x81, 0xFF,
+    0xFB, 0xA1, 0x42, 0x0D, 0xFF, 0xFD, 0xA1, 0xAC, 0x07, 0xFF, 0x79, 0xA1, 0xAC, 0x6F, 0xFF, 0xD9,
+    0xA0, 0xAC, 0xBF, 0xFF, 0xA1, 0x0C, 0x87, 0xFF, 0xF3, 0xA1, 0xAC, 0x0D, 0xFF, 0xF5, 0xA1, 0xAC,
+    0x4F, 0xFF, 0xB9, 0xA1, 0xAC, 0x9F, 0xFF, 0x59, 0xA0, 0xAC, 0xFF, 0xF7, 0x19, 0x18, 0x3E, 0x82,
+    0x78, 0x09, 0xFF, 0xF3, 0xA1, 0xAC, 0x0B, 0xFF, 0xF9, 0x41, 0x6A, 0x81, 0xAC, 0x2F, 0xFF, 0x39,
+    0x19, 0x18, 0x3E, 0x83, 0x58, 0xBF, 0xFF, 0x33, 0x41, 0x58, 0x0A, 0x60, 0x87, 0x7C, 0x01, 0xB2,
+    0x26, 0x80, 0x1D, 0xF2, 0x15, 0xC8, 0xFA, 0xF8, 0x5F, 0x4F, 0x49, 0x49, 0xE9, 0xFB, 0x7F, 0x35,
+    0xA5, 0xAF, 0xFF, 0xA1, 0xE0, 0x3D, 0x36, 0x16, 0xCC, 0xB1, 0x30, 0xBB, 0xC9, 0x63, 0x01, 0x00,
+    0x70, 0x48, 0x5F, 0x44, 0x78, 0x9C, 0x63, 0x50, 0x82, 0x00, 0x26, 0x86, 0xFF, 0x10, 0xC0, 0x07,
+    0x63, 0xF0, 0xC0, 0x18, 0x9C, 0x0C, 0xFF, 0xD7, 0x33, 0x40, 0x00, 0xA9, 0x0C, 0x01, 0x46, 0x08,
+    0x63, 0xDB, 0xFF, 0xFF, 0x39, 0x20, 0x06, 0x18, 0xE8, 0xC2, 0x18, 0xEF, 0x19, 0x19, 0xFE, 0xEF,
+    0x57, 0x65, 0x98, 0xFC, 0xFF, 0x3F, 0x37, 0x44, 0xC7, 0xD7, 0xFF, 0xFA, 0x10, 0xC6, 0x82, 0xFF,
+    0xFD, 0x10, 0x86, 0xC3, 0xFF, 0xF3, 0x10, 0x86, 0xC0, 0xFF, 0xF7, 0x30, 0x63, 0xFF, 0xA3, 0x31,
+    0x14, 0xFE, 0xDF, 0x87, 0x30, 0x02, 0x80, 0x36, 0x82, 0x2D, 0x3C, 0xF0, 0x3F, 0xBF, 0xC0, 0x1F,
+    0xC4, 0xF8, 0xF6, 0x9F, 0xEF, 0xFB, 0x7F, 0x4D, 0x06, 0x86, 0x86, 0xFF, 0xFF, 0x59, 0xBF, 0xFC,
+    0xFF, 0xBF, 0xF7, 0xD4, 0xFF, 0xFF, 0xF3, 0x19, 0x0C, 0xFE, 0x82, 0x6D, 0x67, 0x67, 0x60, 0x48,
+    0x00, 0xB1, 0xAC, 0xC1, 0x66, 0xA4, 0xA6, 0x8B, 0x00, 0x29, 0x00, 0xFF, 0xC6, 0x64, 0xF2, 0x78,
+    0x9C, 0x2D, 0x90, 0x3D, 0x4E, 0xC3, 0x40, 0x10, 0x46, 0xC7, 0xC1, 0x8E, 0xAD, 0x20, 0x20, 0xE2,
+    0x04, 0x3E, 0x00, 0x12, 0x12, 0x05, 0x25, 0x72, 0x97, 0x16, 0xD1, 0x52, 0x70, 0x04, 0xA8, 0xD2,
+    0x26, 0x07, 0xE0, 0x0E, 0x76, 0x43, 0x97, 0x88, 0x82, 0x0B, 0x70, 0x03, 0xDC, 0xA6, 0xB2, 0x68,
+    0x69, 0x92, 0x28, 0xC1, 0xF8, 0x07, 0xF2, 0x98, 0x59, 0x7B, 0xA4, 0x9D, 0x79, 0x1A, 0xED, 0x7C,
+    0xFB, 0xCD, 0x8A, 0xC8, 0xED, 0x17, 0x4B, 0x5F, 0x34, 0x92, 0x3F, 0xA0, 0x38, 0x52, 0x2A, 0xB1,
+    0x18, 0x68, 0x0B, 0xEE, 0xAF, 0x5E, 0x52, 0x6D, 0x7D, 0xF2, 0xA8, 0xF9, 0x5C, 0x4F, 0x4D, 0x28,
+    0x2E, 0xC6, 0x14, 0x1D, 0xC8, 0x13, 0x0F, 0x3D, 0xBD, 0x73, 0xD6, 0xD3, 0x86, 0xE3, 0x9E, 0x76,
+    0x44, 0xF1, 0x8A, 0x67, 0xCF, 0x74, 0x83, 0x4A, 0x85, 0xF5, 0x72, 0xC5, 0x9B, 0x7B, 0x63, 0x28,
+    0x0D, 0xCD, 0xC7, 0xF5, 0xDD, 0x2F, 0x97, 0x4A, 0xA6, 0x9C, 0xF1, 0x2A, 0x2D, 0x33, 0xA7, 0x8F,
+    0xF6, 0x46, 0x26, 0xD1, 0xE0, 0xD7, 0x98, 0x33, 0xF9, 0x21, 0xAC, 0x71, 0x76, 0xBF, 0x89, 0x54,
+    0xAF, 0xA7, 0x7D, 0x67, 0xAA, 0x24, 0xDC, 0x76, 0x13, 0x15, 0x41, 0xCE, 0xA9, 0x51, 0xCB, 0x60,
+    0xEE, 0xFC, 0xC5, 0xEA, 0xB7, 0xF3, 0x9C, 0xD9, 0x32, 0x35, 0x17, 0x96, 0x4E, 0x44, 0x72, 0x58,
+    0xB4, 0xAC, 0x75, 0xDF, 0xD8, 0xBE, 0x80, 0x1B, 0x1B, 0x9B, 0x1F, 0x20, 0xF5, 0xDC, 0x02, 0xC9,
+    0x74, 0x62, 0xE5, 0x1F, 0xC3, 0x1E, 0x79, 0x2E, 0x78, 0x9C, 0x53, 0x52, 0x82, 0x00, 0x86, 0xFF,
+    0x50, 0xC0, 0x82, 0xC1, 0x60, 0x66, 0x00, 0x83, 0xBF, 0xEF, 0x21, 0xB4, 0xC1, 0xFF, 0x7E, 0x08,
+    0x63, 0xC1, 0x7F, 0x7D, 0x08, 0xE3, 0xE3, 0x7F, 0x6E, 0x08, 0xE3, 0xFB, 0x7F, 0x56, 0x54, 0xB5,
+    0x0E, 0x30, 0xB5, 0x1B, 0x30, 0xD4, 0xFE, 0x80, 0xA9, 0xFD, 0x07, 0x55, 0x1B, 0x80, 0xA1, 0xF6,
+    0x13, 0x4E, 0xB5, 0x09, 0x30, 0xB5, 0x07, 0x60, 0x6A, 0x3F, 0xC3, 0xD4, 0xFE, 0x84, 0xA9, 0xFD,
+    0x8F, 0xAE, 0xF6, 0x02, 0x86, 0xDA, 0x67, 0x30, 0xB5, 0x0C, 0x53, 0x20, 0x14, 0x00, 0x28, 0xED,
+    0x49, 0xBA, 0x78, 0x9C, 0x13, 0x48, 0x63, 0x7C, 0xFC, 0x5F, 0xEF, 0xF7, 0xFF, 0xF5, 0xFF, 0xFE,
+    0xDF, 0x07, 0x92, 0x8F, 0xFE, 0xEB, 0x09, 0xA4, 0x31, 0x32, 0xE0, 0x00, 0x02, 0xD8, 0x14, 0x03,
+    0x00, 0x7B, 0x68, 0x1A, 0x77, 0x78, 0x9C, 0x35, 0x90, 0xE9, 0x11, 0x01, 0x41, 0x10, 0x46, 0xDB,
+    0x51, 0x6E, 0x4B, 0x06, 0x94, 0x1F, 0xFE, 0x92, 0x01, 0x19, 0x90, 0x01, 0x99, 0x90, 0x81, 0xCD,
+    0x80, 0x92, 0x00, 0x99, 0x90, 0x81, 0xCD, 0x60, 0x9D, 0xE5, 0xF6, 0x4C, 0x6F, 0xEF, 0x7C, 0x55,
+    0x53, 0xF5, 0xA6, 0xA6, 0x7A, 0xFA, 0x75, 0x8B, 0x88, 0x6C, 0xA1, 0x2C, 0x69, 0x8E, 0x10, 0x78,
+    0xBE, 0xC1, 0xC0, 0xF3, 0x2B, 0x66, 0xE1, 0x99, 0xC5, 0xE7, 0x90, 0xE2, 0x90, 0xC1, 0x9D, 0x9C,
+    0x71, 0x48, 0x70, 0xA6, 0x64, 0x1C, 0x51, 0xDE, 0x53, 0x37, 0xBE, 0x90, 0x0F, 0xE9, 0x19, 0x3F,
+    0x71, 0x25, 0x33, 0xE3, 0xDF, 0xC6, 0x9D, 0x5D, 0x82, 0x7D, 0x26, 0xAE, 0x05, 0x19, 0xE5, 0x39,
+    0x2D, 0x6D, 0x5D, 0x50, 0xDE, 0x53, 0x53, 0xA5, 0xAA, 0xF2, 0x99, 0xA2, 0xAA, 0x36, 0x94, 0xEF,
+    0x64, 0x45, 0xA6, 0x5A, 0x24, 0x92, 0xB8, 0xB4, 0x71, 0x9F, 0x49, 0xD3, 0x1C, 0xBF, 0x88, 0xBE,
+    0xA6, 0xC9, 0x27, 0x03, 0x5A, 0xDC, 0x98, 0x27, 0xCF, 0x81, 0x76, 0xE9, 0x76, 0x5C, 0xD6, 0x8C,
+    0x44, 0xDE, 0x24, 0x26, 0x63, 0x96, 0x6E, 0x40, 0xB3, 0x6A, 0x12, 0xBB, 0x7B, 0x6A, 0xFB, 0x21,
+    0xB7, 0xF2, 0xEB, 0x78, 0x50, 0x8A, 0xFC, 0x9A, 0x2E, 0xD4, 0xAF, 0x54, 0xFC, 0xF2, 0x7A, 0x4F,
+    0x13, 0x17, 0x59, 0x31, 0xFB, 0x03, 0x42, 0x9F, 0x79, 0x35, 0x78, 0x9C, 0x65, 0xCE, 0x31, 0x0E,
+    0x01, 0x41, 0x14, 0x80, 0xE1, 0xD9, 0x59, 0x21, 0x1A, 0x34, 0x0A, 0xED, 0xEA, 0x11, 0x17, 0x20,
+    0x7A, 0x59, 0xAD, 0x53, 0x70, 0x83, 0x6D, 0xA8, 0xB7, 0xD1, 0xE9, 0xB5, 0xEB, 0x04, 0xE2, 0x06,
+    0x9B, 0x38, 0x81, 0x44, 0x6F, 0xA3, 0x90, 0x28, 0x8C, 0xDF, 0x98, 0x7D, 0xB3, 0x8D, 0xA9, 0xBE,
+    0x4C, 0xDE, 0xCC, 0xFF, 0x0C, 0x70, 0xDF, 0x77, 0x95, 0x52, 0x06, 0x77, 0x7A, 0x95, 0x8A, 0x9A,
+    0x55, 0x3F, 0x9A, 0x1D, 0x60, 0x68, 0xA5, 0xED, 0xCC, 0x85, 0x4C, 0x34, 0x02, 0x91, 0xFA, 0xA0,
+    0x45, 0x86, 0x50, 0x04, 0x41, 0xA9, 0x05, 0xB9, 0xCC, 0xDD, 0x88, 0x9D, 0x3A, 0x3B, 0x68, 0xF8,
+    0xC6, 0xDC, 0xD7, 0x32, 0x5D, 0x75, 0xF3, 0xD0, 0x75, 0xA3, 0x8D, 0x21, 0x91, 0xB7, 0x6B, 0xA8,
+    0xCB, 0xCF, 0x2F, 0x5A, 0xA2, 0x07, 0x13, 0xD1, 0x99, 0x95, 0xE8, 0x48, 0xF2, 0x77, 0x77, 0x25,
+    0x16, 0x3D, 0x69, 0x97, 0x9A, 0x42, 0xF3, 0xD7, 0x18, 0x6F, 0xDF, 0x14, 0x81, 0x74, 0x19, 0xF8,
+    0x0D, 0xD2, 0x72, 0x97, 0xE2, 0xB4, 0xB4, 0xB3, 0x5F, 0x43, 0x77, 0x97, 0xB9, 0x78, 0x9C, 0x4D,
+    0x90, 0x4D, 0x0E, 0x01, 0x41, 0x10, 0x85, 0x9F, 0xC4, 0x02, 0x13, 0xB1, 0xB2, 0x94, 0xCC, 0x0D,
+    0xB8, 0x80, 0xC4, 0x01, 0x84, 0x3E, 0x82, 0x9D, 0x0D, 0x89, 0x8D, 0xBD, 0x23, 0xB8, 0x81, 0x7B,
+    0x58, 0x98, 0xA3, 0x70, 0x86, 0x49, 0x0C, 0xC6, 0xCF, 0x53, 0xD5, 0x3D, 0x9D, 0xAE, 0x5A, 0x7D,
+    0xDD, 0xF5, 0xF7, 0xEA, 0x01, 0x40, 0xBE, 0x5F, 0x0F, 0xE1, 0x63, 0xF7, 0x25, 0xB9, 0x55, 0x9A,
+    0xFD, 0xA8, 0x31, 0x15, 0xAC, 0xC8, 0xCB, 0x99, 0xBC, 0x02, 0x8E, 0x9C, 0x4B, 0xEA, 0x33, 0x06,
+    0x4A, 0x9E, 0x7C, 0x43, 0x1B, 0xA8, 0x99, 0x85, 0x6E, 0xE4, 0x64, 0xAB, 0xC1, 0x63, 0xC8, 0x6B,
+    0xDC, 0xB8, 0x8C, 0x58, 0x72, 0x10, 0xF1, 0xCE, 0x7E, 0xC4, 0x27, 0x7B, 0x11, 0x5F, 0xEC, 0x46,
+    0xAC, 0xD9, 0x89, 0xF8, 0x4E, 0x68, 0x7E, 0x4D, 0xAD, 0x99, 0x50, 0xA5, 0xB9, 0x66, 0x9B, 0xD1,
+    0x60, 0x94, 0x4D, 0x92, 0x5E, 0xD9, 0x91, 0xA5, 0x3E, 0x5F, 0xE1, 0x46, 0xC0, 0xAA, 0xB9, 0xB8,
+    0x90, 0xF7, 0x43, 0x7D, 0x10, 0x5B, 0xE4, 0x64, 0x17, 0xDC, 0x59, 0x68, 0xD9, 0x41, 0x79, 0xD3,
+    0x18, 0x10, 0x9C, 0xFC, 0x03, 0x8C, 0x94, 0x5D, 0x69, 0x78, 0x9C, 0x35, 0xD0, 0xBD, 0x12, 0xC1,
+    0x40, 0x10, 0x07, 0xF0, 0xCD, 0x50, 0xF8, 0x1C, 0x19, 0x8D, 0xCE, 0x47, 0x4A, 0x85, 0xD1, 0xA8,
+    0x79, 0x04, 0x6F, 0xA0, 0x61, 0x74, 0xA4, 0x53, 0x7A, 0x05, 0x6A, 0x2F, 0xA1, 0xCE, 0x8C, 0xC9,
+    0x23, 0x9C, 0xCA, 0x0B, 0x28, 0x94, 0x18, 0x42, 0x24, 0xE4, 0x6F, 0x2F, 0x97, 0xDD, 0xE2, 0xE6,
+    0x37, 0xB7, 0x7B, 0x7B, 0x7B, 0x47, 0xC4, 0x31, 0x5D, 0x0D, 0x28, 0x8D, 0x51, 0x0C, 0xC0, 0xCF,
+    0xB1, 0x6C, 0x2D, 0xB6, 0x45, 0x74, 0x06, 0x94, 0xF7, 0x05, 0x7A, 0xD4, 0x4E, 0xB0, 0xE0, 0xD4,
+    0x05, 0x05, 0x3A, 0x42, 0x59, 0xBA, 0x6C, 0x47, 0x14, 0xA2, 0x69, 0x4E, 0x93, 0x0D, 0xE4, 0x33,
+    0xBA, 0x50, 0x99, 0xB8, 0x74, 0x29, 0xBC, 0xA3, 0x25, 0x0C, 0x50, 0x15, 0xBE, 0x51, 0x16, 0x7E,
+    0x50, 0xE4, 0xB5, 0xE3, 0x38, 0x4E, 0x3D, 0xE2, 0x5B, 0x88, 0x22, 0x3D, 0x44, 0x9C, 0x32, 0xD4,
+    0x34, 0xBB, 0x81, 0xA6, 0xA9, 0x25, 0xEA, 0xC3, 0x0F, 0x51, 0x12, 0xBE, 0x50, 0x11, 0x3E, 0x50,
+    0x13, 0xDE, 0x30, 0x14, 0xEE, 0xB1, 0x16, 0x8E, 0x71, 0x15, 0x52, 0x92, 0x36, 0x4E, 0xF9, 0xC4,
+    0x44, 0xB8, 0x01, 0xBA, 0xFC, 0xAE, 0x13, 0x53, 0x8F, 0x72, 0xF0, 0x7E, 0xD0, 0x74, 0x61, 0x82,
+    0x73, 0xB4, 0x4D, 0x18, 0xAA, 0x61, 0x1A, 0xCD, 0xE6, 0xFA, 0x27, 0xFF, 0x3C, 0x44, 0x81, 0xB1,
+    0x78, 0x9C, 0x35, 0x90, 0xDB, 0x6D, 0xC2, 0x50, 0x10, 0x44, 0x37, 0x8E, 0x02, 0x01, 0x0B, 0x4C,
+    0x07, 0xD0, 0x41, 0xDC, 0x01, 0xE9, 0xC0, 0x74, 0x80, 0x3B, 0x20, 0x1D, 0x40, 0x07, 0xD0, 0x81,
+    0xE9, 0x00, 0x7F, 0x46, 0xCA, 0x07, 0xEE, 0xC0, 0x74, 0x60, 0x3A, 0xB0, 0xC1, 0x3C, 0x4D, 0xE0,
+    0x64, 0xD7, 0x22, 0xFB, 0x71, 0xA5, 0x91, 0xE6, 0xEE, 0x99, 0x1D, 0xD9, 0x41, 0x53, 0x6C, 0x60,
+    0x2E, 0xB2, 0x07, 0xD7, 0xC4, 0x08, 0x22, 0x91, 0x03, 0x78, 0xA6, 0x16, 0xB0, 0x12, 0x39, 0x42,
+    0x60, 0x6A, 0x03, 0xA9, 0xC8, 0x29, 0x37, 0x87, 0xFD, 0x78, 0x64, 0x22, 0xE7, 0xF4, 0x96, 0x99,
+    0x3A, 0xE5, 0x55, 0x2E, 0x72, 0x4D, 0xCF, 0x38, 0xAA, 0xAA, 0xA8, 0x42, 0xDF, 0x74, 0x5F, 0x23,
+    0x18, 0x5F, 0x79, 0x91, 0xDB, 0x7A, 0x63, 0x08, 0x1F, 0xEF, 0xA2, 0x9E, 0xFB, 0x7A, 0x66, 0x88,
+    0x19, 0xEE, 0x99, 0x57, 0x79, 0xAC, 0x7C, 0x43, 0x24, 0x34, 0x4F, 0xBC, 0x89, 0xEE, 0x7F, 0x28,
+    0x62, 0x87, 0x73, 0xA4, 0xD1, 0xD3, 0x74, 0x95, 0x22, 0x8E, 0xB9, 0xA6, 0x6A, 0x0E, 0x98, 0x6A,
+    0x1C, 0x47, 0xAE, 0x91, 0x94, 0xB4, 0x7C, 0x26, 0x52, 0x28, 0xE2, 0x1E, 0xA8, 0xB9, 0x3D, 0x62,
+    0x2C, 0x31, 0xEE, 0x40, 0xF7, 0x16, 0xB8, 0xA1, 0x2E, 0x0C, 0xF1, 0x42, 0x65, 0x16, 0x74, 0xBE,
+    0x18, 0x4A, 0x8F, 0x20, 0x56, 0xF3, 0x96, 0xEE, 0x82, 0xBE, 0xC8, 0x6F, 0x54, 0xE8, 0xA2, 0x04,
+    0x6F, 0x69, 0x41, 0x2E, 0x59, 0xA9, 0x90, 0x98, 0x7E, 0x6C, 0xAA, 0xA4, 0xD2, 0x00, 0x4B, 0x3E,
+    0x12, 0xBA, 0xA2, 0x3F, 0x2C, 0xDC, 0x82, 0xE1, 0x96, 0x4E, 0xDD, 0x49, 0x1D, 0x3C, 0x28, 0xEC,
+    0x9C, 0xCF, 0xBA, 0xB7, 0x90, 0x49, 0x41, 0xBB, 0xEE, 0xB2, 0x61, 0x1D, 0x4E, 0xF7, 0xB4, 0x54,
+    0x7D, 0xFF, 0x38, 0xE6, 0x98, 0x97, 0xBC, 0xCB, 0x73, 0x7C, 0x56, 0x87, 0x67, 0xEF, 0x3A, 0x3D,
+    0xD6, 0x76, 0xF0, 0xFF, 0x90, 0xFE, 0x01, 0xD9, 0xF7, 0xB9, 0x57, 0x78, 0x9C, 0xFB, 0xFB, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x73, 0xC4, 0x18, 0x18, 0x18, 0xFE, 0xFE, 0x07, 0x03, 0x29, 0x38, 0xEB, 0x3F,
+    0x0B, 0x90, 0xA5, 0xAC, 0xE4, 0x7C, 0xFC, 0xFF, 0x7F, 0x7B, 0x20, 0x8B, 0x09, 0xA8, 0xE6, 0xCB,
+    0xFF, 0xFB, 0x50, 0x96, 0x03, 0x50, 0x1A, 0xC2, 0x62, 0xF8, 0xFD, 0x9F, 0x13, 0xCA, 0xFA, 0xFE,
+    0x9F, 0x07, 0xCA, 0xFA, 0xFA, 0x9F, 0x17, 0x83, 0xF5, 0xFD, 0x3F, 0x37, 0x5C, 0x07, 0x07, 0x84,
+    0xA5, 0xF0, 0xFF, 0x3F, 0x33, 0x84, 0x75, 0xE9, 0xFF, 0x79, 0xB0, 0xC9, 0x0A, 0x53, 0x21, 0xB6,
+    0x41, 0x00, 0x33, 0xBA, 0xAB, 0xF6, 0x89, 0x83, 0x5D, 0xAA, 0xAC, 0xC4, 0x08, 0x32, 0x07, 0xEA,
+    0x16, 0xDA, 0xB2, 0x00, 0x18, 0x1F, 0x73, 0xF0, 0x78, 0x9C, 0x45, 0xCE, 0x31, 0x0A, 0x02, 0x41,
+    0x0C, 0x05, 0xD0, 0x61, 0x5C, 0x14, 0xB1, 0xD9, 0x56, 0x2C, 0x94, 0xDD, 0xC2, 0xDE, 0xD6, 0xC2,
+    0x23, 0x78, 0x04, 0x3D, 0x8A, 0xE0, 0x41, 0xEC, 0xEC, 0x04, 0x8F, 0xA0, 0x57, 0xF0, 0x02, 0xEB,
+    0x0D, 0x06, 0x41, 0x59, 0x56, 0x1C, 0xBF, 0x89, 0x49, 0x66, 0x52, 0x3D, 0x98, 0xCC, 0xCF, 0x8F,
+    0x00, 0xC2, 0x69, 0xEE, 0x68, 0x22, 0xFE, 0xB3, 0xCC, 0x44, 0x9F, 0x59, 0x57, 0x8B, 0x23, 0xB0,
+    0x66, 0x7A, 0x7A, 0xBB, 0x21, 0x18, 0x67, 0x40, 0xA1, 0x74, 0x1F, 0x0C, 0x8C, 0x1D, 0x86, 0xC6,
+    0x77, 0x66, 0x5E, 0xA0, 0x6F, 0x3D, 0xE5, 0x15, 0x8D, 0x84, 0x95, 0xFB, 0x2F, 0x56, 0xE9, 0x70,
+    0x28, 0x12, 0xC7, 0xA9, 0xCE, 0x44, 0x4A, 0xD6, 0xD5, 0x13, 0x53, 0xA1, 0x77, 0x67, 0x1C, 0x8C,
+    0x94, 0xEA, 0x95, 0x74, 0x76, 0x64, 0x7C, 0x60, 0x63, 0xDC, 0xF1, 0x31, 0x61, 0x09, 0x6A, 0xA3,
+    0x1D, 0x5A, 0x8E, 0x13, 0xDE, 0x39, 0x4E, 0xB8, 0xE5, 0x38, 0xAD, 0x1E, 0x29, 0x4E, 0xF9, 0xA2,
+    0x38, 0xE5, 0x85, 0xE2, 0x7E, 0xE4, 0x29, 0x8D, 0x1F, 0x78, 0x9C, 0xFB, 0xF2, 0x9F, 0x9B, 0x01,
+    0x04, 0x3E, 0xFD, 0xE7, 0xFD, 0x32, 0x2C, 0x98, 0x9F, 0x91, 0x99, 0x3C, 0x60, 0x26, 0x90, 0xFE,
+    0xF8, 0x9F, 0x17, 0xCC, 0xFC, 0xFA, 0x9F, 0xFB, 0xC1, 0x7F, 0x79, 0x30, 0xF3, 0xC7, 0x7F, 0x8E,
+    0x05, 0xFF, 0xEB, 0xC1, 0xCC, 0x7F, 0xFF, 0x99, 0x0D, 0xFE, 0xFF, 0x67, 0x02, 0xB2, 0x26, 0xFC,
+    0x3F, 0xCF, 0xC0, 0xF0, 0xEB, 0x7F, 0x1C, 0x03, 0x83, 0xC0, 0xAF, 0xFF, 0xF6, 0x0C, 0x0C, 0x17,
+    0xFE, 0xFF, 0xDF, 0xBF, 0xEB, 0xEF, 0xFF, 0xFF, 0x6C, 0x40, 0x81, 0x3F, 0xFF, 0x41, 0x20, 0x1E,
+    0xA4, 0x21, 0x00, 0xC4, 0x9E, 0xC7, 0x08, 0xD6, 0x2C, 0x90, 0x5A, 0x6E, 0x06, 0xA2, 0x01, 0x8F,
+    0x2C, 0x7C, 0xA8, 0x78, 0x9C, 0x35, 0x8F, 0xFD, 0x11, 0xC1, 0x50, 0x10, 0xC4, 0x17, 0x43, 0x0C,
+    0xF1, 0xD1, 0x01, 0x1D, 0xD0, 0x01, 0x1D, 0xD0, 0x01, 0x1D, 0x48, 0x07, 0x4A, 0xA0, 0x03, 0x29,
+    0x41, 0x07, 0x74, 0xA0, 0x04, 0x3A, 0xF0, 0x95, 0x0C, 0x31, 0x64, 0x65, 0xEF, 0xD8, 0x3F, 0xEE,
+    0xFD, 0xE6, 0xDD, 0x7B, 0x7B, 0xB7, 0x19, 0x1B, 0x30, 0xDD, 0x19, 0x26, 0x6C, 0x3B, 0x3F, 0x19,
+    0x9C, 0x38, 0x72, 0x7E, 0xB3, 0x1C, 0x73, 0x65, 0xD8, 0xE5, 0x11, 0x53, 0x1E, 0x8C, 0xE7, 0x5C,
+    0x02, 0x64, 0x49, 0xBC, 0xE5, 0x00, 0x78, 0xB1, 0x26, 0xBE, 0xB0, 0x05, 0xA4, 0x6C, 0x8A, 0x13,
+    0xD6, 0x75, 0xD1, 0x11, 0x67, 0xAC, 0xE8, 0xE1, 0x44, 0xFC, 0x39, 0x9B, 0xC1, 0xA6, 0xA8, 0x7D,
+    0xAB, 0x32, 0x06, 0x22, 0xEF, 0x16, 0x03, 0xF5, 0xD2, 0x7E, 0x3D, 0x18, 0xC8, 0xC1, 0x56, 0xBC,
+    0xC9, 0x34, 0x65, 0x55, 0xBC, 0x57, 0x3B, 0xA3, 0x6D, 0x12, 0x71, 0x06, 0xE4, 0x3B, 0x63, 0xD9,
+    0x0D, 0xB9, 0xF0, 0xCD, 0x8B, 0x31, 0x11, 0x7B, 0xFF, 0x44, 0x95, 0x3D, 0xC3, 0x7F, 0xD2, 0xE0,
+    0xEA, 0xCB, 0x02, 0x27, 0x86, 0xA9, 0x87, 0x00, 0xD6, 0xEC, 0xBD, 0x3C, 0x1C, 0x30, 0xE6, 0x22,
+    0x5F, 0xFE, 0x18, 0xF9, 0x51, 0x01, 0x5D, 0x19, 0x15, 0xD0, 0x95, 0x50, 0x01, 0x5D, 0x17, 0x2A,
+    0xA0, 0x2B, 0xE6, 0xD9, 0xCE, 0x2F, 0x48, 0x41, 0x69, 0xDB, 0x78, 0x9C, 0x2D, 0x91, 0x8D, 0x6D,
+    0xC2, 0x50, 0x0C, 0x84, 0xCD, 0x7F, 0x55, 0x44, 0xDA, 0x0D, 0x60, 0x03, 0xD8, 0xA0, 0xDD, 0x80,
+    0x6C, 0x00, 0x1B, 0xB4, 0x1B, 0xA4, 0x1B, 0x94, 0x0D, 0xC8, 0x06, 0x61, 0x03, 0xD8, 0x80, 0x6C,
+    0x10, 0x46, 0x08, 0x22, 0x90, 0x94, 0x10, 0xAE, 0x77, 0x86, 0x48, 0x91, 0xAD, 0x7B, 0x3E, 0xFB,
+    0x7B, 0x7E, 0x0D, 0x4C, 0x1F, 0xD0, 0x57, 0x38, 0xA3, 0x7B, 0x45, 0x87, 0xC9, 0x0C, 0x78, 0x95,
+    0x50, 0xA1, 0x55, 0xA2, 0xC7, 0xE4, 0x1B, 0x18, 0x49, 0xA8, 0x33, 0x2B, 0xF0, 0xC2, 0x24, 0x06,
+    0xC6, 0x12, 0xEE, 0x89, 0xE5, 0x18, 0x32, 0x39, 0x00, 0x73, 0x86, 0x77, 0x44, 0x96, 0x22, 0x60,
+    0x76, 0x44, 0xFD, 0xCB, 0xF0, 0x49, 0x39, 0xF6, 0xDA, 0xF3, 0xBE, 0xDC, 0x7A, 0xAB, 0x31, 0x7F,
+    0xD5, 0x56, 0xEB, 0x13, 0xBC, 0xD5, 0x88, 0x03, 0x23, 0x66, 0xB7, 0x45, 0x8E, 0xB6, 0xD1, 0xCF,
+    0xE1, 0x48, 0xC4, 0x35, 0xDD, 0x89, 0x2C, 0xC7, 0xC0, 0xAC, 0xC9, 0xC4, 0x15, 0xAC, 0x74, 0x78,
+    0x42, 0xD7, 0xEC, 0x4A, 0xF3, 0x12, 0xC3, 0x50, 0x64, 0x17, 0xB4, 0xCC, 0x4A, 0x9A, 0x63, 0x0C,
+    0x26, 0x9A, 0xF6, 0xC7, 0x6A, 0x96, 0xF5, 0xD8, 0xAC, 0x63, 0x77, 0x4E, 0xBB, 0xA9, 0x5F, 0x4E,
+    0xF6, 0x23, 0x6D, 0x22, 0xF3, 0x89, 0x29, 0xD9, 0x8B, 0x3D, 0xAD, 0x5B, 0x9B, 0x38, 0x53, 0x4C,
+    0xF6, 0x72, 0x6D, 0xBC, 0xA5, 0x85, 0x78, 0x7B, 0xE2, 0xD6, 0x0B, 0x59, 0xDB, 0x3F, 0xBE, 0x83,
+    0x19, 0xEB, 0xEE, 0x53, 0x59, 0xFB, 0x9B, 0xC7, 0x96, 0x10, 0x4D, 0x74, 0x63, 0x92, 0x1D, 0x04,
+    0x4A, 0xD4, 0x24, 0xD4, 0x4E, 0x96, 0x18, 0x1D, 0x05, 0x4A, 0xD4, 0x6C, 0xA5, 0x13, 0x92, 0x15,
+    0x8F, 0x85, 0x5F, 0xB0, 0xF3, 0x13, 0xCC, 0xCB, 0xCC, 0x85, 0x13, 0x7C, 0x17, 0x24, 0xBB, 0x26,
+    0x2E, 0xE4, 0xF0, 0x2B, 0x58, 0xB5, 0x6D, 0x22, 0x17, 0x52, 0x60, 0xAD, 0x58, 0x00, 0x1F, 0x2E,
+    0xF0, 0x09, 0xBE, 0xCC, 0x17, 0xED, 0xA0, 0x9A, 0x87, 0xE9, 0xB3, 0xD2, 0x1F, 0x4B, 0xCF, 0x18,
+    0x3C, 0x2B, 0x05, 0xFA, 0x0F, 0x51, 0xF2, 0xBC, 0x5D, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x70, 0x2A,
+    0x4B, 0x67, 0x66, 0x00, 0x82, 0x80, 0x57, 0xFF, 0x81, 0x80, 0x03, 0xC8, 0xFA, 0x0A, 0x62, 0xFC,
+    0xBF, 0xCF, 0xC8, 0xC0, 0xF0, 0xE1, 0xFF, 0xF9, 0x55, 0xAF, 0xFF, 0xFF, 0xE7, 0x62, 0x60, 0x28,
+    0x50, 0x03, 0x4A, 0x7C, 0xFB, 0xAF, 0xCF, 0x00, 0x01, 0x05, 0xFF, 0xEB, 0xA1, 0x2C, 0x85, 0xFF,
+    0xEB, 0xA1, 0x2C, 0x81, 0xFF, 0xFB, 0xE1, 0xAC, 0xF3, 0x20, 0x99, 0xED, 0x7F, 0x81, 0xC6, 0x00,
+    0x59, 0x0A, 0xBF, 0xC1, 0x06, 0x02, 0x59, 0x8F, 0xFF, 0x43, 0x59, 0x02, 0xFF, 0xFE, 0xEF, 0x37,
+    0x53, 0x32, 0x02, 0xB2, 0x1A, 0xFE, 0xFF, 0x67, 0x81, 0xE8, 0xB8, 0xF0, 0x3F, 0x1F, 0xAA, 0xF7,
+    0xC3, 0x7F, 0x79, 0x28, 0xEB, 0xE3, 0x7F, 0x7E, 0x14, 0xB1, 0x04, 0x20, 0xEB, 0x01, 0x58, 0xDD,
+    0xE7, 0xFF, 0xF7, 0x19, 0x26, 0xFC, 0x7F, 0xCF, 0x0C, 0x14, 0xFA, 0xFF, 0x9F, 0x59, 0x00, 0xE8,
+    0xDE, 0x5D, 0xFF, 0xDE, 0x7F, 0xFF, 0xEF, 0x07, 0x71, 0xBD, 0xDD, 0x85, 0xFF, 0xF1, 0x0C, 0x06,
+    0x7F, 0xFE, 0xFF, 0x5F, 0xCF, 0xA8, 0xF0, 0x07, 0x68, 0x84, 0x42, 0x59, 0x18, 0xD0, 0x3B, 0x06,
+    0xAC, 0x00, 0x9C, 0xC8, 0x6B, 0xE0, 0x78, 0x9C, 0xAD, 0xCE, 0xB1, 0x0E, 0xC1, 0x50, 0x14, 0x80,
+    0xE1, 0x23, 0x48, 0x24, 0xC8, 0xED, 0x62, 0xB7, 0x9B, 0xAD, 0xD2, 0x37, 0x90, 0x78, 0x02, 0x9B,
+    0x91, 0xCD, 0xDA, 0x47, 0xF0, 0x06, 0xBC, 0x80, 0xC5, 0x2A, 0xE1, 0x11, 0x74, 0xB7, 0x74, 0xA8,
+    0xC9, 0x20, 0x5A, 0x24, 0x12, 0xFC, 0xEE, 0xE9, 0x6D, 0xDA, 0xC1, 0xEA, 0x4E, 0x5F, 0x72, 0xCF,
+    0xF9, 0x73, 0x44, 0xB2, 0x37, 0xEE, 0x57, 0x1C, 0x24, 0xC2, 0xFC, 0x4D, 0xFE, 0xBC, 0xE3, 0x14,
+    0x00, 0x3D, 0x95, 0xF7, 0xB6, 0x22, 0xB6, 0x0A, 0x61, 0x77, 0xB4, 0x36, 0xF2, 0x64, 0x2A, 0x12,
+    0x5B, 0x79, 0x50, 0x17, 0x1D, 0x31, 0x01, 0x7B, 0xAD, 0x24, 0x98, 0x90, 0x61, 0xDE, 0xBB, 0xBA,
+    0xB8, 0x55, 0x4A, 0x3B, 0xD7, 0x9D, 0x56, 0xAE, 0x07, 0xCD, 0x1F, 0x95, 0xBF, 0xB7, 0x62, 0xA3,
+    0xAC, 0x44, 0x45, 0x79, 0xC5, 0x52, 0x95, 0x62, 0x7C, 0xA8, 0x8A, 0x74, 0x3F, 0x76, 0xE8, 0xC5,
+    0x40, 0xE4, 0xA4, 0xF7, 0x25, 0xB0, 0x3E, 0xB3, 0xB5, 0xF2, 0xF5, 0xF8, 0xC3, 0x42, 0x13, 0x1B,
+    0xB8, 0x34, 0x66, 0x59, 0x6C, 0x34, 0xA9, 0xE9, 0xFA, 0x17, 0x67, 0x71, 0x7D, 0xD0, 0x78, 0x9C,
+    0x65, 0x8F, 0x3F, 0x0E, 0x01, 0x61, 0x10, 0xC5, 0xDF, 0xFA, 0x13, 0x4B, 0xB2, 0x89, 0x5E, 0x82,
+    0xE8, 0xA8, 0xBE, 0x1B, 0xD8, 0x4A, 0xBD, 0x37, 0x50, 0x2A, 0x69, 0x68, 0xB9, 0x81, 0x2B, 0x38,
+    0x80, 0x42, 0xAD, 0xE0, 0x08, 0xE2, 0x04, 0xA2, 0xD6, 0x10, 0xAC, 0xB5, 0xB2, 0xFB, 0xCC, 0x37,
+    0xBE, 0xCE, 0x6B, 0xE6, 0x97, 0xBC, 0x79, 0x93, 0x37, 0x00, 0xC2, 0xD9, 0x00, 0xAA, 0x45, 0x4E,
+    0xEE, 0x0B, 0x02, 0xF5, 0x8C, 0xA2, 0xA1, 0xD0, 0x91, 0x5C, 0x5F, 0xC8, 0x12, 0x90, 0xB2, 0x01,
+    0xC4, 0x6C, 0xC2, 0xF0, 0x20, 0x46, 0xC4, 0x39, 0x56, 0xEC, 0xDB, 0x58, 0x76, 0xC2, 0x95, 0x81,
+    0xA5, 0x84, 0xDE, 0x9D, 0x35, 0x4B, 0x4F, 0x96, 0x63, 0xFA, 0x96, 0x1E, 0xAC, 0x24, 0x74, 0xF2,
+    0xDF, 0xFF, 0x24, 0x6E, 0xB7, 0xA3, 0xF2, 0x5E, 0xAC, 0xFE, 0x8A, 0x48, 0x28, 0x70, 0x74, 0x63,
+    0xCB, 0xD1, 0x86, 0x4B, 0x47, 0x91, 0x16, 0x42, 0x28, 0x55, 0x3F, 0x1C, 0x03, 0x26, 0x95, 0xED,
+    0x33, 0xB9, 0xDB, 0xE6, 0x76, 0xA7, 0xAD, 0xED, 0xF5, 0xD6, 0x44, 0x3E, 0x62, 0x4F, 0x43, 0x66,
+    0x3A, 0x2A, 0xCA, 0xF8, 0x02, 0x6A, 0xB7, 0x67, 0x95, 0x78, 0x9C, 0x5B, 0xF0, 0x8E, 0xFD, 0xE7,
+    0x7F, 0xFF, 0x3F, 0xFF, 0xEB, 0x81, 0xE4, 0x82, 0xF7, 0xEC, 0x0C, 0x18, 0xE0, 0xC3, 0x7F, 0x1E,
+    0x0A, 0x11, 0x00, 0x75, 0x6E, 0x35, 0xC6, 0x78, 0x9C, 0x6B, 0x3C, 0xC5, 0xCE, 0xC0, 0xF0, 0xE5,
+    0x3F, 0xE7, 0x00, 0x13, 0x9F, 0x41, 0xC4, 0xA7, 0xFF, 0xDC, 0x0C, 0x0C, 0x1F, 0xFE, 0xEF, 0xAF,
+    0x66, 0x68, 0xF8, 0xFF, 0xFF, 0x3D, 0x03, 0xC3, 0xAF, 0xFF, 0xFF, 0x99, 0x19, 0x14, 0xCA, 0x44,
+    0x19, 0x00, 0x53, 0x24, 0x43, 0x1E, 0x78, 0x9C, 0xDD, 0x8C, 0xB1, 0x09, 0x83, 0x50, 0x14, 0x45,
+    0x2F, 0xE1, 0x2B, 0x29, 0x44, 0xAD, 0x9C, 0xC7, 0x0D, 0x42, 0x26, 0xB1, 0xB4, 0xD4, 0x0D, 0x1C,
+    0x21, 0xD9, 0xC2, 0xCE, 0x59, 0xD2, 0x5B, 0xF8, 0x02, 0x49, 0xF5, 0xD5, 0x93, 0x27, 0xD9, 0x42,
+    0xB8, 0x1C, 0xEE, 0x69, 0x8E, 0x24, 0xD5, 0x6D, 0x70, 0xDE, 0xDB, 0x44, 0x32, 0x42, 0x0F, 0x4B,
+    0xD0, 0xC1, 0xD4, 0xB5, 0x5A, 0x81, 0x9B, 0xA2, 0xB3, 0x73, 0x1D, 0x99, 0x22, 0xCB, 0x93, 0x69,
+    0x86, 0x8B, 0xB1, 0x37, 0x2A, 0x37, 0x62, 0xA7, 0x72, 0xE5, 0x6A, 0xE0, 0x85, 0x2F, 0xA4, 0xD2,
+    0x87, 0xCC, 0x18, 0xBC, 0xFA, 0xE6, 0xA1, 0x23, 0x9B, 0xFB, 0xFE, 0xC7, 0xF9, 0xA2, 0x30, 0xB2,
+    0x73, 0xEB, 0x0F, 0xFC, 0xA3, 0x98, 0x04, 0x78, 0x9C, 0x63, 0x60, 0x60, 0x60, 0x70, 0x28, 0x57,
+    0x63, 0x60, 0xF8, 0xF0, 0x9F, 0x25, 0xE1, 0xDF, 0xFF, 0xFF, 0x3A, 0x40, 0x06, 0xDB, 0xAF, 0xFF,
+    0x40, 0xC0, 0xF4, 0xE1, 0xFF, 0xF2, 0xFF, 0xFB, 0x6F, 0xFD, 0xFF, 0xCF, 0xF3, 0xE1, 0xFF, 0xBF,
+    0x7E, 0x06, 0x86, 0x2F, 0xFF, 0xED, 0x3F, 0xFC, 0xFF, 0xCF, 0xC6, 0xC0, 0xD0, 0xF0, 0xBF, 0xFF,
+    0xC3, 0xFF, 0x7E, 0x90, 0xBE, 0xFF, 0xF3, 0x3F, 0xFC, 0xE7, 0x03, 0x32, 0x0C, 0xFE, 0xAF, 0xFF,
+    0xF0, 0x9F, 0x07, 0xC8, 0x50, 0x18, 0x68, 0x06, 0x00, 0x74, 0x76, 0x60, 0x2C, 0x78, 0x9C, 0x45,
+    0x8F, 0xBD, 0x0D, 0xC2, 0x40, 0x0C, 0x46, 0xCD, 0x4F, 0x91, 0x20, 0xA1, 0x50, 0x42, 0x05, 0x23,
+    0x64, 0x03, 0x98, 0x00, 0x98, 0x00, 0xE8, 0x28, 0xA9, 0xE8, 0xD9, 0x80, 0x11, 0x60, 0x86, 0x0C,
+    0x80, 0x52, 0xD3, 0x20, 0x26, 0x60, 0x84, 0x43, 0x80, 0xC4, 0x5F, 0xD0, 0xC3, 0x26, 0xE1, 0xE2,
+    0xEA, 0xC9, 0x77, 0xB6, 0xDF, 0x27, 0x22, 0xBD, 0xE5, 0xBC, 0x2E, 0x56, 0xB3, 0x0F, 0xD0, 0x51,
+    0x68, 0xBD, 0xB1, 0xD2, 0x6E, 0x0A, 0xBB, 0x3D, 0x8C, 0x44, 0x5E, 0x4C, 0x44, 0x12, 0x5C, 0x25,
+    0x86, 0xAA, 0xFE, 0xC9, 0x08, 0xB7, 0xAC, 0x6D, 0xEC, 0x42, 0x74, 0xA6, 0x6B, 0x94, 0xB2, 0xB8,
+    0xD1, 0x34, 0x5A, 0xB1, 0xB9, 0xD3, 0x30, 0x1A, 0x73, 0x78, 0x10, 0x1A, 0xC5, 0x9C, 0x9E, 0x04,
+    0x39, 0x39, 0x4F, 0xF8, 0x57, 0x57, 0x4E, 0x94, 0x5B, 0xFC, 0xE6, 0x69, 0x71, 0xED, 0x4A, 0x34,
+    0xF8, 0x1B, 0x04, 0x6A, 0x35, 0xCC, 0xAD, 0xE4, 0x98, 0x9B, 0xF6, 0xD5, 0x3E, 0x33, 0x79, 0x57,
+    0x2B, 0x12, 0xB9, 0xF6, 0x2F, 0x9C, 0xA6, 0xB4, 0xCE, 0x17, 0x17, 0xB1, 0x68, 0x0C, 0x78, 0x9C,
+    0xA5, 0xCE, 0xB1, 0x0E, 0xC1, 0x70, 0x10, 0xC7, 0xF1, 0x0B, 0x15, 0x8D, 0xB6, 0xCC, 0xA6, 0x4E,
+    0xAC, 0x7D, 0x01, 0x83, 0x37, 0xF0, 0x0A, 0x06, 0x89, 0xB1, 0x9B, 0x55, 0x1F, 0x88, 0x57, 0xE0,
+    0x0D, 0x58, 0x3D, 0x81, 0xC5, 0xD0, 0xBF, 0xA4, 0x42, 0x22, 0xF5, 0x75, 0xA7, 0x8D, 0x01, 0x9B,
+    0x1B, 0x2E, 0x9F, 0xE4, 0xF2, 0xBB, 0xFC, 0x44, 0x44, 0xC6, 0x8B, 0x81, 0x6E, 0x87, 0x97, 0x01,
+    0x23, 0xD3, 0xB0, 0x54, 0xD1, 0x52, 0x1D, 0xD8, 0x9C, 0x20, 0x51, 0x91, 0x8A, 0x5C, 0xD8, 0xAA,
+    0xF2, 0xA6, 0xC8, 0x14, 0x1A, 0x8E, 0x89, 0xE6, 0xA4, 0xA4, 0xED, 0x08, 0x4D, 0x57, 0x82, 0x5A,
+    0x05, 0xDD, 0x5A, 0x67, 0x7A, 0xB5, 0x1C, 0xF1, 0x5B, 0xC9, 0x0F, 0xC5, 0x5F, 0x89, 0x82, 0xA8,
+    0xD6, 0x8D, 0x8E, 0x23, 0x32, 0x3D, 0xF0, 0x1C, 0x4B, 0x45, 0x46, 0x6E, 0xAD, 0xFA, 0x76, 0x4C,
+    0x4D, 0xAC, 0xEE, 0x10, 0xA8, 0xD6, 0x56, 0x7E, 0x6F, 0x2F, 0xC3, 0x23, 0xE4, 0xFE, 0x4B, 0x32,
+    0x9B, 0x7B, 0x52, 0xA9, 0x9A, 0xBF, 0xB4, 0xF3, 0xE5, 0x73, 0x9E, 0x6D, 0x8A, 0x82, 0x7D, 0x78,
+    0x9C, 0x63, 0x60, 0x60, 0x60, 0x48, 0x4C, 0x67, 0xFE, 0xF0, 0x9F, 0xA5, 0xE1, 0xFF, 0x7F, 0x8E,
+    0x0F, 0xFF, 0x59, 0x7F, 0xFE, 0xFF, 0xCF, 0xF6, 0xE1, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0x81, 0x82,
+    0x27, 0xFE, 0xF7, 0xDC, 0x64, 0xF8, 0xF0, 0xFF, 0x4F, 0x3C, 0x50, 0xD5, 0x07, 0xA0, 0x04, 0x98,
+    0xBA, 0xCF, 0x00, 0xA6, 0xEA, 0x21, 0x94, 0x3C, 0x84, 0xE2, 0x85, 0x50, 0x3C, 0x54, 0xA7, 0x00,
+    0x26, 0x85, 0x3B, 0xCF, 0x78, 0x9C, 0x35, 0x8D, 0xBF, 0x12, 0xC1, 0x60, 0x10, 0xC4, 0x37, 0x1F,
+    0x42, 0xE1, 0x4F, 0x0A, 0x9D, 0x97, 0x48, 0x95, 0x92, 0x57, 0x30, 0xA3, 0xD5, 0x2B, 0x14, 0x8C,
+    0x19, 0x93, 0xC7, 0xE0, 0x0D, 0x98, 0x51, 0x2A, 0xBC, 0x40, 0x5A, 0x8D, 0x46, 0xAD, 0xFA, 0x50,
+    0xE9, 0x48, 0x81, 0x42, 0x58, 0xDF, 0x5D, 0x26, 0xDB, 0xEC, 0x6F, 0xF6, 0xEE, 0xF6, 0x00, 0x0C,
+    0xE2, 0x08, 0xA2, 0x1B, 0xC9, 0x95, 0x01, 0xAE, 0x14, 0x2D, 0x10, 0xFC, 0x68, 0xB7, 0x19, 0x69,
+    0x96, 0xB4, 0x25, 0x60, 0x3F, 0xC1, 0x99, 0x3D, 0x59, 0x2C, 0xE3, 0xC1, 0x96, 0x9E, 0x14, 0x09,
+    0xB0, 0xA6, 0x35, 0x0A, 0x21, 0xB9, 0xAB, 0x28, 0x3D, 0x5D, 0xCB, 0xD8, 0x93, 0x28, 0x93, 0x66,
+    0xA5, 0x93, 0xA3, 0xAE, 0x4E, 0x67, 0x5F, 0xDE, 0x3D, 0xA5, 0x3E, 0x59, 0xCB, 0x4B, 0x5E, 0x6C,
+    0xE4, 0x90, 0x16, 0xFD, 0x29, 0x9B, 0x61, 0x55, 0xE0, 0xCD, 0xFA, 0xC5, 0xFA, 0xC0, 0x94, 0xF4,
+    0x3F, 0x64, 0x72, 0x20, 0x8F, 0xEE, 0xA9, 0xAA, 0x03, 0x6C, 0xC4, 0x87, 0xFA, 0x7F, 0x3E, 0x6A,
+    0x3B, 0xFB, 0x03, 0xD3, 0xC4, 0x55, 0x78, 0x78, 0x9C, 0x63, 0x60, 0x30, 0x2C, 0x65, 0x00, 0x83,
+    0x3F, 0xFF, 0x89, 0xA1, 0x7F, 0xFD, 0x07, 0x01, 0x7D, 0x28, 0xCD, 0x0F, 0xA5, 0xF9, 0x18, 0x14,
+    0x95, 0xFE, 0xFE, 0x57, 0x52, 0x62, 0x24, 0xDA, 0x1C, 0x4A, 0x68, 0x46, 0x30, 0xFD, 0xFB, 0x3F,
+    0x33, 0x98, 0xFE, 0xF1, 0x9F, 0x8B, 0xC1, 0x11, 0x48, 0x7F, 0xFA, 0x7F, 0xFF, 0xD4, 0x7F, 0x26,
+    0x06, 0x86, 0x06, 0x90, 0x83, 0xB8, 0x81, 0x02, 0xDF, 0xFF, 0xFF, 0xBF, 0xCF, 0x0A, 0xA4, 0x05,
+    0x4A, 0xD3, 0x99, 0x18, 0x00, 0x54, 0x53, 0x4B, 0x25, 0x78, 0x9C, 0x65, 0x90, 0xD1, 0x11, 0xC1,
+    0x40, 0x14, 0x45, 0x6F, 0x0C, 0x63, 0x18, 0x43, 0x1A, 0x30, 0x5A, 0xD0, 0x81, 0x12, 0x12, 0x15,
+    0x48, 0x07, 0x0A, 0xF0, 0xA3, 0x03, 0x25, 0xD0, 0x41, 0xD2, 0x01, 0x9D, 0xAC, 0x4F, 0x7F, 0xB1,
+    0x8C, 0x4C, 0x24, 0xB8, 0xDE, 0xCB, 0x6E, 0xFC, 0xB8, 0x1F, 0x9B, 0xB3, 0x79, 0xFB, 0xCE, 0xBC,
+    0xDD, 0x82, 0x43, 0x68, 0x98, 0xC3, 0x72, 0xAC, 0x14, 0x73, 0x8F, 0x8C, 0x91, 0xE2, 0x41, 0x3E,
+    0x89, 0x6C, 0x25, 0x67, 0x29, 0x86, 0x34, 0x8A, 0x77, 0x0E, 0x80, 0x9A, 0x1D, 0xC1, 0x92, 0x5D,
+    0xA0, 0x60, 0x5F, 0xF0, 0x9D, 0xCB, 0x62, 0x39, 0x82, 0x1C, 0xD3, 0x8E, 0x8C, 0x33, 0x48, 0xB3,
+    0x7A, 0x12, 0xAE, 0x75, 0xAF, 0xF6, 0x90, 0x47, 0xE0, 0xAA, 0x02, 0x55, 0x00, 0x0F, 0x15, 0xA8,
+    0xA2, 0x87, 0x27, 0x9B, 0x41, 0xAC, 0x14, 0x3F, 0x69, 0x83, 0xD2, 0x32, 0x77, 0x83, 0x88, 0x62,
+    0xB1, 0xE5, 0xA4, 0xC1, 0x90, 0xBB, 0x93, 0x1F, 0x1A, 0xB5, 0xB1, 0xD2, 0x09, 0xA7, 0x28, 0x9D,
+    0x40, 0x15, 0x4C, 0x3D, 0x66, 0xE4, 0xCA, 0x63, 0x4C, 0x2F, 0x90, 0xDC, 0x5A, 0x81, 0xBF, 0x82,
+    0x17, 0x1B, 0xFC, 0xDA, 0xA2, 0xF6, 0x67, 0xDD, 0x1E, 0x5D, 0x56, 0x34, 0x81, 0xC3, 0x17, 0x39,
+    0xF5, 0xF5, 0xCA, 0x3D, 0x8F, 0xE6, 0xB2, 0x09, 0xF0, 0x97, 0x2F, 0xEA, 0xBA, 0x64, 0x3E,
+};
+// GlyphProps[width, height, advance_x, left, top, compressed_size, data_offset, code_point]
+const GFXglyph FiraSansZlib_Glyphs[] = {
+    { 0, 0, 11, 0, 0, 8, 0 }, // ' '
+    { 32, 33, 34, 1, 31, 306, 8 }, // '%'
+    { 7, 12, 10, 1, 5, 54, 314 }, // ','
+    { 6, 7, 10, 2, 6, 29, 368 }, // '.'
+    { 14, 39, 22, 4, 34, 159, 397 }, // '/'
+    { 19, 30, 23, 2, 29, 202, 556 }, // '0'
+    { 13, 29, 18, 1, 29, 61, 758 }, // '1'
+    { 18, 29, 21, 1, 29, 160, 819 }, // '2'
+    { 19, 30, 21, 0, 29, 188, 979 }, // '3'
+    { 20, 30, 22, 1, 30, 133, 1167 }, // '4'
+    { 18, 30, 21, 1, 29, 139, 1300 }, // '5'
+    { 19, 30, 22, 2, 29, 217, 1439 }, // '6'
+    { 17, 30, 19, 1, 29, 90, 1656 }, // '7'
+    { 6, 22, 10, 2, 21, 35, 1746 }, // ':'
+    { 24, 29, 24, 0, 29, 197, 1781 }, // 'A'
+    { 20, 29, 25, 4, 29, 163, 1978 }, // 'B'
+    { 21, 31, 23, 2, 30, 172, 2141 }, // 'C'
+    { 22, 31, 26, 2, 30, 199, 2313 }, // 'G'
+    { 28, 29, 32, 2, 29, 283, 2512 }, // 'M'
+    { 19, 29, 24, 4, 29, 109, 2795 }, // 'P'
+    { 21, 29, 25, 4, 29, 161, 2904 }, // 'R'
+    { 21, 30, 28, 3, 29, 106, 3065 }, // 'U'
+    { 23, 29, 23, 0, 29, 199, 3171 }, // 'V'
+    { 33, 29, 34, 1, 29, 303, 3370 }, // 'W'
+    { 20, 24, 23, 1, 23, 173, 3673 }, // 'a'
+    { 19, 33, 25, 2, 32, 168, 3846 }, // 'd'
+    { 19, 24, 23, 2, 23, 171, 4014 }, // 'e'
+    { 6, 33, 12, 3, 33, 30, 4185 }, // 'i'
+    { 9, 33, 12, 3, 32, 47, 4215 }, // 'l'
+    { 29, 23, 36, 3, 23, 113, 4262 }, // 'm'
+    { 18, 23, 24, 3, 23, 86, 4375 }, // 'n'
+    { 20, 24, 24, 2, 23, 161, 4461 }, // 'o'
+    { 20, 33, 25, 3, 23, 161, 4622 }, // 'p'
+    { 13, 23, 16, 3, 23, 69, 4783 }, // 'r'
+    { 17, 24, 19, 1, 23, 163, 4852 }, // 's'
+    { 16, 29, 15, 0, 28, 82, 5015 }, // 't'
+    { 21, 32, 21, 0, 22, 198, 5097 }, // 'y'
+};
+const GFXfont FiraSansZlib = {
+    (uint8_t *)FiraSansZlib_Bitmaps, // (*bitmap) Glyph bitmap pointer, all concatenated together
+    (GFXglyph *)FiraSansZlib_Glyphs, // glyphs Glyph array
+    (UnicodeInterval *)FiraSansZlib_Intervals, // intervals Valid unicode intervals for this font
+    17,   // interval_count Number of unicode intervals.intervals
+    1, // compressed Does this font use compressed glyph bitmaps?
+    50, // advance_y Newline distance (y axis)
+    39, // ascender Maximal height of a glyph above the base line
+    -12, // descender Maximal height of a glyph below the base line
+    FiraSansZlib_AsciiGlyphs, // ascii_glyphs Glyph index of each code point below 128
+    0, // format Glyph bitmap storage, FontFormat_t
+    0, // atlas_stride Bytes per atlas row
+    NULL, // kerning Sorted kerning pairs
+    0, // kerning_count Number of kerning pairs
+};
+/*
+Included intervals
+    ( 32, 32), ie. ' ' -  ' '
+    ( 37, 37), ie. '%' -  '%'
+    ( 44, 44), ie. ',' -  ','
+    ( 46, 55), ie. '.' -  '7'
+    ( 58, 58), ie. ':' -  ':'
+    ( 65, 67), ie. 'A' -  'C'
+    ( 71, 71), ie. 'G' -  'G'
+    ( 77, 77), ie. 'M' -  'M'
+    ( 80, 80), ie. 'P' -  'P'
+    ( 82, 82), ie. 'R' -  'R'
+    ( 85, 87), ie. 'U' -  'W'
+    ( 97, 97), ie. 'a' -  'a'
+    ( 100, 101), ie. 'd' -  'e'
+    ( 105, 105), ie. 'i' -  'i'
+    ( 108, 112), ie. 'l' -  'p'
+    ( 114, 116), ie. 'r' -  't'
+    ( 121, 121), ie. 'y' -  'y'
+
+*/
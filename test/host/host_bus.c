@@ -0,0 +1,76 @@
+/*
+ * The display bus of ed047tc1.c on a host. Rows handed to it are dropped.
+ *
+ * This is a file of its own, so that a test which includes ed047tc1.c
+ * links without it.
+ */
+
+#include "ed047tc1.h"
+#include "epd_driver.h"
+
+#include <stdint.h>
+
+static uint32_t bus_row[EPD_WIDTH / 16];
+
+void epd_base_init(uint32_t epd_row_width, uint32_t pclk_hz)
+{
+    (void)epd_row_width;
+    (void)pclk_hz;
+}
+
+void epd_set_row_timing(uint16_t ckv_low_ticks, uint16_t skip_high_ticks,
+                        uint16_t skip_low_ticks)
+{
+    (void)ckv_low_ticks;
+    (void)skip_high_ticks;
+    (void)skip_low_ticks;
+}
+
+void epd_poweron()
+{
+}
+
+void epd_poweroff()
+{
+}
+
+void epd_start_frame()
+{
+}
+
+void epd_end_frame()
+{
+}
+
+void epd_output_row(uint32_t output_time_dus)
+{
+    (void)output_time_dus;
+}
+
+void epd_skip()
+{
+}
+
+void epd_skip_rows(uint32_t count)
+{
+    (void)count;
+}
+
+uint32_t epd_latch_cycles()
+{
+    return 0;
+}
+
+uint8_t *epd_get_current_buffer()
+{
+    return (uint8_t *)bus_row;
+}
+
+void epd_switch_buffer()
+{
+}
+
+uint32_t epd_bus_time_us()
+{
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * What the driver, font and image code need from ESP-IDF, FreeRTOS and the
+ * display bus, for running them on a host.
+ *
+ * The render tasks are never started, so the FreeRTOS calls only have to
+ * link. The display bus is in host_bus.c.
+ */
+
+#include "epd_driver.h"
+
+#include <driver/gpio.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <hal/gpio_ll.h>
+#include <xtensa/core-macros.h>
+
+#include <stdint.h>
+#include <time.h>
+
+int64_t esp_timer_get_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* A 240 MHz cycle counter, as on the ESP32-S3 */
+uint32_t xthal_get_ccount(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 240000000 + (uint64_t)ts.tv_nsec * 240 / 1000);
+}
+
+gpio_dev_t GPIO;
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode)
+{
+    (void)gpio_num;
+    (void)mode;
+    return ESP_OK;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    static int dummy;
+    return &dummy;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    (void)sem;
+    (void)ticks;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    (void)sem;
+    return pdTRUE;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name,
+                                   uint32_t stack, void *arg, UBaseType_t prio,
+                                   TaskHandle_t *handle, BaseType_t core)
+{
+    (void)task;
+    (void)name;
+    (void)stack;
+    (void)arg;
+    (void)prio;
+    (void)core;
+    static int dummy;
+    *handle = &dummy;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    (void)clear;
+    (void)ticks;
+    return 1;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void)task;
+    return pdPASS;
+}
+
+/* epd_driver.c declares min() C99 inline, an unoptimized build calls this */
+uint32_t min(uint32_t x, uint32_t y)
+{
+    return x < y ? x : y;
+}
@@ -0,0 +1,46 @@
+#pragma once
+/*
+ * Host stand-in for the ROM TJpgDec. jd_prepare() and jd_decomp() are
+ * implemented on top of libjpeg in tjpgd_host.c and hand out RGB888 blocks
+ * of one MCU, scaled by 1/2^scale the way TJpgDec does it.
+ */
+#include <stdint.h>
+
+typedef unsigned int  UINT;
+typedef unsigned char BYTE;
+typedef uint16_t      WORD;
+
+typedef enum
+{
+    JDR_OK = 0, /* Succeeded */
+    JDR_INTR,   /* Interrupted by output function */
+    JDR_INP,    /* Device error or wrong termination of input stream */
+    JDR_MEM1,   /* Insufficient memory pool for the image */
+    JDR_MEM2,   /* Insufficient stream input buffer */
+    JDR_PAR,    /* Parameter error */
+    JDR_FMT1,   /* Data format error (may be damaged data) */
+    JDR_FMT2,   /* Right format but not supported */
+    JDR_FMT3    /* Not supported JPEG standard */
+} JRESULT;
+
+typedef struct
+{
+    WORD left, right, top, bottom;
+} JRECT;
+
+typedef struct JDEC JDEC;
+struct JDEC
+{
+    BYTE  scale;       /* Output scaling ratio */
+    BYTE  msx, msy;    /* MCU size in unit of block (width, height) */
+    WORD  width;       /* Size of the input image (pixel) */
+    WORD  height;
+    void *pool;        /* Work area handed to jd_prepare() */
+    UINT  sz_pool;
+    UINT  (*infunc)(JDEC *, BYTE *, UINT);
+    void *device;      /* Pointer to I/O device identifier for the session */
+};
+
+JRESULT jd_prepare(JDEC *jd, UINT (*infunc)(JDEC *, BYTE *, UINT), void *pool,
+                   UINT sz_pool, void *dev);
+JRESULT jd_decomp(JDEC *jd, UINT (*outfunc)(JDEC *, void *, JRECT *), BYTE scale);
@@ -0,0 +1,12 @@
+#pragma once
+/* Host stand-in: errors and warnings go to stderr, the rest is dropped. */
+#include <esp_err.h>
+#include <stdio.h>
+
+#define ESP_LOG_HOST(tag, ...) \
+    (fprintf(stderr, "%s: ", tag), fprintf(stderr, __VA_ARGS__), fputc('\n', stderr))
+
+#define ESP_LOGE(tag, ...) ESP_LOG_HOST(tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) ESP_LOG_HOST(tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) ((void)(tag))
+#define ESP_LOGD(tag, ...) ((void)(tag))
@@ -0,0 +1,7 @@
+#pragma once
+#include <esp_err.h>
+
+static inline esp_err_t esp_task_wdt_reset(void)
+{
+    return ESP_OK;
+}
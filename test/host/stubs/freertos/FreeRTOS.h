@@ -0,0 +1,17 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int32_t  BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+
+typedef void *TaskHandle_t;
+typedef void *QueueHandle_t;
+typedef void *SemaphoreHandle_t;
+
+#define pdFALSE        0
+#define pdTRUE         1
+#define pdPASS         pdTRUE
+#define portMAX_DELAY  ((TickType_t)0xffffffff)
+#define tskNO_AFFINITY 0x7fffffff
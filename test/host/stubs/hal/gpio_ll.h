@@ -0,0 +1,13 @@
+#pragma once
+/* Host stand-in: the output set and clear registers. */
+#include <driver/gpio.h>
+
+#include <stdint.h>
+
+typedef struct
+{
+    volatile uint32_t out_w1ts;
+    volatile uint32_t out_w1tc;
+} gpio_dev_t;
+
+extern gpio_dev_t GPIO;
@@ -0,0 +1,7 @@
+#pragma once
+#include <stdint.h>
+
+/** Stand-in cycle counter, 240 "cycles" per microsecond. */
+uint32_t xthal_get_ccount(void);
+
+#define XTHAL_GET_CCOUNT() xthal_get_ccount()
@@ -0,0 +1,156 @@
+/*
+ * Each dither mode must turn the same gray JPEG into the same 16 level
+ * image as the checked in golden/ images, decoded both at its own size and
+ * shrunk by the box filter.
+ *
+ * Run with --update to rewrite the golden images after an intended change.
+ * A mismatch leaves the image drawn as <name>.actual.pgm.
+ */
+
+#include "epd_driver.h"
+#include "libjpeg/libjpeg.h"
+#include "test_images.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMAGE_W 96
+#define IMAGE_H 64
+
+static uint8_t framebuffer[EPD_WIDTH / 2 * EPD_HEIGHT];
+
+/* The image area of the framebuffer as 8 bit gray, 0xF -> 255 */
+static void region_to_gray(uint8_t *gray)
+{
+    for (uint32_t y = 0; y < IMAGE_H; y++)
+    {
+        for (uint32_t x = 0; x < IMAGE_W; x++)
+        {
+            uint8_t b = framebuffer[y * EPD_WIDTH / 2 + x / 2];
+            gray[y * IMAGE_W + x] = ((x & 1) ? b >> 4 : b & 0x0F) * 17;
+        }
+    }
+}
+
+static int write_pgm(const char *path, const uint8_t *gray)
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        return 0;
+    }
+    fprintf(f, "P5\n%d %d\n255\n", IMAGE_W, IMAGE_H);
+    int ok = fwrite(gray, 1, IMAGE_W * IMAGE_H, f) == IMAGE_W * IMAGE_H;
+    return fclose(f) == 0 && ok;
+}
+
+static int read_pgm(const char *path, uint8_t *gray)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        return 0;
+    }
+    int w, h, max;
+    int ok = fscanf(f, "P5 %d %d %d", &w, &h, &max) == 3 && fgetc(f) != EOF
+             && w == IMAGE_W && h == IMAGE_H && max == 255
+             && fread(gray, 1, IMAGE_W * IMAGE_H, f) == IMAGE_W * IMAGE_H;
+    fclose(f);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    static const JpegDither_t modes[] = {
+        JPEG_DITHER_NONE, JPEG_DITHER_BAYER, JPEG_DITHER_ERROR_DIFFUSION
+    };
+    static const char *names[] = { "none", "bayer", "diffusion" };
+    int update = argc > 1 && strcmp(argv[1], "--update") == 0;
+    int failed = 0;
+
+    uint8_t *pixels = test_image(IMAGE_W, IMAGE_H, 1, 3);
+    uint8_t *jpeg;
+    size_t size = test_jpeg_encode(pixels, IMAGE_W, IMAGE_H, 1, 90, &jpeg);
+    free(pixels);
+    pixels = test_image(IMAGE_W * 3, IMAGE_H * 3, 1, 3);
+    uint8_t *large_jpeg;
+    size_t large_size = test_jpeg_encode(pixels, IMAGE_W * 3, IMAGE_H * 3, 1, 90, &large_jpeg);
+    free(pixels);
+
+    libjpeg_ctx_t *ctx = libjpeg_ctx_create();
+    for (uint32_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        libjpeg_ctx_set_dither(ctx, modes[m]);
+        for (int scaled = 0; scaled < 2; scaled++)
+        {
+            ImageSource src;
+            Rect_t area = { .x = 0, .y = 0, .width = IMAGE_W, .height = IMAGE_H };
+            int ret;
+            memset(framebuffer, 0xFF, sizeof(framebuffer));
+            if (scaled)
+            {
+                image_source_init_buffer(&src, large_jpeg, large_size);
+                ret = libjpeg_ctx_draw_scaled(ctx, &src, area, JPEG_SCALE_FIT, framebuffer);
+            }
+            else
+            {
+                image_source_init_buffer(&src, jpeg, size);
+                ret = libjpeg_ctx_draw(ctx, &src, &area, framebuffer);
+            }
+
+            char name[64];
+            snprintf(name, sizeof(name), "dither_%s%s", names[m], scaled ? "_scaled" : "");
+            if (ret != 1)
+            {
+                printf("%s: decode failed\n", name);
+                failed = 1;
+                continue;
+            }
+
+            uint8_t actual[IMAGE_W * IMAGE_H];
+            uint8_t golden[IMAGE_W * IMAGE_H];
+            char path[512];
+            region_to_gray(actual);
+            snprintf(path, sizeof(path), "%s/%s.pgm", GOLDEN_DIR, name);
+            if (update)
+            {
+                if (!write_pgm(path, actual))
+                {
+                    printf("%s: cannot write %s\n", name, path);
+                    failed = 1;
+                }
+                continue;
+            }
+            if (!read_pgm(path, golden))
+            {
+                printf("%s: cannot read %s\n", name, path);
+                failed = 1;
+                continue;
+            }
+
+            uint32_t differ = 0;
+            for (uint32_t i = 0; i < IMAGE_W * IMAGE_H; i++)
+            {
+                differ += actual[i] != golden[i];
+            }
+            if (differ)
+            {
+                snprintf(path, sizeof(path), "%s.actual.pgm", name);
+                write_pgm(path, actual);
+                failed = 1;
+            }
+            printf("%-26s %s", name, differ ? "FAILED" : "ok");
+            if (differ)
+            {
+                printf(", %u pixels differ, see %s", differ, path);
+            }
+            printf("\n");
+        }
+    }
+
+    libjpeg_ctx_destroy(ctx);
+    free(jpeg);
+    free(large_jpeg);
+    return failed;
+}
@@ -0,0 +1,73 @@
+#include "test_images.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* jpeglib.h needs FILE and size_t declared first */
+#include <jpeglib.h>
+
+uint8_t *test_image(uint32_t width, uint32_t height, uint32_t components, uint32_t seed)
+{
+    uint8_t *pixels = malloc((size_t)width * height * components);
+    if (pixels == NULL)
+    {
+        return NULL;
+    }
+
+    double cx = width * (0.3 + 0.1 * (seed % 5));
+    double cy = height * (0.4 + 0.05 * (seed % 7));
+    for (uint32_t y = 0; y < height; y++)
+    {
+        for (uint32_t x = 0; x < width; x++)
+        {
+            double fx = (double)x / width;
+            double fy = (double)y / height;
+            double r = hypot(x - cx, y - cy) / (width + height);
+            for (uint32_t c = 0; c < components; c++)
+            {
+                double v = 0.5 * fx + 0.3 * fy + 0.2 * (0.5 + 0.5 * cos(40 * r + c + seed));
+                // a dark bar and a light box with hard edges
+                if (fx > 0.70 && fx < 0.75)
+                {
+                    v *= 0.2;
+                }
+                if (fy > 0.60 && fy < 0.85 && fx > 0.10 && fx < 0.30)
+                {
+                    v = 0.9;
+                }
+                pixels[((size_t)y * width + x) * components + c] = (uint8_t)(255 * v);
+            }
+        }
+    }
+    return pixels;
+}
+
+size_t test_jpeg_encode(const uint8_t *pixels, uint32_t width, uint32_t height,
+                        uint32_t components, int quality, uint8_t **jpeg)
+{
+    struct jpeg_compress_struct cinfo;
+    struct jpeg_error_mgr err;
+    unsigned long size = 0;
+
+    *jpeg = NULL;
+    cinfo.err = jpeg_std_error(&err);
+    jpeg_create_compress(&cinfo);
+    jpeg_mem_dest(&cinfo, jpeg, &size);
+    cinfo.image_width = width;
+    cinfo.image_height = height;
+    cinfo.input_components = components;
+    cinfo.in_color_space = components == 1 ? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    cinfo.dct_method = JDCT_ISLOW;
+    jpeg_start_compress(&cinfo, TRUE);
+    while (cinfo.next_scanline < cinfo.image_height)
+    {
+        JSAMPROW row = (JSAMPROW)&pixels[(size_t)cinfo.next_scanline * width * components];
+        jpeg_write_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+    return size;
+}
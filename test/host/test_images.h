@@ -0,0 +1,24 @@
+#pragma once
+/*
+ * Generated images for the host tests and benchmarks, so no image files
+ * have to be checked in.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A photo-like image: smooth gradients, rings and a few hard edges.
+ * `components` is 1 for gray or 3 for RGB. The same seed gives the same
+ * image. Free with free().
+ */
+uint8_t *test_image(uint32_t width, uint32_t height, uint32_t components, uint32_t seed);
+
+/**
+ * Encode an image as a baseline JPEG with the integer DCT, so that decoding
+ * it gives the same pixels with any libjpeg. Free *jpeg with free().
+ *
+ * @return Size of the JPEG in bytes, 0 on errors.
+ */
+size_t test_jpeg_encode(const uint8_t *pixels, uint32_t width, uint32_t height,
+                        uint32_t components, int quality, uint8_t **jpeg);
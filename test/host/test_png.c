@@ -0,0 +1,540 @@
+/*
+ * PNG and G4Z1 decoding, pixel for pixel. Small images are encoded here in
+ * every color type and bit depth, with every row filter and with the zlib
+ * stream split over several IDAT chunks. They are drawn at even, odd and
+ * clipped positions, and the whole framebuffer must match a reference
+ * drawing of the expected 4bpp pixels.
+ *
+ * The samples are chosen so that the expected gray follows from the
+ * sample alone: gray pixels are gray, palette entries and RGB pixels have
+ * equal components, and alpha is 0 or opaque but for one palette entry.
+ * The color weights and alpha blending have a case of their own with
+ * worked out values.
+ */
+
+#include "epd_driver.h"
+#include "libpng/libpng.h"
+#include "zlib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define W 13 /* odd, so rows end in a half byte */
+#define H 7
+
+#define MAX_PNG 4096
+
+/* The row filter used for every row, or FILTER_CYCLE for row y % 5 */
+#define FILTER_CYCLE 5
+
+typedef struct
+{
+    const char *name;
+    uint8_t     color_type;
+    uint8_t     depth;
+    uint8_t     filter;
+    int         trns;      /* add a tRNS chunk */
+    int         split;     /* spread the zlib stream over several IDATs */
+} png_case_t;
+
+typedef struct
+{
+    int32_t x;
+    int32_t y;
+} position_t;
+
+static const png_case_t png_cases[] = {
+    { "gray 1",               0,  1, FILTER_CYCLE, 0, 0 },
+    { "gray 2",               0,  2, FILTER_CYCLE, 0, 0 },
+    { "gray 4",               0,  4, FILTER_CYCLE, 0, 0 },
+    { "gray 8",               0,  8, FILTER_CYCLE, 0, 0 },
+    { "gray 16",              0, 16, FILTER_CYCLE, 0, 0 },
+    { "gray 8, tRNS",         0,  8, FILTER_CYCLE, 1, 0 },
+    { "gray 16, tRNS",        0, 16, FILTER_CYCLE, 1, 0 },
+    { "palette 1",            3,  1, FILTER_CYCLE, 0, 0 },
+    { "palette 2",            3,  2, FILTER_CYCLE, 0, 0 },
+    { "palette 4",            3,  4, FILTER_CYCLE, 0, 0 },
+    { "palette 8",            3,  8, FILTER_CYCLE, 0, 0 },
+    { "palette 4, tRNS",      3,  4, FILTER_CYCLE, 1, 0 },
+    { "palette 8, tRNS",      3,  8, FILTER_CYCLE, 1, 0 },
+    { "RGB 8",                2,  8, FILTER_CYCLE, 0, 0 },
+    { "RGB 16",               2, 16, FILTER_CYCLE, 0, 0 },
+    { "RGB 8, tRNS",          2,  8, FILTER_CYCLE, 1, 0 },
+    { "RGB 16, tRNS",         2, 16, FILTER_CYCLE, 1, 0 },
+    { "gray-alpha 8",         4,  8, FILTER_CYCLE, 0, 0 },
+    { "gray-alpha 16",        4, 16, FILTER_CYCLE, 0, 0 },
+    { "RGBA 8",               6,  8, FILTER_CYCLE, 0, 0 },
+    { "RGBA 16",              6, 16, FILTER_CYCLE, 0, 0 },
+    { "gray 8, None",         0,  8, 0,            0, 0 },
+    { "gray 8, Sub",          0,  8, 1,            0, 0 },
+    { "gray 8, Up",           0,  8, 2,            0, 0 },
+    { "gray 8, Average",      0,  8, 3,            0, 0 },
+    { "gray 8, Paeth",        0,  8, 4,            0, 0 },
+    { "RGBA 16, None",        6, 16, 0,            0, 0 },
+    { "RGBA 16, Sub",         6, 16, 1,            0, 0 },
+    { "RGBA 16, Up",          6, 16, 2,            0, 0 },
+    { "RGBA 16, Average",     6, 16, 3,            0, 0 },
+    { "RGBA 16, Paeth",       6, 16, 4,            0, 0 },
+    { "gray 2, split IDAT",   0,  2, FILTER_CYCLE, 0, 1 },
+    { "RGB 16, split IDAT",   2, 16, FILTER_CYCLE, 0, 1 },
+    { "palette 8, split IDAT", 3, 8, FILTER_CYCLE, 1, 1 },
+};
+
+static const position_t positions[] = {
+    { 100, 10 },                           /* even x */
+    { 101, 3 },                            /* odd x */
+    { -5, -2 },                            /* clipped left and top */
+    { -4, 0 },                             /* clipped left at an even x */
+    { EPD_WIDTH - 6, EPD_HEIGHT - 4 },     /* clipped right and bottom */
+    { EPD_WIDTH - 7, 20 },                 /* clipped right at an odd x */
+};
+
+static uint8_t framebuffer[EPD_WIDTH / 2 * EPD_HEIGHT];
+static uint8_t expected[EPD_WIDTH / 2 * EPD_HEIGHT];
+
+/* 8-bit gray of the test image */
+static uint8_t pattern(int32_t x, int32_t y)
+{
+    return (uint8_t)(x * 37 + y * 101 + (x * y) * 13);
+}
+
+/* The pixels made transparent, one per row */
+static int transparent_at(int32_t x, int32_t y)
+{
+    return x == (y * 5) % W;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static size_t put_chunk(uint8_t *out, const char *type, const uint8_t *data, uint32_t len)
+{
+    put_be32(out, len);
+    memcpy(out + 4, type, 4);
+    if (len > 0)
+    {
+        memcpy(out + 8, data, len);
+    }
+    put_be32(out + 8 + len, crc32(0, out + 4, len + 4));
+    return len + 12;
+}
+
+static void put_sample(uint8_t *row, uint32_t index, uint32_t depth, uint32_t v)
+{
+    if (depth == 16)
+    {
+        row[2 * index] = v >> 8;
+        row[2 * index + 1] = v;
+    }
+    else if (depth == 8)
+    {
+        row[index] = v;
+    }
+    else
+    {
+        uint32_t bit = index * depth;
+        row[bit / 8] |= v << (8 - depth - bit % 8);
+    }
+}
+
+static uint32_t channels(const png_case_t *c)
+{
+    static const uint32_t count[] = { 1, 0, 3, 1, 2, 0, 4 };
+    return count[c->color_type];
+}
+
+/* The tRNS value of gray and RGB images, never white */
+static uint32_t trns_value(const png_case_t *c, uint32_t k)
+{
+    if (c->depth < 8)
+    {
+        return c->depth == 1 ? 0 : 1;
+    }
+    return c->depth == 16 ? 0x0101 * (1 + k) + 0x10 : 1 + k;
+}
+
+/* The gray of a palette entry; with tRNS the first one is transparent and
+ * the second one half so */
+static uint32_t palette_gray(const png_case_t *c, uint32_t index)
+{
+    return index * 255 / ((1 << c->depth) - 1);
+}
+
+/*
+ * Sample k of a pixel. Gray and color samples are the pattern, 16-bit ones
+ * with noise in the low byte that the decoder must drop. Alpha is opaque
+ * except for the transparent pixels, which gray and RGB images with tRNS
+ * give the tRNS value instead.
+ */
+static uint32_t sample(const png_case_t *c, int32_t x, int32_t y, uint32_t k)
+{
+    uint32_t d = c->depth;
+    uint32_t max = (1 << d) - 1;
+    uint32_t p = pattern(x, y) >> (d < 8 ? 8 - d : 0);
+    if (d == 16)
+    {
+        p = p << 8 | ((x * 59 + y * 31 + k * 17) & 0xFF);
+    }
+
+    int clear = transparent_at(x, y);
+    int alpha = (c->color_type == 4 && k == 1) || (c->color_type == 6 && k == 3);
+    if (alpha)
+    {
+        return clear ? 0 : max;
+    }
+    if (c->trns && clear && (c->color_type == 0 || c->color_type == 2))
+    {
+        return trns_value(c, k);
+    }
+    return p;
+}
+
+/* The 4bpp pixel the decoder must produce */
+static uint8_t expected_pixel(const png_case_t *c, int32_t x, int32_t y)
+{
+    uint32_t d = c->depth;
+    uint32_t v = sample(c, x, y, 0);
+    uint32_t gray;
+
+    switch (c->color_type)
+    {
+    case 0:
+        if (c->trns && v == trns_value(c, 0))
+        {
+            return 15;
+        }
+        gray = d < 8 ? v * (255 / ((1 << d) - 1)) : v >> (d - 8);
+        break;
+    case 3:
+        gray = palette_gray(c, v);
+        if (c->trns && v < 2)
+        {
+            uint32_t a = v == 0 ? 0 : 128;
+            gray = (gray * a + 255 * (255 - a) + 127) / 255;
+        }
+        break;
+    case 2:
+        if (c->trns && v == trns_value(c, 0) && sample(c, x, y, 1) == trns_value(c, 1)
+            && sample(c, x, y, 2) == trns_value(c, 2))
+        {
+            return 15;
+        }
+        // equal components, so the weights add up to the sample
+        gray = v >> (d - 8);
+        break;
+    default:
+        // alpha is 0 or opaque, and blending onto white with 0 is white
+        gray = transparent_at(x, y) ? 255 : v >> (d - 8);
+        break;
+    }
+    return gray >> 4;
+}
+
+/* The raw (unfiltered) rows of a case */
+static uint32_t raw_rows(const png_case_t *c, uint8_t *raw)
+{
+    uint32_t n = channels(c);
+    uint32_t row_bytes = (W * n * c->depth + 7) / 8;
+    memset(raw, 0, row_bytes * H);
+
+    for (int32_t y = 0; y < H; y++)
+    {
+        for (int32_t x = 0; x < W; x++)
+        {
+            for (uint32_t k = 0; k < n; k++)
+            {
+                put_sample(raw + y * row_bytes, x * n + k, c->depth, sample(c, x, y, k));
+            }
+        }
+    }
+    return row_bytes;
+}
+
+static uint8_t paeth(int32_t a, int32_t b, int32_t c)
+{
+    int32_t p = a + b - c;
+    int32_t pa = abs(p - a);
+    int32_t pb = abs(p - b);
+    int32_t pc = abs(p - c);
+    return (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+}
+
+/* Filter the raw rows, each prefixed with its filter type */
+static size_t filter_rows(const png_case_t *c, const uint8_t *raw, uint32_t row_bytes,
+                          uint8_t *out)
+{
+    uint32_t bits = channels(c) * c->depth;
+    uint32_t bpp = bits >= 8 ? bits / 8 : 1;
+
+    for (int32_t y = 0; y < H; y++)
+    {
+        const uint8_t *row = raw + y * row_bytes;
+        const uint8_t *up = y > 0 ? row - row_bytes : NULL;
+        uint8_t filter = c->filter == FILTER_CYCLE ? y % 5 : c->filter;
+        uint8_t *dst = out + y * (row_bytes + 1);
+        dst[0] = filter;
+        for (uint32_t i = 0; i < row_bytes; i++)
+        {
+            int32_t a = i >= bpp ? row[i - bpp] : 0;
+            int32_t b = up ? up[i] : 0;
+            int32_t cc = i >= bpp && up ? up[i - bpp] : 0;
+            int32_t predictor = 0;
+            switch (filter)
+            {
+            case 1: predictor = a; break;
+            case 2: predictor = b; break;
+            case 3: predictor = (a + b) / 2; break;
+            case 4: predictor = paeth(a, b, cc); break;
+            }
+            dst[1 + i] = row[i] - predictor;
+        }
+    }
+    return H * (row_bytes + 1);
+}
+
+static size_t encode_png(const png_case_t *c, uint8_t *png)
+{
+    static uint8_t raw[MAX_PNG];
+    static uint8_t filtered[MAX_PNG];
+    static uint8_t packed[MAX_PNG];
+    uint8_t buf[3 * 256];
+
+    uint32_t row_bytes = raw_rows(c, raw);
+    size_t filtered_size = filter_rows(c, raw, row_bytes, filtered);
+    uLongf packed_size = sizeof(packed);
+    compress2(packed, &packed_size, filtered, filtered_size, 9);
+
+    size_t n = 0;
+    memcpy(png, "\x89PNG\r\n\x1a\n", 8);
+    n += 8;
+
+    put_be32(buf, W);
+    put_be32(buf + 4, H);
+    buf[8] = c->depth;
+    buf[9] = c->color_type;
+    buf[10] = buf[11] = buf[12] = 0;
+    n += put_chunk(png + n, "IHDR", buf, 13);
+
+    // an ancillary chunk to skip
+    n += put_chunk(png + n, "tEXt", (const uint8_t *)"Comment\0test", 12);
+
+    if (c->color_type == 3)
+    {
+        uint32_t entries = 1 << c->depth;
+        for (uint32_t i = 0; i < entries; i++)
+        {
+            buf[3 * i] = buf[3 * i + 1] = buf[3 * i + 2] = palette_gray(c, i);
+        }
+        n += put_chunk(png + n, "PLTE", buf, 3 * entries);
+        if (c->trns)
+        {
+            // shorter than the palette, the rest is opaque
+            buf[0] = 0;
+            buf[1] = 128;
+            n += put_chunk(png + n, "tRNS", buf, 2);
+        }
+    }
+    else if (c->trns)
+    {
+        for (uint32_t k = 0; k < channels(c); k++)
+        {
+            buf[2 * k] = trns_value(c, k) >> 8;
+            buf[2 * k + 1] = trns_value(c, k);
+        }
+        n += put_chunk(png + n, "tRNS", buf, 2 * channels(c));
+    }
+
+    if (c->split)
+    {
+        // one byte, an empty chunk, seven bytes, then the rest
+        n += put_chunk(png + n, "IDAT", packed, 1);
+        n += put_chunk(png + n, "IDAT", NULL, 0);
+        n += put_chunk(png + n, "IDAT", packed + 1, 7);
+        n += put_chunk(png + n, "IDAT", packed + 8, packed_size - 8);
+    }
+    else
+    {
+        n += put_chunk(png + n, "IDAT", packed, packed_size);
+    }
+    n += put_chunk(png + n, "IEND", NULL, 0);
+    return n;
+}
+
+static void set_pixel(uint8_t *fb, int32_t x, int32_t y, uint8_t v)
+{
+    if (x < 0 || x >= EPD_WIDTH || y < 0 || y >= EPD_HEIGHT)
+    {
+        return;
+    }
+    uint8_t *p = &fb[y * EPD_WIDTH / 2 + x / 2];
+    *p = (x & 1) ? (*p & 0x0F) | (v << 4) : (*p & 0xF0) | v;
+}
+
+/* Compare the framebuffers, reporting the first differing pixel */
+static int check(const char *name, position_t pos)
+{
+    if (memcmp(framebuffer, expected, sizeof(framebuffer)) == 0)
+    {
+        return 0;
+    }
+    for (uint32_t i = 0; i < sizeof(framebuffer); i++)
+    {
+        if (framebuffer[i] != expected[i])
+        {
+            printf("%s at %d, %d: pixels %u, %u of row %u are 0x%02x, expected 0x%02x\n",
+                   name, pos.x, pos.y, i % (EPD_WIDTH / 2) * 2, i % (EPD_WIDTH / 2) * 2 + 1,
+                   i / (EPD_WIDTH / 2), framebuffer[i], expected[i]);
+            break;
+        }
+    }
+    return 1;
+}
+
+static int draw_case(const char *name, position_t pos, int gray4, uint8_t *data, size_t size,
+                     uint8_t (*pixel)(const void *, int32_t, int32_t), const void *arg)
+{
+    // a pattern that differs from the image in both nibbles
+    memset(framebuffer, 0x96, sizeof(framebuffer));
+    memset(expected, 0x96, sizeof(expected));
+    for (int32_t y = 0; y < H; y++)
+    {
+        for (int32_t x = 0; x < W; x++)
+        {
+            set_pixel(expected, pos.x + x, pos.y + y, pixel(arg, x, y));
+        }
+    }
+
+    Rect_t area = { .x = pos.x, .y = pos.y };
+    int ret = gray4 ? draw_gray4_from_buff(data, size, &area, framebuffer)
+                    : draw_png_from_buff(data, size, &area, framebuffer);
+    if (ret != 1 || area.width != W || area.height != H)
+    {
+        printf("%s at %d, %d: returned %d, size %dx%d\n", name, pos.x, pos.y, ret,
+               area.width, area.height);
+        return 1;
+    }
+    return check(name, pos);
+}
+
+static uint8_t png_pixel(const void *arg, int32_t x, int32_t y)
+{
+    return expected_pixel((const png_case_t *)arg, x, y);
+}
+
+static uint8_t gray4_pixel(const void *arg, int32_t x, int32_t y)
+{
+    (void)arg;
+    return pattern(x, y) >> 4;
+}
+
+/* Pixels of one color each, for the gray weights and alpha blending */
+static int check_colors(void)
+{
+    static const struct
+    {
+        uint8_t r, g, b, a;
+        uint8_t gray; /* (r * 38 + g * 75 + b * 15) / 128, blended onto white */
+    } colors[] = {
+        { 255,   0,   0, 255,  75 },
+        {   0, 255,   0, 255, 149 },
+        {   0,   0, 255, 255,  29 },
+        { 200, 100,  50, 255, 123 },
+        {   0,   0,   0, 128, 127 },
+        {   0,   0,   0,  64, 191 },
+        { 255,   0,   0,  51, 219 },
+    };
+    uint32_t count = sizeof(colors) / sizeof(colors[0]);
+    uint8_t raw[1 + 4 * 8];
+    uint8_t packed[256];
+    static uint8_t png[MAX_PNG];
+    int failed = 0;
+
+    raw[0] = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        raw[1 + 4 * i] = colors[i].r;
+        raw[2 + 4 * i] = colors[i].g;
+        raw[3 + 4 * i] = colors[i].b;
+        raw[4 + 4 * i] = colors[i].a;
+    }
+    uLongf packed_size = sizeof(packed);
+    compress2(packed, &packed_size, raw, 1 + 4 * count, 9);
+
+    uint8_t ihdr[13] = { 0 };
+    put_be32(ihdr, count);
+    put_be32(ihdr + 4, 1);
+    ihdr[8] = 8;
+    ihdr[9] = 6;
+    size_t n = 8;
+    memcpy(png, "\x89PNG\r\n\x1a\n", 8);
+    n += put_chunk(png + n, "IHDR", ihdr, 13);
+    n += put_chunk(png + n, "IDAT", packed, packed_size);
+    n += put_chunk(png + n, "IEND", NULL, 0);
+
+    memset(framebuffer, 0, sizeof(framebuffer));
+    Rect_t area = { .x = 0, .y = 0 };
+    if (draw_png_from_buff(png, n, &area, framebuffer) != 1)
+    {
+        printf("colors: decode failed\n");
+        return 1;
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint8_t v = (framebuffer[i / 2] >> (4 * (i & 1))) & 0x0F;
+        if (v != colors[i].gray >> 4)
+        {
+            printf("colors: %u, %u, %u alpha %u is %u, expected %u\n", colors[i].r,
+                   colors[i].g, colors[i].b, colors[i].a, v, colors[i].gray >> 4);
+            failed = 1;
+        }
+    }
+    return failed;
+}
+
+int main(void)
+{
+    static uint8_t png[MAX_PNG];
+    uint32_t cases = 0;
+    int failed = 0;
+
+    for (uint32_t i = 0; i < sizeof(png_cases) / sizeof(png_cases[0]); i++)
+    {
+        const png_case_t *c = &png_cases[i];
+        size_t size = encode_png(c, png);
+        for (uint32_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++)
+        {
+            failed |= draw_case(c->name, positions[p], 0, png, size, png_pixel, c);
+            cases++;
+        }
+    }
+
+    // G4Z1: the magic, little endian size, then rows in framebuffer order
+    uint8_t rows[H * (W + 1) / 2];
+    memset(rows, 0, sizeof(rows));
+    for (int32_t y = 0; y < H; y++)
+    {
+        for (int32_t x = 0; x < W; x++)
+        {
+            rows[y * ((W + 1) / 2) + x / 2] |= (pattern(x, y) >> 4) << (4 * (x & 1));
+        }
+    }
+    uint8_t gray4[8 + 256] = { 'G', '4', 'Z', '1', W, 0, H, 0 };
+    uLongf packed_size = sizeof(gray4) - 8;
+    compress2(gray4 + 8, &packed_size, rows, sizeof(rows), 9);
+    for (uint32_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++)
+    {
+        failed |= draw_case("G4Z1", positions[p], 1, gray4, 8 + packed_size, gray4_pixel, NULL);
+        cases++;
+    }
+
+    failed |= check_colors();
+
+    printf("%u decodes checked\n", cases);
+    return failed;
+}
@@ -0,0 +1,93 @@
+/*
+ * The per-frame conversion tables built by update_LUT() must match the ones
+ * the old in-place update produced, byte for byte, for all 15 frames of
+ * each draw mode.
+ */
+
+#include "epd_driver.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* reset_lut() and update_LUT() as they were before the tables were built per frame */
+static void old_reset_lut(uint8_t *lut_mem, DrawMode_t mode)
+{
+    switch (mode)
+    {
+    case BLACK_ON_WHITE:
+        memset(lut_mem, 0x55, (1 << 16));
+        break;
+    case WHITE_ON_BLACK:
+    case WHITE_ON_WHITE:
+        memset(lut_mem, 0xAA, (1 << 16));
+        break;
+    default:
+        break;
+    }
+}
+
+static void old_update_LUT(uint8_t *lut_mem, uint8_t k, DrawMode_t mode)
+{
+    if (mode == BLACK_ON_WHITE || mode == WHITE_ON_WHITE)
+    {
+        k = 15 - k;
+    }
+
+    for (uint32_t l = k; l < (1 << 16); l += 16)
+    {
+        lut_mem[l] &= 0xFC;
+    }
+    for (uint32_t l = (k << 4); l < (1 << 16); l += (1 << 8))
+    {
+        for (uint32_t p = 0; p < 16; p++)
+        {
+            lut_mem[l + p] &= 0xF3;
+        }
+    }
+    for (uint32_t l = (k << 8); l < (1 << 16); l += (1 << 12))
+    {
+        for (uint32_t p = 0; p < (1 << 8); p++)
+        {
+            lut_mem[l + p] &= 0xCF;
+        }
+    }
+    for (uint32_t p = (k << 12); p < ((k + 1) << 12); p++)
+    {
+        lut_mem[p] &= 0x3F;
+    }
+}
+
+int main(void)
+{
+    static const DrawMode_t modes[] = { BLACK_ON_WHITE, WHITE_ON_WHITE, WHITE_ON_BLACK };
+    static const char *names[] = { "BLACK_ON_WHITE", "WHITE_ON_WHITE", "WHITE_ON_BLACK" };
+    uint8_t *expected = malloc(1 << 16);
+    uint8_t *actual = malloc(1 << 16);
+    int failed = 0;
+
+    for (uint32_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        old_reset_lut(expected, modes[m]);
+        for (uint8_t k = 0; k < EPD_FRAME_COUNT; k++)
+        {
+            old_update_LUT(expected, k, modes[m]);
+            memset(actual, 0x5A, 1 << 16);
+            update_LUT(actual, k, modes[m]);
+            for (uint32_t i = 0; i < (1 << 16); i++)
+            {
+                if (actual[i] != expected[i])
+                {
+                    printf("%s frame %u: index 0x%04x is 0x%02x, expected 0x%02x\n",
+                           names[m], k, i, actual[i], expected[i]);
+                    failed = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    free(expected);
+    free(actual);
+    printf("update_LUT: %s\n", failed ? "FAILED" : "all frames match");
+    return failed;
+}
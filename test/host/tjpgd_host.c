@@ -0,0 +1,204 @@
+/*
+ * TJpgDec on top of libjpeg, for running the JPEG path on a host.
+ *
+ * The whole image is decoded at full size and handed out one MCU at a time
+ * in the order TJpgDec uses. Scaled decodes keep every 2^scale-th pixel of
+ * the MCU, which is what TJpgDec does for 1/2 and 1/4 and close to its DC
+ * only 1/8. Like TJpgDec, a partial MCU at the right or bottom edge is
+ * clipped to the image before it is scaled, so odd sizes round down.
+ */
+
+#include "esp32s3/rom/tjpgd.h"
+
+#include <pthread.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* jpeglib.h needs FILE and size_t declared first */
+#include <jpeglib.h>
+
+typedef struct
+{
+    struct jpeg_error_mgr mgr;
+    jmp_buf               env;
+} host_error_t;
+
+/* Each thread keeps its input and pixels for the next decode */
+static _Thread_local uint8_t *input;
+static _Thread_local size_t   input_size;
+static _Thread_local size_t   input_cap;
+static _Thread_local uint8_t *pixels;
+static _Thread_local size_t   pixels_cap;
+
+/* Frees them when the thread exits */
+static pthread_key_t  buffers_key;
+static pthread_once_t buffers_once = PTHREAD_ONCE_INIT;
+
+static void host_error_exit(j_common_ptr cinfo)
+{
+    longjmp(((host_error_t *)cinfo->err)->env, 1);
+}
+
+static void free_buffers(void *arg)
+{
+    (void)arg;
+    free(input);
+    free(pixels);
+    input = NULL;
+    pixels = NULL;
+    input_cap = 0;
+    pixels_cap = 0;
+}
+
+static void create_buffers_key(void)
+{
+    pthread_key_create(&buffers_key, free_buffers);
+}
+
+static int grow(uint8_t **buf, size_t *cap, size_t size)
+{
+    if (size <= *cap)
+    {
+        return 1;
+    }
+    uint8_t *p = realloc(*buf, size);
+    if (p == NULL)
+    {
+        return 0;
+    }
+    *buf = p;
+    *cap = size;
+
+    pthread_once(&buffers_once, create_buffers_key);
+    pthread_setspecific(buffers_key, buf);
+    return 1;
+}
+
+JRESULT jd_prepare(JDEC *jd, UINT (*infunc)(JDEC *, BYTE *, UINT), void *pool,
+                   UINT sz_pool, void *dev)
+{
+    memset(jd, 0, sizeof(*jd));
+    jd->pool = pool;
+    jd->sz_pool = sz_pool;
+    jd->infunc = infunc;
+    jd->device = dev;
+
+    input_size = 0;
+    for (;;)
+    {
+        if (!grow(&input, &input_cap, input_size + 4096))
+        {
+            return JDR_MEM1;
+        }
+        UINT n = infunc(jd, input + input_size, 4096);
+        input_size += n;
+        if (n < 4096)
+        {
+            break;
+        }
+    }
+
+    struct jpeg_decompress_struct cinfo;
+    host_error_t err;
+    cinfo.err = jpeg_std_error(&err.mgr);
+    err.mgr.error_exit = host_error_exit;
+    if (setjmp(err.env))
+    {
+        jpeg_destroy_decompress(&cinfo);
+        return JDR_FMT1;
+    }
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, input, input_size);
+    jpeg_read_header(&cinfo, TRUE);
+    if (cinfo.image_width > 0xFFFF || cinfo.image_height > 0xFFFF)
+    {
+        jpeg_destroy_decompress(&cinfo);
+        return JDR_FMT3;
+    }
+    jd->width = cinfo.image_width;
+    jd->height = cinfo.image_height;
+    jd->msx = cinfo.max_h_samp_factor;
+    jd->msy = cinfo.max_v_samp_factor;
+    jpeg_destroy_decompress(&cinfo);
+
+    return JDR_OK;
+}
+
+JRESULT jd_decomp(JDEC *jd, UINT (*outfunc)(JDEC *, void *, JRECT *), BYTE scale)
+{
+    if (scale > 3)
+    {
+        return JDR_PAR;
+    }
+    jd->scale = scale;
+
+    struct jpeg_decompress_struct cinfo;
+    host_error_t err;
+    cinfo.err = jpeg_std_error(&err.mgr);
+    err.mgr.error_exit = host_error_exit;
+    if (setjmp(err.env))
+    {
+        jpeg_destroy_decompress(&cinfo);
+        return JDR_FMT1;
+    }
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, input, input_size);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.dct_method = JDCT_ISLOW;
+    jpeg_start_decompress(&cinfo);
+
+    size_t stride = (size_t)jd->width * 3;
+    if (!grow(&pixels, &pixels_cap, stride * jd->height))
+    {
+        jpeg_destroy_decompress(&cinfo);
+        return JDR_MEM1;
+    }
+    while (cinfo.output_scanline < cinfo.output_height)
+    {
+        JSAMPROW row = pixels + cinfo.output_scanline * stride;
+        jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+
+    uint32_t mx = jd->msx * 8;
+    uint32_t my = jd->msy * 8;
+    uint8_t block[16 * 16 * 3];
+    for (uint32_t y = 0; y < jd->height; y += my)
+    {
+        for (uint32_t x = 0; x < jd->width; x += mx)
+        {
+            uint32_t rx = (x + mx <= jd->width ? mx : jd->width - x) >> scale;
+            uint32_t ry = (y + my <= jd->height ? my : jd->height - y) >> scale;
+            if (rx == 0 || ry == 0)
+            {
+                continue;
+            }
+
+            uint8_t *dst = block;
+            for (uint32_t by = 0; by < ry; by++)
+            {
+                const uint8_t *src = pixels + (y + (by << scale)) * stride + x * 3;
+                for (uint32_t bx = 0; bx < rx; bx++, dst += 3)
+                {
+                    memcpy(dst, src + (bx << scale) * 3, 3);
+                }
+            }
+
+            JRECT rect;
+            rect.left = x >> scale;
+            rect.right = rect.left + rx - 1;
+            rect.top = y >> scale;
+            rect.bottom = rect.top + ry - 1;
+            if (!outfunc(jd, block, &rect))
+            {
+                return JDR_INTR;
+            }
+        }
+    }
+
+    return JDR_OK;
+}